@@ -71,6 +71,7 @@
  * @CHAFA_DITHER_MODE_NONE: No dithering.
  * @CHAFA_DITHER_MODE_ORDERED: Ordered dithering (Bayer or similar).
  * @CHAFA_DITHER_MODE_DIFFUSION: Error diffusion dithering (Floyd-Steinberg or similar).
+ * @CHAFA_DITHER_MODE_NOISE: Noise pattern dithering (blue noise or similar). Since 1.14.
  * @CHAFA_DITHER_MODE_MAX: Last supported dither mode plus one.
  **/
 
@@ -83,11 +84,20 @@
  * @CHAFA_PIXEL_MODE_MAX: Last supported pixel mode plus one.
  **/
 
+/**
+ * ChafaTransmissionMedium:
+ * @CHAFA_TRANSMISSION_MEDIUM_DIRECT: Pixel data is embedded in the output.
+ * @CHAFA_TRANSMISSION_MEDIUM_TEMP_FILE: Pixel data is written to a temporary file, and its path is embedded in the output.
+ * @CHAFA_TRANSMISSION_MEDIUM_SHARED_MEMORY: Pixel data is written to a POSIX shared memory object, and its name is embedded in the output.
+ * @CHAFA_TRANSMISSION_MEDIUM_MAX: Last supported transmission medium plus one.
+ **/
+
 /**
  * ChafaOptimizations:
  * @CHAFA_OPTIMIZATION_REUSE_ATTRIBUTES: Suppress redundant SGR control sequences.
- * @CHAFA_OPTIMIZATION_SKIP_CELLS: Reserved for future use.
+ * @CHAFA_OPTIMIZATION_SKIP_CELLS: Skip cells that are fully transparent, or unchanged from the previous frame, by moving the cursor past them. Also leaves unchanged bands out of sixel animations with palette reuse, and unchanged tiles out of stored Kitty images. See chafa_canvas_print_delta().
  * @CHAFA_OPTIMIZATION_REPEAT_CELLS: Use REP sequence to compress repeated runs of similar cells.
+ * @CHAFA_OPTIMIZATION_SWAP_COLORS: Print cells with inverse symbols, swapped colors or the invert attribute when that takes fewer bytes. Requires #CHAFA_OPTIMIZATION_REUSE_ATTRIBUTES, and currently only applies to the 256- and 240-color modes.
  * @CHAFA_OPTIMIZATION_NONE: All optimizations disabled.
  * @CHAFA_OPTIMIZATION_ALL: All optimizations enabled.
  **/
@@ -106,6 +116,7 @@ chafa_canvas_config_init (ChafaCanvasConfig *canvas_config)
     canvas_config->color_extractor = CHAFA_COLOR_EXTRACTOR_AVERAGE;
     canvas_config->color_space = CHAFA_COLOR_SPACE_RGB;
     canvas_config->pixel_mode = CHAFA_PIXEL_MODE_SYMBOLS;
+    canvas_config->transmission_medium = CHAFA_TRANSMISSION_MEDIUM_DIRECT;
     canvas_config->width = 80;
     canvas_config->height = 24;
     canvas_config->cell_width = 8;
@@ -937,3 +948,295 @@ chafa_canvas_config_set_fg_only_enabled (ChafaCanvasConfig *config, gboolean fg_
 
     config->fg_only_enabled = fg_only_enabled;
 }
+
+/**
+ * chafa_canvas_config_get_stats_enabled:
+ * @config: A #ChafaCanvasConfig
+ *
+ * Queries whether canvases created with this configuration collect
+ * timing and cell statistics. See chafa_canvas_get_stage_time().
+ *
+ * Returns: %TRUE if statistics are collected, %FALSE otherwise.
+ *
+ * Since: 1.14
+ **/
+gboolean
+chafa_canvas_config_get_stats_enabled (const ChafaCanvasConfig *config)
+{
+    g_return_val_if_fail (config != NULL, FALSE);
+    g_return_val_if_fail (config->refs > 0, FALSE);
+
+    return config->stats_enabled;
+}
+
+/**
+ * chafa_canvas_config_set_stats_enabled:
+ * @config: A #ChafaCanvasConfig
+ * @stats_enabled: Whether to collect statistics
+ *
+ * Indicates whether canvases created with this configuration should
+ * record the time spent in each processing stage and count the cells
+ * handled by each symbol selection path. The results can be retrieved
+ * with chafa_canvas_get_stage_time() and chafa_canvas_get_counter().
+ *
+ * This is off by default, since it adds a small amount of overhead.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_config_set_stats_enabled (ChafaCanvasConfig *config, gboolean stats_enabled)
+{
+    g_return_if_fail (config != NULL);
+    g_return_if_fail (config->refs > 0);
+
+    config->stats_enabled = stats_enabled;
+}
+
+/**
+ * chafa_canvas_config_get_palette_reuse_enabled:
+ * @config: A #ChafaCanvasConfig
+ *
+ * Queries whether canvases created with this configuration keep their
+ * generated palette across draws. See
+ * chafa_canvas_config_set_palette_reuse_enabled().
+ *
+ * Returns: %TRUE if palettes are reused, %FALSE otherwise.
+ *
+ * Since: 1.14
+ **/
+gboolean
+chafa_canvas_config_get_palette_reuse_enabled (const ChafaCanvasConfig *config)
+{
+    g_return_val_if_fail (config != NULL, FALSE);
+    g_return_val_if_fail (config->refs > 0, FALSE);
+
+    return config->palette_reuse_enabled;
+}
+
+/**
+ * chafa_canvas_config_set_palette_reuse_enabled:
+ * @config: A #ChafaCanvasConfig
+ * @palette_reuse_enabled: Whether to reuse palettes across draws
+ *
+ * Indicates whether canvases should keep the palette generated for one
+ * draw and use it for subsequent ones. This is meant for animations
+ * drawn into the same canvas frame by frame. It saves time and prevents
+ * colors from flickering between frames.
+ *
+ * Palettes only apply to sixel output. The palette is regenerated when
+ * the measured quantization error of a new frame grows well beyond
+ * what it was for the frame the palette was made for. Unchanged palettes
+ * are not sent again when printing. This requires a terminal that shares
+ * sixel color registers between images.
+ *
+ * This is off by default.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_config_set_palette_reuse_enabled (ChafaCanvasConfig *config, gboolean palette_reuse_enabled)
+{
+    g_return_if_fail (config != NULL);
+    g_return_if_fail (config->refs > 0);
+
+    config->palette_reuse_enabled = palette_reuse_enabled;
+}
+
+/**
+ * chafa_canvas_config_get_compression_level:
+ * @config: A #ChafaCanvasConfig
+ *
+ * Returns the compression level applied to pixel data in output. See
+ * chafa_canvas_config_set_compression_level().
+ *
+ * Returns: The compression level, in the range [0..9]
+ *
+ * Since: 1.14
+ **/
+gint
+chafa_canvas_config_get_compression_level (const ChafaCanvasConfig *config)
+{
+    g_return_val_if_fail (config != NULL, 0);
+    g_return_val_if_fail (config->refs > 0, 0);
+
+    return config->compression_level;
+}
+
+/**
+ * chafa_canvas_config_set_compression_level:
+ * @config: A #ChafaCanvasConfig
+ * @compression_level: Compression level, in the range [0..9]
+ *
+ * Sets the zlib compression level to apply to pixel data in output. 1 is
+ * the fastest and 9 produces the smallest output. 0 disables compression.
+ *
+ * This affects #CHAFA_PIXEL_MODE_KITTY, where it requires the terminal to
+ * support #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_COMPRESSED_IMAGE_V1, and
+ * #CHAFA_PIXEL_MODE_ITERM2, where the image is sent as a Deflate-compressed
+ * TIFF. Large images are compressed in parallel, as independent blocks. If
+ * Chafa was built without zlib, this setting has no effect.
+ *
+ * Compression is off by default.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_config_set_compression_level (ChafaCanvasConfig *config, gint compression_level)
+{
+    g_return_if_fail (config != NULL);
+    g_return_if_fail (config->refs > 0);
+
+    config->compression_level = CLAMP (compression_level, 0, 9);
+}
+
+/**
+ * chafa_canvas_config_get_transmission_medium:
+ * @config: A #ChafaCanvasConfig
+ *
+ * Returns the medium used to transfer pixel data to the terminal. See
+ * chafa_canvas_config_set_transmission_medium().
+ *
+ * Returns: The #ChafaTransmissionMedium in use
+ *
+ * Since: 1.14
+ **/
+ChafaTransmissionMedium
+chafa_canvas_config_get_transmission_medium (const ChafaCanvasConfig *config)
+{
+    g_return_val_if_fail (config != NULL, CHAFA_TRANSMISSION_MEDIUM_DIRECT);
+    g_return_val_if_fail (config->refs > 0, CHAFA_TRANSMISSION_MEDIUM_DIRECT);
+
+    return config->transmission_medium;
+}
+
+/**
+ * chafa_canvas_config_set_transmission_medium:
+ * @config: A #ChafaCanvasConfig
+ * @transmission_medium: A #ChafaTransmissionMedium
+ *
+ * Sets the medium used to transfer pixel data to the terminal. Temporary
+ * files and shared memory avoid pushing large amounts of encoded data
+ * through the terminal, but only work if the terminal runs on the same
+ * host and reads the output as it's being printed. Don't use them if the
+ * output will be saved for later.
+ *
+ * This currently only affects #CHAFA_PIXEL_MODE_KITTY, and requires the
+ * terminal to support #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_FILE_IMAGE_V1
+ * or #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_SHM_IMAGE_V1 respectively. If
+ * the medium is unsupported or fails, pixel data will be embedded in the
+ * output as usual.
+ *
+ * The default is #CHAFA_TRANSMISSION_MEDIUM_DIRECT.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_config_set_transmission_medium (ChafaCanvasConfig *config, ChafaTransmissionMedium transmission_medium)
+{
+    g_return_if_fail (config != NULL);
+    g_return_if_fail (config->refs > 0);
+    g_return_if_fail (transmission_medium < CHAFA_TRANSMISSION_MEDIUM_MAX);
+
+    config->transmission_medium = transmission_medium;
+}
+
+/**
+ * chafa_canvas_config_get_time_budget:
+ * @config: A #ChafaCanvasConfig
+ *
+ * Returns the time budget for picking symbols and colors on each draw, as
+ * set with chafa_canvas_config_set_time_budget().
+ *
+ * Returns: The time budget in microseconds, or 0 if disabled
+ *
+ * Since: 1.14
+ **/
+gint
+chafa_canvas_config_get_time_budget (const ChafaCanvasConfig *config)
+{
+    g_return_val_if_fail (config != NULL, 0);
+    g_return_val_if_fail (config->refs > 0, 0);
+
+    return config->time_budget_us;
+}
+
+/**
+ * chafa_canvas_config_set_time_budget:
+ * @config: A #ChafaCanvasConfig
+ * @time_budget_us: Time budget in microseconds, or 0 to disable
+ *
+ * Sets a target for the time spent picking symbols and colors each time
+ * new pixels are drawn into the canvas in #CHAFA_PIXEL_MODE_SYMBOLS. This
+ * is useful for live video, where meeting a frame deadline matters more
+ * than a fixed level of quality.
+ *
+ * When set, the canvas times each draw and adjusts its effective work
+ * factor for the next one, trading quality for speed. The work factor set
+ * with chafa_canvas_config_set_work_factor() is the upper limit. At the
+ * lowest setting, wide symbols are no longer considered either. The
+ * current effective work factor can be queried with
+ * chafa_canvas_get_work_factor().
+ *
+ * The default is 0, which keeps the work factor fixed.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_config_set_time_budget (ChafaCanvasConfig *config, gint time_budget_us)
+{
+    g_return_if_fail (config != NULL);
+    g_return_if_fail (config->refs > 0);
+    g_return_if_fail (time_budget_us >= 0);
+
+    config->time_budget_us = time_budget_us;
+}
+
+/**
+ * chafa_canvas_config_get_color_tolerance:
+ * @config: A #ChafaCanvasConfig
+ *
+ * Returns the color tolerance set with
+ * chafa_canvas_config_set_color_tolerance().
+ *
+ * Returns: The color tolerance, or 0 if output is lossless
+ *
+ * Since: 1.14
+ **/
+gint
+chafa_canvas_config_get_color_tolerance (const ChafaCanvasConfig *config)
+{
+    g_return_val_if_fail (config != NULL, 0);
+    g_return_val_if_fail (config->refs > 0, 0);
+
+    return config->color_tolerance;
+}
+
+/**
+ * chafa_canvas_config_set_color_tolerance:
+ * @config: A #ChafaCanvasConfig
+ * @color_tolerance: Tolerance in color channel steps, from 0 to 255
+ *
+ * Allows the canvas to deviate from the best cells it can find in
+ * #CHAFA_PIXEL_MODE_SYMBOLS in order to produce less output. Within the
+ * tolerance, cells will take on their left neighbor's colors so runs of
+ * attributes can be extended, keep their contents from the previous draw
+ * when the new pixels are close enough, and have truecolor values rounded
+ * to coarser steps.
+ *
+ * The tolerance is roughly the mean deviation per color channel and pixel
+ * that each cell may pick up on top of its original error. Small values,
+ * like 4 to 8, are hard to spot in moving images.
+ *
+ * The default is 0, which disables lossy output.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_config_set_color_tolerance (ChafaCanvasConfig *config, gint color_tolerance)
+{
+    g_return_if_fail (config != NULL);
+    g_return_if_fail (config->refs > 0);
+    g_return_if_fail (color_tolerance >= 0 && color_tolerance <= 255);
+
+    config->color_tolerance = color_tolerance;
+}
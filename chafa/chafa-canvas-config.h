@@ -74,6 +74,7 @@ typedef enum
     CHAFA_DITHER_MODE_NONE,
     CHAFA_DITHER_MODE_ORDERED,
     CHAFA_DITHER_MODE_DIFFUSION,
+    CHAFA_DITHER_MODE_NOISE,
 
     CHAFA_DITHER_MODE_MAX
 }
@@ -92,6 +93,18 @@ typedef enum
 }
 ChafaPixelMode;
 
+/* Transmission mediums */
+
+typedef enum
+{
+    CHAFA_TRANSMISSION_MEDIUM_DIRECT,
+    CHAFA_TRANSMISSION_MEDIUM_TEMP_FILE,
+    CHAFA_TRANSMISSION_MEDIUM_SHARED_MEMORY,
+
+    CHAFA_TRANSMISSION_MEDIUM_MAX
+}
+ChafaTransmissionMedium;
+
 /* Sequence optimization flags. When enabled, these may produce more compact
  * output at the cost of reduced compatibility and increased CPU use. Output
  * quality is unaffected. */
@@ -101,6 +114,7 @@ typedef enum
     CHAFA_OPTIMIZATION_REUSE_ATTRIBUTES = (1 << 0),
     CHAFA_OPTIMIZATION_SKIP_CELLS = (1 << 1),
     CHAFA_OPTIMIZATION_REPEAT_CELLS = (1 << 2),
+    CHAFA_OPTIMIZATION_SWAP_COLORS = (1 << 3),
 
     CHAFA_OPTIMIZATION_NONE = 0,
     CHAFA_OPTIMIZATION_ALL = 0x7fffffff
@@ -210,6 +224,36 @@ gboolean chafa_canvas_config_get_fg_only_enabled (const ChafaCanvasConfig *confi
 CHAFA_AVAILABLE_IN_1_8
 void chafa_canvas_config_set_fg_only_enabled (ChafaCanvasConfig *config, gboolean fg_only_enabled);
 
+CHAFA_AVAILABLE_IN_1_14
+gboolean chafa_canvas_config_get_stats_enabled (const ChafaCanvasConfig *config);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_config_set_stats_enabled (ChafaCanvasConfig *config, gboolean stats_enabled);
+
+CHAFA_AVAILABLE_IN_1_14
+gboolean chafa_canvas_config_get_palette_reuse_enabled (const ChafaCanvasConfig *config);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_config_set_palette_reuse_enabled (ChafaCanvasConfig *config, gboolean palette_reuse_enabled);
+
+CHAFA_AVAILABLE_IN_1_14
+gint chafa_canvas_config_get_compression_level (const ChafaCanvasConfig *config);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_config_set_compression_level (ChafaCanvasConfig *config, gint compression_level);
+
+CHAFA_AVAILABLE_IN_1_14
+ChafaTransmissionMedium chafa_canvas_config_get_transmission_medium (const ChafaCanvasConfig *config);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_config_set_transmission_medium (ChafaCanvasConfig *config, ChafaTransmissionMedium transmission_medium);
+
+CHAFA_AVAILABLE_IN_1_14
+gint chafa_canvas_config_get_time_budget (const ChafaCanvasConfig *config);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_config_set_time_budget (ChafaCanvasConfig *config, gint time_budget_us);
+
+CHAFA_AVAILABLE_IN_1_14
+gint chafa_canvas_config_get_color_tolerance (const ChafaCanvasConfig *config);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_config_set_color_tolerance (ChafaCanvasConfig *config, gint color_tolerance);
+
 G_END_DECLS
 
 #endif /* __CHAFA_CANVAS_CONFIG_H__ */
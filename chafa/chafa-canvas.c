@@ -20,14 +20,19 @@
 #include "config.h"
 
 #include <math.h>
+#include <stdlib.h>  /* qsort */
 #include <string.h>
 #include <glib.h>
 #include "chafa.h"
 #include "internal/chafa-batch.h"
+#include "internal/chafa-block-cache.h"
 #include "internal/chafa-canvas-internal.h"
 #include "internal/chafa-canvas-printer.h"
+#include "internal/chafa-cell-cache.h"
+#include "internal/chafa-opencl.h"
 #include "internal/chafa-private.h"
 #include "internal/chafa-pixops.h"
+#include "internal/chafa-scratch.h"
 #include "internal/chafa-work-cell.h"
 #include "internal/smolscale/smolscale.h"
 
@@ -188,8 +193,10 @@ eval_symbol_colors_wide (ChafaCanvas *canvas, ChafaWorkCell *wcell_a, ChafaWorkC
                                  part_eval [1].colors.colors [CHAFA_COLOR_PAIR_BG]);
 }
 
+/* Stops early and returns a partial sum once the error reaches max_error */
 static gint
-calc_error_plain (const ChafaPixel *block, const ChafaColorPair *color_pair, const guint8 *cov)
+calc_error_plain (const ChafaPixel *block, const ChafaColorPair *color_pair, const guint8 *cov,
+                  gint max_error)
 {
     gint error = 0;
     gint i;
@@ -200,17 +207,25 @@ calc_error_plain (const ChafaPixel *block, const ChafaColorPair *color_pair, con
         const ChafaPixel *p0 = block++;
 
         error += chafa_color_diff_fast (&color_pair->colors [p], &p0->col);
+
+        if ((i % CHAFA_SYMBOL_WIDTH_PIXELS) == CHAFA_SYMBOL_WIDTH_PIXELS - 1
+            && error >= max_error)
+            break;
     }
 
     return error;
 }
 
+/* Since the error is a sum of non-negative terms, the calculation can stop
+ * as soon as it reaches max_error. The result is then some value no less
+ * than max_error, which is all the caller needs to reject the symbol. */
 static void
 eval_symbol_error (const ChafaWorkCell *wcell,
                    const ChafaSymbol *sym, SymbolEval *eval,
                    const ChafaPalette *fg_palette,
                    const ChafaPalette *bg_palette,
-                   ChafaColorSpace color_space)
+                   ChafaColorSpace color_space,
+                   gint max_error)
 {
     const guint8 *covp = (guint8 *) &sym->coverage [0];
     ChafaColorPair pair;
@@ -241,22 +256,34 @@ eval_symbol_error (const ChafaWorkCell *wcell,
         pair = eval->colors;
     }
 
+#ifdef HAVE_AVX2_INTRINSICS
+    if (chafa_have_avx2 ())
+        error = calc_error_avx2 (wcell->pixels, &pair, covp);
+    else
+#endif
 #ifdef HAVE_SSE41_INTRINSICS
     if (chafa_have_sse41 ())
-        error = calc_error_sse41 (wcell->pixels, &pair, covp);
+        error = calc_error_sse41 (wcell->pixels, &pair, covp, max_error);
     else
 #endif
-        error = calc_error_plain (wcell->pixels, &pair, covp);
+#ifdef HAVE_NEON_INTRINSICS
+    if (chafa_have_neon ())
+        error = calc_error_neon (wcell->pixels, &pair, covp, max_error);
+    else
+#endif
+        error = calc_error_plain (wcell->pixels, &pair, covp, max_error);
 
     eval->error = error;
 }
 
+/* max_error applies to the sum of both halves */
 static void
 eval_symbol_error_wide (const ChafaWorkCell *wcell_a, const ChafaWorkCell *wcell_b,
                         const ChafaSymbol2 *sym, SymbolEval2 *wide_eval,
                         const ChafaPalette *fg_palette,
                         const ChafaPalette *bg_palette,
-                        ChafaColorSpace color_space)
+                        ChafaColorSpace color_space,
+                        gint max_error)
 {
     SymbolEval eval [2];
 
@@ -264,41 +291,172 @@ eval_symbol_error_wide (const ChafaWorkCell *wcell_a, const ChafaWorkCell *wcell
     eval [1].colors = wide_eval->colors;
 
     eval_symbol_error (wcell_a, &sym->sym [0], &eval [0],
-                       fg_palette, bg_palette, color_space);
-    eval_symbol_error (wcell_b, &sym->sym [1], &eval [1],
-                       fg_palette, bg_palette, color_space);
+                       fg_palette, bg_palette, color_space, max_error);
+
+    /* If the left half alone is too much, don't bother with the right */
+    if (eval [0].error < max_error)
+        eval_symbol_error (wcell_b, &sym->sym [1], &eval [1],
+                           fg_palette, bg_palette, color_space,
+                           max_error - eval [0].error);
+    else
+        eval [1].error = 0;
 
     wide_eval->error [0] = eval [0].error;
     wide_eval->error [1] = eval [1].error;
 }
 
+/* The squared error of a set of pixels against a single color, expanded as
+ * sum ((p - c)^2) = sum (p^2) - 2 c.sum (p) + n c^2 */
+static gint
+calc_sums_error (const ChafaColorSums *sums, const ChafaColor *col)
+{
+    return sums->sq
+        - 2 * (col->ch [0] * sums->ch [0] + col->ch [1] * sums->ch [1] + col->ch [2] * sums->ch [2])
+        + sums->n * (col->ch [0] * col->ch [0] + col->ch [1] * col->ch [1] + col->ch [2] * col->ch [2]);
+}
+
 static void
-eval_symbol (ChafaCanvas *canvas, ChafaWorkCell *wcell, gint sym_index,
-             gint *best_sym_index_out, SymbolEval *best_eval_inout)
+add_sums (ChafaColorSums *dest, const ChafaColorSums *src)
 {
-    const ChafaSymbol *sym;
-    SymbolEval eval;
+    gint ch;
 
-    sym = &canvas->config.symbol_map.symbols [sym_index];
+    for (ch = 0; ch < 4; ch++)
+        dest->ch [ch] += src->ch [ch];
+    dest->sq += src->sq;
+    dest->n += src->n;
+}
 
-    if (canvas->config.fg_only_enabled)
+/* Picks the palette color with the least error for a set of pixels. That's
+ * the one nearest the set's exact mean, so this gives what quantizing the
+ * mean color would, without the lookup. The alpha channel is carried over
+ * from the mean, so the cell colors come out the same when they're
+ * quantized for real. */
+static ChafaColor
+pick_color_from_sums (ChafaCanvas *canvas, const ChafaPalette *palette,
+                      const ChafaPaletteTerms *terms, const ChafaColorSums *sums)
+{
+    ChafaColor col = { { 0 } };
+    gint best_error = G_MAXINT;
+    gint best = 0;
+    gint i;
+
+    if (sums->n == 0)
+        return col;
+
+    if (sums->ch [3] < chafa_palette_get_alpha_threshold (palette) * sums->n)
     {
-        eval.colors = canvas->default_colors;
+        col = *chafa_palette_get_color (palette, canvas->config.color_space,
+                                        chafa_palette_get_transparent_index (palette));
     }
     else
     {
-        eval_symbol_colors (canvas, wcell, sym, &eval);
+        for (i = 0; i < terms->n_colors; i++)
+        {
+            const ChafaColor *c = &terms->colors [i];
+            gint error = sums->n * terms->sq [i]
+                - 2 * (c->ch [0] * sums->ch [0] + c->ch [1] * sums->ch [1] + c->ch [2] * sums->ch [2]);
+
+            if (error < best_error)
+            {
+                best_error = error;
+                best = i;
+            }
+        }
+
+        col = terms->colors [best];
+    }
+
+    col.ch [3] = sums->ch [3] / sums->n;
+    return col;
+}
+
+/* Scores a symbol against the fixed palettes straight from its pixel sums,
+ * instead of quantizing its colors and comparing every pixel */
+static void
+eval_symbol_palette_terms (ChafaCanvas *canvas, ChafaWorkCell *wcell, const ChafaSymbol *sym,
+                           SymbolEval *eval)
+{
+    ChafaColorSums sums [2];
+    gint i;
+
+    chafa_work_cell_get_sums_for_symbol (wcell, sym,
+                                         &sums [CHAFA_COLOR_PAIR_FG],
+                                         &sums [CHAFA_COLOR_PAIR_BG]);
+
+    eval->colors.colors [CHAFA_COLOR_PAIR_FG] =
+        pick_color_from_sums (canvas, &canvas->fg_palette, &canvas->fg_terms,
+                              &sums [CHAFA_COLOR_PAIR_FG]);
+    eval->colors.colors [CHAFA_COLOR_PAIR_BG] =
+        pick_color_from_sums (canvas, &canvas->bg_palette, &canvas->bg_terms,
+                              &sums [CHAFA_COLOR_PAIR_BG]);
+
+    eval->error = 0;
+    for (i = 0; i < 2; i++)
+        eval->error += calc_sums_error (&sums [i], &eval->colors.colors [i]);
+}
+
+/* Like eval_symbol_palette_terms (), with both halves sharing colors */
+static void
+eval_symbol_palette_terms_wide (ChafaCanvas *canvas, ChafaWorkCell *wcell_a, ChafaWorkCell *wcell_b,
+                                const ChafaSymbol2 *sym, SymbolEval2 *eval)
+{
+    ChafaColorSums sums [2] [2];
+    ChafaColorSums both;
+    gint i;
+
+    chafa_work_cell_get_sums_for_symbol (wcell_a, &sym->sym [0],
+                                         &sums [0] [CHAFA_COLOR_PAIR_FG],
+                                         &sums [0] [CHAFA_COLOR_PAIR_BG]);
+    chafa_work_cell_get_sums_for_symbol (wcell_b, &sym->sym [1],
+                                         &sums [1] [CHAFA_COLOR_PAIR_FG],
+                                         &sums [1] [CHAFA_COLOR_PAIR_BG]);
+
+    both = sums [0] [CHAFA_COLOR_PAIR_FG];
+    add_sums (&both, &sums [1] [CHAFA_COLOR_PAIR_FG]);
+    eval->colors.colors [CHAFA_COLOR_PAIR_FG] =
+        pick_color_from_sums (canvas, &canvas->fg_palette, &canvas->fg_terms, &both);
+
+    both = sums [0] [CHAFA_COLOR_PAIR_BG];
+    add_sums (&both, &sums [1] [CHAFA_COLOR_PAIR_BG]);
+    eval->colors.colors [CHAFA_COLOR_PAIR_BG] =
+        pick_color_from_sums (canvas, &canvas->bg_palette, &canvas->bg_terms, &both);
+
+    for (i = 0; i < 2; i++)
+    {
+        eval->error [i] =
+            calc_sums_error (&sums [i] [CHAFA_COLOR_PAIR_FG], &eval->colors.colors [CHAFA_COLOR_PAIR_FG])
+            + calc_sums_error (&sums [i] [CHAFA_COLOR_PAIR_BG], &eval->colors.colors [CHAFA_COLOR_PAIR_BG]);
     }
+}
+
+static void
+eval_symbol (ChafaCanvas *canvas, ChafaWorkCell *wcell, gint sym_index,
+             gint *best_sym_index_out, SymbolEval *best_eval_inout)
+{
+    const ChafaSymbol *sym;
+    SymbolEval eval;
 
-    if (canvas->use_quantized_error)
+    sym = &canvas->config.symbol_map.symbols [sym_index];
+
+    if (canvas->use_palette_terms)
     {
-        eval_symbol_error (wcell, sym, &eval, &canvas->fg_palette,
-                           &canvas->bg_palette, canvas->config.color_space);
+        eval_symbol_palette_terms (canvas, wcell, sym, &eval);
     }
     else
     {
-        eval_symbol_error (wcell, sym, &eval, NULL, NULL,
-                           canvas->config.color_space);
+        if (canvas->config.fg_only_enabled)
+            eval.colors = canvas->default_colors;
+        else
+            eval_symbol_colors (canvas, wcell, sym, &eval);
+
+        if (canvas->use_quantized_error)
+            eval_symbol_error (wcell, sym, &eval, &canvas->fg_palette,
+                               &canvas->bg_palette, canvas->config.color_space,
+                               best_eval_inout->error);
+        else
+            eval_symbol_error (wcell, sym, &eval, NULL, NULL,
+                               canvas->config.color_space,
+                               best_eval_inout->error);
     }
 
     if (eval.error < best_eval_inout->error)
@@ -317,35 +475,36 @@ eval_symbol_wide (ChafaCanvas *canvas, ChafaWorkCell *wcell_a, ChafaWorkCell *wc
 
     sym2 = &canvas->config.symbol_map.symbols2 [sym_index];
 
-    if (canvas->config.fg_only_enabled)
-    {
-        eval.colors = canvas->default_colors;
-    }
-    else
-    {
-        eval_symbol_colors_wide (canvas, wcell_a, wcell_b,
-                                 &sym2->sym [0],
-                                 &sym2->sym [1],
-                                 &eval);
-    }
-
-    if (canvas->use_quantized_error)
+    if (canvas->use_palette_terms)
     {
-        eval_symbol_error_wide (wcell_a, wcell_b,
-                                sym2,
-                                &eval,
-                                &canvas->fg_palette,
-                                &canvas->bg_palette,
-                                canvas->config.color_space);
+        eval_symbol_palette_terms_wide (canvas, wcell_a, wcell_b, sym2, &eval);
     }
     else
     {
-        eval_symbol_error_wide (wcell_a, wcell_b,
-                                sym2,
-                                &eval,
-                                NULL,
-                                NULL,
-                                canvas->config.color_space);
+        if (canvas->config.fg_only_enabled)
+            eval.colors = canvas->default_colors;
+        else
+            eval_symbol_colors_wide (canvas, wcell_a, wcell_b,
+                                     &sym2->sym [0],
+                                     &sym2->sym [1],
+                                     &eval);
+
+        if (canvas->use_quantized_error)
+            eval_symbol_error_wide (wcell_a, wcell_b,
+                                    sym2,
+                                    &eval,
+                                    &canvas->fg_palette,
+                                    &canvas->bg_palette,
+                                    canvas->config.color_space,
+                                    best_eval_inout->error [0] + best_eval_inout->error [1]);
+        else
+            eval_symbol_error_wide (wcell_a, wcell_b,
+                                    sym2,
+                                    &eval,
+                                    NULL,
+                                    NULL,
+                                    canvas->config.color_space,
+                                    best_eval_inout->error [0] + best_eval_inout->error [1]);
     }
 
     if (eval.error [0] + eval.error [1] < best_eval_inout->error [0] + best_eval_inout->error [1])
@@ -355,6 +514,65 @@ eval_symbol_wide (ChafaCanvas *canvas, ChafaWorkCell *wcell_a, ChafaWorkCell *wc
     }
 }
 
+static ChafaCanvasStats *
+stats_new (ChafaCanvas *canvas)
+{
+    ChafaCanvasStats *stats = g_new0 (ChafaCanvasStats, 1);
+
+    stats->n_symbol_tallies = canvas->config.symbol_map.n_symbols
+        + canvas->config.symbol_map.n_symbols2;
+    stats->symbol_picks = g_new0 (gint, MAX (stats->n_symbol_tallies, 1));
+    stats->symbol_candidates = g_new0 (gint, MAX (stats->n_symbol_tallies, 1));
+    return stats;
+}
+
+static void
+stats_free (ChafaCanvasStats *stats)
+{
+    if (!stats)
+        return;
+
+    g_free (stats->symbol_picks);
+    g_free (stats->symbol_candidates);
+    g_free (stats);
+}
+
+static void
+stats_reset (ChafaCanvasStats *stats)
+{
+    memset (stats->stage_times, 0, sizeof (stats->stage_times));
+    memset (stats->counters, 0, sizeof (stats->counters));
+    memset (stats->symbol_picks, 0, stats->n_symbol_tallies * sizeof (gint));
+    memset (stats->symbol_candidates, 0, stats->n_symbol_tallies * sizeof (gint));
+}
+
+/* Wide symbols are tallied after the narrow ones */
+static void
+tally_symbol_pick (ChafaCanvas *canvas, gint index, gboolean is_wide)
+{
+    if (!canvas->stats)
+        return;
+
+    if (is_wide)
+        index += canvas->config.symbol_map.n_symbols;
+    g_atomic_int_inc (&canvas->stats->symbol_picks [index]);
+}
+
+static void
+tally_symbol_candidates (ChafaCanvas *canvas, const ChafaCandidate *candidates, gint n_candidates,
+                         gboolean is_wide)
+{
+    gint ofs;
+    gint i;
+
+    if (!canvas->stats)
+        return;
+
+    ofs = is_wide ? canvas->config.symbol_map.n_symbols : 0;
+    for (i = 0; i < n_candidates; i++)
+        g_atomic_int_inc (&canvas->stats->symbol_candidates [ofs + candidates [i].symbol_index]);
+}
+
 static void
 pick_symbol_and_colors_slow (ChafaCanvas *canvas,
                              ChafaWorkCell *wcell,
@@ -366,11 +584,12 @@ pick_symbol_and_colors_slow (ChafaCanvas *canvas,
     gint best_symbol = -1;
     gint i;
 
-    /* Find best symbol. All symbols are candidates. */
+    /* Find best symbol. All symbols are candidates, but nothing can beat
+     * a perfect match. */
 
     best_eval.error = SYMBOL_ERROR_MAX;
 
-    for (i = 0; canvas->config.symbol_map.symbols [i].c != 0; i++)
+    for (i = 0; canvas->config.symbol_map.symbols [i].c != 0 && best_eval.error > 0; i++)
         eval_symbol (canvas, wcell, i, &best_symbol, &best_eval);
 
     chafa_leave_mmx ();  /* Make FPU happy again */
@@ -378,6 +597,7 @@ pick_symbol_and_colors_slow (ChafaCanvas *canvas,
     /* Output */
 
     g_assert (best_symbol >= 0);
+    tally_symbol_pick (canvas, best_symbol, FALSE);
 
     if (canvas->extract_colors && canvas->config.fg_only_enabled)
         eval_symbol_colors (canvas, wcell, &canvas->config.symbol_map.symbols [best_symbol], &best_eval);
@@ -402,11 +622,15 @@ pick_symbol_and_colors_wide_slow (ChafaCanvas *canvas,
     gint best_symbol = -1;
     gint i;
 
-    /* Find best symbol. All symbols are candidates. */
+    /* Find best symbol. All symbols are candidates, but nothing can beat
+     * a perfect match. */
 
     best_eval.error [0] = best_eval.error [1] = SYMBOL_ERROR_MAX;
 
-    for (i = 0; canvas->config.symbol_map.symbols2 [i].sym [0].c != 0; i++)
+    for (i = 0;
+         canvas->config.symbol_map.symbols2 [i].sym [0].c != 0
+         && best_eval.error [0] + best_eval.error [1] > 0;
+         i++)
         eval_symbol_wide (canvas, wcell_a, wcell_b, i, &best_symbol, &best_eval);
 
     chafa_leave_mmx ();  /* Make FPU happy again */
@@ -414,6 +638,7 @@ pick_symbol_and_colors_wide_slow (ChafaCanvas *canvas,
     /* Output */
 
     g_assert (best_symbol >= 0);
+    tally_symbol_pick (canvas, best_symbol, TRUE);
 
     if (canvas->extract_colors && canvas->config.fg_only_enabled)
         eval_symbol_colors_wide (canvas, wcell_a, wcell_b,
@@ -465,20 +690,50 @@ pick_symbol_and_colors_fast (ChafaCanvas *canvas,
                                       candidates, &n_candidates);
 
     g_assert (n_candidates > 0);
+    tally_symbol_candidates (canvas, candidates, n_candidates, FALSE);
 
     /* Find best candidate */
 
     best_symbol = -1;
     best_eval.error = SYMBOL_ERROR_MAX;
 
-    for (i = 0; i < n_candidates; i++)
-        eval_symbol (canvas, wcell, candidates [i].symbol_index, &best_symbol, &best_eval);
+#ifdef HAVE_AVX2_INTRINSICS
+    /* Score all the candidates in one pass for the common case */
+    if (chafa_have_avx2 ()
+        && canvas->config.color_extractor == CHAFA_COLOR_EXTRACTOR_AVERAGE
+        && !canvas->config.fg_only_enabled
+        && !canvas->use_quantized_error)
+    {
+        ChafaColorPair pairs [N_CANDIDATES_MAX];
+        gint errors [N_CANDIDATES_MAX];
+        gint n_evaluated;
 
-    chafa_leave_mmx ();  /* Make FPU happy again */
+        n_evaluated = chafa_eval_symbols_mean_avx2 (wcell->pixels, canvas->config.symbol_map.symbols,
+                                                    candidates, n_candidates, pairs, errors);
+
+        for (i = 0; i < n_evaluated; i++)
+        {
+            if (errors [i] < best_eval.error)
+            {
+                best_symbol = candidates [i].symbol_index;
+                best_eval.colors = pairs [i];
+                best_eval.error = errors [i];
+            }
+        }
+    }
+    else
+#endif
+    {
+        for (i = 0; i < n_candidates && best_eval.error > 0; i++)
+            eval_symbol (canvas, wcell, candidates [i].symbol_index, &best_symbol, &best_eval);
+
+        chafa_leave_mmx ();  /* Make FPU happy again */
+    }
 
     /* Output */
 
     g_assert (best_symbol >= 0);
+    tally_symbol_pick (canvas, best_symbol, FALSE);
 
     if (canvas->extract_colors && canvas->config.fg_only_enabled)
         eval_symbol_colors (canvas, wcell, &canvas->config.symbol_map.symbols [best_symbol], &best_eval);
@@ -490,6 +745,109 @@ pick_symbol_and_colors_fast (ChafaCanvas *canvas,
         *error_out = best_eval.error;
 }
 
+/* An inverted match swaps the pens. The default background is
+ * transparent, so it's made opaque when it goes in the foreground. */
+static void
+get_fixed_colors (const ChafaCanvas *canvas, gboolean is_inverted, ChafaColorPair *color_pair_out)
+{
+    *color_pair_out = canvas->default_colors;
+
+    if (is_inverted)
+    {
+        color_pair_out->colors [CHAFA_COLOR_PAIR_FG] = canvas->default_colors.colors [CHAFA_COLOR_PAIR_BG];
+        color_pair_out->colors [CHAFA_COLOR_PAIR_BG] = canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG];
+        color_pair_out->colors [CHAFA_COLOR_PAIR_FG].ch [3] = 0xff;
+    }
+}
+
+/* With fixed colors, which side of the divide each pixel falls on doesn't
+ * depend on the symbol. The bitmap is thresholded once, the symbol nearest
+ * to it in Hamming distance wins, and only its error is calculated. */
+static void
+pick_symbol_fixed_colors (ChafaCanvas *canvas,
+                          ChafaWorkCell *wcell,
+                          gunichar *sym_out,
+                          ChafaColorPair *color_pair_out,
+                          gint *error_out)
+{
+    ChafaCandidate candidate;
+    const ChafaSymbol *sym;
+    SymbolEval eval;
+    gint n_candidates = 1;
+
+    chafa_symbol_map_find_candidates (&canvas->config.symbol_map,
+                                      chafa_work_cell_to_bitmap (wcell, &canvas->default_colors),
+                                      canvas->consider_inverted,
+                                      &candidate, &n_candidates);
+
+    g_assert (n_candidates > 0);
+    tally_symbol_candidates (canvas, &candidate, 1, FALSE);
+    tally_symbol_pick (canvas, candidate.symbol_index, FALSE);
+
+    sym = &canvas->config.symbol_map.symbols [candidate.symbol_index];
+
+    get_fixed_colors (canvas, candidate.is_inverted, &eval.colors);
+
+    eval_symbol_error (wcell, sym, &eval, NULL, NULL,
+                       canvas->config.color_space, SYMBOL_ERROR_MAX);
+
+    if (canvas->extract_colors && canvas->config.fg_only_enabled)
+        eval_symbol_colors (canvas, wcell, sym, &eval);
+
+    *sym_out = sym->c;
+    *color_pair_out = eval.colors;
+
+    if (error_out)
+        *error_out = eval.error;
+}
+
+static void
+pick_symbol_fixed_colors_wide (ChafaCanvas *canvas,
+                               ChafaWorkCell *wcell_a,
+                               ChafaWorkCell *wcell_b,
+                               gunichar *sym_out,
+                               ChafaColorPair *color_pair_out,
+                               gint *error_a_out,
+                               gint *error_b_out)
+{
+    ChafaCandidate candidate;
+    const ChafaSymbol2 *sym2;
+    SymbolEval2 eval;
+    guint64 bitmaps [2];
+    gint n_candidates = 1;
+
+    bitmaps [0] = chafa_work_cell_to_bitmap (wcell_a, &canvas->default_colors);
+    bitmaps [1] = chafa_work_cell_to_bitmap (wcell_b, &canvas->default_colors);
+
+    chafa_symbol_map_find_wide_candidates (&canvas->config.symbol_map,
+                                           bitmaps,
+                                           canvas->consider_inverted,
+                                           &candidate, &n_candidates);
+
+    g_assert (n_candidates > 0);
+    tally_symbol_candidates (canvas, &candidate, 1, TRUE);
+    tally_symbol_pick (canvas, candidate.symbol_index, TRUE);
+
+    sym2 = &canvas->config.symbol_map.symbols2 [candidate.symbol_index];
+
+    get_fixed_colors (canvas, candidate.is_inverted, &eval.colors);
+
+    eval_symbol_error_wide (wcell_a, wcell_b, sym2, &eval, NULL, NULL,
+                            canvas->config.color_space, SYMBOL_ERROR_MAX);
+
+    if (canvas->extract_colors && canvas->config.fg_only_enabled)
+        eval_symbol_colors_wide (canvas, wcell_a, wcell_b,
+                                 &sym2->sym [0], &sym2->sym [1], &eval);
+
+    *sym_out = sym2->sym [0].c;
+    *color_pair_out = eval.colors;
+
+    if (error_a_out)
+        *error_a_out = eval.error [0];
+    if (error_b_out)
+        *error_b_out = eval.error [1];
+}
+
 static void
 pick_symbol_and_colors_wide_fast (ChafaCanvas *canvas,
                                   ChafaWorkCell *wcell_a,
@@ -535,13 +893,14 @@ pick_symbol_and_colors_wide_fast (ChafaCanvas *canvas,
                                            candidates, &n_candidates);
 
     g_assert (n_candidates > 0);
+    tally_symbol_candidates (canvas, candidates, n_candidates, TRUE);
 
     /* Find best candidate */
 
     best_symbol = -1;
     best_eval.error [0] = best_eval.error [1] = SYMBOL_ERROR_MAX;
 
-    for (i = 0; i < n_candidates; i++)
+    for (i = 0; i < n_candidates && best_eval.error [0] + best_eval.error [1] > 0; i++)
         eval_symbol_wide (canvas, wcell_a, wcell_b, candidates [i].symbol_index,
                           &best_symbol, &best_eval);
 
@@ -550,6 +909,7 @@ pick_symbol_and_colors_wide_fast (ChafaCanvas *canvas,
     /* Output */
 
     g_assert (best_symbol >= 0);
+    tally_symbol_pick (canvas, best_symbol, TRUE);
 
     if (canvas->extract_colors && canvas->config.fg_only_enabled)
         eval_symbol_colors_wide (canvas, wcell_a, wcell_b,
@@ -578,6 +938,86 @@ get_palette_color (ChafaCanvas *canvas, ChafaPalette *palette, gint index)
     return get_palette_color_with_color_space (palette, index, canvas->config.color_space);
 }
 
+static void
+cell_get_colors (ChafaCanvas *canvas, const ChafaCanvasCell *cell,
+                 gint *fg_out, gint *bg_out)
+{
+    gint fg = -1, bg = -1;
+
+    switch (canvas->config.canvas_mode)
+    {
+        case CHAFA_CANVAS_MODE_TRUECOLOR:
+            fg = packed_rgba_to_rgb (canvas, cell->fg_color);
+            bg = packed_rgba_to_rgb (canvas, cell->bg_color);
+            break;
+        case CHAFA_CANVAS_MODE_INDEXED_256:
+        case CHAFA_CANVAS_MODE_INDEXED_240:
+        case CHAFA_CANVAS_MODE_INDEXED_16:
+        case CHAFA_CANVAS_MODE_INDEXED_16_8:
+        case CHAFA_CANVAS_MODE_INDEXED_8:
+        case CHAFA_CANVAS_MODE_FGBG_BGFG:
+        case CHAFA_CANVAS_MODE_FGBG:
+            if (cell->fg_color == CHAFA_PALETTE_INDEX_BG
+                || cell->fg_color == CHAFA_PALETTE_INDEX_TRANSPARENT)
+                fg = -1;
+            else
+                fg = color_to_rgb (canvas,
+                                   *get_palette_color_with_color_space (&canvas->fg_palette, cell->fg_color,
+                                                                        CHAFA_COLOR_SPACE_RGB));
+            if (cell->bg_color == CHAFA_PALETTE_INDEX_BG
+                || cell->bg_color == CHAFA_PALETTE_INDEX_TRANSPARENT)
+                bg = -1;
+            else
+                bg = color_to_rgb (canvas,
+                                   *get_palette_color_with_color_space (&canvas->bg_palette, cell->bg_color,
+                                                                        CHAFA_COLOR_SPACE_RGB));
+            break;
+        case CHAFA_CANVAS_MODE_MAX:
+            g_assert_not_reached ();
+            break;
+    }
+
+    *fg_out = fg;
+    *bg_out = bg;
+}
+
+static void
+cell_get_raw_colors (const ChafaCanvas *canvas, const ChafaCanvasCell *cell,
+                     gint *fg_out, gint *bg_out)
+{
+    gint fg = -1, bg = -1;
+
+    switch (canvas->config.canvas_mode)
+    {
+        case CHAFA_CANVAS_MODE_TRUECOLOR:
+            fg = packed_rgba_to_rgb (canvas, cell->fg_color);
+            bg = packed_rgba_to_rgb (canvas, cell->bg_color);
+            break;
+        case CHAFA_CANVAS_MODE_INDEXED_256:
+        case CHAFA_CANVAS_MODE_INDEXED_240:
+        case CHAFA_CANVAS_MODE_INDEXED_16:
+        case CHAFA_CANVAS_MODE_INDEXED_16_8:
+        case CHAFA_CANVAS_MODE_INDEXED_8:
+            fg = cell->fg_color < 256 ? (gint) cell->fg_color : -1;
+            bg = cell->bg_color < 256 ? (gint) cell->bg_color : -1;
+            break;
+        case CHAFA_CANVAS_MODE_FGBG_BGFG:
+            fg = cell->fg_color == CHAFA_PALETTE_INDEX_FG ? 0 : -1;
+            bg = cell->bg_color == CHAFA_PALETTE_INDEX_FG ? 0 : -1;
+            break;
+        case CHAFA_CANVAS_MODE_FGBG:
+            fg = 0;
+            bg = -1;
+            break;
+        case CHAFA_CANVAS_MODE_MAX:
+            g_assert_not_reached ();
+            break;
+    }
+
+    *fg_out = fg;
+    *bg_out = bg;
+}
+
 static void
 apply_fill_fg_only (ChafaCanvas *canvas, const ChafaWorkCell *wcell, ChafaCanvasCell *cell)
 {
@@ -630,11 +1070,22 @@ apply_fill_fg_only (ChafaCanvas *canvas, const ChafaWorkCell *wcell, ChafaCanvas
     cell->c = canvas->config.fill_symbol_map.symbols [sym_cand.symbol_index].c;
 }
 
+/* Every cell whose mean maps to the same palette pair gets the same blends
+ * to choose from. Flat areas keep hitting one pair, so each row remembers
+ * the last one. */
+typedef struct
+{
+    gint16 index [2];
+    ChafaColor blends [CHAFA_SYMBOL_N_PIXELS + 1];
+    gboolean is_valid;
+}
+FillBlendCache;
+
 static void
-apply_fill (ChafaCanvas *canvas, const ChafaWorkCell *wcell, ChafaCanvasCell *cell)
+apply_fill (ChafaCanvas *canvas, const ChafaWorkCell *wcell, ChafaCanvasCell *cell,
+            FillBlendCache *blend_cache)
 {
     ChafaColor mean;
-    ChafaColor col [3];
     ChafaColorCandidates ccand;
     ChafaCandidate sym_cand;
     gint n_sym_cands = 1;
@@ -689,26 +1140,42 @@ apply_fill (ChafaCanvas *canvas, const ChafaWorkCell *wcell, ChafaCanvasCell *ce
         g_assert_not_reached ();
     }
 
-    col [0] = *get_palette_color (canvas, &canvas->fg_palette, ccand.index [0]);
-    col [1] = *get_palette_color (canvas, &canvas->fg_palette, ccand.index [1]);
+    if (!blend_cache->is_valid
+        || blend_cache->index [0] != ccand.index [0]
+        || blend_cache->index [1] != ccand.index [1])
+    {
+        ChafaColor col [2];
 
-    /* In FGBG modes, background and transparency is the same thing. Make
-     * sure we have two opaque colors for correct interpolation. */
-    if (canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG_BGFG
-        || canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG)
-        col [1].ch [3] = 0xff;
+        col [0] = *get_palette_color (canvas, &canvas->fg_palette, ccand.index [0]);
+        col [1] = *get_palette_color (canvas, &canvas->fg_palette, ccand.index [1]);
 
-    /* Make the primary color correspond to cell's BG pen, so mostly transparent
-     * cells will get a transparent BG; terminals typically don't support
-     * transparency in the FG pen. BG is also likely to cover a greater area. */
-    for (i = 0; i <= 64; i++)
-    {
-        col [2].ch [0] = (col [0].ch [0] * (64 - i) + col [1].ch [0] * i) / 64;
-        col [2].ch [1] = (col [0].ch [1] * (64 - i) + col [1].ch [1] * i) / 64;
-        col [2].ch [2] = (col [0].ch [2] * (64 - i) + col [1].ch [2] * i) / 64;
-        col [2].ch [3] = (col [0].ch [3] * (64 - i) + col [1].ch [3] * i) / 64;
+        /* In FGBG modes, background and transparency is the same thing. Make
+         * sure we have two opaque colors for correct interpolation. */
+        if (canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG_BGFG
+            || canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG)
+            col [1].ch [3] = 0xff;
 
-        error = chafa_color_diff_fast (&mean, &col [2]);
+        for (i = 0; i <= 64; i++)
+        {
+            ChafaColor *blend = &blend_cache->blends [i];
+
+            blend->ch [0] = (col [0].ch [0] * (64 - i) + col [1].ch [0] * i) / 64;
+            blend->ch [1] = (col [0].ch [1] * (64 - i) + col [1].ch [1] * i) / 64;
+            blend->ch [2] = (col [0].ch [2] * (64 - i) + col [1].ch [2] * i) / 64;
+            blend->ch [3] = (col [0].ch [3] * (64 - i) + col [1].ch [3] * i) / 64;
+        }
+
+        blend_cache->index [0] = ccand.index [0];
+        blend_cache->index [1] = ccand.index [1];
+        blend_cache->is_valid = TRUE;
+    }
+
+    /* Make the primary color correspond to cell's BG pen, so mostly transparent
+     * cells will get a transparent BG; terminals typically don't support
+     * transparency in the FG pen. BG is also likely to cover a greater area. */
+    for (i = 0; i <= 64; i++)
+    {
+        error = chafa_color_diff_fast (&mean, &blend_cache->blends [i]);
         if (error < best_error)
         {
             /* In FGBG mode there's no way to invert or set the BG color, so
@@ -835,6 +1302,8 @@ update_cell (ChafaCanvas *canvas, ChafaWorkCell *work_cell, ChafaCanvasCell *cel
 
     if (canvas->work_factor_int >= 8)
         pick_symbol_and_colors_slow (canvas, work_cell, &sym, &color_pair, &sym_error);
+    else if (canvas->fixed_colors)
+        pick_symbol_fixed_colors (canvas, work_cell, &sym, &color_pair, &sym_error);
     else
         pick_symbol_and_colors_fast (canvas, work_cell, &sym, &color_pair, &sym_error);
 
@@ -847,6 +1316,89 @@ update_cell (ChafaCanvas *canvas, ChafaWorkCell *work_cell, ChafaCanvasCell *cel
     return sym_error;
 }
 
+#ifdef HAVE_OPENCL
+
+/* Like update_cell (), but with the symbol and colors picked up front by
+ * pick_cells_opencl () */
+static gint
+update_cell_from_opencl_pick (ChafaCanvas *canvas, gint cx, gint cy, ChafaCanvasCell *cell_out)
+{
+    const ChafaOpenclPick *pick;
+
+    pick = &canvas->opencl_picks [(cy - canvas->update_y) * canvas->update_width
+                                  + cx - canvas->update_x];
+
+    tally_symbol_pick (canvas, pick->symbol_index, FALSE);
+
+    cell_out->c = canvas->config.symbol_map.symbols [pick->symbol_index].c;
+    update_cell_colors (canvas, cell_out, &pick->colors);
+
+    return pick->error;
+}
+
+#endif
+
+/* Cells whose channels don't vary more than this are treated as flat, and
+ * given the blank symbol in their mean color without a symbol search. At
+ * high work factors, only cells that are completely uniform qualify. */
+#define FLAT_CELL_RANGE_MAX 2
+
+/* Returns the cell's error if it was flat and has been filled in, or -1 if
+ * it needs the full treatment */
+static gint
+update_flat_cell (ChafaCanvas *canvas, const ChafaWorkCell *work_cell, ChafaCanvasCell *cell_out)
+{
+    ChafaColorPair color_pair;
+    gint error = 0;
+    gint i;
+
+    /* With fixed or quantized colors, the symbol search can do things we
+     * can't predict from the mean alone */
+    if (canvas->config.symbol_map.n_symbols == 0
+        || !canvas->extract_colors
+        || canvas->config.fg_only_enabled
+        || canvas->use_quantized_error)
+        return -1;
+
+    if (chafa_work_cell_get_max_channel_range (work_cell)
+        > (canvas->work_factor_int >= 8 ? 0 : FLAT_CELL_RANGE_MAX))
+        return -1;
+
+    chafa_work_cell_calc_mean_color (work_cell, &color_pair.colors [CHAFA_COLOR_PAIR_BG]);
+    color_pair.colors [CHAFA_COLOR_PAIR_FG] = color_pair.colors [CHAFA_COLOR_PAIR_BG];
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+        error += chafa_color_diff_fast (&color_pair.colors [CHAFA_COLOR_PAIR_BG],
+                                        &work_cell->pixels [i].col);
+
+    cell_out->c = canvas->blank_char;
+    update_cell_colors (canvas, cell_out, &color_pair);
+
+    return error;
+}
+
+/* Fills in a cell for the first pass of a progressive draw. There's no
+ * symbol search; the cell gets its mean color, and the fill pass can add
+ * some shading. Returns -1 if the cell needs the regular treatment, since
+ * without extracted colors the mean would show up as nothing. */
+static gint
+update_preview_cell (ChafaCanvas *canvas, const ChafaWorkCell *work_cell, ChafaCanvasCell *cell_out)
+{
+    ChafaColorPair color_pair;
+
+    if (!canvas->extract_colors || canvas->config.fg_only_enabled)
+        return -1;
+
+    chafa_work_cell_calc_mean_color (work_cell, &color_pair.colors [CHAFA_COLOR_PAIR_BG]);
+    color_pair.colors [CHAFA_COLOR_PAIR_FG] = color_pair.colors [CHAFA_COLOR_PAIR_BG];
+
+    /* A space makes the fill pass below consider the cell */
+    cell_out->c = ' ';
+    update_cell_colors (canvas, cell_out, &color_pair);
+
+    return SYMBOL_ERROR_MAX;
+}
+
 static void
 update_cells_wide (ChafaCanvas *canvas, ChafaWorkCell *work_cell_a, ChafaWorkCell *work_cell_b,
                    ChafaCanvasCell *cell_a_out, ChafaCanvasCell *cell_b_out,
@@ -864,6 +1416,10 @@ update_cells_wide (ChafaCanvas *canvas, ChafaWorkCell *work_cell_a, ChafaWorkCel
         pick_symbol_and_colors_wide_slow (canvas, work_cell_a, work_cell_b,
                                           &sym, &color_pair,
                                           error_a_out, error_b_out);
+    else if (canvas->fixed_colors)
+        pick_symbol_fixed_colors_wide (canvas, work_cell_a, work_cell_b,
+                                       &sym, &color_pair,
+                                       error_a_out, error_b_out);
     else
         pick_symbol_and_colors_wide_fast (canvas, work_cell_a, work_cell_b,
                                           &sym, &color_pair,
@@ -881,6 +1437,205 @@ update_cells_wide (ChafaCanvas *canvas, ChafaWorkCell *work_cell_a, ChafaWorkCel
         cell_b_out->c = cell_a_out->c;
 }
 
+/* A wide symbol must beat the two narrow ones it would replace, while
+ * sharing one color pair between both cells. That rarely happens when the
+ * narrow symbols are already close, so below this mean error per pixel we
+ * don't try, unless the work factor calls for an exhaustive search. */
+#define WIDE_GATE_PIXEL_ERROR 48
+
+static gboolean
+wide_symbol_can_win (const ChafaCanvas *canvas, gint narrow_error)
+{
+    /* The wide symbol has to be strictly better */
+    if (narrow_error == 0)
+        return FALSE;
+
+    if (canvas->work_factor_int >= 8)
+        return TRUE;
+
+    return narrow_error > WIDE_GATE_PIXEL_ERROR * CHAFA_SYMBOL_N_PIXELS * 2;
+}
+
+/* Changed cells are checked against their pixels again. This needs the
+ * symbol's shape, which we look up by char. Wide symbols aren't in the
+ * table, so they are left alone. */
+static const ChafaCharCoverage *
+lookup_char_coverage (const ChafaCanvas *canvas, gunichar c)
+{
+    gint lo = 0, hi = canvas->n_char_coverages;
+
+    while (lo < hi)
+    {
+        gint mid = (lo + hi) / 2;
+
+        if (canvas->char_coverages [mid].c < c)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo < canvas->n_char_coverages && canvas->char_coverages [lo].c == c)
+        return &canvas->char_coverages [lo];
+
+    return NULL;
+}
+
+/* Returns the cell's error, or -1 if it can't be evaluated. As with
+ * calc_error_plain (), the result is only exact if it's below max_error. */
+static gint
+calc_cell_error (ChafaCanvas *canvas, const ChafaWorkCell *wcell,
+                 const ChafaCanvasCell *cell, gint max_error)
+{
+    const ChafaCharCoverage *cc;
+    ChafaColorPair pair;
+
+    cc = lookup_char_coverage (canvas, cell->c);
+    if (!cc)
+        return -1;
+
+    if (canvas->config.canvas_mode == CHAFA_CANVAS_MODE_TRUECOLOR)
+    {
+        chafa_unpack_color (cell->fg_color, &pair.colors [CHAFA_COLOR_PAIR_FG]);
+        chafa_unpack_color (cell->bg_color, &pair.colors [CHAFA_COLOR_PAIR_BG]);
+    }
+    else
+    {
+        pair.colors [CHAFA_COLOR_PAIR_FG] = *get_palette_color (canvas, &canvas->fg_palette,
+                                                                cell->fg_color);
+        pair.colors [CHAFA_COLOR_PAIR_BG] = *get_palette_color (canvas, &canvas->bg_palette,
+                                                                cell->bg_color);
+    }
+
+    return calc_error_plain (wcell->pixels, &pair, cc->coverage, max_error);
+}
+
+/* The error doesn't account for alpha, so colors must not change between
+ * transparent and opaque */
+static gboolean
+same_transparency (const ChafaCanvas *canvas, guint32 a, guint32 b)
+{
+    if (canvas->config.canvas_mode == CHAFA_CANVAS_MODE_TRUECOLOR)
+        return (a >> 24) == (b >> 24);
+
+    return (a == CHAFA_PALETTE_INDEX_TRANSPARENT) == (b == CHAFA_PALETTE_INDEX_TRANSPARENT);
+}
+
+/* Replaces the cell with the candidate if its error is within max_error */
+static gboolean
+try_lossy_cell (ChafaCanvas *canvas, const ChafaWorkCell *wcell,
+                ChafaCanvasCell *cell, const ChafaCanvasCell *cand, gint max_error)
+{
+    gint error;
+
+    if (!same_transparency (canvas, cell->fg_color, cand->fg_color)
+        || !same_transparency (canvas, cell->bg_color, cand->bg_color))
+        return FALSE;
+
+    error = calc_cell_error (canvas, wcell, cand, max_error + 1);
+    if (error < 0 || error > max_error)
+        return FALSE;
+
+    *cell = *cand;
+    return TRUE;
+}
+
+static guint32
+round_packed_color (guint32 packed, gint step)
+{
+    ChafaColor col;
+    gint i;
+
+    chafa_unpack_color (packed, &col);
+
+    for (i = 0; i < 3; i++)
+        col.ch [i] = MIN ((col.ch [i] + step / 2) / step * step, 255);
+
+    return chafa_pack_color (&col);
+}
+
+/* Coarsest step truecolor channels may be rounded to */
+#define LOSSY_ROUND_STEP_MAX 32
+
+/* Trades some accuracy for less output, adding at most lossy_max_error to
+ * the cell's error. In order of preference, the cell is reverted to its
+ * contents from the previous draw (prev_cell, or NULL), which delta
+ * printing can skip; takes on its left neighbour's colors, extending the
+ * attribute run; or has its truecolor values rounded, which makes it
+ * likelier to match the cells after it. */
+static void
+apply_color_tolerance (ChafaCanvas *canvas, const ChafaWorkCell *wcell,
+                       ChafaCanvasCell *cell, const ChafaCanvasCell *left_cell,
+                       const ChafaCanvasCell *prev_cell, gint *counters)
+{
+    ChafaCanvasCell cand;
+    gint max_error;
+    gint step;
+
+    max_error = calc_cell_error (canvas, wcell, cell, G_MAXINT);
+    if (max_error < 0)
+        return;
+
+    max_error += canvas->lossy_max_error;
+
+    if (prev_cell && memcmp (cell, prev_cell, sizeof (*cell))
+        && try_lossy_cell (canvas, wcell, cell, prev_cell, max_error))
+    {
+        counters [CHAFA_CANVAS_COUNTER_CELLS_KEPT]++;
+        return;
+    }
+
+    if (left_cell && (cell->fg_color != left_cell->fg_color
+                      || cell->bg_color != left_cell->bg_color))
+    {
+        gboolean merged;
+
+        cand = *cell;
+        cand.fg_color = left_cell->fg_color;
+        cand.bg_color = left_cell->bg_color;
+        merged = try_lossy_cell (canvas, wcell, cell, &cand, max_error);
+
+        /* The background tends to carry over further */
+        if (!merged && cell->bg_color != left_cell->bg_color)
+        {
+            cand = *cell;
+            cand.bg_color = left_cell->bg_color;
+            merged = try_lossy_cell (canvas, wcell, cell, &cand, max_error);
+        }
+
+        if (!merged && cell->fg_color != left_cell->fg_color)
+        {
+            cand = *cell;
+            cand.fg_color = left_cell->fg_color;
+            merged = try_lossy_cell (canvas, wcell, cell, &cand, max_error);
+        }
+
+        if (merged)
+        {
+            counters [CHAFA_CANVAS_COUNTER_CELLS_MERGED]++;
+            return;
+        }
+    }
+
+    if (canvas->config.canvas_mode != CHAFA_CANVAS_MODE_TRUECOLOR)
+        return;
+
+    for (step = LOSSY_ROUND_STEP_MAX; step > 1; step /= 2)
+    {
+        cand = *cell;
+        cand.fg_color = round_packed_color (cell->fg_color, step);
+        cand.bg_color = round_packed_color (cell->bg_color, step);
+
+        if (!memcmp (&cand, cell, sizeof (cand)))
+            break;
+
+        if (try_lossy_cell (canvas, wcell, cell, &cand, max_error))
+        {
+            counters [CHAFA_CANVAS_COUNTER_CELLS_ROUNDED]++;
+            break;
+        }
+    }
+}
+
 /* Number of entries in our cell ring buffer. This allows us to do lookback
  * and replace single-cell symbols with double-cell ones if it improves
  * the error value. */
@@ -889,18 +1644,110 @@ update_cells_wide (ChafaCanvas *canvas, ChafaWorkCell *work_cell_a, ChafaWorkCel
 /* Calculate index after positive or negative wraparound(s) */
 #define buf_cell_index(i) (((i) + N_BUF_CELLS * 64) % N_BUF_CELLS)
 
+/* Stores the source hashes for the cells being updated in a row. Returns
+ * TRUE if the cells from the previous draw were generated from identical
+ * pixels and can be kept.
+ *
+ * Since wide symbols and blank cells depend on their neighbors, we only
+ * skip whole row spans. */
+static gboolean
+refresh_row_hashes (ChafaCanvas *canvas, gint row)
+{
+    guint64 *hashes;
+    gboolean unchanged = canvas->have_cell_hashes;
+    gint cx;
+
+    hashes = &canvas->cell_hashes [row * canvas->config.width];
+
+    for (cx = canvas->update_x; cx < canvas->update_x + canvas->update_width; cx++)
+    {
+        guint64 h = chafa_work_cell_hash_pixels (canvas->pixels, canvas->width_pixels,
+                                                 cx, row);
+        if (h != hashes [cx])
+        {
+            hashes [cx] = h;
+            unchanged = FALSE;
+        }
+    }
+
+    return unchanged;
+}
+
+/* The cell no longer matches the pixels its hash was taken from. Inverting
+ * the hash makes sure the next draw that covers it won't skip the row. */
+static void
+blank_cell_outside_span (ChafaCanvas *canvas, gint row, gint cx)
+{
+    gint i = row * canvas->config.width + cx;
+
+    canvas->cells [i].c = canvas->blank_char;
+    canvas->cell_hashes [i] = ~canvas->cell_hashes [i];
+}
+
+/* Counts the cells handled by each path in counters, which is indexed by
+ * ChafaCanvasCounter and has an extra slot at the end for uncounted work */
 static void
-update_cells_row (ChafaCanvas *canvas, gint row)
+update_cells_row (ChafaCanvas *canvas, gint row, gint *counters)
 {
     ChafaCanvasCell *cells;
     ChafaWorkCell work_cells [N_BUF_CELLS];
     gint cell_errors [N_BUF_CELLS];
+    ChafaCanvasCounter single_counter, wide_counter, wide_gated_counter, fill_counter;
+    ChafaCanvasCell memo_cell = { 0 };
+    FillBlendCache blend_cache;
+    ChafaCanvasCell *prev_cells = NULL;
+    ChafaScratchMark mark;
+    gint memo_error = 0;
+    guint32 block_tag;
+    gint x0, x1;
     gint cx, cy;
 
+    /* Normally the whole row, but a rect draw can narrow this down */
+    x0 = canvas->update_x;
+    x1 = canvas->update_x + canvas->update_width;
+
+    if (refresh_row_hashes (canvas, row))
+    {
+        counters [CHAFA_CANVAS_COUNTER_CELLS_SKIPPED] += x1 - x0;
+        return;
+    }
+
+    /* Pickers that have no symbols to consider return right away. Don't
+     * count those. */
+    single_counter = canvas->config.symbol_map.n_symbols == 0 ? CHAFA_CANVAS_COUNTER_MAX
+        : canvas->work_factor_int >= 8 ? CHAFA_CANVAS_COUNTER_CELLS_SLOW
+        : CHAFA_CANVAS_COUNTER_CELLS_FAST;
+    wide_counter = canvas->config.symbol_map.n_symbols2 == 0 ? CHAFA_CANVAS_COUNTER_MAX
+        : CHAFA_CANVAS_COUNTER_CELLS_WIDE;
+    wide_gated_counter = canvas->config.symbol_map.n_symbols2 == 0 ? CHAFA_CANVAS_COUNTER_MAX
+        : CHAFA_CANVAS_COUNTER_CELLS_WIDE_GATED;
+    fill_counter = canvas->config.fill_symbol_map.n_symbols == 0 ? CHAFA_CANVAS_COUNTER_MAX
+        : CHAFA_CANVAS_COUNTER_CELLS_FILL;
+
     cells = &canvas->cells [row * canvas->config.width];
     cy = row;
+    blend_cache.is_valid = FALSE;
+
+    /* The pick depends on the work level, and previews are done differently */
+    block_tag = canvas->work_factor_int | ((guint32) canvas->preview << 16);
+
+    /* Wide symbols straddling the edges of the span would lose a half.
+     * Blank the halves that are outside it. */
+    if (x0 > 0 && cells [x0].c == 0)
+        blank_cell_outside_span (canvas, row, x0 - 1);
+    if (x1 < canvas->config.width && cells [x1].c == 0)
+        blank_cell_outside_span (canvas, row, x1);
+
+    /* The cells are overwritten as we go, but the color tolerance may
+     * want to bring them back */
+    chafa_scratch_mark (&mark);
+    if (canvas->lossy_max_error > 0 && canvas->have_cell_hashes)
+    {
+        prev_cells = chafa_scratch_new (ChafaCanvasCell, canvas->config.width);
+        memcpy (prev_cells, cells, canvas->config.width * sizeof (ChafaCanvasCell));
+    }
 
-    for (cx = 0; cx < canvas->config.width; cx++)
+    for (cx = x0; cx < x1; cx++)
     {
         gint buf_index = cx % N_BUF_CELLS;
         ChafaWorkCell *wcell = &work_cells [buf_index];
@@ -911,7 +1758,55 @@ update_cells_row (ChafaCanvas *canvas, gint row)
         cells [cx].c = ' ';
 
         chafa_work_cell_init (wcell, canvas->pixels, canvas->width_pixels, cx, cy);
-        cell_errors [buf_index] = update_cell (canvas, wcell, &cells [cx]);
+
+        /* Flat areas tend to repeat along the row, and cells with the same
+         * pixels get the same symbol. Only the symbol search is reused;
+         * the wide and fill passes below also depend on the neighbours. */
+        if (cx > x0 && !memcmp (wcell->pixels, work_cells [buf_cell_index (cx - 1)].pixels,
+                               sizeof (wcell->pixels)))
+        {
+            cells [cx] = memo_cell;
+            cell_errors [buf_index] = memo_error;
+            counters [CHAFA_CANVAS_COUNTER_CELLS_REPEATED]++;
+        }
+        else
+        {
+            if (canvas->block_cache
+                && chafa_block_cache_lookup (canvas->block_cache, wcell->pixels, block_tag,
+                                             &cells [cx], &cell_errors [buf_index]))
+            {
+                counters [CHAFA_CANVAS_COUNTER_CELLS_CACHED]++;
+            }
+            else
+            {
+                cell_errors [buf_index] = canvas->preview
+                    ? update_preview_cell (canvas, wcell, &cells [cx])
+                    : update_flat_cell (canvas, wcell, &cells [cx]);
+
+                if (cell_errors [buf_index] >= 0)
+                {
+                    counters [CHAFA_CANVAS_COUNTER_CELLS_FLAT]++;
+                }
+                else
+                {
+#ifdef HAVE_OPENCL
+                    if (canvas->opencl_picks)
+                        cell_errors [buf_index] = update_cell_from_opencl_pick (canvas, cx, cy,
+                                                                                &cells [cx]);
+                    else
+#endif
+                        cell_errors [buf_index] = update_cell (canvas, wcell, &cells [cx]);
+                    counters [single_counter]++;
+                }
+
+                if (canvas->block_cache)
+                    chafa_block_cache_insert (canvas->block_cache, wcell->pixels, block_tag,
+                                              &cells [cx], cell_errors [buf_index]);
+            }
+
+            memo_cell = cells [cx];
+            memo_error = cell_errors [buf_index];
+        }
 
         /* Try wide symbol */
 
@@ -919,37 +1814,55 @@ update_cells_row (ChafaCanvas *canvas, gint row)
          * try to revert it to two regular symbols and overwrite the rightmost
          * one. */
 
-        if (cx >= 1 && cells [cx - 1].c != 0)
+        if (cx > x0 && cells [cx - 1].c != 0 && !canvas->skip_wide)
         {
             gint wide_buf_index [2];
 
             wide_buf_index [0] = buf_cell_index (cx - 1);
             wide_buf_index [1] = buf_index;
 
-            update_cells_wide (canvas,
-                               &work_cells [wide_buf_index [0]],
-                               &work_cells [wide_buf_index [1]],
-                               &wide_cells [0],
-                               &wide_cells [1],
-                               &wide_cell_errors [0],
-                               &wide_cell_errors [1]);
-
-            if (wide_cell_errors [0] + wide_cell_errors [1] <
-                cell_errors [wide_buf_index [0]] + cell_errors [wide_buf_index [1]])
+            if (!wide_symbol_can_win (canvas, cell_errors [wide_buf_index [0]]
+                                      + cell_errors [wide_buf_index [1]]))
+            {
+                counters [wide_gated_counter]++;
+            }
+            else
             {
-                cells [cx - 1] = wide_cells [0];
-                cells [cx] = wide_cells [1];
-                cell_errors [wide_buf_index [0]] = wide_cell_errors [0];
-                cell_errors [wide_buf_index [1]] = wide_cell_errors [1];
+                counters [wide_counter]++;
+                update_cells_wide (canvas,
+                                   &work_cells [wide_buf_index [0]],
+                                   &work_cells [wide_buf_index [1]],
+                                   &wide_cells [0],
+                                   &wide_cells [1],
+                                   &wide_cell_errors [0],
+                                   &wide_cell_errors [1]);
+
+                if (wide_cell_errors [0] + wide_cell_errors [1] <
+                    cell_errors [wide_buf_index [0]] + cell_errors [wide_buf_index [1]])
+                {
+                    cells [cx - 1] = wide_cells [0];
+                    cells [cx] = wide_cells [1];
+                    cell_errors [wide_buf_index [0]] = wide_cell_errors [0];
+                    cell_errors [wide_buf_index [1]] = wide_cell_errors [1];
+                }
             }
         }
 
+        /* The previous cell can no longer be replaced by a wide symbol,
+         * so it's final apart from the color tolerance */
+        if (canvas->lossy_max_error > 0 && cx > x0)
+            apply_color_tolerance (canvas, &work_cells [buf_cell_index (cx - 1)],
+                                   &cells [cx - 1], cx >= 2 ? &cells [cx - 2] : NULL,
+                                   prev_cells ? &prev_cells [cx - 1] : NULL, counters);
+
         /* If we produced a featureless cell, try fill */
 
         /* FIXME: Check popcount == 0 or == 64 instead of symbol char */
         if (cells [cx].c != 0 && (cells [cx].c == ' ' || cells [cx].c == 0x2588
                                   || cells [cx].fg_color == cells [cx].bg_color))
         {
+            counters [fill_counter]++;
+
             if (canvas->config.fg_only_enabled)
             {
                 apply_fill_fg_only (canvas, wcell, &cells [cx]);
@@ -957,7 +1870,7 @@ update_cells_row (ChafaCanvas *canvas, gint row)
             }
             else
             {
-                apply_fill (canvas, wcell, &cells [cx]);
+                apply_fill (canvas, wcell, &cells [cx], &blend_cache);
             }
         }
 
@@ -987,83 +1900,419 @@ update_cells_row (ChafaCanvas *canvas, gint row)
             }
         }
     }
+
+    if (canvas->lossy_max_error > 0)
+    {
+        cx = x1 - 1;
+        apply_color_tolerance (canvas, &work_cells [buf_cell_index (cx)],
+                               &cells [cx], cx >= 1 ? &cells [cx - 1] : NULL,
+                               prev_cells ? &prev_cells [cx] : NULL, counters);
+    }
+
+    chafa_scratch_release (&mark);
+}
+
+static gboolean
+draw_is_cancelled (ChafaCanvas *canvas)
+{
+    return g_atomic_int_get (&canvas->draw_cancelled) ? TRUE : FALSE;
 }
 
 static void
 cell_build_worker (ChafaBatchInfo *batch, ChafaCanvas *canvas)
 {
+    gint counters [CHAFA_CANVAS_COUNTER_MAX + 1] = { 0 };
+    ChafaScratchMark mark;
     gint i;
 
-    for (i = 0; i < batch->n_rows; i++)
+    chafa_scratch_mark (&mark);
+
+    for (i = 0; i < batch->n_rows && !draw_is_cancelled (canvas); i++)
+    {
+        update_cells_row (canvas, canvas->update_y + batch->first_row + i, counters);
+    }
+
+    counters [CHAFA_CANVAS_COUNTER_SCRATCH_BYTES_MAX] = (gint) chafa_scratch_release (&mark);
+
+    /* Summed in cell_build_post () */
+    if (canvas->stats)
     {
-        update_cells_row (canvas, batch->first_row + i);
+        batch->ret_p = g_new (gint, CHAFA_CANVAS_COUNTER_MAX);
+        memcpy (batch->ret_p, counters, CHAFA_CANVAS_COUNTER_MAX * sizeof (gint));
     }
 }
 
 static void
-update_cells (ChafaCanvas *canvas)
+cell_build_post (ChafaBatchInfo *batch, ChafaCanvas *canvas)
 {
-    chafa_process_batches (canvas,
-                           (GFunc) cell_build_worker,
-                           NULL,  /* _post */
-                           canvas->config.height,
-                           chafa_get_n_actual_threads (),
-                           1);
+    gint *counters = batch->ret_p;
+    gint i;
+
+    for (i = 0; i < CHAFA_CANVAS_COUNTER_MAX; i++)
+    {
+        if (i == CHAFA_CANVAS_COUNTER_SCRATCH_BYTES_MAX)
+            canvas->stats->counters [i] = MAX (canvas->stats->counters [i], counters [i]);
+        else
+            canvas->stats->counters [i] += counters [i];
+    }
+
+    g_free (counters);
 }
 
 static void
-differentiate_channel (guint8 *dest_channel, guint8 reference_channel, gint min_diff)
+set_work_level (ChafaCanvas *canvas, gint level)
 {
-    gint diff;
-
-    diff = (gint) *dest_channel - (gint) reference_channel;
-
-    if (diff >= -min_diff && diff <= 0)
-        *dest_channel = MAX ((gint) reference_channel - min_diff, 0);
-    else if (diff <= min_diff && diff >= 0)
-        *dest_channel = MIN ((gint) reference_channel + min_diff, 255);
+    canvas->work_level = level;
+    canvas->work_factor_int = MAX (level - 1, 0);
+    canvas->skip_wide = (level == 0);
 }
 
+/* Picks the work level for the next draw, given how long this one took.
+ * The cost recorded for each level keeps us from repeatedly stepping up
+ * into one that won't fit. It fades while we're under budget, so the
+ * level gets another try if the content becomes simpler. */
 static void
-update_display_colors (ChafaCanvas *canvas)
+adapt_work_level (ChafaCanvas *canvas, gint64 elapsed_us)
 {
-    ChafaColor fg_col;
-    ChafaColor bg_col;
+    gint64 budget_us = canvas->config.time_budget_us;
+    gint level = canvas->work_level;
+    gint i;
 
-    chafa_unpack_color (canvas->config.fg_color_packed_rgb, &fg_col);
-    chafa_unpack_color (canvas->config.bg_color_packed_rgb, &bg_col);
+    canvas->level_cost_us [level] = elapsed_us;
 
-    if (canvas->config.color_space == CHAFA_COLOR_SPACE_DIN99D)
+    if (elapsed_us > budget_us)
     {
-        chafa_color_rgb_to_din99d (&fg_col, &canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG]);
-        chafa_color_rgb_to_din99d (&bg_col, &canvas->default_colors.colors [CHAFA_COLOR_PAIR_BG]);
+        level -= elapsed_us > budget_us * 2 ? 2 : 1;
+        set_work_level (canvas, MAX (level, 0));
+        return;
     }
-    else
+
+    for (i = level + 1; i <= canvas->work_level_max; i++)
+        canvas->level_cost_us [i] -= canvas->level_cost_us [i] / 16;
+
+    if (level < canvas->work_level_max
+        && elapsed_us < budget_us * 3 / 4
+        && canvas->level_cost_us [level + 1] <= budget_us)
+        set_work_level (canvas, level + 1);
+}
+
+/* Picks up changes to the block cache size. Called before the workers
+ * start, so they can use the cache without checking. */
+static void
+update_block_cache (ChafaCanvas *canvas)
+{
+    gint n_blocks = chafa_block_cache_get_default_size ();
+
+    if (canvas->block_cache
+        && chafa_block_cache_get_size (canvas->block_cache) != n_blocks)
     {
-        canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG] = fg_col;
-        canvas->default_colors.colors [CHAFA_COLOR_PAIR_BG] = bg_col;
+        chafa_block_cache_destroy (canvas->block_cache);
+        canvas->block_cache = NULL;
     }
 
-    canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG].ch [3] = 0xff;
-    canvas->default_colors.colors [CHAFA_COLOR_PAIR_BG].ch [3] = 0x00;
+    if (!canvas->block_cache && n_blocks > 0)
+        canvas->block_cache = chafa_block_cache_new (n_blocks);
+}
 
-    /* When holding the BG, we need to compare against a consistent
-     * foreground color for symbol selection by outline. 50% gray
-     * yields acceptable results as a stand-in average of all possible
-     * colors. The BG color can't be too similar, so push it away a
-     * little if needed. This should work with both bright and dark
-     * background colors, and the background color doesn't have to
-     * be precise.
-     *
-     * We don't need to do this for monochrome modes, as they use the
-     * FG/BG colors directly. */
+#ifdef HAVE_OPENCL
 
-    if (canvas->extract_colors && canvas->config.fg_only_enabled)
-    {
-        gint i;
+/* Below this many cells, the transfers to and from the device cost more
+ * than the search saves */
+#define OPENCL_CELLS_MIN 8192
 
-        chafa_unpack_color (0xff7f7f7f,
-                            &canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG]);
+/* Picks symbols for the whole rect on the GPU ahead of the cell workers.
+ * Only done for the exhaustive search with mean colors and unquantized
+ * error, which is what the device does; other setups, and any failure,
+ * leave opencl_picks NULL and the workers search on the CPU. */
+static void
+pick_cells_opencl (ChafaCanvas *canvas, gint x, gint y, gint width, gint height)
+{
+    if (canvas->config.symbol_map.n_symbols == 0
+        || canvas->work_factor_int < 8
+        || canvas->preview
+        || !canvas->extract_colors
+        || canvas->config.fg_only_enabled
+        || canvas->use_quantized_error
+        || canvas->use_palette_terms
+        || canvas->config.color_extractor != CHAFA_COLOR_EXTRACTOR_AVERAGE
+        || width * height < OPENCL_CELLS_MIN)
+        return;
+
+    if (!canvas->opencl_picker && !canvas->opencl_failed)
+    {
+        canvas->opencl_picker = chafa_opencl_picker_new (&canvas->config.symbol_map);
+        canvas->opencl_failed = canvas->opencl_picker ? FALSE : TRUE;
+    }
+
+    if (!canvas->opencl_picker)
+        return;
+
+    canvas->opencl_picks = g_new (ChafaOpenclPick, width * height);
+
+    if (!chafa_opencl_picker_pick (canvas->opencl_picker, canvas->pixels, canvas->width_pixels,
+                                   x, y, width, height, canvas->opencl_picks))
+    {
+        g_free (canvas->opencl_picks);
+        canvas->opencl_picks = NULL;
+    }
+}
+
+#endif
+
+/* Updates the cells in a rectangle. The time budget only applies to full
+ * draws, since partial ones and previews would throw off its estimates. */
+static void
+update_cells_rect (ChafaCanvas *canvas, gint x, gint y, gint width, gint height)
+{
+    ChafaStageTime start;
+    gboolean adapt;
+    gint64 start_us = 0;
+
+    adapt = canvas->config.time_budget_us > 0 && !canvas->preview
+        && width == canvas->config.width && height == canvas->config.height;
+
+    if (canvas->stats)
+        chafa_stage_time_begin (&start);
+    if (adapt)
+        start_us = g_get_monotonic_time ();
+
+    update_block_cache (canvas);
+
+    canvas->last_work_factor_int = canvas->work_factor_int;
+    canvas->update_x = x;
+    canvas->update_y = y;
+    canvas->update_width = width;
+
+#ifdef HAVE_OPENCL
+    pick_cells_opencl (canvas, x, y, width, height);
+#endif
+
+    /* Cell cost varies a lot; flat areas are cheap, detailed ones aren't */
+    chafa_process_batches_dynamic (canvas,
+                                   "build-cells",
+                                   (GFunc) cell_build_worker,
+                                   canvas->stats ? (GFunc) cell_build_post : NULL,
+                                   height,
+                                   1);
+
+#ifdef HAVE_OPENCL
+    g_free (canvas->opencl_picks);
+    canvas->opencl_picks = NULL;
+#endif
+
+    if (canvas->stats)
+        chafa_stage_time_end (&start, &canvas->stats->stage_times [CHAFA_CANVAS_STAGE_UPDATE_CELLS]);
+
+    /* A cancelled draw says nothing about how long a full one takes */
+    if (adapt && !draw_is_cancelled (canvas))
+        adapt_work_level (canvas, g_get_monotonic_time () - start_us);
+}
+
+void
+chafa_canvas_update_cells (ChafaCanvas *canvas)
+{
+    update_cells_rect (canvas, 0, 0, canvas->config.width, canvas->config.height);
+}
+
+typedef struct
+{
+    gunichar c;
+    guint64 bitmap [2];
+}
+CharBitmap;
+
+static gint
+compare_char_bitmaps (gconstpointer a, gconstpointer b)
+{
+    const CharBitmap *cb_a = a;
+    const CharBitmap *cb_b = b;
+
+    return cb_a->c < cb_b->c ? -1 : cb_a->c > cb_b->c ? 1 : 0;
+}
+
+/* Collects the shapes of every symbol the canvas can emit, sorted by char.
+ * Narrow symbols leave bitmap [1] unused. */
+static CharBitmap *
+build_char_bitmaps (const ChafaCanvas *canvas, gint *n_out)
+{
+    const ChafaSymbolMap *maps [2];
+    CharBitmap *cbs;
+    gint n = 0, n_max = 0;
+    gint i, j;
+
+    maps [0] = &canvas->config.symbol_map;
+    maps [1] = &canvas->config.fill_symbol_map;
+
+    for (i = 0; i < 2; i++)
+        n_max += maps [i]->n_symbols + maps [i]->n_symbols2;
+
+    cbs = g_new (CharBitmap, MAX (n_max, 1));
+
+    for (i = 0; i < 2; i++)
+    {
+        for (j = 0; j < maps [i]->n_symbols; j++)
+        {
+            cbs [n].c = maps [i]->symbols [j].c;
+            cbs [n].bitmap [0] = maps [i]->symbols [j].bitmap;
+            cbs [n].bitmap [1] = 0;
+            n++;
+        }
+
+        for (j = 0; j < maps [i]->n_symbols2; j++)
+        {
+            cbs [n].c = maps [i]->symbols2 [j].sym [0].c;
+            cbs [n].bitmap [0] = maps [i]->symbols2 [j].sym [0].bitmap;
+            cbs [n].bitmap [1] = maps [i]->symbols2 [j].sym [1].bitmap;
+            n++;
+        }
+    }
+
+    qsort (cbs, n, sizeof (CharBitmap), compare_char_bitmaps);
+    *n_out = n;
+    return cbs;
+}
+
+static const CharBitmap *
+lookup_char_bitmap (const CharBitmap *cbs, gint n, gunichar c)
+{
+    gint lo = 0, hi = n;
+
+    while (lo < hi)
+    {
+        gint mid = (lo + hi) / 2;
+
+        if (cbs [mid].c < c)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return (lo < n && cbs [lo].c == c) ? &cbs [lo] : NULL;
+}
+
+static void
+rasterize_bitmap (guint8 *dest, gint dest_rowstride, guint64 bitmap, gint fg, gint bg)
+{
+    guint32 pens [2];
+    gint x, y;
+
+    /* RGBA8 unassociated in memory order, with -1 becoming transparent */
+    pens [0] = bg < 0 ? 0 : GUINT32_TO_BE (((guint32) bg << 8) | 0xff);
+    pens [1] = fg < 0 ? 0 : GUINT32_TO_BE (((guint32) fg << 8) | 0xff);
+
+    for (y = 0; y < CHAFA_SYMBOL_HEIGHT_PIXELS; y++)
+    {
+        guint32 *row = (guint32 *) (dest + y * dest_rowstride);
+
+        /* Pixel 0 is in the most significant bit */
+        for (x = 0; x < CHAFA_SYMBOL_WIDTH_PIXELS; x++)
+            row [x] = pens [(bitmap >> (CHAFA_SYMBOL_N_PIXELS - 1 - y * CHAFA_SYMBOL_WIDTH_PIXELS - x)) & 1];
+    }
+}
+
+/* Renders the cells back to pixels, the way a terminal would if its font
+ * matched our symbol shapes exactly. The result is width_pixels by
+ * height_pixels in RGBA8 unassociated, and is meant for comparing the
+ * output to the source image. Chars we don't know the shape of get the
+ * background color. Only makes sense in symbol mode. */
+void
+chafa_canvas_rasterize (ChafaCanvas *canvas, guint8 *dest, gint dest_rowstride)
+{
+    CharBitmap *cbs;
+    gint n_cbs;
+    gint cx, cy;
+
+    g_return_if_fail (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS);
+
+    cbs = build_char_bitmaps (canvas, &n_cbs);
+
+    for (cy = 0; cy < canvas->config.height; cy++)
+    {
+        const ChafaCanvasCell *cells = &canvas->cells [cy * canvas->config.width];
+        guint8 *row = dest + cy * CHAFA_SYMBOL_HEIGHT_PIXELS * dest_rowstride;
+
+        for (cx = 0; cx < canvas->config.width; cx++)
+        {
+            const CharBitmap *cb;
+            guint64 bitmap = 0;
+            gint fg, bg;
+
+            /* Right half of a wide char; drawn along with the left one */
+            if (cells [cx].c == 0 && cx > 0)
+                continue;
+
+            cell_get_colors (canvas, &cells [cx], &fg, &bg);
+            cb = lookup_char_bitmap (cbs, n_cbs, cells [cx].c);
+            if (cb)
+                bitmap = cb->bitmap [0];
+
+            rasterize_bitmap (row + cx * CHAFA_SYMBOL_WIDTH_PIXELS * 4, dest_rowstride,
+                              bitmap, fg, bg);
+
+            if (cx + 1 < canvas->config.width && cells [cx + 1].c == 0)
+            {
+                rasterize_bitmap (row + (cx + 1) * CHAFA_SYMBOL_WIDTH_PIXELS * 4, dest_rowstride,
+                                  cb ? cb->bitmap [1] : 0, fg, bg);
+            }
+        }
+    }
+
+    g_free (cbs);
+}
+
+static void
+differentiate_channel (guint8 *dest_channel, guint8 reference_channel, gint min_diff)
+{
+    gint diff;
+
+    diff = (gint) *dest_channel - (gint) reference_channel;
+
+    if (diff >= -min_diff && diff <= 0)
+        *dest_channel = MAX ((gint) reference_channel - min_diff, 0);
+    else if (diff <= min_diff && diff >= 0)
+        *dest_channel = MIN ((gint) reference_channel + min_diff, 255);
+}
+
+static void
+update_display_colors (ChafaCanvas *canvas)
+{
+    ChafaColor fg_col;
+    ChafaColor bg_col;
+
+    chafa_unpack_color (canvas->config.fg_color_packed_rgb, &fg_col);
+    chafa_unpack_color (canvas->config.bg_color_packed_rgb, &bg_col);
+
+    if (canvas->config.color_space == CHAFA_COLOR_SPACE_DIN99D)
+    {
+        chafa_color_rgb_to_din99d (&fg_col, &canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG]);
+        chafa_color_rgb_to_din99d (&bg_col, &canvas->default_colors.colors [CHAFA_COLOR_PAIR_BG]);
+    }
+    else
+    {
+        canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG] = fg_col;
+        canvas->default_colors.colors [CHAFA_COLOR_PAIR_BG] = bg_col;
+    }
+
+    canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG].ch [3] = 0xff;
+    canvas->default_colors.colors [CHAFA_COLOR_PAIR_BG].ch [3] = 0x00;
+
+    /* When holding the BG, we need to compare against a consistent
+     * foreground color for symbol selection by outline. 50% gray
+     * yields acceptable results as a stand-in average of all possible
+     * colors. The BG color can't be too similar, so push it away a
+     * little if needed. This should work with both bright and dark
+     * background colors, and the background color doesn't have to
+     * be precise.
+     *
+     * We don't need to do this for monochrome modes, as they use the
+     * FG/BG colors directly. */
+
+    if (canvas->extract_colors && canvas->config.fg_only_enabled)
+    {
+        gint i;
+
+        chafa_unpack_color (0xff7f7f7f,
+                            &canvas->default_colors.colors [CHAFA_COLOR_PAIR_FG]);
 
         for (i = 0; i < 3; i++)
         {
@@ -1158,6 +2407,10 @@ setup_palette (ChafaCanvas *canvas)
     chafa_palette_set_alpha_threshold (&canvas->fg_palette, canvas->config.alpha_threshold);
     chafa_palette_set_transparent_index (&canvas->fg_palette, CHAFA_PALETTE_INDEX_TRANSPARENT);
 
+    /* K-means refinement of generated palettes is slow, so it only kicks in
+     * at the high end of the work scale */
+    chafa_palette_set_refine_passes (&canvas->fg_palette, MAX (0, canvas->work_factor_int - 5));
+
     chafa_palette_init (&canvas->bg_palette, bg_pal_type);
 
     chafa_palette_set_color (&canvas->bg_palette, CHAFA_PALETTE_INDEX_FG, &fg_col);
@@ -1165,6 +2418,31 @@ setup_palette (ChafaCanvas *canvas)
 
     chafa_palette_set_alpha_threshold (&canvas->bg_palette, canvas->config.alpha_threshold);
     chafa_palette_set_transparent_index (&canvas->bg_palette, CHAFA_PALETTE_INDEX_TRANSPARENT);
+    chafa_palette_set_refine_passes (&canvas->bg_palette, MAX (0, canvas->work_factor_int - 5));
+}
+
+static void
+setup_palette_terms (ChafaCanvas *canvas, const ChafaPalette *palette, ChafaPaletteTerms *terms)
+{
+    gint first = chafa_palette_get_first_color (palette);
+    gint i;
+
+    terms->n_colors = 0;
+
+    for (i = first; i < first + chafa_palette_get_n_colors (palette); i++)
+    {
+        ChafaColor *col = &terms->colors [terms->n_colors];
+
+        if (i == chafa_palette_get_transparent_index (palette))
+            continue;
+
+        g_assert (terms->n_colors < CHAFA_PALETTE_TERMS_MAX);
+
+        *col = *chafa_palette_get_color (palette, canvas->config.color_space, i);
+        terms->sq [terms->n_colors] = col->ch [0] * col->ch [0]
+            + col->ch [1] * col->ch [1] + col->ch [2] * col->ch [2];
+        terms->n_colors++;
+    }
 }
 
 static gunichar
@@ -1245,6 +2523,130 @@ find_best_solid_char (ChafaCanvas *canvas)
     return best_char;
 }
 
+static guint64
+hash_symbol_map (guint64 h, const ChafaSymbolMap *symbol_map)
+{
+    gint i;
+
+    for (i = 0; i < symbol_map->n_symbols; i++)
+    {
+        const ChafaSymbol *sym = &symbol_map->symbols [i];
+
+        h = chafa_cell_cache_hash_bytes (h, &sym->c, sizeof (sym->c));
+        h = chafa_cell_cache_hash_bytes (h, &sym->bitmap, sizeof (sym->bitmap));
+    }
+
+    for (i = 0; i < symbol_map->n_symbols2; i++)
+    {
+        const ChafaSymbol2 *sym = &symbol_map->symbols2 [i];
+
+        h = chafa_cell_cache_hash_bytes (h, &sym->sym [0].c, sizeof (sym->sym [0].c));
+        h = chafa_cell_cache_hash_bytes (h, &sym->sym [0].bitmap, sizeof (sym->sym [0].bitmap));
+        h = chafa_cell_cache_hash_bytes (h, &sym->sym [1].bitmap, sizeof (sym->sym [1].bitmap));
+    }
+
+    /* Separates the two maps, so symbols can't move from one to the other
+     * without changing the hash */
+    return chafa_cell_cache_hash_bytes (h, &symbol_map->n_symbols, sizeof (symbol_map->n_symbols));
+}
+
+static gint
+compare_char_coverages (gconstpointer a, gconstpointer b)
+{
+    const ChafaCharCoverage *cc_a = a;
+    const ChafaCharCoverage *cc_b = b;
+
+    return cc_a->c < cc_b->c ? -1 : cc_a->c > cc_b->c ? 1 : 0;
+}
+
+/* Lossy changes are only made in modes where each cell's colors can be
+ * picked freely, since they're checked against the pixels one at a time */
+static void
+setup_color_tolerance (ChafaCanvas *canvas)
+{
+    const ChafaSymbolMap *maps [2];
+    gint tolerance = canvas->config.color_tolerance;
+    gint i, j, n = 0;
+
+    canvas->lossy_max_error = 0;
+    canvas->char_coverages = NULL;
+    canvas->n_char_coverages = 0;
+
+    if (tolerance == 0
+        || canvas->config.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS
+        || canvas->config.fg_only_enabled
+        || !(canvas->config.canvas_mode == CHAFA_CANVAS_MODE_TRUECOLOR
+             || canvas->config.canvas_mode == CHAFA_CANVAS_MODE_INDEXED_256
+             || canvas->config.canvas_mode == CHAFA_CANVAS_MODE_INDEXED_240
+             || canvas->config.canvas_mode == CHAFA_CANVAS_MODE_INDEXED_16
+             || canvas->config.canvas_mode == CHAFA_CANVAS_MODE_INDEXED_8))
+        return;
+
+    /* The error is summed over three channels and every pixel */
+    canvas->lossy_max_error = tolerance * tolerance * 3 * CHAFA_SYMBOL_N_PIXELS;
+
+    maps [0] = &canvas->config.symbol_map;
+    maps [1] = &canvas->config.fill_symbol_map;
+    canvas->char_coverages = g_new (ChafaCharCoverage,
+                                    maps [0]->n_symbols + maps [1]->n_symbols);
+
+    for (i = 0; i < 2; i++)
+    {
+        for (j = 0; j < maps [i]->n_symbols; j++)
+        {
+            ChafaCharCoverage *cc = &canvas->char_coverages [n++];
+
+            cc->c = maps [i]->symbols [j].c;
+            memcpy (cc->coverage, maps [i]->symbols [j].coverage, CHAFA_SYMBOL_N_PIXELS);
+        }
+    }
+
+    qsort (canvas->char_coverages, n, sizeof (ChafaCharCoverage), compare_char_coverages);
+
+    /* A char can be in both maps */
+    for (i = 0, j = 0; i < n; i++)
+    {
+        if (j == 0 || canvas->char_coverages [j - 1].c != canvas->char_coverages [i].c)
+            canvas->char_coverages [j++] = canvas->char_coverages [i];
+    }
+
+    canvas->n_char_coverages = j;
+}
+
+/* Must be called after the config has been adjusted for the canvas and the
+ * symbol maps have been prepared. The work level is left out, since it can
+ * change between draws. */
+static guint64
+calc_config_hash (ChafaCanvas *canvas)
+{
+    const ChafaCanvasConfig *config = &canvas->config;
+    guint64 h = 0x9e3779b97f4a7c15ULL;
+    gint32 fields [16];
+
+    fields [0] = config->width;
+    fields [1] = config->height;
+    fields [2] = config->canvas_mode;
+    fields [3] = config->color_space;
+    fields [4] = config->dither_mode;
+    fields [5] = config->color_extractor;
+    fields [6] = config->dither_grain_width;
+    fields [7] = config->dither_grain_height;
+    memcpy (&fields [8], &config->dither_intensity, sizeof (gint32));
+    fields [9] = config->fg_color_packed_rgb;
+    fields [10] = config->bg_color_packed_rgb;
+    fields [11] = config->alpha_threshold;
+    fields [12] = config->preprocessing_enabled;
+    fields [13] = config->fg_only_enabled;
+    fields [14] = canvas->consider_inverted;
+    fields [15] = canvas->lossy_max_error;
+
+    h = chafa_cell_cache_hash_bytes (h, fields, sizeof (fields));
+    h = hash_symbol_map (h, &config->symbol_map);
+    h = hash_symbol_map (h, &config->fill_symbol_map);
+
+    return h;
+}
+
 /**
  * chafa_canvas_new:
  * @config: Configuration to use or %NULL for hardcoded defaults
@@ -1303,9 +2705,17 @@ chafa_canvas_new (const ChafaCanvasConfig *config)
 
     canvas->pixels = NULL;
     canvas->cells = g_new (ChafaCanvasCell, canvas->config.width * canvas->config.height);
+    chafa_batch_first_touch (canvas->cells, canvas->config.width * sizeof (ChafaCanvasCell),
+                             canvas->config.height, 1);
+    canvas->cell_hashes = NULL;
+    canvas->have_cell_hashes = FALSE;
     canvas->work_factor_int = canvas->config.work_factor * 10 + 0.5f;
+    canvas->work_level_max = canvas->work_factor_int + 1;
+    set_work_level (canvas, canvas->work_level_max);
+    canvas->last_work_factor_int = canvas->work_factor_int;
     canvas->needs_clear = TRUE;
     canvas->have_alpha = FALSE;
+    canvas->cells_opaque = FALSE;
 
     canvas->consider_inverted = !(canvas->config.fg_only_enabled
                                   || canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG);
@@ -1316,13 +2726,20 @@ chafa_canvas_new (const ChafaCanvasConfig *config)
     if (canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG)
         canvas->config.fg_only_enabled = TRUE;
 
+    canvas->fixed_colors = !canvas->extract_colors || canvas->config.fg_only_enabled;
+
     canvas->use_quantized_error =
         (canvas->config.canvas_mode == CHAFA_CANVAS_MODE_INDEXED_16_8
          && !canvas->config.fg_only_enabled);
+    canvas->use_palette_terms =
+        (canvas->use_quantized_error
+         && canvas->config.color_extractor == CHAFA_COLOR_EXTRACTOR_AVERAGE);
 
     chafa_symbol_map_prepare (&canvas->config.symbol_map);
     chafa_symbol_map_prepare (&canvas->config.fill_symbol_map);
 
+    canvas->stats = canvas->config.stats_enabled ? stats_new (canvas) : NULL;
+
     canvas->blank_char = find_best_blank_char (canvas);
     canvas->solid_char = find_best_solid_char (canvas);
 
@@ -1342,7 +2759,8 @@ chafa_canvas_new (const ChafaCanvasConfig *config)
         canvas->config.dither_mode = CHAFA_DITHER_MODE_NONE;
     }
 
-    if (canvas->config.dither_mode == CHAFA_DITHER_MODE_ORDERED)
+    if (canvas->config.dither_mode == CHAFA_DITHER_MODE_ORDERED
+        || canvas->config.dither_mode == CHAFA_DITHER_MODE_NOISE)
     {
         switch (canvas->config.canvas_mode)
         {
@@ -1373,8 +2791,30 @@ chafa_canvas_new (const ChafaCanvasConfig *config)
                        canvas->config.dither_grain_width,
                        canvas->config.dither_grain_height);
 
-    update_display_colors (canvas);
+    if (canvas->stats)
+    {
+        ChafaStageTime start;
+
+        chafa_stage_time_begin (&start);
+        update_display_colors (canvas);
+        chafa_stage_time_end (&start, &canvas->stats->stage_times [CHAFA_CANVAS_STAGE_DISPLAY_COLORS]);
+    }
+    else
+    {
+        update_display_colors (canvas);
+    }
+
     setup_palette (canvas);
+    setup_color_tolerance (canvas);
+
+    if (canvas->use_palette_terms)
+    {
+        setup_palette_terms (canvas, &canvas->fg_palette, &canvas->fg_terms);
+        setup_palette_terms (canvas, &canvas->bg_palette, &canvas->bg_terms);
+    }
+
+    if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS)
+        canvas->config_hash = calc_config_hash (canvas);
 
     return canvas;
 }
@@ -1402,7 +2842,32 @@ chafa_canvas_new_similar (ChafaCanvas *orig)
 
     canvas->pixels = NULL;
     canvas->cells = g_new (ChafaCanvasCell, canvas->config.width * canvas->config.height);
+    chafa_batch_first_touch (canvas->cells, canvas->config.width * sizeof (ChafaCanvasCell),
+                             canvas->config.height, 1);
+    canvas->cell_hashes = NULL;
+    canvas->have_cell_hashes = FALSE;
+    canvas->cells_opaque = FALSE;
+    canvas->pixel_canvas = NULL;
     canvas->needs_clear = TRUE;
+    canvas->draw_cancelled = FALSE;
+    canvas->stats = orig->stats ? stats_new (canvas) : NULL;
+    memset (canvas->remap_targets, 0, sizeof (canvas->remap_targets));
+    canvas->block_cache = NULL;
+#ifdef HAVE_OPENCL
+    canvas->opencl_picker = NULL;
+    canvas->opencl_picks = NULL;
+    canvas->opencl_failed = FALSE;
+#endif
+
+    if (orig->char_coverages)
+        canvas->char_coverages = g_memdup (orig->char_coverages,
+                                           orig->n_char_coverages * sizeof (ChafaCharCoverage));
+
+    if (orig->custom_palette)
+    {
+        canvas->custom_palette = g_new (ChafaPalette, 1);
+        chafa_palette_copy (orig->custom_palette, canvas->custom_palette);
+    }
 
     chafa_dither_copy (&orig->dither, &canvas->dither);
 
@@ -1454,6 +2919,7 @@ void
 chafa_canvas_unref (ChafaCanvas *canvas)
 {
     gint refs;
+    gint i;
 
     g_return_if_fail (canvas != NULL);
     refs = g_atomic_int_get (&canvas->refs);
@@ -1466,8 +2932,28 @@ chafa_canvas_unref (ChafaCanvas *canvas)
         chafa_dither_deinit (&canvas->dither);
         chafa_palette_deinit (&canvas->fg_palette);
         chafa_palette_deinit (&canvas->bg_palette);
-        g_free (canvas->pixels);
+        chafa_aligned_free (canvas->pixels);
         g_free (canvas->cells);
+        g_free (canvas->cell_hashes);
+        chafa_block_cache_destroy (canvas->block_cache);
+#ifdef HAVE_OPENCL
+        chafa_opencl_picker_destroy (canvas->opencl_picker);
+#endif
+        stats_free (canvas->stats);
+        g_free (canvas->char_coverages);
+        for (i = 0; i < CHAFA_CANVAS_MODE_MAX; i++)
+        {
+            if (canvas->remap_targets [i])
+            {
+                chafa_canvas_unref (canvas->remap_targets [i]->canvas);
+                g_free (canvas->remap_targets [i]);
+            }
+        }
+        if (canvas->custom_palette)
+        {
+            chafa_palette_deinit (canvas->custom_palette);
+            g_free (canvas->custom_palette);
+        }
         g_free (canvas);
     }
 }
@@ -1491,49 +2977,79 @@ chafa_canvas_peek_config (ChafaCanvas *canvas)
     return &canvas->config;
 }
 
-/**
- * chafa_canvas_draw_all_pixels:
- * @canvas: Canvas whose pixel data to replace
- * @src_pixel_type: Pixel format of @src_pixels
- * @src_pixels: Pointer to the start of source pixel memory
- * @src_width: Width in pixels of source pixel data
- * @src_height: Height in pixels of source pixel data
- * @src_rowstride: Number of bytes between the start of each pixel row
- *
- * Replaces pixel data of @canvas with a copy of that found at @src_pixels,
- * which must be in one of the formats supported by #ChafaPixelType.
+/* Called when every cell has been generated from the prepared pixels. Cells
+ * can only be transparent if the source was, or if they don't carry their
+ * own background colors. */
+static void
+update_cells_opaque (ChafaCanvas *canvas)
+{
+    canvas->cells_opaque = !canvas->have_alpha
+        && canvas->extract_colors
+        && !canvas->config.fg_only_enabled;
+}
+
+/* When the same image is drawn over and over with the same settings, the
+ * cells can be copied from the cache instead. Returns TRUE if they were.
+ * The prepared pixels are left stale in that case, so the next draw can't
+ * use them to skip unchanged rows.
  *
- * Since: 1.2
- **/
-void
-chafa_canvas_draw_all_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
-                              const guint8 *src_pixels,
-                              gint src_width, gint src_height, gint src_rowstride)
+ * On a miss, *cache_key_out is set up for inserting the result. */
+static gboolean
+fetch_cached_cells (ChafaCanvas *canvas, ChafaCellCacheKey *cache_key_out,
+                    ChafaPixelType src_pixel_type, const guint8 *src_pixels,
+                    gint src_width, gint src_height, gint src_rowstride)
 {
-    g_return_if_fail (canvas != NULL);
-    g_return_if_fail (canvas->refs > 0);
-    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
-    g_return_if_fail (src_pixels != NULL);
-    g_return_if_fail (src_width >= 0);
-    g_return_if_fail (src_height >= 0);
+    gint n_cells = canvas->config.width * canvas->config.height;
+    gboolean have_alpha;
 
-    if (src_width == 0 || src_height == 0)
-        return;
+    cache_key_out->src_hash = chafa_cell_cache_hash_pixels (src_pixel_type, src_pixels,
+                                                            src_width, src_height,
+                                                            src_rowstride);
+    /* The work level can change between draws */
+    cache_key_out->config_hash = chafa_cell_cache_hash_bytes (canvas->config_hash,
+                                                              &canvas->work_level,
+                                                              sizeof (canvas->work_level));
 
-    if (canvas->pixels)
-    {
-        g_free (canvas->pixels);
-        canvas->pixels = NULL;
-    }
+    if (!chafa_cell_cache_lookup (cache_key_out, canvas->cells, n_cells, &have_alpha))
+        return FALSE;
 
-    destroy_pixel_canvas (canvas);
+    canvas->have_alpha = have_alpha;
+    canvas->needs_clear = FALSE;
+    canvas->have_cell_hashes = FALSE;
+    update_cells_opaque (canvas);
 
-    if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS)
-    {
-        /* Symbol mode */
+    if (canvas->stats)
+        canvas->stats->counters [CHAFA_CANVAS_COUNTER_CELLS_SKIPPED] += n_cells;
+
+    return TRUE;
+}
+
+static void
+alloc_pixels (ChafaCanvas *canvas)
+{
+    canvas->pixels = chafa_aligned_alloc ((gsize) canvas->width_pixels * canvas->height_pixels
+                                          * sizeof (ChafaPixel));
+    chafa_batch_first_touch (canvas->pixels, canvas->width_pixels * sizeof (ChafaPixel),
+                             canvas->height_pixels, CHAFA_SYMBOL_HEIGHT_PIXELS);
+}
+
+/* Scales and prepares the source pixels for the cell workers in symbol
+ * mode, allocating the work buffers on first use */
+static void
+prepare_symbol_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                       const guint8 *src_pixels,
+                       gint src_width, gint src_height, gint src_rowstride)
+{
+    if (!canvas->pixels)
+        alloc_pixels (canvas);
+
+    if (!canvas->cell_hashes)
+        canvas->cell_hashes = g_new (guint64, canvas->config.width * canvas->config.height);
 
-        canvas->pixels = g_new (ChafaPixel, canvas->width_pixels * canvas->height_pixels);
+    /* Until the cells are all regenerated */
+    canvas->cells_opaque = FALSE;
 
+    canvas->have_alpha =
         chafa_prepare_pixel_data_for_symbols (&canvas->fg_palette, &canvas->dither,
                                               canvas->config.color_space,
                                               canvas->config.preprocessing_enabled,
@@ -1543,27 +3059,94 @@ chafa_canvas_draw_all_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type
                                               src_width, src_height,
                                               src_rowstride,
                                               canvas->pixels,
-                                              canvas->width_pixels, canvas->height_pixels);
+                                              canvas->width_pixels, canvas->height_pixels,
+                                              canvas->stats ? canvas->stats->stage_times : NULL,
+                                              &canvas->draw_cancelled);
 
-        if (canvas->config.alpha_threshold == 0)
-            canvas->have_alpha = FALSE;
+    if (canvas->config.alpha_threshold == 0)
+        canvas->have_alpha = FALSE;
+}
+
+/* Does the work for the draw functions. Checks draw_cancelled, but
+ * doesn't reset it. */
+static void
+draw_all_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                 const guint8 *src_pixels,
+                 gint src_width, gint src_height, gint src_rowstride)
+{
+    ChafaStageTime start;
+
+    /* In symbol mode, the stages are timed separately further down */
+    if (canvas->stats && canvas->config.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS)
+        chafa_stage_time_begin (&start);
+
+    /* Work buffers and pixel canvases are kept around between draws, since
+     * the geometry can't change. This makes redrawing a canvas much cheaper
+     * than creating a new one for each frame. */
+
+    if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS)
+    {
+        /* Symbol mode */
+
+        ChafaCellCacheKey cache_key;
+        gint n_cells = canvas->config.width * canvas->config.height;
+        gboolean use_cache = chafa_cell_cache_get_max_size () > 0;
+
+        if (use_cache
+            && fetch_cached_cells (canvas, &cache_key, src_pixel_type, src_pixels,
+                                   src_width, src_height, src_rowstride))
+            return;
+
+        prepare_symbol_pixels (canvas, src_pixel_type, src_pixels,
+                               src_width, src_height, src_rowstride);
+
+        if (!draw_is_cancelled (canvas))
+            chafa_canvas_update_cells (canvas);
+
+        /* Some rows may have new hashes but old cells, so a cancelled draw
+         * must not be used to skip rows next time */
+        if (draw_is_cancelled (canvas))
+        {
+            canvas->needs_clear = TRUE;
+            canvas->have_cell_hashes = FALSE;
+            return;
+        }
 
-        update_cells (canvas);
         canvas->needs_clear = FALSE;
+        canvas->have_cell_hashes = TRUE;
+        update_cells_opaque (canvas);
 
-        g_free (canvas->pixels);
-        canvas->pixels = NULL;
+        if (use_cache)
+            chafa_cell_cache_insert (&cache_key, canvas->cells, n_cells, canvas->have_alpha,
+                                     canvas->config.canvas_mode != CHAFA_CANVAS_MODE_TRUECOLOR);
     }
     else if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SIXELS)
     {
         /* Sixel mode */
 
         canvas->fg_palette.alpha_threshold = canvas->config.alpha_threshold;
-        canvas->pixel_canvas = chafa_sixel_canvas_new (canvas->width_pixels,
-                                                       canvas->height_pixels,
-                                                       canvas->config.color_space,
-                                                       &canvas->fg_palette,
-                                                       &canvas->dither);
+
+        if (!canvas->pixel_canvas)
+        {
+            canvas->pixel_canvas = chafa_sixel_canvas_new (canvas->width_pixels,
+                                                           canvas->height_pixels,
+                                                           canvas->config.color_space,
+                                                           &canvas->fg_palette,
+                                                           &canvas->dither);
+            chafa_sixel_canvas_set_palette_reuse (canvas->pixel_canvas,
+                                                  canvas->config.palette_reuse_enabled);
+            chafa_sixel_canvas_set_cancel_flag (canvas->pixel_canvas, &canvas->draw_cancelled);
+            if (canvas->custom_palette)
+            {
+                canvas->custom_palette->alpha_threshold = canvas->config.alpha_threshold;
+                chafa_sixel_canvas_set_fixed_palette (canvas->pixel_canvas, canvas->custom_palette);
+            }
+        }
+        else if (!canvas->config.palette_reuse_enabled && !canvas->custom_palette)
+        {
+            chafa_sixel_canvas_set_palette (canvas->pixel_canvas, &canvas->fg_palette);
+        }
+
         chafa_sixel_canvas_draw_all_pixels (canvas->pixel_canvas,
                                             src_pixel_type,
                                             src_pixels,
@@ -1580,8 +3163,15 @@ chafa_canvas_draw_all_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type
         /* Kitty mode */
 
         canvas->fg_palette.alpha_threshold = canvas->config.alpha_threshold;
-        canvas->pixel_canvas = chafa_kitty_canvas_new (canvas->width_pixels,
-                                                       canvas->height_pixels);
+        if (!canvas->pixel_canvas)
+        {
+            canvas->pixel_canvas = chafa_kitty_canvas_new (canvas->width_pixels,
+                                                           canvas->height_pixels);
+            chafa_kitty_canvas_set_compression_level (canvas->pixel_canvas,
+                                                      canvas->config.compression_level);
+            chafa_kitty_canvas_set_transmission_medium (canvas->pixel_canvas,
+                                                        canvas->config.transmission_medium);
+        }
         chafa_kitty_canvas_draw_all_pixels (canvas->pixel_canvas,
                                             src_pixel_type,
                                             src_pixels,
@@ -1594,141 +3184,1647 @@ chafa_canvas_draw_all_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type
         /* iTerm2 mode */
 
         canvas->fg_palette.alpha_threshold = canvas->config.alpha_threshold;
-        canvas->pixel_canvas = chafa_iterm2_canvas_new (canvas->width_pixels,
-                                                        canvas->height_pixels);
+        if (!canvas->pixel_canvas)
+        {
+            canvas->pixel_canvas = chafa_iterm2_canvas_new (canvas->width_pixels,
+                                                            canvas->height_pixels);
+            chafa_iterm2_canvas_set_compression_level (canvas->pixel_canvas,
+                                                       canvas->config.compression_level);
+        }
         chafa_iterm2_canvas_draw_all_pixels (canvas->pixel_canvas,
                                              src_pixel_type,
                                              src_pixels,
                                              src_width, src_height,
                                              src_rowstride);
     }
+
+    if (canvas->stats && canvas->config.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS)
+        chafa_stage_time_end (&start, &canvas->stats->stage_times [CHAFA_CANVAS_STAGE_PIXEL_CANVAS_DRAW]);
+}
+
+/**
+ * chafa_canvas_draw_all_pixels:
+ * @canvas: Canvas whose pixel data to replace
+ * @src_pixel_type: Pixel format of @src_pixels
+ * @src_pixels: Pointer to the start of source pixel memory
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @src_rowstride: Number of bytes between the start of each pixel row
+ *
+ * Replaces pixel data of @canvas with a copy of that found at @src_pixels,
+ * which must be in one of the formats supported by #ChafaPixelType.
+ *
+ * Planar YUV frames from a video decoder can be passed in directly. They
+ * are converted to RGB as part of scaling, without an intermediate copy.
+ * The same goes for 16-bit and floating point images.
+ *
+ * A canvas can be redrawn any number of times. Its work buffers are
+ * allocated on the first draw and reused after that, and in symbol mode,
+ * rows are only recalculated when their pixels change. When showing
+ * animations or video, it is therefore much cheaper to keep drawing into
+ * the same canvas than to create a new one for each frame.
+ *
+ * Since: 1.2
+ **/
+void
+chafa_canvas_draw_all_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                              const guint8 *src_pixels,
+                              gint src_width, gint src_height, gint src_rowstride)
+{
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
+    g_return_if_fail (src_pixels != NULL);
+    g_return_if_fail (src_width >= 0);
+    g_return_if_fail (src_height >= 0);
+
+    if (src_width == 0 || src_height == 0)
+        return;
+
+    g_atomic_int_set (&canvas->draw_cancelled, FALSE);
+    draw_all_pixels (canvas, src_pixel_type, src_pixels, src_width, src_height, src_rowstride);
+}
+
+typedef struct
+{
+    ChafaCanvas *canvas;
+    ChafaPixelType src_pixel_type;
+    const guint8 *src_pixels;
+    gint src_width, src_height, src_rowstride;
+    ChafaCanvasDrawFunc done_func;
+    gpointer user_data;
+}
+AsyncDraw;
+
+/* Async draws get their own threads, since the batch workers may all be
+ * busy. Each draw still farms its stages out to the batch pool. */
+static GThreadPool *async_draw_pool;
+static GMutex async_draw_mutex;
+
+static void
+async_draw_worker (AsyncDraw *ad, G_GNUC_UNUSED gpointer data)
+{
+    draw_all_pixels (ad->canvas, ad->src_pixel_type, ad->src_pixels,
+                     ad->src_width, ad->src_height, ad->src_rowstride);
+
+    if (ad->done_func)
+        ad->done_func (ad->canvas, !draw_is_cancelled (ad->canvas), ad->user_data);
+
+    chafa_canvas_unref (ad->canvas);
+    g_free (ad);
+}
+
+/**
+ * ChafaCanvasDrawFunc:
+ * @canvas: The canvas that was drawn
+ * @completed: %TRUE if the draw ran to completion, %FALSE if it was cancelled
+ * @user_data: Data passed to chafa_canvas_draw_all_pixels_async()
+ *
+ * Called when an asynchronous draw finishes. This is called from a worker
+ * thread.
+ *
+ * Since: 1.14
+ **/
+
+/**
+ * chafa_canvas_draw_all_pixels_async:
+ * @canvas: Canvas whose pixel data to replace
+ * @src_pixel_type: Pixel format of @src_pixels
+ * @src_pixels: Pointer to the start of source pixel memory
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @src_rowstride: Number of bytes between the start of each pixel row
+ * @done_func: (scope async) (nullable): Function to call when done, or %NULL
+ * @user_data: Data to pass to @done_func
+ *
+ * Like chafa_canvas_draw_all_pixels(), but returns right away and draws
+ * on a worker thread. @done_func is called from that thread when the draw
+ * is complete or was cancelled with chafa_canvas_cancel_draw().
+ *
+ * The source pixels are not copied, and must stay valid until @done_func
+ * is called. @canvas is kept alive for the duration, but must not be
+ * used for anything else until then.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_draw_all_pixels_async (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                                    const guint8 *src_pixels,
+                                    gint src_width, gint src_height, gint src_rowstride,
+                                    ChafaCanvasDrawFunc done_func, gpointer user_data)
+{
+    AsyncDraw *ad;
+
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
+    g_return_if_fail (src_pixels != NULL);
+    g_return_if_fail (src_width >= 0);
+    g_return_if_fail (src_height >= 0);
+
+    /* Reset here, not in the worker, so a draw can be cancelled before
+     * it gets going */
+    g_atomic_int_set (&canvas->draw_cancelled, FALSE);
+
+    ad = g_new (AsyncDraw, 1);
+    ad->canvas = canvas;
+    ad->src_pixel_type = src_pixel_type;
+    ad->src_pixels = src_pixels;
+    ad->src_width = src_width;
+    ad->src_height = src_height;
+    ad->src_rowstride = src_rowstride;
+    ad->done_func = done_func;
+    ad->user_data = user_data;
+    chafa_canvas_ref (canvas);
+
+    g_mutex_lock (&async_draw_mutex);
+    if (!async_draw_pool)
+        async_draw_pool = g_thread_pool_new ((GFunc) async_draw_worker, NULL, -1, FALSE, NULL);
+    g_mutex_unlock (&async_draw_mutex);
+
+    g_thread_pool_push (async_draw_pool, ad, NULL);
+}
+
+typedef struct
+{
+    ChafaCanvasRowFunc row_func;
+    gpointer user_data;
+}
+PullRows;
+
+static void
+pull_row (uint32_t inrow_ofs, void *row_out, void *user_data)
+{
+    PullRows *pull_rows = user_data;
+
+    pull_rows->row_func (inrow_ofs, row_out, pull_rows->user_data);
+}
+
+/**
+ * ChafaCanvasRowFunc:
+ * @row: Index of the row to fetch, counting from the top
+ * @row_out: Where to store the row's pixels
+ * @user_data: Data passed to chafa_canvas_draw_all_pixels_from_rows()
+ *
+ * Fills in a single row of source pixels. Rows are requested in
+ * ascending order, and each row is requested exactly once.
+ *
+ * Since: 1.14
+ **/
+
+/**
+ * chafa_canvas_draw_all_pixels_from_rows:
+ * @canvas: Canvas whose pixel data to replace
+ * @src_pixel_type: Pixel format of the source rows
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @row_func: Callback that provides source rows
+ * @user_data: Data to pass to @row_func
+ *
+ * Like chafa_canvas_draw_all_pixels(), but the source pixels are pulled
+ * from @row_func one row at a time as they're needed, instead of being
+ * read from a single buffer. Only a handful of source rows are held in
+ * memory at once, so this can be used with images that would be too
+ * large to decode in full.
+ *
+ * The row buffer passed to @row_func holds @src_width pixels of
+ * @src_pixel_type. Planar pixel types are not supported.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_draw_all_pixels_from_rows (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                                        gint src_width, gint src_height,
+                                        ChafaCanvasRowFunc row_func, gpointer user_data)
+{
+    SmolScaleCtx *scale_ctx;
+    PullRows pull_rows;
+    ChafaStageTime start;
+    guint8 *pixels;
+    gint width, height;
+
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
+    g_return_if_fail (src_pixel_type != CHAFA_PIXEL_I420);
+    g_return_if_fail (src_pixel_type != CHAFA_PIXEL_NV12);
+    g_return_if_fail (row_func != NULL);
+    g_return_if_fail (src_width >= 0);
+    g_return_if_fail (src_height >= 0);
+
+    if (src_width == 0 || src_height == 0)
+        return;
+
+    /* The rows have to arrive in order, so the source is scaled down to
+     * canvas resolution in a single pass up front. The regular draw then
+     * sees a source that matches the canvas and just copies it. */
+    width = canvas->width_pixels;
+    height = canvas->height_pixels;
+    pixels = g_malloc ((gsize) width * height * sizeof (guint32));
+
+    if (canvas->stats)
+        chafa_stage_time_begin (&start);
+
+    pull_rows.row_func = row_func;
+    pull_rows.user_data = user_data;
+
+    scale_ctx = smol_scale_new_pull ((SmolPixelType) src_pixel_type,
+                                     pull_row, &pull_rows,
+                                     src_width, src_height,
+                                     SMOL_PIXEL_RGBA8_PREMULTIPLIED,
+                                     pixels,
+                                     width, height, width * sizeof (guint32),
+                                     NULL, NULL,
+                                     SMOL_NO_FLAGS);
+    smol_scale_batch (scale_ctx, 0, height);
+    smol_scale_destroy (scale_ctx);
+
+    if (canvas->stats)
+        chafa_stage_time_end (&start, &canvas->stats->stage_times [CHAFA_CANVAS_STAGE_SCALE]);
+
+    g_atomic_int_set (&canvas->draw_cancelled, FALSE);
+    draw_all_pixels (canvas, CHAFA_PIXEL_RGBA8_PREMULTIPLIED, pixels,
+                     width, height, width * sizeof (guint32));
+
+    g_free (pixels);
+}
+
+/**
+ * chafa_canvas_cancel_draw:
+ * @canvas: Canvas whose draw to cancel
+ *
+ * Asks a draw in progress on @canvas to stop as soon as possible. Work is
+ * abandoned between rows of cells and between processing passes, so this
+ * takes effect quickly even for large canvases. It's safe to call from any
+ * thread, and does nothing if no draw is in progress.
+ *
+ * This is mainly useful with chafa_canvas_draw_all_pixels_async(), but
+ * synchronous draws running on another thread can be cancelled too.
+ *
+ * The contents of a canvas whose draw was cancelled are undefined until
+ * it's drawn again. They should not be printed.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_cancel_draw (ChafaCanvas *canvas)
+{
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+
+    g_atomic_int_set (&canvas->draw_cancelled, TRUE);
+}
+
+/* A progressive draw refines its preview in about this many steps */
+#define PROGRESSIVE_STEPS 8
+
+/* Copies the rows that were just refined into the canvas holding what's
+ * on screen */
+static void
+copy_cell_rows (ChafaCanvas *dest, const ChafaCanvas *src, gint first_row, gint n_rows)
+{
+    gint width = src->config.width;
+
+    memcpy (&dest->cells [first_row * width], &src->cells [first_row * width],
+            (gsize) n_rows * width * sizeof (ChafaCanvasCell));
+}
+
+/**
+ * ChafaCanvasRefineFunc:
+ * @canvas: The canvas being drawn
+ * @prev_canvas: (nullable): A canvas holding what was passed the previous time, or %NULL
+ * @user_data: Data passed to chafa_canvas_draw_all_pixels_progressive()
+ *
+ * Called each time a progressive draw has something new to show. @prev_canvas
+ * is %NULL the first time. After that, it holds the cells @canvas had at the
+ * previous call, so passing both to chafa_canvas_print_delta() will yield
+ * just the rows that were refined since then.
+ *
+ * Returns: %TRUE to continue, %FALSE to stop refining
+ *
+ * Since: 1.14
+ **/
+
+/**
+ * chafa_canvas_draw_all_pixels_progressive:
+ * @canvas: Canvas whose pixel data to replace
+ * @src_pixel_type: Pixel format of @src_pixels
+ * @src_pixels: Pointer to the start of source pixel memory
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @src_rowstride: Number of bytes between the start of each pixel row
+ * @refine_func: (scope call): Function to call with each new version of the canvas
+ * @user_data: Data to pass to @refine_func
+ *
+ * Like chafa_canvas_draw_all_pixels(), but gets something on screen sooner.
+ * In symbol mode, a quick preview is made first, using only the mean color
+ * of each cell and the fill symbols, and passed to @refine_func. The rows
+ * are then refined at the canvas' full work factor a few at a time, and
+ * @refine_func is called after each batch.
+ *
+ * Returning %FALSE from @refine_func, or cancelling with
+ * chafa_canvas_cancel_draw(), stops the refinement and leaves @canvas in
+ * whatever state it was last shown in.
+ *
+ * In the pixel modes, and when the cells were found in the cache, there is
+ * nothing to refine, and @refine_func is only called once.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_draw_all_pixels_progressive (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                                          const guint8 *src_pixels,
+                                          gint src_width, gint src_height, gint src_rowstride,
+                                          ChafaCanvasRefineFunc refine_func, gpointer user_data)
+{
+    ChafaCellCacheKey cache_key;
+    ChafaCanvas *shown;
+    gboolean use_cache;
+    gint work_level;
+    gint n_rows;
+    gint row;
+
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
+    g_return_if_fail (src_pixels != NULL);
+    g_return_if_fail (src_width >= 0);
+    g_return_if_fail (src_height >= 0);
+    g_return_if_fail (refine_func != NULL);
+
+    if (src_width == 0 || src_height == 0)
+        return;
+
+    g_atomic_int_set (&canvas->draw_cancelled, FALSE);
+
+    use_cache = chafa_cell_cache_get_max_size () > 0;
+
+    if (canvas->config.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS
+        || (use_cache && fetch_cached_cells (canvas, &cache_key, src_pixel_type, src_pixels,
+                                             src_width, src_height, src_rowstride)))
+    {
+        if (canvas->config.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS)
+            draw_all_pixels (canvas, src_pixel_type, src_pixels,
+                             src_width, src_height, src_rowstride);
+        if (!draw_is_cancelled (canvas))
+            refine_func (canvas, NULL, user_data);
+        return;
+    }
+
+    /* The pixels are prepared once, at the full work factor, since the
+     * refinement needs them and scaling twice would cost more than the
+     * preview saves */
+    prepare_symbol_pixels (canvas, src_pixel_type, src_pixels,
+                           src_width, src_height, src_rowstride);
+    if (draw_is_cancelled (canvas))
+        goto cancelled;
+
+    /* Preview at the lowest work level, without wide symbols. Every row
+     * must be recalculated afterwards, so the hashes are not trusted on
+     * either pass. */
+    work_level = canvas->work_level;
+    set_work_level (canvas, 0);
+    canvas->preview = TRUE;
+    canvas->have_cell_hashes = FALSE;
+    chafa_canvas_update_cells (canvas);
+    canvas->preview = FALSE;
+    canvas->have_cell_hashes = FALSE;
+    set_work_level (canvas, work_level);
+
+    if (draw_is_cancelled (canvas))
+        goto cancelled;
+
+    canvas->needs_clear = FALSE;
+    if (!refine_func (canvas, NULL, user_data))
+        return;
+
+    shown = chafa_canvas_new_similar (canvas);
+    copy_cell_rows (shown, canvas, 0, canvas->config.height);
+    shown->needs_clear = FALSE;
+
+    n_rows = MAX ((canvas->config.height + PROGRESSIVE_STEPS - 1) / PROGRESSIVE_STEPS,
+                  chafa_get_n_actual_threads ());
+
+    for (row = 0; row < canvas->config.height; row += n_rows)
+    {
+        gint step_rows = MIN (n_rows, canvas->config.height - row);
+
+        update_cells_rect (canvas, 0, row, canvas->config.width, step_rows);
+
+        if (draw_is_cancelled (canvas))
+        {
+            /* Put back what was shown, so the canvas stays printable */
+            copy_cell_rows (canvas, shown, row, step_rows);
+            break;
+        }
+
+        if (!refine_func (canvas, shown, user_data))
+            break;
+
+        copy_cell_rows (shown, canvas, row, step_rows);
+    }
+
+    chafa_canvas_unref (shown);
+
+    /* Only a complete refinement describes the hashed pixels */
+    if (row >= canvas->config.height)
+    {
+        canvas->have_cell_hashes = TRUE;
+        update_cells_opaque (canvas);
+
+        if (use_cache)
+            chafa_cell_cache_insert (&cache_key, canvas->cells,
+                                     canvas->config.width * canvas->config.height,
+                                     canvas->have_alpha,
+                                     canvas->config.canvas_mode != CHAFA_CANVAS_MODE_TRUECOLOR);
+    }
+    return;
+
+cancelled:
+    canvas->needs_clear = TRUE;
+    canvas->have_cell_hashes = FALSE;
+}
+
+/**
+ * chafa_canvas_draw_pixels_rect:
+ * @canvas: Canvas whose pixel data to partially replace
+ * @x: Leftmost cell column to draw into
+ * @y: Topmost cell row to draw into
+ * @width: Width of the area to draw into, in cells
+ * @height: Height of the area to draw into, in cells
+ * @src_pixel_type: Pixel format of @src_pixels
+ * @src_pixels: Pointer to the start of source pixel memory
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @src_rowstride: Number of bytes between the start of each pixel row
+ *
+ * Like chafa_canvas_draw_all_pixels(), but the source image is scaled into
+ * a rectangle of cells, leaving the rest of @canvas as it is. Only the
+ * cells inside the rectangle are processed, so this is much cheaper than
+ * redrawing the whole canvas when a small part of it changes.
+ *
+ * Wide symbols that straddle the edge of the rectangle have their outside
+ * halves replaced with blank cells. Since chafa_canvas_print_delta()
+ * compares cell contents, it will only emit the cells that changed.
+ *
+ * This is only supported in #CHAFA_PIXEL_MODE_SYMBOLS.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_draw_pixels_rect (ChafaCanvas *canvas,
+                               gint x, gint y, gint width, gint height,
+                               ChafaPixelType src_pixel_type,
+                               const guint8 *src_pixels,
+                               gint src_width, gint src_height, gint src_rowstride)
+{
+    ChafaPixel *rect_pixels;
+    ChafaScratchMark mark;
+    gint rect_width_pixels, rect_height_pixels;
+    gint i;
+
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS);
+    g_return_if_fail (x >= 0 && y >= 0 && width >= 0 && height >= 0);
+    g_return_if_fail (x + width <= canvas->config.width);
+    g_return_if_fail (y + height <= canvas->config.height);
+    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
+    g_return_if_fail (src_pixels != NULL);
+    g_return_if_fail (src_width >= 0);
+    g_return_if_fail (src_height >= 0);
+
+    if (width == 0 || height == 0 || src_width == 0 || src_height == 0)
+        return;
+
+    g_atomic_int_set (&canvas->draw_cancelled, FALSE);
+
+    /* Cells outside the rectangle start out blank */
+    maybe_clear (canvas);
+    canvas->needs_clear = FALSE;
+
+    if (!canvas->pixels)
+        alloc_pixels (canvas);
+
+    if (!canvas->cell_hashes)
+        canvas->cell_hashes = g_new (guint64, canvas->config.width * canvas->config.height);
+
+    rect_width_pixels = width * CHAFA_SYMBOL_WIDTH_PIXELS;
+    rect_height_pixels = height * CHAFA_SYMBOL_HEIGHT_PIXELS;
+    chafa_scratch_mark (&mark);
+    rect_pixels = chafa_scratch_new (ChafaPixel, rect_width_pixels * rect_height_pixels);
+
+    /* The rest of the canvas may still have transparent pixels */
+    if (chafa_prepare_pixel_data_for_symbols (&canvas->fg_palette, &canvas->dither,
+                                              canvas->config.color_space,
+                                              canvas->config.preprocessing_enabled,
+                                              canvas->work_factor_int,
+                                              src_pixel_type,
+                                              src_pixels,
+                                              src_width, src_height,
+                                              src_rowstride,
+                                              rect_pixels,
+                                              rect_width_pixels, rect_height_pixels,
+                                              canvas->stats ? canvas->stats->stage_times : NULL,
+                                              NULL))
+        canvas->have_alpha = TRUE;
+    canvas->cells_opaque = FALSE;
+
+    for (i = 0; i < rect_height_pixels; i++)
+    {
+        memcpy (&canvas->pixels [(y * CHAFA_SYMBOL_HEIGHT_PIXELS + i) * canvas->width_pixels
+                                 + x * CHAFA_SYMBOL_WIDTH_PIXELS],
+                &rect_pixels [i * rect_width_pixels],
+                rect_width_pixels * sizeof (ChafaPixel));
+    }
+
+    chafa_scratch_release (&mark);
+
+    if (canvas->config.alpha_threshold == 0)
+        canvas->have_alpha = FALSE;
+
+    /* have_cell_hashes is left alone. If it's FALSE, the hashes outside
+     * the rectangle are garbage and must stay marked as such. */
+    update_cells_rect (canvas, x, y, width, height);
+}
+
+/* Sources are halved repeatedly for chafa_canvas_draw_all_pixels_multi (),
+ * and each canvas is drawn from the smallest level that is still at least
+ * as big as the canvas in both dimensions */
+#define PYRAMID_LEVELS_MAX 16
+
+typedef struct
+{
+    ChafaPixelType pixel_type;
+    const guint8 *pixels;
+    gint width, height, rowstride;
+}
+PyramidLevel;
+
+typedef struct
+{
+    SmolScaleCtx *scale_ctx;
+    PyramidLevel *dest;
+}
+ScaleLevelCtx;
+
+typedef struct
+{
+    ChafaCanvas **canvases;
+    const PyramidLevel *levels;
+    const gint *canvas_levels;
+}
+MultiDrawCtx;
+
+static void
+scale_level_worker (ChafaBatchInfo *batch, const ScaleLevelCtx *ctx)
+{
+    smol_scale_batch_full (ctx->scale_ctx,
+                           (guint8 *) ctx->dest->pixels + ctx->dest->rowstride * batch->first_row,
+                           batch->first_row,
+                           batch->n_rows);
+}
+
+static void
+build_pyramid_level (const PyramidLevel *src, PyramidLevel *dest)
+{
+    ScaleLevelCtx ctx;
+
+    dest->pixel_type = CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
+    dest->width = MAX (src->width / 2, 1);
+    dest->height = MAX (src->height / 2, 1);
+    dest->rowstride = CHAFA_ALIGNED_ROWSTRIDE (dest->width * sizeof (guint32));
+    dest->pixels = chafa_aligned_alloc ((gsize) dest->rowstride * dest->height);
+
+    ctx.dest = dest;
+    ctx.scale_ctx = smol_scale_new_full ((SmolPixelType) src->pixel_type,
+                                         (const guint32 *) src->pixels,
+                                         src->width, src->height, src->rowstride,
+                                         SMOL_PIXEL_RGBA8_PREMULTIPLIED,
+                                         NULL,
+                                         dest->width, dest->height, dest->rowstride,
+                                         NULL,
+                                         &ctx);
+
+    chafa_process_batches (&ctx,
+                           "scale-level",
+                           (GFunc) scale_level_worker,
+                           NULL,
+                           dest->height,
+                           chafa_get_n_actual_threads (),
+                           1);
+
+    smol_scale_destroy (ctx.scale_ctx);
+}
+
+static void
+draw_multi_worker (ChafaBatchInfo *batch, const MultiDrawCtx *ctx)
+{
+    gint i;
+
+    for (i = batch->first_row; i < batch->first_row + batch->n_rows; i++)
+    {
+        const PyramidLevel *level = &ctx->levels [ctx->canvas_levels [i]];
+
+        chafa_canvas_draw_all_pixels (ctx->canvases [i], level->pixel_type, level->pixels,
+                                      level->width, level->height, level->rowstride);
+    }
+}
+
+/**
+ * chafa_canvas_draw_all_pixels_multi:
+ * @canvases: (array length=n_canvases): Canvases whose pixel data to replace
+ * @n_canvases: Number of canvases in @canvases
+ * @src_pixel_type: Pixel format of @src_pixels
+ * @src_pixels: Pointer to the start of source pixel memory
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @src_rowstride: Number of bytes between the start of each pixel row
+ *
+ * Like calling chafa_canvas_draw_all_pixels() on each of @canvases with the
+ * same source image, but cheaper when they're much smaller than the source.
+ *
+ * The source is successively halved, and each canvas is drawn from the
+ * smallest of those versions that's no smaller than the canvas, so the
+ * full size image is only scaled down once. The canvases are then drawn
+ * concurrently. Canvases that are about as big as the source are drawn
+ * from it directly. The results may differ slightly from drawing each
+ * canvas on its own.
+ *
+ * The canvases can have different configurations, but must be distinct.
+ *
+ * Planar YUV sources are drawn into each canvas without the intermediate
+ * steps.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_draw_all_pixels_multi (ChafaCanvas **canvases, gint n_canvases,
+                                    ChafaPixelType src_pixel_type,
+                                    const guint8 *src_pixels,
+                                    gint src_width, gint src_height, gint src_rowstride)
+{
+    PyramidLevel levels [PYRAMID_LEVELS_MAX];
+    MultiDrawCtx ctx;
+    gint *canvas_levels;
+    gint n_levels = 1;
+    gint i;
+
+    g_return_if_fail (canvases != NULL || n_canvases == 0);
+    g_return_if_fail (n_canvases >= 0);
+    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
+    g_return_if_fail (src_pixels != NULL);
+    g_return_if_fail (src_width >= 0);
+    g_return_if_fail (src_height >= 0);
+
+    if (n_canvases == 0 || src_width == 0 || src_height == 0)
+        return;
+
+    levels [0].pixel_type = src_pixel_type;
+    levels [0].pixels = src_pixels;
+    levels [0].width = src_width;
+    levels [0].height = src_height;
+    levels [0].rowstride = src_rowstride;
+
+    canvas_levels = g_new0 (gint, n_canvases);
+
+    /* Levels are only built while some canvas can use them. Each one is
+     * made from the previous, so the source is only read once. */
+    while (n_levels < PYRAMID_LEVELS_MAX
+           && src_pixel_type != CHAFA_PIXEL_I420
+           && src_pixel_type != CHAFA_PIXEL_NV12)
+    {
+        gint half_width = levels [n_levels - 1].width / 2;
+        gint half_height = levels [n_levels - 1].height / 2;
+        gboolean wanted = FALSE;
+
+        for (i = 0; i < n_canvases; i++)
+        {
+            if (canvases [i]->width_pixels <= half_width
+                && canvases [i]->height_pixels <= half_height)
+            {
+                canvas_levels [i] = n_levels;
+                wanted = TRUE;
+            }
+        }
+
+        if (!wanted)
+            break;
+
+        build_pyramid_level (&levels [n_levels - 1], &levels [n_levels]);
+        n_levels++;
+    }
+
+    ctx.canvases = canvases;
+    ctx.levels = levels;
+    ctx.canvas_levels = canvas_levels;
+
+    /* Each canvas is a row. Their own stages are batched in turn, which
+     * the pool handles by having this thread help out. */
+    chafa_process_batches (&ctx,
+                           "draw-multi",
+                           (GFunc) draw_multi_worker,
+                           NULL,
+                           n_canvases,
+                           n_canvases,
+                           1);
+
+    for (i = 1; i < n_levels; i++)
+        chafa_aligned_free ((gpointer) levels [i].pixels);
+    g_free (canvas_levels);
+}
+
+/**
+ * chafa_canvas_set_contents_rgba8:
+ * @canvas: Canvas whose pixel data to replace
+ * @src_pixels: Pointer to the start of source pixel memory
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @src_rowstride: Number of bytes between the start of each pixel row
+ *
+ * Replaces pixel data of @canvas with a copy of that found at @src_pixels.
+ * The source data must be in packed 8-bits-per-channel RGBA format. The
+ * alpha value is expressed as opacity (0xff is opaque) and is not
+ * premultiplied.
+ *
+ * Deprecated: 1.2: Use chafa_canvas_draw_all_pixels() instead.
+ **/
+void
+chafa_canvas_set_contents_rgba8 (ChafaCanvas *canvas, const guint8 *src_pixels,
+                                 gint src_width, gint src_height, gint src_rowstride)
+{
+    chafa_canvas_draw_all_pixels (canvas, CHAFA_PIXEL_RGBA8_UNASSOCIATED,
+                                  src_pixels, src_width, src_height, src_rowstride);
+}
+
+/**
+ * chafa_canvas_build_ansi:
+ * @canvas: The canvas to generate an ANSI character representation of
+ *
+ * Builds a UTF-8 string of ANSI sequences and symbols representing
+ * the canvas' current contents. This can e.g. be printed to a terminal.
+ * The exact choice of escape sequences and symbols, dimensions, etc. is
+ * determined by the configuration assigned to @canvas on its creation.
+ *
+ * All output lines except for the last one will end in a newline.
+ *
+ * Returns: A UTF-8 string of ANSI sequences and symbols
+ *
+ * Deprecated: 1.6: Use chafa_canvas_print() instead.
+ **/
+GString *
+chafa_canvas_build_ansi (ChafaCanvas *canvas)
+{
+    g_return_val_if_fail (canvas != NULL, NULL);
+    g_return_val_if_fail (canvas->refs > 0, NULL);
+
+    return chafa_canvas_print (canvas, NULL);
+}
+
+/* skip_unchanged only applies to sixels and Kitty; see chafa_canvas_print_delta () */
+static void
+print_to_sink (ChafaCanvas *canvas, ChafaTermInfo *term_info, ChafaStringSink *sink,
+               gboolean skip_unchanged)
+{
+    ChafaStageTime start;
+
+    if (canvas->stats)
+        chafa_stage_time_begin (&start);
+
+    if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS)
+    {
+        maybe_clear (canvas);
+        chafa_canvas_print_symbols (canvas, term_info, sink);
+    }
+    else if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SIXELS
+             && chafa_term_info_get_seq (term_info, CHAFA_TERM_SEQ_BEGIN_SIXELS))
+    {
+        gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
+        gchar *out;
+
+        /* Sixel mode */
+
+        out = chafa_term_info_emit_begin_sixels (term_info, buf, 0, 1, 0);
+        *out = '\0';
+        g_string_append (sink->gs, buf);
+
+        g_string_append_printf (sink->gs, "\"1;1;%d;%d", canvas->width_pixels, canvas->height_pixels);
+        chafa_sixel_canvas_build_ansi (canvas->pixel_canvas, sink, skip_unchanged);
+
+        out = chafa_term_info_emit_end_sixels (term_info, buf);
+        *out = '\0';
+        g_string_append (sink->gs, buf);
+    }
+    else if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_KITTY
+             && chafa_term_info_get_seq (term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_IMAGE_V1))
+    {
+        /* Kitty mode */
+
+        if (!skip_unchanged
+            || !chafa_kitty_canvas_build_ansi_delta (canvas->pixel_canvas, term_info, sink,
+                                                     canvas->config.width, canvas->config.height,
+                                                     canvas->image_id))
+            chafa_kitty_canvas_build_ansi (canvas->pixel_canvas, term_info, sink,
+                                           canvas->config.width, canvas->config.height,
+                                           canvas->image_id);
+    }
+    else if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_ITERM2)
+    {
+        /* iTerm2 mode */
+
+        chafa_iterm2_canvas_build_ansi (canvas->pixel_canvas, term_info, sink,
+                                        canvas->config.width, canvas->config.height);
+    }
+
+    chafa_string_sink_flush (sink);
+
+    /* Includes the time spent in the caller's sink function */
+    if (canvas->stats)
+        chafa_stage_time_end (&start, &canvas->stats->stage_times [CHAFA_CANVAS_STAGE_PRINT]);
+}
+
+/**
+ * chafa_canvas_print:
+ * @canvas: The canvas to generate a printable representation of
+ * @term_info: Terminal to format for, or %NULL for fallback
+ *
+ * Builds a UTF-8 string of terminal control sequences and symbols
+ * representing the canvas' current contents. This can e.g. be printed
+ * to a terminal. The exact choice of escape sequences and symbols,
+ * dimensions, etc. is determined by the configuration assigned to
+ * @canvas on its creation.
+ *
+ * All output lines except for the last one will end in a newline.
+ *
+ * Returns: A UTF-8 string of terminal control sequences and symbols
+ *
+ * Since: 1.6
+ **/
+GString *
+chafa_canvas_print (ChafaCanvas *canvas, ChafaTermInfo *term_info)
+{
+    ChafaStringSink sink = { 0 };
+
+    g_return_val_if_fail (canvas != NULL, NULL);
+    g_return_val_if_fail (canvas->refs > 0, NULL);
+
+    if (term_info)
+        chafa_term_info_ref (term_info);
+    else
+        term_info = chafa_term_db_get_fallback_info (chafa_term_db_get_default ());
+
+    sink.gs = g_string_new ("");
+    print_to_sink (canvas, term_info, &sink, FALSE);
+
+    chafa_term_info_unref (term_info);
+    return sink.gs;
+}
+
+/**
+ * ChafaCanvasSinkFunc:
+ * @data: Pointer to a piece of output
+ * @len: Length of @data in bytes
+ * @user_data: The data passed to chafa_canvas_print_to_sink()
+ *
+ * Receives output from chafa_canvas_print_to_sink(). @data is not
+ * NUL-terminated and is only valid for the duration of the call.
+ *
+ * Returns: %TRUE to continue, %FALSE to stop, e.g. on a write error
+ *
+ * Since: 1.14
+ **/
+
+/**
+ * chafa_canvas_print_to_sink:
+ * @canvas: The canvas to generate a printable representation of
+ * @term_info: Terminal to format for, or %NULL for fallback
+ * @sink_func: Function to pass output to
+ * @user_data: Data to pass to @sink_func
+ *
+ * Like chafa_canvas_print(), but instead of returning the whole output at
+ * once, passes it to @sink_func in pieces as it is generated. In symbol
+ * mode, this happens once per row; in pixel modes, once per sixel band or
+ * chunk of encoded image data. This keeps memory use low for large frames
+ * and allows the output to be written while encoding is still in progress.
+ *
+ * The concatenated pieces are identical to the output of
+ * chafa_canvas_print(). If @sink_func returns %FALSE, no more output is
+ * passed to it.
+ *
+ * Returns: %TRUE on success, %FALSE if @sink_func returned %FALSE
+ *
+ * Since: 1.14
+ **/
+gboolean
+chafa_canvas_print_to_sink (ChafaCanvas *canvas, ChafaTermInfo *term_info,
+                            ChafaCanvasSinkFunc sink_func, gpointer user_data)
+{
+    ChafaStringSink sink = { 0 };
+
+    g_return_val_if_fail (canvas != NULL, FALSE);
+    g_return_val_if_fail (canvas->refs > 0, FALSE);
+    g_return_val_if_fail (sink_func != NULL, FALSE);
+
+    if (term_info)
+        chafa_term_info_ref (term_info);
+    else
+        term_info = chafa_term_db_get_fallback_info (chafa_term_db_get_default ());
+
+    sink.gs = g_string_new ("");
+    sink.sink_func = sink_func;
+    sink.sink_data = user_data;
+
+    print_to_sink (canvas, term_info, &sink, FALSE);
+
+    g_string_free (sink.gs, TRUE);
+    chafa_term_info_unref (term_info);
+    return !sink.failed;
+}
+
+static gboolean
+is_fgbg_mode (ChafaCanvasMode canvas_mode)
+{
+    return canvas_mode == CHAFA_CANVAS_MODE_FGBG
+        || canvas_mode == CHAFA_CANVAS_MODE_FGBG_BGFG;
+}
+
+static ChafaRemapTarget *
+get_remap_target (ChafaCanvas *canvas, ChafaCanvasMode canvas_mode)
+{
+    ChafaRemapTarget *target = canvas->remap_targets [canvas_mode];
+    ChafaCanvasConfig *config;
+
+    if (target)
+        return target;
+
+    config = chafa_canvas_config_copy (&canvas->config);
+    chafa_canvas_config_set_canvas_mode (config, canvas_mode);
+    chafa_canvas_config_set_stats_enabled (config, FALSE);
+
+    target = g_new0 (ChafaRemapTarget, 1);
+    target->canvas = chafa_canvas_new (config);
+    chafa_canvas_config_unref (config);
+
+    canvas->remap_targets [canvas_mode] = target;
+    return target;
+}
+
+/* Converts a source cell color to the target's mode. side is
+ * CHAFA_COLOR_PAIR_FG or CHAFA_COLOR_PAIR_BG, since the palettes for the
+ * two differ in 16/8 mode. */
+static guint32
+remap_cell_color (ChafaCanvas *canvas, ChafaRemapTarget *target, gint side, guint32 color)
+{
+    const ChafaPalette *src_palette = side == CHAFA_COLOR_PAIR_FG
+        ? &canvas->fg_palette : &canvas->bg_palette;
+    ChafaCanvas *dest = target->canvas;
+    ChafaColor col;
+    guint32 key;
+    gint slot;
+
+    if (canvas->config.canvas_mode == CHAFA_CANVAS_MODE_TRUECOLOR)
+    {
+        chafa_unpack_color (color, &col);
+        if (col.ch [3] < canvas->config.alpha_threshold)
+            return transparent_cell_color (dest->config.canvas_mode);
+    }
+    else
+    {
+        if (color == CHAFA_PALETTE_INDEX_TRANSPARENT)
+            return transparent_cell_color (dest->config.canvas_mode);
+        col = *chafa_palette_get_color (src_palette, CHAFA_COLOR_SPACE_RGB, color);
+    }
+
+    col.ch [3] = 0xff;
+    key = chafa_pack_color (&col);
+    slot = ((key * 0x9e3779b1U) >> 20) & (CHAFA_REMAP_CACHE_SIZE - 1);
+
+    if (target->keys [side] [slot] == key)
+        return target->values [side] [slot];
+
+    if (dest->config.canvas_mode == CHAFA_CANVAS_MODE_TRUECOLOR)
+    {
+        target->values [side] [slot] = key;
+    }
+    else
+    {
+        const ChafaPalette *dest_palette = side == CHAFA_COLOR_PAIR_FG
+            ? &dest->fg_palette : &dest->bg_palette;
+        ChafaColor lookup_col = col;
+
+        if (dest->config.color_space == CHAFA_COLOR_SPACE_DIN99D)
+            chafa_color_rgb_to_din99d (&col, &lookup_col);
+
+        target->values [side] [slot] =
+            chafa_palette_lookup_nearest (dest_palette, dest->config.color_space, &lookup_col, NULL);
+    }
+
+    target->keys [side] [slot] = key;
+    return target->values [side] [slot];
+}
+
+/**
+ * chafa_canvas_print_for_mode:
+ * @canvas: The canvas to generate a printable representation of
+ * @term_info: Terminal to format for, or %NULL for fallback
+ * @canvas_mode: Canvas mode to print in
+ *
+ * Like chafa_canvas_print(), but prints the canvas' cells as if it had
+ * been created with @canvas_mode. The symbols are kept, and the colors are
+ * converted to the nearest ones available in @canvas_mode.
+ *
+ * This allows a single drawn canvas to be shown on several terminals
+ * with different capabilities. The cells only have to be computed once,
+ * preferably in the richest mode any of the terminals supports, and the
+ * colors are converted through a cache that's kept with @canvas, so
+ * printing the same canvas again is cheap.
+ *
+ * This only works in %CHAFA_PIXEL_MODE_SYMBOLS. The
+ * %CHAFA_CANVAS_MODE_FGBG and %CHAFA_CANVAS_MODE_FGBG_BGFG modes can
+ * only be printed as themselves, since their symbols are chosen for two
+ * colors.
+ *
+ * A canvas must not be printed from more than one thread at a time.
+ *
+ * Returns: A UTF-8 string of terminal control sequences and symbols
+ *
+ * Since: 1.14
+ **/
+GString *
+chafa_canvas_print_for_mode (ChafaCanvas *canvas, ChafaTermInfo *term_info,
+                             ChafaCanvasMode canvas_mode)
+{
+    ChafaRemapTarget *target;
+    ChafaCanvas *dest;
+    gint i;
+
+    g_return_val_if_fail (canvas != NULL, NULL);
+    g_return_val_if_fail (canvas->refs > 0, NULL);
+    g_return_val_if_fail (canvas_mode >= 0 && canvas_mode < CHAFA_CANVAS_MODE_MAX, NULL);
+
+    if (canvas_mode == canvas->config.canvas_mode)
+        return chafa_canvas_print (canvas, term_info);
+
+    g_return_val_if_fail (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS, NULL);
+    g_return_val_if_fail (!is_fgbg_mode (canvas_mode), NULL);
+    g_return_val_if_fail (!is_fgbg_mode (canvas->config.canvas_mode), NULL);
+
+    maybe_clear (canvas);
+
+    target = get_remap_target (canvas, canvas_mode);
+    dest = target->canvas;
+
+    for (i = 0; i < canvas->config.width * canvas->config.height; i++)
+    {
+        const ChafaCanvasCell *src_cell = &canvas->cells [i];
+        ChafaCanvasCell *dest_cell = &dest->cells [i];
+
+        dest_cell->c = src_cell->c;
+        dest_cell->fg_color = remap_cell_color (canvas, target, CHAFA_COLOR_PAIR_FG,
+                                                src_cell->fg_color);
+        dest_cell->bg_color = remap_cell_color (canvas, target, CHAFA_COLOR_PAIR_BG,
+                                                src_cell->bg_color);
+    }
+
+    dest->needs_clear = FALSE;
+    dest->have_cell_hashes = FALSE;
+    dest->have_alpha = canvas->have_alpha;
+    dest->cells_opaque = canvas->cells_opaque;
+
+    return chafa_canvas_print (dest, term_info);
+}
+
+/* Streams sixels band by band from the source pixels. See
+ * chafa_canvas_draw_and_print_to_sink (). */
+static void
+stream_sixels_to_sink (ChafaCanvas *canvas, ChafaTermInfo *term_info, ChafaStringSink *sink,
+                       ChafaPixelType src_pixel_type, const guint8 *src_pixels,
+                       gint src_width, gint src_height, gint src_rowstride)
+{
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
+    ChafaPalette *palette;
+    ChafaStageTime start;
+    gchar *out;
+
+    if (canvas->stats)
+        chafa_stage_time_begin (&start);
+
+    canvas->fg_palette.alpha_threshold = canvas->config.alpha_threshold;
+    palette = &canvas->fg_palette;
+
+    if (canvas->custom_palette)
+    {
+        canvas->custom_palette->alpha_threshold = canvas->config.alpha_threshold;
+        palette = canvas->custom_palette;
+    }
+
+    out = chafa_term_info_emit_begin_sixels (term_info, buf, 0, 1, 0);
+    *out = '\0';
+    g_string_append (sink->gs, buf);
+
+    g_string_append_printf (sink->gs, "\"1;1;%d;%d", canvas->width_pixels, canvas->height_pixels);
+    chafa_sixel_canvas_stream_pixels (canvas->width_pixels, canvas->height_pixels,
+                                      canvas->config.color_space,
+                                      palette,
+                                      canvas->custom_palette != NULL,
+                                      &canvas->dither,
+                                      &canvas->draw_cancelled,
+                                      src_pixel_type, src_pixels,
+                                      src_width, src_height, src_rowstride,
+                                      sink);
+
+    out = chafa_term_info_emit_end_sixels (term_info, buf);
+    *out = '\0';
+    g_string_append (sink->gs, buf);
+
+    chafa_string_sink_flush (sink);
+
+    if (canvas->stats)
+        chafa_stage_time_end (&start, &canvas->stats->stage_times [CHAFA_CANVAS_STAGE_PRINT]);
+}
+
+/**
+ * chafa_canvas_draw_and_print_to_sink:
+ * @canvas: Canvas to draw and print
+ * @term_info: Terminal to format for, or %NULL for fallback
+ * @src_pixel_type: Pixel format of @src_pixels
+ * @src_pixels: Pointer to the start of source pixel memory
+ * @src_width: Width in pixels of source pixel data
+ * @src_height: Height in pixels of source pixel data
+ * @src_rowstride: Number of bytes between the start of each pixel row
+ * @sink_func: Function to pass output to
+ * @user_data: Data to pass to @sink_func
+ *
+ * Draws the pixels into @canvas as with chafa_canvas_draw_all_pixels(),
+ * then prints it as with chafa_canvas_print_to_sink().
+ *
+ * In sixel mode without palette reuse, the two are done in one pass
+ * instead. The image is scaled, quantized, dithered and encoded a few
+ * six pixel high bands at a time, and each group of bands is passed to
+ * @sink_func as soon as it's ready. Neither the scaled nor the quantized
+ * image is held in memory in full, which makes a big difference for very
+ * large images. A dynamic palette is generated from a downscaled copy of
+ * the image, so the colors may differ slightly from a separate draw and
+ * print. The canvas' own contents are not updated in this case.
+ *
+ * Returns: %TRUE on success, %FALSE if @sink_func returned %FALSE
+ *
+ * Since: 1.14
+ **/
+gboolean
+chafa_canvas_draw_and_print_to_sink (ChafaCanvas *canvas, ChafaTermInfo *term_info,
+                                     ChafaPixelType src_pixel_type,
+                                     const guint8 *src_pixels,
+                                     gint src_width, gint src_height, gint src_rowstride,
+                                     ChafaCanvasSinkFunc sink_func, gpointer user_data)
+{
+    ChafaStringSink sink = { 0 };
+
+    g_return_val_if_fail (canvas != NULL, FALSE);
+    g_return_val_if_fail (canvas->refs > 0, FALSE);
+    g_return_val_if_fail (src_pixel_type < CHAFA_PIXEL_MAX, FALSE);
+    g_return_val_if_fail (src_pixels != NULL, FALSE);
+    g_return_val_if_fail (sink_func != NULL, FALSE);
+
+    if (term_info)
+        chafa_term_info_ref (term_info);
+    else
+        term_info = chafa_term_db_get_fallback_info (chafa_term_db_get_default ());
+
+    sink.gs = g_string_new ("");
+    sink.sink_func = sink_func;
+    sink.sink_data = user_data;
+
+    g_atomic_int_set (&canvas->draw_cancelled, FALSE);
+
+    if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SIXELS
+        && !canvas->config.palette_reuse_enabled
+        && chafa_term_info_get_seq (term_info, CHAFA_TERM_SEQ_BEGIN_SIXELS))
+    {
+        if (src_width > 0 && src_height > 0)
+            stream_sixels_to_sink (canvas, term_info, &sink, src_pixel_type, src_pixels,
+                                   src_width, src_height, src_rowstride);
+    }
+    else
+    {
+        if (src_width > 0 && src_height > 0)
+            draw_all_pixels (canvas, src_pixel_type, src_pixels, src_width, src_height, src_rowstride);
+
+        print_to_sink (canvas, term_info, &sink, FALSE);
+    }
+
+    g_string_free (sink.gs, TRUE);
+    chafa_term_info_unref (term_info);
+    return !sink.failed;
+}
+
+/**
+ * chafa_canvas_print_delta:
+ * @canvas: The canvas to generate a printable representation of
+ * @prev_canvas: Canvas that was printed previously at the same location, or %NULL
+ * @term_info: Terminal to format for, or %NULL for fallback
+ *
+ * Like chafa_canvas_print(), but assumes the terminal is already showing
+ * @prev_canvas at the cursor position, and only emits the runs of cells
+ * that differ from it. Unchanged cells are skipped over with cursor
+ * movement sequences.
+ *
+ * This only happens if #CHAFA_OPTIMIZATION_SKIP_CELLS is enabled in
+ * @canvas' configuration, both canvases are in symbol mode with the
+ * same geometry and canvas mode, and @term_info supports
+ * #CHAFA_TERM_SEQ_CURSOR_RIGHT. Otherwise, or if @prev_canvas is %NULL,
+ * the output is identical to that of chafa_canvas_print().
+ *
+ * Sixel canvases with palette reuse enabled (see
+ * chafa_canvas_config_set_palette_reuse_enabled()) are drawn into
+ * repeatedly, and remember what they printed last. For these, pass
+ * @canvas itself as @prev_canvas, and the six pixel high bands that are
+ * unchanged since the last print are left out of the sixel data. This
+ * also requires #CHAFA_OPTIMIZATION_SKIP_CELLS, and the palette must not
+ * have changed in the meantime; if it did, the whole image is sent.
+ *
+ * Kitty canvases with an image ID (see chafa_canvas_set_image_id()) work
+ * the same way. The image is updated in place in the terminal, and only
+ * the tiles that changed since it was last stored are sent. This requires
+ * #CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_IMAGE_V1, and the image must still be
+ * on screen at the cursor position.
+ *
+ * As with chafa_canvas_print(), the output starts at the top left
+ * corner of the canvas and leaves the cursor on its last row, though
+ * not necessarily in the last column.
+ *
+ * Returns: A UTF-8 string of terminal control sequences and symbols
+ *
+ * Since: 1.14
+ **/
+GString *
+chafa_canvas_print_delta (ChafaCanvas *canvas, ChafaCanvas *prev_canvas,
+                          ChafaTermInfo *term_info)
+{
+    GString *str;
+
+    g_return_val_if_fail (canvas != NULL, NULL);
+    g_return_val_if_fail (canvas->refs > 0, NULL);
+
+    if (prev_canvas == canvas
+        && ((canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SIXELS
+             && canvas->config.palette_reuse_enabled)
+            || (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_KITTY
+                && canvas->image_id != 0))
+        && (canvas->config.optimizations & CHAFA_OPTIMIZATION_SKIP_CELLS))
+    {
+        ChafaStringSink sink = { 0 };
+
+        if (term_info)
+            chafa_term_info_ref (term_info);
+        else
+            term_info = chafa_term_db_get_fallback_info (chafa_term_db_get_default ());
+
+        sink.gs = g_string_new ("");
+        print_to_sink (canvas, term_info, &sink, TRUE);
+
+        chafa_term_info_unref (term_info);
+        return sink.gs;
+    }
+
+    if (!prev_canvas
+        || prev_canvas == canvas
+        || !(canvas->config.optimizations & CHAFA_OPTIMIZATION_SKIP_CELLS)
+        || canvas->config.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS
+        || prev_canvas->config.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS
+        || canvas->config.canvas_mode != prev_canvas->config.canvas_mode
+        || canvas->config.width != prev_canvas->config.width
+        || canvas->config.height != prev_canvas->config.height)
+        return chafa_canvas_print (canvas, term_info);
+
+    if (term_info)
+        chafa_term_info_ref (term_info);
+    else
+        term_info = chafa_term_db_get_fallback_info (chafa_term_db_get_default ());
+
+    if (chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_CURSOR_RIGHT))
+    {
+        ChafaStringSink sink = { 0 };
+        ChafaStageTime start;
+
+        if (canvas->stats)
+            chafa_stage_time_begin (&start);
+
+        maybe_clear (canvas);
+        maybe_clear (prev_canvas);
+
+        sink.gs = g_string_new ("");
+        chafa_canvas_print_symbols_delta (canvas, prev_canvas, term_info, &sink);
+        str = sink.gs;
+
+        if (canvas->stats)
+            chafa_stage_time_end (&start, &canvas->stats->stage_times [CHAFA_CANVAS_STAGE_PRINT]);
+    }
+    else
+    {
+        str = chafa_canvas_print (canvas, term_info);
+    }
+
+    chafa_term_info_unref (term_info);
+    return str;
+}
+
+/**
+ * ChafaCanvasStage:
+ * @CHAFA_CANVAS_STAGE_SCALE: Scaling the source image in symbol mode. Since this runs in parallel inside the first preparation pass, the time is summed over all threads and reported as both wall and CPU time.
+ * @CHAFA_CANVAS_STAGE_PREPARE_PASS_1: First pixel preparation pass in symbol mode: scaling, pixel format conversion and histogram generation.
+ * @CHAFA_CANVAS_STAGE_PREPARE_PASS_2: Second pixel preparation pass in symbol mode: normalization, dithering and color space conversion.
+ * @CHAFA_CANVAS_STAGE_UPDATE_CELLS: Picking symbols and colors for cells.
+ * @CHAFA_CANVAS_STAGE_DISPLAY_COLORS: Setting up the display colors when the canvas is created.
+ * @CHAFA_CANVAS_STAGE_PIXEL_CANVAS_DRAW: Scaling and quantizing the image in sixel, Kitty and iTerm2 modes.
+ * @CHAFA_CANVAS_STAGE_PRINT: Generating the printable output.
+ * @CHAFA_CANVAS_STAGE_MAX: Last supported stage plus one.
+ **/
+
+/**
+ * ChafaCanvasCounter:
+ * @CHAFA_CANVAS_COUNTER_CELLS_FAST: Cells evaluated with the fast symbol picker.
+ * @CHAFA_CANVAS_COUNTER_CELLS_SLOW: Cells evaluated with the exhaustive symbol picker, used at high work factors.
+ * @CHAFA_CANVAS_COUNTER_CELLS_WIDE: Pairs of cells evaluated for a wide symbol.
+ * @CHAFA_CANVAS_COUNTER_CELLS_FILL: Featureless cells for which a fill symbol was tried.
+ * @CHAFA_CANVAS_COUNTER_CELLS_SKIPPED: Cells that were kept from the previous draw because their pixels did not change, or copied from the cell cache.
+ * @CHAFA_CANVAS_COUNTER_CELLS_WIDE_GATED: Pairs of cells not evaluated for a wide symbol, because their narrow symbols were already good enough.
+ * @CHAFA_CANVAS_COUNTER_CELLS_FLAT: Cells of near-uniform color that were given a blank symbol without a search.
+ * @CHAFA_CANVAS_COUNTER_CELLS_REPEATED: Cells that got the same symbol as their left neighbour, because the pixels were identical.
+ * @CHAFA_CANVAS_COUNTER_CELLS_KEPT: Cells that kept their contents from the previous draw, because they were within the color tolerance.
+ * @CHAFA_CANVAS_COUNTER_CELLS_MERGED: Cells that took on colors from their left neighbour within the color tolerance.
+ * @CHAFA_CANVAS_COUNTER_CELLS_ROUNDED: Cells that had their truecolor values rounded within the color tolerance.
+ * @CHAFA_CANVAS_COUNTER_SCRATCH_BYTES_MAX: The most scratch memory used by a worker for one batch of cells, in bytes. Unlike the other counters, this is a high-water mark, not a sum. Since: 1.14
+ * @CHAFA_CANVAS_COUNTER_CELLS_CACHED: Cells whose pixels had been seen before, anywhere in this or an earlier frame, and were looked up in the block cache. See chafa_set_block_cache_size(). Since: 1.14
+ * @CHAFA_CANVAS_COUNTER_MAX: Last supported counter plus one.
+ **/
+
+/**
+ * chafa_canvas_get_stage_time:
+ * @canvas: The canvas to inspect
+ * @stage: Processing stage to query
+ * @wall_time_us_out: Location to store the elapsed time in, or %NULL
+ * @cpu_time_us_out: Location to store the CPU time in, or %NULL
+ *
+ * Gets the total time spent in @stage since the canvas was created or
+ * chafa_canvas_reset_stats() was called, in microseconds. CPU time is
+ * counted for the whole process, so it includes the work done by all
+ * threads in that period.
+ *
+ * Statistics are only collected if they were enabled with
+ * chafa_canvas_config_set_stats_enabled(). Otherwise, the times will
+ * be zero.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_get_stage_time (ChafaCanvas *canvas, ChafaCanvasStage stage,
+                             gint64 *wall_time_us_out, gint64 *cpu_time_us_out)
+{
+    const ChafaStageTime *stage_time;
+
+    if (wall_time_us_out)
+        *wall_time_us_out = 0;
+    if (cpu_time_us_out)
+        *cpu_time_us_out = 0;
+
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (stage < CHAFA_CANVAS_STAGE_MAX);
+
+    if (!canvas->stats)
+        return;
+
+    stage_time = &canvas->stats->stage_times [stage];
+
+    if (wall_time_us_out)
+        *wall_time_us_out = stage_time->wall_us;
+    if (cpu_time_us_out)
+        *cpu_time_us_out = stage_time->cpu_us;
+}
+
+/**
+ * chafa_canvas_get_counter:
+ * @canvas: The canvas to inspect
+ * @counter: Counter to query
+ *
+ * Gets the value of @counter accumulated since the canvas was created or
+ * chafa_canvas_reset_stats() was called. The counters are only updated if
+ * statistics were enabled with chafa_canvas_config_set_stats_enabled().
+ *
+ * Returns: The counter's value
+ *
+ * Since: 1.14
+ **/
+gint64
+chafa_canvas_get_counter (ChafaCanvas *canvas, ChafaCanvasCounter counter)
+{
+    g_return_val_if_fail (canvas != NULL, 0);
+    g_return_val_if_fail (canvas->refs > 0, 0);
+    g_return_val_if_fail (counter < CHAFA_CANVAS_COUNTER_MAX, 0);
+
+    if (!canvas->stats)
+        return 0;
+
+    return canvas->stats->counters [counter];
 }
 
 /**
- * chafa_canvas_set_contents_rgba8:
- * @canvas: Canvas whose pixel data to replace
- * @src_pixels: Pointer to the start of source pixel memory
- * @src_width: Width in pixels of source pixel data
- * @src_height: Height in pixels of source pixel data
- * @src_rowstride: Number of bytes between the start of each pixel row
+ * chafa_canvas_get_work_factor:
+ * @canvas: The canvas to inspect
  *
- * Replaces pixel data of @canvas with a copy of that found at @src_pixels.
- * The source data must be in packed 8-bits-per-channel RGBA format. The
- * alpha value is expressed as opacity (0xff is opaque) and is not
- * premultiplied.
+ * Gets the work factor that was used to pick symbols and colors in the
+ * most recent draw. This is the configured work factor, unless a time
+ * budget was set with chafa_canvas_config_set_time_budget(), in which case
+ * it reflects the quality that could be achieved within the budget.
  *
- * Deprecated: 1.2: Use chafa_canvas_draw_all_pixels() instead.
+ * Returns: The work factor [0.0 - 1.0]
+ *
+ * Since: 1.14
  **/
-void
-chafa_canvas_set_contents_rgba8 (ChafaCanvas *canvas, const guint8 *src_pixels,
-                                 gint src_width, gint src_height, gint src_rowstride)
+gfloat
+chafa_canvas_get_work_factor (ChafaCanvas *canvas)
 {
-    chafa_canvas_draw_all_pixels (canvas, CHAFA_PIXEL_RGBA8_UNASSOCIATED,
-                                  src_pixels, src_width, src_height, src_rowstride);
+    g_return_val_if_fail (canvas != NULL, 0.0f);
+    g_return_val_if_fail (canvas->refs > 0, 0.0f);
+
+    return canvas->last_work_factor_int / 10.0f;
 }
 
 /**
- * chafa_canvas_build_ansi:
- * @canvas: The canvas to generate an ANSI character representation of
- *
- * Builds a UTF-8 string of ANSI sequences and symbols representing
- * the canvas' current contents. This can e.g. be printed to a terminal.
- * The exact choice of escape sequences and symbols, dimensions, etc. is
- * determined by the configuration assigned to @canvas on its creation.
+ * chafa_canvas_reset_stats:
+ * @canvas: The canvas whose statistics to reset
  *
- * All output lines except for the last one will end in a newline.
- *
- * Returns: A UTF-8 string of ANSI sequences and symbols
+ * Sets all stage times and counters of @canvas to zero.
  *
- * Deprecated: 1.6: Use chafa_canvas_print() instead.
+ * Since: 1.14
  **/
-GString *
-chafa_canvas_build_ansi (ChafaCanvas *canvas)
+void
+chafa_canvas_reset_stats (ChafaCanvas *canvas)
 {
-    g_return_val_if_fail (canvas != NULL, NULL);
-    g_return_val_if_fail (canvas->refs > 0, NULL);
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
 
-    return chafa_canvas_print (canvas, NULL);
+    if (canvas->stats)
+        stats_reset (canvas->stats);
 }
 
 /**
- * chafa_canvas_print:
- * @canvas: The canvas to generate a printable representation of
- * @term_info: Terminal to format for, or %NULL for fallback
+ * chafa_canvas_get_symbol_usage:
+ * @canvas: The canvas to inspect
+ * @symbols_out: (out) (array) (transfer full): Location to store the symbols' code points
+ * @n_picked_out: (out) (array) (transfer full) (optional): Location to store the pick counts
+ * @n_candidate_out: (out) (array) (transfer full) (optional): Location to store the candidate counts
  *
- * Builds a UTF-8 string of terminal control sequences and symbols
- * representing the canvas' current contents. This can e.g. be printed
- * to a terminal. The exact choice of escape sequences and symbols,
- * dimensions, etc. is determined by the configuration assigned to
- * @canvas on its creation.
+ * Gets per-symbol tallies accumulated since the canvas was created or
+ * chafa_canvas_reset_stats() was called. For each symbol in the canvas'
+ * symbol map, this is the number of cells it was picked for, and the
+ * number of times it made the short list of candidates considered for a
+ * cell. Wide symbols are listed after narrow ones.
  *
- * All output lines except for the last one will end in a newline.
+ * Symbols that are rarely or never picked for typical content can be
+ * removed from the map, making the search faster.
  *
- * Returns: A UTF-8 string of terminal control sequences and symbols
+ * Picks are counted when a cell is evaluated, so cells that were skipped
+ * or filled in some other way don't count towards them. The tallies are
+ * only updated if statistics were enabled with
+ * chafa_canvas_config_set_stats_enabled(). The arrays must be freed
+ * with g_free().
  *
- * Since: 1.6
+ * Returns: The number of symbols in each array
+ *
+ * Since: 1.14
  **/
-GString *
-chafa_canvas_print (ChafaCanvas *canvas, ChafaTermInfo *term_info)
+gint
+chafa_canvas_get_symbol_usage (ChafaCanvas *canvas, gunichar **symbols_out,
+                               gint64 **n_picked_out, gint64 **n_candidate_out)
 {
-    GString *str;
+    const ChafaSymbolMap *symbol_map;
+    gint n_symbols, i;
 
-    g_return_val_if_fail (canvas != NULL, NULL);
-    g_return_val_if_fail (canvas->refs > 0, NULL);
+    g_return_val_if_fail (canvas != NULL, 0);
+    g_return_val_if_fail (canvas->refs > 0, 0);
+    g_return_val_if_fail (symbols_out != NULL, 0);
 
-    if (term_info)
-        chafa_term_info_ref (term_info);
-    else
-        term_info = chafa_term_db_get_fallback_info (chafa_term_db_get_default ());
+    symbol_map = &canvas->config.symbol_map;
+    n_symbols = symbol_map->n_symbols + symbol_map->n_symbols2;
 
-    if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS)
-    {
-        maybe_clear (canvas);
-        str = chafa_canvas_print_symbols (canvas, term_info);
-    }
-    else if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_SIXELS
-             && chafa_term_info_get_seq (term_info, CHAFA_TERM_SEQ_BEGIN_SIXELS))
+    *symbols_out = g_new (gunichar, MAX (n_symbols, 1));
+    if (n_picked_out)
+        *n_picked_out = g_new0 (gint64, MAX (n_symbols, 1));
+    if (n_candidate_out)
+        *n_candidate_out = g_new0 (gint64, MAX (n_symbols, 1));
+
+    for (i = 0; i < n_symbols; i++)
     {
-        gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
-        gchar *out;
+        (*symbols_out) [i] = i < symbol_map->n_symbols
+            ? symbol_map->symbols [i].c
+            : symbol_map->symbols2 [i - symbol_map->n_symbols].sym [0].c;
 
-        /* Sixel mode */
+        if (!canvas->stats)
+            continue;
 
-        out = chafa_term_info_emit_begin_sixels (term_info, buf, 0, 1, 0);
-        *out = '\0';
-        str = g_string_new (buf);
+        if (n_picked_out)
+            (*n_picked_out) [i] = g_atomic_int_get (&canvas->stats->symbol_picks [i]);
+        if (n_candidate_out)
+            (*n_candidate_out) [i] = g_atomic_int_get (&canvas->stats->symbol_candidates [i]);
+    }
 
-        g_string_append_printf (str, "\"1;1;%d;%d", canvas->width_pixels, canvas->height_pixels);
-        chafa_sixel_canvas_build_ansi (canvas->pixel_canvas, str);
+    return n_symbols;
+}
 
-        out = chafa_term_info_emit_end_sixels (term_info, buf);
-        *out = '\0';
-        g_string_append (str, buf);
-    }
-    else if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_KITTY
-             && chafa_term_info_get_seq (term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_IMAGE_V1))
-    {
-        /* Kitty mode */
+/**
+ * chafa_canvas_set_palette:
+ * @canvas: The canvas to set the palette of
+ * @colors: (nullable): Array of packed 0xRRGGBB colors
+ * @n_colors: Number of elements in @colors
+ *
+ * Makes @canvas quantize pixels to @colors instead of generating a
+ * palette for each image. This only affects %CHAFA_PIXEL_MODE_SIXELS,
+ * and is useful for keeping the colors of animation frames consistent.
+ *
+ * At most 255 colors are used; any beyond that are ignored. Passing
+ * %NULL or zero colors reverts to generated palettes.
+ *
+ * The new palette takes effect with the next call to
+ * chafa_canvas_draw_all_pixels().
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_set_palette (ChafaCanvas *canvas, const guint32 *colors, gint n_colors)
+{
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (n_colors >= 0);
 
-        str = g_string_new ("");
-        chafa_kitty_canvas_build_ansi (canvas->pixel_canvas, term_info, str,
-                                       canvas->config.width, canvas->config.height);
-    }
-    else if (canvas->config.pixel_mode == CHAFA_PIXEL_MODE_ITERM2)
+    if (canvas->custom_palette)
     {
-        /* iTerm2 mode */
-
-        str = g_string_new ("");
-        chafa_iterm2_canvas_build_ansi (canvas->pixel_canvas, term_info, str,
-                                        canvas->config.width, canvas->config.height);
+        chafa_palette_deinit (canvas->custom_palette);
+        g_free (canvas->custom_palette);
+        canvas->custom_palette = NULL;
     }
-    else
+
+    if (colors && n_colors > 0)
     {
-        str = g_string_new ("");
+        /* The last index is reserved for transparency */
+        canvas->custom_palette = g_new0 (ChafaPalette, 1);
+        chafa_palette_init (canvas->custom_palette, CHAFA_PALETTE_TYPE_DYNAMIC_256);
+        chafa_palette_load_colors (canvas->custom_palette, colors, MIN (n_colors, 255));
     }
 
-    chafa_term_info_unref (term_info);
-    return str;
+    /* Picked up by the next draw */
+    destroy_pixel_canvas (canvas);
+}
+
+/**
+ * chafa_canvas_get_image_id:
+ * @canvas: The canvas to inspect
+ *
+ * Returns the ID that printed images will be stored under. See
+ * chafa_canvas_set_image_id().
+ *
+ * Returns: The image ID, or 0 if images aren't stored
+ *
+ * Since: 1.14
+ **/
+guint
+chafa_canvas_get_image_id (ChafaCanvas *canvas)
+{
+    g_return_val_if_fail (canvas != NULL, 0);
+    g_return_val_if_fail (canvas->refs > 0, 0);
+
+    return canvas->image_id;
+}
+
+/**
+ * chafa_canvas_set_image_id:
+ * @canvas: The canvas to modify
+ * @image_id: Image ID in the range [1..9999], or 0
+ *
+ * Makes the terminal keep the image under @image_id when @canvas is
+ * printed, replacing any image it already has under that ID. The image
+ * is displayed as usual, and can be shown again later with
+ * #CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1 without being transferred again.
+ * This is useful for looping animations.
+ *
+ * This only affects #CHAFA_PIXEL_MODE_KITTY, and requires the terminal to
+ * support #CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1 and
+ * #CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1. Stored images are always
+ * transferred in-band, regardless of the transmission medium.
+ *
+ * Passing 0, the default, disables storage.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_set_image_id (ChafaCanvas *canvas, guint image_id)
+{
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (image_id <= 9999);
+
+    canvas->image_id = image_id;
 }
 
 /**
@@ -1795,6 +4891,9 @@ chafa_canvas_set_char_at (ChafaCanvas *canvas, gint x, gint y, gunichar c)
         return 0;
 
     cell = &canvas->cells [y * canvas->config.width + x];
+    canvas->have_cell_hashes = FALSE;
+    canvas->cells_opaque = FALSE;
+
     cell [0].c = c;
 
     if (cwidth == 2)
@@ -1840,51 +4939,13 @@ void
 chafa_canvas_get_colors_at (ChafaCanvas *canvas, gint x, gint y,
                             gint *fg_out, gint *bg_out)
 {
-    const ChafaCanvasCell *cell;
-    gint fg = -1, bg = -1;
-
     g_return_if_fail (canvas != NULL);
     g_return_if_fail (canvas->refs > 0);
     g_return_if_fail (x >= 0 && x < canvas->config.width);
     g_return_if_fail (y >= 0 && y < canvas->config.height);
 
-    cell = &canvas->cells [y * canvas->config.width + x];
-
-    switch (canvas->config.canvas_mode)
-    {
-        case CHAFA_CANVAS_MODE_TRUECOLOR:
-            fg = packed_rgba_to_rgb (canvas, cell->fg_color);
-            bg = packed_rgba_to_rgb (canvas, cell->bg_color);
-            break;
-        case CHAFA_CANVAS_MODE_INDEXED_256:
-        case CHAFA_CANVAS_MODE_INDEXED_240:
-        case CHAFA_CANVAS_MODE_INDEXED_16:
-        case CHAFA_CANVAS_MODE_INDEXED_16_8:
-        case CHAFA_CANVAS_MODE_INDEXED_8:
-        case CHAFA_CANVAS_MODE_FGBG_BGFG:
-        case CHAFA_CANVAS_MODE_FGBG:
-            if (cell->fg_color == CHAFA_PALETTE_INDEX_BG
-                || cell->fg_color == CHAFA_PALETTE_INDEX_TRANSPARENT)
-                fg = -1;
-            else
-                fg = color_to_rgb (canvas,
-                                   *get_palette_color_with_color_space (&canvas->fg_palette, cell->fg_color,
-                                                                        CHAFA_COLOR_SPACE_RGB));
-            if (cell->bg_color == CHAFA_PALETTE_INDEX_BG
-                || cell->bg_color == CHAFA_PALETTE_INDEX_TRANSPARENT)
-                bg = -1;
-            else
-                bg = color_to_rgb (canvas,
-                                   *get_palette_color_with_color_space (&canvas->bg_palette, cell->bg_color,
-                                                                        CHAFA_COLOR_SPACE_RGB));
-            break;
-        case CHAFA_CANVAS_MODE_MAX:
-            g_assert_not_reached ();
-            break;
-    }
-
-    *fg_out = fg;
-    *bg_out = bg;
+    cell_get_colors (canvas, &canvas->cells [y * canvas->config.width + x],
+                     fg_out, bg_out);
 }
 
 /**
@@ -1918,6 +4979,8 @@ chafa_canvas_set_colors_at (ChafaCanvas *canvas, gint x, gint y,
     g_return_if_fail (y >= 0 && y < canvas->config.height);
 
     cell = &canvas->cells [y * canvas->config.width + x];
+    canvas->have_cell_hashes = FALSE;
+    canvas->cells_opaque = FALSE;
 
     switch (canvas->config.canvas_mode)
     {
@@ -1984,42 +5047,15 @@ void
 chafa_canvas_get_raw_colors_at (ChafaCanvas *canvas, gint x, gint y,
                                 gint *fg_out, gint *bg_out)
 {
-    const ChafaCanvasCell *cell;
-    gint fg = -1, bg = -1;
+    gint fg, bg;
 
     g_return_if_fail (canvas != NULL);
     g_return_if_fail (canvas->refs > 0);
     g_return_if_fail (x >= 0 && x < canvas->config.width);
     g_return_if_fail (y >= 0 && y < canvas->config.height);
 
-    cell = &canvas->cells [y * canvas->config.width + x];
-
-    switch (canvas->config.canvas_mode)
-    {
-        case CHAFA_CANVAS_MODE_TRUECOLOR:
-            fg = packed_rgba_to_rgb (canvas, cell->fg_color);
-            bg = packed_rgba_to_rgb (canvas, cell->bg_color);
-            break;
-        case CHAFA_CANVAS_MODE_INDEXED_256:
-        case CHAFA_CANVAS_MODE_INDEXED_240:
-        case CHAFA_CANVAS_MODE_INDEXED_16:
-        case CHAFA_CANVAS_MODE_INDEXED_16_8:
-        case CHAFA_CANVAS_MODE_INDEXED_8:
-            fg = cell->fg_color < 256 ? (gint) cell->fg_color : -1;
-            bg = cell->bg_color < 256 ? (gint) cell->bg_color : -1;
-            break;
-        case CHAFA_CANVAS_MODE_FGBG_BGFG:
-            fg = cell->fg_color == CHAFA_PALETTE_INDEX_FG ? 0 : -1;
-            bg = cell->bg_color == CHAFA_PALETTE_INDEX_FG ? 0 : -1;
-            break;
-        case CHAFA_CANVAS_MODE_FGBG:
-            fg = 0;
-            bg = -1;
-            break;
-        case CHAFA_CANVAS_MODE_MAX:
-            g_assert_not_reached ();
-            break;
-    }
+    cell_get_raw_colors (canvas, &canvas->cells [y * canvas->config.width + x],
+                         &fg, &bg);
 
     if (fg_out)
         *fg_out = fg;
@@ -2059,6 +5095,8 @@ chafa_canvas_set_raw_colors_at (ChafaCanvas *canvas, gint x, gint y,
     g_return_if_fail (y >= 0 && y < canvas->config.height);
 
     cell = &canvas->cells [y * canvas->config.width + x];
+    canvas->have_cell_hashes = FALSE;
+    canvas->cells_opaque = FALSE;
 
     switch (canvas->config.canvas_mode)
     {
@@ -2100,3 +5138,130 @@ chafa_canvas_set_raw_colors_at (ChafaCanvas *canvas, gint x, gint y,
         cell [1].bg_color = cell->bg_color;
     }
 }
+
+/**
+ * chafa_canvas_get_cells:
+ * @canvas: The canvas to inspect
+ * @x: Leftmost column of the rectangle to inspect
+ * @y: Top row of the rectangle to inspect
+ * @width: Width of the rectangle, in cells
+ * @height: Height of the rectangle, in cells
+ * @chars_out: (out caller-allocates) (optional): Storage for characters
+ * @fg_out: (out caller-allocates) (optional): Storage for foreground colors
+ * @bg_out: (out caller-allocates) (optional): Storage for background colors
+ * @rowstride: Distance between rows in the output arrays, in elements
+ *
+ * Gets the characters and colors of a rectangle of cells in one call. This
+ * is equivalent to calling chafa_canvas_get_char_at() and
+ * chafa_canvas_get_colors_at() for each cell, but much faster when
+ * transferring a large canvas to e.g. a TUI library.
+ *
+ * The output arrays are laid out in rows, with the cell at (x + i, y + j)
+ * going to element (j * @rowstride + i). @rowstride must be at least
+ * @width, and each array that is not %NULL must have room for
+ * ((@height - 1) * @rowstride + @width) elements.
+ *
+ * The values are the same as those returned by the per-cell functions;
+ * the colors are -1 for transparency, packed 8bpc RGB otherwise, i.e.
+ * 0x00RRGGBB hex, and the rightmost cell of a double-width character
+ * contains 0.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_get_cells (ChafaCanvas *canvas, gint x, gint y, gint width, gint height,
+                        gunichar *chars_out, gint *fg_out, gint *bg_out, gint rowstride)
+{
+    gint i, j;
+
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (x >= 0 && width >= 0 && x + width <= canvas->config.width);
+    g_return_if_fail (y >= 0 && height >= 0 && y + height <= canvas->config.height);
+    g_return_if_fail (rowstride >= width);
+
+    for (j = 0; j < height; j++)
+    {
+        const ChafaCanvasCell *cells = &canvas->cells [(y + j) * canvas->config.width + x];
+        gint ofs = j * rowstride;
+
+        if (chars_out)
+        {
+            for (i = 0; i < width; i++)
+                chars_out [ofs + i] = cells [i].c;
+        }
+
+        if (fg_out || bg_out)
+        {
+            for (i = 0; i < width; i++)
+            {
+                gint fg, bg;
+
+                cell_get_colors (canvas, &cells [i], &fg, &bg);
+
+                if (fg_out)
+                    fg_out [ofs + i] = fg;
+                if (bg_out)
+                    bg_out [ofs + i] = bg;
+            }
+        }
+    }
+}
+
+/**
+ * chafa_canvas_get_raw_cells:
+ * @canvas: The canvas to inspect
+ * @x: Leftmost column of the rectangle to inspect
+ * @y: Top row of the rectangle to inspect
+ * @width: Width of the rectangle, in cells
+ * @height: Height of the rectangle, in cells
+ * @chars_out: (out caller-allocates) (optional): Storage for characters
+ * @fg_out: (out caller-allocates) (optional): Storage for foreground colors
+ * @bg_out: (out caller-allocates) (optional): Storage for background colors
+ * @rowstride: Distance between rows in the output arrays, in elements
+ *
+ * Like chafa_canvas_get_cells(), but the colors are the ones returned by
+ * chafa_canvas_get_raw_colors_at(): -1 for transparency, packed 8bpc RGB
+ * in truecolor mode, or the raw pen value (0-255) in indexed modes.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_canvas_get_raw_cells (ChafaCanvas *canvas, gint x, gint y, gint width, gint height,
+                            gunichar *chars_out, gint *fg_out, gint *bg_out, gint rowstride)
+{
+    gint i, j;
+
+    g_return_if_fail (canvas != NULL);
+    g_return_if_fail (canvas->refs > 0);
+    g_return_if_fail (x >= 0 && width >= 0 && x + width <= canvas->config.width);
+    g_return_if_fail (y >= 0 && height >= 0 && y + height <= canvas->config.height);
+    g_return_if_fail (rowstride >= width);
+
+    for (j = 0; j < height; j++)
+    {
+        const ChafaCanvasCell *cells = &canvas->cells [(y + j) * canvas->config.width + x];
+        gint ofs = j * rowstride;
+
+        if (chars_out)
+        {
+            for (i = 0; i < width; i++)
+                chars_out [ofs + i] = cells [i].c;
+        }
+
+        if (fg_out || bg_out)
+        {
+            for (i = 0; i < width; i++)
+            {
+                gint fg, bg;
+
+                cell_get_raw_colors (canvas, &cells [i], &fg, &bg);
+
+                if (fg_out)
+                    fg_out [ofs + i] = fg;
+                if (bg_out)
+                    bg_out [ofs + i] = bg;
+            }
+        }
+    }
+}
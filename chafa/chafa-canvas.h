@@ -30,6 +30,48 @@ G_BEGIN_DECLS
 
 typedef struct ChafaCanvas ChafaCanvas;
 
+typedef gboolean (*ChafaCanvasSinkFunc) (const gchar *data, gsize len, gpointer user_data);
+typedef void (*ChafaCanvasDrawFunc) (ChafaCanvas *canvas, gboolean completed, gpointer user_data);
+typedef gboolean (*ChafaCanvasRefineFunc) (ChafaCanvas *canvas, ChafaCanvas *prev_canvas,
+                                           gpointer user_data);
+typedef void (*ChafaCanvasRowFunc) (gint row, guint8 *row_out, gpointer user_data);
+
+/* Statistics */
+
+typedef enum
+{
+    CHAFA_CANVAS_STAGE_SCALE,
+    CHAFA_CANVAS_STAGE_PREPARE_PASS_1,
+    CHAFA_CANVAS_STAGE_PREPARE_PASS_2,
+    CHAFA_CANVAS_STAGE_UPDATE_CELLS,
+    CHAFA_CANVAS_STAGE_DISPLAY_COLORS,
+    CHAFA_CANVAS_STAGE_PIXEL_CANVAS_DRAW,
+    CHAFA_CANVAS_STAGE_PRINT,
+
+    CHAFA_CANVAS_STAGE_MAX
+}
+ChafaCanvasStage;
+
+typedef enum
+{
+    CHAFA_CANVAS_COUNTER_CELLS_FAST,
+    CHAFA_CANVAS_COUNTER_CELLS_SLOW,
+    CHAFA_CANVAS_COUNTER_CELLS_WIDE,
+    CHAFA_CANVAS_COUNTER_CELLS_FILL,
+    CHAFA_CANVAS_COUNTER_CELLS_SKIPPED,
+    CHAFA_CANVAS_COUNTER_CELLS_WIDE_GATED,
+    CHAFA_CANVAS_COUNTER_CELLS_FLAT,
+    CHAFA_CANVAS_COUNTER_CELLS_REPEATED,
+    CHAFA_CANVAS_COUNTER_CELLS_KEPT,
+    CHAFA_CANVAS_COUNTER_CELLS_MERGED,
+    CHAFA_CANVAS_COUNTER_CELLS_ROUNDED,
+    CHAFA_CANVAS_COUNTER_SCRATCH_BYTES_MAX,
+    CHAFA_CANVAS_COUNTER_CELLS_CACHED,
+
+    CHAFA_CANVAS_COUNTER_MAX
+}
+ChafaCanvasCounter;
+
 CHAFA_AVAILABLE_IN_ALL
 ChafaCanvas *chafa_canvas_new (const ChafaCanvasConfig *config);
 CHAFA_AVAILABLE_IN_ALL
@@ -46,8 +88,71 @@ CHAFA_AVAILABLE_IN_1_2
 void chafa_canvas_draw_all_pixels (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
                                    const guint8 *src_pixels,
                                    gint src_width, gint src_height, gint src_rowstride);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_draw_all_pixels_async (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                                         const guint8 *src_pixels,
+                                         gint src_width, gint src_height, gint src_rowstride,
+                                         ChafaCanvasDrawFunc done_func, gpointer user_data);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_draw_all_pixels_from_rows (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                                             gint src_width, gint src_height,
+                                             ChafaCanvasRowFunc row_func, gpointer user_data);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_cancel_draw (ChafaCanvas *canvas);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_draw_all_pixels_progressive (ChafaCanvas *canvas, ChafaPixelType src_pixel_type,
+                                               const guint8 *src_pixels,
+                                               gint src_width, gint src_height, gint src_rowstride,
+                                               ChafaCanvasRefineFunc refine_func, gpointer user_data);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_draw_pixels_rect (ChafaCanvas *canvas,
+                                    gint x, gint y, gint width, gint height,
+                                    ChafaPixelType src_pixel_type,
+                                    const guint8 *src_pixels,
+                                    gint src_width, gint src_height, gint src_rowstride);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_draw_all_pixels_multi (ChafaCanvas **canvases, gint n_canvases,
+                                         ChafaPixelType src_pixel_type,
+                                         const guint8 *src_pixels,
+                                         gint src_width, gint src_height, gint src_rowstride);
 CHAFA_AVAILABLE_IN_1_6
 GString *chafa_canvas_print (ChafaCanvas *canvas, ChafaTermInfo *term_info);
+CHAFA_AVAILABLE_IN_1_14
+gboolean chafa_canvas_print_to_sink (ChafaCanvas *canvas, ChafaTermInfo *term_info,
+                                     ChafaCanvasSinkFunc sink_func, gpointer user_data);
+CHAFA_AVAILABLE_IN_1_14
+gboolean chafa_canvas_draw_and_print_to_sink (ChafaCanvas *canvas, ChafaTermInfo *term_info,
+                                              ChafaPixelType src_pixel_type,
+                                              const guint8 *src_pixels,
+                                              gint src_width, gint src_height, gint src_rowstride,
+                                              ChafaCanvasSinkFunc sink_func, gpointer user_data);
+CHAFA_AVAILABLE_IN_1_14
+GString *chafa_canvas_print_delta (ChafaCanvas *canvas, ChafaCanvas *prev_canvas,
+                                   ChafaTermInfo *term_info);
+CHAFA_AVAILABLE_IN_1_14
+GString *chafa_canvas_print_for_mode (ChafaCanvas *canvas, ChafaTermInfo *term_info,
+                                      ChafaCanvasMode canvas_mode);
+
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_get_stage_time (ChafaCanvas *canvas, ChafaCanvasStage stage,
+                                  gint64 *wall_time_us_out, gint64 *cpu_time_us_out);
+CHAFA_AVAILABLE_IN_1_14
+gint64 chafa_canvas_get_counter (ChafaCanvas *canvas, ChafaCanvasCounter counter);
+CHAFA_AVAILABLE_IN_1_14
+gfloat chafa_canvas_get_work_factor (ChafaCanvas *canvas);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_reset_stats (ChafaCanvas *canvas);
+CHAFA_AVAILABLE_IN_1_14
+gint chafa_canvas_get_symbol_usage (ChafaCanvas *canvas, gunichar **symbols_out,
+                                    gint64 **n_picked_out, gint64 **n_candidate_out);
+
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_set_palette (ChafaCanvas *canvas, const guint32 *colors, gint n_colors);
+
+CHAFA_AVAILABLE_IN_1_14
+guint chafa_canvas_get_image_id (ChafaCanvas *canvas);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_set_image_id (ChafaCanvas *canvas, guint image_id);
 
 CHAFA_AVAILABLE_IN_1_8
 gunichar chafa_canvas_get_char_at (ChafaCanvas *canvas, gint x, gint y);
@@ -68,6 +173,13 @@ CHAFA_AVAILABLE_IN_1_8
 void chafa_canvas_set_raw_colors_at (ChafaCanvas *canvas, gint x, gint y,
                                      gint fg, gint bg);
 
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_get_cells (ChafaCanvas *canvas, gint x, gint y, gint width, gint height,
+                             gunichar *chars_out, gint *fg_out, gint *bg_out, gint rowstride);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_canvas_get_raw_cells (ChafaCanvas *canvas, gint x, gint y, gint width, gint height,
+                                 gunichar *chars_out, gint *fg_out, gint *bg_out, gint rowstride);
+
 CHAFA_DEPRECATED_IN_1_2
 void chafa_canvas_set_contents_rgba8 (ChafaCanvas *canvas, const guint8 *src_pixels,
                                      gint src_width, gint src_height, gint src_rowstride);
@@ -38,10 +38,31 @@ G_BEGIN_DECLS
  * @CHAFA_PIXEL_ABGR8_UNASSOCIATED: Unassociated ABGR, 8 bits per channel.
  * @CHAFA_PIXEL_RGB8: Packed RGB (no alpha), 8 bits per channel.
  * @CHAFA_PIXEL_BGR8: Packed BGR (no alpha), 8 bits per channel.
+ * @CHAFA_PIXEL_I420: Planar YUV 4:2:0 with separate U and V planes (since 1.14).
+ * @CHAFA_PIXEL_NV12: Planar YUV 4:2:0 with an interleaved UV plane (since 1.14).
+ * @CHAFA_PIXEL_RGBA16_PREMULTIPLIED: Premultiplied RGBA, 16 bits per channel (since 1.14).
+ * @CHAFA_PIXEL_RGBA16_UNASSOCIATED: Unassociated RGBA, 16 bits per channel (since 1.14).
+ * @CHAFA_PIXEL_RGB16: Packed RGB (no alpha), 16 bits per channel (since 1.14).
+ * @CHAFA_PIXEL_RGBA16F_PREMULTIPLIED: Premultiplied linear RGBA, half-precision floats (since 1.14).
+ * @CHAFA_PIXEL_RGBA32F_PREMULTIPLIED: Premultiplied linear RGBA, single-precision floats (since 1.14).
  * @CHAFA_PIXEL_MAX: Last supported pixel type, plus one.
  *
  * Pixel formats supported by #ChafaCanvas and #ChafaSymbolMap.
  *
+ * The YUV formats are BT.601 limited range, as commonly produced by video
+ * decoders. Their planes must be laid out back to back: The luma plane
+ * of height rows of rowstride bytes comes first, followed by the chroma
+ * plane(s) of (height + 1) / 2 rows each. For #CHAFA_PIXEL_I420, the U
+ * and V planes have a rowstride of rowstride / 2. For #CHAFA_PIXEL_NV12,
+ * the UV plane has the same rowstride as the luma plane.
+ *
+ * The 16-bit formats store each channel in host byte order, and use the
+ * same transfer function as the 8-bit formats. The floating point formats
+ * are in linear light, with 1.0 as nominal white. Brighter values are
+ * tone mapped down. All of these are reduced to 8 bits per channel one
+ * row at a time as part of scaling, so there is no need to convert the
+ * whole image beforehand.
+ *
  * Since: 1.4
  **/
 
@@ -64,6 +85,22 @@ typedef enum
     CHAFA_PIXEL_RGB8,
     CHAFA_PIXEL_BGR8,
 
+    /* Planar YUV 4:2:0 */
+
+    CHAFA_PIXEL_I420,
+    CHAFA_PIXEL_NV12,
+
+    /* 64 and 48 bits per pixel */
+
+    CHAFA_PIXEL_RGBA16_PREMULTIPLIED,
+    CHAFA_PIXEL_RGBA16_UNASSOCIATED,
+    CHAFA_PIXEL_RGB16,
+
+    /* Floating point, 64 and 128 bits per pixel */
+
+    CHAFA_PIXEL_RGBA16F_PREMULTIPLIED,
+    CHAFA_PIXEL_RGBA32F_PREMULTIPLIED,
+
     CHAFA_PIXEL_MAX
 }
 ChafaPixelType;
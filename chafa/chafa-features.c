@@ -20,7 +20,11 @@
 #include "config.h"
 
 #include "chafa.h"
+#include "internal/chafa-batch.h"
+#include "internal/chafa-block-cache.h"
+#include "internal/chafa-cell-cache.h"
 #include "internal/chafa-private.h"
+#include "internal/chafa-trace.h"
 
 /**
  * SECTION:chafa-features
@@ -38,6 +42,19 @@
  * @CHAFA_FEATURE_MMX: Flag indicating MMX support.
  * @CHAFA_FEATURE_SSE41: Flag indicating SSE 4.1 support.
  * @CHAFA_FEATURE_POPCNT: Flag indicating popcnt support.
+ * @CHAFA_FEATURE_AVX2: Flag indicating AVX2 support.
+ * @CHAFA_FEATURE_AVX512_VPOPCNTDQ: Flag indicating AVX-512 VPOPCNTDQ support.
+ * @CHAFA_FEATURE_NEON: Flag indicating ARM NEON (Advanced SIMD) support.
+ **/
+
+/**
+ * ChafaThreadAffinity:
+ * @CHAFA_THREAD_AFFINITY_NONE: Worker threads can run on any CPU.
+ * @CHAFA_THREAD_AFFINITY_CORES: Each worker thread is pinned to a core of its own.
+ * @CHAFA_THREAD_AFFINITY_NODES: Worker threads are spread over the NUMA nodes, and can run on any CPU in their node.
+ * @CHAFA_THREAD_AFFINITY_MAX: Last supported thread affinity plus one.
+ *
+ * Since: 1.14
  **/
 
 static gboolean chafa_initialized;
@@ -45,6 +62,9 @@ static gboolean chafa_initialized;
 static gboolean have_mmx;
 static gboolean have_sse41;
 static gboolean have_popcnt;
+static gboolean have_avx2;
+static gboolean have_avx512_vpopcntdq;
+static gboolean have_neon;
 
 static gint n_threads = -1;
 
@@ -68,6 +88,22 @@ init_features (void)
     if (__builtin_cpu_supports ("popcnt"))
         have_popcnt = TRUE;
 # endif
+
+# ifdef HAVE_AVX2_INTRINSICS
+    if (__builtin_cpu_supports ("avx2"))
+        have_avx2 = TRUE;
+# endif
+
+# ifdef HAVE_AVX512_VPOPCNTDQ_INTRINSICS
+    if (__builtin_cpu_supports ("avx512f")
+        && __builtin_cpu_supports ("avx512vpopcntdq"))
+        have_avx512_vpopcntdq = TRUE;
+# endif
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+    /* Advanced SIMD is a mandatory part of AArch64 */
+    have_neon = TRUE;
 #endif
 }
 
@@ -76,7 +112,6 @@ init_once (G_GNUC_UNUSED gpointer data)
 {
     init_features ();
     chafa_init_palette ();
-    chafa_init_symbols ();
 
     chafa_initialized = TRUE;
     return NULL;
@@ -108,6 +143,43 @@ chafa_have_popcnt (void)
     return have_popcnt;
 }
 
+gboolean
+chafa_have_avx2 (void)
+{
+    return have_avx2;
+}
+
+gboolean
+chafa_have_avx512_vpopcntdq (void)
+{
+    return have_avx512_vpopcntdq;
+}
+
+gboolean
+chafa_have_neon (void)
+{
+    return have_neon;
+}
+
+/* Restricts the code paths in use to the ones in mask. Features not
+ * supported by the runtime platform stay disabled. Used for benchmarking;
+ * must not be called while other threads are using the library. */
+void
+chafa_set_feature_mask (ChafaFeatures mask)
+{
+    chafa_init ();
+
+    have_mmx = have_sse41 = have_popcnt = have_avx2 = have_avx512_vpopcntdq = have_neon = FALSE;
+    init_features ();
+
+    have_mmx &= (mask & CHAFA_FEATURE_MMX) ? TRUE : FALSE;
+    have_sse41 &= (mask & CHAFA_FEATURE_SSE41) ? TRUE : FALSE;
+    have_popcnt &= (mask & CHAFA_FEATURE_POPCNT) ? TRUE : FALSE;
+    have_avx2 &= (mask & CHAFA_FEATURE_AVX2) ? TRUE : FALSE;
+    have_avx512_vpopcntdq &= (mask & CHAFA_FEATURE_AVX512_VPOPCNTDQ) ? TRUE : FALSE;
+    have_neon &= (mask & CHAFA_FEATURE_NEON) ? TRUE : FALSE;
+}
+
 /* Public API */
 
 /**
@@ -134,6 +206,18 @@ chafa_get_builtin_features (void)
     features |= CHAFA_FEATURE_POPCNT;
 #endif
 
+#ifdef HAVE_AVX2_INTRINSICS
+    features |= CHAFA_FEATURE_AVX2;
+#endif
+
+#ifdef HAVE_AVX512_VPOPCNTDQ_INTRINSICS
+    features |= CHAFA_FEATURE_AVX512_VPOPCNTDQ;
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+    features |= CHAFA_FEATURE_NEON;
+#endif
+
     return features;
 }
 
@@ -152,7 +236,10 @@ chafa_get_supported_features (void)
 
     return (have_mmx ? CHAFA_FEATURE_MMX : 0)
       | (have_sse41 ? CHAFA_FEATURE_SSE41 : 0)
-      | (have_popcnt ? CHAFA_FEATURE_POPCNT : 0);
+      | (have_popcnt ? CHAFA_FEATURE_POPCNT : 0)
+      | (have_avx2 ? CHAFA_FEATURE_AVX2 : 0)
+      | (have_avx512_vpopcntdq ? CHAFA_FEATURE_AVX512_VPOPCNTDQ : 0)
+      | (have_neon ? CHAFA_FEATURE_NEON : 0);
 }
 
 /**
@@ -176,6 +263,12 @@ chafa_describe_features (ChafaFeatures features)
         g_string_append (features_gstr, "sse4.1 ");
     if (features & CHAFA_FEATURE_POPCNT)
         g_string_append (features_gstr, "popcnt ");
+    if (features & CHAFA_FEATURE_AVX2)
+        g_string_append (features_gstr, "avx2 ");
+    if (features & CHAFA_FEATURE_AVX512_VPOPCNTDQ)
+        g_string_append (features_gstr, "avx512-vpopcntdq ");
+    if (features & CHAFA_FEATURE_NEON)
+        g_string_append (features_gstr, "neon ");
 
     if (features_gstr->len > 0 && features_gstr->str [features_gstr->len - 1] == ' ')
         g_string_truncate (features_gstr, features_gstr->len - 1);
@@ -205,6 +298,15 @@ chafa_get_n_threads (void)
  *
  * Setting this to 0 or 1 will avoid using thread pools and instead perform
  * all processing in the main thread.
+ *
+ * When determined automatically, the number of available processors is the
+ * upper limit. Each processing stage keeps an estimate of its cost, and
+ * small jobs, like those for tiny canvases, are spread over fewer threads
+ * so the work isn't dominated by thread dispatch. An explicit thread count
+ * is always used as given.
+ *
+ * Worker threads are started on demand and kept in a process-wide pool
+ * that is reused for all subsequent processing.
  **/
 void
 chafa_set_n_threads (gint n)
@@ -235,3 +337,177 @@ chafa_get_n_actual_threads (void)
 
     return n_threads;
 }
+
+/**
+ * chafa_get_thread_affinity:
+ *
+ * Queries how worker threads are placed on the available CPUs.
+ *
+ * Returns: The current #ChafaThreadAffinity
+ *
+ * Since: 1.14
+ **/
+ChafaThreadAffinity
+chafa_get_thread_affinity (void)
+{
+    return chafa_batch_get_thread_affinity ();
+}
+
+/**
+ * chafa_set_thread_affinity:
+ * @affinity: A #ChafaThreadAffinity
+ *
+ * Sets how worker threads are placed on the available CPUs. The default,
+ * %CHAFA_THREAD_AFFINITY_NONE, leaves it to the operating system.
+ *
+ * With %CHAFA_THREAD_AFFINITY_CORES, each worker is pinned to a core of
+ * its own, leaving the first one to the calling thread. With
+ * %CHAFA_THREAD_AFFINITY_NODES, workers are spread round-robin over the
+ * NUMA nodes and kept within them. In both cases, canvas work buffers are
+ * then first written to by the workers, so on multi-socket machines their
+ * memory tends to end up on the nodes that process it.
+ *
+ * Only the CPUs the process was allowed to run on when workers were first
+ * pinned are used. Workers pick up a changed setting before their next
+ * job. This has no effect on platforms that don't support setting thread
+ * affinity.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_set_thread_affinity (ChafaThreadAffinity affinity)
+{
+    g_return_if_fail (affinity >= 0 && affinity < CHAFA_THREAD_AFFINITY_MAX);
+
+    chafa_batch_set_thread_affinity (affinity);
+}
+
+/**
+ * chafa_get_cell_cache_size:
+ *
+ * Queries the maximum amount of memory the process-wide cell cache is
+ * allowed to use.
+ *
+ * Returns: The size limit in bytes, or 0 if the cache is disabled
+ *
+ * Since: 1.14
+ **/
+gsize
+chafa_get_cell_cache_size (void)
+{
+    return chafa_cell_cache_get_max_size ();
+}
+
+/**
+ * chafa_set_cell_cache_size:
+ * @max_bytes: Size limit in bytes
+ *
+ * Sets the maximum amount of memory the process-wide cell cache is allowed
+ * to use, or 0 to disable it. The default is 0.
+ *
+ * When enabled, the cells generated by chafa_canvas_draw_all_pixels () in
+ * %CHAFA_PIXEL_MODE_SYMBOLS are stored, keyed by a hash of the source
+ * pixels and the canvas configuration. Drawing the same image again with
+ * an identical configuration, even into a different canvas, then copies
+ * the cells from the cache instead of recalculating them. This is useful
+ * when the same few images are rendered many times over.
+ *
+ * The least recently used entries are discarded to stay within the limit.
+ * Lowering the limit takes effect immediately.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_set_cell_cache_size (gsize max_bytes)
+{
+    chafa_cell_cache_set_max_size (max_bytes);
+}
+
+/**
+ * chafa_get_block_cache_size:
+ *
+ * Queries how many blocks of pixels each canvas' block cache holds.
+ *
+ * Returns: The number of blocks, or 0 if block caches are disabled
+ *
+ * Since: 1.14
+ **/
+gint
+chafa_get_block_cache_size (void)
+{
+    return chafa_block_cache_get_default_size ();
+}
+
+/**
+ * chafa_set_block_cache_size:
+ * @n_blocks: Number of blocks to hold
+ *
+ * Sets how many blocks of pixels each canvas' block cache holds, or 0 to
+ * disable block caches. The default is 256.
+ *
+ * When enabled, canvases in %CHAFA_PIXEL_MODE_SYMBOLS remember the symbol
+ * and colors they picked for each cell-sized block of pixels. When the
+ * same block turns up again, anywhere in the same or a later frame, the
+ * result is looked up instead of searched for. This pays off for
+ * screenshots of text interfaces, tiled graphics and the like, which
+ * repeat the same blocks at many positions. The output is unaffected.
+ *
+ * Each block takes a little under 300 bytes. The number is rounded up to
+ * a power of two, and canvases pick up a changed setting on their next
+ * draw.
+ *
+ * Since: 1.14
+ **/
+void
+chafa_set_block_cache_size (gint n_blocks)
+{
+    g_return_if_fail (n_blocks >= 0);
+
+    chafa_block_cache_set_default_size (n_blocks);
+}
+
+/**
+ * chafa_set_trace_file:
+ * @path: (nullable): Path of the file to write, or %NULL to stop tracing
+ *
+ * Starts recording when each thread works on each batch of rows, and
+ * writes the events to @path in the Chrome trace JSON format, which can
+ * be loaded in Perfetto or chrome://tracing. This shows how evenly work
+ * is spread over the threads, and where time goes in each stage. Any
+ * trace that was already being written is finished first.
+ *
+ * Tracing can also be enabled from the start by naming a file in the
+ * CHAFA_TRACE environment variable.
+ *
+ * Returns: %TRUE on success, %FALSE if the file could not be created
+ *
+ * Since: 1.14
+ **/
+gboolean
+chafa_set_trace_file (const gchar *path)
+{
+    return chafa_trace_set_file (path);
+}
+
+/**
+ * chafa_add_trace_event:
+ * @name: Name of the stage
+ * @start_us: Start time from g_get_monotonic_time ()
+ * @end_us: End time from g_get_monotonic_time ()
+ * @first_row: First row worked on
+ * @n_rows: Number of rows worked on, or -1 to leave out the range
+ *
+ * Adds a span of work on the calling thread to the trace, so an
+ * application's own stages can be seen alongside Chafa's. Does nothing
+ * unless tracing is enabled; see chafa_set_trace_file ().
+ *
+ * Since: 1.14
+ **/
+void
+chafa_add_trace_event (const gchar *name, gint64 start_us, gint64 end_us,
+                       gint first_row, gint n_rows)
+{
+    g_return_if_fail (name != NULL);
+
+    chafa_trace_add_event (name, start_us, end_us, first_row, n_rows);
+}
@@ -33,9 +33,22 @@ typedef enum
     CHAFA_FEATURE_MMX          = (1 << 0),
     CHAFA_FEATURE_SSE41        = (1 << 1),
     CHAFA_FEATURE_POPCNT       = (1 << 2),
+    CHAFA_FEATURE_AVX2         = (1 << 3),
+    CHAFA_FEATURE_AVX512_VPOPCNTDQ = (1 << 4),
+    CHAFA_FEATURE_NEON         = (1 << 5),
 }
 ChafaFeatures;
 
+typedef enum
+{
+    CHAFA_THREAD_AFFINITY_NONE,
+    CHAFA_THREAD_AFFINITY_CORES,
+    CHAFA_THREAD_AFFINITY_NODES,
+
+    CHAFA_THREAD_AFFINITY_MAX
+}
+ChafaThreadAffinity;
+
 CHAFA_AVAILABLE_IN_ALL
 ChafaFeatures chafa_get_builtin_features (void);
 CHAFA_AVAILABLE_IN_ALL
@@ -51,6 +64,26 @@ void chafa_set_n_threads (gint n);
 CHAFA_AVAILABLE_IN_1_10
 gint chafa_get_n_actual_threads (void);
 
+CHAFA_AVAILABLE_IN_1_14
+ChafaThreadAffinity chafa_get_thread_affinity (void);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_set_thread_affinity (ChafaThreadAffinity affinity);
+
+CHAFA_AVAILABLE_IN_1_14
+gsize chafa_get_cell_cache_size (void);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_set_cell_cache_size (gsize max_bytes);
+CHAFA_AVAILABLE_IN_1_14
+gint chafa_get_block_cache_size (void);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_set_block_cache_size (gint n_blocks);
+
+CHAFA_AVAILABLE_IN_1_14
+gboolean chafa_set_trace_file (const gchar *path);
+CHAFA_AVAILABLE_IN_1_14
+void chafa_add_trace_event (const gchar *name, gint64 start_us, gint64 end_us,
+                            gint first_row, gint n_rows);
+
 G_END_DECLS
 
 #endif /* __CHAFA_FEATURES_H__ */
@@ -23,6 +23,7 @@
 #include <stdlib.h>  /* qsort */
 #include "chafa.h"
 #include "internal/chafa-private.h"
+#include "internal/chafa-scratch.h"
 #include "internal/smolscale/smolscale.h"
 
 /* Max number of candidates to return from chafa_symbol_map_find_candidates() */
@@ -135,6 +136,68 @@ Glyph2;
  * symbol -- #CHAFA_SYMBOL_TAG_VHALF works well by itself.
  **/
 
+/* Serialized symbol map format. All fields are in native byte order, and
+ * the blob starts with a header followed by the record arrays in the order
+ * they appear in the header. Records are multiples of 8 bytes, so a blob
+ * that is itself 8-byte aligned (e.g. mmapped) has aligned records. The
+ * built-in symbols are baked in, so blobs are tied to the library version
+ * that created them. */
+
+#define SERIAL_MAGIC 0x4d534843  /* "CHSM" */
+#define SERIAL_FORMAT_VERSION 1
+#define SERIAL_BYTE_ORDER_MARK 0x01020304
+#define SERIAL_LIB_VERSION_LEN 16
+
+typedef struct
+{
+    guint32 magic;
+    guint32 format_version;
+    guint32 byte_order_mark;
+    guint32 use_builtin_glyphs;
+    gchar lib_version [SERIAL_LIB_VERSION_LEN];
+
+    guint32 n_selectors;
+    guint32 n_glyphs;
+    guint32 n_glyphs2;
+    guint32 n_symbols;
+    guint32 n_symbols2;
+    guint32 padding;
+
+    gint32 popcount_ofs [CHAFA_SYMBOL_N_PIXELS + 2];
+}
+SerialHeader;
+
+typedef struct
+{
+    guint32 selector_type;
+    guint32 additive;
+    guint32 tags;
+    guint32 first_code_point;
+    guint32 last_code_point;
+    guint32 padding;
+}
+SerialSelector;
+
+typedef struct
+{
+    guint64 bitmap [2];
+    guint32 c;
+    guint32 padding;
+}
+SerialGlyph;
+
+typedef struct
+{
+    guint64 bitmap;
+    guint32 sc;
+    guint32 c;
+    gint32 fg_weight, bg_weight;
+    gint32 popcount;
+    guint32 padding;
+    guint8 coverage [CHAFA_SYMBOL_N_PIXELS];
+}
+SerialSymbol;
+
 /* Private */
 
 #if 0
@@ -174,7 +237,9 @@ pixels_to_coverage (const guint8 *pixels_in, ChafaPixelType old_format, guint8 *
 {
     gint i;
 
-    if (old_format == CHAFA_PIXEL_RGB8 || old_format == CHAFA_PIXEL_BGR8)
+    if (old_format == CHAFA_PIXEL_RGB8 || old_format == CHAFA_PIXEL_BGR8
+        || old_format == CHAFA_PIXEL_I420 || old_format == CHAFA_PIXEL_NV12
+        || old_format == CHAFA_PIXEL_RGB16)
     {
         for (i = 0; i < n_pixels; i++)
             pixels_out [i] = (pixels_in [i * 4] + pixels_in [i * 4 + 1] + pixels_in [i * 4 + 2]) / 3;
@@ -324,16 +389,46 @@ glyph_to_bitmap_wide (gint width, gint height,
                                             CHAFA_SYMBOL_WIDTH_PIXELS * 2);
 }
 
+/* Packs the popcount of each 4x4 quadrant of a bitmap into a byte. The
+ * hamming distance between two bitmaps is at least the sum of their
+ * quadrant count differences, so these give a tighter bound than the
+ * overall popcount. */
+static guint32
+bitmap_to_quadrant_counts (guint64 bitmap)
+{
+    return ((guint32) chafa_population_count_u64 (bitmap & G_GUINT64_CONSTANT (0xf0f0f0f000000000)) << 24)
+        | ((guint32) chafa_population_count_u64 (bitmap & G_GUINT64_CONSTANT (0x0f0f0f0f00000000)) << 16)
+        | ((guint32) chafa_population_count_u64 (bitmap & G_GUINT64_CONSTANT (0x00000000f0f0f0f0)) << 8)
+        | (guint32) chafa_population_count_u64 (bitmap & G_GUINT64_CONSTANT (0x000000000f0f0f0f));
+}
+
+/* Symbols with the same popcount are ordered by their quadrant counts, so
+ * blocks of similar symbols end up together and their bounds are tight */
 static gint
 compare_symbols_popcount (const void *a, const void *b)
 {
     const ChafaSymbol *a_sym = a;
     const ChafaSymbol *b_sym = b;
+    guint32 a_counts, b_counts;
 
     if (a_sym->popcount < b_sym->popcount)
         return -1;
     if (a_sym->popcount > b_sym->popcount)
         return 1;
+
+    a_counts = bitmap_to_quadrant_counts (a_sym->bitmap);
+    b_counts = bitmap_to_quadrant_counts (b_sym->bitmap);
+
+    if (a_counts < b_counts)
+        return -1;
+    if (a_counts > b_counts)
+        return 1;
+
+    /* Keep the order stable between runs */
+    if (a_sym->c < b_sym->c)
+        return -1;
+    if (a_sym->c > b_sym->c)
+        return 1;
     return 0;
 }
 
@@ -352,18 +447,313 @@ compare_symbols2_popcount (const void *a, const void *b)
     return 0;
 }
 
+/* Assumes symbols are sorted by ascending popcount */
+static gint
+find_closest_popcount (const ChafaSymbolMap *symbol_map, gint popcount)
+{
+    gint i, j;
+
+    g_assert (symbol_map->n_symbols > 0);
+
+    i = 0;
+    j = symbol_map->n_symbols - 1;
+
+    while (i < j)
+    {
+        gint k = (i + j + 1) / 2;
+
+        if (popcount < symbol_map->symbols [k].popcount)
+            j = k - 1;
+        else if (popcount >= symbol_map->symbols [k].popcount)
+            i = k;
+        else
+            i = j = k;
+    }
+
+    /* If we didn't find the exact popcount, the i+1'th element may be
+     * a closer match. */
+
+    if (i < symbol_map->n_symbols - 1
+        && (abs (popcount - symbol_map->symbols [i + 1].popcount)
+            < abs (popcount - symbol_map->symbols [i].popcount)))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/* Assumes symbols are sorted by ascending popcount */
+static gint
+find_closest_popcount_wide (const ChafaSymbolMap *symbol_map, gint popcount)
+{
+    gint i, j;
+
+    g_assert (symbol_map->n_symbols2 > 0);
+
+    i = 0;
+    j = symbol_map->n_symbols2 - 1;
+
+    while (i < j)
+    {
+        gint k = (i + j + 1) / 2;
+
+        if (popcount < symbol_map->symbols2 [k].sym [0].popcount
+            + symbol_map->symbols2 [k].sym [1].popcount)
+            j = k - 1;
+        else if (popcount >= symbol_map->symbols2 [k].sym [0].popcount
+            + symbol_map->symbols2 [k].sym [1].popcount)
+            i = k;
+        else
+            i = j = k;
+    }
+
+    /* If we didn't find the exact popcount, the i+1'th element may be
+     * a closer match. */
+
+    if (i < symbol_map->n_symbols2 - 1
+        && (abs (popcount - (symbol_map->symbols2 [i + 1].sym [0].popcount
+                             + symbol_map->symbols2 [i + 1].sym [1].popcount))
+            < abs (popcount - (symbol_map->symbols2 [i].sym [0].popcount
+                               + symbol_map->symbols2 [i].sym [1].popcount))))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/* Precomputes find_closest_popcount*() for every possible popcount, so the
+ * per-cell fill lookups are plain table reads */
 static void
-compile_symbols (ChafaSymbolMap *symbol_map, GHashTable *desired_symbols)
+index_fill_popcounts (ChafaSymbolMap *symbol_map)
 {
-    GHashTableIter iter;
-    gpointer key, value;
     gint i;
 
-    for (i = 0; i < symbol_map->n_symbols; i++)
-        g_free (symbol_map->symbols [i].coverage);
+    for (i = 0; i <= CHAFA_SYMBOL_N_PIXELS; i++)
+        symbol_map->fill_index [i] = symbol_map->n_symbols > 0
+            ? find_closest_popcount (symbol_map, i) : 0;
+
+    for (i = 0; i <= CHAFA_SYMBOL_N_PIXELS * 2; i++)
+        symbol_map->fill_index2 [i] = symbol_map->n_symbols2 > 0
+            ? find_closest_popcount_wide (symbol_map, i) : 0;
+}
+
+/* Takes ownership of the map's compiled arrays */
+static ChafaSymbolTable *
+symbol_table_new_from_map (ChafaSymbolMap *symbol_map)
+{
+    ChafaSymbolTable *table = g_new (ChafaSymbolTable, 1);
+
+    table->refs = 1;
+    table->symbols = symbol_map->symbols;
+    table->n_symbols = symbol_map->n_symbols;
+    table->packed_bitmaps = symbol_map->packed_bitmaps;
+    table->block_bounds = symbol_map->block_bounds;
+    table->symbols2 = symbol_map->symbols2;
+    table->n_symbols2 = symbol_map->n_symbols2;
+    table->packed_bitmaps2 = symbol_map->packed_bitmaps2;
+
+    return table;
+}
+
+static ChafaSymbolTable *
+symbol_table_ref (ChafaSymbolTable *table)
+{
+    g_atomic_int_inc (&table->refs);
+    return table;
+}
+
+static void
+symbol_table_unref (ChafaSymbolTable *table)
+{
+    gint i;
+
+    if (!table || !g_atomic_int_dec_and_test (&table->refs))
+        return;
+
+    for (i = 0; i < table->n_symbols; i++)
+        g_free (table->symbols [i].coverage);
+
+    for (i = 0; i < table->n_symbols2; i++)
+    {
+        g_free (table->symbols2 [i].sym [0].coverage);
+        g_free (table->symbols2 [i].sym [1].coverage);
+    }
+
+    g_free (table->symbols);
+    g_free (table->symbols2);
+    g_free (table->packed_bitmaps);
+    g_free (table->block_bounds);
+    g_free (table->packed_bitmaps2);
+    g_free (table);
+}
+
+/* Points the map's fields at a table's arrays. The per-popcount indexes
+ * are small, and stay in the map. */
+static void
+use_symbol_table (ChafaSymbolMap *symbol_map, ChafaSymbolTable *table)
+{
+    symbol_table_unref (symbol_map->table);
+
+    symbol_map->table = table;
+    symbol_map->symbols = table->symbols;
+    symbol_map->n_symbols = table->n_symbols;
+    symbol_map->packed_bitmaps = table->packed_bitmaps;
+    symbol_map->block_bounds = table->block_bounds;
+    symbol_map->symbols2 = table->symbols2;
+    symbol_map->n_symbols2 = table->n_symbols2;
+    symbol_map->packed_bitmaps2 = table->packed_bitmaps2;
+}
+
+/* Maps built from the same selectors get the same symbols, so the
+ * compiled tables are kept around for other maps to share. This only
+ * covers maps without user glyphs, which would make the keys unwieldy.
+ * The cache is small, and simply starts over when it fills up. */
+#define SYMBOL_TABLE_CACHE_MAX 16
+
+typedef struct
+{
+    ChafaSymbolTable *table;
+    gint popcount_ofs [CHAFA_SYMBOL_N_PIXELS + 2];
+    gint fill_index [CHAFA_SYMBOL_N_PIXELS + 1];
+    gint fill_index2 [CHAFA_SYMBOL_N_PIXELS * 2 + 1];
+}
+SymbolTableCacheEntry;
+
+static GMutex symbol_table_cache_mutex;
+static GHashTable *symbol_table_cache;
+
+static void
+free_symbol_table_cache_entry (gpointer p)
+{
+    SymbolTableCacheEntry *entry = p;
+
+    symbol_table_unref (entry->table);
+    g_free (entry);
+}
+
+/* Returns NULL if the map can't be cached */
+static GBytes *
+make_symbol_table_cache_key (const ChafaSymbolMap *symbol_map)
+{
+    guint32 *key;
+    gint n, i;
+
+    if (g_hash_table_size (symbol_map->glyphs) > 0
+        || g_hash_table_size (symbol_map->glyphs2) > 0)
+        return NULL;
+
+    /* Built field by field; the selectors may have padding */
+    n = 1 + symbol_map->selectors->len * 5;
+    key = g_new (guint32, n);
+    key [0] = symbol_map->use_builtin_glyphs;
+
+    for (i = 0; i < (gint) symbol_map->selectors->len; i++)
+    {
+        const Selector *selector = &g_array_index (symbol_map->selectors, Selector, i);
+
+        key [1 + i * 5] = selector->selector_type;
+        key [2 + i * 5] = selector->additive;
+        key [3 + i * 5] = selector->tags;
+        key [4 + i * 5] = selector->first_code_point;
+        key [5 + i * 5] = selector->last_code_point;
+    }
+
+    return g_bytes_new_take (key, n * sizeof (guint32));
+}
+
+static gboolean
+lookup_symbol_table (ChafaSymbolMap *symbol_map, GBytes *key)
+{
+    SymbolTableCacheEntry *entry = NULL;
+
+    g_mutex_lock (&symbol_table_cache_mutex);
+
+    if (symbol_table_cache)
+        entry = g_hash_table_lookup (symbol_table_cache, key);
+
+    if (entry)
+    {
+        use_symbol_table (symbol_map, symbol_table_ref (entry->table));
+        memcpy (symbol_map->popcount_ofs, entry->popcount_ofs, sizeof (entry->popcount_ofs));
+        memcpy (symbol_map->fill_index, entry->fill_index, sizeof (entry->fill_index));
+        memcpy (symbol_map->fill_index2, entry->fill_index2, sizeof (entry->fill_index2));
+    }
+
+    g_mutex_unlock (&symbol_table_cache_mutex);
+
+    return entry != NULL;
+}
+
+/* Takes ownership of key */
+static void
+insert_symbol_table (const ChafaSymbolMap *symbol_map, GBytes *key)
+{
+    SymbolTableCacheEntry *entry = g_new (SymbolTableCacheEntry, 1);
+
+    entry->table = symbol_table_ref (symbol_map->table);
+    memcpy (entry->popcount_ofs, symbol_map->popcount_ofs, sizeof (entry->popcount_ofs));
+    memcpy (entry->fill_index, symbol_map->fill_index, sizeof (entry->fill_index));
+    memcpy (entry->fill_index2, symbol_map->fill_index2, sizeof (entry->fill_index2));
+
+    g_mutex_lock (&symbol_table_cache_mutex);
+
+    if (!symbol_table_cache)
+        symbol_table_cache = g_hash_table_new_full (g_bytes_hash, g_bytes_equal,
+                                                    (GDestroyNotify) g_bytes_unref,
+                                                    free_symbol_table_cache_entry);
+    else if (g_hash_table_size (symbol_table_cache) >= SYMBOL_TABLE_CACHE_MAX)
+        g_hash_table_remove_all (symbol_table_cache);
+
+    /* Another thread may have built the same table in the meantime */
+    g_hash_table_replace (symbol_table_cache, key, entry);
+
+    g_mutex_unlock (&symbol_table_cache_mutex);
+}
+
+/* Records the per-quadrant popcount ranges of each symbol block */
+static void
+index_blocks (ChafaSymbolMap *symbol_map)
+{
+    gint n_blocks = (symbol_map->n_symbols + CHAFA_SYMBOL_BLOCK_SIZE - 1) / CHAFA_SYMBOL_BLOCK_SIZE;
+    gint i, j, k;
+
+    symbol_map->block_bounds = g_new (guint32, MAX (n_blocks, 1) * 2);
+
+    for (i = 0; i < n_blocks; i++)
+    {
+        guint8 lo [4] = { 255, 255, 255, 255 };
+        guint8 hi [4] = { 0, 0, 0, 0 };
+
+        for (j = i * CHAFA_SYMBOL_BLOCK_SIZE;
+             j < MIN ((i + 1) * CHAFA_SYMBOL_BLOCK_SIZE, symbol_map->n_symbols);
+             j++)
+        {
+            guint32 counts = bitmap_to_quadrant_counts (symbol_map->packed_bitmaps [j]);
+
+            for (k = 0; k < 4; k++)
+            {
+                guint8 c = (counts >> (k * 8)) & 0xff;
+
+                lo [k] = MIN (lo [k], c);
+                hi [k] = MAX (hi [k], c);
+            }
+        }
+
+        symbol_map->block_bounds [i * 2] = ((guint32) lo [3] << 24) | ((guint32) lo [2] << 16)
+            | ((guint32) lo [1] << 8) | lo [0];
+        symbol_map->block_bounds [i * 2 + 1] = ((guint32) hi [3] << 24) | ((guint32) hi [2] << 16)
+            | ((guint32) hi [1] << 8) | hi [0];
+    }
+}
 
-    g_free (symbol_map->symbols);
-    g_free (symbol_map->packed_bitmaps);
+static void
+compile_symbols (ChafaSymbolMap *symbol_map, GHashTable *desired_symbols)
+{
+    GHashTableIter iter;
+    gpointer key, value;
+    gint i, j;
 
     symbol_map->n_symbols = g_hash_table_size (desired_symbols);
     symbol_map->symbols = g_new (ChafaSymbol, symbol_map->n_symbols + 1);
@@ -389,6 +779,16 @@ compile_symbols (ChafaSymbolMap *symbol_map, GHashTable *desired_symbols)
     symbol_map->packed_bitmaps = g_new (guint64, symbol_map->n_symbols);
     for (i = 0; i < symbol_map->n_symbols; i++)
         symbol_map->packed_bitmaps [i] = symbol_map->symbols [i].bitmap;
+
+    index_blocks (symbol_map);
+
+    /* Index popcount buckets for chafa_symbol_map_find_candidates() */
+    for (i = 0, j = 0; j <= CHAFA_SYMBOL_N_PIXELS + 1; j++)
+    {
+        while (i < symbol_map->n_symbols && symbol_map->symbols [i].popcount < j)
+            i++;
+        symbol_map->popcount_ofs [j] = i;
+    }
 }
 
 static void
@@ -398,14 +798,6 @@ compile_symbols_wide (ChafaSymbolMap *symbol_map, GHashTable *desired_symbols)
     gpointer key, value;
     gint i;
 
-    for (i = 0; i < symbol_map->n_symbols2; i++)
-    {
-        g_free (symbol_map->symbols2 [i].sym [0].coverage);
-        g_free (symbol_map->symbols2 [i].sym [1].coverage);
-    }
-
-    g_free (symbol_map->symbols2);
-
     symbol_map->n_symbols2 = g_hash_table_size (desired_symbols);
     symbol_map->symbols2 = g_new (ChafaSymbol2, symbol_map->n_symbols2 + 1);
 
@@ -524,8 +916,17 @@ rebuild_symbols (ChafaSymbolMap *symbol_map)
     GHashTable *desired_syms_wide;
     GHashTableIter iter;
     gpointer key, value;
+    GBytes *cache_key;
     gint i;
 
+    cache_key = make_symbol_table_cache_key (symbol_map);
+    if (cache_key && lookup_symbol_table (symbol_map, cache_key))
+    {
+        g_bytes_unref (cache_key);
+        symbol_map->need_rebuild = FALSE;
+        return;
+    }
+
     desired_syms = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, free_symbol);
     desired_syms_wide = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, free_symbol_wide);
 
@@ -634,7 +1035,12 @@ rebuild_symbols (ChafaSymbolMap *symbol_map)
     compile_symbols_wide (symbol_map, desired_syms_wide);
     g_hash_table_destroy (desired_syms_wide);
 
+    use_symbol_table (symbol_map, symbol_table_new_from_map (symbol_map));
+    index_fill_popcounts (symbol_map);
     symbol_map->need_rebuild = FALSE;
+
+    if (cache_key)
+        insert_symbol_table (symbol_map, cache_key);
 }
 
 static GHashTable *
@@ -975,26 +1381,12 @@ chafa_symbol_map_init (ChafaSymbolMap *symbol_map)
 void
 chafa_symbol_map_deinit (ChafaSymbolMap *symbol_map)
 {
-    gint i;
-
     g_return_if_fail (symbol_map != NULL);
 
-    for (i = 0; i < symbol_map->n_symbols; i++)
-        g_free (symbol_map->symbols [i].coverage);
-
-    for (i = 0; i < symbol_map->n_symbols2; i++)
-    {
-        g_free (symbol_map->symbols2 [i].sym [0].coverage);
-        g_free (symbol_map->symbols2 [i].sym [1].coverage);
-    }
-
     g_hash_table_destroy (symbol_map->glyphs);
     g_hash_table_destroy (symbol_map->glyphs2);
     g_array_free (symbol_map->selectors, TRUE);
-    g_free (symbol_map->symbols);
-    g_free (symbol_map->symbols2);
-    g_free (symbol_map->packed_bitmaps);
-    g_free (symbol_map->packed_bitmaps2);
+    symbol_table_unref (symbol_map->table);
 }
 
 void
@@ -1008,19 +1400,102 @@ chafa_symbol_map_copy_contents (ChafaSymbolMap *dest, const ChafaSymbolMap *src)
     dest->glyphs = copy_glyph_table (dest->glyphs);
     dest->glyphs2 = copy_glyph2_table (dest->glyphs2);
     dest->selectors = copy_selector_array (dest->selectors);
+    dest->refs = 1;
+
+    /* A prepared map shares its compiled symbols. The table is immutable,
+     * so the fields copied above can keep pointing into it. */
+    if (!src->need_rebuild && src->table)
+    {
+        symbol_table_ref (dest->table);
+        return;
+    }
+
+    dest->table = NULL;
     dest->symbols = NULL;
     dest->n_symbols = 0;
     dest->symbols2 = NULL;
     dest->n_symbols2 = 0;
     dest->packed_bitmaps = NULL;
+    dest->block_bounds = NULL;
     dest->packed_bitmaps2 = NULL;
     dest->need_rebuild = TRUE;
-    dest->refs = 1;
 
     if (!src->need_rebuild)
         chafa_symbol_map_prepare (dest);
 }
 
+static void
+symbol_to_serial (const ChafaSymbol *sym, SerialSymbol *ss)
+{
+    memset (ss, 0, sizeof (*ss));
+    ss->bitmap = sym->bitmap;
+    ss->sc = sym->sc;
+    ss->c = sym->c;
+    ss->fg_weight = sym->fg_weight;
+    ss->bg_weight = sym->bg_weight;
+    ss->popcount = sym->popcount;
+    memcpy (ss->coverage, sym->coverage, CHAFA_SYMBOL_N_PIXELS);
+}
+
+static void
+serial_to_symbol (const SerialSymbol *ss, ChafaSymbol *sym)
+{
+    sym->bitmap = ss->bitmap;
+    sym->sc = ss->sc;
+    sym->c = ss->c;
+    sym->fg_weight = ss->fg_weight;
+    sym->bg_weight = ss->bg_weight;
+    sym->popcount = ss->popcount;
+    sym->coverage = g_memdup (ss->coverage, CHAFA_SYMBOL_N_PIXELS);
+}
+
+static gboolean
+validate_serial_header (const SerialHeader *header, gsize len, GError **error)
+{
+    gsize n_records;
+    gint i;
+
+    if (header->magic != SERIAL_MAGIC
+        || header->byte_order_mark != SERIAL_BYTE_ORDER_MARK
+        || header->format_version != SERIAL_FORMAT_VERSION
+        || strncmp (header->lib_version, VERSION, SERIAL_LIB_VERSION_LEN))
+    {
+        g_set_error (error, CHAFA_SYMBOL_MAP_ERROR, CHAFA_SYMBOL_MAP_ERROR_INCOMPATIBLE,
+                     "Serialized symbol map is from an incompatible version.");
+        return FALSE;
+    }
+
+    len -= sizeof (SerialHeader);
+
+    /* Check each count separately first so the sum can't overflow */
+    if (header->n_selectors > len / sizeof (SerialSelector)
+        || header->n_glyphs > len / sizeof (SerialGlyph)
+        || header->n_glyphs2 > len / sizeof (SerialGlyph)
+        || header->n_symbols > len / sizeof (SerialSymbol)
+        || header->n_symbols2 > len / (sizeof (SerialSymbol) * 2))
+        goto truncated;
+
+    n_records = header->n_selectors * sizeof (SerialSelector)
+        + (header->n_glyphs + (gsize) header->n_glyphs2) * sizeof (SerialGlyph)
+        + (header->n_symbols + (gsize) header->n_symbols2 * 2) * sizeof (SerialSymbol);
+    if (n_records != len)
+        goto truncated;
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS + 2; i++)
+    {
+        if (header->popcount_ofs [i] < (i > 0 ? header->popcount_ofs [i - 1] : 0)
+            || header->popcount_ofs [i] > (gint32) header->n_symbols)
+            goto truncated;
+    }
+
+    return TRUE;
+
+truncated:
+    g_set_error (error, CHAFA_SYMBOL_MAP_ERROR, CHAFA_SYMBOL_MAP_ERROR_CORRUPT,
+                 "Serialized symbol map is corrupt.");
+    return FALSE;
+}
+
 void
 chafa_symbol_map_prepare (ChafaSymbolMap *symbol_map)
 {
@@ -1082,83 +1557,219 @@ insert_candidate (ChafaCandidate *candidates, const ChafaCandidate *new_cand)
     candidates [0] = *new_cand;
 }
 
-void
-chafa_symbol_map_find_candidates (const ChafaSymbolMap *symbol_map, guint64 bitmap,
-                                  gboolean do_inverse, ChafaCandidate *candidates_out, gint *n_candidates_inout)
+/* Candidates are kept as sort keys while searching. The order is by hamming
+ * distance, then position in the symbol table, plain before inverted. This
+ * is also the order a linear scan with insert_candidate () would produce, but
+ * it doesn't depend on the order in which symbols are visited. */
+#define CANDIDATE_KEY(hd, index, inv) (((guint32) (hd) << 16) | ((guint32) (index) << 1) | (inv))
+#define CANDIDATE_KEY_NONE G_MAXUINT32
+
+static inline void
+insert_candidate_key (guint32 *keys, guint32 key)
 {
-    ChafaCandidate candidates [N_CANDIDATES_MAX] =
-    {
-        { 0, 65, FALSE },
-        { 0, 65, FALSE },
-        { 0, 65, FALSE },
-        { 0, 65, FALSE },
-        { 0, 65, FALSE },
-        { 0, 65, FALSE },
-        { 0, 65, FALSE },
-        { 0, 65, FALSE }
-    };
-    gint *ham_dist;
     gint i;
 
-    g_return_if_fail (symbol_map != NULL);
+    for (i = 0; i < N_CANDIDATES_MAX; i++)
+    {
+        guint32 t = keys [i];
 
-    ham_dist = g_new (gint, symbol_map->n_symbols + 1);
+        keys [i] = MIN (t, key);
+        key = MAX (t, key);
+    }
+}
 
-    chafa_hamming_distance_vu64 (bitmap, symbol_map->packed_bitmaps, ham_dist, symbol_map->n_symbols);
+/* Lower bound on the hamming distance between a bitmap with the given
+ * quadrant counts and any symbol in a block */
+static inline gint
+block_distance_bound (guint32 counts, guint32 lo, guint32 hi)
+{
+    gint bound = 0;
+    gint k;
 
-    if (do_inverse)
+    for (k = 0; k < 32; k += 8)
     {
-        for (i = 0; i < symbol_map->n_symbols; i++)
-        {
-            ChafaCandidate cand;
-            gint hd = ham_dist [i];
+        gint c = (counts >> k) & 0xff;
+        gint l = (lo >> k) & 0xff;
+        gint h = (hi >> k) & 0xff;
 
-            if (hd < candidates [N_CANDIDATES_MAX - 1].hamming_distance)
-            {
-                cand.symbol_index = i;
-                cand.hamming_distance = hd;
-                cand.is_inverted = FALSE;
-                insert_candidate (candidates, &cand);
-            }
+        bound += MAX (l - c, 0) + MAX (c - h, 0);
+    }
 
-            hd = 64 - hd;
+    return bound;
+}
 
-            if (hd < candidates [N_CANDIDATES_MAX - 1].hamming_distance)
-            {
-                cand.symbol_index = i;
-                cand.hamming_distance = hd;
-                cand.is_inverted = TRUE;
-                insert_candidate (candidates, &cand);
-            }
-        }
-    }
-    else
+/* Scans symbols with popcounts in [first_popcount, last_popcount].
+ *
+ * This is done one block at a time. Blocks whose quadrant count ranges are
+ * too far from the bitmap's to beat the worst candidate so far are skipped
+ * without looking at the individual symbols. A symbol with the same
+ * distance as the worst candidate can still win on its index, so only
+ * blocks that are strictly worse are skipped. */
+static void
+scan_popcount_range (const ChafaSymbolMap *symbol_map, guint64 bitmap,
+                     gint first_popcount, gint last_popcount,
+                     gboolean do_inverse, guint32 *keys, gint n_keys)
+{
+    gint ham_dist [CHAFA_SYMBOL_BLOCK_SIZE];
+    guint32 counts, inv_counts;
+    gint first, last;
+
+    first_popcount = MAX (first_popcount, 0);
+    last_popcount = MIN (last_popcount, CHAFA_SYMBOL_N_PIXELS);
+
+    if (first_popcount > last_popcount)
+        return;
+
+    first = symbol_map->popcount_ofs [first_popcount];
+    last = symbol_map->popcount_ofs [last_popcount + 1];
+
+    counts = bitmap_to_quadrant_counts (bitmap);
+    inv_counts = 0x10101010 - counts;
+
+    while (first < last)
     {
-        for (i = 0; i < symbol_map->n_symbols; i++)
+        gint block = first / CHAFA_SYMBOL_BLOCK_SIZE;
+        gint n = MIN (last, (block + 1) * CHAFA_SYMBOL_BLOCK_SIZE) - first;
+        gint worst = keys [n_keys - 1] >> 16;
+        gint bound;
+        gint i;
+
+        bound = block_distance_bound (counts,
+                                      symbol_map->block_bounds [block * 2],
+                                      symbol_map->block_bounds [block * 2 + 1]);
+        if (do_inverse)
+            bound = MIN (bound, block_distance_bound (inv_counts,
+                                                      symbol_map->block_bounds [block * 2],
+                                                      symbol_map->block_bounds [block * 2 + 1]));
+
+        if (bound > worst)
         {
-            ChafaCandidate cand;
-            gint hd = ham_dist [i];
+            first += n;
+            continue;
+        }
 
-            if (hd < candidates [N_CANDIDATES_MAX - 1].hamming_distance)
+        chafa_hamming_distance_vu64 (bitmap, symbol_map->packed_bitmaps + first, ham_dist, n);
+
+        for (i = 0; i < n; i++)
+        {
+            guint32 key;
+
+            key = CANDIDATE_KEY (ham_dist [i], first + i, 0);
+            if (key < keys [n_keys - 1])
+                insert_candidate_key (keys, key);
+
+            if (do_inverse)
             {
-                cand.symbol_index = i;
-                cand.hamming_distance = hd;
-                cand.is_inverted = FALSE;
-                insert_candidate (candidates, &cand);
+                key = CANDIDATE_KEY (CHAFA_SYMBOL_N_PIXELS - ham_dist [i], first + i, 1);
+                if (key < keys [n_keys - 1])
+                    insert_candidate_key (keys, key);
             }
         }
+
+        first += n;
+    }
+}
+
+/* Scans [first_popcount, last_popcount] except for the part that overlaps
+ * [skip_first, skip_last] */
+static void
+scan_popcount_range_skip (const ChafaSymbolMap *symbol_map, guint64 bitmap,
+                          gint first_popcount, gint last_popcount,
+                          gint skip_first, gint skip_last,
+                          gboolean do_inverse, guint32 *keys, gint n_keys)
+{
+    scan_popcount_range (symbol_map, bitmap,
+                         first_popcount, MIN (last_popcount, skip_first - 1),
+                         do_inverse, keys, n_keys);
+    scan_popcount_range (symbol_map, bitmap,
+                         MAX (first_popcount, skip_last + 1), last_popcount,
+                         do_inverse, keys, n_keys);
+}
+
+/* Symbols are sorted by popcount, and the popcount difference bounds the
+ * hamming distance from below. The inverted distance is bounded by the
+ * difference to the inverted bitmap's popcount.
+ *
+ * We first scan the symbols with popcounts closest to the bitmap's until we
+ * have enough candidates. The worst of those is an upper bound on the final
+ * result, so we only need to look at the symbols that could beat it. */
+void
+chafa_symbol_map_find_candidates (const ChafaSymbolMap *symbol_map, guint64 bitmap,
+                                  gboolean do_inverse, ChafaCandidate *candidates_out, gint *n_candidates_inout)
+{
+    guint32 keys [N_CANDIDATES_MAX];
+    gint popcount [2];
+    gint seed [2];
+    gint n_keys;
+    gint bound;
+    gint i;
+
+    g_return_if_fail (symbol_map != NULL);
+
+    n_keys = MIN (*n_candidates_inout, N_CANDIDATES_MAX);
+    if (n_keys < 1)
+    {
+        *n_candidates_inout = 0;
+        return;
     }
 
     for (i = 0; i < N_CANDIDATES_MAX; i++)
+        keys [i] = CANDIDATE_KEY_NONE;
+
+    popcount [0] = chafa_population_count_u64 (bitmap);
+    popcount [1] = CHAFA_SYMBOL_N_PIXELS - popcount [0];
+
+    /* Widen the seed window until it holds at least n_keys symbols */
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
     {
-         if (candidates [i].hamming_distance > 64)
-             break;
+        seed [0] = MAX (popcount [0] - i, 0);
+        seed [1] = MIN (popcount [0] + i, CHAFA_SYMBOL_N_PIXELS);
+
+        if (symbol_map->popcount_ofs [seed [1] + 1]
+            - symbol_map->popcount_ofs [seed [0]] >= n_keys)
+            break;
     }
 
-    i = *n_candidates_inout = MIN (i, *n_candidates_inout);
-    memcpy (candidates_out, candidates, i * sizeof (ChafaCandidate));
+    scan_popcount_range (symbol_map, bitmap, seed [0], seed [1], do_inverse, keys, n_keys);
+    bound = keys [n_keys - 1] == CANDIDATE_KEY_NONE
+        ? CHAFA_SYMBOL_N_PIXELS : (gint) (keys [n_keys - 1] >> 16);
+
+    if (do_inverse
+        && popcount [1] - bound <= popcount [0] + bound + 1
+        && popcount [0] - bound <= popcount [1] + bound + 1)
+    {
+        /* Plain and inverted ranges overlap or touch; scan them as one */
+        scan_popcount_range_skip (symbol_map, bitmap,
+                                  MIN (popcount [0], popcount [1]) - bound,
+                                  MAX (popcount [0], popcount [1]) + bound,
+                                  seed [0], seed [1],
+                                  do_inverse, keys, n_keys);
+    }
+    else
+    {
+        scan_popcount_range_skip (symbol_map, bitmap,
+                                  popcount [0] - bound, popcount [0] + bound,
+                                  seed [0], seed [1],
+                                  do_inverse, keys, n_keys);
+        if (do_inverse)
+            scan_popcount_range_skip (symbol_map, bitmap,
+                                      popcount [1] - bound, popcount [1] + bound,
+                                      seed [0], seed [1],
+                                      do_inverse, keys, n_keys);
+    }
+
+    for (i = 0; i < n_keys; i++)
+    {
+        if (keys [i] == CANDIDATE_KEY_NONE)
+            break;
+
+        candidates_out [i].hamming_distance = keys [i] >> 16;
+        candidates_out [i].symbol_index = (keys [i] >> 1) & 0x7fff;
+        candidates_out [i].is_inverted = keys [i] & 1;
+    }
 
-    g_free (ham_dist);
+    *n_candidates_inout = i;
 }
 
 void
@@ -1176,12 +1787,14 @@ chafa_symbol_map_find_wide_candidates (const ChafaSymbolMap *symbol_map, const g
         { 0, 129, FALSE },
         { 0, 129, FALSE }
     };
+    ChafaScratchMark mark;
     gint *ham_dist;
     gint i;
 
     g_return_if_fail (symbol_map != NULL);
 
-    ham_dist = g_new (gint, symbol_map->n_symbols2 + 1);
+    chafa_scratch_mark (&mark);
+    ham_dist = chafa_scratch_new (gint, symbol_map->n_symbols2 + 1);
 
     chafa_hamming_distance_2_vu64 (bitmaps, symbol_map->packed_bitmaps2, ham_dist, symbol_map->n_symbols2);
 
@@ -1237,43 +1850,7 @@ chafa_symbol_map_find_wide_candidates (const ChafaSymbolMap *symbol_map, const g
     i = *n_candidates_inout = MIN (i, *n_candidates_inout);
     memcpy (candidates_out, candidates, i * sizeof (ChafaCandidate));
 
-    g_free (ham_dist);
-}
-
-/* Assumes symbols are sorted by ascending popcount */
-static gint
-find_closest_popcount (const ChafaSymbolMap *symbol_map, gint popcount)
-{
-    gint i, j;
-
-    g_assert (symbol_map->n_symbols > 0);
-
-    i = 0;
-    j = symbol_map->n_symbols - 1;
-
-    while (i < j)
-    {
-        gint k = (i + j + 1) / 2;
-
-        if (popcount < symbol_map->symbols [k].popcount)
-            j = k - 1;
-        else if (popcount >= symbol_map->symbols [k].popcount)
-            i = k;
-        else
-            i = j = k;
-    }
-
-    /* If we didn't find the exact popcount, the i+1'th element may be
-     * a closer match. */
-
-    if (i < symbol_map->n_symbols - 1
-        && (abs (popcount - symbol_map->symbols [i + 1].popcount)
-            < abs (popcount - symbol_map->symbols [i].popcount)))
-    {
-        i++;
-    }
-
-    return i;
+    chafa_scratch_release (&mark);
 }
 
 /* Always returns zero or one candidates. We may want to do more in the future */
@@ -1306,14 +1883,16 @@ chafa_symbol_map_find_fill_candidates (const ChafaSymbolMap *symbol_map, gint po
         return;
     }
 
-    sym = find_closest_popcount (symbol_map, popcount);
+    popcount = CLAMP (popcount, 0, CHAFA_SYMBOL_N_PIXELS);
+
+    sym = symbol_map->fill_index [popcount];
     candidates [0].symbol_index = sym;
     candidates [0].hamming_distance = abs (popcount - symbol_map->symbols [sym].popcount);
     candidates [0].is_inverted = FALSE;
 
     if (do_inverse && candidates [0].hamming_distance != 0)
     {
-        sym = find_closest_popcount (symbol_map, 64 - popcount);
+        sym = symbol_map->fill_index [64 - popcount];
         distance = abs (64 - popcount - symbol_map->symbols [sym].popcount);
 
         if (distance < candidates [0].hamming_distance)
@@ -1334,46 +1913,6 @@ chafa_symbol_map_find_fill_candidates (const ChafaSymbolMap *symbol_map, gint po
     memcpy (candidates_out, candidates, i * sizeof (ChafaCandidate));
 }
 
-/* Assumes symbols are sorted by ascending popcount */
-static gint
-find_closest_popcount_wide (const ChafaSymbolMap *symbol_map, gint popcount)
-{
-    gint i, j;
-
-    g_assert (symbol_map->n_symbols2 > 0);
-
-    i = 0;
-    j = symbol_map->n_symbols2 - 1;
-
-    while (i < j)
-    {
-        gint k = (i + j + 1) / 2;
-
-        if (popcount < symbol_map->symbols2 [k].sym [0].popcount
-            + symbol_map->symbols2 [k].sym [1].popcount)
-            j = k - 1;
-        else if (popcount >= symbol_map->symbols2 [k].sym [0].popcount
-            + symbol_map->symbols2 [k].sym [1].popcount)
-            i = k;
-        else
-            i = j = k;
-    }
-
-    /* If we didn't find the exact popcount, the i+1'th element may be
-     * a closer match. */
-
-    if (i < symbol_map->n_symbols2 - 1
-        && (abs (popcount - (symbol_map->symbols2 [i + 1].sym [0].popcount
-                             + symbol_map->symbols2 [i + 1].sym [1].popcount))
-            < abs (popcount - (symbol_map->symbols2 [i].sym [0].popcount
-                               + symbol_map->symbols2 [i].sym [1].popcount))))
-    {
-        i++;
-    }
-
-    return i;
-}
-
 /* Always returns zero or one candidates. We may want to do more in the future */
 void
 chafa_symbol_map_find_wide_fill_candidates (const ChafaSymbolMap *symbol_map, gint popcount,
@@ -1404,7 +1943,9 @@ chafa_symbol_map_find_wide_fill_candidates (const ChafaSymbolMap *symbol_map, gi
         return;
     }
 
-    sym = find_closest_popcount_wide (symbol_map, popcount);
+    popcount = CLAMP (popcount, 0, CHAFA_SYMBOL_N_PIXELS * 2);
+
+    sym = symbol_map->fill_index2 [popcount];
     candidates [0].symbol_index = sym;
     candidates [0].hamming_distance = abs (popcount - (symbol_map->symbols2 [sym].sym [0].popcount
                                                        + symbol_map->symbols2 [sym].sym [1].popcount));
@@ -1412,7 +1953,7 @@ chafa_symbol_map_find_wide_fill_candidates (const ChafaSymbolMap *symbol_map, gi
 
     if (do_inverse && candidates [0].hamming_distance != 0)
     {
-        sym = find_closest_popcount (symbol_map, 128 - popcount);
+        sym = symbol_map->fill_index2 [128 - popcount];
         distance = abs (128 - popcount - (symbol_map->symbols2 [sym].sym [0].popcount
                                           + symbol_map->symbols2 [sym].sym [1].popcount));
 
@@ -1436,6 +1977,8 @@ chafa_symbol_map_find_wide_fill_candidates (const ChafaSymbolMap *symbol_map, gi
 
 /* Public */
 
+G_DEFINE_QUARK (chafa-symbol-map-error-quark, chafa_symbol_map_error)
+
 /**
  * chafa_symbol_map_new:
  *
@@ -1770,6 +2313,9 @@ chafa_symbol_map_get_glyph (ChafaSymbolMap *symbol_map,
 
     g_return_val_if_fail (symbol_map != NULL, FALSE);
 
+    /* Planar and high bit depth formats are input only */
+    g_return_val_if_fail (pixel_format < CHAFA_PIXEL_I420, FALSE);
+
     if (g_unichar_iswide (code_point))
     {
         Glyph2 *glyph2;
@@ -1839,3 +2385,256 @@ chafa_symbol_map_get_glyph (ChafaSymbolMap *symbol_map,
 out:
     return success;
 }
+
+/**
+ * chafa_symbol_map_serialize:
+ * @symbol_map: A symbol map
+ * @len_out: Return location for the length of the result, in bytes
+ *
+ * Prepares @symbol_map for use and stores its complete state, including
+ * compiled symbols, in a compact binary blob. The blob can be written to
+ * disk and passed to chafa_symbol_map_new_from_serialized () later,
+ * e.g. from a file mapping, to skip glyph loading and symbol compilation.
+ *
+ * The blob is only valid for the same version of Chafa on a machine with
+ * the same byte order.
+ *
+ * Returns: (transfer full): The serialized symbol map. Free with g_free ().
+ *
+ * Since: 1.14
+ **/
+gpointer
+chafa_symbol_map_serialize (ChafaSymbolMap *symbol_map, gsize *len_out)
+{
+    SerialHeader header;
+    GHashTableIter iter;
+    gpointer key, value;
+    guint8 *blob, *p;
+    gsize len;
+    gint i;
+
+    g_return_val_if_fail (symbol_map != NULL, NULL);
+    g_return_val_if_fail (len_out != NULL, NULL);
+
+    chafa_symbol_map_prepare (symbol_map);
+
+    memset (&header, 0, sizeof (header));
+    header.magic = SERIAL_MAGIC;
+    header.format_version = SERIAL_FORMAT_VERSION;
+    header.byte_order_mark = SERIAL_BYTE_ORDER_MARK;
+    header.use_builtin_glyphs = symbol_map->use_builtin_glyphs;
+    g_strlcpy (header.lib_version, VERSION, SERIAL_LIB_VERSION_LEN);
+    header.n_selectors = symbol_map->selectors->len;
+    header.n_glyphs = g_hash_table_size (symbol_map->glyphs);
+    header.n_glyphs2 = g_hash_table_size (symbol_map->glyphs2);
+    header.n_symbols = symbol_map->n_symbols;
+    header.n_symbols2 = symbol_map->n_symbols2;
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS + 2; i++)
+        header.popcount_ofs [i] = symbol_map->popcount_ofs [i];
+
+    len = sizeof (SerialHeader)
+        + header.n_selectors * sizeof (SerialSelector)
+        + (header.n_glyphs + header.n_glyphs2) * sizeof (SerialGlyph)
+        + (header.n_symbols + header.n_symbols2 * 2) * sizeof (SerialSymbol);
+
+    blob = g_malloc0 (len);
+    memcpy (blob, &header, sizeof (header));
+    p = blob + sizeof (header);
+
+    for (i = 0; i < (gint) symbol_map->selectors->len; i++)
+    {
+        const Selector *selector = &g_array_index (symbol_map->selectors, Selector, i);
+        SerialSelector ss = { 0 };
+
+        ss.selector_type = selector->selector_type;
+        ss.additive = selector->additive;
+        ss.tags = selector->tags;
+        ss.first_code_point = selector->first_code_point;
+        ss.last_code_point = selector->last_code_point;
+        memcpy (p, &ss, sizeof (ss));
+        p += sizeof (ss);
+    }
+
+    g_hash_table_iter_init (&iter, symbol_map->glyphs);
+    while (g_hash_table_iter_next (&iter, &key, &value))
+    {
+        const Glyph *glyph = value;
+        SerialGlyph sg;
+
+        memset (&sg, 0, sizeof (sg));
+
+        sg.bitmap [0] = glyph->bitmap;
+        sg.c = glyph->c;
+        memcpy (p, &sg, sizeof (sg));
+        p += sizeof (sg);
+    }
+
+    g_hash_table_iter_init (&iter, symbol_map->glyphs2);
+    while (g_hash_table_iter_next (&iter, &key, &value))
+    {
+        const Glyph2 *glyph2 = value;
+        SerialGlyph sg;
+
+        memset (&sg, 0, sizeof (sg));
+
+        sg.bitmap [0] = glyph2->bitmap [0];
+        sg.bitmap [1] = glyph2->bitmap [1];
+        sg.c = glyph2->c;
+        memcpy (p, &sg, sizeof (sg));
+        p += sizeof (sg);
+    }
+
+    for (i = 0; i < symbol_map->n_symbols; i++)
+    {
+        SerialSymbol ss;
+
+        symbol_to_serial (&symbol_map->symbols [i], &ss);
+        memcpy (p, &ss, sizeof (ss));
+        p += sizeof (ss);
+    }
+
+    for (i = 0; i < symbol_map->n_symbols2; i++)
+    {
+        SerialSymbol ss [2];
+
+        symbol_to_serial (&symbol_map->symbols2 [i].sym [0], &ss [0]);
+        symbol_to_serial (&symbol_map->symbols2 [i].sym [1], &ss [1]);
+        memcpy (p, ss, sizeof (ss));
+        p += sizeof (ss);
+    }
+
+    g_assert (p == blob + len);
+
+    *len_out = len;
+    return blob;
+}
+
+/**
+ * chafa_symbol_map_new_from_serialized:
+ * @data: Serialized symbol map, as returned by chafa_symbol_map_serialize ()
+ * @len: Length of @data, in bytes
+ * @error: Return location for error, or %NULL
+ *
+ * Creates a new #ChafaSymbolMap from data produced by
+ * chafa_symbol_map_serialize (). The symbol map is ready for use and
+ * does not need to be compiled again unless it's modified. @data is not
+ * referenced after the call returns.
+ *
+ * Returns: The new symbol map, or %NULL on error
+ *
+ * Since: 1.14
+ **/
+ChafaSymbolMap *
+chafa_symbol_map_new_from_serialized (gconstpointer data, gsize len, GError **error)
+{
+    ChafaSymbolMap *symbol_map;
+    SerialHeader header;
+    const guint8 *p;
+    guint i;
+
+    g_return_val_if_fail (data != NULL, NULL);
+
+    if (len < sizeof (SerialHeader))
+    {
+        g_set_error (error, CHAFA_SYMBOL_MAP_ERROR, CHAFA_SYMBOL_MAP_ERROR_CORRUPT,
+                     "Serialized symbol map is corrupt.");
+        return NULL;
+    }
+
+    memcpy (&header, data, sizeof (header));
+    if (!validate_serial_header (&header, len, error))
+        return NULL;
+
+    symbol_map = chafa_symbol_map_new ();
+    symbol_map->use_builtin_glyphs = header.use_builtin_glyphs ? TRUE : FALSE;
+    p = (const guint8 *) data + sizeof (header);
+
+    for (i = 0; i < header.n_selectors; i++)
+    {
+        SerialSelector ss;
+        Selector selector;
+
+        memcpy (&ss, p, sizeof (ss));
+        p += sizeof (ss);
+
+        selector.selector_type = ss.selector_type;
+        selector.additive = ss.additive;
+        selector.tags = ss.tags;
+        selector.first_code_point = ss.first_code_point;
+        selector.last_code_point = ss.last_code_point;
+        g_array_append_val (symbol_map->selectors, selector);
+    }
+
+    for (i = 0; i < header.n_glyphs; i++)
+    {
+        SerialGlyph sg;
+        Glyph *glyph = g_new (Glyph, 1);
+
+        memcpy (&sg, p, sizeof (sg));
+        p += sizeof (sg);
+
+        glyph->c = sg.c;
+        glyph->bitmap = sg.bitmap [0];
+        g_hash_table_insert (symbol_map->glyphs, GUINT_TO_POINTER (glyph->c), glyph);
+    }
+
+    for (i = 0; i < header.n_glyphs2; i++)
+    {
+        SerialGlyph sg;
+        Glyph2 *glyph2 = g_new (Glyph2, 1);
+
+        memcpy (&sg, p, sizeof (sg));
+        p += sizeof (sg);
+
+        glyph2->c = sg.c;
+        glyph2->bitmap [0] = sg.bitmap [0];
+        glyph2->bitmap [1] = sg.bitmap [1];
+        g_hash_table_insert (symbol_map->glyphs2, GUINT_TO_POINTER (glyph2->c), glyph2);
+    }
+
+    /* Compiled symbols, with zeroed sentinels at the end */
+
+    symbol_map->n_symbols = header.n_symbols;
+    symbol_map->symbols = g_new0 (ChafaSymbol, header.n_symbols + 1);
+    symbol_map->packed_bitmaps = g_new (guint64, header.n_symbols);
+
+    for (i = 0; i < header.n_symbols; i++)
+    {
+        SerialSymbol ss;
+
+        memcpy (&ss, p, sizeof (ss));
+        p += sizeof (ss);
+
+        serial_to_symbol (&ss, &symbol_map->symbols [i]);
+        symbol_map->packed_bitmaps [i] = ss.bitmap;
+    }
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS + 2; i++)
+        symbol_map->popcount_ofs [i] = header.popcount_ofs [i];
+
+    /* Not serialized; the bounds hold whatever order the symbols are in */
+    index_blocks (symbol_map);
+
+    symbol_map->n_symbols2 = header.n_symbols2;
+    symbol_map->symbols2 = g_new0 (ChafaSymbol2, header.n_symbols2 + 1);
+    symbol_map->packed_bitmaps2 = g_new (guint64, header.n_symbols2 * 2);
+
+    for (i = 0; i < header.n_symbols2; i++)
+    {
+        SerialSymbol ss [2];
+
+        memcpy (ss, p, sizeof (ss));
+        p += sizeof (ss);
+
+        serial_to_symbol (&ss [0], &symbol_map->symbols2 [i].sym [0]);
+        serial_to_symbol (&ss [1], &symbol_map->symbols2 [i].sym [1]);
+        symbol_map->packed_bitmaps2 [i * 2] = ss [0].bitmap;
+        symbol_map->packed_bitmaps2 [i * 2 + 1] = ss [1].bitmap;
+    }
+
+    use_symbol_table (symbol_map, symbol_table_new_from_map (symbol_map));
+    index_fill_popcounts (symbol_map);
+    symbol_map->need_rebuild = FALSE;
+    return symbol_map;
+}
@@ -68,6 +68,33 @@ ChafaSymbolTags;
 
 typedef struct ChafaSymbolMap ChafaSymbolMap;
 
+/**
+ * CHAFA_SYMBOL_MAP_ERROR:
+ *
+ * Error domain for #ChafaSymbolMap. Errors in this domain will
+ * be from the #ChafaSymbolMapError enumeration. See #GError for information on
+ * error domains.
+ **/
+#define CHAFA_SYMBOL_MAP_ERROR (chafa_symbol_map_error_quark ())
+
+/**
+ * ChafaSymbolMapError:
+ * @CHAFA_SYMBOL_MAP_ERROR_INCOMPATIBLE: Serialized data was created by a
+ *  different version of Chafa or on a machine with a different byte order.
+ * @CHAFA_SYMBOL_MAP_ERROR_CORRUPT: Serialized data is truncated or malformed.
+ *
+ * Error codes returned when loading a serialized #ChafaSymbolMap.
+ **/
+typedef enum
+{
+    CHAFA_SYMBOL_MAP_ERROR_INCOMPATIBLE,
+    CHAFA_SYMBOL_MAP_ERROR_CORRUPT
+}
+ChafaSymbolMapError;
+
+CHAFA_AVAILABLE_IN_1_14
+GQuark chafa_symbol_map_error_quark (void);
+
 CHAFA_AVAILABLE_IN_ALL
 ChafaSymbolMap *chafa_symbol_map_new (void);
 CHAFA_AVAILABLE_IN_ALL
@@ -119,6 +146,14 @@ gboolean chafa_symbol_map_get_glyph (ChafaSymbolMap *symbol_map,
                                      gint *width_out, gint *height_out,
                                      gint *rowstride_out);
 
+/* --- Serialization --- */
+
+CHAFA_AVAILABLE_IN_1_14
+gpointer chafa_symbol_map_serialize (ChafaSymbolMap *symbol_map, gsize *len_out);
+CHAFA_AVAILABLE_IN_1_14
+ChafaSymbolMap *chafa_symbol_map_new_from_serialized (gconstpointer data, gsize len,
+                                                      GError **error);
+
 G_END_DECLS
 
 #endif /* __CHAFA_SYMBOL_MAP_H__ */
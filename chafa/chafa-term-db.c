@@ -93,6 +93,16 @@ static const SeqStr rep_seqs [] =
     { CHAFA_TERM_SEQ_MAX, NULL }
 };
 
+/* DEC private mode 2026. Terminals that don't know it should ignore it,
+ * but we only send it to those that are known to handle it. */
+static const SeqStr sync_seqs [] =
+{
+    { CHAFA_TERM_SEQ_BEGIN_SYNCHRONIZED_UPDATE, "\033[?2026h" },
+    { CHAFA_TERM_SEQ_END_SYNCHRONIZED_UPDATE, "\033[?2026l" },
+
+    { CHAFA_TERM_SEQ_MAX, NULL }
+};
+
 static const SeqStr sixel_seqs [] =
 {
     { CHAFA_TERM_SEQ_BEGIN_SIXELS, "\033P%1;%2;%3q" },
@@ -275,10 +285,34 @@ static const SeqStr *color_fbterm_list [] =
 static const SeqStr kitty_seqs [] =
 {
     { CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_IMAGE_V1, "\033_Ga=T,f=%1,s=%2,v=%3,c=%4,r=%5,m=1\033\\" },
+    { CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_COMPRESSED_IMAGE_V1, "\033_Ga=T,f=%1,o=z,s=%2,v=%3,c=%4,r=%5,m=1\033\\" },
     { CHAFA_TERM_SEQ_END_KITTY_IMAGE, "\033_Gm=0\033\\" },
     { CHAFA_TERM_SEQ_BEGIN_KITTY_IMAGE_CHUNK, "\033_Gm=1;" },
     { CHAFA_TERM_SEQ_END_KITTY_IMAGE_CHUNK, "\033\\" },
 
+    /* Commands referring to an image ID are acknowledged by the terminal
+     * unless we ask it to be quiet with q=2 */
+    { CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1, "\033_Ga=t,q=2,i=%1,f=%2,s=%3,v=%4,m=1\033\\" },
+    { CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_COMPRESSED_IMAGE_V1, "\033_Ga=t,q=2,i=%1,f=%2,o=z,s=%3,v=%4,m=1\033\\" },
+    { CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1, "\033_Ga=p,q=2,i=%1,c=%2,r=%3\033\\" },
+    { CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_PLACEMENTS_V1, "\033_Ga=d,q=2,d=i,i=%1\033\\" },
+    { CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_V1, "\033_Ga=d,q=2,d=I,i=%1\033\\" },
+
+    /* Edits the root frame in place. X=1 overwrites the pixels instead of
+     * blending the new ones on top. */
+    { CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_IMAGE_V1, "\033_Ga=f,q=2,i=%1,r=1,X=1,f=%2,x=%3,y=%4,s=%5,v=%6,m=1\033\\" },
+    { CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_COMPRESSED_IMAGE_V1, "\033_Ga=f,q=2,i=%1,r=1,X=1,f=%2,o=z,x=%3,y=%4,s=%5,v=%6,m=1\033\\" },
+
+    { CHAFA_TERM_SEQ_MAX, NULL }
+};
+
+/* These only work when the terminal can see our shared memory and files.
+ * They're excluded from the fallback list for the same reason. */
+static const SeqStr kitty_local_seqs [] =
+{
+    { CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_SHM_IMAGE_V1, "\033_Ga=T,t=s,f=%1,s=%2,v=%3,c=%4,r=%5;" },
+    { CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_FILE_IMAGE_V1, "\033_Ga=T,t=t,f=%1,s=%2,v=%3,c=%4,r=%5;" },
+
     { CHAFA_TERM_SEQ_MAX, NULL }
 };
 
@@ -293,6 +327,7 @@ static const SeqStr iterm2_seqs [] =
 static const SeqStr *fallback_list [] =
 {
     vt220_seqs,
+    sync_seqs,
     color_direct_seqs,
     color_256_seqs,
     color_16_seqs,
@@ -343,10 +378,13 @@ detect_capabilities (ChafaTermInfo *ti, gchar **envp)
     const gchar *tmux;
     const gchar *ctx_backend;
     const gchar *lc_terminal;
+    gboolean is_remote;
     gchar *comspec = NULL;
     const SeqStr **color_seq_list = color_256_list;
     const SeqStr *gfx_seqs = NULL;
     const SeqStr *rep_seqs_local = NULL;
+    const SeqStr *gfx_local_seqs = NULL;
+    const SeqStr *sync_seqs_local = NULL;
 
     add_seqs (ti, vt220_seqs);
 
@@ -377,6 +415,11 @@ detect_capabilities (ChafaTermInfo *ti, gchar **envp)
     lc_terminal = g_environ_getenv (envp, "LC_TERMINAL");
     if (!lc_terminal) lc_terminal = "";
 
+    /* If we're in an SSH session, the terminal is likely on another host */
+    is_remote = g_environ_getenv (envp, "SSH_CONNECTION")
+        || g_environ_getenv (envp, "SSH_CLIENT")
+        || g_environ_getenv (envp, "SSH_TTY");
+
     /* The MS Windows 10 TH2 (v1511+) console supports ANSI escape codes,
      * including AIX and DirectColor sequences. We detect this early and allow
      * TERM to override, if present. */
@@ -435,7 +478,15 @@ detect_capabilities (ChafaTermInfo *ti, gchar **envp)
 
     /* Kitty has a unique graphics protocol */
     if (!strcmp (term, "xterm-kitty"))
+    {
         gfx_seqs = kitty_seqs;
+        sync_seqs_local = sync_seqs;
+
+        /* It can also read image data directly from shared memory or
+         * temporary files, provided it's running on the same host. */
+        if (!is_remote)
+            gfx_local_seqs = kitty_local_seqs;
+    }
 
     /* iTerm2 supports truecolor and has a unique graphics protocol */
     if (!g_ascii_strcasecmp (lc_terminal, "iTerm2")
@@ -448,13 +499,19 @@ detect_capabilities (ChafaTermInfo *ti, gchar **envp)
     if (!g_ascii_strcasecmp (term_program, "WezTerm"))
     {
         gfx_seqs = sixel_seqs;
+        sync_seqs_local = sync_seqs;
     }
 
     if (!g_ascii_strcasecmp (term_name, "contour"))
     {
         gfx_seqs = sixel_seqs;
+        sync_seqs_local = sync_seqs;
     }
 
+    /* Alacritty supports synchronized updates since 0.13 */
+    if (!strcmp (term, "alacritty"))
+        sync_seqs_local = sync_seqs;
+
     /* Apple Terminal sets TERM=xterm-256color, and does not support truecolor */
     if (!g_ascii_strcasecmp (term_program, "Apple_Terminal"))
         color_seq_list = color_256_list;
@@ -475,7 +532,10 @@ detect_capabilities (ChafaTermInfo *ti, gchar **envp)
     }
 
     if (!strcmp (term, "foot") || !strncmp (term, "foot-", 5))
+    {
         gfx_seqs = sixel_seqs;
+        sync_seqs_local = sync_seqs;
+    }
 
     /* rxvt 256-color really is 256 colors only */
     if (!strcmp (term, "rxvt-unicode-256color"))
@@ -503,6 +563,10 @@ detect_capabilities (ChafaTermInfo *ti, gchar **envp)
         /* screen and older tmux do not support REP. Newer tmux does,
          * but there's no reliable way to tell which version we're dealing with. */
         rep_seqs_local = NULL;
+
+        /* The outer terminal may support synchronized updates, but the
+         * multiplexer repaints on its own schedule */
+        sync_seqs_local = NULL;
     }
 
     /* If TERM is "linux", we're probably on the Linux console, which supports
@@ -522,7 +586,9 @@ detect_capabilities (ChafaTermInfo *ti, gchar **envp)
 
     add_seq_list (ti, color_seq_list);
     add_seqs (ti, gfx_seqs);
+    add_seqs (ti, gfx_local_seqs);
     add_seqs (ti, rep_seqs_local);
+    add_seqs (ti, sync_seqs_local);
 }
 
 static ChafaTermDb *
@@ -173,6 +173,18 @@
  * @CHAFA_TERM_SEQ_F12_KEY: F12 key.
  * @CHAFA_TERM_SEQ_F12_CTRL_KEY: Ctrl + F12 key.
  * @CHAFA_TERM_SEQ_F12_SHIFT_KEY: Shift + F12 key.
+ * @CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_COMPRESSED_IMAGE_V1: Begin upload of zlib-compressed Kitty image for immediate display at cursor.
+ * @CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_SHM_IMAGE_V1: Begin Kitty image transfer through shared memory for immediate display at cursor.
+ * @CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_FILE_IMAGE_V1: Begin Kitty image transfer through a temporary file for immediate display at cursor.
+ * @CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1: Begin upload of Kitty image to be stored under an ID.
+ * @CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_COMPRESSED_IMAGE_V1: Begin upload of zlib-compressed Kitty image to be stored under an ID.
+ * @CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1: Display a stored Kitty image at cursor.
+ * @CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_PLACEMENTS_V1: Remove all placements of a stored Kitty image, keeping its data.
+ * @CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_V1: Remove a stored Kitty image and free its data.
+ * @CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_IMAGE_V1: Begin upload of pixels replacing a rectangle in a stored Kitty image.
+ * @CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_COMPRESSED_IMAGE_V1: Begin upload of zlib-compressed pixels replacing a rectangle in a stored Kitty image.
+ * @CHAFA_TERM_SEQ_BEGIN_SYNCHRONIZED_UPDATE: Hold off on repainting the screen until the end of the update.
+ * @CHAFA_TERM_SEQ_END_SYNCHRONIZED_UPDATE: Repaint the screen with everything received since the update began.
  * @CHAFA_TERM_SEQ_MAX: Last control sequence plus one.
  *
  * An enumeration of the control sequences supported by #ChafaTermInfo.
@@ -187,12 +199,59 @@ typedef struct
 }
 SeqArgInfo;
 
+/* Sequences with 8-bit arguments are also kept in a precompiled form. The
+ * literal fragments between arguments are padded to fixed-size slots, so
+ * emitting one takes a few fixed-length copies and one table lookup per
+ * argument. Sequences that don't fit fall back to the generic formatter. */
+#define SEQ_FRAG_LEN_MAX 8
+
+typedef struct
+{
+    gchar frag [CHAFA_TERM_SEQ_ARGS_MAX] [SEQ_FRAG_LEN_MAX];
+    guint8 frag_len [CHAFA_TERM_SEQ_ARGS_MAX];
+    guint8 arg_index [CHAFA_TERM_SEQ_ARGS_MAX];
+    guint8 is_valid;
+}
+SeqTemplate;
+
+/* All the sequences are also merged into a trie for parsing input of
+ * unknown type. Its edges are either literal bytes or numeric arguments.
+ * It's built on first use and dropped whenever a sequence changes. */
+typedef enum
+{
+    TRIE_EDGE_LITERAL,
+    TRIE_EDGE_DEC,
+    TRIE_EDGE_HEX
+}
+TrieEdgeType;
+
+typedef struct
+{
+    /* Node 0 is the root, so it doubles as "none" here */
+    guint16 first_child;
+    guint16 next_sibling;
+    guint8 edge_type;
+    guint8 c;
+    /* Lowest sequence ending at this node, or CHAFA_TERM_SEQ_MAX */
+    guint16 seq;
+}
+TrieNode;
+
+typedef struct
+{
+    TrieNode *nodes;
+    gint n_nodes;
+}
+SeqTrie;
+
 struct ChafaTermInfo
 {
     gint refs;
     gchar seq_str [CHAFA_TERM_SEQ_MAX] [CHAFA_TERM_SEQ_LENGTH_MAX];
     SeqArgInfo seq_args [CHAFA_TERM_SEQ_MAX] [CHAFA_TERM_SEQ_ARGS_MAX];
+    SeqTemplate seq_tmpl [CHAFA_TERM_SEQ_MAX];
     gchar *unparsed_str [CHAFA_TERM_SEQ_MAX];
+    SeqTrie *trie;
 };
 
 typedef struct
@@ -317,6 +376,61 @@ out:
     return result;
 }
 
+static void
+compile_seq_template (ChafaTermInfo *term_info, ChafaTermSeq seq)
+{
+    const SeqArgInfo *seq_args = &term_info->seq_args [seq] [0];
+    SeqTemplate *tmpl = &term_info->seq_tmpl [seq];
+    gint n_args = seq_meta [seq].n_args;
+    gint ofs = 0;
+    gint i;
+
+    memset (tmpl, 0, sizeof (*tmpl));
+
+    if (seq_meta [seq].type_size != 1 || n_args < 1)
+        return;
+
+    /* Every argument must be used exactly once in the list, and the slots
+     * must not be overrun */
+    for (i = 0; i <= n_args; i++)
+    {
+        if (seq_args [i].pre_len > SEQ_FRAG_LEN_MAX)
+            return;
+        if (i < n_args && seq_args [i].arg_index >= n_args)
+            return;
+
+        memcpy (&tmpl->frag [i] [0], &term_info->seq_str [seq] [ofs], seq_args [i].pre_len);
+        tmpl->frag_len [i] = seq_args [i].pre_len;
+        tmpl->arg_index [i] = seq_args [i].arg_index;
+        ofs += seq_args [i].pre_len;
+    }
+
+    if (seq_args [n_args].arg_index != ARG_INDEX_SENTINEL)
+        return;
+
+    /* The padding is copied too, so leave room for it past the end */
+    if (ofs + n_args * 3 + SEQ_FRAG_LEN_MAX > CHAFA_TERM_SEQ_LENGTH_MAX)
+        return;
+
+    tmpl->is_valid = TRUE;
+}
+
+static inline gchar *
+emit_seq_tmpl_guint8 (const SeqTemplate *tmpl, gchar *out, const guint8 *args, gint n_args)
+{
+    gint i;
+
+    for (i = 0; i < n_args; i++)
+    {
+        memcpy (out, &tmpl->frag [i] [0], SEQ_FRAG_LEN_MAX);
+        out += tmpl->frag_len [i];
+        out = chafa_format_dec_u8 (out, args [tmpl->arg_index [i]]);
+    }
+
+    memcpy (out, &tmpl->frag [i] [0], SEQ_FRAG_LEN_MAX);
+    return out + tmpl->frag_len [i];
+}
+
 #define EMIT_SEQ_DEF(name, inttype, intformatter)                        \
     static gchar *                                                      \
     emit_seq_##name (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq seq, \
@@ -367,6 +481,8 @@ emit_seq_1_args_uint (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq s
 static gchar *
 emit_seq_1_args_uint8 (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq seq, guint8 arg0)
 {
+    if (G_LIKELY (term_info->seq_tmpl [seq].is_valid))
+        return emit_seq_tmpl_guint8 (&term_info->seq_tmpl [seq], out, &arg0, 1);
     return emit_seq_guint8 (term_info, out, seq, &arg0, 1);
 }
 
@@ -387,6 +503,9 @@ emit_seq_2_args_uint8 (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq
 
     args [0] = arg0;
     args [1] = arg1;
+
+    if (G_LIKELY (term_info->seq_tmpl [seq].is_valid))
+        return emit_seq_tmpl_guint8 (&term_info->seq_tmpl [seq], out, args, 2);
     return emit_seq_guint8 (term_info, out, seq, args, 2);
 }
 
@@ -401,6 +520,18 @@ emit_seq_3_args_uint (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq s
     return emit_seq_guint (term_info, out, seq, args, 3);
 }
 
+static gchar *
+emit_seq_4_args_uint (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq seq, guint arg0, guint arg1, guint arg2, guint arg3)
+{
+    guint args [4];
+
+    args [0] = arg0;
+    args [1] = arg1;
+    args [2] = arg2;
+    args [3] = arg3;
+    return emit_seq_guint (term_info, out, seq, args, 4);
+}
+
 static gchar *
 emit_seq_5_args_uint (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq seq, guint arg0, guint arg1, guint arg2, guint arg3, guint arg4)
 {
@@ -414,6 +545,20 @@ emit_seq_5_args_uint (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq s
     return emit_seq_guint (term_info, out, seq, args, 5);
 }
 
+static gchar *
+emit_seq_6_args_uint (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq seq, guint arg0, guint arg1, guint arg2, guint arg3, guint arg4, guint arg5)
+{
+    guint args [6];
+
+    args [0] = arg0;
+    args [1] = arg1;
+    args [2] = arg2;
+    args [3] = arg3;
+    args [4] = arg4;
+    args [5] = arg5;
+    return emit_seq_guint (term_info, out, seq, args, 6);
+}
+
 static gchar *
 emit_seq_3_args_uint8 (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq seq, guint8 arg0, guint8 arg1, guint8 arg2)
 {
@@ -422,6 +567,9 @@ emit_seq_3_args_uint8 (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq
     args [0] = arg0;
     args [1] = arg1;
     args [2] = arg2;
+
+    if (G_LIKELY (term_info->seq_tmpl [seq].is_valid))
+        return emit_seq_tmpl_guint8 (&term_info->seq_tmpl [seq], out, args, 3);
     return emit_seq_guint8 (term_info, out, seq, args, 3);
 }
 
@@ -436,6 +584,9 @@ emit_seq_6_args_uint8 (const ChafaTermInfo *term_info, gchar *out, ChafaTermSeq
     args [3] = arg3;
     args [4] = arg4;
     args [5] = arg5;
+
+    if (G_LIKELY (term_info->seq_tmpl [seq].is_valid))
+        return emit_seq_tmpl_guint8 (&term_info->seq_tmpl [seq], out, args, 6);
     return emit_seq_guint8 (term_info, out, seq, args, 6);
 }
 
@@ -559,6 +710,194 @@ try_parse_seq (const ChafaTermInfo *term_info, ChafaTermSeq seq,
     return CHAFA_PARSE_SUCCESS;
 }
 
+/* Sequence trie */
+
+static TrieEdgeType
+arg_edge_type (ChafaTermSeq seq)
+{
+    return seq_meta [seq].type_size == 2 ? TRIE_EDGE_HEX : TRIE_EDGE_DEC;
+}
+
+static guint16
+trie_get_child (GArray *nodes, guint16 parent, TrieEdgeType edge_type, guint8 c)
+{
+    TrieNode node = { 0 };
+    guint16 child;
+
+    for (child = g_array_index (nodes, TrieNode, parent).first_child;
+         child != 0;
+         child = g_array_index (nodes, TrieNode, child).next_sibling)
+    {
+        const TrieNode *n = &g_array_index (nodes, TrieNode, child);
+
+        if (n->edge_type == edge_type && n->c == c)
+            return child;
+    }
+
+    node.edge_type = edge_type;
+    node.c = c;
+    node.seq = CHAFA_TERM_SEQ_MAX;
+    node.next_sibling = g_array_index (nodes, TrieNode, parent).first_child;
+    g_array_append_val (nodes, node);
+
+    child = nodes->len - 1;
+    g_array_index (nodes, TrieNode, parent).first_child = child;
+    return child;
+}
+
+static void
+trie_add_seq (GArray *nodes, const ChafaTermInfo *term_info, ChafaTermSeq seq)
+{
+    const gchar *seq_str = &term_info->seq_str [seq] [0];
+    const SeqArgInfo *seq_args = &term_info->seq_args [seq] [0];
+    guint16 node = 0;
+    gint i, j;
+
+    for (i = 0; ; i++)
+    {
+        for (j = 0; j < seq_args [i].pre_len; j++)
+            node = trie_get_child (nodes, node, TRIE_EDGE_LITERAL, *(seq_str++));
+
+        if (seq_args [i].arg_index == ARG_INDEX_SENTINEL)
+            break;
+
+        node = trie_get_child (nodes, node, arg_edge_type (seq), 0);
+    }
+
+    /* Can't match an empty sequence */
+    if (node == 0)
+        return;
+
+    if (g_array_index (nodes, TrieNode, node).seq == CHAFA_TERM_SEQ_MAX)
+        g_array_index (nodes, TrieNode, node).seq = seq;
+}
+
+static SeqTrie *
+seq_trie_new (const ChafaTermInfo *term_info)
+{
+    SeqTrie *trie;
+    GArray *nodes;
+    TrieNode root = { 0 };
+    gint i;
+
+    /* Node indexes are 16-bit, but this can't get anywhere near that */
+    G_STATIC_ASSERT (CHAFA_TERM_SEQ_MAX * CHAFA_TERM_SEQ_LENGTH_MAX < 65536);
+
+    nodes = g_array_new (FALSE, FALSE, sizeof (TrieNode));
+    root.seq = CHAFA_TERM_SEQ_MAX;
+    g_array_append_val (nodes, root);
+
+    for (i = 0; i < CHAFA_TERM_SEQ_MAX; i++)
+    {
+        if (term_info->unparsed_str [i])
+            trie_add_seq (nodes, term_info, i);
+    }
+
+    trie = g_new (SeqTrie, 1);
+    trie->n_nodes = nodes->len;
+    trie->nodes = (TrieNode *) g_array_free (nodes, FALSE);
+    return trie;
+}
+
+static void
+seq_trie_destroy (SeqTrie *trie)
+{
+    if (!trie)
+        return;
+
+    g_free (trie->nodes);
+    g_free (trie);
+}
+
+static const SeqTrie *
+get_seq_trie (ChafaTermInfo *term_info)
+{
+    SeqTrie *trie = g_atomic_pointer_get (&term_info->trie);
+
+    if (!trie)
+    {
+        /* Another thread may be racing us to it. Only one trie gets in. */
+        trie = seq_trie_new (term_info);
+        if (!g_atomic_pointer_compare_and_exchange (&term_info->trie, NULL, trie))
+        {
+            seq_trie_destroy (trie);
+            trie = g_atomic_pointer_get (&term_info->trie);
+        }
+    }
+
+    return trie;
+}
+
+static void
+clear_seq_trie (ChafaTermInfo *term_info)
+{
+    seq_trie_destroy (term_info->trie);
+    term_info->trie = NULL;
+}
+
+typedef struct
+{
+    const gchar *in;
+    gint in_len;
+
+    /* Longest complete match so far */
+    ChafaTermSeq seq;
+    gint len;
+    guint args [CHAFA_TERM_SEQ_ARGS_MAX];
+
+    /* Set if we ran out of input partway into a sequence */
+    gboolean need_more;
+}
+TrieMatch;
+
+/* Literal and argument edges may both accept the next byte, so this
+ * explores every branch that's consistent with the input. Depth is
+ * bounded by the sequence length. */
+static void
+trie_match (const SeqTrie *trie, guint16 node_index, gint ofs,
+            guint *args, gint n_args, TrieMatch *match)
+{
+    const TrieNode *node = &trie->nodes [node_index];
+    guint16 child;
+
+    if (node->seq != CHAFA_TERM_SEQ_MAX && ofs > match->len)
+    {
+        match->seq = node->seq;
+        match->len = ofs;
+        memcpy (match->args, args, n_args * sizeof (guint));
+    }
+
+    if (node->first_child && ofs == match->in_len)
+    {
+        match->need_more = TRUE;
+        return;
+    }
+
+    for (child = node->first_child; child != 0; child = trie->nodes [child].next_sibling)
+    {
+        const TrieNode *c = &trie->nodes [child];
+        gint len;
+
+        if (c->edge_type == TRIE_EDGE_LITERAL)
+        {
+            if (match->in [ofs] == (gchar) c->c)
+                trie_match (trie, child, ofs + 1, args, n_args, match);
+            continue;
+        }
+
+        if (n_args == CHAFA_TERM_SEQ_ARGS_MAX)
+            continue;
+
+        if (c->edge_type == TRIE_EDGE_HEX)
+            len = parse_hex4 (match->in + ofs, match->in_len - ofs, args + n_args);
+        else
+            len = parse_dec (match->in + ofs, match->in_len - ofs, args + n_args);
+
+        if (len > 0)
+            trie_match (trie, child, ofs + len, args, n_args + 1, match);
+    }
+}
+
 /* Public */
 
 G_DEFINE_QUARK (chafa-term-info-error-quark, chafa_term_info_error)
@@ -610,6 +949,7 @@ chafa_term_info_copy (const ChafaTermInfo *term_info)
     new_term_info = g_new (ChafaTermInfo, 1);
     memcpy (new_term_info, term_info, sizeof (ChafaTermInfo));
     new_term_info->refs = 1;
+    new_term_info->trie = NULL;
 
     for (i = 0; i < CHAFA_TERM_SEQ_MAX; i++)
     {
@@ -664,6 +1004,7 @@ chafa_term_info_unref (ChafaTermInfo *term_info)
         for (i = 0; i < CHAFA_TERM_SEQ_MAX; i++)
             g_free (term_info->unparsed_str [i]);
 
+        seq_trie_destroy (term_info->trie);
         g_free (term_info);
     }
 }
@@ -775,6 +1116,8 @@ chafa_term_info_set_seq (ChafaTermInfo *term_info, ChafaTermSeq seq, const gchar
         }
     }
 
+    compile_seq_template (term_info, seq);
+    clear_seq_trie (term_info);
     return result;
 }
 
@@ -909,6 +1252,86 @@ chafa_term_info_parse_seq (ChafaTermInfo *term_info, ChafaTermSeq seq,
     return try_parse_seq (term_info, seq, input, input_len, args_out);
 }
 
+/**
+ * chafa_term_info_parse_next_seq:
+ * @term_info: A #ChafaTermInfo
+ * @input: Pointer to pointer to input data
+ * @input_len: Pointer to maximum input data length
+ * @seq_out: Pointer to return location for the matched #ChafaTermSeq, or %NULL
+ * @args_out: Pointer to parsed argument values, or %NULL
+ *
+ * Attempts to parse any of the terminal sequences defined in @term_info
+ * from an input data array. This is useful when the type of the input is
+ * not known in advance, e.g. when it could be a key press or a reply to
+ * a query.
+ *
+ * All the sequences are considered in a single pass over the input. If
+ * more than one matches, the longest match wins. If several sequences
+ * are identical, the one with the lowest #ChafaTermSeq value is returned.
+ *
+ * If successful, #CHAFA_PARSE_SUCCESS will be returned, @seq_out and
+ * @args_out will be filled in, the @input pointer will be advanced and
+ * the parsed length will be subtracted from @input_len. @args_out must
+ * have room for at least %CHAFA_TERM_SEQ_ARGS_MAX elements.
+ *
+ * If no sequence matches, but the input is a prefix of one or more
+ * sequences, #CHAFA_PARSE_AGAIN will be returned.
+ *
+ * Returns: A #ChafaParseResult indicating success, failure or insufficient input data
+ *
+ * Since: 1.14
+ **/
+ChafaParseResult
+chafa_term_info_parse_next_seq (ChafaTermInfo *term_info,
+                                gchar **input, gint *input_len,
+                                ChafaTermSeq *seq_out, guint *args_out)
+{
+    const SeqTrie *trie;
+    TrieMatch match;
+    guint args [CHAFA_TERM_SEQ_ARGS_MAX];
+    const SeqArgInfo *seq_args;
+    gint i;
+
+    g_return_val_if_fail (term_info != NULL, CHAFA_PARSE_FAILURE);
+    g_return_val_if_fail (input != NULL, CHAFA_PARSE_FAILURE);
+    g_return_val_if_fail (*input != NULL, CHAFA_PARSE_FAILURE);
+    g_return_val_if_fail (input_len != NULL, CHAFA_PARSE_FAILURE);
+
+    if (*input_len < 1)
+        return CHAFA_PARSE_AGAIN;
+
+    trie = get_seq_trie (term_info);
+
+    match.in = *input;
+    match.in_len = *input_len;
+    match.seq = CHAFA_TERM_SEQ_MAX;
+    match.len = 0;
+    match.need_more = FALSE;
+
+    trie_match (trie, 0, 0, args, 0, &match);
+
+    if (match.seq == CHAFA_TERM_SEQ_MAX)
+        return match.need_more ? CHAFA_PARSE_AGAIN : CHAFA_PARSE_FAILURE;
+
+    /* Arguments were collected in the order they appear; put them in
+     * their assigned slots */
+    if (args_out)
+    {
+        seq_args = &term_info->seq_args [match.seq] [0];
+        memset (args_out, 0, seq_meta [match.seq].n_args * sizeof (guint));
+
+        for (i = 0; seq_args [i].arg_index != ARG_INDEX_SENTINEL; i++)
+            args_out [seq_args [i].arg_index] = match.args [i];
+    }
+
+    if (seq_out)
+        *seq_out = match.seq;
+
+    *input += match.len;
+    *input_len -= match.len;
+    return CHAFA_PARSE_SUCCESS;
+}
+
 /**
  * chafa_term_info_supplement:
  * @term_info: A #ChafaTermInfo to supplement
@@ -936,8 +1359,11 @@ chafa_term_info_supplement (ChafaTermInfo *term_info, ChafaTermInfo *source)
                     CHAFA_TERM_SEQ_LENGTH_MAX);
             memcpy (&term_info->seq_args [i] [0], &source->seq_args [i] [0],
                     CHAFA_TERM_SEQ_ARGS_MAX * sizeof (SeqArgInfo));
+            term_info->seq_tmpl [i] = source->seq_tmpl [i];
         }
     }
+
+    clear_seq_trie (term_info);
 }
 
 #define DEFINE_EMIT_SEQ_0_none_char(func_name, seq_name) \
@@ -992,10 +1418,18 @@ gchar *chafa_term_info_emit_##func_name(const ChafaTermInfo *term_info, gchar *d
 gchar *chafa_term_info_emit_##func_name(const ChafaTermInfo *term_info, gchar *dest, guint arg0, guint arg1, guint arg2) \
 { return emit_seq_3_args_uint (term_info, dest, CHAFA_TERM_SEQ_##seq_name, arg0, arg1, arg2); }
 
+#define DEFINE_EMIT_SEQ_4_none_guint(func_name, seq_name) \
+gchar *chafa_term_info_emit_##func_name(const ChafaTermInfo *term_info, gchar *dest, guint arg0, guint arg1, guint arg2, guint arg3) \
+{ return emit_seq_4_args_uint (term_info, dest, CHAFA_TERM_SEQ_##seq_name, arg0, arg1, arg2, arg3); }
+
 #define DEFINE_EMIT_SEQ_5_none_guint(func_name, seq_name) \
 gchar *chafa_term_info_emit_##func_name(const ChafaTermInfo *term_info, gchar *dest, guint arg0, guint arg1, guint arg2, guint arg3, guint arg4) \
 { return emit_seq_5_args_uint (term_info, dest, CHAFA_TERM_SEQ_##seq_name, arg0, arg1, arg2, arg3, arg4); }
 
+#define DEFINE_EMIT_SEQ_6_none_guint(func_name, seq_name) \
+gchar *chafa_term_info_emit_##func_name(const ChafaTermInfo *term_info, gchar *dest, guint arg0, guint arg1, guint arg2, guint arg3, guint arg4, guint arg5) \
+{ return emit_seq_6_args_uint (term_info, dest, CHAFA_TERM_SEQ_##seq_name, arg0, arg1, arg2, arg3, arg4, arg5); }
+
 #define DEFINE_EMIT_SEQ_3_none_guint8(func_name, seq_name) \
 gchar *chafa_term_info_emit_##func_name(const ChafaTermInfo *term_info, gchar *dest, guint8 arg0, guint8 arg1, guint8 arg2) \
 { return emit_seq_3_args_uint8 (term_info, dest, CHAFA_TERM_SEQ_##seq_name, arg0, arg1, arg2); }
@@ -117,6 +117,10 @@ CHAFA_AVAILABLE_IN_1_14
 ChafaParseResult chafa_term_info_parse_seq (ChafaTermInfo *term_info, ChafaTermSeq seq,
                                             gchar **input, gint *input_len,
                                             guint *args_out);
+CHAFA_AVAILABLE_IN_1_14
+ChafaParseResult chafa_term_info_parse_next_seq (ChafaTermInfo *term_info,
+                                                 gchar **input, gint *input_len,
+                                                 ChafaTermSeq *seq_out, guint *args_out);
 
 CHAFA_AVAILABLE_IN_1_6
 void chafa_term_info_supplement (ChafaTermInfo *term_info, ChafaTermInfo *source);
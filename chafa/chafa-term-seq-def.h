@@ -2397,6 +2397,297 @@ CHAFA_TERM_SEQ_DEF(f12_ctrl_key, F12_CTRL_KEY, 0, none, char)
  **/
 CHAFA_TERM_SEQ_DEF(f12_shift_key, F12_SHIFT_KEY, 0, none, char)
 
+/**
+ * chafa_term_info_emit_begin_kitty_immediate_compressed_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @bpp: Bits per pixel
+ * @width_pixels: Image width in pixels
+ * @height_pixels: Image height in pixels
+ * @width_cells: Target width in cells
+ * @height_cells: Target height in cells
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_COMPRESSED_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * This works like #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_IMAGE_V1, except
+ * the image data must be compressed with zlib (RFC 1950) before it is
+ * base-64 encoded and split into chunks.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_kitty_immediate_compressed_image_v1, BEGIN_KITTY_IMMEDIATE_COMPRESSED_IMAGE_V1, 5, none, guint, CHAFA_TERM_SEQ_ARGS guint bpp, guint width_pixels, guint height_pixels, guint width_cells, guint height_cells)
+
+/**
+ * chafa_term_info_emit_begin_kitty_immediate_shm_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @bpp: Bits per pixel
+ * @width_pixels: Image width in pixels
+ * @height_pixels: Image height in pixels
+ * @width_cells: Target width in cells
+ * @height_cells: Target height in cells
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_SHM_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * This sequence must be followed by the base-64 encoded name of a POSIX
+ * shared memory object holding the image data, and then
+ * #CHAFA_TERM_SEQ_END_KITTY_IMAGE_CHUNK. The terminal will unlink the
+ * object after reading it. This only works if the terminal runs on the
+ * same host.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_kitty_immediate_shm_image_v1, BEGIN_KITTY_IMMEDIATE_SHM_IMAGE_V1, 5, none, guint, CHAFA_TERM_SEQ_ARGS guint bpp, guint width_pixels, guint height_pixels, guint width_cells, guint height_cells)
+
+/**
+ * chafa_term_info_emit_begin_kitty_immediate_file_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @bpp: Bits per pixel
+ * @width_pixels: Image width in pixels
+ * @height_pixels: Image height in pixels
+ * @width_cells: Target width in cells
+ * @height_cells: Target height in cells
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_FILE_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * This sequence must be followed by the base-64 encoded absolute path of a
+ * temporary file holding the image data, and then
+ * #CHAFA_TERM_SEQ_END_KITTY_IMAGE_CHUNK. The terminal will delete the
+ * file after reading it if it's in a temporary directory and its name
+ * contains the string "tty-graphics-protocol". This only works if the
+ * terminal runs on the same host.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_kitty_immediate_file_image_v1, BEGIN_KITTY_IMMEDIATE_FILE_IMAGE_V1, 5, none, guint, CHAFA_TERM_SEQ_ARGS guint bpp, guint width_pixels, guint height_pixels, guint width_cells, guint height_cells)
+
+/**
+ * chafa_term_info_emit_begin_kitty_store_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @image_id: Image ID in the range [1..9999]
+ * @bpp: Bits per pixel
+ * @width_pixels: Image width in pixels
+ * @height_pixels: Image height in pixels
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * This works like #CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_IMAGE_V1, except
+ * the image is stored under @image_id instead of being displayed. Any
+ * image previously stored under the same ID is replaced. The image can
+ * then be displayed any number of times with
+ * #CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1 without transferring it again.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_kitty_store_image_v1, BEGIN_KITTY_STORE_IMAGE_V1, 4, none, guint, CHAFA_TERM_SEQ_ARGS guint image_id, guint bpp, guint width_pixels, guint height_pixels)
+
+/**
+ * chafa_term_info_emit_begin_kitty_store_compressed_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @image_id: Image ID in the range [1..9999]
+ * @bpp: Bits per pixel
+ * @width_pixels: Image width in pixels
+ * @height_pixels: Image height in pixels
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_COMPRESSED_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * This works like #CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1, except
+ * the image data must be compressed with zlib (RFC 1950) before it is
+ * base-64 encoded and split into chunks.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_kitty_store_compressed_image_v1, BEGIN_KITTY_STORE_COMPRESSED_IMAGE_V1, 4, none, guint, CHAFA_TERM_SEQ_ARGS guint image_id, guint bpp, guint width_pixels, guint height_pixels)
+
+/**
+ * chafa_term_info_emit_place_kitty_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @image_id: Image ID in the range [1..9999]
+ * @width_cells: Target width in cells
+ * @height_cells: Target height in cells
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * Displays the image stored under @image_id at the cursor position.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(place_kitty_image_v1, PLACE_KITTY_IMAGE_V1, 3, none, guint, CHAFA_TERM_SEQ_ARGS guint image_id, guint width_cells, guint height_cells)
+
+/**
+ * chafa_term_info_emit_delete_kitty_image_placements_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @image_id: Image ID in the range [1..9999]
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_PLACEMENTS_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * Removes every placement of the image stored under @image_id from the
+ * screen. The image data is kept, so it can be placed again.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(delete_kitty_image_placements_v1, DELETE_KITTY_IMAGE_PLACEMENTS_V1, 1, none, guint, CHAFA_TERM_SEQ_ARGS guint image_id)
+
+/**
+ * chafa_term_info_emit_delete_kitty_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @image_id: Image ID in the range [1..9999]
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * Removes every placement of the image stored under @image_id and frees
+ * its data in the terminal.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(delete_kitty_image_v1, DELETE_KITTY_IMAGE_V1, 1, none, guint, CHAFA_TERM_SEQ_ARGS guint image_id)
+
+/**
+ * chafa_term_info_emit_begin_kitty_update_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @image_id: Image ID in the range [1..9999]
+ * @bpp: Bits per pixel
+ * @x: Left edge of the updated rectangle, in pixels
+ * @y: Top edge of the updated rectangle, in pixels
+ * @width_pixels: Width of the updated rectangle in pixels
+ * @height_pixels: Height of the updated rectangle in pixels
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * This works like #CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1, except
+ * the transferred pixels replace a rectangle of the image already stored
+ * under @image_id. Placements of the image are updated to match.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_kitty_update_image_v1, BEGIN_KITTY_UPDATE_IMAGE_V1, 6, none, guint, CHAFA_TERM_SEQ_ARGS guint image_id, guint bpp, guint x, guint y, guint width_pixels, guint height_pixels)
+
+/**
+ * chafa_term_info_emit_begin_kitty_update_compressed_image_v1:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ * @image_id: Image ID in the range [1..9999]
+ * @bpp: Bits per pixel
+ * @x: Left edge of the updated rectangle, in pixels
+ * @y: Top edge of the updated rectangle, in pixels
+ * @width_pixels: Width of the updated rectangle in pixels
+ * @height_pixels: Height of the updated rectangle in pixels
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_COMPRESSED_IMAGE_V1.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * This works like #CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_IMAGE_V1, except
+ * the image data must be compressed with zlib (RFC 1950) before it is
+ * base-64 encoded and split into chunks.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_kitty_update_compressed_image_v1, BEGIN_KITTY_UPDATE_COMPRESSED_IMAGE_V1, 6, none, guint, CHAFA_TERM_SEQ_ARGS guint image_id, guint bpp, guint x, guint y, guint width_pixels, guint height_pixels)
+
+/**
+ * chafa_term_info_emit_begin_synchronized_update:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_BEGIN_SYNCHRONIZED_UPDATE.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * The terminal will hold off on repainting the screen until
+ * #CHAFA_TERM_SEQ_END_SYNCHRONIZED_UPDATE is received, so output between
+ * the two is shown all at once. This is DEC private mode 2026.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(begin_synchronized_update, BEGIN_SYNCHRONIZED_UPDATE, 0, none, char)
+
+/**
+ * chafa_term_info_emit_end_synchronized_update:
+ * @term_info: A #ChafaTermInfo
+ * @dest: String destination
+ *
+ * Prints the control sequence for #CHAFA_TERM_SEQ_END_SYNCHRONIZED_UPDATE.
+ *
+ * @dest must have enough space to hold
+ * #CHAFA_TERM_SEQ_LENGTH_MAX bytes, even if the emitted sequence is
+ * shorter. The output will not be zero-terminated.
+ *
+ * Returns: Pointer to first byte after emitted string
+ *
+ * Since: 1.14
+ **/
+CHAFA_TERM_SEQ_DEF(end_synchronized_update, END_SYNCHRONIZED_UPDATE, 0, none, char)
+
 #undef CHAFA_TERM_SEQ_AVAILABILITY
 
 #undef CHAFA_TERM_SEQ_ARGS
@@ -0,0 +1,467 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <string.h>
+#include <immintrin.h>
+#include "chafa.h"
+#include "internal/chafa-private.h"
+
+/* A work cell's 64 pixels fit in eight 256-bit registers, eight pixels each.
+ * A symbol's shape is expanded to matching per-pixel masks, either from its
+ * coverage bytes or straight from its bitmap. */
+#define N_PIXEL_VECS (CHAFA_SYMBOL_N_PIXELS / 8)
+
+static inline void
+load_pixels (const ChafaPixel *pixels, __m256i *pv)
+{
+    gint i;
+
+    for (i = 0; i < N_PIXEL_VECS; i++)
+        pv [i] = _mm256_loadu_si256 ((const __m256i *) (pixels + i * 8));
+}
+
+static inline void
+cov_to_masks (const guint8 *cov, __m256i *masks)
+{
+    gint i;
+
+    for (i = 0; i < N_PIXEL_VECS; i++)
+    {
+        __m256i c = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i *) (cov + i * 8)));
+        masks [i] = _mm256_cmpgt_epi32 (c, _mm256_setzero_si256 ());
+    }
+}
+
+/* The bitmap's most significant byte is the top row, with the leftmost
+ * pixel in the most significant bit. Each row is broadcast and tested
+ * against one bit per lane. This avoids touching the coverage array. */
+static inline void
+bitmap_to_masks (guint64 bitmap, __m256i *masks)
+{
+    const __m256i bits = _mm256_setr_epi32 (0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+    gint i;
+
+    for (i = 0; i < N_PIXEL_VECS; i++)
+    {
+        __m256i row = _mm256_set1_epi32 ((gint) ((bitmap >> (56 - i * 8)) & 0xff));
+        masks [i] = _mm256_cmpeq_epi32 (_mm256_and_si256 (row, bits), bits);
+    }
+}
+
+/* Sums the channels of eight pixels into 16-bit lanes, four pixels' worth */
+static inline __m256i
+widen_sum_pixels (__m256i v)
+{
+    return _mm256_add_epi16 (_mm256_unpacklo_epi8 (v, _mm256_setzero_si256 ()),
+                             _mm256_unpackhi_epi8 (v, _mm256_setzero_si256 ()));
+}
+
+/* Folds 16-bit lanes holding four pixels' worth of channel sums into one */
+static inline __m128i
+fold_channel_sums (__m256i v)
+{
+    __m128i s;
+
+    s = _mm_add_epi16 (_mm256_castsi256_si128 (v), _mm256_extracti128_si256 (v, 1));
+    return _mm_add_epi16 (s, _mm_srli_si128 (s, 8));
+}
+
+static inline __m128i
+sum_pixels (const __m256i *pv)
+{
+    __m256i acc = _mm256_setzero_si256 ();
+    gint i;
+
+    for (i = 0; i < N_PIXEL_VECS; i++)
+        acc = _mm256_add_epi16 (acc, widen_sum_pixels (pv [i]));
+
+    return fold_channel_sums (acc);
+}
+
+/* Fills accums [0] with the sum of uncovered (bg) pixels and accums [1] with
+ * the sum of covered (fg) pixels */
+static inline void
+calc_accums (const __m256i *pv, __m128i total, const __m256i *masks, ChafaColorAccum *accums)
+{
+    __m256i acc = _mm256_setzero_si256 ();
+    __m128i fg;
+    gint i;
+
+    for (i = 0; i < N_PIXEL_VECS; i++)
+        acc = _mm256_add_epi16 (acc, widen_sum_pixels (_mm256_and_si256 (pv [i], masks [i])));
+
+    fg = fold_channel_sums (acc);
+    _mm_storel_epi64 ((__m128i *) &accums [0], _mm_sub_epi16 (total, fg));
+    _mm_storel_epi64 ((__m128i *) &accums [1], fg);
+}
+
+/* pv must have the alpha channel masked out */
+static inline gint
+calc_error (const __m256i *pv, const ChafaColorPair *color_pair, const __m256i *masks)
+{
+    const __m256i rgb_mask = _mm256_set1_epi32 (0x00ffffff);
+    const __m256i zero = _mm256_setzero_si256 ();
+    __m256i fg, bg;
+    __m256i err = _mm256_setzero_si256 ();
+    __m128i s;
+    guint32 u32;
+    gint i;
+
+    memcpy (&u32, &color_pair->colors [CHAFA_COLOR_PAIR_FG], sizeof (u32));
+    fg = _mm256_and_si256 (_mm256_set1_epi32 (u32), rgb_mask);
+    memcpy (&u32, &color_pair->colors [CHAFA_COLOR_PAIR_BG], sizeof (u32));
+    bg = _mm256_and_si256 (_mm256_set1_epi32 (u32), rgb_mask);
+
+    for (i = 0; i < N_PIXEL_VECS; i++)
+    {
+        __m256i c, d;
+
+        c = _mm256_blendv_epi8 (bg, fg, masks [i]);
+
+        d = _mm256_sub_epi16 (_mm256_unpacklo_epi8 (pv [i], zero), _mm256_unpacklo_epi8 (c, zero));
+        err = _mm256_add_epi32 (err, _mm256_madd_epi16 (d, d));
+        d = _mm256_sub_epi16 (_mm256_unpackhi_epi8 (pv [i], zero), _mm256_unpackhi_epi8 (c, zero));
+        err = _mm256_add_epi32 (err, _mm256_madd_epi16 (d, d));
+    }
+
+    s = _mm_add_epi32 (_mm256_castsi256_si128 (err), _mm256_extracti128_si256 (err, 1));
+    s = _mm_add_epi32 (s, _mm_srli_si128 (s, 8));
+    s = _mm_add_epi32 (s, _mm_srli_si128 (s, 4));
+
+    return _mm_cvtsi128_si32 (s);
+}
+
+static inline void
+mask_alpha (__m256i *pv)
+{
+    const __m256i rgb_mask = _mm256_set1_epi32 (0x00ffffff);
+    gint i;
+
+    for (i = 0; i < N_PIXEL_VECS; i++)
+        pv [i] = _mm256_and_si256 (pv [i], rgb_mask);
+}
+
+static inline void
+accum_to_color (const ChafaColorAccum *accum, ChafaColor *color)
+{
+    gint i;
+
+    for (i = 0; i < 4; i++)
+        color->ch [i] = accum->ch [i];
+}
+
+/* Takes the symbol's bitmap instead of its coverage bytes */
+void
+calc_colors_bitmap_avx2 (const ChafaPixel *pixels, ChafaColorAccum *accums_out, guint64 bitmap)
+{
+    __m256i pv [N_PIXEL_VECS];
+    __m256i masks [N_PIXEL_VECS];
+
+    load_pixels (pixels, pv);
+    bitmap_to_masks (bitmap, masks);
+    calc_accums (pv, sum_pixels (pv), masks, accums_out);
+}
+
+gint
+calc_error_avx2 (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov)
+{
+    __m256i pv [N_PIXEL_VECS];
+    __m256i masks [N_PIXEL_VECS];
+
+    load_pixels (pixels, pv);
+    mask_alpha (pv);
+    cov_to_masks (cov, masks);
+    return calc_error (pv, color_pair, masks);
+}
+
+/* Finds the mean colors and resulting error for each candidate symbol in one
+ * pass. The pixels are only loaded once, and the pixel sum is shared. Results
+ * are identical to chafa_work_cell_get_mean_colors_for_symbol () followed by
+ * calc_error_avx2 ().
+ *
+ * Since no later candidate can beat a perfect match, this stops after the
+ * first one with zero error. Returns the number of candidates evaluated. */
+gint
+chafa_eval_symbols_mean_avx2 (const ChafaPixel *pixels, const ChafaSymbol *symbols,
+                              const ChafaCandidate *candidates, gint n_candidates,
+                              ChafaColorPair *pairs_out, gint *errors_out)
+{
+    __m256i pv [N_PIXEL_VECS];
+    __m256i pv_rgb [N_PIXEL_VECS];
+    __m128i total;
+    gint i;
+
+    load_pixels (pixels, pv);
+    memcpy (pv_rgb, pv, sizeof (pv));
+    mask_alpha (pv_rgb);
+    total = sum_pixels (pv);
+
+    for (i = 0; i < n_candidates; i++)
+    {
+        const ChafaSymbol *sym = &symbols [candidates [i].symbol_index];
+        __m256i masks [N_PIXEL_VECS];
+        ChafaColorAccum accums [2];
+
+        /* The masks are shared by both steps */
+        bitmap_to_masks (sym->bitmap, masks);
+        calc_accums (pv, total, masks, accums);
+
+        if (sym->fg_weight > 1)
+            chafa_color_accum_div_scalar (&accums [1], sym->fg_weight);
+        if (sym->bg_weight > 1)
+            chafa_color_accum_div_scalar (&accums [0], sym->bg_weight);
+
+        accum_to_color (&accums [0], &pairs_out [i].colors [CHAFA_COLOR_PAIR_BG]);
+        accum_to_color (&accums [1], &pairs_out [i].colors [CHAFA_COLOR_PAIR_FG]);
+
+        errors_out [i] = calc_error (pv_rgb, &pairs_out [i], masks);
+        if (errors_out [i] == 0)
+            return i + 1;
+    }
+
+    return n_candidates;
+}
+
+/* Like chafa_work_cell_to_bitmap (), sixteen pixels at a time from the
+ * channel planes. Each pixel's red and green are paired up as 16-bit
+ * values so a single madd applies both weights, giving exact 32-bit dot
+ * products. The lanes are reversed before the movemask, since the bitmap
+ * has the first pixel in its most significant bit. */
+guint64
+chafa_work_cell_to_bitmap_avx2 (const guint8 *plane_r, const guint8 *plane_g, const guint8 *plane_b,
+                                const ChafaColorPair *color_pair)
+{
+    const ChafaColor *col_a = &color_pair->colors [0];
+    const ChafaColor *col_b = &color_pair->colors [1];
+    const __m256i reverse = _mm256_setr_epi32 (7, 6, 5, 4, 3, 2, 1, 0);
+    __m256i w_rg, w_b, bias;
+    guint64 bitmap = 0;
+    gint c = 0, ch, i, j;
+
+    for (ch = 0; ch < 3; ch++)
+        c += col_a->ch [ch] * col_a->ch [ch] - col_b->ch [ch] * col_b->ch [ch];
+
+    w_rg = _mm256_set1_epi32 ((guint16) (2 * (col_b->ch [0] - col_a->ch [0]))
+                              | ((guint32) (guint16) (2 * (col_b->ch [1] - col_a->ch [1])) << 16));
+    w_b = _mm256_set1_epi32 ((guint16) (2 * (col_b->ch [2] - col_a->ch [2])));
+    bias = _mm256_set1_epi32 (c);
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i += 16)
+    {
+        __m128i r = _mm_loadu_si128 ((const __m128i *) (plane_r + i));
+        __m128i g = _mm_loadu_si128 ((const __m128i *) (plane_g + i));
+        __m128i b = _mm_loadu_si128 ((const __m128i *) (plane_b + i));
+        __m128i rg [2], b0 [2];
+
+        rg [0] = _mm_unpacklo_epi8 (r, g);
+        rg [1] = _mm_unpackhi_epi8 (r, g);
+        b0 [0] = _mm_unpacklo_epi8 (b, _mm_setzero_si128 ());
+        b0 [1] = _mm_unpackhi_epi8 (b, _mm_setzero_si128 ());
+
+        for (j = 0; j < 2; j++)
+        {
+            __m256i d;
+
+            d = _mm256_add_epi32 (_mm256_madd_epi16 (_mm256_cvtepu8_epi16 (rg [j]), w_rg),
+                                  _mm256_madd_epi16 (_mm256_cvtepu8_epi16 (b0 [j]), w_b));
+            d = _mm256_add_epi32 (d, bias);
+            d = _mm256_cmpgt_epi32 (d, _mm256_setzero_si256 ());
+            d = _mm256_permutevar8x32_epi32 (d, reverse);
+
+            bitmap = (bitmap << 8)
+                | (guint) _mm256_movemask_ps (_mm256_castsi256_ps (d));
+        }
+    }
+
+    return bitmap;
+}
+
+/* Per-byte popcount using a nibble lookup table (Mula's method). The result
+ * is summed per 64-bit lane. */
+static inline __m256i
+popcount_epi64_avx2 (__m256i v)
+{
+    const __m256i lut = _mm256_setr_epi8 (0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                          0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8 (0x0f);
+    __m256i lo, hi, cnt;
+
+    lo = _mm256_and_si256 (v, low_mask);
+    hi = _mm256_and_si256 (_mm256_srli_epi16 (v, 4), low_mask);
+    cnt = _mm256_add_epi8 (_mm256_shuffle_epi8 (lut, lo),
+                           _mm256_shuffle_epi8 (lut, hi));
+
+    return _mm256_sad_epu8 (cnt, _mm256_setzero_si256 ());
+}
+
+void
+chafa_hamming_distance_vu64_avx2 (guint64 a, const guint64 *vb, gint *vc, gint n)
+{
+    const __m256i av = _mm256_set1_epi64x (a);
+    const __m256i pack_idx = _mm256_setr_epi32 (0, 2, 4, 6, 0, 2, 4, 6);
+
+    while (n >= 8)
+    {
+        __m256i c0, c1;
+
+        c0 = popcount_epi64_avx2 (_mm256_xor_si256 (av, _mm256_loadu_si256 ((const __m256i *) vb)));
+        c1 = popcount_epi64_avx2 (_mm256_xor_si256 (av, _mm256_loadu_si256 ((const __m256i *) (vb + 4))));
+
+        /* Counts fit in the low 32 bits of each lane */
+        c0 = _mm256_permutevar8x32_epi32 (c0, pack_idx);
+        c1 = _mm256_permutevar8x32_epi32 (c1, pack_idx);
+        _mm256_storeu_si256 ((__m256i *) vc, _mm256_permute2x128_si256 (c0, c1, 0x20));
+
+        vb += 8;
+        vc += 8;
+        n -= 8;
+    }
+
+    while (n--)
+        *(vc++) = chafa_slow_pop_count (a ^ *(vb++));
+}
+
+/* Two bitmaps per item (a points to a pair, vb points to array of pairs) */
+void
+chafa_hamming_distance_2_vu64_avx2 (const guint64 *a, const guint64 *vb, gint *vc, gint n)
+{
+    const __m256i av = _mm256_setr_epi64x (a [0], a [1], a [0], a [1]);
+    const __m256i pack_idx = _mm256_setr_epi32 (0, 4, 1, 5, 0, 4, 1, 5);
+
+    while (n >= 4)
+    {
+        __m256i c0, c1;
+
+        c0 = popcount_epi64_avx2 (_mm256_xor_si256 (av, _mm256_loadu_si256 ((const __m256i *) vb)));
+        c1 = popcount_epi64_avx2 (_mm256_xor_si256 (av, _mm256_loadu_si256 ((const __m256i *) (vb + 4))));
+
+        /* Add the two halves of each pair; the sums end up in lanes 0 and 2 */
+        c0 = _mm256_add_epi64 (c0, _mm256_shuffle_epi32 (c0, 0x4e));
+        c1 = _mm256_add_epi64 (c1, _mm256_shuffle_epi32 (c1, 0x4e));
+
+        /* Interleave as [c0.0, c1.0, -, -, c0.2, c1.2, -, -], then reorder */
+        c0 = _mm256_blend_epi32 (c0, _mm256_slli_epi64 (c1, 32), 0x22);
+        c0 = _mm256_permutevar8x32_epi32 (c0, pack_idx);
+        _mm_storeu_si128 ((__m128i *) vc, _mm256_castsi256_si128 (c0));
+
+        vb += 8;
+        vc += 4;
+        n -= 4;
+    }
+
+    while (n--)
+    {
+        *(vc++) = chafa_slow_pop_count (a [0] ^ vb [0])
+            + chafa_slow_pop_count (a [1] ^ vb [1]);
+        vb += 2;
+    }
+}
+
+/* Base64 encoding; see chafa-sse41.c. This is the same algorithm with two
+ * 12-byte groups per iteration, one in each 128-bit lane. */
+
+static inline __m256i
+base64_reshuffle (__m256i in)
+{
+    __m256i t0, t1, t2, t3;
+
+    in = _mm256_shuffle_epi8 (in, _mm256_set_epi8 (10, 11, 9, 10, 7, 8, 6, 7,
+                                                   4, 5, 3, 4, 1, 2, 0, 1,
+                                                   10, 11, 9, 10, 7, 8, 6, 7,
+                                                   4, 5, 3, 4, 1, 2, 0, 1));
+
+    t0 = _mm256_and_si256 (in, _mm256_set1_epi32 (0x0fc0fc00));
+    t1 = _mm256_mulhi_epu16 (t0, _mm256_set1_epi32 (0x04000040));
+    t2 = _mm256_and_si256 (in, _mm256_set1_epi32 (0x003f03f0));
+    t3 = _mm256_mullo_epi16 (t2, _mm256_set1_epi32 (0x01000010));
+
+    return _mm256_or_si256 (t1, t3);
+}
+
+static inline __m256i
+base64_translate (__m256i in)
+{
+    const __m256i offsets = _mm256_setr_epi8 ('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                              '/' - 63, 'A', 0, 0,
+                                              'a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                              '/' - 63, 'A', 0, 0);
+    __m256i r, less;
+
+    r = _mm256_subs_epu8 (in, _mm256_set1_epi8 (51));
+    less = _mm256_cmpgt_epi8 (_mm256_set1_epi8 (26), in);
+    r = _mm256_or_si256 (r, _mm256_and_si256 (less, _mm256_set1_epi8 (13)));
+
+    return _mm256_add_epi8 (_mm256_shuffle_epi8 (offsets, r), in);
+}
+
+gsize
+chafa_base64_encode_avx2 (gchar *out, const guint8 *in, gsize in_len)
+{
+    const guint8 *p = in;
+
+    /* The upper lane's load ends 28 bytes in, of which 24 are consumed */
+    while (in_len - (p - in) >= 28)
+    {
+        __m256i v;
+
+        v = _mm256_inserti128_si256 (_mm256_castsi128_si256 (_mm_loadu_si128 ((const __m128i *) p)),
+                                     _mm_loadu_si128 ((const __m128i *) (p + 12)), 1);
+        v = base64_translate (base64_reshuffle (v));
+        _mm256_storeu_si256 ((__m256i *) out, v);
+
+        p += 24;
+        out += 32;
+    }
+
+    return p - in;
+}
+
+/* Adds a row of per-channel ordered dither offsets to pixels, saturating to
+ * [0..255]. Eight pixels are widened to 16 bits per channel at a time. Both
+ * arrays must be 32-byte aligned and width a multiple of eight, which is how
+ * chafa_dither_row_ordered () hands them over. */
+void
+chafa_apply_dither_row_avx2 (ChafaPixel *pixels, const gint16 *mods, gint width)
+{
+    gint x;
+
+    for (x = 0; x < width; x += 8)
+    {
+        __m256i p, lo, hi;
+
+        p = _mm256_load_si256 ((const __m256i *) (pixels + x));
+
+        lo = _mm256_cvtepu8_epi16 (_mm256_castsi256_si128 (p));
+        hi = _mm256_cvtepu8_epi16 (_mm256_extracti128_si256 (p, 1));
+        lo = _mm256_add_epi16 (lo, _mm256_load_si256 ((const __m256i *) (mods + x * 4)));
+        hi = _mm256_add_epi16 (hi, _mm256_load_si256 ((const __m256i *) (mods + x * 4 + 16)));
+
+        /* Packing works within 128-bit lanes, leaving pixel pairs out of order */
+        p = _mm256_packus_epi16 (lo, hi);
+        p = _mm256_permute4x64_epi64 (p, _MM_SHUFFLE (3, 1, 2, 0));
+
+        _mm256_store_si256 ((__m256i *) (pixels + x), p);
+    }
+}
@@ -0,0 +1,94 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <immintrin.h>
+#include "chafa.h"
+#include "internal/chafa-private.h"
+
+void
+chafa_hamming_distance_vu64_avx512_popcnt (guint64 a, const guint64 *vb, gint *vc, gint n)
+{
+    const __m512i av = _mm512_set1_epi64 (a);
+
+    while (n >= 8)
+    {
+        __m512i c = _mm512_popcnt_epi64 (_mm512_xor_si512 (av, _mm512_loadu_si512 (vb)));
+
+        _mm256_storeu_si256 ((__m256i *) vc, _mm512_cvtepi64_epi32 (c));
+
+        vb += 8;
+        vc += 8;
+        n -= 8;
+    }
+
+    if (n > 0)
+    {
+        __mmask8 mask = (1 << n) - 1;
+        __m512i c = _mm512_popcnt_epi64 (_mm512_xor_si512 (av, _mm512_maskz_loadu_epi64 (mask, vb)));
+
+        _mm512_mask_cvtepi64_storeu_epi32 (vc, mask, c);
+    }
+}
+
+/* Two bitmaps per item (a points to a pair, vb points to array of pairs) */
+void
+chafa_hamming_distance_2_vu64_avx512_popcnt (const guint64 *a, const guint64 *vb, gint *vc, gint n)
+{
+    const __m512i av = _mm512_set4_epi64 (a [1], a [0], a [1], a [0]);
+    const __m512i even_idx = _mm512_setr_epi64 (0, 2, 4, 6, 8, 10, 12, 14);
+
+    while (n >= 8)
+    {
+        __m512i c0, c1;
+
+        c0 = _mm512_popcnt_epi64 (_mm512_xor_si512 (av, _mm512_loadu_si512 (vb)));
+        c1 = _mm512_popcnt_epi64 (_mm512_xor_si512 (av, _mm512_loadu_si512 (vb + 8)));
+
+        /* Add the two halves of each pair; the sums end up in even lanes */
+        c0 = _mm512_add_epi64 (c0, _mm512_shuffle_epi32 (c0, _MM_PERM_BADC));
+        c1 = _mm512_add_epi64 (c1, _mm512_shuffle_epi32 (c1, _MM_PERM_BADC));
+
+        c0 = _mm512_permutex2var_epi64 (c0, even_idx, c1);
+        _mm256_storeu_si256 ((__m256i *) vc, _mm512_cvtepi64_epi32 (c0));
+
+        vb += 16;
+        vc += 8;
+        n -= 8;
+    }
+
+    while (n > 0)
+    {
+        gint m = MIN (n, 4);
+        __mmask8 mask = (1 << (m * 2)) - 1;
+        __m512i c;
+        gint64 sums [8];
+        gint i;
+
+        c = _mm512_popcnt_epi64 (_mm512_xor_si512 (av, _mm512_maskz_loadu_epi64 (mask, vb)));
+        _mm512_storeu_si512 (sums, c);
+
+        for (i = 0; i < m; i++)
+            *(vc++) = sums [i * 2] + sums [i * 2 + 1];
+
+        vb += m * 2;
+        n -= m;
+    }
+}
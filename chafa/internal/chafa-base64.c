@@ -24,6 +24,7 @@
 
 #include "chafa.h"
 #include "internal/chafa-base64.h"
+#include "internal/chafa-private.h"
 
 static const gchar base64_dict [] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -43,13 +44,14 @@ chafa_base64_deinit (ChafaBase64 *base64)
     base64->buf_len = -1;
 }
 
-static void
-encode_3_bytes (GString *gs_out, guint32 bytes)
+static inline gchar *
+encode_3_bytes (gchar *out, guint32 bytes)
 {
-    g_string_append_c (gs_out, base64_dict [(bytes >> (3 * 6)) & 0x3f]);
-    g_string_append_c (gs_out, base64_dict [(bytes >> (2 * 6)) & 0x3f]);
-    g_string_append_c (gs_out, base64_dict [(bytes >> (1 * 6)) & 0x3f]);
-    g_string_append_c (gs_out, base64_dict [bytes & 0x3f]);
+    *(out++) = base64_dict [(bytes >> (3 * 6)) & 0x3f];
+    *(out++) = base64_dict [(bytes >> (2 * 6)) & 0x3f];
+    *(out++) = base64_dict [(bytes >> (1 * 6)) & 0x3f];
+    *(out++) = base64_dict [bytes & 0x3f];
+    return out;
 }
 
 void
@@ -57,6 +59,8 @@ chafa_base64_encode (ChafaBase64 *base64, GString *gs_out, gconstpointer in, gin
 {
     const guint8 *in_u8 = in;
     const guint8 *end_u8 = in_u8 + in_len;
+    gsize out_ofs;
+    gchar *out;
     guint32 r;
 
     if (base64->buf_len + in_len < 3)
@@ -66,25 +70,50 @@ chafa_base64_encode (ChafaBase64 *base64, GString *gs_out, gconstpointer in, gin
         return;
     }
 
+    /* Make room for all the complete groups up front, so we can write
+     * straight into the string */
+    out_ofs = gs_out->len;
+    g_string_set_size (gs_out, out_ofs + ((base64->buf_len + in_len) / 3) * 4);
+    out = gs_out->str + out_ofs;
+
     if (base64->buf_len == 1)
     {
         r = (base64->buf [0] << 16) | (in_u8 [0] << 8) | in_u8 [1];
         in_u8 += 2;
-        encode_3_bytes (gs_out, r);
+        out = encode_3_bytes (out, r);
     }
     else if (base64->buf_len == 2)
     {
         r = (base64->buf [0] << 16) | (base64->buf [1] << 8) | in_u8 [0];
         in_u8++;
-        encode_3_bytes (gs_out, r);
+        out = encode_3_bytes (out, r);
     }
 
     base64->buf_len = 0;
 
+    /* The SIMD paths leave a tail of up to 27 bytes for the next one */
+#ifdef HAVE_AVX2_INTRINSICS
+    if (chafa_have_avx2 ())
+    {
+        gsize n = chafa_base64_encode_avx2 (out, in_u8, end_u8 - in_u8);
+        in_u8 += n;
+        out += (n / 3) * 4;
+    }
+#endif
+
+#ifdef HAVE_SSE41_INTRINSICS
+    if (chafa_have_sse41 ())
+    {
+        gsize n = chafa_base64_encode_sse41 (out, in_u8, end_u8 - in_u8);
+        in_u8 += n;
+        out += (n / 3) * 4;
+    }
+#endif
+
     while (end_u8 - in_u8 >= 3)
     {
         r = (in_u8 [0] << 16) | (in_u8 [1] << 8) | in_u8 [2];
-        encode_3_bytes (gs_out, r);
+        out = encode_3_bytes (out, r);
         in_u8 += 3;
     }
 
@@ -107,7 +136,7 @@ chafa_base64_encode_end (ChafaBase64 *base64, GString *gs_out)
     {
         g_string_append_c (gs_out, base64_dict [base64->buf [0] >> 2]);
         g_string_append_c (gs_out, base64_dict [((base64->buf [0] << 4) | (base64->buf [1] >> 4)) & 0x3f]);
-        g_string_append_c (gs_out, base64_dict [base64->buf [1] & 0x0f]);
+        g_string_append_c (gs_out, base64_dict [(base64->buf [1] << 2) & 0x3c]);
         g_string_append_c (gs_out, '=');
     }
 }
@@ -19,17 +19,451 @@
 
 #include "config.h"
 
+#include <stdlib.h>
 #include <string.h>
 #include <glib.h>
 
+#ifdef HAVE_SCHED_SETAFFINITY
+# include <sched.h>
+#endif
+
 #include "chafa.h"
 #include "internal/chafa-batch.h"
+#include "internal/chafa-trace.h"
+
+/* A job is one call to chafa_process_batches (). The caller and any number
+ * of pool workers claim batches from it until none are left. Workers may
+ * pick up a job after the caller has finished it, so it's refcounted and
+ * the last user frees it.
+ *
+ * Finished batches are flagged in batch_done, so the caller can hand them
+ * to post_func in order while later batches are still being worked on. */
+typedef struct
+{
+    gint refs;
+
+    gpointer ctx;
+    const gchar *name;
+    GFunc batch_func;
+    ChafaBatchInfo *batches;
+    guint8 *batch_done;
+    gint n_batches;
+
+    gint next_batch;
+    gint n_batches_remaining;
+
+    /* Summed time spent in batch_func, for tuning. Pointer-sized so it
+     * can be updated atomically. */
+    gssize work_us;
+
+    GMutex mutex;
+    GCond cond;
+}
+ChafaBatchJob;
+
+/* When the cost per row is uneven, we split the work into this many batches
+ * per thread. Threads that finish early keep claiming batches from the shared
+ * counter, so a few expensive rows no longer hold up the whole job. */
+#define DYNAMIC_BATCHES_PER_THREAD 8
+
+/* With an automatic thread count, each batch function is treated as a
+ * stage, and we keep a running estimate of its cost per row. Small jobs
+ * then use fewer threads; waking one up only pays off if it gets at least
+ * THREAD_MIN_WORK_US of work. Likewise, dynamic batches are kept above
+ * BATCH_MIN_WORK_US so claiming them doesn't dominate. */
+#define THREAD_MIN_WORK_US 100
+#define BATCH_MIN_WORK_US 20
+#define N_TUNED_STAGES_MAX 32
+
+typedef struct
+{
+    GFunc batch_func;
+
+    /* In nanoseconds, smoothed over calls */
+    gint64 row_cost_ns;
+}
+TunedStage;
+
+static TunedStage tuned_stages [N_TUNED_STAGES_MAX];
+static gint n_tuned_stages;
+static GMutex tuning_mutex;
+
+/* Process-wide pool. Threads are exclusive to it, so they stay around between
+ * jobs instead of being created and joined per call. */
+static GThreadPool *thread_pool;
+static gint thread_pool_max_threads;
+static GMutex thread_pool_mutex;
+
+/* Workers check the affinity serial before each job, and re-pin themselves
+ * if it changed since they last looked. Each worker gets a fixed index the
+ * first time it's pinned, which decides where it goes. The index is stored
+ * plus one and the serial starts at one, so NULL means unset. */
+static gint thread_affinity = CHAFA_THREAD_AFFINITY_NONE;
+static gint thread_affinity_serial = 1;
+static gint n_indexed_workers;
+static GPrivate worker_index_key = G_PRIVATE_INIT (NULL);
+static GPrivate worker_serial_key = G_PRIVATE_INIT (NULL);
+
+#ifdef HAVE_SCHED_SETAFFINITY
+
+/* CPUs we were allowed to run on at startup, and the subset belonging to
+ * each NUMA node. Without node information, everything is one node. */
+typedef struct
+{
+    cpu_set_t allowed;
+    gint *cpus;
+    gint n_cpus;
+    cpu_set_t *nodes;
+    gint n_nodes;
+}
+CpuTopology;
+
+static CpuTopology topology;
+
+/* Parses a list like "0-7,16-23" into set */
+static void
+parse_cpu_list (const gchar *list, cpu_set_t *set)
+{
+    const gchar *p = list;
+
+    CPU_ZERO (set);
+
+    while (*p)
+    {
+        gchar *end;
+        glong first, last;
+
+        first = last = strtol (p, &end, 10);
+        if (end == p)
+            break;
+        p = end;
+
+        if (*p == '-')
+        {
+            p++;
+            last = strtol (p, &end, 10);
+            if (end == p)
+                break;
+            p = end;
+        }
+
+        for ( ; first <= last && first < CPU_SETSIZE; first++)
+            if (first >= 0)
+                CPU_SET (first, set);
+
+        if (*p != ',')
+            break;
+        p++;
+    }
+}
+
+static void
+init_topology (void)
+{
+    GArray *nodes;
+    GDir *dir;
+    const gchar *name;
+    gint i;
+
+    if (sched_getaffinity (0, sizeof (cpu_set_t), &topology.allowed) != 0)
+    {
+        CPU_ZERO (&topology.allowed);
+        CPU_SET (0, &topology.allowed);
+    }
+
+    topology.cpus = g_new (gint, CPU_COUNT (&topology.allowed));
+    for (i = 0; i < CPU_SETSIZE; i++)
+        if (CPU_ISSET (i, &topology.allowed))
+            topology.cpus [topology.n_cpus++] = i;
+
+    nodes = g_array_new (FALSE, FALSE, sizeof (cpu_set_t));
+    dir = g_dir_open ("/sys/devices/system/node", 0, NULL);
+
+    while (dir && (name = g_dir_read_name (dir)))
+    {
+        gchar *path, *contents;
+        cpu_set_t set;
+
+        if (strncmp (name, "node", 4) || !g_ascii_isdigit (name [4]))
+            continue;
+
+        path = g_build_filename ("/sys/devices/system/node", name, "cpulist", NULL);
+
+        if (g_file_get_contents (path, &contents, NULL, NULL))
+        {
+            parse_cpu_list (contents, &set);
+            CPU_AND (&set, &set, &topology.allowed);
+            if (CPU_COUNT (&set) > 0)
+                g_array_append_val (nodes, set);
+            g_free (contents);
+        }
+
+        g_free (path);
+    }
+
+    if (dir)
+        g_dir_close (dir);
+
+    if (nodes->len == 0)
+        g_array_append_val (nodes, topology.allowed);
+
+    topology.n_nodes = nodes->len;
+    topology.nodes = (cpu_set_t *) g_array_free (nodes, FALSE);
+}
+
+/* The calling thread of a job isn't ours to pin, so workers start at the
+ * second core and leave the first to it */
+static void
+pin_worker (gint index, ChafaThreadAffinity affinity)
+{
+    static gsize topology_initialized;
+    cpu_set_t set;
+
+    if (g_once_init_enter (&topology_initialized))
+    {
+        init_topology ();
+        g_once_init_leave (&topology_initialized, 1);
+    }
+
+    switch (affinity)
+    {
+        case CHAFA_THREAD_AFFINITY_CORES:
+            CPU_ZERO (&set);
+            CPU_SET (topology.cpus [(index + 1) % topology.n_cpus], &set);
+            break;
+        case CHAFA_THREAD_AFFINITY_NODES:
+            set = topology.nodes [index % topology.n_nodes];
+            break;
+        default:
+            set = topology.allowed;
+            break;
+    }
+
+    sched_setaffinity (0, sizeof (cpu_set_t), &set);
+}
+
+#else
+
+static void
+pin_worker (G_GNUC_UNUSED gint index, G_GNUC_UNUSED ChafaThreadAffinity affinity)
+{
+}
+
+#endif
+
+static void
+update_worker_affinity (void)
+{
+    gint serial = g_atomic_int_get (&thread_affinity_serial);
+    ChafaThreadAffinity affinity;
+    gint index;
+
+    if (GPOINTER_TO_INT (g_private_get (&worker_serial_key)) == serial)
+        return;
+
+    g_private_set (&worker_serial_key, GINT_TO_POINTER (serial));
+    affinity = g_atomic_int_get (&thread_affinity);
+    index = GPOINTER_TO_INT (g_private_get (&worker_index_key)) - 1;
+
+    /* Workers that were never pinned have nothing to undo */
+    if (index < 0)
+    {
+        if (affinity == CHAFA_THREAD_AFFINITY_NONE)
+            return;
+
+        index = g_atomic_int_add (&n_indexed_workers, 1);
+        g_private_set (&worker_index_key, GINT_TO_POINTER (index + 1));
+    }
+
+    pin_worker (index, affinity);
+}
+
+static void
+job_unref (ChafaBatchJob *job)
+{
+    if (g_atomic_int_dec_and_test (&job->refs))
+    {
+        g_mutex_clear (&job->mutex);
+        g_cond_clear (&job->cond);
+        g_free (job->batches);
+        g_free (job->batch_done);
+        g_free (job);
+    }
+}
+
+/* Hands finished batches to post_func in order, starting at *n_posted. If
+ * wait is TRUE, blocks until every batch has been posted. Only the calling
+ * thread does this. */
+static void
+post_job_batches (ChafaBatchJob *job, GFunc post_func, gint *n_posted, gboolean wait)
+{
+    while (*n_posted < job->n_batches)
+    {
+        gint i = *n_posted;
+        gboolean done;
+
+        g_mutex_lock (&job->mutex);
+        while (wait && !job->batch_done [i])
+            g_cond_wait (&job->cond, &job->mutex);
+        done = job->batch_done [i];
+        g_mutex_unlock (&job->mutex);
+
+        if (!done)
+            break;
+
+        ((void (*)(ChafaBatchInfo *, gpointer)) post_func) (&job->batches [i], job->ctx);
+        (*n_posted)++;
+    }
+}
+
+/* Returns the estimated cost of n_rows of batch_func, or -1 if unknown or
+ * if the thread count is fixed */
+static gint64
+estimate_work_us (GFunc batch_func, gint n_rows)
+{
+    gint64 work_us = -1;
+    gint i;
+
+    if (chafa_get_n_threads () >= 0)
+        return -1;
+
+    g_mutex_lock (&tuning_mutex);
+
+    for (i = 0; i < n_tuned_stages; i++)
+    {
+        if (tuned_stages [i].batch_func == batch_func)
+        {
+            work_us = tuned_stages [i].row_cost_ns * n_rows / 1000;
+            break;
+        }
+    }
+
+    g_mutex_unlock (&tuning_mutex);
+
+    return work_us;
+}
+
+static void
+record_work_us (GFunc batch_func, gint n_rows, gint64 work_us)
+{
+    gint64 row_cost_ns = work_us * 1000 / n_rows;
+    gint i;
+
+    g_mutex_lock (&tuning_mutex);
+
+    for (i = 0; i < n_tuned_stages; i++)
+    {
+        if (tuned_stages [i].batch_func == batch_func)
+        {
+            tuned_stages [i].row_cost_ns = (tuned_stages [i].row_cost_ns * 3 + row_cost_ns) / 4;
+            break;
+        }
+    }
+
+    if (i == n_tuned_stages && n_tuned_stages < N_TUNED_STAGES_MAX)
+    {
+        tuned_stages [i].batch_func = batch_func;
+        tuned_stages [i].row_cost_ns = row_cost_ns;
+        n_tuned_stages++;
+    }
+
+    g_mutex_unlock (&tuning_mutex);
+}
+
+/* Until a stage has been measured, it gets every thread */
+static gint
+pick_n_threads (gint64 work_us)
+{
+    gint n_threads = chafa_get_n_actual_threads ();
+
+    if (work_us < 0)
+        return n_threads;
+
+    return CLAMP (work_us / THREAD_MIN_WORK_US, 1, n_threads);
+}
+
+static void
+run_batch (ChafaBatchInfo *batch, const gchar *name, GFunc batch_func, gpointer ctx,
+           gssize *work_us)
+{
+    gint64 start_us = g_get_monotonic_time ();
+    gint64 end_us;
 
+    batch_func (batch, ctx);
+
+    end_us = g_get_monotonic_time ();
+    g_atomic_pointer_add (work_us, end_us - start_us);
+    chafa_trace_add_event (name, start_us, end_us, batch->first_row, batch->n_rows);
+}
+
+static void
+run_job_batches (ChafaBatchJob *job, GFunc post_func, gint *n_posted)
+{
+    for (;;)
+    {
+        gint i = g_atomic_int_add (&job->next_batch, 1);
+
+        if (i >= job->n_batches)
+            break;
+
+        run_batch (&job->batches [i], job->name, job->batch_func, job->ctx, &job->work_us);
+
+        g_mutex_lock (&job->mutex);
+        job->batch_done [i] = TRUE;
+        job->n_batches_remaining--;
+        g_cond_signal (&job->cond);
+        g_mutex_unlock (&job->mutex);
+
+        if (post_func)
+            post_job_batches (job, post_func, n_posted, FALSE);
+    }
+}
+
+static void
+pool_worker (ChafaBatchJob *job, G_GNUC_UNUSED gpointer data)
+{
+    update_worker_affinity ();
+    run_job_batches (job, NULL, NULL);
+    job_unref (job);
+}
+
+static GThreadPool *
+get_thread_pool (gint n_threads)
+{
+    GThreadPool *pool;
+
+    g_mutex_lock (&thread_pool_mutex);
+
+    if (!thread_pool)
+    {
+        thread_pool = g_thread_pool_new ((GFunc) pool_worker,
+                                         NULL,
+                                         n_threads,
+                                         TRUE,
+                                         NULL);
+        thread_pool_max_threads = n_threads;
+    }
+    else if (n_threads > thread_pool_max_threads)
+    {
+        g_thread_pool_set_max_threads (thread_pool, n_threads, NULL);
+        thread_pool_max_threads = n_threads;
+    }
+
+    pool = thread_pool;
+    g_mutex_unlock (&thread_pool_mutex);
+
+    return pool;
+}
+
+/* The name identifies the work in traces */
 void
-chafa_process_batches (gpointer ctx, GFunc batch_func, GFunc post_func, gint n_rows, gint n_batches, gint batch_unit)
+chafa_process_batches (gpointer ctx, const gchar *name, GFunc batch_func, GFunc post_func,
+                       gint n_rows, gint n_batches, gint batch_unit)
 {
-    GThreadPool *thread_pool = NULL;
+    ChafaBatchJob *job = NULL;
     ChafaBatchInfo *batches;
+    gssize work_us = 0;
+    gint64 wait_start_us;
     gint n_threads;
     gint n_units;
     gfloat units_per_batch;
@@ -42,19 +476,12 @@ chafa_process_batches (gpointer ctx, GFunc batch_func, GFunc post_func, gint n_r
     if (n_rows < 1)
         return;
 
-    n_threads = MIN (chafa_get_n_actual_threads (), n_batches);
+    n_threads = MIN (pick_n_threads (estimate_work_us (batch_func, n_rows)), n_batches);
     n_units = (n_rows + batch_unit - 1) / batch_unit;
     units_per_batch = (gfloat) n_units / (gfloat) n_batches;
 
     batches = g_new0 (ChafaBatchInfo, n_batches);
 
-    if (n_threads >= 2)
-        thread_pool = g_thread_pool_new (batch_func,
-                                         (gpointer) ctx,
-                                         n_threads,
-                                         FALSE,
-                                         NULL);
-
     /* Divide work up into batches that are multiples of batch_unit, except
      * for the last one (if n_rows is not itself a multiple) */
 
@@ -97,31 +524,155 @@ chafa_process_batches (gpointer ctx, GFunc batch_func, GFunc post_func, gint n_r
         g_printerr ("Batch %d: %04d rows\n", i, batch->n_rows);
 #endif
 
-        if (n_threads >= 2)
-        {
-            g_thread_pool_push (thread_pool, batch, NULL);
-        }
-        else
-        {
-            batch_func (batch, ctx);
-        }
-
         ofs [0] = ofs [1];
     }
 
-    if (n_threads >= 2)
-    {
-        /* Wait for threads to finish */
-        g_thread_pool_free (thread_pool, FALSE, TRUE);
-    }
+    n_threads = MIN (n_threads, n_batches);
 
-    if (post_func)
+    if (n_threads < 2)
     {
         for (i = 0; i < n_batches; i++)
         {
-            ((void (*)(ChafaBatchInfo *, gpointer)) post_func) (&batches [i], ctx);
+            run_batch (&batches [i], name, batch_func, ctx, &work_us);
+
+            if (post_func)
+                ((void (*)(ChafaBatchInfo *, gpointer)) post_func) (&batches [i], ctx);
+        }
+
+        g_free (batches);
+    }
+    else
+    {
+        GThreadPool *pool;
+        gint n_posted = 0;
+
+        /* The calling thread does its share of the work, so we only need
+         * n_threads - 1 helpers. This also means nested calls from inside
+         * a batch always make progress, even if all the workers are busy. */
+
+        pool = get_thread_pool (chafa_get_n_actual_threads () - 1);
+
+        job = g_new0 (ChafaBatchJob, 1);
+        job->refs = n_threads;
+        job->ctx = ctx;
+        job->name = name;
+        job->batch_func = batch_func;
+        job->batches = batches;
+        job->batch_done = g_new0 (guint8, n_batches);
+        job->n_batches = n_batches;
+        job->n_batches_remaining = n_batches;
+        g_mutex_init (&job->mutex);
+        g_cond_init (&job->cond);
+
+        for (i = 0; i < n_threads - 1; i++)
+            g_thread_pool_push (pool, job, NULL);
+
+        /* Post batches as they become available in order, so e.g. output
+         * can be passed on while the rest is still being generated */
+        run_job_batches (job, post_func, &n_posted);
+
+        /* Time spent here means the workers were given uneven loads */
+        wait_start_us = g_get_monotonic_time ();
+
+        if (post_func)
+        {
+            post_job_batches (job, post_func, &n_posted, TRUE);
+        }
+        else
+        {
+            /* Wait for the workers to finish the batches they claimed */
+            g_mutex_lock (&job->mutex);
+            while (job->n_batches_remaining > 0)
+                g_cond_wait (&job->cond, &job->mutex);
+            g_mutex_unlock (&job->mutex);
         }
+
+        chafa_trace_add_event ("wait", wait_start_us, g_get_monotonic_time (), 0, -1);
+
+        /* Workers add their time before marking a batch done, so it's all
+         * in by now */
+        work_us = (gssize) g_atomic_pointer_get (&job->work_us);
+        job_unref (job);
     }
 
-    g_free (batches);
+    record_work_us (batch_func, n_rows, work_us);
+}
+
+/* Like chafa_process_batches (), but picks a fine-grained batch count, so
+ * idle threads can take over rows from busy ones. Batches are still handed to
+ * post_func in order. Use this for work with unpredictable per-row cost. */
+void
+chafa_process_batches_dynamic (gpointer ctx, const gchar *name, GFunc batch_func, GFunc post_func,
+                               gint n_rows, gint batch_unit)
+{
+    gint64 work_us;
+    gint n_threads;
+    gint n_units;
+    gint n_batches;
+
+    g_assert (batch_unit >= 1);
+
+    if (n_rows < 1)
+        return;
+
+    work_us = estimate_work_us (batch_func, n_rows);
+    n_threads = pick_n_threads (work_us);
+    n_units = (n_rows + batch_unit - 1) / batch_unit;
+
+    /* Single-threaded runs gain nothing from extra batches */
+    if (n_threads < 2)
+        n_batches = 1;
+    else
+        n_batches = MIN (n_units, n_threads * DYNAMIC_BATCHES_PER_THREAD);
+
+    if (work_us >= 0)
+        n_batches = CLAMP (work_us / BATCH_MIN_WORK_US, MIN (n_threads, n_units), n_batches);
+
+    chafa_process_batches (ctx, name, batch_func, post_func, n_rows, n_batches, batch_unit);
+}
+
+ChafaThreadAffinity
+chafa_batch_get_thread_affinity (void)
+{
+    return g_atomic_int_get (&thread_affinity);
+}
+
+void
+chafa_batch_set_thread_affinity (ChafaThreadAffinity affinity)
+{
+    g_atomic_int_set (&thread_affinity, affinity);
+    g_atomic_int_inc (&thread_affinity_serial);
+}
+
+typedef struct
+{
+    guint8 *mem;
+    gsize row_bytes;
+}
+FirstTouchCtx;
+
+static void
+first_touch_batch (ChafaBatchInfo *batch, FirstTouchCtx *ctx)
+{
+    memset (ctx->mem + batch->first_row * ctx->row_bytes, 0, batch->n_rows * ctx->row_bytes);
+}
+
+/* Fresh allocations don't get physical pages until they're written to, and
+ * then they come from the writer's NUMA node. When workers are pinned, this
+ * zeroes mem in row batches from the pool, so the pages are spread over the
+ * nodes that will be processing them. Batches are still claimed first come,
+ * first served, so this improves locality rather than guaranteeing it. */
+void
+chafa_batch_first_touch (gpointer mem, gsize row_bytes, gint n_rows, gint batch_unit)
+{
+    FirstTouchCtx ctx;
+
+    if (g_atomic_int_get (&thread_affinity) == CHAFA_THREAD_AFFINITY_NONE)
+        return;
+
+    ctx.mem = mem;
+    ctx.row_bytes = row_bytes;
+
+    chafa_process_batches (&ctx, "first-touch", (GFunc) first_touch_batch, NULL, n_rows,
+                           chafa_get_n_actual_threads (), batch_unit);
 }
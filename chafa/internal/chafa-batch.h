@@ -21,6 +21,7 @@
 #define __CHAFA_BATCH_H__
 
 #include <glib.h>
+#include "chafa.h"
 
 G_BEGIN_DECLS
 
@@ -34,8 +35,14 @@ typedef struct
 }
 ChafaBatchInfo;
 
-void chafa_process_batches (gpointer ctx, GFunc batch_func, GFunc post_func,
+void chafa_process_batches (gpointer ctx, const gchar *name, GFunc batch_func, GFunc post_func,
                             gint n_rows, gint n_batches, gint batch_unit);
+void chafa_process_batches_dynamic (gpointer ctx, const gchar *name, GFunc batch_func, GFunc post_func,
+                                    gint n_rows, gint batch_unit);
+
+ChafaThreadAffinity chafa_batch_get_thread_affinity (void);
+void chafa_batch_set_thread_affinity (ChafaThreadAffinity affinity);
+void chafa_batch_first_touch (gpointer mem, gsize row_bytes, gint n_rows, gint batch_unit);
 
 G_END_DECLS
 
@@ -0,0 +1,173 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <string.h>  /* memcpy, memcmp */
+#include "chafa.h"
+#include "internal/chafa-block-cache.h"
+#include "internal/chafa-cell-cache.h"
+
+typedef struct
+{
+    /* Odd while a writer is filling in the slot, zero if it's never been
+     * written. Accessed atomically. */
+    gint seq;
+
+    guint32 tag;
+    guint64 hash;
+    ChafaCanvasCell cell;
+    gint error;
+    ChafaPixel pixels [CHAFA_SYMBOL_N_PIXELS];
+}
+BlockSlot;
+
+struct ChafaBlockCache
+{
+    /* As requested, and rounded up to a power of two */
+    gint n_blocks;
+    gint n_slots;
+
+    BlockSlot *slots;
+};
+
+/* Small enough to go unnoticed next to the canvas' own buffers, but it
+ * still catches blocks that repeat across rows, e.g. in flat regions
+ * and text */
+#define DEFAULT_SIZE 256
+
+/* Accessed atomically */
+static gint default_size = DEFAULT_SIZE;
+
+static guint64
+hash_block (const ChafaPixel *pixels)
+{
+    return chafa_cell_cache_hash_bytes (0x9e3779b97f4a7c15ULL, pixels,
+                                        CHAFA_SYMBOL_N_PIXELS * sizeof (ChafaPixel));
+}
+
+static BlockSlot *
+get_slot (ChafaBlockCache *block_cache, guint64 hash)
+{
+    return &block_cache->slots [(hash >> 32) & (block_cache->n_slots - 1)];
+}
+
+gint
+chafa_block_cache_get_default_size (void)
+{
+    return g_atomic_int_get (&default_size);
+}
+
+void
+chafa_block_cache_set_default_size (gint n_blocks)
+{
+    g_atomic_int_set (&default_size, MAX (n_blocks, 0));
+}
+
+ChafaBlockCache *
+chafa_block_cache_new (gint n_blocks)
+{
+    ChafaBlockCache *block_cache;
+
+    block_cache = g_new (ChafaBlockCache, 1);
+    block_cache->n_blocks = n_blocks;
+    block_cache->n_slots = 1 << g_bit_storage (MAX (n_blocks, 2) - 1);
+    block_cache->slots = g_new0 (BlockSlot, block_cache->n_slots);
+
+    return block_cache;
+}
+
+gint
+chafa_block_cache_get_size (ChafaBlockCache *block_cache)
+{
+    return block_cache->n_blocks;
+}
+
+void
+chafa_block_cache_destroy (ChafaBlockCache *block_cache)
+{
+    if (!block_cache)
+        return;
+
+    g_free (block_cache->slots);
+    g_free (block_cache);
+}
+
+gboolean
+chafa_block_cache_lookup (ChafaBlockCache *block_cache,
+                          const ChafaPixel *pixels, guint32 tag,
+                          ChafaCanvasCell *cell_out, gint *error_out)
+{
+    guint64 hash = hash_block (pixels);
+    BlockSlot *slot = get_slot (block_cache, hash);
+    ChafaCanvasCell cell;
+    gint error;
+    gint seq;
+
+    seq = g_atomic_int_get (&slot->seq);
+    if (seq == 0 || (seq & 1))
+        return FALSE;
+
+    if (slot->hash != hash || slot->tag != tag
+        || memcmp (slot->pixels, pixels, sizeof (slot->pixels)))
+        return FALSE;
+
+    cell = slot->cell;
+    error = slot->error;
+
+    /* Keep the copies above from being reordered past the check below on
+     * weakly ordered CPUs. If a writer got in while we were reading, the
+     * copy may be torn. */
+    __atomic_thread_fence (__ATOMIC_ACQUIRE);
+    if (g_atomic_int_get (&slot->seq) != seq)
+        return FALSE;
+
+    *cell_out = cell;
+    *error_out = error;
+    return TRUE;
+}
+
+void
+chafa_block_cache_insert (ChafaBlockCache *block_cache,
+                          const ChafaPixel *pixels, guint32 tag,
+                          const ChafaCanvasCell *cell, gint error)
+{
+    guint64 hash = hash_block (pixels);
+    BlockSlot *slot = get_slot (block_cache, hash);
+    gint seq;
+
+    seq = g_atomic_int_get (&slot->seq);
+
+    /* Someone else is writing it; theirs is as good as ours. The exchange
+     * is a full barrier, so none of the stores below can be seen before
+     * the slot is marked busy. */
+    if ((seq & 1) || !g_atomic_int_compare_and_exchange (&slot->seq, seq, seq + 1))
+        return;
+
+    slot->tag = tag;
+    slot->hash = hash;
+    slot->cell = *cell;
+    slot->error = error;
+    memcpy (slot->pixels, pixels, sizeof (slot->pixels));
+
+    /* Publish the stores above before the slot is marked complete.
+     * Wraps around to 2, never back to 0. */
+    __atomic_thread_fence (__ATOMIC_RELEASE);
+    g_atomic_int_set (&slot->seq, seq == G_MAXINT - 1 ? 2 : seq + 2);
+}
@@ -0,0 +1,59 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef __CHAFA_BLOCK_CACHE_H__
+#define __CHAFA_BLOCK_CACHE_H__
+
+#include <glib.h>
+#include "chafa.h"
+#include "internal/chafa-canvas-internal.h"
+
+G_BEGIN_DECLS
+
+/* Per-canvas cache of the cells picked for blocks of prepared pixels,
+ * regardless of where in the canvas or in which frame the block turned up.
+ * Entries are tagged with a caller-supplied value covering whatever else
+ * the pick depended on.
+ *
+ * It's direct mapped, and shared by the cell workers without locks: Each
+ * slot has a sequence number that's odd while it's being written. Readers
+ * that see it change treat the slot as a miss, and writers that find it
+ * busy give up. */
+
+typedef struct ChafaBlockCache ChafaBlockCache;
+
+/* Number of blocks new caches should hold, or 0 for none. Process-wide,
+ * and read by each canvas before it updates its cells. */
+gint chafa_block_cache_get_default_size (void);
+void chafa_block_cache_set_default_size (gint n_blocks);
+
+ChafaBlockCache *chafa_block_cache_new (gint n_blocks);
+void chafa_block_cache_destroy (ChafaBlockCache *block_cache);
+gint chafa_block_cache_get_size (ChafaBlockCache *block_cache);
+
+gboolean chafa_block_cache_lookup (ChafaBlockCache *block_cache,
+                                   const ChafaPixel *pixels, guint32 tag,
+                                   ChafaCanvasCell *cell_out, gint *error_out);
+void chafa_block_cache_insert (ChafaBlockCache *block_cache,
+                               const ChafaPixel *pixels, guint32 tag,
+                               const ChafaCanvasCell *cell, gint error);
+
+G_END_DECLS
+
+#endif /* __CHAFA_BLOCK_CACHE_H__ */
@@ -24,9 +24,56 @@
 #include "chafa.h"
 #include "internal/chafa-private.h"
 #include "internal/chafa-pixops.h"
+#include "internal/chafa-stage-time.h"
 
 G_BEGIN_DECLS
 
+/* Work factor 1.0 plus one level for skipping wide symbols */
+#define CHAFA_WORK_LEVEL_MAX 11
+
+typedef struct
+{
+    ChafaStageTime stage_times [CHAFA_CANVAS_STAGE_MAX];
+    gint64 counters [CHAFA_CANVAS_COUNTER_MAX];
+
+    /* How often each symbol was picked, and how often it was on the short
+     * list of candidates. Indexed like the symbol map's narrow symbols,
+     * followed by its wide ones. Updated atomically by the workers. */
+    gint n_symbol_tallies;
+    gint *symbol_picks;
+    gint *symbol_candidates;
+}
+ChafaCanvasStats;
+
+/* Most colors a palette can have for symbols to be scored against it from
+ * pixel sums; enough for the 16 and 8 color modes */
+#define CHAFA_PALETTE_TERMS_MAX 16
+
+/* A small fixed palette's colors in the canvas' color space, along with
+ * their squared magnitudes */
+typedef struct
+{
+    gint n_colors;
+    ChafaColor colors [CHAFA_PALETTE_TERMS_MAX];
+    gint sq [CHAFA_PALETTE_TERMS_MAX];
+}
+ChafaPaletteTerms;
+
+/* Size of the color cache for each side of a remap target. Must be a
+ * power of two. */
+#define CHAFA_REMAP_CACHE_SIZE 4096
+
+/* Cells converted to another canvas mode for printing, along with the
+ * colors converted so far. Keys are opaque RGB with the alpha byte set,
+ * so zero marks an empty slot. See chafa_canvas_print_for_mode (). */
+typedef struct
+{
+    ChafaCanvas *canvas;
+    guint32 keys [2] [CHAFA_REMAP_CACHE_SIZE];
+    guint32 values [2] [CHAFA_REMAP_CACHE_SIZE];
+}
+ChafaRemapTarget;
+
 struct ChafaCanvasCell
 {
     gunichar c;
@@ -36,29 +83,93 @@ struct ChafaCanvasCell
     guint32 bg_color;
 };
 
+typedef struct
+{
+    gunichar c;
+    guint8 coverage [CHAFA_SYMBOL_N_PIXELS];
+}
+ChafaCharCoverage;
+
 struct ChafaCanvas
 {
     gint refs;
 
     gint width_pixels, height_pixels;
+
+    /* Prepared pixels, from chafa_aligned_alloc (). Rows are a whole number
+     * of cells wide, so they're a multiple of 32 bytes and all start on a
+     * 32-byte boundary without any padding. An AVX2 register or a pair of
+     * NEON ones holds a cell row, and row loops never need a tail. */
     ChafaPixel *pixels;
     ChafaCanvasCell *cells;
+
+    /* Hash of each cell's prepared source pixel block from the last draw,
+     * so rows that didn't change between frames can be skipped */
+    guint64 *cell_hashes;
     guint have_alpha : 1;
     guint needs_clear : 1;
 
+    /* Whether cell_hashes describes the pixels the current cells were
+     * generated from. Cleared when cells are modified directly. */
+    guint have_cell_hashes : 1;
+
+    /* Whether every cell has opaque colors, so the printer can skip the
+     * transparency checks. Only set after a complete symbol draw. */
+    guint cells_opaque : 1;
+
     /* Whether to consider inverted symbols; FALSE if using FG only */
     guint consider_inverted : 1;
 
     /* Whether to extract symbol colors; FALSE if using default colors */
     guint extract_colors : 1;
 
+    /* Whether symbols are picked against default_colors, so the fast
+     * search can go by the cell's bitmap alone. Set in FGBG modes and
+     * with fg_only_enabled. */
+    guint fixed_colors : 1;
+
     /* Whether to quantize colors before calculating error (slower, but
      * yields better results in palettized modes, especially 16/8) */
     guint use_quantized_error : 1;
 
+    /* Whether quantized errors can be had from pixel sums against
+     * fg_terms and bg_terms; only with the average color extractor */
+    guint use_palette_terms : 1;
+
+    /* Whether to leave out wide symbols; only at the lowest work level */
+    guint skip_wide : 1;
+
+    /* Whether to skip the symbol search and give cells their mean color;
+     * only during the first pass of a progressive draw */
+    guint preview : 1;
+
     ChafaColorPair default_colors;
     guint work_factor_int;
 
+    /* Span of each row updated by the cell workers; the whole row except
+     * in chafa_canvas_draw_pixels_rect (). update_y is added to the batch
+     * row. */
+    gint update_x, update_y, update_width;
+
+    /* Work levels map to work_factor_int - 1, with level 0 also setting
+     * skip_wide. With a time budget, the level is adjusted after each
+     * draw, never going above the one given by the config. The time each
+     * level took when last used is kept in level_cost_us. */
+    gint work_level, work_level_max;
+    gint last_work_factor_int;
+    gint64 level_cost_us [CHAFA_WORK_LEVEL_MAX + 1];
+
+    /* Fingerprint of everything that affects cell generation for a given
+     * image. Used to key the cell cache in symbol mode. */
+    guint64 config_hash;
+
+    /* Extra error each cell may pick up from lossy changes, and the
+     * narrow symbol shapes sorted by char, so changed cells can be checked
+     * against their pixels. Only set up with a color tolerance. */
+    gint lossy_max_error;
+    ChafaCharCoverage *char_coverages;
+    gint n_char_coverages;
+
     /* Character to use in cells where fg color == bg color. Typically
      * space, but could be something else depending on the symbol map. */
     gunichar blank_char;
@@ -78,11 +189,50 @@ struct ChafaCanvas
      * (ChafaSixelCanvas *), (ChafaKittyCanvas *), (ChafaIterm2Canvas *) */
     gpointer pixel_canvas;
 
+    /* Caller-supplied palette for sixel output, or NULL */
+    ChafaPalette *custom_palette;
+
+    /* ID to store Kitty images under, or 0 to display them directly */
+    guint image_id;
+
+    /* NULL unless statistics were enabled in the config */
+    ChafaCanvasStats *stats;
+
+    /* Results for blocks of pixels seen before, or NULL if the block cache
+     * is disabled. Shared by the cell workers. */
+    struct ChafaBlockCache *block_cache;
+
+    /* Symbol picker on an OpenCL device, created on first use. The picks
+     * for the rect being drawn are made before the cell workers start,
+     * and are only around until they're done. opencl_failed is set if
+     * there was no device, so we don't keep asking. */
+#ifdef HAVE_OPENCL
+    struct ChafaOpenclPicker *opencl_picker;
+    struct ChafaOpenclPick *opencl_picks;
+    gboolean opencl_failed;
+#endif
+
+    /* Created on demand by chafa_canvas_print_for_mode () */
+    ChafaRemapTarget *remap_targets [CHAFA_CANVAS_MODE_MAX];
+
+    /* Set by chafa_canvas_cancel_draw () and checked by the workers.
+     * Accessed atomically. */
+    gint draw_cancelled;
+
     /* Our palettes. Kind of a big structure, so they go last. */
     ChafaPalette fg_palette;
     ChafaPalette bg_palette;
+    ChafaPaletteTerms fg_terms;
+    ChafaPaletteTerms bg_terms;
 };
 
+/* Regenerates the cells from canvas->pixels. Exposed for benchmarking. */
+void chafa_canvas_update_cells (ChafaCanvas *canvas);
+
+/* Renders the cells to RGBA8 unassociated pixels using the symbols'
+ * bitmaps. For measuring output quality. */
+void chafa_canvas_rasterize (ChafaCanvas *canvas, guint8 *dest, gint dest_rowstride);
+
 G_END_DECLS
 
 #endif /* __CHAFA_CANVAS_INTERNAL_H__ */
@@ -20,8 +20,34 @@
 #include "config.h"
 
 #include "chafa.h"
+#include "internal/chafa-batch.h"
 #include "internal/chafa-canvas-printer.h"
 
+/* Byte cost of each attribute sequence, not counting argument digits */
+typedef struct
+{
+    guint8 reset;
+    guint8 invert;
+    guint8 fg;
+    guint8 bg;
+    guint8 fgbg;
+}
+SeqCosts;
+
+/* One way of printing a cell, and the cheapest way to get there */
+typedef struct
+{
+    gunichar c;
+    guint32 fg;
+    guint32 bg;
+    guint8 inverted;
+    guint8 n_chars;
+    guint8 prev;
+    guint8 is_chosen;
+    gint cost;
+}
+PlanNode;
+
 typedef struct
 {
     ChafaCanvas *canvas;
@@ -29,6 +55,10 @@ typedef struct
 
     gunichar cur_char;
     gint n_reps;
+
+    /* UTF-8 encoding of cur_char, made once when it's queued */
+    guint32 cur_utf8;
+    gint cur_utf8_len;
     guint cur_inverted : 1;
     guint cur_bold : 1;
     guint32 cur_fg;
@@ -37,6 +67,13 @@ typedef struct
     /* For direct-color mode */
     ChafaColor cur_fg_direct;
     ChafaColor cur_bg_direct;
+
+    /* For the attribute optimizer */
+    guint have_costs : 1;
+    SeqCosts costs;
+    guint32 have_inverse;
+    PlanNode *plan;
+    gint plan_len;
 }
 PrintCtx;
 
@@ -53,40 +90,53 @@ threshold_alpha (ChafaColor col, gint alpha_threshold)
     return col;
 }
 
+/* Writes n copies of a UTF-8 character. The first copy is stored whole,
+ * and the rest is filled by copying what was already written, doubling the
+ * span each time. Overwrites up to 3 bytes past the end. */
+static gchar *
+fill_utf8_reps (gchar *out, guint32 utf8, gint len, gint n)
+{
+    gint total = len * n;
+    gint done;
+
+    if (len == 1)
+    {
+        memset (out, utf8 & 0xff, n);
+        return out + n;
+    }
+
+    memcpy (out, &utf8, 4);
+
+    for (done = len; done < total; done *= 2)
+        memcpy (out + done, out, MIN (done, total - done));
+
+    return out + total;
+}
+
 G_GNUC_WARN_UNUSED_RESULT static gchar *
 flush_chars (PrintCtx *ctx, gchar *out)
 {
-    gchar buf [8];
-    gint len;
+    gint len = ctx->cur_utf8_len;
 
     if (!ctx->cur_char)
         return out;
 
-    len = g_unichar_to_utf8 (ctx->cur_char, buf);
-
     if ((ctx->canvas->config.optimizations & CHAFA_OPTIMIZATION_REPEAT_CELLS)
         && chafa_term_info_have_seq (ctx->term_info, CHAFA_TERM_SEQ_REPEAT_CHAR)
         && ctx->n_reps > 1
         && ctx->n_reps * len > len + 4 /* ESC [#b */)
     {
-        memcpy (out, buf, len);
+        memcpy (out, &ctx->cur_utf8, 4);
         out += len;
 
         out = chafa_term_info_emit_repeat_char (ctx->term_info, out, ctx->n_reps - 1);
-
-        ctx->n_reps = 0;
     }
     else
     {
-        do
-        {
-            memcpy (out, buf, len);
-            out += len;
-            ctx->n_reps--;
-        }
-        while (ctx->n_reps != 0);
+        out = fill_utf8_reps (out, ctx->cur_utf8, len, ctx->n_reps);
     }
 
+    ctx->n_reps = 0;
     ctx->cur_char = 0;
     return out;
 }
@@ -104,24 +154,29 @@ queue_char (PrintCtx *ctx, gchar *out, gunichar c)
             out = flush_chars (ctx, out);
 
         ctx->cur_char = c;
+        ctx->cur_utf8_len = chafa_unichar_to_utf8_packed (c, &ctx->cur_utf8);
         ctx->n_reps = 1;
     }
 
     return out;
 }
 
-G_GNUC_WARN_UNUSED_RESULT static gchar *
-reset_attributes (PrintCtx *ctx, gchar *out)
+static void
+reset_state (PrintCtx *ctx)
 {
-    out = chafa_term_info_emit_reset_attributes (ctx->term_info, out);
-
     ctx->cur_inverted = FALSE;
     ctx->cur_bold = FALSE;
     ctx->cur_fg = CHAFA_PALETTE_INDEX_TRANSPARENT;
     ctx->cur_bg = CHAFA_PALETTE_INDEX_TRANSPARENT;
     ctx->cur_fg_direct.ch [3] = 0;
     ctx->cur_bg_direct.ch [3] = 0;
+}
 
+G_GNUC_WARN_UNUSED_RESULT static gchar *
+reset_attributes (PrintCtx *ctx, gchar *out)
+{
+    out = chafa_term_info_emit_reset_attributes (ctx->term_info, out);
+    reset_state (ctx);
     return out;
 }
 
@@ -203,9 +258,39 @@ emit_attributes_truecolor (PrintCtx *ctx, gchar *out,
     return out;
 }
 
+/* For canvases drawn from opaque sources in a mode that extracts colors.
+ * Every cell gets both colors, so there's no inversion or blanking to
+ * consider. */
+G_GNUC_WARN_UNUSED_RESULT static gchar *
+emit_ansi_truecolor_opaque (PrintCtx *ctx, gchar *out, gint i, gint i_max)
+{
+    for ( ; i < i_max; i++)
+    {
+        ChafaCanvasCell *cell = &ctx->canvas->cells [i];
+        ChafaColor fg, bg;
+
+        /* Wide symbols have a zero code point in the rightmost cell */
+        if (cell->c == 0)
+            continue;
+
+        chafa_unpack_color (cell->fg_color, &fg);
+        fg.ch [3] = 255;
+        chafa_unpack_color (cell->bg_color, &bg);
+        bg.ch [3] = 255;
+
+        out = emit_attributes_truecolor (ctx, out, fg, bg, FALSE);
+        out = queue_char (ctx, out, cell->c);
+    }
+
+    return out;
+}
+
 G_GNUC_WARN_UNUSED_RESULT static gchar *
 emit_ansi_truecolor (PrintCtx *ctx, gchar *out, gint i, gint i_max)
 {
+    if (ctx->canvas->cells_opaque)
+        return emit_ansi_truecolor_opaque (ctx, out, i, i_max);
+
     for ( ; i < i_max; i++)
     {
         ChafaCanvasCell *cell = &ctx->canvas->cells [i];
@@ -331,9 +416,19 @@ emit_attributes_256 (PrintCtx *ctx, gchar *out,
     return out;
 }
 
+G_GNUC_WARN_UNUSED_RESULT static gchar *
+emit_ansi_256_planned (PrintCtx *ctx, gchar *out, gint i, gint i_max);
+
 G_GNUC_WARN_UNUSED_RESULT static gchar *
 emit_ansi_256 (PrintCtx *ctx, gchar *out, gint i, gint i_max)
 {
+    /* The cost model relies on attribute reuse, which FG-only mode can't
+     * do */
+    if ((ctx->canvas->config.optimizations & CHAFA_OPTIMIZATION_SWAP_COLORS)
+        && (ctx->canvas->config.optimizations & CHAFA_OPTIMIZATION_REUSE_ATTRIBUTES)
+        && !ctx->canvas->config.fg_only_enabled)
+        return emit_ansi_256_planned (ctx, out, i, i_max);
+
     for ( ; i < i_max; i++)
     {
         ChafaCanvasCell *cell = &ctx->canvas->cells [i];
@@ -366,6 +461,345 @@ emit_ansi_256 (PrintCtx *ctx, gchar *out, gint i, gint i_max)
     return out;
 }
 
+/* --- Attribute optimizer --- */
+
+/* The optimizer considers several encodings for each cell: The symbol as-is
+ * or its inverse with the colors swapped, each with or without the invert
+ * attribute, and for spaces and full blocks, with or without setting the
+ * color that isn't visible. A Viterbi pass over each run picks the sequence
+ * of encodings that costs the fewest bytes, as emit_attributes_256 () would
+ * print them. */
+
+#define PLAN_CANDIDATES_MAX 8
+
+/* Stands in for a color that isn't visible in the cell */
+#define PLAN_COLOR_ANY 0xffffffff
+
+/* Symbols that look the same as their partner with the colors swapped */
+static const gunichar inverse_pairs [] [2] =
+{
+    { 0x0020, 0x2588 },  /* Space, full block */
+    { 0x2580, 0x2584 },  /* Upper half, lower half */
+    { 0x258c, 0x2590 },  /* Left half, right half */
+    { 0x2598, 0x259f },  /* Quadrants */
+    { 0x259d, 0x2599 },
+    { 0x2596, 0x259c },
+    { 0x2597, 0x259b },
+    { 0x259a, 0x259e }
+};
+
+static void
+init_plan_costs (PrintCtx *ctx)
+{
+    const ChafaSymbolMap *symbol_map = &ctx->canvas->config.symbol_map;
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX];
+    gint i, j;
+
+    ctx->costs.reset = chafa_term_info_emit_reset_attributes (ctx->term_info, buf) - buf;
+    ctx->costs.invert = chafa_term_info_emit_invert_colors (ctx->term_info, buf) - buf;
+    ctx->costs.fg = chafa_term_info_emit_set_color_fg_256 (ctx->term_info, buf, 0) - buf - 1;
+    ctx->costs.bg = chafa_term_info_emit_set_color_bg_256 (ctx->term_info, buf, 0) - buf - 1;
+    ctx->costs.fgbg = chafa_term_info_emit_set_color_fgbg_256 (ctx->term_info, buf, 0, 0) - buf - 2;
+
+    /* A symbol may only be substituted if it's one the canvas could have
+     * picked itself. Space is always fine. */
+    ctx->have_inverse = 1;
+
+    for (i = 0; i < (gint) G_N_ELEMENTS (inverse_pairs); i++)
+    {
+        for (j = 0; j < 2; j++)
+        {
+            if (chafa_symbol_map_has_symbol (symbol_map, inverse_pairs [i] [j]))
+                ctx->have_inverse |= 1 << (i * 2 + j);
+        }
+    }
+
+    ctx->have_costs = TRUE;
+}
+
+static gunichar
+get_inverse_symbol (const PrintCtx *ctx, gunichar c)
+{
+    gint i;
+
+    for (i = 0; i < (gint) G_N_ELEMENTS (inverse_pairs); i++)
+    {
+        if (inverse_pairs [i] [0] == c && (ctx->have_inverse & (1 << (i * 2 + 1))))
+            return inverse_pairs [i] [1];
+        if (inverse_pairs [i] [1] == c && (ctx->have_inverse & (1 << (i * 2))))
+            return inverse_pairs [i] [0];
+    }
+
+    return 0;
+}
+
+static gint
+pen_digits (guint32 pen)
+{
+    return chafa_ascii_dec_u8 [pen & 0xff] [3];
+}
+
+/* Mirrors the decisions in handle_attrs_with_reuse () and
+ * emit_attributes_256 (). Colors that are PLAN_COLOR_ANY in node are
+ * resolved against the state, and the state is updated to match. */
+static gint
+plan_attrs_cost (const PrintCtx *ctx, PlanNode *state, PlanNode *node)
+{
+    guint32 fg = node->fg, bg = node->bg;
+    gint cost = 0;
+
+    if ((state->inverted && !node->inverted)
+        || (state->fg != CHAFA_PALETTE_INDEX_TRANSPARENT && fg == CHAFA_PALETTE_INDEX_TRANSPARENT)
+        || (state->bg != CHAFA_PALETTE_INDEX_TRANSPARENT && bg == CHAFA_PALETTE_INDEX_TRANSPARENT))
+    {
+        cost += ctx->costs.reset;
+        state->fg = CHAFA_PALETTE_INDEX_TRANSPARENT;
+        state->bg = CHAFA_PALETTE_INDEX_TRANSPARENT;
+        state->inverted = FALSE;
+    }
+
+    if (fg == PLAN_COLOR_ANY)
+        fg = state->fg;
+    if (bg == PLAN_COLOR_ANY)
+        bg = state->bg;
+
+    if (!state->inverted && node->inverted)
+        cost += ctx->costs.invert;
+
+    if (fg != state->fg)
+    {
+        if (bg != state->bg && bg != CHAFA_PALETTE_INDEX_TRANSPARENT)
+            cost += ctx->costs.fgbg + pen_digits (fg) + pen_digits (bg);
+        else if (fg != CHAFA_PALETTE_INDEX_TRANSPARENT)
+            cost += ctx->costs.fg + pen_digits (fg);
+    }
+    else if (bg != state->bg && bg != CHAFA_PALETTE_INDEX_TRANSPARENT)
+    {
+        cost += ctx->costs.bg + pen_digits (bg);
+    }
+
+    state->fg = fg;
+    state->bg = bg;
+    state->inverted = node->inverted;
+
+    return cost + chafa_unichar_utf8_len (node->c) * node->n_chars;
+}
+
+static void
+add_candidate (PlanNode *cand, gint *n_cand, gunichar c, guint32 fg, guint32 bg,
+               gboolean inverted, gint n_chars)
+{
+    PlanNode *node = &cand [(*n_cand)++];
+
+    node->c = c;
+    node->fg = fg;
+    node->bg = bg;
+    node->inverted = inverted;
+    node->n_chars = n_chars;
+    node->prev = 0;
+    node->is_chosen = FALSE;
+    node->cost = G_MAXINT;
+}
+
+/* Only one of the colors is visible in a space or a full block, so the
+ * other can be left as it is */
+static void
+hide_invisible_color (PlanNode *node)
+{
+    if (node->c == 0x0020)
+    {
+        if (node->inverted)
+            node->bg = PLAN_COLOR_ANY;
+        else
+            node->fg = PLAN_COLOR_ANY;
+    }
+    else if (node->c == 0x2588)
+    {
+        if (node->inverted)
+            node->fg = PLAN_COLOR_ANY;
+        else
+            node->bg = PLAN_COLOR_ANY;
+    }
+}
+
+static gint
+get_candidates_256 (const PrintCtx *ctx, gint i, gint i_max, PlanNode *cand)
+{
+    const ChafaCanvasCell *cell = &ctx->canvas->cells [i];
+    guint32 fg = cell->fg_color;
+    guint32 bg = cell->bg_color;
+    gboolean is_wide = (i < i_max - 1 && ctx->canvas->cells [i + 1].c == 0);
+    gboolean can_invert;
+    gunichar syms [2];
+    gint n_syms = 0;
+    gint n_cand = 0;
+    gint j;
+
+    /* Cells with transparency or wide symbols are printed as usual */
+    if (fg == CHAFA_PALETTE_INDEX_TRANSPARENT || bg == CHAFA_PALETTE_INDEX_TRANSPARENT
+        || is_wide)
+    {
+        if (fg == CHAFA_PALETTE_INDEX_TRANSPARENT && bg == CHAFA_PALETTE_INDEX_TRANSPARENT)
+            add_candidate (cand, &n_cand, ' ', fg, bg, FALSE, is_wide ? 2 : 1);
+        else if (fg == CHAFA_PALETTE_INDEX_TRANSPARENT)
+            add_candidate (cand, &n_cand, cell->c, bg, fg, TRUE, 1);
+        else
+            add_candidate (cand, &n_cand, cell->c, fg, bg, FALSE, 1);
+
+        return n_cand;
+    }
+
+    if (fg == bg)
+    {
+        /* Solid cell; any symbol will do */
+        syms [n_syms++] = ' ';
+        if (ctx->have_inverse & 2)
+            syms [n_syms++] = 0x2588;
+    }
+    else
+    {
+        gunichar inv = get_inverse_symbol (ctx, cell->c);
+
+        syms [n_syms++] = cell->c;
+        if (inv)
+            syms [n_syms++] = inv;
+    }
+
+    can_invert = ctx->costs.invert > 0;
+
+    for (j = 0; j < n_syms; j++)
+    {
+        /* The inverse symbol prints with swapped colors */
+        guint32 sfg = (j == 0 || fg == bg) ? fg : bg;
+        guint32 sbg = (j == 0 || fg == bg) ? bg : fg;
+
+        add_candidate (cand, &n_cand, syms [j], sfg, sbg, FALSE, 1);
+        if (can_invert)
+            add_candidate (cand, &n_cand, syms [j], sbg, sfg, TRUE, 1);
+    }
+
+    /* For spaces and full blocks, also try leaving the hidden color alone.
+     * Setting it anyway may still pay off if the next cell needs it. */
+    for (j = 0, n_syms = n_cand; j < n_syms; j++)
+    {
+        if (cand [j].c == 0x0020 || cand [j].c == 0x2588)
+        {
+            cand [n_cand] = cand [j];
+            hide_invisible_color (&cand [n_cand++]);
+        }
+    }
+
+    return n_cand;
+}
+
+G_GNUC_WARN_UNUSED_RESULT static gchar *
+emit_ansi_256_planned (PrintCtx *ctx, gchar *out, gint i, gint i_max)
+{
+    const ChafaCanvasCell *cells = ctx->canvas->cells;
+    PlanNode start;
+    PlanNode *row, *prev_row = NULL;
+    gint n_prev = 1;
+    gint n_rows = 0;
+    gint best;
+    gint j, k, l;
+
+    if (!ctx->have_costs)
+        init_plan_costs (ctx);
+
+    if (ctx->plan_len < (i_max - i) * PLAN_CANDIDATES_MAX)
+    {
+        ctx->plan_len = (i_max - i) * PLAN_CANDIDATES_MAX;
+        ctx->plan = g_renew (PlanNode, ctx->plan, ctx->plan_len);
+    }
+
+    start.fg = ctx->cur_fg;
+    start.bg = ctx->cur_bg;
+    start.inverted = ctx->cur_inverted;
+    start.cost = 0;
+
+    /* Forward pass. Each candidate keeps the cheapest predecessor and the
+     * attribute state that results from it. */
+    for (j = i; j < i_max; j++)
+    {
+        gint n_cand;
+
+        /* Wide symbols have a zero code point in the rightmost cell */
+        if (cells [j].c == 0)
+            continue;
+
+        row = &ctx->plan [n_rows * PLAN_CANDIDATES_MAX];
+        n_cand = get_candidates_256 (ctx, j, i_max, row);
+
+        for (k = 0; k < n_cand; k++)
+        {
+            PlanNode resolved = row [k];
+
+            for (l = 0; l < n_prev; l++)
+            {
+                PlanNode state = prev_row ? prev_row [l] : start;
+                PlanNode node = row [k];
+                gint cost;
+
+                if (state.cost == G_MAXINT)
+                    continue;
+
+                cost = state.cost + plan_attrs_cost (ctx, &state, &node);
+                if (cost < resolved.cost)
+                {
+                    resolved.fg = state.fg;
+                    resolved.bg = state.bg;
+                    resolved.prev = l;
+                    resolved.cost = cost;
+                }
+            }
+
+            row [k] = resolved;
+        }
+
+        for ( ; k < PLAN_CANDIDATES_MAX; k++)
+            row [k].cost = G_MAXINT;
+
+        prev_row = row;
+        n_prev = PLAN_CANDIDATES_MAX;
+        n_rows++;
+    }
+
+    if (n_rows == 0)
+        return out;
+
+    /* Backtrack from the cheapest final candidate */
+    best = 0;
+    for (k = 1; k < PLAN_CANDIDATES_MAX; k++)
+    {
+        if (prev_row [k].cost < prev_row [best].cost)
+            best = k;
+    }
+
+    for (j = n_rows - 1; j >= 0; j--)
+    {
+        PlanNode *node = &ctx->plan [j * PLAN_CANDIDATES_MAX + best];
+
+        node->is_chosen = TRUE;
+        best = node->prev;
+    }
+
+    /* Emit the chosen path */
+    for (j = 0; j < n_rows; j++)
+    {
+        PlanNode *node = &ctx->plan [j * PLAN_CANDIDATES_MAX];
+
+        while (!node->is_chosen)
+            node++;
+
+        out = emit_attributes_256 (ctx, out, node->fg, node->bg, node->inverted);
+        out = queue_char (ctx, out, node->c);
+        if (node->n_chars > 1)
+            out = queue_char (ctx, out, node->c);
+    }
+
+    return out;
+}
+
 G_GNUC_WARN_UNUSED_RESULT static gchar *
 emit_attributes_16 (PrintCtx *ctx, gchar *out,
                     guint32 fg, guint32 bg, gboolean inverted)
@@ -640,6 +1074,127 @@ emit_ansi_fgbg (PrintCtx *ctx, gchar *out, gint i, gint i_max)
     return out;
 }
 
+G_GNUC_WARN_UNUSED_RESULT static gchar *
+emit_ansi_cells_mode (PrintCtx *ctx, gchar *out, gint i, gint i_max)
+{
+    switch (ctx->canvas->config.canvas_mode)
+    {
+        case CHAFA_CANVAS_MODE_TRUECOLOR:
+            out = emit_ansi_truecolor (ctx, out, i, i_max);
+            break;
+        case CHAFA_CANVAS_MODE_INDEXED_256:
+        case CHAFA_CANVAS_MODE_INDEXED_240:
+            out = emit_ansi_256 (ctx, out, i, i_max);
+            break;
+        case CHAFA_CANVAS_MODE_INDEXED_16:
+            out = emit_ansi_16 (ctx, out, i, i_max);
+            break;
+        case CHAFA_CANVAS_MODE_INDEXED_16_8:
+            out = emit_ansi_16_8 (ctx, out, i, i_max);
+            break;
+        case CHAFA_CANVAS_MODE_INDEXED_8:
+            out = emit_ansi_16 (ctx, out, i, i_max);
+            break;
+        case CHAFA_CANVAS_MODE_FGBG_BGFG:
+            out = emit_ansi_fgbg_bgfg (ctx, out, i, i_max);
+            break;
+        case CHAFA_CANVAS_MODE_FGBG:
+            out = emit_ansi_fgbg (ctx, out, i, i_max);
+            break;
+        case CHAFA_CANVAS_MODE_MAX:
+            g_assert_not_reached ();
+            break;
+    }
+
+    return out;
+}
+
+static gint
+cursor_right_len (const PrintCtx *ctx, gint n)
+{
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX];
+
+    return chafa_term_info_emit_cursor_right (ctx->term_info, buf, n) - buf;
+}
+
+static gboolean
+cell_is_transparent (const PrintCtx *ctx, const ChafaCanvasCell *cell)
+{
+    if (ctx->canvas->config.canvas_mode == CHAFA_CANVAS_MODE_TRUECOLOR)
+    {
+        ChafaColor fg, bg;
+
+        chafa_unpack_color (cell->fg_color, &fg);
+        chafa_unpack_color (cell->bg_color, &bg);
+        return fg.ch [3] < ctx->canvas->config.alpha_threshold
+            && bg.ch [3] < ctx->canvas->config.alpha_threshold;
+    }
+
+    return cell->fg_color == CHAFA_PALETTE_INDEX_TRANSPARENT
+        && cell->bg_color == CHAFA_PALETTE_INDEX_TRANSPARENT;
+}
+
+/* With CHAFA_OPTIMIZATION_SKIP_CELLS, runs of fully transparent cells are
+ * stepped over with a cursor movement when that's shorter than printing
+ * spaces, and left out entirely at the end of a row. */
+G_GNUC_WARN_UNUSED_RESULT static gchar *
+emit_ansi_cells (PrintCtx *ctx, gchar *out, gint i, gint i_max)
+{
+    const ChafaCanvasCell *cells = ctx->canvas->cells;
+    gint width = ctx->canvas->config.width;
+
+    if (!(ctx->canvas->config.optimizations & CHAFA_OPTIMIZATION_SKIP_CELLS)
+        || ctx->canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG_BGFG
+        || ctx->canvas->config.canvas_mode == CHAFA_CANVAS_MODE_FGBG
+        || !chafa_term_info_have_seq (ctx->term_info, CHAFA_TERM_SEQ_CURSOR_RIGHT))
+        return emit_ansi_cells_mode (ctx, out, i, i_max);
+
+    while (i < i_max)
+    {
+        gint run_start, run_end;
+
+        /* A run can't start in the right half of a wide symbol, but it
+         * takes along the right half of a transparent one */
+        for (run_start = i; run_start < i_max; run_start++)
+        {
+            if (cells [run_start].c != 0 && cell_is_transparent (ctx, &cells [run_start]))
+                break;
+        }
+
+        for (run_end = run_start; run_end < i_max; run_end++)
+        {
+            if (cells [run_end].c != 0 && !cell_is_transparent (ctx, &cells [run_end]))
+                break;
+        }
+
+        if (run_start > i)
+            out = emit_ansi_cells_mode (ctx, out, i, run_start);
+
+        if (run_end > run_start)
+        {
+            gint n = run_end - run_start;
+
+            if (run_end % width == 0)
+            {
+                out = flush_chars (ctx, out);
+            }
+            else if (cursor_right_len (ctx, n) <= n)
+            {
+                out = flush_chars (ctx, out);
+                out = chafa_term_info_emit_cursor_right (ctx->term_info, out, n);
+            }
+            else
+            {
+                out = emit_ansi_cells_mode (ctx, out, run_start, run_end);
+            }
+        }
+
+        i = run_end;
+    }
+
+    return out;
+}
+
 static void
 prealloc_string (GString *gs, gint n_cells)
 {
@@ -657,93 +1212,293 @@ prealloc_string (GString *gs, gint n_cells)
     }
 }
 
-static GString *
-build_ansi_gstring (ChafaCanvas *canvas, ChafaTermInfo *ti)
+/* Don't split the output into batches smaller than this. Below it, the
+ * thread handoff costs more than the encoding. */
+#define PRINT_BATCH_CELLS_MIN 4096
+
+typedef struct
 {
-    GString *gs = g_string_new ("");
-    PrintCtx ctx = { 0 };
-    gint i, i_max, i_step, i_next;
+    ChafaCanvas *canvas;
+    ChafaTermInfo *term_info;
+    ChafaStringSink *sink;
+}
+BuildCtx;
+
+G_GNUC_WARN_UNUSED_RESULT static gchar *
+emit_row (PrintCtx *ctx, gchar *out, gint row)
+{
+    ChafaCanvas *canvas = ctx->canvas;
+    gint width = canvas->config.width;
+    gboolean use_attrs;
+
+    /* Avoid control codes in FGBG mode. Don't reset attributes when BG
+     * is held, to preserve any BG color set previously. */
+    use_attrs = canvas->config.canvas_mode != CHAFA_CANVAS_MODE_FGBG
+        && !canvas->config.fg_only_enabled;
+
+    if (row == 0 && use_attrs)
+        out = reset_attributes (ctx, out);
+
+    out = emit_ansi_cells (ctx, out, row * width, (row + 1) * width);
+    out = flush_chars (ctx, out);
+
+    if (use_attrs)
+        out = reset_attributes (ctx, out);
+
+    /* Last line should not end in newline */
+    if (row < canvas->config.height - 1)
+        *(out++) = '\n';
+
+    return out;
+}
+
+/* Every row ends with an attribute reset, so a batch can start from the
+ * reset state without looking at the rows before it. */
+static void
+build_ansi_worker (ChafaBatchInfo *batch, const BuildCtx *ctx)
+{
+    PrintCtx pctx = { 0 };
+    GString *gs;
+    gint row;
+
+    pctx.canvas = ctx->canvas;
+    pctx.term_info = ctx->term_info;
+    reset_state (&pctx);
+
+    gs = g_string_new ("");
+
+    for (row = batch->first_row; row < batch->first_row + batch->n_rows; row++)
+    {
+        gchar *out;
+
+        prealloc_string (gs, ctx->canvas->config.width);
+        out = emit_row (&pctx, gs->str + gs->len, row);
+        *out = '\0';
+        gs->len = out - gs->str;
+    }
+
+    g_free (pctx.plan);
+    batch->ret_p = gs;
+}
+
+static void
+build_ansi_post (ChafaBatchInfo *batch, const BuildCtx *ctx)
+{
+    GString *gs = batch->ret_p;
+
+    chafa_string_sink_append_len (ctx->sink, gs->str, gs->len);
+    g_string_free (gs, TRUE);
+}
+
+static void
+build_ansi_parallel (ChafaCanvas *canvas, ChafaTermInfo *ti, ChafaStringSink *sink,
+                     gint n_batches)
+{
+    BuildCtx ctx;
 
     ctx.canvas = canvas;
     ctx.term_info = ti;
+    ctx.sink = sink;
+
+    chafa_process_batches (&ctx,
+                           "build-ansi",
+                           (GFunc) build_ansi_worker,
+                           (GFunc) build_ansi_post,
+                           canvas->config.height,
+                           n_batches,
+                           1);
+}
+
+static void
+build_ansi (ChafaCanvas *canvas, ChafaTermInfo *ti, ChafaStringSink *sink)
+{
+    GString *gs = sink->gs;
+    PrintCtx ctx = { 0 };
+    gint n_batches;
+    gint row;
+
+    /* Without the per-row reset, attributes carry over from one row to the
+     * next, and the rows must be encoded in sequence */
+    if (canvas->config.canvas_mode != CHAFA_CANVAS_MODE_FGBG
+        && !canvas->config.fg_only_enabled)
+    {
+        n_batches = (canvas->config.width * canvas->config.height) / PRINT_BATCH_CELLS_MIN;
+        n_batches = CLAMP (n_batches, 1, chafa_get_n_actual_threads ());
 
-    i = 0;
-    i_max = canvas->config.width * canvas->config.height;
-    i_step = canvas->config.width;
+        if (n_batches > 1)
+        {
+            build_ansi_parallel (canvas, ti, sink, n_batches);
+            return;
+        }
+    }
 
-    for ( ; i < i_max; i = i_next)
+    ctx.canvas = canvas;
+    ctx.term_info = ti;
+
+    for (row = 0; row < canvas->config.height && !sink->failed; row++)
     {
         gchar *out;
 
-        i_next = i + i_step;
+        prealloc_string (gs, canvas->config.width);
+        out = emit_row (&ctx, gs->str + gs->len, row);
+        *out = '\0';
+        gs->len = out - gs->str;
+
+        chafa_string_sink_flush (sink);
+    }
+
+    g_free (ctx.plan);
+}
+
+static gboolean
+cells_equal (const ChafaCanvasCell *a, const ChafaCanvasCell *b)
+{
+    return a->c == b->c && a->fg_color == b->fg_color && a->bg_color == b->bg_color;
+}
 
-        prealloc_string (gs, i_step);
+/* Unchanged gaps are reprinted instead of skipped when the cells take fewer
+ * bytes than the cursor movement. Attributes may add to the cost of
+ * reprinting, so a tie goes to the cursor movement. */
+static gboolean
+gap_is_cheaper_to_reprint (const PrintCtx *ctx, gint i, gint i_max)
+{
+    const ChafaCanvasCell *cells = ctx->canvas->cells;
+    gint cost = 0;
+    gint j;
+
+    for (j = i; j < i_max; j++)
+    {
+        if (cells [j].c != 0)
+            cost += chafa_unichar_utf8_len (cells [j].c);
+    }
+
+    return cost < cursor_right_len (ctx, i_max - i);
+}
+
+static void
+build_ansi_delta (ChafaCanvas *canvas, ChafaCanvas *prev_canvas, ChafaTermInfo *ti,
+                  ChafaStringSink *sink)
+{
+    GString *gs = sink->gs;
+    PrintCtx ctx = { 0 };
+    const ChafaCanvasCell *cells = canvas->cells;
+    const ChafaCanvasCell *prev_cells = prev_canvas->cells;
+    gint width = canvas->config.width;
+    gint height = canvas->config.height;
+    gboolean use_attrs;
+    gboolean need_reset = TRUE;
+    gint row;
+
+    ctx.canvas = canvas;
+    ctx.term_info = ti;
+
+    /* Same rules as for full output; see build_ansi () */
+    use_attrs = canvas->config.canvas_mode != CHAFA_CANVAS_MODE_FGBG
+        && !canvas->config.fg_only_enabled;
+
+    for (row = 0; row < height && !sink->failed; row++)
+    {
+        gint i_row = row * width;
+        gint x = 0, cur_x = 0;
+        gboolean row_changed = FALSE;
+        gchar *out;
+
+        /* Each run may add a cursor movement on top of the regular output */
+        prealloc_string (gs, width * 2);
         out = gs->str + gs->len;
 
-        /* Avoid control codes in FGBG mode. Don't reset attributes when BG
-         * is held, to preserve any BG color set previously. */
-        if (i == 0
-            && canvas->config.canvas_mode != CHAFA_CANVAS_MODE_FGBG
-            && !canvas->config.fg_only_enabled)
+        while (x < width)
         {
-            out = reset_attributes (&ctx, out);
-        }
+            gint run_start, run_end;
 
-        switch (canvas->config.canvas_mode)
-        {
-            case CHAFA_CANVAS_MODE_TRUECOLOR:
-                out = emit_ansi_truecolor (&ctx, out, i, i_next);
-                break;
-            case CHAFA_CANVAS_MODE_INDEXED_256:
-            case CHAFA_CANVAS_MODE_INDEXED_240:
-                out = emit_ansi_256 (&ctx, out, i, i_next);
-                break;
-            case CHAFA_CANVAS_MODE_INDEXED_16:
-                out = emit_ansi_16 (&ctx, out, i, i_next);
-                break;
-            case CHAFA_CANVAS_MODE_INDEXED_16_8:
-                out = emit_ansi_16_8 (&ctx, out, i, i_next);
+            while (x < width && cells_equal (&cells [i_row + x], &prev_cells [i_row + x]))
+                x++;
+            if (x == width)
                 break;
-            case CHAFA_CANVAS_MODE_INDEXED_8:
-                out = emit_ansi_16 (&ctx, out, i, i_next);
-                break;
-            case CHAFA_CANVAS_MODE_FGBG_BGFG:
-                out = emit_ansi_fgbg_bgfg (&ctx, out, i, i_next);
-                break;
-            case CHAFA_CANVAS_MODE_FGBG:
-                out = emit_ansi_fgbg (&ctx, out, i, i_next);
-                break;
-            case CHAFA_CANVAS_MODE_MAX:
-                g_assert_not_reached ();
-                break;
-        }
 
-        out = flush_chars (&ctx, out);
+            run_start = x;
+            run_end = x + 1;
 
-        /* Avoid control codes in FGBG mode. Don't reset attributes when BG
-         * is held, to preserve any BG color set previously. */
-        if (canvas->config.canvas_mode != CHAFA_CANVAS_MODE_FGBG
-            && !canvas->config.fg_only_enabled)
+            /* Extend the run over any gaps that are cheaper to reprint */
+            for (;;)
+            {
+                gint gap_end = run_end;
+
+                while (gap_end < width && cells_equal (&cells [i_row + gap_end],
+                                                       &prev_cells [i_row + gap_end]))
+                    gap_end++;
+
+                if (gap_end == width
+                    || !gap_is_cheaper_to_reprint (&ctx, i_row + run_end, i_row + gap_end))
+                    break;
+
+                run_end = gap_end + 1;
+            }
+
+            /* Don't split wide symbols; they have a zero code point in
+             * the rightmost cell */
+            if (run_start > 0 && cells [i_row + run_start].c == 0)
+                run_start--;
+            if (run_end < width && cells [i_row + run_end].c == 0)
+                run_end++;
+
+            x = run_end;
+
+            if (need_reset && use_attrs)
+                out = reset_attributes (&ctx, out);
+            need_reset = FALSE;
+            row_changed = TRUE;
+
+            if (run_start > cur_x)
+            {
+                out = flush_chars (&ctx, out);
+                out = chafa_term_info_emit_cursor_right (ti, out, run_start - cur_x);
+            }
+
+            out = emit_ansi_cells (&ctx, out, i_row + run_start, i_row + run_end);
+            cur_x = run_end;
+        }
+
+        if (row_changed)
         {
-            out = reset_attributes (&ctx, out);
+            out = flush_chars (&ctx, out);
+            if (use_attrs)
+                out = reset_attributes (&ctx, out);
         }
 
         /* Last line should not end in newline */
-        if (i_next < i_max)
+        if (row < height - 1)
             *(out++) = '\n';
 
         *out = '\0';
         gs->len = out - gs->str;
+
+        if (row_changed)
+            chafa_string_sink_flush (sink);
     }
 
-    return gs;
+    chafa_string_sink_flush (sink);
+    g_free (ctx.plan);
+}
+
+void
+chafa_canvas_print_symbols (ChafaCanvas *canvas, ChafaTermInfo *ti, ChafaStringSink *sink)
+{
+    g_assert (canvas != NULL);
+    g_assert (ti != NULL);
+    g_assert (sink != NULL);
+
+    build_ansi (canvas, ti, sink);
 }
 
-GString *
-chafa_canvas_print_symbols (ChafaCanvas *canvas, ChafaTermInfo *ti)
+void
+chafa_canvas_print_symbols_delta (ChafaCanvas *canvas, ChafaCanvas *prev_canvas,
+                                  ChafaTermInfo *ti, ChafaStringSink *sink)
 {
     g_assert (canvas != NULL);
+    g_assert (prev_canvas != NULL);
     g_assert (ti != NULL);
+    g_assert (sink != NULL);
 
-    return build_ansi_gstring (canvas, ti);
+    build_ansi_delta (canvas, prev_canvas, ti, sink);
 }
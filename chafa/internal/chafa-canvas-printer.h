@@ -25,10 +25,13 @@
 #include "internal/chafa-canvas-internal.h"
 #include "internal/chafa-private.h"
 #include "internal/chafa-pixops.h"
+#include "internal/chafa-string-util.h"
 
 G_BEGIN_DECLS
 
-GString *chafa_canvas_print_symbols (ChafaCanvas *canvas, ChafaTermInfo *ti);
+void chafa_canvas_print_symbols (ChafaCanvas *canvas, ChafaTermInfo *ti, ChafaStringSink *sink);
+void chafa_canvas_print_symbols_delta (ChafaCanvas *canvas, ChafaCanvas *prev_canvas,
+                                       ChafaTermInfo *ti, ChafaStringSink *sink);
 
 G_END_DECLS
 
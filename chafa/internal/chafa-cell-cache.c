@@ -0,0 +1,382 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <string.h>  /* memcpy */
+#include "chafa.h"
+#include "internal/chafa-canvas-internal.h"
+#include "internal/chafa-cell-cache.h"
+
+/* Cells from indexed modes are stored in 32 bits each: An index into the
+ * entry's table of symbols and two palette indexes. That's a third of the
+ * full cell size, and lets the cache hold that many more frames. */
+#define PACKED_COLOR_BITS 10
+#define PACKED_COLOR_MASK ((1 << PACKED_COLOR_BITS) - 1)
+#define PACKED_CHARS_MAX (1 << (32 - 2 * PACKED_COLOR_BITS))
+
+typedef struct
+{
+    ChafaCellCacheKey key;
+    gint n_cells;
+    guint have_alpha : 1;
+
+    /* Exactly one of cells and packed_cells is set */
+    ChafaCanvasCell *cells;
+    guint32 *packed_cells;
+    gunichar *chars;
+    gint n_chars;
+
+    /* Position in the recency queue. Embedded, so the entry can be moved
+     * to the front without a lookup. */
+    GList link;
+}
+CacheEntry;
+
+/* All of the below are protected by cache_mutex, except max_size, which is
+ * also read atomically so lookups can bail out early when disabled */
+static GMutex cache_mutex;
+static GHashTable *entries;
+static GQueue recency = G_QUEUE_INIT;
+static gsize cur_size;
+static gsize max_size;
+
+static gsize
+entry_size (const CacheEntry *entry)
+{
+    if (entry->packed_cells)
+        return sizeof (CacheEntry) + entry->n_cells * sizeof (guint32)
+            + entry->n_chars * sizeof (gunichar);
+
+    return sizeof (CacheEntry) + entry->n_cells * sizeof (ChafaCanvasCell);
+}
+
+/* Returns FALSE if the cells don't fit in the packed format, which is
+ * always the case for truecolor */
+static gboolean
+pack_cells (CacheEntry *entry, const ChafaCanvasCell *cells, gint n_cells)
+{
+    GHashTable *char_to_index;
+    guint32 *packed;
+    gunichar *chars;
+    gint n_chars = 0;
+    gint i;
+
+    packed = g_new (guint32, n_cells);
+    chars = g_new (gunichar, PACKED_CHARS_MAX);
+    char_to_index = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+    for (i = 0; i < n_cells; i++)
+    {
+        const ChafaCanvasCell *cell = &cells [i];
+        gpointer p;
+        guint32 index;
+
+        if (cell->fg_color > PACKED_COLOR_MASK || cell->bg_color > PACKED_COLOR_MASK)
+            goto fail;
+
+        /* Keys are offset by one, since a zero code point is valid here */
+        p = g_hash_table_lookup (char_to_index, GUINT_TO_POINTER (cell->c + 1));
+        if (p)
+        {
+            index = GPOINTER_TO_UINT (p) - 1;
+        }
+        else
+        {
+            if (n_chars == PACKED_CHARS_MAX)
+                goto fail;
+
+            index = n_chars;
+            chars [n_chars++] = cell->c;
+            g_hash_table_insert (char_to_index, GUINT_TO_POINTER (cell->c + 1),
+                                 GUINT_TO_POINTER (index + 1));
+        }
+
+        packed [i] = (index << (2 * PACKED_COLOR_BITS))
+            | (cell->fg_color << PACKED_COLOR_BITS)
+            | cell->bg_color;
+    }
+
+    g_hash_table_destroy (char_to_index);
+
+    entry->packed_cells = packed;
+    entry->chars = g_renew (gunichar, chars, n_chars);
+    entry->n_chars = n_chars;
+    return TRUE;
+
+fail:
+    g_hash_table_destroy (char_to_index);
+    g_free (chars);
+    g_free (packed);
+    return FALSE;
+}
+
+static void
+unpack_cells (const CacheEntry *entry, ChafaCanvasCell *cells_out)
+{
+    gint i;
+
+    for (i = 0; i < entry->n_cells; i++)
+    {
+        guint32 p = entry->packed_cells [i];
+
+        cells_out [i].c = entry->chars [p >> (2 * PACKED_COLOR_BITS)];
+        cells_out [i].fg_color = (p >> PACKED_COLOR_BITS) & PACKED_COLOR_MASK;
+        cells_out [i].bg_color = p & PACKED_COLOR_MASK;
+    }
+}
+
+static guint
+key_hash (gconstpointer p)
+{
+    const ChafaCellCacheKey *key = p;
+
+    return (guint) (key->src_hash ^ (key->config_hash >> 7));
+}
+
+static gboolean
+key_equal (gconstpointer a, gconstpointer b)
+{
+    const ChafaCellCacheKey *key_a = a;
+    const ChafaCellCacheKey *key_b = b;
+
+    return key_a->src_hash == key_b->src_hash
+        && key_a->config_hash == key_b->config_hash;
+}
+
+static void
+remove_entry (CacheEntry *entry)
+{
+    g_hash_table_remove (entries, &entry->key);
+    g_queue_unlink (&recency, &entry->link);
+    cur_size -= entry_size (entry);
+
+    g_free (entry->cells);
+    g_free (entry->packed_cells);
+    g_free (entry->chars);
+    g_free (entry);
+}
+
+/* Must be called with cache_mutex held */
+static void
+evict_to_size (gsize size)
+{
+    while (cur_size > size && recency.tail)
+        remove_entry (recency.tail->data);
+}
+
+gsize
+chafa_cell_cache_get_max_size (void)
+{
+    return (gsize) g_atomic_pointer_get (&max_size);
+}
+
+void
+chafa_cell_cache_set_max_size (gsize size)
+{
+    g_mutex_lock (&cache_mutex);
+
+    g_atomic_pointer_set (&max_size, size);
+    evict_to_size (size);
+
+    if (size == 0 && entries)
+    {
+        g_hash_table_destroy (entries);
+        entries = NULL;
+    }
+
+    g_mutex_unlock (&cache_mutex);
+}
+
+guint64
+chafa_cell_cache_hash_bytes (guint64 h, gconstpointer p, gsize len)
+{
+    const guint8 *p0 = p;
+    const guint8 *p1 = p0 + len;
+    guint64 v;
+
+    for ( ; p0 + sizeof (guint64) <= p1; p0 += sizeof (guint64))
+    {
+        memcpy (&v, p0, sizeof (v));
+        h = (h ^ v) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+    }
+
+    if (p0 < p1)
+    {
+        v = 0;
+        memcpy (&v, p0, p1 - p0);
+        h = (h ^ v ^ ((guint64) (p1 - p0) << 56)) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+    }
+
+    return h;
+}
+
+guint64
+chafa_cell_cache_hash_pixels (ChafaPixelType pixel_type,
+                              const guint8 *pixels,
+                              gint width, gint height, gint rowstride)
+{
+    guint64 h = 0x9e3779b97f4a7c15ULL;
+    gint32 header [3];
+    gint bpp;
+    gint y;
+
+    header [0] = pixel_type;
+    header [1] = width;
+    header [2] = height;
+    h = chafa_cell_cache_hash_bytes (h, header, sizeof (header));
+
+    if (pixel_type == CHAFA_PIXEL_I420 || pixel_type == CHAFA_PIXEL_NV12)
+    {
+        gint chroma_rowstride = pixel_type == CHAFA_PIXEL_I420 ? rowstride / 2 : rowstride;
+        gint chroma_width = pixel_type == CHAFA_PIXEL_I420 ? (width + 1) / 2 : ((width + 1) / 2) * 2;
+        gint n_chroma_rows = ((height + 1) / 2) * (pixel_type == CHAFA_PIXEL_I420 ? 2 : 1);
+
+        for (y = 0; y < height; y++)
+            h = chafa_cell_cache_hash_bytes (h, pixels + y * rowstride, width);
+
+        /* The I420 V plane follows the U plane, so both can be done in one go */
+        pixels += height * rowstride;
+        for (y = 0; y < n_chroma_rows; y++)
+            h = chafa_cell_cache_hash_bytes (h, pixels + y * chroma_rowstride, chroma_width);
+
+        return h;
+    }
+
+    switch (pixel_type)
+    {
+        case CHAFA_PIXEL_RGB8:
+        case CHAFA_PIXEL_BGR8:
+            bpp = 3;
+            break;
+        case CHAFA_PIXEL_RGB16:
+            bpp = 6;
+            break;
+        case CHAFA_PIXEL_RGBA16_PREMULTIPLIED:
+        case CHAFA_PIXEL_RGBA16_UNASSOCIATED:
+        case CHAFA_PIXEL_RGBA16F_PREMULTIPLIED:
+            bpp = 8;
+            break;
+        case CHAFA_PIXEL_RGBA32F_PREMULTIPLIED:
+            bpp = 16;
+            break;
+        default:
+            bpp = 4;
+            break;
+    }
+
+    /* Only the visible part of each row counts; padding can be garbage */
+    for (y = 0; y < height; y++)
+        h = chafa_cell_cache_hash_bytes (h, pixels + y * rowstride, width * bpp);
+
+    return h;
+}
+
+gboolean
+chafa_cell_cache_lookup (const ChafaCellCacheKey *key,
+                         ChafaCanvasCell *cells_out, gint n_cells,
+                         gboolean *have_alpha_out)
+{
+    CacheEntry *entry = NULL;
+
+    if (chafa_cell_cache_get_max_size () == 0)
+        return FALSE;
+
+    g_mutex_lock (&cache_mutex);
+
+    if (entries)
+        entry = g_hash_table_lookup (entries, key);
+
+    if (entry && entry->n_cells == n_cells)
+    {
+        if (entry->packed_cells)
+            unpack_cells (entry, cells_out);
+        else
+            memcpy (cells_out, entry->cells, n_cells * sizeof (ChafaCanvasCell));
+        *have_alpha_out = entry->have_alpha;
+
+        g_queue_unlink (&recency, &entry->link);
+        g_queue_push_head_link (&recency, &entry->link);
+    }
+    else
+    {
+        entry = NULL;
+    }
+
+    g_mutex_unlock (&cache_mutex);
+
+    return entry != NULL;
+}
+
+void
+chafa_cell_cache_insert (const ChafaCellCacheKey *key,
+                         const ChafaCanvasCell *cells, gint n_cells,
+                         gboolean have_alpha, gboolean indexed_colors)
+{
+    CacheEntry *entry;
+    gsize size;
+
+    if (sizeof (CacheEntry) + n_cells * sizeof (guint32) > chafa_cell_cache_get_max_size ())
+        return;
+
+    /* Packing is done outside the lock, so other threads can keep going */
+    entry = g_new0 (CacheEntry, 1);
+    entry->key = *key;
+    entry->n_cells = n_cells;
+    entry->have_alpha = have_alpha ? TRUE : FALSE;
+    entry->link.data = entry;
+
+    if (!indexed_colors || !pack_cells (entry, cells, n_cells))
+        entry->cells = g_memdup (cells, n_cells * sizeof (ChafaCanvasCell));
+
+    size = entry_size (entry);
+
+    g_mutex_lock (&cache_mutex);
+
+    if (!entries)
+        entries = g_hash_table_new (key_hash, key_equal);
+
+    /* Another thread may have rendered the same image in the meantime */
+    {
+        CacheEntry *old_entry = g_hash_table_lookup (entries, key);
+        if (old_entry)
+            remove_entry (old_entry);
+    }
+
+    /* The size may have shrunk since we checked it above */
+    if (size > max_size)
+    {
+        g_free (entry->cells);
+        g_free (entry->packed_cells);
+        g_free (entry->chars);
+        g_free (entry);
+        goto out;
+    }
+
+    evict_to_size (max_size - size);
+
+    g_hash_table_insert (entries, &entry->key, entry);
+    g_queue_push_head_link (&recency, &entry->link);
+    cur_size += size;
+
+out:
+    g_mutex_unlock (&cache_mutex);
+}
@@ -0,0 +1,61 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef __CHAFA_CELL_CACHE_H__
+#define __CHAFA_CELL_CACHE_H__
+
+#include <glib.h>
+#include "chafa.h"
+#include "internal/chafa-private.h"
+
+G_BEGIN_DECLS
+
+/* Process-wide cache of symbol mode cell arrays. Entries are keyed by the
+ * source image contents and a fingerprint of everything in the canvas that
+ * affects cell generation, and are evicted least recently used first. */
+
+typedef struct
+{
+    guint64 src_hash;
+    guint64 config_hash;
+}
+ChafaCellCacheKey;
+
+gsize chafa_cell_cache_get_max_size (void);
+void chafa_cell_cache_set_max_size (gsize max_size);
+
+/* Mixes len bytes at p into the running hash h */
+guint64 chafa_cell_cache_hash_bytes (guint64 h, gconstpointer p, gsize len);
+guint64 chafa_cell_cache_hash_pixels (ChafaPixelType pixel_type,
+                                      const guint8 *pixels,
+                                      gint width, gint height, gint rowstride);
+
+/* Both of these copy the cells; the cache never holds on to caller memory.
+ * Set indexed_colors when the cell colors are palette indexes, so they can
+ * be stored in less space. */
+gboolean chafa_cell_cache_lookup (const ChafaCellCacheKey *key,
+                                  ChafaCanvasCell *cells_out, gint n_cells,
+                                  gboolean *have_alpha_out);
+void chafa_cell_cache_insert (const ChafaCellCacheKey *key,
+                              const ChafaCanvasCell *cells, gint n_cells,
+                              gboolean have_alpha, gboolean indexed_colors);
+
+G_END_DECLS
+
+#endif /* __CHAFA_CELL_CACHE_H__ */
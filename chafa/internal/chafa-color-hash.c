@@ -22,27 +22,55 @@
 #include "chafa.h"
 #include "internal/chafa-color-hash.h"
 
+/* n_sets must be a power of two */
 void
-chafa_color_hash_init (ChafaColorHash *color_hash)
+chafa_color_hash_init (ChafaColorHash *color_hash, guint n_sets)
+{
+    g_assert (n_sets > 0 && (n_sets & (n_sets - 1)) == 0);
+
+    color_hash->n_sets = n_sets;
+    color_hash->map = g_new (guint32, n_sets * CHAFA_COLOR_HASH_N_WAYS);
+    chafa_color_hash_clear (color_hash);
+}
+
+void
+chafa_color_hash_deinit (ChafaColorHash *color_hash)
+{
+    g_free (color_hash->map);
+    color_hash->map = NULL;
+}
+
+void
+chafa_color_hash_clear (ChafaColorHash *color_hash)
 {
     guint i;
     guint32 j;
 
-    /* Initialize with invalid entries */
+    /* Initialize with invalid entries; colors that belong to a different set */
 
-    for (i = 0, j = 0; i < CHAFA_COLOR_HASH_N_ENTRIES; i++)
+    for (i = 0, j = 0; i < color_hash->n_sets; i++)
     {
-        while (_chafa_color_hash_calc_hash (j) == i)
+        gint k;
+
+        while (_chafa_color_hash_calc_hash (j, color_hash->n_sets) == i)
         {
             j++;
             j %= 0x01000000;
         }
 
-        color_hash->map [i] = j << 8;
+        for (k = 0; k < CHAFA_COLOR_HASH_N_WAYS; k++)
+            color_hash->map [i * CHAFA_COLOR_HASH_N_WAYS + k] = j << 8;
     }
+
+    color_hash->n_hits = 0;
+    color_hash->n_misses = 0;
 }
 
+/* Workers count locally and add their totals when done, so the counters
+ * aren't contended */
 void
-chafa_color_hash_deinit (G_GNUC_UNUSED ChafaColorHash *color_hash)
+chafa_color_hash_add_stats (ChafaColorHash *color_hash, gint n_hits, gint n_misses)
 {
+    g_atomic_int_add (&color_hash->n_hits, n_hits);
+    g_atomic_int_add (&color_hash->n_misses, n_misses);
 }
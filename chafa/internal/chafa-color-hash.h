@@ -22,42 +22,66 @@
 
 G_BEGIN_DECLS
 
-#define CHAFA_COLOR_HASH_N_ENTRIES 16384
+/* The hash is set-associative; each color maps to a set of N_WAYS entries,
+ * and a color evicts the oldest entry in its set. Entries are stored as
+ * single 32-bit words and accessed atomically, so one hash can be shared
+ * by worker threads without locking. Concurrent updates may lose an entry,
+ * but never corrupt one. */
+#define CHAFA_COLOR_HASH_N_WAYS 4
+#define CHAFA_COLOR_HASH_DEFAULT_N_SETS 16384
 
 typedef struct
 {
-    guint32 map [CHAFA_COLOR_HASH_N_ENTRIES];
+    /* Each entry is the 24-bit color in the high bits, and the pen in the
+     * low eight bits */
+    guint32 *map;
+    guint n_sets;
+
+    gint n_hits;
+    gint n_misses;
 }
 ChafaColorHash;
 
-void   chafa_color_hash_init    (ChafaColorHash *color_hash);
+void   chafa_color_hash_init    (ChafaColorHash *color_hash, guint n_sets);
 void   chafa_color_hash_deinit  (ChafaColorHash *color_hash);
+void   chafa_color_hash_clear   (ChafaColorHash *color_hash);
+void   chafa_color_hash_add_stats (ChafaColorHash *color_hash, gint n_hits, gint n_misses);
 
 static inline guint
-_chafa_color_hash_calc_hash (guint32 color)
+_chafa_color_hash_calc_hash (guint32 color, guint n_sets)
 {
     color &= 0x00ffffff;
 
-    return (color ^ (color >> 7) ^ (color >> 14)) % CHAFA_COLOR_HASH_N_ENTRIES;
+    return (color ^ (color >> 7) ^ (color >> 14)) & (n_sets - 1);
 }
 
 static inline void
 chafa_color_hash_replace (ChafaColorHash *color_hash, guint32 color, guint8 pen)
 {
-    guint index = _chafa_color_hash_calc_hash (color);
-    guint32 entry = (color << 8) | pen;
+    gint *set = (gint *) color_hash->map
+        + _chafa_color_hash_calc_hash (color, color_hash->n_sets) * CHAFA_COLOR_HASH_N_WAYS;
+    gint i;
+
+    for (i = CHAFA_COLOR_HASH_N_WAYS - 1; i > 0; i--)
+        g_atomic_int_set (&set [i], g_atomic_int_get (&set [i - 1]));
 
-    color_hash->map [index] = entry;
+    g_atomic_int_set (&set [0], (gint) ((color << 8) | pen));
 }
 
 static inline gint
 chafa_color_hash_lookup (const ChafaColorHash *color_hash, guint32 color)
 {
-    guint index = _chafa_color_hash_calc_hash (color);
-    guint32 entry = color_hash->map [index];
+    gint *set = (gint *) color_hash->map
+        + _chafa_color_hash_calc_hash (color, color_hash->n_sets) * CHAFA_COLOR_HASH_N_WAYS;
+    gint i;
+
+    for (i = 0; i < CHAFA_COLOR_HASH_N_WAYS; i++)
+    {
+        guint32 entry = (guint32) g_atomic_int_get (&set [i]);
 
-    if ((entry & 0xffffff00) == (color << 8))
-        return entry & 0xff;
+        if ((entry & 0xffffff00) == (color << 8))
+            return entry & 0xff;
+    }
 
     return -1;
 }
@@ -26,76 +26,29 @@
 #include "chafa.h"
 
 #include "internal/chafa-color-table.h"
-#include "internal/chafa-pca.h"
 
 #define CHAFA_COLOR_TABLE_ENABLE_PROFILING 0
-#define DEBUG_PEN_CHOICE(x)
 
 #define POW2(x) ((x) * (x))
 
-#define FIXED_MUL_BIG_SHIFT 14
-#define FIXED_MUL_BIG (1 << (FIXED_MUL_BIG_SHIFT))
-
-#define FIXED_MUL 32
-#define FIXED_MUL_F ((gfloat) (FIXED_MUL))
-
 #if CHAFA_COLOR_TABLE_ENABLE_PROFILING
 
 # define profile_counter_inc(x) g_atomic_int_inc ((gint *) &(x))
 
 static gint n_lookups;
 static gint n_misses;
-static gint n_a;
-static gint n_b;
-static gint n_c;
-static gint n_d;
-
-static void
-dump_entry (const ChafaColorTable *color_table, gint entry, gint want_color)
-{
-    const ChafaColorTableEntry *e = &color_table->entries [entry];
-    guint32 c = color_table->pens [e->pen];
-    gint err;
-
-    err = POW2 (((gint) (c & 0xff) - (want_color & 0xff)))
-        + POW2 (((gint) (c >> 8) & 0xff) - ((want_color >> 8) & 0xff))
-        + POW2 (((gint) (c >> 16) & 0xff) - ((want_color >> 16) & 0xff));
-
-    g_printerr ("{ %3d, %3d, %3d }  { %7d, %7d }  n = %3d  err = %6d\n",
-                c & 0xff,
-                (c >> 8) & 0xff,
-                (c >> 16) & 0xff,
-                e->v [0], e->v [1],
-                entry,
-                err);
-}
+static gint n_visits;
 
 #else
 # define profile_counter_inc(x)
 #endif
 
-static gint
-compare_entries (gconstpointer a, gconstpointer b)
+static void
+color_to_channels (guint32 color, gint *ch_out)
 {
-    const ChafaColorTableEntry *ab = a;
-    const ChafaColorTableEntry *bb = b;
-
-    return ab->v [0] - bb->v [0];
-}
-
-static gint
-scalar_project_vec3i32 (const ChafaVec3i32 *a, const ChafaVec3i32 *b, guint32 b_mul)
-{
-    guint64 d = chafa_vec3i32_dot_64 (a, b);
-
-    /* I replaced the following (a division, three multiplications and
-     * two additions) with a multiplication and a right shift:
-     * 
-     * d / (POW2 (b->v [0]) + POW2 (b->v [1]) + POW2 (b->v [2]))
-     *
-     * The result is multiplied by FIXED_MUL for increased precision. */
-
-    return (d * b_mul) / (FIXED_MUL_BIG / FIXED_MUL);
+    ch_out [0] = color & 0xff;
+    ch_out [1] = (color >> 8) & 0xff;
+    ch_out [2] = (color >> 16) & 0xff;
 }
 
 static gint
@@ -104,138 +57,153 @@ color_diff (guint32 a, guint32 b)
     gint diff;
     gint n;
 
-    n = (gint) ((b & 0xff) - (gint) (a & 0xff)) * FIXED_MUL;
+    n = (gint) (b & 0xff) - (gint) (a & 0xff);
     diff = n * n;
-    n = (gint) (((b >> 8) & 0xff) - (gint) ((a >> 8) & 0xff)) * FIXED_MUL;
+    n = (gint) ((b >> 8) & 0xff) - (gint) ((a >> 8) & 0xff);
     diff += n * n;
-    n = (gint) (((b >> 16) & 0xff) - (gint) ((a >> 16) & 0xff)) * FIXED_MUL;
+    n = (gint) ((b >> 16) & 0xff) - (gint) ((a >> 16) & 0xff);
     diff += n * n;
 
     return diff;
 }
 
+#define DEFINE_COMPARE_NODES(axis)                                      \
+static gint                                                             \
+compare_nodes_##axis (gconstpointer a, gconstpointer b)                 \
+{                                                                       \
+    const ChafaColorTableNode *an = a;                                  \
+    const ChafaColorTableNode *bn = b;                                  \
+                                                                        \
+    if (an->ch [axis] != bn->ch [axis])                                 \
+        return (gint) an->ch [axis] - (gint) bn->ch [axis];             \
+    return an->pen - bn->pen;                                           \
+}
+
+DEFINE_COMPARE_NODES (0)
+DEFINE_COMPARE_NODES (1)
+DEFINE_COMPARE_NODES (2)
+
+static gint (* const compare_nodes [3]) (gconstpointer a, gconstpointer b) =
+{
+    compare_nodes_0,
+    compare_nodes_1,
+    compare_nodes_2
+};
+
 static void
-project_color (const ChafaColorTable *color_table, guint32 color, gint *v_out)
+build_kd_tree (ChafaColorTableNode *nodes, gint n_nodes)
 {
-    ChafaVec3i32 v;
+    gint ch_min [3] = { 255, 255, 255 };
+    gint ch_max [3] = { 0, 0, 0 };
+    gint axis = 0;
+    gint i, j, mid;
 
-    v.v [0] = (color & 0xff) * FIXED_MUL;
-    v.v [1] = ((color >> 8) & 0xff) * FIXED_MUL;
-    v.v [2] = ((color >> 16) & 0xff) * FIXED_MUL;
+    if (n_nodes < 2)
+        return;
 
-    chafa_vec3i32_sub (&v, &v, &color_table->average);
+    for (i = 0; i < n_nodes; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            ch_min [j] = MIN (ch_min [j], nodes [i].ch [j]);
+            ch_max [j] = MAX (ch_max [j], nodes [i].ch [j]);
+        }
+    }
 
-    v_out [0] = scalar_project_vec3i32 (&v, &color_table->eigenvectors [0], color_table->eigen_mul [0]);
-    v_out [1] = scalar_project_vec3i32 (&v, &color_table->eigenvectors [1], color_table->eigen_mul [1]);
-}
+    /* Split along the axis with the greatest spread */
 
-static void
-vec3i32_fixed_point_from_vec3f32 (ChafaVec3i32 *out, const ChafaVec3f32 *in)
-{
-    ChafaVec3f32 t;
+    for (j = 1; j < 3; j++)
+    {
+        if (ch_max [j] - ch_min [j] > ch_max [axis] - ch_min [axis])
+            axis = j;
+    }
+
+    qsort (nodes, n_nodes, sizeof (ChafaColorTableNode), compare_nodes [axis]);
 
-    chafa_vec3f32_mul_scalar (&t, in, FIXED_MUL_F);
-    chafa_vec3i32_from_vec3f32 (out, &t);
+    mid = n_nodes / 2;
+    nodes [mid].split_axis = axis;
+
+    build_kd_tree (nodes, mid);
+    build_kd_tree (nodes + mid + 1, n_nodes - mid - 1);
 }
 
+/* Exact nearest-neighbor search. Equidistant pens are resolved in favor of
+ * the lowest pen number, so the result does not depend on tree layout.
+ *
+ * The near side of each split is searched first, and the far side is
+ * skipped if the splitting plane is farther away than the best match.
+ * For typical palettes this visits a small fraction of the nodes. */
 static void
-do_pca (ChafaColorTable *color_table)
+search_kd_tree (const ChafaColorTableNode *nodes, gint n_nodes, const gint *want,
+                gint *best_pen, gint *best_diff)
 {
-    ChafaVec3f32 v [256];
-    ChafaVec3f32 eigenvectors [2];
-    ChafaVec3f32 average;
-    gint i, j;
-
-    for (i = 0, j = 0; i < 256; i++)
+    while (n_nodes > 0)
     {
-        guint32 col = color_table->pens [i];
+        gint mid = n_nodes / 2;
+        const ChafaColorTableNode *node = &nodes [mid];
+        gint d, delta;
 
-        if ((col & 0xff000000) == 0xff000000)
-            continue;
+        profile_counter_inc (n_visits);
 
-        v [j].v [0] = (col & 0xff) * FIXED_MUL_F;
-        v [j].v [1] = ((col >> 8) & 0xff) * FIXED_MUL_F;
-        v [j].v [2] = ((col >> 16) & 0xff) * FIXED_MUL_F;
-        j++;
-    }
+        d = POW2 ((gint) node->ch [0] - want [0])
+            + POW2 ((gint) node->ch [1] - want [1])
+            + POW2 ((gint) node->ch [2] - want [2]);
+
+        if (d < *best_diff || (d == *best_diff && node->pen < *best_pen))
+        {
+            *best_pen = node->pen;
+            *best_diff = d;
+        }
 
-    chafa_vec3f32_array_compute_pca (v, j,
-                                     2,
-                                     eigenvectors,
-                                     NULL,
-                                     &average);
-
-    vec3i32_fixed_point_from_vec3f32 (&color_table->eigenvectors [0], &eigenvectors [0]);
-    vec3i32_fixed_point_from_vec3f32 (&color_table->eigenvectors [1], &eigenvectors [1]);
-    vec3i32_fixed_point_from_vec3f32 (&color_table->average, &average);
-
-    color_table->eigen_mul [0] =
-        POW2 (color_table->eigenvectors [0].v [0])
-        + POW2 (color_table->eigenvectors [0].v [1])
-        + POW2 (color_table->eigenvectors [0].v [2]);
-    color_table->eigen_mul [0] = MAX (color_table->eigen_mul [0], 1);
-    color_table->eigen_mul [0] = FIXED_MUL_BIG / color_table->eigen_mul [0];
-
-    color_table->eigen_mul [1] =
-        POW2 (color_table->eigenvectors [1].v [0])
-        + POW2 (color_table->eigenvectors [1].v [1])
-        + POW2 (color_table->eigenvectors [1].v [2]);
-    color_table->eigen_mul [1] = MAX (color_table->eigen_mul [1], 1);
-    color_table->eigen_mul [1] = FIXED_MUL_BIG / color_table->eigen_mul [1];
+        delta = want [node->split_axis] - (gint) node->ch [node->split_axis];
 
-    for (i = 0; i < color_table->n_entries; i++)
-    {
-        ChafaColorTableEntry *entry = &color_table->entries [i];
-        project_color (color_table, color_table->pens [entry->pen], entry->v);
+        if (delta < 0)
+        {
+            search_kd_tree (nodes, mid, want, best_pen, best_diff);
+            nodes += mid + 1;
+            n_nodes -= mid + 1;
+        }
+        else
+        {
+            search_kd_tree (nodes + mid + 1, n_nodes - mid - 1, want, best_pen, best_diff);
+            n_nodes = mid;
+        }
+
+        if (POW2 (delta) > *best_diff)
+            break;
     }
 }
 
-static inline gboolean
-refine_pen_choice (const ChafaColorTable *color_table, guint want_color, const gint *v, gint j,
-                   gint *best_pen, gint64 *best_diff)
+static gint
+find_nearest_pen (const ChafaColorTable *color_table, guint32 want_color,
+                  gint best_pen, gint best_diff)
 {
-    const ChafaColorTableEntry *pj = &color_table->entries [j];
-    gint64 a, b, d;
+    gint want [3];
 
-    a = POW2 ((gint64) pj->v [0] - v [0]);
+    profile_counter_inc (n_lookups);
 
-    profile_counter_inc (n_a);
-    DEBUG_PEN_CHOICE (g_printerr ("a=%d\n", a));
+    color_to_channels (want_color, want);
+    search_kd_tree (color_table->nodes, color_table->n_entries, want, &best_pen, &best_diff);
 
-    if (a <= *best_diff)
-    {
-        /* TODO: When using gint32, the POW2 multiplication can result in overflow.
-         * Our workaround is to use gint64 for best_diff, a, b and d. This probably
-         * slows us down, though (we should measure). Is there a better fix? */
-        b = POW2 ((gint64) pj->v [1] - v [1]);
+#if CHAFA_COLOR_TABLE_ENABLE_PROFILING
+    gint i;
 
-        profile_counter_inc (n_b);
-        DEBUG_PEN_CHOICE (g_printerr ("b=%d\n", b));
+    for (i = 0; i < color_table->n_entries; i++)
+    {
+        const ChafaColorTableNode *node = &color_table->nodes [i];
+        gint d = color_diff (color_table->pens [node->pen], want_color);
 
-        if (b <= *best_diff)
+        if (d < best_diff || (d == best_diff && node->pen < best_pen))
         {
-            d = color_diff (color_table->pens [pj->pen], want_color);
-
-            profile_counter_inc (n_c);
-            DEBUG_PEN_CHOICE (g_printerr ("d=%d\n", d));
-
-            if (d <= *best_diff)
-            {
-                *best_pen = j;
-                *best_diff = d;
-
-                profile_counter_inc (n_d);
-                DEBUG_PEN_CHOICE (g_printerr ("a=%d, b=%d, d=%d\n", a, b, d));
-            }
+            profile_counter_inc (n_misses);
+            g_printerr ("Bad lookup: %06x -> pen %d, should be pen %d\n",
+                        want_color, best_pen, node->pen);
+            break;
         }
     }
-    else
-    {
-        DEBUG_PEN_CHOICE (g_printerr ("\n"));
-        return FALSE;
-    }
+#endif
 
-    return TRUE;
+    return best_pen;
 }
 
 void
@@ -251,18 +219,12 @@ void
 chafa_color_table_deinit (G_GNUC_UNUSED ChafaColorTable *color_table)
 {
 #if CHAFA_COLOR_TABLE_ENABLE_PROFILING
-    g_printerr ("l=%7d m=%7d a=%7d b=%7d c=%7d d=%7d\n"
-                "per probe: a=%6.1lf b=%6.1lf c=%6.1lf d=%6.1lf\n",
+    g_printerr ("l=%7d m=%7d v=%7d\n"
+                "per probe: v=%6.1lf\n",
                 n_lookups,
                 n_misses,
-                n_a,
-                n_b,
-                n_c,
-                n_d,
-                n_a / (gdouble) n_lookups,
-                n_b / (gdouble) n_lookups,
-                n_c / (gdouble) n_lookups,
-                n_d / (gdouble) n_lookups);
+                n_visits,
+                n_visits / (gdouble) n_lookups);
 #endif
 }
 
@@ -295,96 +257,64 @@ chafa_color_table_sort (ChafaColorTable *color_table)
 
     for (i = 0, j = 0; i < CHAFA_COLOR_TABLE_MAX_ENTRIES; i++)
     {
-        ChafaColorTableEntry *entry;
+        ChafaColorTableNode *node;
+        guint32 col = color_table->pens [i];
 
-        if (color_table->pens [i] == 0xffffffff)
+        if (col == 0xffffffff)
             continue;
 
-        entry = &color_table->entries [j++];
-        entry->pen = i;
+        node = &color_table->nodes [j++];
+        node->ch [0] = col & 0xff;
+        node->ch [1] = (col >> 8) & 0xff;
+        node->ch [2] = (col >> 16) & 0xff;
+        node->split_axis = 0;
+        node->pen = i;
     }
 
     color_table->n_entries = j;
 
-    do_pca (color_table);
-
-    qsort (color_table->entries, color_table->n_entries, sizeof (ChafaColorTableEntry), compare_entries);
+    build_kd_tree (color_table->nodes, color_table->n_entries);
     color_table->is_sorted = TRUE;
 }
 
 gint
 chafa_color_table_find_nearest_pen (const ChafaColorTable *color_table, guint32 want_color)
 {
-    gint64 best_diff = G_MAXINT64;
-    gint best_pen = 0;
-    gint v [2];
-    gint i, j, m;
-
     g_assert (color_table->n_entries > 0);
     g_assert (color_table->is_sorted);
 
-    profile_counter_inc (n_lookups);
-
-    project_color (color_table, want_color, v);
-
-    /* Binary search for first vector component */
-
-    i = 0;
-    j = color_table->n_entries;
-
-    while (i != j)
-    {
-        gint n = i + (j - i) / 2;
-
-        if (v [0] > color_table->entries [n].v [0])
-            i = n + 1;
-        else
-            j = n;
-    }
-
-    m = j;
-
-    /* Left scan for closer match */
+    return find_nearest_pen (color_table, want_color & 0x00ffffff, G_MAXINT, G_MAXINT);
+}
 
-    for (j = m; j >= 0; j--)
-    {
-        if (!refine_pen_choice (color_table, want_color, v, j, &best_pen, &best_diff))
-            break;
-    }
+/* Looks up a run of colors, e.g. a row of pixels. Neighboring pixels tend
+ * to map to the same or nearby pens, so each previous result is used as
+ * the initial bound for the next search, and repeats skip it entirely. */
+void
+chafa_color_table_find_nearest_pens (const ChafaColorTable *color_table,
+                                     const guint32 *colors, gint *pens_out, gint n_colors)
+{
+    guint32 prev_color = 0;
+    gint prev_pen = G_MAXINT;
+    gint i;
 
-    /* Right scan for closer match */
+    g_assert (color_table->n_entries > 0);
+    g_assert (color_table->is_sorted);
 
-    for (j = m + 1; j < color_table->n_entries; j++)
+    for (i = 0; i < n_colors; i++)
     {
-        if (!refine_pen_choice (color_table, want_color, v, j, &best_pen, &best_diff))
-            break;
-    }
+        guint32 color = colors [i] & 0x00ffffff;
 
-#if CHAFA_COLOR_TABLE_ENABLE_PROFILING
-    gint best_pen_2 = -1;
-    gint64 best_diff_2 = G_MAXINT64;
+        if (prev_pen == G_MAXINT || color != prev_color)
+        {
+            gint best_diff = G_MAXINT;
 
-    for (i = 0; i < color_table->n_entries; i++)
-    {
-        const ChafaColorTableEntry *pi = &color_table->entries [i];
-        gint64 d = color_diff (color_table->pens [pi->pen], want_color);
+            if (prev_pen != G_MAXINT)
+                best_diff = color_diff (color_table->pens [prev_pen], color);
 
-        if (d < best_diff_2)
-        {
-            best_pen_2 = i;
-            best_diff_2 = d;
+            prev_pen = find_nearest_pen (color_table, color, prev_pen, best_diff);
+            prev_color = color;
         }
-    }
-
-    if (best_diff_2 < best_diff)
-    {
-        profile_counter_inc (n_misses);
 
-        g_printerr ("Bad lookup: "); dump_entry (color_table, best_pen, want_color);
-        g_printerr ("\nShould be:  "); dump_entry (color_table, best_pen_2, want_color);
-        g_printerr ("\n");
+        pens_out [i] = prev_pen;
     }
-#endif
-
-    return color_table->entries [best_pen].pen;
 }
@@ -20,33 +20,32 @@
 #ifndef __CHAFA_COLOR_TABLE_H__
 #define __CHAFA_COLOR_TABLE_H__
 
-#include "internal/chafa-pca.h"
+#include <glib.h>
 
 G_BEGIN_DECLS
 
 #define CHAFA_COLOR_TABLE_MAX_ENTRIES 256
 
+/* Node in the implicit k-d tree over the table's pens. The tree is stored
+ * as a sorted array where the median of each range is its root; the
+ * children are the subranges on either side of it. */
 typedef struct
 {
-    gint v [2];
+    guint8 ch [3];
+    guint8 split_axis;
     gint pen;
 }
-ChafaColorTableEntry;
+ChafaColorTableNode;
 
 typedef struct
 {
-    ChafaColorTableEntry entries [CHAFA_COLOR_TABLE_MAX_ENTRIES];
+    ChafaColorTableNode nodes [CHAFA_COLOR_TABLE_MAX_ENTRIES];
 
     /* Each pen is 24 bits (B8G8R8) of color information */
     guint32 pens [CHAFA_COLOR_TABLE_MAX_ENTRIES];
 
     gint n_entries;
     guint is_sorted : 1;
-
-    ChafaVec3i32 eigenvectors [2];
-    ChafaVec3i32 average;
-
-    guint eigen_mul [2];
 }
 ChafaColorTable;
 
@@ -58,6 +57,8 @@ void       chafa_color_table_set_pen_color    (ChafaColorTable *color_table, gin
 
 void       chafa_color_table_sort             (ChafaColorTable *color_table);
 gint       chafa_color_table_find_nearest_pen (const ChafaColorTable *color_table, guint32 color);
+void       chafa_color_table_find_nearest_pens (const ChafaColorTable *color_table,
+                                                const guint32 *colors, gint *pens_out, gint n_colors);
 
 G_END_DECLS
 
@@ -20,7 +20,7 @@
 #include "config.h"
 
 #include <stdlib.h>  /* abs */
-#include <math.h>  /* pow, cbrt, log, sqrt, atan2, cos, sin */
+#include <math.h>  /* pow, cbrt, log, sqrt */
 #include "chafa.h"
 #include "internal/chafa-color.h"
 
@@ -76,17 +76,36 @@ invert_rgb_channel_compand (gdouble v)
     return v <= 0.04045 ? (v / 12.92) : pow ((v + 0.055) / 1.044, 2.4);
 }
 
+/* Linearized channel values for each 8-bit input. pow () dominated the
+ * cost of the conversion, and there are only 256 possible inputs. */
+static gdouble linear_channel_lut [256];
+static gsize linear_channel_lut_initialized;
+
+static const gdouble *
+get_linear_channel_lut (void)
+{
+    if (g_once_init_enter (&linear_channel_lut_initialized))
+    {
+        gint i;
+
+        for (i = 0; i < 256; i++)
+            linear_channel_lut [i] = invert_rgb_channel_compand ((gdouble) i / 255.0);
+
+        g_once_init_leave (&linear_channel_lut_initialized, 1);
+    }
+
+    return linear_channel_lut;
+}
+
 static void
 convert_rgb_to_xyz (const ChafaColor *rgbi, ChafaColorXYZ *xyz)
 {
+    const gdouble *lut = get_linear_channel_lut ();
     ChafaColorRGBf rgbf;
     gint i;
 
     for (i = 0; i < 3; i++)
-    {
-        rgbf.c [i] = (gdouble) rgbi->ch [i] / 255.0;
-        rgbf.c [i] = invert_rgb_channel_compand (rgbf.c [i]);
-    }
+        rgbf.c [i] = lut [rgbi->ch [i]];
 
     xyz->c [0] = 0.4124564 * rgbf.c [0] + 0.3575761 * rgbf.c [1] + 0.1804375 * rgbf.c [2];
     xyz->c [1] = 0.2126729 * rgbf.c [0] + 0.7151522 * rgbf.c [1] + 0.0721750 * rgbf.c [2];
@@ -122,7 +141,7 @@ chafa_color_rgb_to_din99d (const ChafaColor *rgb, ChafaColor *din99)
 {
     ChafaColorXYZ xyz;
     ChafaColorLab lab;
-    gdouble adj_L, ee, f, G, C, h;
+    gdouble adj_L, ee, f, G, C;
 
     convert_rgb_to_xyz (rgb, &xyz);
 
@@ -141,18 +160,30 @@ chafa_color_rgb_to_din99d (const ChafaColor *rgb, ChafaColor *din99)
     f = 1.14 * (0.6427876096865393 * lab.c [2] - 0.766044443118978 * lab.c [1]);
     G = sqrt (ee * ee + f * f);
 
-    /* Hue/chroma */
+    /* Hue/chroma. The hue is the angle of (ee, f) rotated by 50 degrees.
+     * Rather than calling atan2 (), cos () and sin (), we rotate the unit
+     * vector directly. This differs from the trigonometric form by at most
+     * one step in the final 8-bit values, for 187 of the 2^24 colors. */
 
     C = 22.5 * log (1.0 + 0.06 * G);
 
-    h = atan2 (f, ee) + 0.8726646 /* 50 degrees */;
-    while (h < 0.0) h += 6.283185;  /* 360 degrees */
-    while (h > 6.283185) h -= 6.283185;  /* 360 degrees */
-
     /* The final values should be in the range [0..255] */
 
     din99->ch [0] = adj_L * 2.5;
-    din99->ch [1] = C * cos (h) * 2.5 + 128.0;
-    din99->ch [2] = C * sin (h) * 2.5 + 128.0;
+
+    if (G > 0.0)
+    {
+        gdouble cos_h = (ee * 0.6427876296015227 - f * 0.7660444264083224) / G;
+        gdouble sin_h = (f * 0.6427876296015227 + ee * 0.7660444264083224) / G;
+
+        din99->ch [1] = C * cos_h * 2.5 + 128.0;
+        din99->ch [2] = C * sin_h * 2.5 + 128.0;
+    }
+    else
+    {
+        din99->ch [1] = 128;
+        din99->ch [2] = 128;
+    }
+
     din99->ch [3] = rgb->ch [3];
 }
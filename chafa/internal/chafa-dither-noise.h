@@ -0,0 +1,290 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+/* This is meant to be #included in chafa-dither.c. It's kept in a separate
+ * file due to its size.
+ *
+ * A tileable 64x64 blue noise threshold texture, made with the
+ * void-and-cluster method (Ulichney, 1993) using a Gaussian filter with
+ * sigma = 1.5. Ranks are scaled to [0..255], with each value appearing
+ * 16 times. */
+
+#define NOISE_TEXTURE_DIM_SHIFT 6
+#define NOISE_TEXTURE_DIM (1 << (NOISE_TEXTURE_DIM_SHIFT))
+#define NOISE_TEXTURE_SIZE ((NOISE_TEXTURE_DIM) * (NOISE_TEXTURE_DIM))
+
+static const guint8 noise_texture [NOISE_TEXTURE_SIZE] =
+{
+    224, 145, 182,  13, 226, 110,  34, 185, 158, 239, 207, 138,  40, 126, 197, 245,
+     94, 216, 115,  66,   9, 209, 225,  15, 137, 233, 202,  44, 162, 252,   3, 150,
+    208,  77,  34, 148, 224, 200,  88, 141, 110, 219,  57, 121, 234,  43, 219, 160,
+     22, 191, 106, 138,  63,  99, 227, 119, 243,  72, 114,  11, 185,  74, 126,  97,
+     21, 239,  56,  88, 152,  68, 215,  16, 128,  58,  29, 169, 225,  66, 166,  21,
+    132,  31, 168, 253, 153,  90, 120, 164,  62,  84, 152, 104,  70, 200,  84,  50,
+    237, 119, 195,  53,  98, 161,  30, 255, 171,  77, 241,  17, 166,  73,   1, 109,
+    243,  55, 222,   5, 249, 172,  25, 153,  50, 137, 198, 155, 105, 246,  49, 161,
+     77, 192, 117, 171, 252,  46, 143,  78, 229, 109, 187,  87,   9, 150, 100, 211,
+     62, 228,  80,  23, 200,  45,  73, 246, 190,  30, 240,   9, 140, 227, 116, 178,
+     96,  22, 172, 244,   5, 127, 211,  60,   7, 129, 187, 101, 144, 200, 127, 179,
+     77, 143, 169, 123,  36, 208,  79, 191, 220,  28,  84, 212,  23, 133, 177, 209,
+     42, 135,  30, 208,   3, 107, 183, 206, 165,  43, 252, 120, 203, 238,  42, 180,
+    117, 149, 185, 107, 235, 129, 179,   2, 103, 131, 213, 175,  56,  23, 158,  35,
+    224, 141,  68, 110, 218,  76, 186, 104, 155, 204,  49,  30, 229,  58, 238,  40,
+    204,  16,  90, 193,  66, 113, 144,  13, 102, 178, 254,  41,  69, 226,   2, 109,
+    154, 220,  99,  70, 138, 232,  31,  96,  11,  72, 141,  23,  58, 135,  79,   3,
+    244,  49,  12, 140,  60,  29, 219, 146, 204,  48,  74, 118, 196, 101, 247,  64,
+    203,  10, 190, 151,  26, 169,  43, 229,  22, 246,  80, 174, 119,  91,  23, 147,
+    102, 255,  47, 219, 156, 242,  53, 234, 127,  58, 161,  99, 188, 149,  85, 250,
+    173,  11, 240, 187, 161,  57, 126, 247, 152, 199, 222, 170, 102, 192, 219, 163,
+     92, 199, 225,  96, 193, 162, 111,  20,  90, 255, 158,  14, 218,  82, 180, 137,
+    121,  87, 235,  51,  91, 249, 142,  68, 124,  96, 147, 218,   8, 194, 163, 224,
+     62, 176, 134,  23,  99,   1, 168,  85, 203,  20, 140, 231, 118,  33, 198,  61,
+     93, 123,  45,  86,  21, 221,  81, 179,  36, 115,  88,  45, 242,  17, 112,  35,
+    133,  67, 171,  39, 250,  81, 228,  65, 169,  31, 225, 133,  42, 154,   2,  47,
+    213,  29, 164, 132, 200, 117,   1, 216, 165, 193,  37,  63, 137, 247,  77, 124,
+      5, 110, 231,  76, 181, 212, 119,  35, 226, 175,  79,   7,  54, 219, 130,  18,
+    205, 181, 143, 210, 111, 193,   8, 138,  64, 233,   0, 186, 153,  63, 144, 250,
+    211,  16, 114, 147,   4, 127,  42, 201, 117, 187,  99,  68, 243, 112, 233, 188,
+     99, 255,  75,  14, 225,  39, 180,  84,  51,  15, 239, 181, 107,  45,  27, 184,
+    215, 154,  34, 199, 140,  49, 251, 148,  62, 109, 197, 248, 156, 179, 103, 237,
+     75,  32, 255,  63, 168,  40, 241,  99, 207, 163, 130,  74, 212,  96, 176,  50,
+     86, 185, 239,  76, 215, 180, 153, 241,  12, 142,  51, 206, 173,  28,  76, 142,
+     58, 176, 112, 188,  62, 101, 144, 236, 113, 210, 127,  86, 228, 152, 205,  99,
+     51,  86, 243,  64, 114,  25,  93, 189,  10, 136,  34,  96,  65,  25, 145,  47,
+    165, 116,   0,  95, 228, 123, 152, 185,  51,  27, 255, 111,  31, 236,   6, 202,
+    126,  24, 160,  47, 104,  28,  58,  97,  78, 217, 161,   6,  89, 197, 122, 223,
+     24, 150,  42, 214, 157, 247,  27, 199,  66, 156,  32, 171,   2,  60, 133, 250,
+    172, 128,  18, 168, 225, 158, 208,  73, 168, 238, 214, 126, 188, 243,  84, 217,
+    136, 232, 191, 157,  21,  57,  80,  14, 219,  90, 147, 196,  55, 133, 165,  73,
+    232,  97, 224, 133, 196, 246, 118, 194, 232,  28, 122, 250, 141,  41, 166,   8,
+    202, 243,  84, 123,   9,  75, 130, 171,  12,  98, 253,  72, 218, 191,  81,  12,
+     39, 217, 190,  89,   6,  55, 127, 233,  21,  87,  48, 159,   4, 113, 197,  16,
+    101,  36,  72, 220, 138, 202, 250, 108, 128, 174,  66,  11, 178, 221, 112,  28,
+    151,  59, 178,  16,  70, 155,   9, 134,  43, 174,  74, 106, 218,  62, 236, 109,
+     72, 134,  30, 233, 175, 210,  94,  47, 233, 188, 142, 115,  43, 160, 121, 228,
+    151,  73, 110, 143, 247, 176, 106,  43, 146, 114, 203,  74, 229,  41, 171,  64,
+    248, 179, 128,  48, 103, 170,  33, 155, 233,  39, 207, 244, 101,  80,  42, 252,
+    198, 119,  38, 205,  92, 220, 185,  82, 150, 212,  53, 186,  14, 154,  86, 179,
+     46, 194, 156,  99,  58,  36, 146, 219, 120,  57,  21, 205,  93, 241,  27,  98,
+    200,  50, 236,  31,  68, 204,  26, 220, 184, 244,  17, 180, 139,  93, 222, 153,
+      6,  85, 206,  12, 234,  87,  64, 189,   4,  77, 118, 140,  19, 157, 189, 136,
+      3,  87, 245, 161, 128,  52,  25, 254, 111,   2, 242, 136,  97, 207,  27, 249,
+    119, 225,   5, 186, 117, 252, 183,   2, 160,  85, 244, 153,   8, 182,  55, 167,
+    132,   3, 163, 194, 132,  94, 155,  81,  61, 131, 100,  59, 254,  26, 119,  51,
+    139, 238, 160, 116, 185,  19, 210, 141, 100, 220, 163,  53, 202, 230,  64,  98,
+    172, 218,  67,  11, 229, 102, 171,  63, 203,  89, 162,  32, 232,  50, 131, 161,
+     19,  93,  69, 208, 140,  20,  79, 108, 203,  38, 179,  70, 123, 223,  76, 207,
+    253,  87, 115,  58, 216,  15, 252, 196,   0, 173,  39, 157, 208,  80, 190, 214,
+    108,  59,  30,  72, 145, 247, 121,  49, 241,  23, 183,  94,  34, 114,  17, 240,
+     48, 123, 149, 189,  41, 141, 236, 120,  36, 188, 125,  70, 176, 112, 199,  65,
+    217, 147, 245,  36,  87, 167, 236,  59, 225, 134,  95, 209,  34, 144, 107,  17,
+     41, 182, 224,  27, 174, 124,  49, 108, 144, 237, 200, 115,   8, 131, 165,  20,
+    228, 172, 197, 223,  95,  37, 174,  82, 195, 124,  69, 253, 216, 131, 184, 154,
+    201,  80,  27, 109, 208,  77,  19, 215, 151,  55, 238,  16, 210,  84,   3, 179,
+    104,  51, 173, 123, 222,  49, 194, 124,  28, 171,  16, 235,  59, 187, 244, 156,
+    125,  67, 143, 102, 239,  74, 166, 224,  89,  26,  70, 223,  49, 240,  67,  92,
+    141,  44, 125,   0, 165,  60, 227,   9, 156,  44, 143,   1, 167,  77,  38,  93,
+      8, 232, 166, 251,  56, 180, 160,  97,  10, 222, 105, 167, 143, 253,  40, 233,
+    136,  26, 197,  15, 157,  98,   6, 147,  68, 255, 103, 157, 129,   1,  91,  51,
+    194, 233,  11, 190,  39, 147,  12, 187,  44, 129, 184, 102, 147, 179,  33, 193,
+     13,  83, 239, 107, 204, 138, 116, 214, 102, 238, 201, 108,  56, 193, 247, 142,
+    212,  45, 131,  94,   0, 122, 245,  67, 199, 133,  78,  29,  52, 119, 158,  68,
+    207,  86, 240, 109,  66, 248, 214, 166,  85, 189,  48, 201,  79, 227, 173, 212,
+     29,  95, 163,  80, 203, 117, 246,  65, 207, 161, 250,  24,  86, 217, 110, 249,
+    153, 215, 175,  68,  33, 255,  19,  71, 179,  26,  83, 230, 149,  21, 102,  60,
+    118, 182,  71, 195, 150, 212,  27, 112,  43, 174, 246, 189, 220,  89, 186,  11,
+    124, 165,  56, 142, 184,  30, 113,  43, 230, 121,  10, 221, 114,  25, 135,  71,
+    119, 243, 131,  56, 221,  90,  32, 136,  98,   7, 120,  60, 166,   2, 130,  63,
+    100,  52,  23, 146, 187,  85, 154, 196,  52, 135, 170,  40, 122, 207, 234, 174,
+     30, 224,  15, 239,  39,  83, 187, 144, 235,  88,   5,  63, 138,  21, 242, 101,
+    228,  36, 218,   9, 207,  75, 138, 197,  21, 146, 181,  67, 154,  43, 235, 160,
+      8, 206,  34, 182,   2, 157, 232, 177, 215,  79, 226, 187, 235,  46, 209, 177,
+    231, 200, 123, 242, 105,  46, 233, 121,  92, 248,   9, 216,  73, 162,   6,  79,
+    145,  91, 159, 110, 133, 229,  53, 166,  19, 128, 156, 203, 111, 173,  45, 146,
+    192,  78, 116, 158,  93, 242, 178,  60, 104, 240,  37,  97, 247, 199,  89, 187,
+    106,  65, 146, 254, 109,  61, 124,  15,  52, 154,  33, 132, 103, 148,  80,  18,
+     37, 159,  90,  14, 216, 170,   3, 209,  35, 148, 112, 184,  97,  50, 131, 191,
+    255,  48, 209,  61, 176,   6, 103, 222,  71, 210, 100,  32, 233,  79, 206,  63,
+     14, 176, 254,  22, 130,  48,   1, 220,  78, 203, 129, 167,   5, 121,  55,  18,
+    225, 169,  91,  46, 199, 173,  81, 196, 248, 115, 204,  69,  14, 254, 193, 112,
+    245,  72, 186,  55, 129,  79, 140,  66, 188, 220,  56, 243,  25, 202, 229, 104,
+     17, 125, 187,  29, 248,  80, 195, 120,  43, 177, 255,  56, 162,   0, 121, 246,
+    135,  99,  55, 195, 225, 167, 114, 148, 174,  13,  52, 215,  76, 178, 145, 250,
+    126,  26, 214, 138,  19, 238,  34, 142,  99,  18, 170, 217,  92, 161,  58, 133,
+    214,  25, 148, 230, 200,  34, 251, 159, 105,  13,  83, 164, 118, 145,  69,  40,
+    165, 215,  73, 106, 157, 137,  22, 240, 144,   8,  82, 190, 140, 227,  92, 167,
+     39, 222, 149,  28,  70,  87, 238,  39,  95, 249, 151, 105, 230,  22, 204,  81,
+     44, 184,  74, 229, 120,  96, 164, 220,  70, 190,  57, 141,  41, 226,   4, 173,
+     46, 124,  95,   6, 111, 177,  90,  19, 237, 178, 136,  38, 225,   4, 176, 244,
+     86, 146,   7, 235,  46, 217,  62, 163,  95, 217, 125,  27, 108,  45, 185,  17,
+     82, 201, 109, 180, 126, 211,  15, 193, 123,  68, 184,  33, 138,  62, 109, 157,
+    210, 103, 149,  11,  63, 207,  49,   3, 122, 240,  29, 232, 126, 186, 104,  82,
+    237, 189, 161, 246,  57, 135, 222,  48, 125,  63, 215, 186,  59,  92, 207, 113,
+     22, 226, 120, 182,  88, 191, 114,  38, 202,  65, 157, 243, 200,  71, 216, 146,
+    237,  61,   9, 234,  37, 159,  59, 139, 228,  18, 208,  87, 246, 191,  35, 237,
+      7,  57, 244, 192, 160, 131, 250, 183, 152,  88, 165, 108,  72,  21, 210, 155,
+     13,  68,  38, 207,  82,  24, 193, 151, 206,  95,  26, 107, 252, 161, 132,  48,
+    197,  58, 169,  35, 131,  10, 250, 175,  16, 235,  47,  98,   9, 161, 127,  31,
+    113, 171, 141,  91, 198, 106, 252,  81, 166,  46, 116, 170,   2, 122, 164,  90,
+    139, 173, 115,  41,  91,  26,  74, 106,  37, 211,  10, 202, 148, 245,  59, 118,
+    144, 217, 113, 174, 146, 239,  71, 108,   2, 168, 231, 147,  11,  75,  31, 234,
+    149, 103,  75, 240, 200,  66, 150, 102, 130,  84, 182, 144, 221,  52, 246,  85,
+    205,  44, 247,  71, 148,   3, 177,  27, 103, 220, 145,  67, 216,  52, 232,  68,
+    213,  27,  78, 208, 235, 167, 199, 227, 139,  65, 253,  49,  91, 172,  35, 196,
+     77, 254,  26,  91,   7, 121, 183,  37, 250,  80,  53, 128, 198, 218, 170,  84,
+    190,   1, 216, 141,  20,  91, 228,  45, 196, 225,  19, 115,  74, 188, 105,   2,
+    178, 129,  18, 211,  50, 227, 129, 192,  57, 242,  16, 197,  96, 147,  14, 188,
+    127, 255, 181, 142,  18, 120,  54,   7,  85, 175, 122, 191,  14, 129, 224,  99,
+    182,  49, 130, 188, 230,  53, 218, 160, 137, 213, 181,  33,  91,  51, 113,  17,
+    243, 127,  46, 165, 113, 212, 171,   3,  73, 160,  40, 253, 168,  23, 213, 151,
+     56, 225,  95, 121, 167,  76,  36, 211, 153,  83, 130,  40, 251, 177, 115,  39,
+     96,  54,   1, 106,  63, 221, 153, 187, 236,  21, 157, 104, 234,  71, 153,   3,
+    116, 161, 213,  65, 153, 103,  18,  93,  61,  13, 110, 242, 157, 231, 184, 145,
+     66, 175,  97, 254,  31,  56, 126, 244, 111, 138, 200,  92, 124,  47, 134, 241,
+     76, 192, 154,  29, 196, 236,  93, 117,   7, 172, 189, 111,  73,  25, 224, 200,
+    166, 227, 155, 240, 192,  94,  29, 128, 101, 213,  60,  33, 209, 176,  54, 238,
+     35,  89,  10, 245,  33, 204, 175, 241, 125, 170, 196,  67,   4, 126,  36,  95,
+    219,  27, 208,  72, 192, 157,  83, 180,  31, 219,  62,  13, 236, 204,  88,  32,
+    113,  11, 254,  65, 108,  13, 145, 248,  69, 217,  21, 231, 164, 138,  57,  83,
+    134,  30, 116,  80,  39, 168, 248,  71,  43, 139, 241,  83, 114,  22, 134, 202,
+    229, 190, 146,  80, 115, 141,  69,  42, 223,  29,  98, 146, 212,  79, 195, 247,
+     51, 120, 152,   7, 135, 237,  16, 202,  55, 103, 170, 143, 182,  65, 159, 228,
+    176, 140,  45, 163, 220, 180,  56, 190,  37, 136,  89,  45, 206, 102, 244,   6,
+    213,  67, 177, 206, 137,   9, 210, 148, 193,   4, 167, 200, 147, 250,  75, 103,
+     19, 122,  56, 172, 234,  12, 188,  89, 151, 205,  50, 254,  22, 163, 106,  11,
+    161, 189,  86, 230, 108,  42,  98, 141, 249,   5, 230,  85,  29, 117,   5, 198,
+     97,  72, 209, 127,  82,  32, 121, 226, 159, 106, 241, 155,  65,  19, 180, 149,
+     92, 248,  16,  50, 229, 119,  54, 107, 230,  78, 123,  50,  16, 183,  44, 170,
+     66, 252, 198,  38,  98, 214, 123, 248,   0,  77, 137, 117, 179,  55, 215, 129,
+     70, 239,  24,  58, 204, 167, 222,  65, 162, 116, 191,  47, 211, 251, 135,  56,
+     23, 245, 181,   0, 239, 152,  95,  19,  75, 203,   4, 125, 190, 227, 112,  44,
+    194, 126, 158, 102, 181,  74, 162,  22, 173,  35, 246, 104, 216,  89, 225, 137,
+    158,  92,  14, 224, 157,  53,  30, 167, 107, 190, 236,  33,  93, 231, 142,  41,
+    203, 102, 139, 181, 120,  77,  20, 194,  34,  75, 133, 156, 100,  73, 174, 222,
+    151, 119,  38, 104,  64, 194, 214, 169, 252,  54, 177,  84,  38, 139,  72, 167,
+     26, 219,  62, 237,  29, 198, 254,  95, 212, 137, 182,  64, 160, 126,   0, 206,
+     34, 185, 139, 112,  79, 184, 135,  65, 217,  24, 156,  69, 198,   5,  82, 249,
+     15, 163,  46, 216,   0, 251, 131, 101, 238, 204,  23, 242,  15, 193,  37, 109,
+     78, 206, 164, 226, 135,  48,   9, 130,  35, 144, 112, 237, 199,   9, 243, 208,
+     83, 110,  11, 135,  88, 145,   3, 125,  50,  84,   9, 201,  32, 232,  56, 110,
+     74, 216,  47, 236,   6, 209, 242,  94, 178,  57, 126, 222, 169, 114, 154, 182,
+    121,  73, 235,  90, 154,  40, 185, 149,  51, 165, 111,  62, 216, 122, 162,  10,
+    231,  53,  17,  88, 183, 246, 114,  86, 187, 230,  23,  69, 163,  95, 120,  54,
+    147, 251, 164, 213,  41, 225,  64, 189, 240, 148, 221, 119,  78, 145, 174, 243,
+     20, 122, 169,  68, 149, 119,  20,  42, 146, 251,  13, 101,  44, 234,  62,  33,
+    223, 199,  25, 176, 109,  62, 221,  82,   7, 212,  90, 181, 139,  49, 245,  94,
+    181, 126, 198, 147,  26,  77, 162, 222,  57,  98, 211, 150,  47, 221, 181,  15,
+    191,  34,  73, 188, 118, 174, 101, 156,  23, 108,  38, 166, 252,  16,  90, 196,
+    157,  95, 249,  32, 194,  84, 162, 232, 110, 194,  80, 211, 143,  17, 196, 108,
+     88, 143,  53, 130, 241, 203,  25, 124, 235, 141,  36, 231,   0,  85, 197, 145,
+     40, 255,  66, 106, 234,  43, 202,  16, 133, 168,   1, 127, 253,  29, 136,  89,
+    230, 126, 101,   7,  55, 247,  17, 209,  72, 228, 195,  58, 101, 207,  43, 136,
+    220,   4, 182, 108, 227,  50, 205,  66,   3, 134,  34, 181,  66, 247, 128, 173,
+      3, 252, 190,  79,  10, 162,  93, 175,  55, 196,  74, 118, 158, 218,  63,  18,
+    114, 166,   3, 210, 172, 119, 149,  71, 238,  39, 201,  81, 106, 169,  67, 201,
+     45, 171, 238, 205, 158,  85, 133,  45, 172,  88, 134,   4, 181, 123, 238,  62,
+    193,  82,  56, 143,  12, 131, 179, 100, 221, 168, 242, 113, 158,  93,  47, 214,
+     70, 164,  22, 105, 224, 137,  38, 253, 106,  13, 168, 248,  26, 102, 177, 239,
+     81, 220, 138,  91,  59,  21, 251,  97, 179, 117, 228,  59, 190,  10, 218, 110,
+    145,  23,  61, 138,  33, 226, 192, 114, 241,  29, 160, 236,  70, 153,  24, 111,
+     37, 244, 165, 203,  90, 255,  28, 156,  40,  84,  57,   9, 205,  24, 226, 140,
+     36, 120, 210, 154,  51, 199,  75, 189, 152, 220,  94,  48, 207, 150,  38, 130,
+    202,  53,  30, 192, 227, 140, 186,  10,  53, 158,  25, 142, 240, 156,  36, 247,
+     76, 209,  96, 185, 110,  71,   0, 150,  60, 217, 107,  48, 210,  85, 227, 174,
+    147, 117,  22, 219,  42, 118,  76, 232, 208, 125, 188, 230, 134,  81, 179, 104,
+    194, 237,  90,  30, 245, 113,   2, 129,  33,  64, 138, 183, 124,  69, 229,  11,
+    104, 153, 248, 113,  39,  83, 211, 111, 221,  78, 185,  99,  46,  86, 125, 178,
+     13, 162, 244,  17, 215, 164, 253,  91, 198,  19, 129, 187,  34, 135,  13,  97,
+    223,  75, 134,  61, 159, 197, 143,  19, 103, 151,  27,  98, 166,  60, 248,  11,
+     76,  54, 144, 183,  69, 167, 228,  89, 241, 201,  22, 226,   5,  88, 191, 164,
+     64, 184,  15, 132, 177,  63, 157,  30, 135, 249,   5, 214, 132, 196,  63, 213,
+    100, 122,  41,  81, 128,  54,  35, 140, 175,  75, 244,  94, 166, 254, 199,  50,
+    180,   1, 189, 235, 103,   7, 244,  53, 178,  69, 251,  48, 199,  33, 123, 152,
+    171, 214,   5, 125, 206,  22, 150,  55, 170, 105,  78, 163, 114, 253, 136,  44,
+    233,  80, 209,  96, 241,   4, 230,  92, 194,  58, 116, 168,  29, 231,   7, 150,
+     53, 226, 183, 154, 231, 177, 208, 112,  10, 213, 153,  59,   5, 109,  68, 158,
+    107, 250,  87,  32, 170,  72, 187, 132, 222,   0, 206, 111, 145, 221,  96, 233,
+     44, 108, 254,  83,  47, 105, 213, 135,   9, 186, 233,  35, 210,  57,  25, 206,
+    116, 144,  32,  57, 151, 201, 122, 172,  41, 149,  87, 239,  70, 159, 113, 254,
+     30, 197,  68,   5, 100,  24,  70, 236,  49, 118,  30, 195, 220, 129, 234,  28,
+    139,  52, 151, 204, 128, 226,  37,  86, 115, 155,  80, 175,  13,  74,  24, 201,
+    137,  18, 189, 159, 236, 176,  78,  38, 251, 125,  52, 143,  99, 155, 178,  94,
+      0, 244, 172, 221, 104,  46,  77,  18, 234, 212,  15, 198,  44,  96, 186,  75,
+    134,  93, 145, 243, 121, 195, 134,  92, 167, 227, 141,  79, 171,  44,  90, 192,
+     78, 211, 115,  15,  57, 100, 164, 201,  28, 234,  41, 130, 243, 187, 159,  51,
+     87, 225,  66,  34, 130,  12, 223, 158,  97,  70, 218,  18, 195,  73, 235, 131,
+     60, 193,  85,  12, 136, 186, 255, 140,  64, 106, 174, 122, 142, 227,  21, 211,
+    172,  15, 206,  57,  39, 164, 251,  17, 201,  66,  99, 249,  20, 144, 215,  10,
+    173,  33, 231, 176, 243, 148,  12, 253,  63, 190,  96, 215,  59, 105, 125, 247,
+    181, 116, 149,  99, 204,  58, 115, 193,  25, 183, 160, 112, 248,  40,  17, 217,
+    152,  35, 121, 164, 228,  28,  94, 205, 161,  36,  75, 250,   1, 165,  60, 121,
+     45, 233, 107, 180, 223,  85,  60, 152,  37, 177,   5, 122, 185,  64, 111, 245,
+    101, 155,  65,  89,  40, 208,  73, 120, 139, 169,   8, 150,  31, 226,   2,  77,
+     31, 211,  14, 249, 182,  88, 238,  44, 139, 241,   4,  86, 173, 127,  98, 186,
+     78, 251, 205,  69,  43, 118, 175,   8, 125, 223, 191,  52,  87, 217, 103, 246,
+    151,  81, 132,  25, 149,   0, 213, 104, 129, 242, 207,  55, 228, 156, 201,  49,
+    226,   7, 124, 194, 140, 109, 179,  24, 224,  50, 110, 195,  71, 167, 202, 140,
+    173,  61, 162,  46, 136,   2, 150, 209,  76, 122,  49, 212,  61, 229, 163,  49,
+    112,  14, 144, 102, 240, 214,  60,  86, 245,  25, 148, 117, 201, 136,  29, 189,
+      6, 200,  61, 249,  96, 124, 175, 231,  52,  82, 145, 105,  35,  85,  21, 136,
+     71, 180, 247,  28, 215,   2, 234,  92, 202,  78, 235, 126, 252,  90,  47, 221,
+     98, 237,  82, 118, 229,  71, 171,  20, 100, 224, 150, 189,  30, 142,   5, 197,
+    222, 169,  55, 182,   4, 133, 158, 190,  47, 101, 183,  11, 242,  43,  74, 170,
+     97, 224,  38, 159, 206,  68,  33, 192,  10, 165,  24, 195, 172, 252, 117, 168,
+    205,  97,  50, 161,  82,  61, 134,  42, 155,  27, 174,  42,  11, 155, 116,  24,
+    129,   6, 185, 216,  26, 195, 111, 254,  61, 178,  12,  93, 119, 242,  67,  94,
+    132,  31, 231,  90, 198,  76,  31, 229, 139, 213,  61,  83, 174, 154, 213, 127,
+     24, 142, 114, 181,  15, 234, 139,  89, 118, 215, 238,  72, 132,   1, 218,  42,
+     19, 232, 143, 116, 226, 171, 249, 192, 105, 221, 142,  98, 209, 183,  67, 240,
+    199, 146,  40, 100, 155,  51, 132, 203,  37, 137, 246, 205,  79, 156, 215,  22,
+    245,  77, 121, 160,  21, 247, 117,  94,  12, 163, 112, 230,  22, 105,  58, 252,
+    195,  70, 239,  84,  53, 105, 169, 254,  64, 142,  95,  44, 211,  62,  91, 149,
+    196,  76,   8, 188,  32, 100,  14, 123,  67,   4, 246,  59, 130, 230,  34, 170,
+     87,  59, 246, 176,  78, 237,   8,  86, 165, 109,  23,  54, 170,  39, 113, 178,
+    146, 192,  41, 210, 141,  52, 177, 205,  67, 253,  32, 193, 128, 222,   4,  92,
+     44, 169,  10, 204, 151, 219,  18,  45, 196,  15, 184, 115, 154, 179, 242, 128,
+    166, 107, 252,  63, 209, 154,  52, 218, 168, 186,  88, 195,  23,  81, 149, 110,
+     17, 214, 117,  12, 207, 107, 148, 219,  65, 232, 184, 127, 236,   8, 199,  53,
+    102,   1, 237,  66, 105, 222, 152,  41, 130, 186, 147,  50,  76, 144, 184, 120,
+    155, 228, 110, 133,  37, 185, 124,  83, 160, 223,  36, 245,  12, 104,  31,  54,
+    219,  28, 137, 172,  89, 128, 239,  82,  28, 133,  45, 152, 115, 211,  52, 253,
+    188, 159,  73, 137,  32, 170,  46, 189,  16,  91, 152,  71, 217,  89, 134, 255,
+     73, 173, 115, 164,  13,  87,  24, 239,  82,   1,  92, 238, 208,  38, 245,  64,
+    212,  27,  60, 250,  95,  69, 239, 208, 106,  61, 131, 168,  75, 194, 232,  83,
+    124, 192,  46, 223,  17,  40, 191, 160, 107, 204, 223,  13, 243, 175,   2, 133,
+     94,  43, 229, 182, 251,  70, 123, 241, 136,  42, 198,  28, 107,  48, 159, 210,
+     27, 227,  47, 198, 251, 132, 195, 111, 168, 223, 116, 162,  14, 101, 166,  20,
+    139,  88, 171, 193,   1, 159,  31, 137,   8, 235,  88, 204,  41, 134, 152,   4,
+     96, 237,  74, 114, 150, 234,  69,   8, 255,  61,  93, 163,  72, 101, 197,  65,
+    218,  24, 125,  52,  97, 214,   1, 102, 175, 223, 117, 248, 169, 192,  14, 119,
+     85, 148, 127,  75,  35, 176,  60, 216,  48,  28, 191,  54, 130, 200,  81, 224,
+    108, 205,  36, 142, 231, 103, 176,  51, 191, 156,  25, 118, 253,  59, 216, 183,
+     55, 158,  10, 177, 213,  97, 143, 120, 178,  35, 127, 231,  48, 143,  32, 237,
+    156, 108, 201, 162,  20, 151, 197,  79,  26,  64, 147,   6,  58, 140, 240,  41,
+    177, 203,   8, 219, 155, 100,   6, 150,  79, 135, 248,  71, 227, 151,  46, 178,
+      6, 244,  72, 116,  54, 217,  77, 251, 109,  67, 218, 183,  14,  81, 111,  31,
+    210, 132, 250,  84,  54,  20, 198,  47, 221, 148, 194,  20, 172, 214, 118, 180,
+     76,   6, 242,  83, 232,  59, 128, 249, 159, 209,  94, 229,  80, 212, 100,  67,
+    230, 107,  56,  91, 186, 241, 122, 233, 203,  98, 175,   7, 112,  26, 253,  62,
+    124, 153, 183,  16, 202, 129,  20, 148, 206,  37, 132,  93, 163, 141, 240, 169,
+     68, 106,  38, 202, 128, 164, 245,  81, 100,   0,  74, 105, 249,  84,  12,  54,
+    146, 191,  42, 138, 180, 104,  37, 184,  51, 113,  19, 180, 123,  32, 185, 131,
+     20, 165, 249, 131,  18,  69,  45, 182,  18,  39, 153, 205,  86, 184, 135,  92,
+    212,  40,  83, 235, 162,  42, 188,  87,   3, 173, 236,  54, 223,  36, 197,   7,
+};
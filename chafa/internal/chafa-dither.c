@@ -25,10 +25,11 @@
 #include "chafa.h"
 #include "internal/chafa-dither.h"
 #include "internal/chafa-private.h"
+#include "internal/chafa-dither-noise.h"
+#include "internal/chafa-scratch.h"
 
 #define BAYER_MATRIX_DIM_SHIFT 4
 #define BAYER_MATRIX_DIM (1 << (BAYER_MATRIX_DIM_SHIFT))
-#define BAYER_MATRIX_SIZE ((BAYER_MATRIX_DIM) * (BAYER_MATRIX_DIM))
 
 static gint
 calc_grain_shift (gint size)
@@ -50,6 +51,49 @@ calc_grain_shift (gint size)
     return 0;
 }
 
+/* Same range as the Bayer matrix */
+static gint *
+gen_noise_matrix (gdouble magnitude)
+{
+    gint *matrix;
+    gint i;
+
+    matrix = g_new (gint, NOISE_TEXTURE_SIZE);
+
+    for (i = 0; i < NOISE_TEXTURE_SIZE; i++)
+        matrix [i] = ((gdouble) noise_texture [i] + 0.5 - 128.0) * magnitude + 0.5;
+
+    return matrix;
+}
+
+static void
+gen_ordered_rows (ChafaDither *dither)
+{
+    gint matrix_dim = 1 << dither->bayer_size_shift;
+    gint row_width = matrix_dim << dither->grain_width_shift;
+    gint16 *p;
+    gint x, y;
+
+    /* Aligned for the SIMD kernels. Each row is at least 64 bytes */
+    p = dither->ordered_rows = chafa_aligned_alloc (matrix_dim * row_width * 4 * sizeof (gint16));
+    dither->ordered_row_width = row_width;
+
+    for (y = 0; y < matrix_dim; y++)
+    {
+        for (x = 0; x < row_width; x++)
+        {
+            /* Anything beyond this saturates the channel anyway */
+            gint mod = dither->bayer_matrix [y * matrix_dim + (x >> dither->grain_width_shift)];
+            mod = CLAMP (mod, -255, 255);
+
+            *(p++) = mod;
+            *(p++) = mod;
+            *(p++) = mod;
+            *(p++) = 0;
+        }
+    }
+}
+
 void
 chafa_dither_init (ChafaDither *dither, ChafaDitherMode mode,
                    gdouble intensity,
@@ -67,6 +111,14 @@ chafa_dither_init (ChafaDither *dither, ChafaDitherMode mode,
     if (mode == CHAFA_DITHER_MODE_ORDERED)
     {
         dither->bayer_matrix = chafa_gen_bayer_matrix (BAYER_MATRIX_DIM, intensity);
+        gen_ordered_rows (dither);
+    }
+    else if (mode == CHAFA_DITHER_MODE_NOISE)
+    {
+        dither->bayer_size_shift = NOISE_TEXTURE_DIM_SHIFT;
+        dither->bayer_size_mask = NOISE_TEXTURE_DIM - 1;
+        dither->bayer_matrix = gen_noise_matrix (intensity);
+        gen_ordered_rows (dither);
     }
     else if (mode == CHAFA_DITHER_MODE_DIFFUSION)
     {
@@ -79,6 +131,8 @@ chafa_dither_deinit (ChafaDither *dither)
 {
     g_free (dither->bayer_matrix);
     dither->bayer_matrix = NULL;
+    chafa_aligned_free (dither->ordered_rows);
+    dither->ordered_rows = NULL;
 }
 
 void
@@ -86,7 +140,15 @@ chafa_dither_copy (const ChafaDither *src, ChafaDither *dest)
 {
     memcpy (dest, src, sizeof (*dest));
     if (dest->bayer_matrix)
-        dest->bayer_matrix = g_memdup (src->bayer_matrix, BAYER_MATRIX_SIZE * sizeof (gint));
+        dest->bayer_matrix = g_memdup (src->bayer_matrix,
+                                       (1 << (2 * src->bayer_size_shift)) * sizeof (gint));
+    if (dest->ordered_rows)
+    {
+        gsize size = (1 << src->bayer_size_shift) * src->ordered_row_width * 4 * sizeof (gint16);
+
+        dest->ordered_rows = chafa_aligned_alloc (size);
+        memcpy (dest->ordered_rows, src->ordered_rows, size);
+    }
 }
 
 ChafaColor
@@ -109,3 +171,46 @@ chafa_dither_color_ordered (const ChafaDither *dither, ChafaColor color, gint x,
 
     return color;
 }
+
+static void
+apply_ordered_row (ChafaPixel *pixels, const gint16 *mods, gint width)
+{
+    gint i;
+
+    for (i = 0; i < width * 4; i++)
+    {
+        gint16 c;
+
+        c = (gint16) pixels [i / 4].col.ch [i % 4] + mods [i];
+        pixels [i / 4].col.ch [i % 4] = CLAMP (c, 0, 255);
+    }
+}
+
+/* Dithers a whole row of pixels. Equivalent to chafa_dither_color_ordered ()
+ * for each pixel, but the matrix row is already expanded to grain size. */
+void
+chafa_dither_row_ordered (const ChafaDither *dither, ChafaPixel *pixels, gint width, gint y)
+{
+    const gint16 *mods;
+    gint x;
+
+    mods = dither->ordered_rows
+        + ((y >> dither->grain_height_shift) & dither->bayer_size_mask)
+        * dither->ordered_row_width * 4;
+
+    for (x = 0; x < width; x += dither->ordered_row_width)
+    {
+        gint n = MIN (width - x, dither->ordered_row_width);
+
+#ifdef HAVE_AVX2_INTRINSICS
+        /* Canvas rows are 32-byte aligned and a whole number of cells wide */
+        if (chafa_have_avx2 () && !(n & 7))
+        {
+            chafa_apply_dither_row_avx2 (pixels + x, mods, n);
+            continue;
+        }
+#endif
+
+        apply_ordered_row (pixels + x, mods, n);
+    }
+}
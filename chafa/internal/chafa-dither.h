@@ -34,6 +34,11 @@ typedef struct
     gint bayer_size_shift;
     guint bayer_size_mask;
     gint *bayer_matrix;
+
+    /* The Bayer matrix expanded to grain size, one row per matrix row and
+     * four channels per pixel. Alpha is left alone. */
+    gint16 *ordered_rows;
+    gint ordered_row_width;
 }
 ChafaDither;
 
@@ -44,6 +49,7 @@ void chafa_dither_deinit (ChafaDither *dither);
 void chafa_dither_copy (const ChafaDither *src, ChafaDither *dest);
 
 ChafaColor chafa_dither_color_ordered (const ChafaDither *dither, ChafaColor color, gint x, gint y);
+void chafa_dither_row_ordered (const ChafaDither *dither, ChafaPixel *pixels, gint width, gint y);
 
 G_END_DECLS
 
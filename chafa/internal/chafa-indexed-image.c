@@ -19,10 +19,24 @@
 
 #include "config.h"
 
+#include <math.h>
+#include <string.h>
+
 #include "smolscale/smolscale.h"
 #include "chafa.h"
 #include "internal/chafa-batch.h"
 #include "internal/chafa-private.h"
+#include "internal/chafa-scratch.h"
+
+/* When reusing a palette, a frame that quantizes more than 25% worse than
+ * the frame the palette was generated from triggers a new palette. The
+ * slack keeps near-perfect palettes from being replaced over noise. */
+#define PALETTE_ERROR_N_SAMPLES 4096
+#define PALETTE_ERROR_SLACK 16
+
+/* Streaming draws generate their palette from a downscaled copy of the
+ * whole image of at most this many pixels */
+#define STREAM_PALETTE_SAMPLE_PIXELS_MAX (256 * 256)
 
 typedef struct
 {
@@ -36,11 +50,26 @@ typedef struct
     SmolScaleCtx *scale_ctx;
     guint32 *scaled_data;
 
+    /* When streaming, the image holds one band of rows at a time. This is
+     * the band's first row in the full image, and diffusion error carries
+     * over between bands in error_rows. */
+    gint first_row;
+    ChafaColorAccum *error_rows [2];
+
     /* BG color with alpha multiplier 255-0 */
     guint32 bg_color_lut [256];
 }
 DrawPixelsCtx;
 
+/* Per-worker hash statistics, added to the shared hash when the batch is done */
+typedef struct
+{
+    ChafaColorHash *color_hash;
+    gint n_hits;
+    gint n_misses;
+}
+HashCtx;
+
 static void
 gen_color_lut_rgba8 (guint32 *color_lut, ChafaColor col)
 {
@@ -74,18 +103,27 @@ post_scale_row (guint32 *row_inout, int width, void *user_data)
     }
 }
 
+static gboolean
+draw_is_cancelled (const ChafaIndexedImage *indexed_image)
+{
+    return indexed_image->cancel_flag && g_atomic_int_get (indexed_image->cancel_flag);
+}
+
 static void
 draw_pixels_pass_1_worker (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx)
 {
+    if (draw_is_cancelled (ctx->indexed_image))
+        return;
+
     smol_scale_batch_full (ctx->scale_ctx,
                            ctx->scaled_data + (ctx->dest_width * batch->first_row),
-                           batch->first_row,
+                           ctx->first_row + batch->first_row,
                            batch->n_rows);
 }
 
 static gint
 quantize_pixel (const ChafaPalette *palette, ChafaColorSpace color_space,
-                ChafaColorHash *color_hash, ChafaColor color)
+                HashCtx *hctx, ChafaColor color)
 {
     ChafaColor cached_color;
     gint index;
@@ -98,10 +136,19 @@ quantize_pixel (const ChafaPalette *palette, ChafaColorSpace color_space,
      * mask out the alpha channel. */
     CHAFA_COLOR8_U32 (cached_color) = CHAFA_COLOR8_U32 (color) & GUINT32_FROM_BE (0xfefefe00);
 
-    index = chafa_color_hash_lookup (color_hash, CHAFA_COLOR8_U32 (cached_color));
+    index = chafa_color_hash_lookup (hctx->color_hash, CHAFA_COLOR8_U32 (cached_color));
 
     if (index < 0)
     {
+        hctx->n_misses++;
+
+        /* Look up the masked color, so the result depends only on the key.
+         * The hash is shared between threads and kept across frames, and
+         * would otherwise hold whichever color happened to get there first. */
+        color.ch [0] = cached_color.ch [0];
+        color.ch [1] = cached_color.ch [1];
+        color.ch [2] = cached_color.ch [2];
+
         if (color_space == CHAFA_COLOR_SPACE_DIN99D)
             chafa_color_rgb_to_din99d (&color, &color);
 
@@ -113,7 +160,11 @@ quantize_pixel (const ChafaPalette *palette, ChafaColorSpace color_space,
 
         /* Don't insert transparent pixels, since color hash does not store transparency */
         if (index != chafa_palette_get_transparent_index (palette))
-            chafa_color_hash_replace (color_hash, CHAFA_COLOR8_U32 (cached_color), index);
+            chafa_color_hash_replace (hctx->color_hash, CHAFA_COLOR8_U32 (cached_color), index);
+    }
+    else
+    {
+        hctx->n_hits++;
     }
 
     return index;
@@ -121,8 +172,10 @@ quantize_pixel (const ChafaPalette *palette, ChafaColorSpace color_space,
 
 static gint
 quantize_pixel_with_error (const ChafaPalette *palette, ChafaColorSpace color_space,
-                           ChafaColor color, ChafaColorAccum *error_inout)
+                           HashCtx *hctx, ChafaColor color, ChafaColorAccum *error_inout)
 {
+    ChafaColorAccum compensated_color;
+    ChafaColor cached_color;
     gint index;
 
     if ((gint) (color.ch [3]) < chafa_palette_get_alpha_threshold (palette))
@@ -136,69 +189,90 @@ quantize_pixel_with_error (const ChafaPalette *palette, ChafaColorSpace color_sp
         return chafa_palette_get_transparent_index (palette);
     }
 
-    if (color_space == CHAFA_COLOR_SPACE_DIN99D)
-        chafa_color_rgb_to_din99d (&color, &color);
+    /* DIN99d pixels were converted in advance by convert_din99d_worker () */
 
-    index = chafa_palette_lookup_with_error (palette,
-                                             color_space,
-                                             color,
-                                             error_inout)
-      - chafa_palette_get_first_color (palette);
+    color = chafa_palette_compensate_color (color, error_inout, &compensated_color);
 
-    return index;
+    /* As in quantize_pixel (), drop the low-order bits for a better hit rate.
+     * The error term is computed from the full color, so the discarded bits
+     * are diffused to the neighbors. */
+    CHAFA_COLOR8_U32 (cached_color) = CHAFA_COLOR8_U32 (color) & GUINT32_FROM_BE (0xfefefe00);
+
+    index = chafa_color_hash_lookup (hctx->color_hash, CHAFA_COLOR8_U32 (cached_color));
+
+    if (index < 0)
+    {
+        hctx->n_misses++;
+
+        color.ch [0] = cached_color.ch [0];
+        color.ch [1] = cached_color.ch [1];
+        color.ch [2] = cached_color.ch [2];
+
+        index = chafa_palette_lookup_nearest (palette, color_space, &color, NULL)
+          - chafa_palette_get_first_color (palette);
+
+        if (index != chafa_palette_get_transparent_index (palette))
+            chafa_color_hash_replace (hctx->color_hash, CHAFA_COLOR8_U32 (cached_color), index);
+    }
+    else
+    {
+        hctx->n_hits++;
+    }
+
+    index += chafa_palette_get_first_color (palette);
+    chafa_palette_get_error (palette, color_space, index, &compensated_color, error_inout);
+
+    return index - chafa_palette_get_first_color (palette);
 }
 
 static void
 draw_pixels_pass_2_nodither (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx,
-                             ChafaColorHash *chash)
+                             HashCtx *hctx)
 {
     const guint32 *src_p;
-    guint8 *dest_p, *dest_end_p;
+    guint8 *dest_row_p;
+    gint x, y;
 
     src_p = ctx->scaled_data + (ctx->dest_width * batch->first_row);
-    dest_p = ctx->indexed_image->pixels + (ctx->dest_width * batch->first_row);
-    dest_end_p = dest_p + (ctx->dest_width * batch->n_rows);
+    dest_row_p = ctx->indexed_image->pixels + (ctx->indexed_image->rowstride * batch->first_row);
 
-    for ( ; dest_p < dest_end_p; src_p++, dest_p++)
+    for (y = 0; y < batch->n_rows; y++, dest_row_p += ctx->indexed_image->rowstride)
     {
-        ChafaColor col;
-        gint index;
+        for (x = 0; x < ctx->dest_width; x++, src_p++)
+        {
+            ChafaColor col;
 
-        col = chafa_color8_fetch_from_rgba8 (src_p);
-        index = quantize_pixel (&ctx->indexed_image->palette, ctx->color_space, chash, col);
-        *dest_p = index;
+            col = chafa_color8_fetch_from_rgba8 (src_p);
+            dest_row_p [x] = quantize_pixel (&ctx->indexed_image->palette, ctx->color_space,
+                                             hctx, col);
+        }
     }
 }
 
 static void
 draw_pixels_pass_2_bayer (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx,
-                          ChafaColorHash *chash)
+                          HashCtx *hctx)
 {
     const guint32 *src_p;
-    guint8 *dest_p, *dest_end_p;
-    gint x, y;
+    guint8 *dest_row_p;
+    gint x, y, y_end;
 
     src_p = ctx->scaled_data + (ctx->dest_width * batch->first_row);
-    dest_p = ctx->indexed_image->pixels + (ctx->dest_width * batch->first_row);
-    dest_end_p = dest_p + (ctx->dest_width * batch->n_rows);
+    dest_row_p = ctx->indexed_image->pixels + (ctx->indexed_image->rowstride * batch->first_row);
 
-    x = 0;
-    y = batch->first_row;
+    y = ctx->first_row + batch->first_row;
+    y_end = y + batch->n_rows;
 
-    for ( ; dest_p < dest_end_p; src_p++, dest_p++)
+    for ( ; y < y_end; y++, dest_row_p += ctx->indexed_image->rowstride)
     {
-        ChafaColor col;
-        gint index;
-
-        col = chafa_color8_fetch_from_rgba8 (src_p);
-        col = chafa_dither_color_ordered (&ctx->indexed_image->dither, col, x, y);
-        index = quantize_pixel (&ctx->indexed_image->palette, ctx->color_space, chash, col);
-        *dest_p = index;
-
-        if (++x >= ctx->dest_width)
+        for (x = 0; x < ctx->dest_width; x++, src_p++)
         {
-            x = 0;
-            y++;
+            ChafaColor col;
+
+            col = chafa_color8_fetch_from_rgba8 (src_p);
+            col = chafa_dither_color_ordered (&ctx->indexed_image->dither, col, x, y);
+            dest_row_p [x] = quantize_pixel (&ctx->indexed_image->palette, ctx->color_space,
+                                             hctx, col);
         }
     }
 }
@@ -222,7 +296,7 @@ distribute_error (ChafaColorAccum error_in, ChafaColorAccum *error_out_0,
 }
 
 static guint8
-fs_dither_pixel (const DrawPixelsCtx *ctx, G_GNUC_UNUSED ChafaColorHash *chash,
+fs_dither_pixel (const DrawPixelsCtx *ctx, HashCtx *hctx,
                  const guint32 *inpixel_p,
                  ChafaColorAccum error_in,
                  ChafaColorAccum *error_out_0, ChafaColorAccum *error_out_1,
@@ -231,7 +305,7 @@ fs_dither_pixel (const DrawPixelsCtx *ctx, G_GNUC_UNUSED ChafaColorHash *chash,
     ChafaColor col = chafa_color8_fetch_from_rgba8 (inpixel_p);
     guint8 index;
 
-    index = quantize_pixel_with_error (&ctx->indexed_image->palette, ctx->color_space, col, &error_in);
+    index = quantize_pixel_with_error (&ctx->indexed_image->palette, ctx->color_space, hctx, col, &error_in);
     distribute_error (error_in,
                       error_out_0, error_out_1, error_out_2, error_out_3,
                       ctx->indexed_image->dither.intensity);
@@ -239,7 +313,7 @@ fs_dither_pixel (const DrawPixelsCtx *ctx, G_GNUC_UNUSED ChafaColorHash *chash,
 }
 
 static void
-fs_dither_row (const DrawPixelsCtx *ctx, ChafaColorHash *chash, const guint32 *inrow_p,
+fs_dither_row (const DrawPixelsCtx *ctx, HashCtx *hctx, const guint32 *inrow_p,
                guint8 *outrow_p, ChafaColorAccum *error_row, ChafaColorAccum *next_error_row,
                gint width, gint y)
 {
@@ -249,7 +323,7 @@ fs_dither_row (const DrawPixelsCtx *ctx, ChafaColorHash *chash, const guint32 *i
     {
         /* Forwards pass */
 
-        outrow_p [0] = fs_dither_pixel (ctx, chash, &inrow_p [0], error_row [0],
+        outrow_p [0] = fs_dither_pixel (ctx, hctx, &inrow_p [0], error_row [0],
                                         &error_row [1],
                                         &next_error_row [1],
                                         &next_error_row [0],
@@ -257,14 +331,14 @@ fs_dither_row (const DrawPixelsCtx *ctx, ChafaColorHash *chash, const guint32 *i
 
         for (x = 1; x < width - 1; x++)
         {
-            outrow_p [x] = fs_dither_pixel (ctx, chash, &inrow_p [x], error_row [x],
+            outrow_p [x] = fs_dither_pixel (ctx, hctx, &inrow_p [x], error_row [x],
                                             &error_row [x + 1],
                                             &next_error_row [x + 1],
                                             &next_error_row [x],
                                             &next_error_row [x - 1]);
         }
 
-        outrow_p [x] = fs_dither_pixel (ctx, chash, &inrow_p [x], error_row [x],
+        outrow_p [x] = fs_dither_pixel (ctx, hctx, &inrow_p [x], error_row [x],
                                         &next_error_row [x],
                                         &next_error_row [x],
                                         &next_error_row [x - 1],
@@ -276,7 +350,7 @@ fs_dither_row (const DrawPixelsCtx *ctx, ChafaColorHash *chash, const guint32 *i
 
         x = width - 1;
 
-        outrow_p [x] = fs_dither_pixel (ctx, chash, &inrow_p [x], error_row [x],
+        outrow_p [x] = fs_dither_pixel (ctx, hctx, &inrow_p [x], error_row [x],
                                         &error_row [x - 1],
                                         &next_error_row [x - 1],
                                         &next_error_row [x],
@@ -284,14 +358,14 @@ fs_dither_row (const DrawPixelsCtx *ctx, ChafaColorHash *chash, const guint32 *i
 
         for (x--; x >= 1; x--)
         {
-            outrow_p [x] = fs_dither_pixel (ctx, chash, &inrow_p [x], error_row [x],
+            outrow_p [x] = fs_dither_pixel (ctx, hctx, &inrow_p [x], error_row [x],
                                             &error_row [x - 1],
                                             &next_error_row [x - 1],
                                             &next_error_row [x],
                                             &next_error_row [x + 1]);
         }
 
-        outrow_p [0] = fs_dither_pixel (ctx, chash, &inrow_p [0], error_row [0],
+        outrow_p [0] = fs_dither_pixel (ctx, hctx, &inrow_p [0], error_row [0],
                                         &next_error_row [0],
                                         &next_error_row [0],
                                         &next_error_row [1],
@@ -301,31 +375,40 @@ fs_dither_row (const DrawPixelsCtx *ctx, ChafaColorHash *chash, const guint32 *i
 
 static void
 draw_pixels_pass_2_fs (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx,
-                       ChafaColorHash *chash)
+                       HashCtx *hctx)
 {
     ChafaColorAccum *error_row [2];
     const guint32 *src_p;
     guint8 *dest_end_p, *dest_p;
     gint y;
 
-    error_row [0] = g_malloc (ctx->dest_width * sizeof (ChafaColorAccum));
-    error_row [1] = g_malloc (ctx->dest_width * sizeof (ChafaColorAccum));
+    if (ctx->error_rows [0])
+    {
+        /* Streaming; pick up the error where the previous band left it */
+        error_row [0] = ctx->error_rows [0];
+        error_row [1] = ctx->error_rows [1];
+    }
+    else
+    {
+        error_row [0] = g_malloc (ctx->dest_width * sizeof (ChafaColorAccum));
+        error_row [1] = g_malloc (ctx->dest_width * sizeof (ChafaColorAccum));
+        memset (error_row [0], 0, ctx->dest_width * sizeof (ChafaColorAccum));
+    }
 
     src_p = ctx->scaled_data + (ctx->dest_width * batch->first_row);
-    dest_p = ctx->indexed_image->pixels + (ctx->dest_width * batch->first_row);
-    dest_end_p = dest_p + (ctx->dest_width * batch->n_rows);
+    dest_p = ctx->indexed_image->pixels + (ctx->indexed_image->rowstride * batch->first_row);
+    dest_end_p = dest_p + (ctx->indexed_image->rowstride * batch->n_rows);
 
-    y = batch->first_row;
+    y = ctx->first_row + batch->first_row;
 
-    memset (error_row [0], 0, ctx->dest_width * sizeof (ChafaColorAccum));
-
-    for ( ; dest_p < dest_end_p; src_p += ctx->dest_width, dest_p += ctx->dest_width, y++)
+    for ( ; dest_p < dest_end_p;
+         src_p += ctx->dest_width, dest_p += ctx->indexed_image->rowstride, y++)
     {
         ChafaColorAccum *error_row_temp;
 
         memset (error_row [1], 0, ctx->dest_width * sizeof (ChafaColorAccum));
 
-        fs_dither_row (ctx, chash, src_p, dest_p, error_row [0], error_row [1],
+        fs_dither_row (ctx, hctx, src_p, dest_p, error_row [0], error_row [1],
                        ctx->dest_width, y);
 
         error_row_temp = error_row [0];
@@ -333,29 +416,62 @@ draw_pixels_pass_2_fs (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx,
         error_row [1] = error_row_temp;
     }
 
+    if (ctx->error_rows [0])
+    {
+        /* Only one batch per band, so this can't race */
+        ((DrawPixelsCtx *) ctx)->error_rows [0] = error_row [0];
+        ((DrawPixelsCtx *) ctx)->error_rows [1] = error_row [1];
+        return;
+    }
+
     g_free (error_row [1]);
     g_free (error_row [0]);
 }
 
+/* Error diffusion is serial, since the image is scanned in alternating
+ * directions and each row depends on all of the previous one. The color
+ * space conversion does not depend on the error, though, so we do it for
+ * all pixels in parallel beforehand to keep it off the serial path. */
+static void
+convert_din99d_worker (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx)
+{
+    guint32 *p = ctx->scaled_data + (ctx->dest_width * batch->first_row);
+    guint32 *p_end = p + (ctx->dest_width * batch->n_rows);
+
+    for ( ; p < p_end; p++)
+    {
+        ChafaColor col = chafa_color8_fetch_from_rgba8 (p);
+
+        chafa_color_rgb_to_din99d (&col, &col);
+        chafa_color8_store_to_rgba8 (col, p);
+    }
+}
+
 static void
 draw_pixels_pass_2_worker (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx)
 {
-    ChafaColorHash chash;
+    HashCtx hctx;
 
-    chafa_color_hash_init (&chash);
+    if (draw_is_cancelled (ctx->indexed_image))
+        return;
+
+    hctx.color_hash = &ctx->indexed_image->color_hash;
+    hctx.n_hits = 0;
+    hctx.n_misses = 0;
 
     switch (ctx->indexed_image->dither.mode)
     {
         case CHAFA_DITHER_MODE_NONE:
-            draw_pixels_pass_2_nodither (batch, ctx, &chash);
+            draw_pixels_pass_2_nodither (batch, ctx, &hctx);
             break;
 
         case CHAFA_DITHER_MODE_ORDERED:
-            draw_pixels_pass_2_bayer (batch, ctx, &chash);
+        case CHAFA_DITHER_MODE_NOISE:
+            draw_pixels_pass_2_bayer (batch, ctx, &hctx);
             break;
 
         case CHAFA_DITHER_MODE_DIFFUSION:
-            draw_pixels_pass_2_fs (batch, ctx, &chash);
+            draw_pixels_pass_2_fs (batch, ctx, &hctx);
             break;
 
         case CHAFA_DITHER_MODE_MAX:
@@ -363,33 +479,229 @@ draw_pixels_pass_2_worker (ChafaBatchInfo *batch, const DrawPixelsCtx *ctx)
             break;
     }
 
-    chafa_color_hash_deinit (&chash);
+    chafa_color_hash_add_stats (hctx.color_hash, hctx.n_hits, hctx.n_misses);
 }
 
+/* Clears the color hash if the palette or color space changed since it
+ * was filled. Dynamic palettes are regenerated for every frame, but often
+ * come out the same for animations with a stable color distribution. */
 static void
-draw_pixels (DrawPixelsCtx *ctx)
+validate_color_hash (ChafaIndexedImage *indexed_image, ChafaColorSpace color_space)
+{
+    const ChafaPalette *palette = &indexed_image->palette;
+
+    if (indexed_image->hash_palette_type == palette->type
+        && indexed_image->hash_color_space == color_space
+        && !memcmp (indexed_image->hash_palette_colors, palette->colors,
+                    sizeof (indexed_image->hash_palette_colors)))
+        return;
+
+    chafa_color_hash_clear (&indexed_image->color_hash);
+    indexed_image->hash_palette_type = palette->type;
+    indexed_image->hash_color_space = color_space;
+    memcpy (indexed_image->hash_palette_colors, palette->colors,
+            sizeof (indexed_image->hash_palette_colors));
+}
+
+/* Mean squared quantization error over a sparse sample of the frame.
+ * It's only compared against other frames' errors, so the sample can
+ * be small. */
+static gint
+measure_palette_error (const ChafaPalette *palette, ChafaColorSpace color_space,
+                       const guint32 *pixels, gint n_pixels)
+{
+    gint64 sum = 0;
+    gint n = 0;
+    gint step;
+    gint i;
+
+    step = n_pixels / PALETTE_ERROR_N_SAMPLES + 1;
+
+    for (i = 0; i < n_pixels; i += step)
+    {
+        ChafaColor col;
+        gint index;
+
+        CHAFA_COLOR8_U32 (col) = pixels [i];
+        if ((gint) col.ch [3] < chafa_palette_get_alpha_threshold (palette))
+            continue;
+
+        if (color_space == CHAFA_COLOR_SPACE_DIN99D)
+            chafa_color_rgb_to_din99d (&col, &col);
+
+        index = chafa_palette_lookup_nearest (palette, color_space, &col, NULL);
+        sum += chafa_color_diff_fast (&col, chafa_palette_get_color (palette, color_space, index));
+        n++;
+    }
+
+    return n > 0 ? sum / n : 0;
+}
+
+static void
+update_palette (DrawPixelsCtx *ctx)
+{
+    ChafaIndexedImage *indexed_image = ctx->indexed_image;
+    gint n_pixels = ctx->dest_width * ctx->dest_height;
+
+    if (indexed_image->palette_is_fixed
+        || chafa_palette_get_type (&indexed_image->palette) != CHAFA_PALETTE_TYPE_DYNAMIC_256)
+        return;
+
+    if (indexed_image->reuse_palette && indexed_image->have_palette)
+    {
+        gint error = measure_palette_error (&indexed_image->palette, ctx->color_space,
+                                            ctx->scaled_data, n_pixels);
+
+        if (error <= indexed_image->palette_error + indexed_image->palette_error / 4 + PALETTE_ERROR_SLACK)
+            return;
+    }
+
+    chafa_palette_generate (&indexed_image->palette,
+                            ctx->scaled_data, n_pixels,
+                            ctx->color_space);
+    indexed_image->have_palette = TRUE;
+    indexed_image->palette_serial++;
+
+    if (indexed_image->reuse_palette)
+        indexed_image->palette_error = measure_palette_error (&indexed_image->palette, ctx->color_space,
+                                                              ctx->scaled_data, n_pixels);
+}
+
+static void
+scale_rows (DrawPixelsCtx *ctx, gint n_rows)
 {
     chafa_process_batches (ctx,
+                           "index-pass-1",
                            (GFunc) draw_pixels_pass_1_worker,
                            NULL,
-                           ctx->dest_height,
+                           n_rows,
                            chafa_get_n_actual_threads (),
                            1);
+}
 
-    chafa_palette_generate (&ctx->indexed_image->palette,
-                            ctx->scaled_data, ctx->dest_width * ctx->dest_height,
-                            ctx->color_space);
+static void
+quantize_rows (DrawPixelsCtx *ctx, gint n_rows)
+{
+    if (ctx->indexed_image->dither.mode == CHAFA_DITHER_MODE_DIFFUSION
+        && ctx->color_space == CHAFA_COLOR_SPACE_DIN99D)
+    {
+        chafa_process_batches (ctx,
+                               "convert-din99d",
+                               (GFunc) convert_din99d_worker,
+                               NULL,
+                               n_rows,
+                               chafa_get_n_actual_threads (),
+                               1);
+    }
 
     /* Single thread only for diffusion; it's a fully serial operation */
     chafa_process_batches (ctx,
+                           "index-pass-2",
                            (GFunc) draw_pixels_pass_2_worker,
                            NULL,
-                           ctx->dest_height,
+                           n_rows,
                            ctx->indexed_image->dither.mode == CHAFA_DITHER_MODE_DIFFUSION
                              ? 1 : chafa_get_n_actual_threads (),
                            1);
 }
 
+static void
+draw_pixels (DrawPixelsCtx *ctx)
+{
+    scale_rows (ctx, ctx->dest_height);
+
+    /* Keep the old palette; a generated one would be from partial data */
+    if (draw_is_cancelled (ctx->indexed_image))
+        return;
+
+    update_palette (ctx);
+
+    validate_color_hash (ctx->indexed_image, ctx->color_space);
+
+    quantize_rows (ctx, ctx->dest_height);
+}
+
+static SmolScaleCtx *
+new_scale_ctx (DrawPixelsCtx *ctx, gint dest_width, gint dest_height)
+{
+    return smol_scale_new_full ((SmolPixelType) ctx->src_pixel_type,
+                                (const guint32 *) ctx->src_pixels,
+                                ctx->src_width,
+                                ctx->src_height,
+                                ctx->src_rowstride,
+                                SMOL_PIXEL_RGBA8_PREMULTIPLIED,
+                                NULL,
+                                dest_width,
+                                dest_height,
+                                dest_width * sizeof (guint32),
+                                post_scale_row,
+                                ctx);
+}
+
+static void
+init_draw_pixels_ctx (DrawPixelsCtx *ctx,
+                      ChafaIndexedImage *indexed_image,
+                      ChafaColorSpace color_space,
+                      ChafaPixelType src_pixel_type,
+                      gconstpointer src_pixels,
+                      gint src_width, gint src_height, gint src_rowstride,
+                      gint dest_width, gint dest_height)
+{
+    memset (ctx, 0, sizeof (*ctx));
+
+    ctx->indexed_image = indexed_image;
+    ctx->color_space = color_space;
+    ctx->src_pixel_type = src_pixel_type;
+    ctx->src_pixels = src_pixels;
+    ctx->src_width = src_width;
+    ctx->src_height = src_height;
+    ctx->src_rowstride = src_rowstride;
+    ctx->dest_width = dest_width;
+    ctx->dest_height = dest_height;
+
+    gen_color_lut_rgba8 (ctx->bg_color_lut,
+                         *chafa_palette_get_color (&indexed_image->palette,
+                                                   CHAFA_COLOR_SPACE_RGB,
+                                                   CHAFA_PALETTE_INDEX_BG));
+}
+
+/* Generates a dynamic palette from a downscaled copy of the image, since
+ * the full image is never in memory all at once */
+static void
+generate_stream_palette (DrawPixelsCtx *ctx)
+{
+    ChafaIndexedImage *indexed_image = ctx->indexed_image;
+    SmolScaleCtx *sample_scale_ctx;
+    guint32 *sample;
+    gint sample_width = ctx->dest_width;
+    gint sample_height = ctx->dest_height;
+    gdouble n_pixels = (gdouble) sample_width * sample_height;
+
+    if (indexed_image->palette_is_fixed
+        || chafa_palette_get_type (&indexed_image->palette) != CHAFA_PALETTE_TYPE_DYNAMIC_256)
+        return;
+
+    if (n_pixels > STREAM_PALETTE_SAMPLE_PIXELS_MAX)
+    {
+        gdouble f = sqrt (STREAM_PALETTE_SAMPLE_PIXELS_MAX / n_pixels);
+
+        sample_width = MAX (sample_width * f, 1);
+        sample_height = MAX (sample_height * f, 1);
+    }
+
+    sample = g_new (guint32, sample_width * sample_height);
+    sample_scale_ctx = new_scale_ctx (ctx, sample_width, sample_height);
+    smol_scale_batch_full (sample_scale_ctx, sample, 0, sample_height);
+    smol_scale_destroy (sample_scale_ctx);
+
+    chafa_palette_generate (&indexed_image->palette, sample,
+                            sample_width * sample_height, ctx->color_space);
+    indexed_image->have_palette = TRUE;
+    indexed_image->palette_serial++;
+
+    g_free (sample);
+}
+
 ChafaIndexedImage *
 chafa_indexed_image_new (gint width, gint height,
                          const ChafaPalette *palette,
@@ -400,21 +712,51 @@ chafa_indexed_image_new (gint width, gint height,
     indexed_image = g_new0 (ChafaIndexedImage, 1);
     indexed_image->width = width;
     indexed_image->height = height;
-    indexed_image->pixels = g_malloc (width * height);
+    indexed_image->rowstride = CHAFA_ALIGNED_ROWSTRIDE (width);
+    indexed_image->pixels = chafa_aligned_alloc0 ((gsize) indexed_image->rowstride * height);
 
-    chafa_palette_copy (palette, &indexed_image->palette);
-    chafa_palette_set_transparent_index (&indexed_image->palette, 255);
+    chafa_color_hash_init (&indexed_image->color_hash, CHAFA_COLOR_HASH_DEFAULT_N_SETS);
+    indexed_image->hash_color_space = CHAFA_COLOR_SPACE_MAX;
 
+    chafa_indexed_image_set_palette (indexed_image, palette);
     chafa_dither_copy (dither, &indexed_image->dither);
 
     return indexed_image;
 }
 
+/* Resets the palette to its initial state, so that a redraw generates the
+ * same colors as a freshly created image would */
+void
+chafa_indexed_image_set_palette (ChafaIndexedImage *indexed_image, const ChafaPalette *palette)
+{
+    chafa_palette_copy (palette, &indexed_image->palette);
+    chafa_palette_set_transparent_index (&indexed_image->palette, 255);
+    indexed_image->palette_is_fixed = FALSE;
+    indexed_image->have_palette = FALSE;
+    indexed_image->palette_serial++;
+}
+
+/* Makes all subsequent draws quantize to palette as-is */
+void
+chafa_indexed_image_set_fixed_palette (ChafaIndexedImage *indexed_image, const ChafaPalette *palette)
+{
+    chafa_indexed_image_set_palette (indexed_image, palette);
+    indexed_image->palette_is_fixed = TRUE;
+    indexed_image->have_palette = TRUE;
+}
+
+void
+chafa_indexed_image_set_palette_reuse (ChafaIndexedImage *indexed_image, gboolean reuse_palette)
+{
+    indexed_image->reuse_palette = reuse_palette;
+}
+
 void
 chafa_indexed_image_destroy (ChafaIndexedImage *indexed_image)
 {
     chafa_dither_deinit (&indexed_image->dither);
-    g_free (indexed_image->pixels);
+    chafa_color_hash_deinit (&indexed_image->color_hash);
+    chafa_aligned_free (indexed_image->pixels);
     g_free (indexed_image);
 }
 
@@ -434,41 +776,99 @@ chafa_indexed_image_draw_pixels (ChafaIndexedImage *indexed_image,
     dest_width = MIN (dest_width, indexed_image->width);
     dest_height = MIN (dest_height, indexed_image->height);
 
-    ctx.indexed_image = indexed_image;
-    ctx.color_space = color_space;
-    ctx.src_pixel_type = src_pixel_type;
-    ctx.src_pixels = src_pixels;
-    ctx.src_width = src_width;
-    ctx.src_height = src_height;
-    ctx.src_rowstride = src_rowstride;
-    ctx.dest_width = dest_width;
-    ctx.dest_height = dest_height;
-
-    gen_color_lut_rgba8 (ctx.bg_color_lut,
-                         *chafa_palette_get_color (&indexed_image->palette,
-                                                   CHAFA_COLOR_SPACE_RGB,
-                                                   CHAFA_PALETTE_INDEX_BG));
+    init_draw_pixels_ctx (&ctx, indexed_image, color_space,
+                          src_pixel_type, src_pixels,
+                          src_width, src_height, src_rowstride,
+                          dest_width, dest_height);
 
     ctx.scaled_data = g_new (guint32, dest_width * dest_height);
-    ctx.scale_ctx = smol_scale_new_full ((SmolPixelType) src_pixel_type,
-                                         (const guint32 *) src_pixels,
-                                         src_width,
-                                         src_height,
-                                         src_rowstride,
-                                         SMOL_PIXEL_RGBA8_PREMULTIPLIED,
-                                         NULL,
-                                         dest_width,
-                                         dest_height,
-                                         dest_width * sizeof (guint32),
-                                         post_scale_row,
-                                         &ctx);
+    ctx.scale_ctx = new_scale_ctx (&ctx, dest_width, dest_height);
 
     draw_pixels (&ctx);
 
-    memset (indexed_image->pixels + indexed_image->width * dest_height,
+    memset (indexed_image->pixels + indexed_image->rowstride * dest_height,
             0,
-            indexed_image->width * (indexed_image->height - dest_height));
+            indexed_image->rowstride * (indexed_image->height - dest_height));
 
     smol_scale_destroy (ctx.scale_ctx);
     g_free (ctx.scaled_data);
 }
+
+/* Starts a draw of an image that may be much taller than indexed_image.
+ * Each call to chafa_indexed_image_draw_next_band () scales and quantizes
+ * the next indexed_image->height rows into the image's pixels, so memory
+ * use depends on the band height only. Palette reuse does not apply. */
+void
+chafa_indexed_image_begin_stream (ChafaIndexedImage *indexed_image,
+                                  ChafaColorSpace color_space,
+                                  ChafaPixelType src_pixel_type,
+                                  gconstpointer src_pixels,
+                                  gint src_width, gint src_height, gint src_rowstride,
+                                  gint dest_width, gint dest_height)
+{
+    DrawPixelsCtx *ctx;
+
+    g_return_if_fail (dest_width == indexed_image->width);
+    g_return_if_fail (indexed_image->stream_ctx == NULL);
+
+    ctx = g_new (DrawPixelsCtx, 1);
+    init_draw_pixels_ctx (ctx, indexed_image, color_space,
+                          src_pixel_type, src_pixels,
+                          src_width, src_height, src_rowstride,
+                          dest_width, dest_height);
+
+    ctx->scaled_data = g_new (guint32, dest_width * indexed_image->height);
+    ctx->scale_ctx = new_scale_ctx (ctx, dest_width, dest_height);
+
+    if (indexed_image->dither.mode == CHAFA_DITHER_MODE_DIFFUSION)
+    {
+        ctx->error_rows [0] = g_new0 (ChafaColorAccum, dest_width);
+        ctx->error_rows [1] = g_new0 (ChafaColorAccum, dest_width);
+    }
+
+    generate_stream_palette (ctx);
+    validate_color_hash (indexed_image, color_space);
+
+    indexed_image->stream_ctx = ctx;
+}
+
+/* Returns the number of image rows drawn, or 0 when done. Rows past the
+ * end of the image are cleared. */
+gint
+chafa_indexed_image_draw_next_band (ChafaIndexedImage *indexed_image)
+{
+    DrawPixelsCtx *ctx = indexed_image->stream_ctx;
+    gint n_rows;
+
+    g_return_val_if_fail (ctx != NULL, 0);
+
+    n_rows = MIN (indexed_image->height, ctx->dest_height - ctx->first_row);
+    if (n_rows <= 0 || draw_is_cancelled (indexed_image))
+        return 0;
+
+    scale_rows (ctx, n_rows);
+    quantize_rows (ctx, n_rows);
+
+    memset (indexed_image->pixels + indexed_image->rowstride * n_rows,
+            0,
+            indexed_image->rowstride * (indexed_image->height - n_rows));
+
+    ctx->first_row += n_rows;
+    return n_rows;
+}
+
+void
+chafa_indexed_image_end_stream (ChafaIndexedImage *indexed_image)
+{
+    DrawPixelsCtx *ctx = indexed_image->stream_ctx;
+
+    g_return_if_fail (ctx != NULL);
+
+    smol_scale_destroy (ctx->scale_ctx);
+    g_free (ctx->scaled_data);
+    g_free (ctx->error_rows [0]);
+    g_free (ctx->error_rows [1]);
+    g_free (ctx);
+
+    indexed_image->stream_ctx = NULL;
+}
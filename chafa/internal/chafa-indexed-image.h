@@ -22,6 +22,7 @@
 
 #include "internal/chafa-palette.h"
 #include "internal/chafa-dither.h"
+#include "internal/chafa-color-hash.h"
 
 G_BEGIN_DECLS
 
@@ -30,7 +31,37 @@ typedef struct
     gint width, height;
     ChafaPalette palette;
     ChafaDither dither;
+
+    /* From chafa_aligned_alloc (). Rows are padded to a whole number of
+     * CHAFA_SCRATCH_ALIGN blocks; the padding is always zero. */
     guint8 *pixels;
+    gint rowstride;
+
+    /* Kept across redraws, since animations often repeat colors. It's
+     * only valid for the palette and color space it was filled for. */
+    ChafaColorHash color_hash;
+    ChafaPaletteType hash_palette_type;
+    ChafaColorSpace hash_color_space;
+    ChafaPaletteColor hash_palette_colors [CHAFA_PALETTE_INDEX_MAX];
+
+    /* With reuse_palette, a generated palette is kept for later draws
+     * until a frame quantizes much worse than the one it was made for.
+     * A fixed palette was supplied by the caller and is never replaced. */
+    guint reuse_palette : 1;
+    guint palette_is_fixed : 1;
+    guint have_palette : 1;
+    gint palette_error;
+
+    /* Bumped whenever the palette may have changed */
+    guint palette_serial;
+
+    /* Set by the owner to abandon a draw in progress, or NULL. The pixels
+     * are undefined after that. */
+    const gint *cancel_flag;
+
+    /* Draw state between chafa_indexed_image_begin_stream () and
+     * chafa_indexed_image_end_stream () */
+    gpointer stream_ctx;
 }
 ChafaIndexedImage;
 
@@ -38,6 +69,9 @@ ChafaIndexedImage *chafa_indexed_image_new (gint width, gint height,
                                             const ChafaPalette *palette,
                                             const ChafaDither *dither);
 void chafa_indexed_image_destroy (ChafaIndexedImage *indexed_image);
+void chafa_indexed_image_set_palette (ChafaIndexedImage *indexed_image, const ChafaPalette *palette);
+void chafa_indexed_image_set_fixed_palette (ChafaIndexedImage *indexed_image, const ChafaPalette *palette);
+void chafa_indexed_image_set_palette_reuse (ChafaIndexedImage *indexed_image, gboolean reuse_palette);
 void chafa_indexed_image_draw_pixels (ChafaIndexedImage *indexed_image,
                                       ChafaColorSpace color_space,
                                       ChafaPixelType src_pixel_type,
@@ -45,6 +79,15 @@ void chafa_indexed_image_draw_pixels (ChafaIndexedImage *indexed_image,
                                       gint src_width, gint src_height, gint src_rowstride,
                                       gint dest_width, gint dest_height);
 
+void chafa_indexed_image_begin_stream (ChafaIndexedImage *indexed_image,
+                                       ChafaColorSpace color_space,
+                                       ChafaPixelType src_pixel_type,
+                                       gconstpointer src_pixels,
+                                       gint src_width, gint src_height, gint src_rowstride,
+                                       gint dest_width, gint dest_height);
+gint chafa_indexed_image_draw_next_band (ChafaIndexedImage *indexed_image);
+void chafa_indexed_image_end_stream (ChafaIndexedImage *indexed_image);
+
 G_END_DECLS
 
 #endif /* __CHAFA_INDEXED_IMAGE_H__ */
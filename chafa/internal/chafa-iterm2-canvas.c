@@ -26,9 +26,12 @@
 #include "internal/chafa-bitfield.h"
 #include "internal/chafa-indexed-image.h"
 #include "internal/chafa-iterm2-canvas.h"
+#include "internal/chafa-scratch.h"
 #include "internal/chafa-string-util.h"
+#include "internal/chafa-zlib.h"
 
-/* We support iTerm2 images by embedding them as uncompressed TIFF files.
+/* We support iTerm2 images by embedding them as TIFF files. The pixel data
+ * is stored as a single strip, either uncompressed or Deflate-compressed.
  *
  * See: https://www.adobe.io/open/standards/TIFF.html */
 
@@ -76,11 +79,15 @@ typedef enum
 }
 TiffTagId;
 
+#define TIFF_COMPRESSION_NONE 1
+#define TIFF_COMPRESSION_ADOBE_DEFLATE 8
 #define TIFF_PHOTOMETRIC_INTERPRETATION_RGB 2
 #define TIFF_ORIENTATION_TOPLEFT 1
 #define TIFF_PLANAR_CONFIGURATION_CONTIGUOUS 1
 #define TIFF_EXTRA_SAMPLE_ASSOC_ALPHA 1
 
+#define TIFF_N_TAGS 12
+
 typedef struct
 {
     guint16 tag_id;
@@ -112,7 +119,9 @@ chafa_iterm2_canvas_new (gint width, gint height)
     iterm2_canvas = g_new (ChafaIterm2Canvas, 1);
     iterm2_canvas->width = width;
     iterm2_canvas->height = height;
-    iterm2_canvas->rgba_image = g_malloc (width * height * sizeof (guint32));
+    /* Rows are sent as they are, so there's no padding */
+    iterm2_canvas->rgba_image = chafa_aligned_alloc ((gsize) width * height * sizeof (guint32));
+    iterm2_canvas->compression_level = 0;
 
     return iterm2_canvas;
 }
@@ -120,10 +129,16 @@ chafa_iterm2_canvas_new (gint width, gint height)
 void
 chafa_iterm2_canvas_destroy (ChafaIterm2Canvas *iterm2_canvas)
 {
-    g_free (iterm2_canvas->rgba_image);
+    chafa_aligned_free (iterm2_canvas->rgba_image);
     g_free (iterm2_canvas);
 }
 
+void
+chafa_iterm2_canvas_set_compression_level (ChafaIterm2Canvas *iterm2_canvas, gint compression_level)
+{
+    iterm2_canvas->compression_level = compression_level;
+}
+
 static void
 draw_pixels_worker (ChafaBatchInfo *batch, const DrawCtx *ctx)
 {
@@ -164,6 +179,7 @@ chafa_iterm2_canvas_draw_all_pixels (ChafaIterm2Canvas *iterm2_canvas, ChafaPixe
                                          &ctx);
 
     chafa_process_batches (&ctx,
+                           "iterm2-draw",
                            (GFunc) draw_pixels_worker,
                            NULL,
                            iterm2_canvas->height,
@@ -173,6 +189,10 @@ chafa_iterm2_canvas_draw_all_pixels (ChafaIterm2Canvas *iterm2_canvas, ChafaPixe
     smol_scale_destroy (ctx.scale_ctx);
 }
 
+/* When streaming to a sink, pass on output after encoding this many bytes
+ * of image data. Multiple of 3 to avoid splitting base64 groups. */
+#define ITERM2_BYTES_PER_FLUSH (3 * 16384)
+
 static void
 encode_tag (ChafaBase64 *base64, GString *gs, const TiffTag *tag)
 {
@@ -194,13 +214,38 @@ generate_tag (ChafaBase64 *base64, GString *gs,
 }
 
 void
-chafa_iterm2_canvas_build_ansi (ChafaIterm2Canvas *iterm2_canvas, ChafaTermInfo *term_info, GString *out_str, gint width_cells, gint height_cells)
+chafa_iterm2_canvas_build_ansi (ChafaIterm2Canvas *iterm2_canvas, ChafaTermInfo *term_info, ChafaStringSink *sink, gint width_cells, gint height_cells)
 {
+    GString *out_str = sink->gs;
     gchar seq [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
     ChafaBase64 base64;
+    GString *compressed = NULL;
+    const guint8 *p, *last;
+    guint16 compression = TIFF_COMPRESSION_NONE;
+    gsize strip_len, strip_len_padded;
     guint32 u32;
     guint16 u16;
 
+    strip_len = iterm2_canvas->width * iterm2_canvas->height * sizeof (guint32);
+    p = iterm2_canvas->rgba_image;
+
+#ifdef HAVE_ZLIB
+    if (iterm2_canvas->compression_level > 0)
+    {
+        compressed = chafa_zlib_compress_rows (iterm2_canvas->rgba_image,
+                                               iterm2_canvas->width * sizeof (guint32),
+                                               iterm2_canvas->height,
+                                               iterm2_canvas->compression_level);
+        compression = TIFF_COMPRESSION_ADOBE_DEFLATE;
+        strip_len = compressed->len;
+        p = (const guint8 *) compressed->str;
+    }
+#endif
+
+    /* The IFD must start on a word boundary */
+    strip_len_padded = (strip_len + 1) & ~(gsize) 1;
+    last = p + strip_len;
+
     *chafa_term_info_emit_begin_iterm2_image (term_info, seq, width_cells, height_cells) = '\0';
     g_string_append (out_str, seq);
 
@@ -210,19 +255,32 @@ chafa_iterm2_canvas_build_ansi (ChafaIterm2Canvas *iterm2_canvas, ChafaTermInfo
 
     u32 = GUINT32_TO_LE (0x002a4949);
     chafa_base64_encode (&base64, out_str, &u32, sizeof (u32));
-    u32 = GUINT32_TO_LE (iterm2_canvas->width * iterm2_canvas->height * sizeof (guint32)
-                         + sizeof (guint32) * 2);
+    u32 = GUINT32_TO_LE (strip_len_padded + sizeof (guint32) * 2);
     chafa_base64_encode (&base64, out_str, &u32, sizeof (u32));
 
-    /* Image data */
+    /* Image data. Encoded in slices so it can be streamed to a sink. */
+
+    while (p < last)
+    {
+        const guint8 *end = p + MIN (last - p, ITERM2_BYTES_PER_FLUSH);
+
+        chafa_base64_encode (&base64, out_str, p, end - p);
+        chafa_string_sink_flush (sink);
+        p = end;
+    }
+
+    if (strip_len_padded != strip_len)
+    {
+        guint8 pad = 0;
+        chafa_base64_encode (&base64, out_str, &pad, 1);
+    }
 
-    chafa_base64_encode (&base64, out_str,
-                         iterm2_canvas->rgba_image,
-                         iterm2_canvas->width * iterm2_canvas->height * sizeof (guint32));
+    if (compressed)
+        g_string_free (compressed, TRUE);
 
     /* IFD */
 
-    u16 = GUINT16_TO_LE (11);  /* Tag count */
+    u16 = GUINT16_TO_LE (TIFF_N_TAGS);
     chafa_base64_encode (&base64, out_str, &u16, sizeof (u16));
 
     /* Tags */
@@ -232,19 +290,19 @@ chafa_iterm2_canvas_build_ansi (ChafaIterm2Canvas *iterm2_canvas, ChafaTermInfo
 
     /* For BitsPerSample, the data field points to external data towards the end of file */
     generate_tag (&base64, out_str, TIFF_TAG_BITS_PER_SAMPLE, TIFF_TYPE_SHORT, 4,
-                  iterm2_canvas->width * iterm2_canvas->height * sizeof (guint32)
+                  strip_len_padded
                   + sizeof (guint32) * 2
                   + sizeof (guint16)
-                  + sizeof (TiffTag) * 11 /* Tag count */
+                  + sizeof (TiffTag) * TIFF_N_TAGS
                   + sizeof (guint32));
 
+    generate_tag (&base64, out_str, TIFF_TAG_COMPRESSION, TIFF_TYPE_SHORT, 1, compression);
     generate_tag (&base64, out_str, TIFF_TAG_PHOTOMETRIC_INTERPRETATION, TIFF_TYPE_SHORT, 1, TIFF_PHOTOMETRIC_INTERPRETATION_RGB);
     generate_tag (&base64, out_str, TIFF_TAG_STRIP_OFFSETS, TIFF_TYPE_LONG, 1, sizeof (guint32) * 2);
     generate_tag (&base64, out_str, TIFF_TAG_ORIENTATION, TIFF_TYPE_SHORT, 1, TIFF_ORIENTATION_TOPLEFT);
     generate_tag (&base64, out_str, TIFF_TAG_SAMPLES_PER_PIXEL, TIFF_TYPE_SHORT, 1, 4);
     generate_tag (&base64, out_str, TIFF_TAG_ROWS_PER_STRIP, TIFF_TYPE_LONG, 1, iterm2_canvas->height);
-    generate_tag (&base64, out_str, TIFF_TAG_STRIP_BYTE_COUNTS, TIFF_TYPE_LONG, 1,
-                  iterm2_canvas->width * iterm2_canvas->height * 4);
+    generate_tag (&base64, out_str, TIFF_TAG_STRIP_BYTE_COUNTS, TIFF_TYPE_LONG, 1, strip_len);
     generate_tag (&base64, out_str, TIFF_TAG_PLANAR_CONFIGURATION, TIFF_TYPE_SHORT, 1, TIFF_PLANAR_CONFIGURATION_CONTIGUOUS);
     generate_tag (&base64, out_str, TIFF_TAG_EXTRA_SAMPLES, TIFF_TYPE_SHORT, 1, TIFF_EXTRA_SAMPLE_ASSOC_ALPHA);
 
@@ -21,6 +21,7 @@
 #define __CHAFA_ITERM2_CANVAS_H__
 
 #include "chafa.h"
+#include "internal/chafa-string-util.h"
 
 G_BEGIN_DECLS
 
@@ -28,16 +29,21 @@ typedef struct
 {
     gint width, height;
     gpointer rgba_image;
+
+    /* zlib level, 0 for uncompressed output */
+    gint compression_level;
 }
 ChafaIterm2Canvas;
 
 ChafaIterm2Canvas *chafa_iterm2_canvas_new (gint width, gint height);
 void chafa_iterm2_canvas_destroy (ChafaIterm2Canvas *iterm2_canvas);
 
+void chafa_iterm2_canvas_set_compression_level (ChafaIterm2Canvas *iterm2_canvas, gint compression_level);
+
 void chafa_iterm2_canvas_draw_all_pixels (ChafaIterm2Canvas *iterm2_canvas, ChafaPixelType src_pixel_type,
                                           gconstpointer src_pixels,
                                           gint src_width, gint src_height, gint src_rowstride);
-void chafa_iterm2_canvas_build_ansi (ChafaIterm2Canvas *iterm2_canvas, ChafaTermInfo *term_info, GString *out_str,
+void chafa_iterm2_canvas_build_ansi (ChafaIterm2Canvas *iterm2_canvas, ChafaTermInfo *term_info, ChafaStringSink *sink,
                                      gint width_cells, gint height_cells);
 
 G_END_DECLS
@@ -19,6 +19,15 @@
 
 #include "config.h"
 
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined (HAVE_SHM_OPEN) && defined (HAVE_MMAP)
+# include <sys/mman.h>
+#endif
+
 #include "chafa.h"
 #include "smolscale/smolscale.h"
 #include "internal/chafa-base64.h"
@@ -27,7 +36,9 @@
 #include "internal/chafa-indexed-image.h"
 #include "internal/chafa-kitty-canvas.h"
 #include "internal/chafa-pixops.h"
+#include "internal/chafa-scratch.h"
 #include "internal/chafa-string-util.h"
+#include "internal/chafa-zlib.h"
 
 typedef struct
 {
@@ -42,6 +53,9 @@ typedef struct
     SmolScaleCtx *scale_ctx;
     ChafaColor bg_color;
     gboolean flatten_alpha;
+
+    /* Whether flattened RGBA must be packed into RGB afterwards */
+    gboolean pack_rgb;
 }
 DrawCtx;
 
@@ -53,7 +67,9 @@ chafa_kitty_canvas_new (gint width, gint height)
     kitty_canvas = g_new0 (ChafaKittyCanvas, 1);
     kitty_canvas->width = width;
     kitty_canvas->height = height;
-    kitty_canvas->rgba_image = g_malloc (width * height * sizeof (guint32));
+    /* Rows are sent as they are, so there's no padding */
+    kitty_canvas->image = chafa_aligned_alloc ((gsize) width * height * sizeof (guint32));
+    kitty_canvas->bytes_per_pixel = 4;
 
     return kitty_canvas;
 }
@@ -61,25 +77,75 @@ chafa_kitty_canvas_new (gint width, gint height)
 void
 chafa_kitty_canvas_destroy (ChafaKittyCanvas *kitty_canvas)
 {
-    g_free (kitty_canvas->rgba_image);
+    chafa_aligned_free (kitty_canvas->image);
+    g_free (kitty_canvas->emitted_image);
     g_free (kitty_canvas);
 }
 
+void
+chafa_kitty_canvas_set_compression_level (ChafaKittyCanvas *kitty_canvas, gint compression_level)
+{
+    kitty_canvas->compression_level = compression_level;
+}
+
+void
+chafa_kitty_canvas_set_transmission_medium (ChafaKittyCanvas *kitty_canvas,
+                                            ChafaTransmissionMedium transmission_medium)
+{
+    kitty_canvas->transmission_medium = transmission_medium;
+}
+
+static gsize
+image_size (const ChafaKittyCanvas *kitty_canvas)
+{
+    return (gsize) kitty_canvas->width * kitty_canvas->height * kitty_canvas->bytes_per_pixel;
+}
+
+static void
+pack_rgba_to_rgb (guint8 *dest, const guint8 *src, gsize n_pixels)
+{
+    const guint8 *src_max = src + n_pixels * 4;
+
+    for ( ; src < src_max; src += 4, dest += 3)
+    {
+        dest [0] = src [0];
+        dest [1] = src [1];
+        dest [2] = src [2];
+    }
+}
+
 static void
 draw_pixels_worker (ChafaBatchInfo *batch, const DrawCtx *ctx)
 {
-    smol_scale_batch_full (ctx->scale_ctx,
-                           ((guint32 *) ctx->kitty_canvas->rgba_image) + (ctx->kitty_canvas->width * batch->first_row),
-                           batch->first_row,
-                           batch->n_rows);
+    ChafaKittyCanvas *kitty_canvas = ctx->kitty_canvas;
+    gsize n_pixels = (gsize) kitty_canvas->width * batch->n_rows;
+    guint8 *dest;
+
+    dest = (guint8 *) kitty_canvas->image
+        + (gsize) kitty_canvas->width * batch->first_row * kitty_canvas->bytes_per_pixel;
+
+    if (!ctx->pack_rgb)
+    {
+        smol_scale_batch_full (ctx->scale_ctx, dest, batch->first_row, batch->n_rows);
 
-    /* FIXME: Smolscale should be able to do this */
-    if (ctx->flatten_alpha)
-        chafa_composite_rgba_on_solid_color (ctx->bg_color,
-                                             ctx->kitty_canvas->rgba_image,
-                                             ctx->kitty_canvas->width,
-                                             batch->first_row,
-                                             batch->n_rows);
+        /* FIXME: Smolscale should be able to do this */
+        if (ctx->flatten_alpha)
+            chafa_composite_rgba_on_solid_color (ctx->bg_color,
+                                                 kitty_canvas->image,
+                                                 kitty_canvas->width,
+                                                 batch->first_row,
+                                                 batch->n_rows);
+    }
+    else
+    {
+        ChafaPixel *pixels = g_new (ChafaPixel, n_pixels);
+
+        smol_scale_batch_full (ctx->scale_ctx, pixels, batch->first_row, batch->n_rows);
+        chafa_composite_rgba_on_solid_color (ctx->bg_color, pixels, kitty_canvas->width,
+                                             0, batch->n_rows);
+        pack_rgba_to_rgb (dest, (const guint8 *) pixels, n_pixels);
+        g_free (pixels);
+    }
 }
 
 void
@@ -89,6 +155,7 @@ chafa_kitty_canvas_draw_all_pixels (ChafaKittyCanvas *kitty_canvas, ChafaPixelTy
                                     ChafaColor bg_color)
 {
     DrawCtx ctx;
+    gboolean src_is_opaque;
 
     g_return_if_fail (kitty_canvas != NULL);
     g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
@@ -99,23 +166,33 @@ chafa_kitty_canvas_draw_all_pixels (ChafaKittyCanvas *kitty_canvas, ChafaPixelTy
     if (src_width == 0 || src_height == 0)
         return;
 
+    /* Opaque sources are scaled straight to packed RGB. Others are too if
+     * their alpha gets flattened, but that takes a detour through RGBA. */
+    src_is_opaque = chafa_pixel_type_is_opaque (src_pixel_type);
+
     ctx.kitty_canvas = kitty_canvas;
+    ctx.bg_color = bg_color;
+    ctx.flatten_alpha = !src_is_opaque && bg_color.ch [3] == 0;
+    ctx.pack_rgb = ctx.flatten_alpha;
+
+    kitty_canvas->bytes_per_pixel = (src_is_opaque || ctx.flatten_alpha) ? 3 : 4;
+
     ctx.scale_ctx = smol_scale_new_full ((SmolPixelType) src_pixel_type,
                                          (const guint32 *) src_pixels,
                                          src_width,
                                          src_height,
                                          src_rowstride,
-                                         SMOL_PIXEL_RGBA8_PREMULTIPLIED,
+                                         src_is_opaque ? SMOL_PIXEL_RGB8
+                                         : SMOL_PIXEL_RGBA8_PREMULTIPLIED,
                                          NULL,
                                          kitty_canvas->width,
                                          kitty_canvas->height,
-                                         kitty_canvas->width * sizeof (guint32),
+                                         kitty_canvas->width * (src_is_opaque ? 3 : 4),
                                          NULL,
                                          &ctx);
-    ctx.bg_color = bg_color;
-    ctx.flatten_alpha = bg_color.ch [3] == 0;
 
     chafa_process_batches (&ctx,
+                           "kitty-draw",
                            (GFunc) draw_pixels_worker,
                            NULL,
                            kitty_canvas->height,
@@ -125,6 +202,12 @@ chafa_kitty_canvas_draw_all_pixels (ChafaKittyCanvas *kitty_canvas, ChafaPixelTy
     smol_scale_destroy (ctx.scale_ctx);
 }
 
+/* When streaming to a sink, pass on output after this many chunks */
+#define KITTY_CHUNKS_PER_FLUSH 64
+
+/* Side of the square tiles compared when sending only what changed */
+#define KITTY_TILE_SIZE 32
+
 static void
 encode_chunk (GString *gs, const guint8 *start, const guint8 *end)
 {
@@ -136,25 +219,147 @@ encode_chunk (GString *gs, const guint8 *start, const guint8 *end)
     chafa_base64_deinit (&base64);
 }
 
-void
-chafa_kitty_canvas_build_ansi (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info, GString *out_str,
-                               gint width_cells, gint height_cells)
+#if defined (HAVE_SHM_OPEN) && defined (HAVE_MMAP)
+
+/* Copies the image to a new POSIX shared memory object. Returns the
+ * object's name, or NULL on failure. The terminal unlinks the object
+ * once it's been read. */
+static gchar *
+write_shm (ChafaKittyCanvas *kitty_canvas)
+{
+    static gint serial = 0;
+    gsize len = image_size (kitty_canvas);
+    gpointer map;
+    gchar *name;
+    gint fd;
+
+    name = g_strdup_printf ("/chafa-%d-%d", (gint) getpid (),
+                            g_atomic_int_add (&serial, 1));
+
+    fd = shm_open (name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+        goto fail;
+
+    if (ftruncate (fd, len) < 0)
+        goto fail_unlink;
+
+    map = mmap (NULL, len, PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED)
+        goto fail_unlink;
+
+    memcpy (map, kitty_canvas->image, len);
+    munmap (map, len);
+    close (fd);
+    return name;
+
+fail_unlink:
+    shm_unlink (name);
+    close (fd);
+fail:
+    g_free (name);
+    return NULL;
+}
+
+#endif
+
+/* Writes the image to a new temporary file. Returns the file's absolute
+ * path, or NULL on failure. The terminal only deletes files in temporary
+ * directories whose names contain "tty-graphics-protocol". */
+static gchar *
+write_temp_file (ChafaKittyCanvas *kitty_canvas)
+{
+    gsize len = image_size (kitty_canvas);
+    const guint8 *p = kitty_canvas->image;
+    gchar *path = NULL;
+    gint fd;
+
+    fd = g_file_open_tmp ("tty-graphics-protocol-chafa-XXXXXX", &path, NULL);
+    if (fd < 0)
+        return NULL;
+
+    while (len > 0)
+    {
+        gssize n_written = write (fd, p, len);
+
+        if (n_written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            unlink (path);
+            close (fd);
+            g_free (path);
+            return NULL;
+        }
+
+        p += n_written;
+        len -= n_written;
+    }
+
+    close (fd);
+    return path;
+}
+
+/* Emits a single escape sequence naming the file or shared memory object
+ * the terminal should read the image from. Returns FALSE if the medium
+ * isn't available, in which case nothing is emitted. */
+static gboolean
+build_ansi_indirect (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info, GString *out_str,
+                     gint width_cells, gint height_cells)
 {
-    const guint8 *p, *last;
     gchar seq [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
+    gchar *name = NULL;
+
+#if defined (HAVE_SHM_OPEN) && defined (HAVE_MMAP)
+    if (kitty_canvas->transmission_medium == CHAFA_TRANSMISSION_MEDIUM_SHARED_MEMORY
+        && chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_SHM_IMAGE_V1)
+        && (name = write_shm (kitty_canvas)))
+    {
+        *chafa_term_info_emit_begin_kitty_immediate_shm_image_v1 (term_info, seq,
+                                                                  kitty_canvas->bytes_per_pixel * 8,
+                                                                  kitty_canvas->width,
+                                                                  kitty_canvas->height,
+                                                                  width_cells,
+                                                                  height_cells) = '\0';
+    }
+#endif
+
+    /* Temporary files are also the fallback for failed shared memory */
+    if (!name
+        && kitty_canvas->transmission_medium != CHAFA_TRANSMISSION_MEDIUM_DIRECT
+        && chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_FILE_IMAGE_V1)
+        && (name = write_temp_file (kitty_canvas)))
+    {
+        *chafa_term_info_emit_begin_kitty_immediate_file_image_v1 (term_info, seq,
+                                                                   kitty_canvas->bytes_per_pixel * 8,
+                                                                   kitty_canvas->width,
+                                                                   kitty_canvas->height,
+                                                                   width_cells,
+                                                                   height_cells) = '\0';
+    }
+
+    if (!name)
+        return FALSE;
 
-    *chafa_term_info_emit_begin_kitty_immediate_image_v1 (term_info, seq,
-                                                          32,
-                                                          kitty_canvas->width,
-                                                          kitty_canvas->height,
-                                                          width_cells,
-                                                          height_cells) = '\0';
     g_string_append (out_str, seq);
+    encode_chunk (out_str, (const guint8 *) name, (const guint8 *) name + strlen (name));
 
-    last = ((guint8 *) kitty_canvas->rgba_image)
-        + kitty_canvas->width * kitty_canvas->height * sizeof (guint32);
+    *chafa_term_info_emit_end_kitty_image_chunk (term_info, seq) = '\0';
+    g_string_append (out_str, seq);
+
+    g_free (name);
+    return TRUE;
+}
+
+/* Sends the data following a begin sequence, and ends the image */
+static void
+emit_chunks (ChafaTermInfo *term_info, ChafaStringSink *sink,
+             const guint8 *p, const guint8 *last, gint *n_chunks)
+{
+    GString *out_str = sink->gs;
+    gchar seq [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
 
-    for (p = kitty_canvas->rgba_image; p < last; )
+    while (p < last)
     {
         const guint8 *end;
 
@@ -170,9 +375,291 @@ chafa_kitty_canvas_build_ansi (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *te
         *chafa_term_info_emit_end_kitty_image_chunk (term_info, seq) = '\0';
         g_string_append (out_str, seq);
 
+        if (++(*n_chunks) % KITTY_CHUNKS_PER_FLUSH == 0)
+            chafa_string_sink_flush (sink);
+
         p = end;
     }
 
     *chafa_term_info_emit_end_kitty_image (term_info, seq) = '\0';
     g_string_append (out_str, seq);
 }
+
+static void
+remember_emitted_image (ChafaKittyCanvas *kitty_canvas, guint image_id)
+{
+    /* Sized for RGBA, so it can be reused whatever the format */
+    if (!kitty_canvas->emitted_image)
+        kitty_canvas->emitted_image = g_malloc (kitty_canvas->width * kitty_canvas->height
+                                                * sizeof (guint32));
+    memcpy (kitty_canvas->emitted_image, kitty_canvas->image, image_size (kitty_canvas));
+    kitty_canvas->emitted_image_id = image_id;
+    kitty_canvas->emitted_bytes_per_pixel = kitty_canvas->bytes_per_pixel;
+}
+
+void
+chafa_kitty_canvas_build_ansi (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info, ChafaStringSink *sink,
+                               gint width_cells, gint height_cells, guint image_id)
+{
+    GString *out_str = sink->gs;
+    GString *compressed = NULL;
+    const guint8 *p, *last;
+    gchar seq [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
+    gint n_chunks = 0;
+    gboolean store;
+
+    store = image_id > 0
+        && chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1)
+        && chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1);
+
+    /* Local transfers skip compression; it would only cost time */
+    if (!store
+        && kitty_canvas->transmission_medium != CHAFA_TRANSMISSION_MEDIUM_DIRECT
+        && build_ansi_indirect (kitty_canvas, term_info, out_str, width_cells, height_cells))
+        return;
+
+#ifdef HAVE_ZLIB
+    if (kitty_canvas->compression_level > 0
+        && chafa_term_info_have_seq (term_info,
+                                     store ? CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_COMPRESSED_IMAGE_V1
+                                     : CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_COMPRESSED_IMAGE_V1))
+        compressed = chafa_zlib_compress_rows (kitty_canvas->image,
+                                               kitty_canvas->width * kitty_canvas->bytes_per_pixel,
+                                               kitty_canvas->height,
+                                               kitty_canvas->compression_level);
+#endif
+
+    if (compressed)
+    {
+        if (store)
+            *chafa_term_info_emit_begin_kitty_store_compressed_image_v1 (term_info, seq,
+                                                                         image_id,
+                                                                         kitty_canvas->bytes_per_pixel * 8,
+                                                                         kitty_canvas->width,
+                                                                         kitty_canvas->height) = '\0';
+        else
+            *chafa_term_info_emit_begin_kitty_immediate_compressed_image_v1 (term_info, seq,
+                                                                             kitty_canvas->bytes_per_pixel * 8,
+                                                                             kitty_canvas->width,
+                                                                             kitty_canvas->height,
+                                                                             width_cells,
+                                                                             height_cells) = '\0';
+        p = (const guint8 *) compressed->str;
+        last = p + compressed->len;
+    }
+    else
+    {
+        if (store)
+            *chafa_term_info_emit_begin_kitty_store_image_v1 (term_info, seq,
+                                                              image_id,
+                                                              kitty_canvas->bytes_per_pixel * 8,
+                                                              kitty_canvas->width,
+                                                              kitty_canvas->height) = '\0';
+        else
+            *chafa_term_info_emit_begin_kitty_immediate_image_v1 (term_info, seq,
+                                                                  kitty_canvas->bytes_per_pixel * 8,
+                                                                  kitty_canvas->width,
+                                                                  kitty_canvas->height,
+                                                                  width_cells,
+                                                                  height_cells) = '\0';
+        p = kitty_canvas->image;
+        last = p + image_size (kitty_canvas);
+    }
+
+    g_string_append (out_str, seq);
+    emit_chunks (term_info, sink, p, last, &n_chunks);
+
+    /* Stored images must be placed separately */
+    if (store)
+    {
+        remember_emitted_image (kitty_canvas, image_id);
+
+        *chafa_term_info_emit_place_kitty_image_v1 (term_info, seq,
+                                                    image_id,
+                                                    width_cells,
+                                                    height_cells) = '\0';
+        g_string_append (out_str, seq);
+    }
+
+    if (compressed)
+        g_string_free (compressed, TRUE);
+}
+
+static gboolean
+tile_is_unchanged (const ChafaKittyCanvas *kitty_canvas, gint tx, gint ty)
+{
+    const guint8 *a = kitty_canvas->image;
+    const guint8 *b = kitty_canvas->emitted_image;
+    gint bpp = kitty_canvas->bytes_per_pixel;
+    gint x0 = tx * KITTY_TILE_SIZE;
+    gint y0 = ty * KITTY_TILE_SIZE;
+    gint w = MIN (KITTY_TILE_SIZE, kitty_canvas->width - x0);
+    gint y1 = MIN (y0 + KITTY_TILE_SIZE, kitty_canvas->height);
+    gint y;
+
+    for (y = y0; y < y1; y++)
+    {
+        gsize ofs = ((gsize) y * kitty_canvas->width + x0) * bpp;
+
+        if (memcmp (a + ofs, b + ofs, w * bpp))
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* Sends one rectangle of the image to replace the same pixels in the
+ * stored copy. Coordinates are in pixels. */
+static void
+emit_update_rect (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info, ChafaStringSink *sink,
+                  guint image_id, gint x, gint y, gint w, gint h, gint *n_chunks)
+{
+    gchar seq [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
+    GString *compressed = NULL;
+    gint bpp = kitty_canvas->bytes_per_pixel;
+    guint8 *rect;
+    gint i;
+
+    /* The protocol wants the rectangle's rows back to back */
+    rect = g_malloc ((gsize) w * h * bpp);
+    for (i = 0; i < h; i++)
+        memcpy (rect + (gsize) i * w * bpp,
+                (const guint8 *) kitty_canvas->image
+                + ((gsize) (y + i) * kitty_canvas->width + x) * bpp,
+                w * bpp);
+
+#ifdef HAVE_ZLIB
+    if (kitty_canvas->compression_level > 0
+        && chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_COMPRESSED_IMAGE_V1))
+        compressed = chafa_zlib_compress_rows (rect, w * bpp, h,
+                                               kitty_canvas->compression_level);
+#endif
+
+    if (compressed)
+    {
+        *chafa_term_info_emit_begin_kitty_update_compressed_image_v1 (term_info, seq,
+                                                                      image_id, bpp * 8,
+                                                                      x, y, w, h) = '\0';
+        g_string_append (sink->gs, seq);
+        emit_chunks (term_info, sink,
+                     (const guint8 *) compressed->str,
+                     (const guint8 *) compressed->str + compressed->len,
+                     n_chunks);
+        g_string_free (compressed, TRUE);
+    }
+    else
+    {
+        *chafa_term_info_emit_begin_kitty_update_image_v1 (term_info, seq,
+                                                           image_id, bpp * 8,
+                                                           x, y, w, h) = '\0';
+        g_string_append (sink->gs, seq);
+        emit_chunks (term_info, sink, rect, rect + (gsize) w * h * bpp, n_chunks);
+    }
+
+    g_free (rect);
+}
+
+/* Sends only the tiles that changed since the image was last stored under
+ * image_id, assuming it's still on screen at the cursor position. Changed
+ * tiles are merged into horizontal runs, and runs spanning the same
+ * columns in consecutive tile rows are merged into one rectangle.
+ *
+ * Returns FALSE without emitting anything if there's no stored image to
+ * update, in which case the caller must do a full build. */
+gboolean
+chafa_kitty_canvas_build_ansi_delta (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info,
+                                     ChafaStringSink *sink,
+                                     gint width_cells, gint height_cells, guint image_id)
+{
+    gint n_tiles_x = (kitty_canvas->width + KITTY_TILE_SIZE - 1) / KITTY_TILE_SIZE;
+    gint n_tiles_y = (kitty_canvas->height + KITTY_TILE_SIZE - 1) / KITTY_TILE_SIZE;
+    gchar seq [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
+    gint *open_x1, *open_y0, *row_x1;
+    gint n_chunks = 0;
+    gint tx, ty;
+
+    if (image_id == 0
+        || !kitty_canvas->emitted_image
+        || kitty_canvas->emitted_image_id != image_id
+        || kitty_canvas->emitted_bytes_per_pixel != kitty_canvas->bytes_per_pixel
+        || !chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_IMAGE_V1)
+        || !chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_CURSOR_DOWN)
+        || !chafa_term_info_have_seq (term_info, CHAFA_TERM_SEQ_CURSOR_RIGHT))
+        return FALSE;
+
+    /* For each tile column, the end of the run starting there in the
+     * rectangle being grown, and the tile row it started in; -1 if none */
+    open_x1 = g_new (gint, n_tiles_x);
+    open_y0 = g_new (gint, n_tiles_x);
+    row_x1 = g_new (gint, n_tiles_x);
+    for (tx = 0; tx < n_tiles_x; tx++)
+        open_x1 [tx] = -1;
+
+    for (ty = 0; ty <= n_tiles_y; ty++)
+    {
+        for (tx = 0; tx < n_tiles_x; tx++)
+            row_x1 [tx] = -1;
+
+        /* Find this row's runs. The sentinel row past the end has none,
+         * flushing everything that's still open. */
+        for (tx = 0; ty < n_tiles_y && tx < n_tiles_x; )
+        {
+            gint x1;
+
+            if (tile_is_unchanged (kitty_canvas, tx, ty))
+            {
+                tx++;
+                continue;
+            }
+
+            for (x1 = tx + 1; x1 < n_tiles_x && !tile_is_unchanged (kitty_canvas, x1, ty); x1++)
+                ;
+
+            row_x1 [tx] = x1;
+            tx = x1;
+        }
+
+        /* Runs that don't continue in this row are done */
+        for (tx = 0; tx < n_tiles_x; tx++)
+        {
+            gint x, y;
+
+            if (open_x1 [tx] < 0 || open_x1 [tx] == row_x1 [tx])
+                continue;
+
+            x = tx * KITTY_TILE_SIZE;
+            y = open_y0 [tx] * KITTY_TILE_SIZE;
+            emit_update_rect (kitty_canvas, term_info, sink, image_id,
+                              x, y,
+                              MIN (open_x1 [tx] * KITTY_TILE_SIZE, kitty_canvas->width) - x,
+                              MIN (ty * KITTY_TILE_SIZE, kitty_canvas->height) - y,
+                              &n_chunks);
+            open_x1 [tx] = -1;
+        }
+
+        for (tx = 0; tx < n_tiles_x; tx++)
+        {
+            if (row_x1 [tx] >= 0 && open_x1 [tx] < 0)
+            {
+                open_x1 [tx] = row_x1 [tx];
+                open_y0 [tx] = ty;
+            }
+        }
+    }
+
+    g_free (open_x1);
+    g_free (open_y0);
+    g_free (row_x1);
+
+    /* Leave the cursor where placing the image would have */
+    if (height_cells > 1)
+    {
+        *chafa_term_info_emit_cursor_down (term_info, seq, height_cells - 1) = '\0';
+        g_string_append (sink->gs, seq);
+    }
+    *chafa_term_info_emit_cursor_right (term_info, seq, width_cells) = '\0';
+    g_string_append (sink->gs, seq);
+
+    remember_emitted_image (kitty_canvas, image_id);
+    return TRUE;
+}
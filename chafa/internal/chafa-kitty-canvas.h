@@ -21,26 +21,50 @@
 #define __CHAFA_KITTY_CANVAS_H__
 
 #include "chafa.h"
+#include "internal/chafa-string-util.h"
 
 G_BEGIN_DECLS
 
 typedef struct
 {
     gint width, height;
-    gpointer rgba_image;
+
+    /* Premultiplied RGBA, or packed RGB if the last frame drawn was opaque.
+     * Kitty takes both, and RGB saves a quarter of the payload. The buffer
+     * has room for RGBA either way. */
+    gpointer image;
+    gint bytes_per_pixel;
+
+    /* zlib level, 0 for uncompressed output */
+    gint compression_level;
+
+    /* Preferred medium; falls back to direct if unavailable */
+    ChafaTransmissionMedium transmission_medium;
+
+    /* Copy of the image as last stored in the terminal, and its ID, so
+     * later builds can send only the tiles that changed */
+    gpointer emitted_image;
+    guint emitted_image_id;
+    gint emitted_bytes_per_pixel;
 }
 ChafaKittyCanvas;
 
 ChafaKittyCanvas *chafa_kitty_canvas_new (gint width, gint height);
 void chafa_kitty_canvas_destroy (ChafaKittyCanvas *kitty_canvas);
+void chafa_kitty_canvas_set_compression_level (ChafaKittyCanvas *kitty_canvas, gint compression_level);
+void chafa_kitty_canvas_set_transmission_medium (ChafaKittyCanvas *kitty_canvas,
+                                                 ChafaTransmissionMedium transmission_medium);
 
 void chafa_kitty_canvas_draw_all_pixels (ChafaKittyCanvas *kitty_canvas,
                                          ChafaPixelType src_pixel_type,
                                          gconstpointer src_pixels,
                                          gint src_width, gint src_height, gint src_rowstride,
                                          ChafaColor bg_color);
-void chafa_kitty_canvas_build_ansi (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info, GString *out_str,
-                                    gint width_cells, gint height_cells);
+void chafa_kitty_canvas_build_ansi (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info, ChafaStringSink *sink,
+                                    gint width_cells, gint height_cells, guint image_id);
+gboolean chafa_kitty_canvas_build_ansi_delta (ChafaKittyCanvas *kitty_canvas, ChafaTermInfo *term_info,
+                                              ChafaStringSink *sink,
+                                              gint width_cells, gint height_cells, guint image_id);
 
 G_END_DECLS
 
@@ -24,7 +24,7 @@
 #include "internal/chafa-private.h"
 
 void
-calc_colors_mmx (const ChafaPixel *pixels, ChafaColorAccum *accums_out, const guint8 *cov)
+calc_colors_mmx (const ChafaPixel *pixels, ChafaColorAccum *accums_out, guint64 bitmap)
 {
     __m64 accum [2] = { 0 };
     const guint32 *u32p0 = (const guint32 *) pixels;
@@ -38,7 +38,7 @@ calc_colors_mmx (const ChafaPixel *pixels, ChafaColorAccum *accums_out, const gu
         __m64 *m64p1;
         __m64 m64a;
 
-        m64p1 = &accum [cov [i]];
+        m64p1 = &accum [(bitmap >> (CHAFA_SYMBOL_N_PIXELS - 1 - i)) & 1];
         m64a = _mm_cvtsi32_si64 (u32p0 [i]);
         m64a = _mm_unpacklo_pi8 (m64a, m64b);
         *m64p1 = _mm_adds_pi16 (*m64p1, m64a);
@@ -57,6 +57,12 @@ void
 chafa_leave_mmx (void)
 {
 #ifdef HAVE_MMX_INTRINSICS
+    /* The AVX2 paths take precedence and never touch MMX state */
+# ifdef HAVE_AVX2_INTRINSICS
+    if (chafa_have_avx2 ())
+        return;
+# endif
+
     if (chafa_have_mmx ())
         _mm_empty ();
 #endif
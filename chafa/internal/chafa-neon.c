@@ -0,0 +1,127 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <arm_neon.h>
+#include "chafa.h"
+#include "internal/chafa-private.h"
+
+/* Stops early and returns a partial sum once the error reaches max_error */
+gint
+calc_error_neon (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov,
+                 gint max_error)
+{
+    const guint32 *u32p0 = (const guint32 *) pixels;
+    const guint32 *u32p1 = (const guint32 *) color_pair->colors;
+    int32x4_t err4 = vdupq_n_s32 (0);
+    gint i;
+
+    /* Two pixels per iteration. The 8-bit channels are widened to 16 bits
+     * by the subtraction, and the squares accumulate in one 32-bit lane
+     * per channel. */
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i += 2)
+    {
+        uint32x2_t p, c;
+        int16x8_t d;
+
+        p = vld1_u32 (u32p0 + i);
+        c = vdup_n_u32 (u32p1 [cov [i]]);
+        c = vset_lane_u32 (u32p1 [cov [i + 1]], c, 1);
+
+        d = vreinterpretq_s16_u16 (vsubl_u8 (vreinterpret_u8_u32 (p),
+                                             vreinterpret_u8_u32 (c)));
+        err4 = vmlal_s16 (err4, vget_low_s16 (d), vget_low_s16 (d));
+        err4 = vmlal_s16 (err4, vget_high_s16 (d), vget_high_s16 (d));
+
+        /* The alpha lane isn't part of the error */
+        if ((i & 15) == 14
+            && vgetq_lane_s32 (err4, 0) + vgetq_lane_s32 (err4, 1) + vgetq_lane_s32 (err4, 2) >= max_error)
+            break;
+    }
+
+    return vgetq_lane_s32 (err4, 0) + vgetq_lane_s32 (err4, 1) + vgetq_lane_s32 (err4, 2);
+}
+
+/* Population counts of a ^ b, with the count for each 64-bit element
+ * spread over four 16-bit lanes */
+static inline uint16x8_t
+hamming_distance_u16x8 (uint64x2_t a, const guint64 *b)
+{
+    return vpaddlq_u8 (vcntq_u8 (vreinterpretq_u8_u64 (veorq_u64 (a, vld1q_u64 (b)))));
+}
+
+void
+chafa_hamming_distance_vu64_neon (guint64 a, const guint64 *vb, gint *vc, gint n)
+{
+    uint64x2_t va = vdupq_n_u64 (a);
+
+    while (n >= 4)
+    {
+        uint16x8_t s;
+
+        /* Each pairwise add halves the number of lanes per element; two
+         * of them leave one 16-bit count per element in the low half */
+        s = vpaddq_u16 (hamming_distance_u16x8 (va, vb), hamming_distance_u16x8 (va, vb + 2));
+        s = vpaddq_u16 (s, s);
+        vst1q_s32 ((int32_t *) vc, vreinterpretq_s32_u32 (vmovl_u16 (vget_low_u16 (s))));
+
+        vb += 4;
+        vc += 4;
+        n -= 4;
+    }
+
+    while (n--)
+        *(vc++) = vaddv_u8 (vcnt_u8 (vcreate_u8 (a ^ *(vb++))));
+}
+
+/* Two bitmaps per item (a points to a pair, vb points to array of pairs) */
+void
+chafa_hamming_distance_2_vu64_neon (const guint64 *a, const guint64 *vb, gint *vc, gint n)
+{
+    uint64x2_t va = vld1q_u64 (a);
+
+    while (n >= 4)
+    {
+        uint8x16_t c0, c1, c2, c3, s;
+
+        c0 = vcntq_u8 (vreinterpretq_u8_u64 (veorq_u64 (va, vld1q_u64 (vb))));
+        c1 = vcntq_u8 (vreinterpretq_u8_u64 (veorq_u64 (va, vld1q_u64 (vb + 2))));
+        c2 = vcntq_u8 (vreinterpretq_u8_u64 (veorq_u64 (va, vld1q_u64 (vb + 4))));
+        c3 = vcntq_u8 (vreinterpretq_u8_u64 (veorq_u64 (va, vld1q_u64 (vb + 6))));
+
+        /* A pair of bitmaps has at most 128 bits set, so the sums fit in
+         * bytes all the way down to one byte per item */
+        s = vpaddq_u8 (vpaddq_u8 (c0, c1), vpaddq_u8 (c2, c3));
+        s = vpaddq_u8 (s, s);
+        s = vpaddq_u8 (s, s);
+        vst1q_s32 ((int32_t *) vc,
+                   vreinterpretq_s32_u32 (vmovl_u16 (vget_low_u16 (vmovl_u8 (vget_low_u8 (s))))));
+
+        vb += 8;
+        vc += 4;
+        n -= 4;
+    }
+
+    while (n--)
+    {
+        *(vc++) = vaddvq_u8 (vcntq_u8 (vreinterpretq_u8_u64 (veorq_u64 (va, vld1q_u64 (vb)))));
+        vb += 2;
+    }
+}
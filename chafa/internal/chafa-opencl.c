@@ -0,0 +1,338 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+
+#include "config.h"
+
+#ifdef HAVE_OPENCL
+# define CL_TARGET_OPENCL_VERSION 120
+# ifdef __APPLE__
+#  include <OpenCL/opencl.h>
+# else
+#  include <CL/cl.h>
+# endif
+#endif
+
+#include "chafa.h"
+#include "internal/chafa-opencl.h"
+#include "internal/chafa-private.h"
+
+#ifdef HAVE_OPENCL
+
+/* One work item per cell. The colors and error are worked out from pixel
+ * sums the same way chafa_work_cell_get_mean_colors_for_symbol () and
+ * calc_error_plain () do on the CPU: Means are truncated, a side with no
+ * pixels is black, and only the first three channels count towards the
+ * error. The sum of squared differences from a side's mean c is
+ * sq - 2 c.S + n |c|^2, which is exact in integers.
+ *
+ * Symbols are tried in order and must beat the best so far, and the
+ * search stops at a perfect match, so ties go the same way too. */
+static const gchar kernel_source [] =
+    "__kernel void\n"
+    "pick_symbols (__global const uchar4 *pixels, int rowstride, int x0,\n"
+    "              __global const ulong *bitmaps, int n_symbols,\n"
+    "              __global int2 *results_out, __global uchar4 *colors_out)\n"
+    "{\n"
+    "    int cx = get_global_id (0), cy = get_global_id (1);\n"
+    "    int i = cy * get_global_size (0) + cx;\n"
+    "    __global const uchar4 *row_p = pixels + cy * 8 * rowstride + (x0 + cx) * 8;\n"
+    "    int4 block [64];\n"
+    "    int sq [64];\n"
+    "    int4 total = 0;\n"
+    "    int total_sq = 0;\n"
+    "    int4 best_fg = 0, best_bg = 0;\n"
+    "    int best_error = 0x7fffffff / 8, best_symbol = 0;\n"
+    "    int j, s;\n"
+    "\n"
+    "    for (j = 0; j < 64; j++)\n"
+    "    {\n"
+    "        int4 p = convert_int4 (row_p [(j / 8) * rowstride + (j % 8)]);\n"
+    "        block [j] = p;\n"
+    "        sq [j] = p.x * p.x + p.y * p.y + p.z * p.z;\n"
+    "        total += p;\n"
+    "        total_sq += sq [j];\n"
+    "    }\n"
+    "\n"
+    "    for (s = 0; s < n_symbols && best_error > 0; s++)\n"
+    "    {\n"
+    "        ulong bm = bitmaps [s];\n"
+    "        int n_fg = popcount (bm), n_bg = 64 - n_fg;\n"
+    "        int4 fg_sum = 0, bg_sum, fg, bg;\n"
+    "        int fg_sq = 0, bg_sq, error;\n"
+    "\n"
+    "        for (j = 0; j < 64; j++)\n"
+    "        {\n"
+    "            if ((bm >> (63 - j)) & 1)\n"
+    "            {\n"
+    "                fg_sum += block [j];\n"
+    "                fg_sq += sq [j];\n"
+    "            }\n"
+    "        }\n"
+    "\n"
+    "        bg_sum = total - fg_sum;\n"
+    "        bg_sq = total_sq - fg_sq;\n"
+    "        fg = n_fg > 1 ? fg_sum / n_fg : fg_sum;\n"
+    "        bg = n_bg > 1 ? bg_sum / n_bg : bg_sum;\n"
+    "\n"
+    "        error = fg_sq - 2 * (fg.x * fg_sum.x + fg.y * fg_sum.y + fg.z * fg_sum.z)\n"
+    "            + n_fg * (fg.x * fg.x + fg.y * fg.y + fg.z * fg.z)\n"
+    "            + bg_sq - 2 * (bg.x * bg_sum.x + bg.y * bg_sum.y + bg.z * bg_sum.z)\n"
+    "            + n_bg * (bg.x * bg.x + bg.y * bg.y + bg.z * bg.z);\n"
+    "\n"
+    "        if (error < best_error)\n"
+    "        {\n"
+    "            best_error = error;\n"
+    "            best_symbol = s;\n"
+    "            best_fg = fg;\n"
+    "            best_bg = bg;\n"
+    "        }\n"
+    "    }\n"
+    "\n"
+    "    results_out [i] = (int2) (best_symbol, best_error);\n"
+    "    colors_out [i * 2] = convert_uchar4 (best_bg);\n"
+    "    colors_out [i * 2 + 1] = convert_uchar4 (best_fg);\n"
+    "}\n";
+
+typedef struct
+{
+    cl_context context;
+    cl_device_id device;
+    cl_program program;
+}
+OpenclShared;
+
+struct ChafaOpenclPicker
+{
+    cl_command_queue queue;
+    cl_kernel kernel;
+    cl_mem bitmaps;
+    gint n_symbols;
+};
+
+static OpenclShared *shared;
+static gsize shared_initialized;
+
+static cl_device_id
+find_gpu_device (void)
+{
+    cl_platform_id platforms [16];
+    cl_uint n_platforms = 0;
+    cl_uint i;
+
+    if (clGetPlatformIDs (G_N_ELEMENTS (platforms), platforms, &n_platforms) != CL_SUCCESS)
+        return NULL;
+
+    for (i = 0; i < n_platforms && i < G_N_ELEMENTS (platforms); i++)
+    {
+        cl_device_id device;
+
+        if (clGetDeviceIDs (platforms [i], CL_DEVICE_TYPE_GPU, 1, &device, NULL) == CL_SUCCESS)
+            return device;
+    }
+
+    return NULL;
+}
+
+/* Returns NULL if there's no usable device. Done once; a failure sticks */
+static OpenclShared *
+shared_new (void)
+{
+    OpenclShared *sh;
+    const gchar *src = kernel_source;
+    cl_int err;
+
+    sh = g_new0 (OpenclShared, 1);
+
+    sh->device = find_gpu_device ();
+    if (!sh->device)
+        goto fail;
+
+    sh->context = clCreateContext (NULL, 1, &sh->device, NULL, NULL, &err);
+    if (err != CL_SUCCESS)
+        goto fail;
+
+    sh->program = clCreateProgramWithSource (sh->context, 1, &src, NULL, &err);
+    if (err != CL_SUCCESS)
+        goto fail;
+
+    if (clBuildProgram (sh->program, 1, &sh->device, NULL, NULL, NULL) != CL_SUCCESS)
+        goto fail;
+
+    return sh;
+
+fail:
+    if (sh->program)
+        clReleaseProgram (sh->program);
+    if (sh->context)
+        clReleaseContext (sh->context);
+    g_free (sh);
+    return NULL;
+}
+
+static OpenclShared *
+get_shared (void)
+{
+    if (g_once_init_enter (&shared_initialized))
+    {
+        shared = shared_new ();
+        g_once_init_leave (&shared_initialized, 1);
+    }
+
+    return shared;
+}
+
+ChafaOpenclPicker *
+chafa_opencl_picker_new (const ChafaSymbolMap *symbol_map)
+{
+    OpenclShared *sh = get_shared ();
+    ChafaOpenclPicker *picker;
+    cl_ulong *bitmaps;
+    cl_int err;
+    gint i;
+
+    if (!sh || symbol_map->n_symbols < 1)
+        return NULL;
+
+    picker = g_new0 (ChafaOpenclPicker, 1);
+    picker->n_symbols = symbol_map->n_symbols;
+
+    picker->queue = clCreateCommandQueue (sh->context, sh->device, 0, &err);
+    if (err != CL_SUCCESS)
+        goto fail;
+
+    picker->kernel = clCreateKernel (sh->program, "pick_symbols", &err);
+    if (err != CL_SUCCESS)
+        goto fail;
+
+    bitmaps = g_new (cl_ulong, picker->n_symbols);
+    for (i = 0; i < picker->n_symbols; i++)
+        bitmaps [i] = symbol_map->symbols [i].bitmap;
+
+    picker->bitmaps = clCreateBuffer (sh->context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                                      picker->n_symbols * sizeof (cl_ulong), bitmaps, &err);
+    g_free (bitmaps);
+    if (err != CL_SUCCESS)
+        goto fail;
+
+    return picker;
+
+fail:
+    chafa_opencl_picker_destroy (picker);
+    return NULL;
+}
+
+void
+chafa_opencl_picker_destroy (ChafaOpenclPicker *picker)
+{
+    if (!picker)
+        return;
+
+    if (picker->bitmaps)
+        clReleaseMemObject (picker->bitmaps);
+    if (picker->kernel)
+        clReleaseKernel (picker->kernel);
+    if (picker->queue)
+        clReleaseCommandQueue (picker->queue);
+    g_free (picker);
+}
+
+gboolean
+chafa_opencl_picker_pick (ChafaOpenclPicker *picker,
+                          const ChafaPixel *pixels, gint width_pixels,
+                          gint x, gint y, gint width, gint height,
+                          ChafaOpenclPick *picks_out)
+{
+    OpenclShared *sh = get_shared ();
+    gint n_cells = width * height;
+    cl_mem pixels_mem = NULL, results_mem = NULL, colors_mem = NULL;
+    cl_int rowstride = width_pixels, x0 = x, n_symbols = picker->n_symbols;
+    cl_int *results = NULL;
+    ChafaColorPair *colors = NULL;
+    size_t global_size [2];
+    gboolean success = FALSE;
+    cl_int err;
+    gint i;
+
+    /* Only the band of pixel rows covering the rect goes to the device */
+    pixels_mem = clCreateBuffer (sh->context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                                 (gsize) height * CHAFA_SYMBOL_HEIGHT_PIXELS * width_pixels
+                                 * sizeof (ChafaPixel),
+                                 (gpointer) (pixels + (gsize) y * CHAFA_SYMBOL_HEIGHT_PIXELS * width_pixels),
+                                 &err);
+    if (err != CL_SUCCESS)
+        goto out;
+
+    results_mem = clCreateBuffer (sh->context, CL_MEM_WRITE_ONLY,
+                                  n_cells * 2 * sizeof (cl_int), NULL, &err);
+    if (err != CL_SUCCESS)
+        goto out;
+
+    colors_mem = clCreateBuffer (sh->context, CL_MEM_WRITE_ONLY,
+                                 n_cells * sizeof (ChafaColorPair), NULL, &err);
+    if (err != CL_SUCCESS)
+        goto out;
+
+    if (clSetKernelArg (picker->kernel, 0, sizeof (cl_mem), &pixels_mem) != CL_SUCCESS
+        || clSetKernelArg (picker->kernel, 1, sizeof (cl_int), &rowstride) != CL_SUCCESS
+        || clSetKernelArg (picker->kernel, 2, sizeof (cl_int), &x0) != CL_SUCCESS
+        || clSetKernelArg (picker->kernel, 3, sizeof (cl_mem), &picker->bitmaps) != CL_SUCCESS
+        || clSetKernelArg (picker->kernel, 4, sizeof (cl_int), &n_symbols) != CL_SUCCESS
+        || clSetKernelArg (picker->kernel, 5, sizeof (cl_mem), &results_mem) != CL_SUCCESS
+        || clSetKernelArg (picker->kernel, 6, sizeof (cl_mem), &colors_mem) != CL_SUCCESS)
+        goto out;
+
+    global_size [0] = width;
+    global_size [1] = height;
+
+    if (clEnqueueNDRangeKernel (picker->queue, picker->kernel, 2, NULL, global_size, NULL,
+                                0, NULL, NULL) != CL_SUCCESS)
+        goto out;
+
+    results = g_new (cl_int, n_cells * 2);
+    colors = g_new (ChafaColorPair, n_cells);
+
+    if (clEnqueueReadBuffer (picker->queue, results_mem, CL_TRUE, 0,
+                             n_cells * 2 * sizeof (cl_int), results, 0, NULL, NULL) != CL_SUCCESS
+        || clEnqueueReadBuffer (picker->queue, colors_mem, CL_TRUE, 0,
+                                n_cells * sizeof (ChafaColorPair), colors, 0, NULL, NULL) != CL_SUCCESS)
+        goto out;
+
+    for (i = 0; i < n_cells; i++)
+    {
+        picks_out [i].symbol_index = results [i * 2];
+        picks_out [i].error = results [i * 2 + 1];
+        picks_out [i].colors = colors [i];
+    }
+
+    success = TRUE;
+
+out:
+    g_free (results);
+    g_free (colors);
+    if (colors_mem)
+        clReleaseMemObject (colors_mem);
+    if (results_mem)
+        clReleaseMemObject (results_mem);
+    if (pixels_mem)
+        clReleaseMemObject (pixels_mem);
+    return success;
+}
+
+#endif
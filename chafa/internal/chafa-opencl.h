@@ -0,0 +1,64 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+
+#ifndef __CHAFA_OPENCL_H__
+#define __CHAFA_OPENCL_H__
+
+#include <glib.h>
+#include "chafa.h"
+#include "internal/chafa-private.h"
+
+G_BEGIN_DECLS
+
+#ifdef HAVE_OPENCL
+
+/* Picks narrow symbols for a rectangle of cells on an OpenCL device. The
+ * search is the exhaustive one, with mean colors and unquantized error,
+ * and its results match the CPU's.
+ *
+ * The device, context and program are set up once per process. If that
+ * fails, or there's no GPU, chafa_opencl_picker_new () returns NULL and
+ * the caller should stick to the CPU. */
+
+typedef struct ChafaOpenclPick
+{
+    gint symbol_index;
+    gint error;
+    ChafaColorPair colors;
+}
+ChafaOpenclPick;
+
+typedef struct ChafaOpenclPicker ChafaOpenclPicker;
+
+ChafaOpenclPicker *chafa_opencl_picker_new (const ChafaSymbolMap *symbol_map);
+void chafa_opencl_picker_destroy (ChafaOpenclPicker *picker);
+
+/* Fills in width * height picks in row order. Returns FALSE if the device
+ * failed us, in which case picks_out is undefined. */
+gboolean chafa_opencl_picker_pick (ChafaOpenclPicker *picker,
+                                   const ChafaPixel *pixels, gint width_pixels,
+                                   gint x, gint y, gint width, gint height,
+                                   ChafaOpenclPick *picks_out);
+
+#endif
+
+G_END_DECLS
+
+#endif /* __CHAFA_OPENCL_H__ */
@@ -23,6 +23,7 @@
 #include <string.h>  /* memcpy, memset */
 #include <math.h>  /* pow, cbrt, log, sqrt, atan2, cos, sin */
 #include "chafa.h"
+#include "internal/chafa-batch.h"
 #include "internal/chafa-private.h"
 
 #define DEBUG(x)
@@ -243,17 +244,166 @@ pick_color_fixed_24_grays (const ChafaColor *color, ChafaColorSpace color_space,
     while (i >= 232 && i <= 255);
 }
 
+/* ------------------ *
+ * Palette index grid *
+ * ------------------ */
+
+/* Exhaustive searches over a range of the fixed palette are sped up with a
+ * grid that divides the color space into GRID_SIDE^3 boxes. Each box lists
+ * the palette indexes that can be the best or second best match for some
+ * color inside it, in palette order. Searching only those yields the same
+ * candidates, including tie breaks, as searching the whole range.
+ *
+ * Grids are built on first use, since the larger ones take a while. */
+
+#define GRID_SHIFT 3
+#define GRID_SIDE (256 >> GRID_SHIFT)
+#define GRID_N_BOXES (GRID_SIDE * GRID_SIDE * GRID_SIDE)
+
+typedef enum
+{
+    GRID_RANGE_16,
+    GRID_RANGE_240,
+    GRID_RANGE_256,
+
+    GRID_RANGE_MAX
+}
+GridRange;
+
+typedef struct
+{
+    /* Indexes for box i are indexes [offsets [i]] .. indexes [offsets [i + 1] - 1] */
+    guint32 *offsets;
+    guint8 *indexes;
+}
+PaletteGrid;
+
+static const struct
+{
+    gint first, n;
+}
+grid_ranges [GRID_RANGE_MAX] =
+{
+    { 0, 16 },
+    { 16, 240 },
+    { 0, 256 }
+};
+
+static PaletteGrid palette_grids [GRID_RANGE_MAX] [CHAFA_COLOR_SPACE_MAX];
+static gsize palette_grid_built [GRID_RANGE_MAX] [CHAFA_COLOR_SPACE_MAX];
+
+/* Smallest and largest squared distance from a point to a box */
 static void
-pick_color_fixed_16 (const ChafaColor *color, ChafaColorSpace color_space, ChafaColorCandidates *candidates)
+box_distance_bounds (const ChafaColor *col, const gint *box_min, gint *dmin_out, gint *dmax_out)
 {
+    gint dmin = 0, dmax = 0;
     gint i;
 
-    for (i = 0; i < 16; i++)
+    for (i = 0; i < 3; i++)
     {
-        update_candidates_with_color_index_diff (candidates, color_space, color, i);
+        gint lo = box_min [i] - col->ch [i];
+        gint hi = box_min [i] + (1 << GRID_SHIFT) - 1 - col->ch [i];
+
+        if (lo > 0)
+            dmin += lo * lo;
+        else if (hi < 0)
+            dmin += hi * hi;
+
+        dmax += MAX (lo * lo, hi * hi);
+    }
+
+    *dmin_out = dmin;
+    *dmax_out = dmax;
+}
+
+static void
+build_palette_grid (PaletteGrid *grid, GridRange range, ChafaColorSpace color_space)
+{
+    gint dmin [256], dmax [256];
+    GArray *indexes;
+    gint box_min [3];
+    gint box = 0;
+    gint i;
+
+    indexes = g_array_new (FALSE, FALSE, sizeof (guint8));
+    grid->offsets = g_new (guint32, GRID_N_BOXES + 1);
+
+    for (box_min [0] = 0; box_min [0] < 256; box_min [0] += 1 << GRID_SHIFT)
+    for (box_min [1] = 0; box_min [1] < 256; box_min [1] += 1 << GRID_SHIFT)
+    for (box_min [2] = 0; box_min [2] < 256; box_min [2] += 1 << GRID_SHIFT)
+    {
+        gint best [2] = { G_MAXINT, G_MAXINT };
+
+        grid->offsets [box++] = indexes->len;
+
+        /* The second smallest max distance bounds the second best match
+         * for any color in the box */
+        for (i = 0; i < grid_ranges [range].n; i++)
+        {
+            box_distance_bounds (get_fixed_palette_color (grid_ranges [range].first + i, color_space),
+                                 box_min, &dmin [i], &dmax [i]);
+
+            if (dmax [i] < best [0])
+            {
+                best [1] = best [0];
+                best [0] = dmax [i];
+            }
+            else if (dmax [i] < best [1])
+            {
+                best [1] = dmax [i];
+            }
+        }
+
+        for (i = 0; i < grid_ranges [range].n; i++)
+        {
+            if (dmin [i] <= best [1])
+            {
+                guint8 index = grid_ranges [range].first + i;
+                g_array_append_val (indexes, index);
+            }
+        }
+    }
+
+    grid->offsets [box] = indexes->len;
+    grid->indexes = (guint8 *) g_array_free (indexes, FALSE);
+}
+
+static const PaletteGrid *
+get_palette_grid (GridRange range, ChafaColorSpace color_space)
+{
+    if (g_once_init_enter (&palette_grid_built [range] [color_space]))
+    {
+        build_palette_grid (&palette_grids [range] [color_space], range, color_space);
+        g_once_init_leave (&palette_grid_built [range] [color_space], 1);
     }
+
+    return &palette_grids [range] [color_space];
 }
 
+static void
+pick_color_from_grid (const ChafaColor *color, ChafaColorSpace color_space, GridRange range,
+                      ChafaColorCandidates *candidates)
+{
+    const PaletteGrid *grid = get_palette_grid (range, color_space);
+    guint32 box, i;
+
+    box = (((color->ch [0] >> GRID_SHIFT) * GRID_SIDE
+            + (color->ch [1] >> GRID_SHIFT)) * GRID_SIDE
+           + (color->ch [2] >> GRID_SHIFT));
+
+    for (i = grid->offsets [box]; i < grid->offsets [box + 1]; i++)
+    {
+        update_candidates_with_color_index_diff (candidates, color_space, color, grid->indexes [i]);
+    }
+}
+
+static void
+pick_color_fixed_16 (const ChafaColor *color, ChafaColorSpace color_space, ChafaColorCandidates *candidates)
+{
+    pick_color_from_grid (color, color_space, GRID_RANGE_16, candidates);
+}
+
+/* Eight colors are too few for the grid to pay off */
 static void
 pick_color_fixed_8 (const ChafaColor *color, ChafaColorSpace color_space, ChafaColorCandidates *candidates)
 {
@@ -268,8 +418,6 @@ pick_color_fixed_8 (const ChafaColor *color, ChafaColorSpace color_space, ChafaC
 static void
 pick_color_fixed_256 (const ChafaColor *color, ChafaColorSpace color_space, ChafaColorCandidates *candidates)
 {
-    gint i;
-
     if (color_space == CHAFA_COLOR_SPACE_RGB)
     {
         pick_color_fixed_216_cube (color, color_space, candidates);
@@ -280,18 +428,13 @@ pick_color_fixed_256 (const ChafaColor *color, ChafaColorSpace color_space, Chaf
     }
     else
     {
-        for (i = 0; i < 256; i++)
-        {
-            update_candidates_with_color_index_diff (candidates, color_space, color, i);
-        }
+        pick_color_from_grid (color, color_space, GRID_RANGE_256, candidates);
     }
 }
 
 static void
 pick_color_fixed_240 (const ChafaColor *color, ChafaColorSpace color_space, ChafaColorCandidates *candidates)
 {
-    gint i;
-
     if (color_space == CHAFA_COLOR_SPACE_RGB)
     {
         pick_color_fixed_216_cube (color, color_space, candidates);
@@ -299,11 +442,8 @@ pick_color_fixed_240 (const ChafaColor *color, ChafaColorSpace color_space, Chaf
     }
     else
     {
-        /* Check color cube, but not lower 16, bg or fg. Slow! */
-        for (i = 16; i < 256; i++)
-        {
-            update_candidates_with_color_index_diff (candidates, color_space, color, i);
-        }
+        /* Check color cube, but not lower 16, bg or fg */
+        pick_color_from_grid (color, color_space, GRID_RANGE_240, candidates);
     }
 }
 
@@ -375,70 +515,33 @@ find_dominant_channel (gconstpointer pixels, gint n_pixels)
     return best;
 }
 
-static int
-compare_rgba_0 (gconstpointer a, gconstpointer b)
-{
-    const guint8 *ab = a;
-    const guint8 *bb = b;
-    gint ai = ab [0];
-    gint bi = bb [0];
-
-    return ai - bi;
-}
-
-static int
-compare_rgba_1 (gconstpointer a, gconstpointer b)
+/* Stable counting sort on one channel. The median cut sorts every box at
+ * every level, so keeping this linear in the number of samples makes a big
+ * difference. scratch must have room for n_pixels samples. */
+static void
+sort_by_channel (gpointer pixels, gint n_pixels, gint ch, guint32 *scratch)
 {
-    const guint8 *ab = a;
-    const guint8 *bb = b;
-    gint ai = ab [1];
-    gint bi = bb [1];
+    guint32 *p = pixels;
+    const guint8 *key = (const guint8 *) pixels + ch;
+    gint pos [256] = { 0 };
+    gint i, sum;
 
-    return ai - bi;
-}
+    g_assert (ch >= 0 && ch < 4);
 
-static int
-compare_rgba_2 (gconstpointer a, gconstpointer b)
-{
-    const guint8 *ab = a;
-    const guint8 *bb = b;
-    gint ai = ab [2];
-    gint bi = bb [2];
-
-    return ai - bi;
-}
-
-static int
-compare_rgba_3 (gconstpointer a, gconstpointer b)
-{
-    const guint8 *ab = a;
-    const guint8 *bb = b;
-    gint ai = ab [3];
-    gint bi = bb [3];
-
-    return ai - bi;
-}
+    for (i = 0; i < n_pixels; i++)
+        pos [key [i * 4]]++;
 
-static void
-sort_by_channel (gpointer pixels, gint n_pixels, gint ch)
-{
-    switch (ch)
+    for (i = 0, sum = 0; i < 256; i++)
     {
-        case 0:
-            qsort (pixels, n_pixels, sizeof (guint32), compare_rgba_0);
-            break;
-        case 1:
-            qsort (pixels, n_pixels, sizeof (guint32), compare_rgba_1);
-            break;
-        case 2:
-            qsort (pixels, n_pixels, sizeof (guint32), compare_rgba_2);
-            break;
-        case 3:
-            qsort (pixels, n_pixels, sizeof (guint32), compare_rgba_3);
-            break;
-        default:
-            g_assert_not_reached ();
+        gint n = pos [i];
+        pos [i] = sum;
+        sum += n;
     }
+
+    for (i = 0; i < n_pixels; i++)
+        scratch [pos [key [i * 4]]++] = p [i];
+
+    memcpy (p, scratch, n_pixels * sizeof (guint32));
 }
 
 #if 0
@@ -521,7 +624,7 @@ pick_box_color (gpointer pixels, gint first_ofs, gint n_pixels, ChafaColor *colo
 }
 
 static void
-median_cut_once (gpointer pixels,
+median_cut_once (gpointer pixels, guint32 *scratch,
                  gint first_ofs, gint n_pixels,
                  ChafaColor *color_out)
 {
@@ -531,13 +634,13 @@ median_cut_once (gpointer pixels,
     g_assert (n_pixels > 0);
 
     dominant_ch = find_dominant_channel (p + first_ofs * sizeof (guint32), n_pixels);
-    sort_by_channel (p + first_ofs * sizeof (guint32), n_pixels, dominant_ch);
+    sort_by_channel (p + first_ofs * sizeof (guint32), n_pixels, dominant_ch, scratch);
 
     pick_box_color (pixels, first_ofs, n_pixels, color_out);
 }
 
 static void
-median_cut (ChafaPalette *pal, gpointer pixels,
+median_cut (ChafaPalette *pal, gpointer pixels, guint32 *scratch,
             gint first_ofs, gint n_pixels,
             gint first_col, gint n_cols)
 {
@@ -548,7 +651,7 @@ median_cut (ChafaPalette *pal, gpointer pixels,
     g_assert (n_cols > 0);
 
     dominant_ch = find_dominant_channel (p + first_ofs * sizeof (guint32), n_pixels);
-    sort_by_channel (p + first_ofs * sizeof (guint32), n_pixels, dominant_ch);
+    sort_by_channel (p + first_ofs * sizeof (guint32), n_pixels, dominant_ch, scratch);
 
     if (n_cols == 1 || n_pixels < 2)
     {
@@ -556,13 +659,13 @@ median_cut (ChafaPalette *pal, gpointer pixels,
         return;
     }
 
-    median_cut (pal, pixels,
+    median_cut (pal, pixels, scratch,
                 first_ofs,
                 n_pixels / 2,
                 first_col,
                 n_cols / 2);
 
-    median_cut (pal, pixels,
+    median_cut (pal, pixels, scratch,
                 first_ofs + (n_pixels / 2),
                 n_pixels - (n_pixels / 2),
                 first_col + (n_cols / 2),
@@ -582,7 +685,7 @@ dominant_diff (guint8 *p1, guint8 *p2)
 }
 
 static void
-diversity_pass (ChafaPalette *pal, gpointer pixels,
+diversity_pass (ChafaPalette *pal, gpointer pixels, guint32 *scratch,
                 gint n_pixels,
                 gint first_col, gint n_cols)
 {
@@ -611,13 +714,13 @@ diversity_pass (ChafaPalette *pal, gpointer pixels,
             n += step;
         }
 
-        median_cut_once (pixels, best_box * step, MAX (step / 2, 1),
+        median_cut_once (pixels, scratch, best_box * step, MAX (step / 2, 1),
                          &pal->colors [first_col + c].col [CHAFA_COLOR_SPACE_RGB]);
         c++;
         if (c >= n_cols)
             break;
 
-        median_cut_once (pixels, best_box * step + step / 2, MAX (step / 2, 1),
+        median_cut_once (pixels, scratch, best_box * step + step / 2, MAX (step / 2, 1),
                          &pal->colors [first_col + c].col [CHAFA_COLOR_SPACE_RGB]);
 
         done [best_box] = 1;
@@ -657,6 +760,137 @@ gen_table (ChafaPalette *palette, ChafaColorSpace color_space)
     chafa_color_table_sort (&palette->table [color_space]);
 }
 
+/* --- K-means refinement --- */
+
+/* Lookups are done in runs of this many samples */
+#define REFINE_RUN_LEN 256
+
+typedef struct
+{
+    guint64 sum [CHAFA_COLOR_TABLE_MAX_ENTRIES] [3];
+    guint32 count [CHAFA_COLOR_TABLE_MAX_ENTRIES];
+}
+RefineAccum;
+
+typedef struct
+{
+    const ChafaColorTable *table;
+    const guint32 *samples;
+    RefineAccum *total;
+}
+RefineCtx;
+
+static void
+refine_worker (ChafaBatchInfo *batch, const RefineCtx *ctx)
+{
+    RefineAccum *accum = g_new0 (RefineAccum, 1);
+    guint32 colors [REFINE_RUN_LEN];
+    gint pens [REFINE_RUN_LEN];
+    gint i, i_max, j, n;
+
+    i_max = batch->first_row + batch->n_rows;
+
+    for (i = batch->first_row; i < i_max; i += n)
+    {
+        const guint8 *p = (const guint8 *) (ctx->samples + i);
+
+        n = MIN (REFINE_RUN_LEN, i_max - i);
+
+        for (j = 0; j < n; j++)
+            colors [j] = p [j * 4] | (p [j * 4 + 1] << 8) | (p [j * 4 + 2] << 16);
+
+        chafa_color_table_find_nearest_pens (ctx->table, colors, pens, n);
+
+        for (j = 0; j < n; j++)
+        {
+            accum->sum [pens [j]] [0] += p [j * 4];
+            accum->sum [pens [j]] [1] += p [j * 4 + 1];
+            accum->sum [pens [j]] [2] += p [j * 4 + 2];
+            accum->count [pens [j]]++;
+        }
+    }
+
+    batch->ret_p = accum;
+}
+
+static void
+refine_post (ChafaBatchInfo *batch, const RefineCtx *ctx)
+{
+    RefineAccum *accum = batch->ret_p;
+    gint i;
+
+    for (i = 0; i < CHAFA_COLOR_TABLE_MAX_ENTRIES; i++)
+    {
+        ctx->total->sum [i] [0] += accum->sum [i] [0];
+        ctx->total->sum [i] [1] += accum->sum [i] [1];
+        ctx->total->sum [i] [2] += accum->sum [i] [2];
+        ctx->total->count [i] += accum->count [i];
+    }
+
+    g_free (accum);
+}
+
+/* Lloyd iterations: Moves each color to the mean of the samples nearest to
+ * it, which the median cut only approximates. Stops early if nothing moves.
+ * Expects the RGB table to be up to date, and leaves it that way. */
+static void
+refine_palette (ChafaPalette *palette, const guint32 *samples, gint n_samples)
+{
+    RefineAccum *total;
+    RefineCtx ctx;
+    gint pass, i;
+
+    total = g_new (RefineAccum, 1);
+
+    ctx.table = &palette->table [CHAFA_COLOR_SPACE_RGB];
+    ctx.samples = samples;
+    ctx.total = total;
+
+    for (pass = 0; pass < palette->n_refine_passes; pass++)
+    {
+        gboolean moved = FALSE;
+
+        memset (total, 0, sizeof (*total));
+
+        chafa_process_batches (&ctx,
+                               "palette-refine",
+                               (GFunc) refine_worker,
+                               (GFunc) refine_post,
+                               n_samples,
+                               chafa_get_n_actual_threads (),
+                               REFINE_RUN_LEN);
+
+        for (i = 0; i < palette->n_colors; i++)
+        {
+            ChafaColor *col = &palette->colors [i].col [CHAFA_COLOR_SPACE_RGB];
+            guint32 n = total->count [i];
+            ChafaColor mean;
+
+            if (i == palette->transparent_index || n == 0)
+                continue;
+
+            mean.ch [0] = (total->sum [i] [0] + n / 2) / n;
+            mean.ch [1] = (total->sum [i] [1] + n / 2) / n;
+            mean.ch [2] = (total->sum [i] [2] + n / 2) / n;
+
+            if (mean.ch [0] != col->ch [0] || mean.ch [1] != col->ch [1] || mean.ch [2] != col->ch [2])
+            {
+                col->ch [0] = mean.ch [0];
+                col->ch [1] = mean.ch [1];
+                col->ch [2] = mean.ch [2];
+                moved = TRUE;
+            }
+        }
+
+        if (!moved)
+            break;
+
+        gen_table (palette, CHAFA_COLOR_SPACE_RGB);
+    }
+
+    g_free (total);
+}
+
 #define N_SAMPLES 32768
 
 static gint
@@ -786,6 +1020,7 @@ chafa_palette_init (ChafaPalette *palette_out, ChafaPaletteType type)
     chafa_init_palette ();
     palette_out->type = type;
     palette_out->transparent_index = CHAFA_PALETTE_INDEX_TRANSPARENT;
+    palette_out->n_refine_passes = 0;
 
     for (i = 0; i < CHAFA_PALETTE_INDEX_MAX; i++)
     {
@@ -862,13 +1097,16 @@ chafa_palette_generate (ChafaPalette *palette_out, gconstpointer pixels, gint n_
                         ChafaColorSpace color_space)
 {
     guint32 *pixels_copy;
+    guint32 *scratch;
     gint step;
     gint copy_n_pixels;
 
     if (palette_out->type != CHAFA_PALETTE_TYPE_DYNAMIC_256)
         return;
 
-    pixels_copy = g_malloc (N_SAMPLES * sizeof (guint32));
+    /* Second half is scratch space for sorting */
+    pixels_copy = g_malloc (N_SAMPLES * 2 * sizeof (guint32));
+    scratch = pixels_copy + N_SAMPLES;
 
     step = (n_pixels / N_SAMPLES) + 1;
     copy_n_pixels = extract_samples (pixels, pixels_copy, n_pixels, step,
@@ -888,16 +1126,19 @@ chafa_palette_generate (ChafaPalette *palette_out, gconstpointer pixels, gint n_
         goto out;
     }
 
-    median_cut (palette_out, pixels_copy, 0, copy_n_pixels, 0, 128);
+    median_cut (palette_out, pixels_copy, scratch, 0, copy_n_pixels, 0, 128);
     palette_out->n_colors = 128;
     clean_up (palette_out);
 
-    diversity_pass (palette_out, pixels_copy, copy_n_pixels, palette_out->n_colors, 256 - palette_out->n_colors);
+    diversity_pass (palette_out, pixels_copy, scratch, copy_n_pixels, palette_out->n_colors, 256 - palette_out->n_colors);
     palette_out->n_colors = 256;
     clean_up (palette_out);
 
     gen_table (palette_out, CHAFA_COLOR_SPACE_RGB);
 
+    if (palette_out->n_refine_passes > 0)
+        refine_palette (palette_out, pixels_copy, copy_n_pixels);
+
     if (color_space == CHAFA_COLOR_SPACE_DIN99D)
     {
         gen_din99d_color_space (palette_out);
@@ -908,6 +1149,35 @@ out:
     g_free (pixels_copy);
 }
 
+/* Replaces a dynamic palette's colors with caller-supplied ones, packed
+ * as 0xRRGGBB, and builds the lookup tables for every color space */
+void
+chafa_palette_load_colors (ChafaPalette *palette, const guint32 *colors, gint n_colors)
+{
+    gint i;
+
+    g_assert (palette->type == CHAFA_PALETTE_TYPE_DYNAMIC_256);
+    g_assert (n_colors >= 0 && n_colors <= 256);
+
+    for (i = 0; i < n_colors; i++)
+    {
+        ChafaColor col;
+
+        chafa_unpack_color (colors [i], &col);
+        col.ch [3] = 0xff;
+        palette->colors [i].col [CHAFA_COLOR_SPACE_RGB] = col;
+    }
+
+    palette->n_colors = n_colors;
+    gen_din99d_color_space (palette);
+
+    for (i = 0; i < CHAFA_COLOR_SPACE_MAX; i++)
+    {
+        chafa_color_table_init (&palette->table [i]);
+        gen_table (palette, i);
+    }
+}
+
 gint
 chafa_palette_lookup_nearest (const ChafaPalette *palette, ChafaColorSpace color_space,
                               const ChafaColor *color, ChafaColorCandidates *candidates)
@@ -992,6 +1262,45 @@ chafa_palette_lookup_nearest (const ChafaPalette *palette, ChafaColorSpace color
     g_assert_not_reached ();
 }
 
+/* Applies a fraction of the accumulated error to color, clamping the result.
+ * The unclamped color is stored in compensated_out for use with
+ * chafa_palette_get_error (). */
+ChafaColor
+chafa_palette_compensate_color (ChafaColor color, const ChafaColorAccum *error,
+                                ChafaColorAccum *compensated_out)
+{
+    compensated_out->ch [0] = ((gint16) color.ch [0]) + ((error->ch [0] * 0.9f) / 16);
+    compensated_out->ch [1] = ((gint16) color.ch [1]) + ((error->ch [1] * 0.9f) / 16);
+    compensated_out->ch [2] = ((gint16) color.ch [2]) + ((error->ch [2] * 0.9f) / 16);
+
+    color.ch [0] = CLAMP (compensated_out->ch [0], 0, 255);
+    color.ch [1] = CLAMP (compensated_out->ch [1], 0, 255);
+    color.ch [2] = CLAMP (compensated_out->ch [2], 0, 255);
+
+    return color;
+}
+
+/* Stores the difference between a compensated color and the palette color
+ * it was mapped to in error_out */
+void
+chafa_palette_get_error (const ChafaPalette *palette, ChafaColorSpace color_space,
+                         gint index, const ChafaColorAccum *compensated,
+                         ChafaColorAccum *error_out)
+{
+    if (index == palette->transparent_index)
+    {
+        memset (error_out, 0, sizeof (*error_out));
+    }
+    else
+    {
+        ChafaColor found_color = palette->colors [index].col [color_space];
+
+        error_out->ch [0] = ((gint16) compensated->ch [0]) - ((gint16) found_color.ch [0]);
+        error_out->ch [1] = ((gint16) compensated->ch [1]) - ((gint16) found_color.ch [1]);
+        error_out->ch [2] = ((gint16) compensated->ch [2]) - ((gint16) found_color.ch [2]);
+    }
+}
+
 gint
 chafa_palette_lookup_with_error (const ChafaPalette *palette, ChafaColorSpace color_space,
                                  ChafaColor color, ChafaColorAccum *error_inout)
@@ -1000,33 +1309,12 @@ chafa_palette_lookup_with_error (const ChafaPalette *palette, ChafaColorSpace co
     gint index;
 
     if (error_inout)
-    {
-        compensated_color.ch [0] = ((gint16) color.ch [0]) + ((error_inout->ch [0] * 0.9f) / 16);
-        compensated_color.ch [1] = ((gint16) color.ch [1]) + ((error_inout->ch [1] * 0.9f) / 16);
-        compensated_color.ch [2] = ((gint16) color.ch [2]) + ((error_inout->ch [2] * 0.9f) / 16);
-
-        color.ch [0] = CLAMP (compensated_color.ch [0], 0, 255);
-        color.ch [1] = CLAMP (compensated_color.ch [1], 0, 255);
-        color.ch [2] = CLAMP (compensated_color.ch [2], 0, 255);
-    }
+        color = chafa_palette_compensate_color (color, error_inout, &compensated_color);
 
     index = chafa_palette_lookup_nearest (palette, color_space, &color, NULL);
 
     if (error_inout)
-    {
-        if (index == palette->transparent_index)
-        {
-            memset (error_inout, 0, sizeof (*error_inout));
-        }
-        else
-        {
-            ChafaColor found_color = palette->colors [index].col [color_space];
-
-            error_inout->ch [0] = ((gint16) compensated_color.ch [0]) - ((gint16) found_color.ch [0]);
-            error_inout->ch [1] = ((gint16) compensated_color.ch [1]) - ((gint16) found_color.ch [1]);
-            error_inout->ch [2] = ((gint16) compensated_color.ch [2]) - ((gint16) found_color.ch [2]);
-        }
-    }
+        chafa_palette_get_error (palette, color_space, index, &compensated_color, error_inout);
 
     return index;
 }
@@ -1064,6 +1352,19 @@ chafa_palette_set_alpha_threshold (ChafaPalette *palette, gint alpha_threshold)
     palette->alpha_threshold = alpha_threshold;
 }
 
+gint
+chafa_palette_get_refine_passes (const ChafaPalette *palette)
+{
+    return palette->n_refine_passes;
+}
+
+/* Number of k-means passes to run on generated palettes. 0 disables. */
+void
+chafa_palette_set_refine_passes (ChafaPalette *palette, gint n_passes)
+{
+    palette->n_refine_passes = n_passes;
+}
+
 gint
 chafa_palette_get_transparent_index (const ChafaPalette *palette)
 {
@@ -46,6 +46,7 @@ typedef struct
     gint n_colors;
     gint alpha_threshold;
     gint transparent_index;
+    gint n_refine_passes;
 }
 ChafaPalette;
 
@@ -58,6 +59,7 @@ void chafa_palette_deinit (ChafaPalette *palette);
 void chafa_palette_copy (const ChafaPalette *src, ChafaPalette *dest);
 void chafa_palette_generate (ChafaPalette *palette_out, gconstpointer pixels, gint n_pixels,
                              ChafaColorSpace color_space);
+void chafa_palette_load_colors (ChafaPalette *palette, const guint32 *colors, gint n_colors);
 
 ChafaPaletteType chafa_palette_get_type (const ChafaPalette *palette);
 
@@ -69,6 +71,11 @@ gint chafa_palette_lookup_nearest (const ChafaPalette *palette, ChafaColorSpace
 
 gint chafa_palette_lookup_with_error (const ChafaPalette *palette, ChafaColorSpace color_space,
                                       ChafaColor color, ChafaColorAccum *error_inout);
+ChafaColor chafa_palette_compensate_color (ChafaColor color, const ChafaColorAccum *error,
+                                          ChafaColorAccum *compensated_out);
+void chafa_palette_get_error (const ChafaPalette *palette, ChafaColorSpace color_space,
+                              gint index, const ChafaColorAccum *compensated,
+                              ChafaColorAccum *error_out);
 
 const ChafaColor *chafa_palette_get_color (const ChafaPalette *palette, ChafaColorSpace color_space,
                                            gint index);
@@ -77,6 +84,9 @@ void chafa_palette_set_color (ChafaPalette *palette, gint index, const ChafaColo
 gint chafa_palette_get_alpha_threshold (const ChafaPalette *palette);
 void chafa_palette_set_alpha_threshold (ChafaPalette *palette, gint alpha_threshold);
 
+gint chafa_palette_get_refine_passes (const ChafaPalette *palette);
+void chafa_palette_set_refine_passes (ChafaPalette *palette, gint n_passes);
+
 gint chafa_palette_get_transparent_index (const ChafaPalette *palette);
 void chafa_palette_set_transparent_index (ChafaPalette *palette, gint index);
 
@@ -19,6 +19,8 @@
 
 #include "config.h"
 
+#include <math.h>
+
 #include "internal/chafa-batch.h"
 #include "internal/chafa-pixops.h"
 #include "internal/smolscale/smolscale.h"
@@ -29,6 +31,23 @@
 /* See rgb_to_intensity_fast () */
 #define INTENSITY_MAX (256 * 8)
 
+/* When passes are fused, pixels are scaled and prepared this many rows at a
+ * time, so each chunk is still in cache when the second pass gets to it */
+#define FUSED_CHUNK_ROWS 8
+
+/* Scale in linear light at this work factor and above. It roughly doubles
+ * the cost of scaling, but keeps thin bright details from being averaged
+ * into the background. */
+#define LINEAR_SCALING_WORK_FACTOR_MIN 5
+
+/* Histograms are built in this many lanes, with consecutive pixels going to
+ * different lanes. Runs of similar pixels would otherwise serialize on
+ * increments to the same bin. Must be a power of two. */
+#define HISTOGRAM_LANES 4
+
+/* Pixels whose intensities are computed in one go before binning */
+#define HISTOGRAM_CHUNK_PIXELS 256
+
 /* Normalization: Percentage of pixels to discard at extremes of histogram */
 #define INDEXED_16_CROP_PCT 5
 #define INDEXED_8_CROP_PCT  10
@@ -38,6 +57,9 @@
 G_STATIC_ASSERT (FIXED_MULT * INTENSITY_MAX * (gint64) 255 <= G_MAXINT);
 G_STATIC_ASSERT (FIXED_MULT * INTENSITY_MAX * (gint64) -255 >= G_MININT);
 
+/* The scaler writes premultiplied RGBA8 straight into the pixel buffer */
+G_STATIC_ASSERT (sizeof (ChafaPixel) == sizeof (guint32));
+
 typedef struct
 {
     gint32 c [INTENSITY_MAX];
@@ -73,14 +95,30 @@ typedef struct
     /* Result of alpha detection is stored here */
     gint have_alpha_int;
 
+    /* Post-processing for freshly scaled pixels. Returns nonzero if any
+     * of them have alpha. NULL if there's nothing to do. */
+    gint (*post_scale_func) (ChafaPixel *pixels, ChafaPixel *pixels_max);
+
+    /* Whether the second pass runs in the first pass' workers */
+    gboolean fuse_passes;
+
     Histogram hist;
     SmolScaleCtx *scale_ctx;
+
+    /* Indexed by ChafaCanvasStage. NULL if not collecting stats. */
+    ChafaStageTime *stage_times;
 }
 PrepareContext;
 
 typedef struct
 {
-    Histogram hist;
+    /* Histogram lanes. The extra bin at the end takes transparent pixels,
+     * which are not sampled. */
+    gint32 hist_lanes [HISTOGRAM_LANES] [INTENSITY_MAX + 1];
+    gint n_pixels;
+
+    /* Time spent scaling this batch, if collecting stats */
+    gint64 scale_time_us;
 }
 PreparePixelsBatch1Ret;
 
@@ -92,15 +130,45 @@ rgb_to_intensity_fast (const ChafaColor *color)
 }
 
 static void
-sum_histograms (const Histogram *hist_in, Histogram *hist_accum)
+sum_histograms (gint32 hist_lanes [HISTOGRAM_LANES] [INTENSITY_MAX + 1], gint n_pixels,
+                Histogram *hist_accum)
 {
-    gint i;
+    gint i, j;
 
-    hist_accum->n_samples += hist_in->n_samples;
+    hist_accum->n_samples += n_pixels;
 
-    for (i = 0; i < INTENSITY_MAX; i++)
+    for (j = 0; j < HISTOGRAM_LANES; j++)
     {
-        hist_accum->c [i] += hist_in->c [i];
+        for (i = 0; i < INTENSITY_MAX; i++)
+            hist_accum->c [i] += hist_lanes [j] [i];
+
+        hist_accum->n_samples -= hist_lanes [j] [INTENSITY_MAX];
+    }
+}
+
+/* Bins the intensities of a run of pixels. Intensities are computed for a
+ * chunk at a time without branching, which the compiler can vectorize. */
+static void
+accumulate_histogram (PreparePixelsBatch1Ret *ret, const ChafaPixel *pixels, gint n_pixels)
+{
+    guint16 v [HISTOGRAM_CHUNK_PIXELS];
+    gint i, j, n;
+
+    ret->n_pixels += n_pixels;
+
+    for (i = 0; i < n_pixels; i += n)
+    {
+        n = MIN (n_pixels - i, HISTOGRAM_CHUNK_PIXELS);
+
+        for (j = 0; j < n; j++)
+        {
+            const ChafaColor *col = &pixels [i + j].col;
+
+            v [j] = col->ch [3] > 127 ? rgb_to_intensity_fast (col) : INTENSITY_MAX;
+        }
+
+        for (j = 0; j < n; j++)
+            ret->hist_lanes [j & (HISTOGRAM_LANES - 1)] [v [j]]++;
     }
 }
 
@@ -283,29 +351,25 @@ convert_rgb_to_din99d (ChafaPixel *pixels, gint width, gint dest_y, gint n_rows)
 {
     ChafaPixel *pixel = pixels + dest_y * width;
     ChafaPixel *pixel_max = pixel + n_rows * width;
+    ChafaColor prev_in = { { 0, 0, 0, 0 } };
+    ChafaColor prev_out = { { 0, 0, 0, 0 } };
+    gboolean have_prev = FALSE;
 
-    /* RGB -> DIN99d */
+    /* RGB -> DIN99d. Runs of identical pixels are common in flat
+     * graphics, so reuse the previous result when we can. */
 
     for ( ; pixel < pixel_max; pixel++)
     {
-        chafa_color_rgb_to_din99d (&pixel->col, &pixel->col);
-    }
-}
-
-static void
-bayer_dither (const ChafaDither *dither, ChafaPixel *pixels, gint width, gint dest_y, gint n_rows)
-{
-    ChafaPixel *pixel = pixels + dest_y * width;
-    ChafaPixel *pixel_max = pixel + n_rows * width;
-    gint x, y;
-
-    for (y = dest_y; pixel < pixel_max; y++)
-    {
-        for (x = 0; x < width; x++)
+        if (have_prev && CHAFA_COLOR8_U32 (pixel->col) == CHAFA_COLOR8_U32 (prev_in))
         {
-            pixel->col = chafa_dither_color_ordered (dither, pixel->col, x, y);
-            pixel++;
+            pixel->col = prev_out;
+            continue;
         }
+
+        prev_in = pixel->col;
+        chafa_color_rgb_to_din99d (&pixel->col, &pixel->col);
+        prev_out = pixel->col;
+        have_prev = TRUE;
     }
 }
 
@@ -413,30 +477,106 @@ fs_dither (const ChafaDither *dither, const ChafaPalette *palette,
 }
 
 static void
-bayer_and_convert_rgb_to_din99d (const ChafaDither *dither,
-                                 ChafaPixel *pixels, gint width, gint dest_y, gint n_rows)
+fs_and_convert_rgb_to_din99d (const ChafaDither *dither, const ChafaPalette *palette,
+                              ChafaPixel *pixels, gint width, gint dest_y, gint n_rows)
 {
-    ChafaPixel *pixel = pixels + dest_y * width;
-    ChafaPixel *pixel_max = pixel + n_rows * width;
-    gint x, y;
+    convert_rgb_to_din99d (pixels, width, dest_y, n_rows);
+    fs_dither (dither, palette, CHAFA_COLOR_SPACE_DIN99D, pixels, width, dest_y, n_rows);
+}
+
+static void
+composite_alpha_on_bg (ChafaColor bg_color,
+                       ChafaPixel *pixels, gint width, gint first_row, gint n_rows)
+{
+    ChafaPixel *p0, *p1;
+
+    p0 = pixels + first_row * width;
+    p1 = p0 + n_rows * width;
 
-    for (y = dest_y; pixel < pixel_max; y++)
+    for ( ; p0 < p1; p0++)
     {
-        for (x = 0; x < width; x++)
-        {
-            pixel->col = chafa_dither_color_ordered (dither, pixel->col, x, y);
-            chafa_color_rgb_to_din99d (&pixel->col, &pixel->col);
-            pixel++;
-        }
+        p0->col.ch [0] += (bg_color.ch [0] * (255 - (guint32) p0->col.ch [3])) / 255;
+        p0->col.ch [1] += (bg_color.ch [1] * (255 - (guint32) p0->col.ch [3])) / 255;
+        p0->col.ch [2] += (bg_color.ch [2] * (255 - (guint32) p0->col.ch [3])) / 255;
     }
 }
 
+static gboolean
+need_normalization (PrepareContext *prep_ctx)
+{
+    return prep_ctx->preprocessing_enabled
+        && (prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_16
+            || prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_8
+            || prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_FGBG);
+}
+
+/* Each row goes through normalization, compositing, ordered dithering and
+ * color space conversion while it's still in L1 cache */
 static void
-fs_and_convert_rgb_to_din99d (const ChafaDither *dither, const ChafaPalette *palette,
-                              ChafaPixel *pixels, gint width, gint dest_y, gint n_rows)
+prepare_pixels_2_row (PrepareContext *prep_ctx, gint row, gboolean have_alpha)
 {
-    convert_rgb_to_din99d (pixels, width, dest_y, n_rows);
-    fs_dither (dither, palette, CHAFA_COLOR_SPACE_DIN99D, pixels, width, dest_y, n_rows);
+    ChafaPixel *pixels = prep_ctx->dest_pixels + row * prep_ctx->dest_width;
+
+    if (need_normalization (prep_ctx))
+        normalize_rgb (prep_ctx->dest_pixels, &prep_ctx->hist, prep_ctx->dest_width,
+                       row, 1);
+
+    if (have_alpha)
+        composite_alpha_on_bg (prep_ctx->bg_color_rgb,
+                               prep_ctx->dest_pixels, prep_ctx->dest_width,
+                               row, 1);
+
+    if (prep_ctx->dither->mode == CHAFA_DITHER_MODE_ORDERED
+        || prep_ctx->dither->mode == CHAFA_DITHER_MODE_NOISE)
+        chafa_dither_row_ordered (prep_ctx->dither, pixels, prep_ctx->dest_width, row);
+
+    if (prep_ctx->color_space == CHAFA_COLOR_SPACE_DIN99D)
+        convert_rgb_to_din99d (prep_ctx->dest_pixels, prep_ctx->dest_width, row, 1);
+}
+
+static void
+prepare_pixels_2_rows (PrepareContext *prep_ctx, gint first_row, gint n_rows,
+                       gboolean have_alpha)
+{
+    gint i;
+
+    if (prep_ctx->dither->mode != CHAFA_DITHER_MODE_DIFFUSION)
+    {
+        for (i = first_row; i < first_row + n_rows; i++)
+            prepare_pixels_2_row (prep_ctx, i, have_alpha);
+        return;
+    }
+
+    /* Error diffusion works on whole runs of rows */
+
+    if (need_normalization (prep_ctx))
+        normalize_rgb (prep_ctx->dest_pixels, &prep_ctx->hist, prep_ctx->dest_width,
+                       first_row, n_rows);
+
+    if (have_alpha)
+        composite_alpha_on_bg (prep_ctx->bg_color_rgb,
+                               prep_ctx->dest_pixels, prep_ctx->dest_width,
+                               first_row, n_rows);
+
+    if (prep_ctx->color_space == CHAFA_COLOR_SPACE_DIN99D)
+    {
+        fs_and_convert_rgb_to_din99d (prep_ctx->dither,
+                                      prep_ctx->palette,
+                                      prep_ctx->dest_pixels,
+                                      prep_ctx->dest_width,
+                                      first_row,
+                                      n_rows);
+    }
+    else
+    {
+        fs_dither (prep_ctx->dither,
+                   prep_ctx->palette,
+                   prep_ctx->color_space,
+                   prep_ctx->dest_pixels,
+                   prep_ctx->dest_width,
+                   first_row,
+                   n_rows);
+    }
 }
 
 static void
@@ -462,14 +602,56 @@ prepare_pixels_1_inner (PreparePixelsBatch1Ret *ret,
     {
         boost_saturation_rgb (col);
     }
+}
 
-    /* Build histogram */
-    if (col->ch [3] > 127)
-    {
-        gint v = rgb_to_intensity_fast (col);
-        ret->hist.c [v]++;
-        ret->hist.n_samples++;
-    }
+/* Generates the loops that post-process scaled pixels in place. There's
+ * one for each combination of alpha tracking and saturation boost, so
+ * neither has to be checked per pixel. Sources that can't have alpha,
+ * and don't need boosting, skip this altogether. */
+#define DEFINE_POST_SCALE_FUNC(name, track_alpha, boost)                \
+static gint                                                             \
+name (ChafaPixel *pixel, ChafaPixel *pixel_max)                         \
+{                                                                       \
+    gint alpha_or = 0;                                                  \
+                                                                        \
+    for ( ; pixel < pixel_max; pixel++)                                 \
+    {                                                                   \
+        if (track_alpha)                                                \
+            alpha_or |= 0xff - pixel->col.ch [3];                       \
+        if (boost)                                                      \
+            boost_saturation_rgb (&pixel->col);                         \
+    }                                                                   \
+                                                                        \
+    return alpha_or;                                                    \
+}
+
+DEFINE_POST_SCALE_FUNC (post_scale_alpha, TRUE, FALSE)
+DEFINE_POST_SCALE_FUNC (post_scale_alpha_boost, TRUE, TRUE)
+DEFINE_POST_SCALE_FUNC (post_scale_boost, FALSE, TRUE)
+
+/* Whether pixels of this type are always fully opaque */
+gboolean
+chafa_pixel_type_is_opaque (ChafaPixelType pixel_type)
+{
+    return pixel_type == CHAFA_PIXEL_RGB8
+        || pixel_type == CHAFA_PIXEL_BGR8
+        || pixel_type == CHAFA_PIXEL_I420
+        || pixel_type == CHAFA_PIXEL_NV12
+        || pixel_type == CHAFA_PIXEL_RGB16;
+}
+
+static void
+pick_post_scale_func (PrepareContext *prep_ctx)
+{
+    gboolean opaque = chafa_pixel_type_is_opaque (prep_ctx->src_pixel_type);
+    gboolean boost = prep_ctx->preprocessing_enabled
+        && (prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_16
+            || prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_8);
+
+    if (opaque)
+        prep_ctx->post_scale_func = boost ? post_scale_boost : NULL;
+    else
+        prep_ctx->post_scale_func = boost ? post_scale_alpha_boost : post_scale_alpha;
 }
 
 static void
@@ -485,7 +667,7 @@ prepare_pixels_1_worker_nearest (ChafaBatchInfo *batch, PrepareContext *prep_ctx
     gint rowstride;
     PreparePixelsBatch1Ret *ret;
 
-    ret = g_new (PreparePixelsBatch1Ret, 1);
+    ret = g_new0 (PreparePixelsBatch1Ret, 1);
     batch->ret_p = ret;
 
     dest_y = batch->first_row;
@@ -509,6 +691,23 @@ prepare_pixels_1_worker_nearest (ChafaBatchInfo *batch, PrepareContext *prep_ctx
             const guint8 *data_p = data_row_p + ((px * x_inc) / FIXED_MULT) * 4;
             prepare_pixels_1_inner (ret, prep_ctx, data_p, pixel++, &alpha_sum);
         }
+
+        if (need_normalization (prep_ctx))
+            accumulate_histogram (ret, pixel - prep_ctx->dest_width, prep_ctx->dest_width);
+
+        /* Compositing leaves opaque pixels alone, so it's fine to do it
+         * for chunks that have some alpha even if others don't */
+        if (prep_ctx->fuse_passes
+            && ((py - dest_y + 1) % FUSED_CHUNK_ROWS == 0 || py == dest_y + n_rows - 1))
+        {
+            gint chunk_rows = (py - dest_y) % FUSED_CHUNK_ROWS + 1;
+
+            prepare_pixels_2_rows (prep_ctx, py + 1 - chunk_rows, chunk_rows,
+                                   alpha_sum > 0);
+            if (alpha_sum > 0)
+                g_atomic_int_set (&prep_ctx->have_alpha_int, 1);
+            alpha_sum = 0;
+        }
     }
 
     if (alpha_sum > 0)
@@ -519,31 +718,52 @@ static void
 prepare_pixels_1_worker_smooth (ChafaBatchInfo *batch, PrepareContext *prep_ctx)
 {
     ChafaPixel *pixel, *pixel_max;
-    gint alpha_sum = 0;
-    guint8 *scaled_data;
-    const guint8 *data_p;
     PreparePixelsBatch1Ret *ret;
+    SmolScaleState *scale_state;
+    gint chunk_rows, y;
 
     ret = g_new0 (PreparePixelsBatch1Ret, 1);
     batch->ret_p = ret;
 
-    scaled_data = g_malloc (prep_ctx->dest_width * batch->n_rows * sizeof (guint32));
-    smol_scale_batch_full (prep_ctx->scale_ctx, scaled_data, batch->first_row, batch->n_rows);
+    /* Without fusion, the whole batch is scaled in one go */
+    chunk_rows = prep_ctx->fuse_passes ? FUSED_CHUNK_ROWS : batch->n_rows;
 
-    data_p = scaled_data;
-    pixel = prep_ctx->dest_pixels + batch->first_row * prep_ctx->dest_width;
-    pixel_max = pixel + batch->n_rows * prep_ctx->dest_width;
+    /* Carried across chunks, so the input rows at chunk seams are only
+     * scaled horizontally once */
+    scale_state = smol_scale_state_new (prep_ctx->scale_ctx);
 
-    while (pixel < pixel_max)
+    for (y = batch->first_row; y < batch->first_row + batch->n_rows; y += chunk_rows)
     {
-        prepare_pixels_1_inner (ret, prep_ctx, data_p, pixel++, &alpha_sum);
-        data_p += 4;
-    }
+        gint n_rows = MIN (chunk_rows, batch->first_row + batch->n_rows - y);
+        gboolean chunk_has_alpha = FALSE;
 
-    g_free (scaled_data);
+        pixel = prep_ctx->dest_pixels + y * prep_ctx->dest_width;
+        pixel_max = pixel + n_rows * prep_ctx->dest_width;
 
-    if (alpha_sum > 0)
-        g_atomic_int_set (&prep_ctx->have_alpha_int, 1);
+        if (prep_ctx->stage_times)
+            ret->scale_time_us -= g_get_monotonic_time ();
+
+        smol_scale_batch_with_state (prep_ctx->scale_ctx, scale_state, pixel, y, n_rows);
+
+        if (prep_ctx->stage_times)
+            ret->scale_time_us += g_get_monotonic_time ();
+
+        if (prep_ctx->post_scale_func)
+            chunk_has_alpha = prep_ctx->post_scale_func (pixel, pixel_max) != 0;
+
+        if (need_normalization (prep_ctx))
+            accumulate_histogram (ret, pixel, n_rows * prep_ctx->dest_width);
+
+        if (chunk_has_alpha)
+            g_atomic_int_set (&prep_ctx->have_alpha_int, 1);
+
+        /* Compositing leaves opaque pixels alone, so it's fine to do it
+         * for chunks that have some alpha even if others don't */
+        if (prep_ctx->fuse_passes)
+            prepare_pixels_2_rows (prep_ctx, y, n_rows, chunk_has_alpha);
+    }
+
+    smol_scale_state_destroy (scale_state);
 }
 
 static void
@@ -551,9 +771,17 @@ pass_1_post (ChafaBatchInfo *batch, PrepareContext *prep_ctx)
 {
     PreparePixelsBatch1Ret *ret = batch->ret_p;
 
-    if (prep_ctx->preprocessing_enabled)
+    if (need_normalization (prep_ctx))
+    {
+        sum_histograms (ret->hist_lanes, ret->n_pixels, &prep_ctx->hist);
+    }
+
+    /* Scaling runs in the workers, so we can only report the time they
+     * spent on it, summed. That's CPU time when the workers are busy. */
+    if (prep_ctx->stage_times)
     {
-        sum_histograms (&ret->hist, &prep_ctx->hist);
+        prep_ctx->stage_times [CHAFA_CANVAS_STAGE_SCALE].wall_us += ret->scale_time_us;
+        prep_ctx->stage_times [CHAFA_CANVAS_STAGE_SCALE].cpu_us += ret->scale_time_us;
     }
 
     g_free (ret);
@@ -569,7 +797,7 @@ prepare_pixels_pass_1 (PrepareContext *prep_ctx)
      *
      * - Scale and convert pixel format
      * - Apply local preprocessing like saturation boost (optional)
-     * - Generate histogram for later passes (e.g. for normalization)
+     * - Generate histogram for normalization (optional)
      * - Figure out if we have alpha transparency
      */
 
@@ -579,6 +807,7 @@ prepare_pixels_pass_1 (PrepareContext *prep_ctx)
                           : prepare_pixels_1_worker_smooth);
 
     chafa_process_batches (prep_ctx,
+                           "prepare-pass-1",
                            (GFunc) batch_func,
                            (GFunc) pass_1_post,
                            prep_ctx->dest_height,
@@ -586,7 +815,7 @@ prepare_pixels_pass_1 (PrepareContext *prep_ctx)
                            1);
 
     /* Generate final histogram */
-    if (prep_ctx->preprocessing_enabled)
+    if (need_normalization (prep_ctx))
     {
         switch (prep_ctx->palette_type)
         {
@@ -603,23 +832,6 @@ prepare_pixels_pass_1 (PrepareContext *prep_ctx)
     }
 }
 
-static void
-composite_alpha_on_bg (ChafaColor bg_color,
-                       ChafaPixel *pixels, gint width, gint first_row, gint n_rows)
-{
-    ChafaPixel *p0, *p1;
-
-    p0 = pixels + first_row * width;
-    p1 = p0 + n_rows * width;
-
-    for ( ; p0 < p1; p0++)
-    {
-        p0->col.ch [0] += (bg_color.ch [0] * (255 - (guint32) p0->col.ch [3])) / 255;
-        p0->col.ch [1] += (bg_color.ch [1] * (255 - (guint32) p0->col.ch [3])) / 255;
-        p0->col.ch [2] += (bg_color.ch [2] * (255 - (guint32) p0->col.ch [3])) / 255;
-    }
-}
-
 /* FIXME: Could we always destroy the alpha channel and eliminate the other
  * variant? */
 static void
@@ -650,72 +862,14 @@ chafa_composite_rgba_on_solid_color (ChafaColor color,
 static void
 prepare_pixels_2_worker (ChafaBatchInfo *batch, PrepareContext *prep_ctx)
 {
-    if (prep_ctx->preprocessing_enabled
-        && (prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_16
-            || prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_8
-            || prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_FGBG))
-        normalize_rgb (prep_ctx->dest_pixels, &prep_ctx->hist, prep_ctx->dest_width,
-                       batch->first_row, batch->n_rows);
-
-    if (prep_ctx->have_alpha_int)
-        composite_alpha_on_bg (prep_ctx->bg_color_rgb,
-                               prep_ctx->dest_pixels, prep_ctx->dest_width,
-                               batch->first_row, batch->n_rows);
-
-    if (prep_ctx->color_space == CHAFA_COLOR_SPACE_DIN99D)
-    {
-        if (prep_ctx->dither->mode == CHAFA_DITHER_MODE_ORDERED)
-        {
-            bayer_and_convert_rgb_to_din99d (prep_ctx->dither,
-                                             prep_ctx->dest_pixels,
-                                             prep_ctx->dest_width,
-                                             batch->first_row,
-                                             batch->n_rows);
-        }
-        else if (prep_ctx->dither->mode == CHAFA_DITHER_MODE_DIFFUSION)
-        {
-            fs_and_convert_rgb_to_din99d (prep_ctx->dither,
-                                          prep_ctx->palette,
-                                          prep_ctx->dest_pixels,
-                                          prep_ctx->dest_width,
-                                          batch->first_row,
-                                          batch->n_rows);
-        }
-        else
-        {
-            convert_rgb_to_din99d (prep_ctx->dest_pixels,
-                                   prep_ctx->dest_width,
-                                   batch->first_row,
-                                   batch->n_rows);
-        }
-    }
-    else if (prep_ctx->dither->mode == CHAFA_DITHER_MODE_ORDERED)
-    {
-        bayer_dither (prep_ctx->dither,
-                      prep_ctx->dest_pixels,
-                      prep_ctx->dest_width,
-                      batch->first_row,
-                      batch->n_rows);
-    }
-    else if (prep_ctx->dither->mode == CHAFA_DITHER_MODE_DIFFUSION)
-    {
-        fs_dither (prep_ctx->dither,
-                   prep_ctx->palette,
-                   prep_ctx->color_space,
-                   prep_ctx->dest_pixels,
-                   prep_ctx->dest_width,
-                   batch->first_row,
-                   batch->n_rows);
-    }
+    prepare_pixels_2_rows (prep_ctx, batch->first_row, batch->n_rows,
+                           prep_ctx->have_alpha_int);
 }
 
 static gboolean
 need_pass_2 (PrepareContext *prep_ctx)
 {
-    if ((prep_ctx->preprocessing_enabled
-         && (prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_16
-             || prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_8
-             || prep_ctx->palette_type == CHAFA_PALETTE_TYPE_FIXED_FGBG))
+    if (need_normalization (prep_ctx)
         || prep_ctx->have_alpha_int
         || prep_ctx->color_space == CHAFA_COLOR_SPACE_DIN99D
         || prep_ctx->dither->mode != CHAFA_DITHER_MODE_NONE)
@@ -724,6 +878,18 @@ need_pass_2 (PrepareContext *prep_ctx)
     return FALSE;
 }
 
+/* The second pass can be done a few rows at a time right after the first,
+ * while the pixels are still in cache, unless it needs something that's
+ * only known once the whole image has been through the first pass. */
+static gboolean
+can_fuse_passes (PrepareContext *prep_ctx)
+{
+    /* Normalization needs the histogram of the whole image, and diffusion
+     * must run in order in a single thread */
+    return !need_normalization (prep_ctx)
+        && prep_ctx->dither->mode != CHAFA_DITHER_MODE_DIFFUSION;
+}
+
 static void
 prepare_pixels_pass_2 (PrepareContext *prep_ctx)
 {
@@ -738,7 +904,7 @@ prepare_pixels_pass_2 (PrepareContext *prep_ctx)
      * - Color space conversion; DIN99d (optional)
      */
 
-    if (!need_pass_2 (prep_ctx))
+    if (prep_ctx->fuse_passes || !need_pass_2 (prep_ctx))
         return;
 
     n_batches = chafa_get_n_actual_threads ();
@@ -753,6 +919,7 @@ prepare_pixels_pass_2 (PrepareContext *prep_ctx)
     }
 
     chafa_process_batches (prep_ctx,
+                           "prepare-pass-2",
                            (GFunc) prepare_pixels_2_worker,
                            NULL,  /* _post */
                            prep_ctx->dest_height,
@@ -760,7 +927,9 @@ prepare_pixels_pass_2 (PrepareContext *prep_ctx)
                            batch_unit);
 }
 
-void
+/* Returns TRUE if any of the prepared pixels have alpha. Opaque source
+ * pixel types never do, and skip alpha detection. */
+gboolean
 chafa_prepare_pixel_data_for_symbols (const ChafaPalette *palette,
                                       const ChafaDither *dither,
                                       ChafaColorSpace color_space,
@@ -773,9 +942,12 @@ chafa_prepare_pixel_data_for_symbols (const ChafaPalette *palette,
                                       gint src_rowstride,
                                       ChafaPixel *dest_pixels,
                                       gint dest_width,
-                                      gint dest_height)
+                                      gint dest_height,
+                                      ChafaStageTime *stage_times,
+                                      const gint *cancel_flag)
 {
     PrepareContext prep_ctx = { 0 };
+    ChafaStageTime start;
 
     prep_ctx.palette = palette;
     prep_ctx.dither = dither;
@@ -797,22 +969,47 @@ chafa_prepare_pixel_data_for_symbols (const ChafaPalette *palette,
     prep_ctx.dest_pixels = dest_pixels;
     prep_ctx.dest_width = dest_width;
     prep_ctx.dest_height = dest_height;
-
-    prep_ctx.scale_ctx = smol_scale_new ((SmolPixelType) prep_ctx.src_pixel_type,
-                                         (const guint32 *) prep_ctx.src_pixels,
-                                         prep_ctx.src_width,
-                                         prep_ctx.src_height,
-                                         prep_ctx.src_rowstride,
-                                         SMOL_PIXEL_RGBA8_PREMULTIPLIED,
-                                         NULL,
-                                         prep_ctx.dest_width,
-                                         prep_ctx.dest_height,
-                                         prep_ctx.dest_width * sizeof (guint32));
+    prep_ctx.stage_times = stage_times;
+
+    prep_ctx.scale_ctx = smol_scale_new_flags ((SmolPixelType) prep_ctx.src_pixel_type,
+                                               (const guint32 *) prep_ctx.src_pixels,
+                                               prep_ctx.src_width,
+                                               prep_ctx.src_height,
+                                               prep_ctx.src_rowstride,
+                                               SMOL_PIXEL_RGBA8_PREMULTIPLIED,
+                                               NULL,
+                                               prep_ctx.dest_width,
+                                               prep_ctx.dest_height,
+                                               prep_ctx.dest_width * sizeof (guint32),
+                                               NULL,
+                                               NULL,
+                                               work_factor >= LINEAR_SCALING_WORK_FACTOR_MIN
+                                               ? SMOL_ENABLE_SRGB_LINEARIZATION
+                                               : SMOL_NO_FLAGS);
+
+    prep_ctx.fuse_passes = can_fuse_passes (&prep_ctx);
+    pick_post_scale_func (&prep_ctx);
+
+    if (stage_times)
+        chafa_stage_time_begin (&start);
 
     prepare_pixels_pass_1 (&prep_ctx);
-    prepare_pixels_pass_2 (&prep_ctx);
+
+    if (stage_times)
+    {
+        chafa_stage_time_end (&start, &stage_times [CHAFA_CANVAS_STAGE_PREPARE_PASS_1]);
+        chafa_stage_time_begin (&start);
+    }
+
+    /* The caller checks the flag too, and discards the pixels */
+    if (!cancel_flag || !g_atomic_int_get (cancel_flag))
+        prepare_pixels_pass_2 (&prep_ctx);
+
+    if (stage_times)
+        chafa_stage_time_end (&start, &stage_times [CHAFA_CANVAS_STAGE_PREPARE_PASS_2]);
 
     smol_scale_destroy (prep_ctx.scale_ctx);
+    return prep_ctx.have_alpha_int ? TRUE : FALSE;
 }
 
 void
@@ -22,27 +22,32 @@
 
 #include <glib.h>
 #include "internal/chafa-private.h"
+#include "internal/chafa-stage-time.h"
 
 G_BEGIN_DECLS
 
-void chafa_prepare_pixel_data_for_symbols (const ChafaPalette *palette,
-                                           const ChafaDither *dither,
-                                           ChafaColorSpace color_space,
-                                           gboolean preprocessing_enabled,
-                                           gint work_factor,
-                                           ChafaPixelType src_pixel_type,
-                                           gconstpointer src_pixels,
-                                           gint src_width,
-                                           gint src_height,
-                                           gint src_rowstride,
-                                           ChafaPixel *dest_pixels,
-                                           gint dest_width,
-                                           gint dest_height);
+gboolean chafa_prepare_pixel_data_for_symbols (const ChafaPalette *palette,
+                                               const ChafaDither *dither,
+                                               ChafaColorSpace color_space,
+                                               gboolean preprocessing_enabled,
+                                               gint work_factor,
+                                               ChafaPixelType src_pixel_type,
+                                               gconstpointer src_pixels,
+                                               gint src_width,
+                                               gint src_height,
+                                               gint src_rowstride,
+                                               ChafaPixel *dest_pixels,
+                                               gint dest_width,
+                                               gint dest_height,
+                                               ChafaStageTime *stage_times,
+                                               const gint *cancel_flag);
 
 void chafa_sort_pixel_index_by_channel (guint8 *index,
                                         const ChafaPixel *pixels, gint n_pixels,
                                         gint ch);
 
+gboolean chafa_pixel_type_is_opaque (ChafaPixelType pixel_type);
+
 void chafa_composite_rgba_on_solid_color (ChafaColor color,
                                           ChafaPixel *pixels, gint width, gint first_row, gint n_rows);
 
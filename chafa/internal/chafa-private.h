@@ -55,6 +55,27 @@ typedef struct
 }
 ChafaSymbol2;
 
+/* Number of symbols covered by each entry in block_bounds */
+#define CHAFA_SYMBOL_BLOCK_SIZE 16
+
+/* Owns the compiled symbol arrays. These are immutable once built, and
+ * shared between every map prepared from the same contents; a map that
+ * changes gets a new table instead of modifying this one. */
+typedef struct
+{
+    gint refs;
+
+    ChafaSymbol *symbols;
+    gint n_symbols;
+    guint64 *packed_bitmaps;
+    guint32 *block_bounds;
+
+    ChafaSymbol2 *symbols2;
+    gint n_symbols2;
+    guint64 *packed_bitmaps2;
+}
+ChafaSymbolTable;
+
 struct ChafaSymbolMap
 {
     gint refs;
@@ -66,17 +87,35 @@ struct ChafaSymbolMap
     GHashTable *glyphs2;  /* Wide glyphs with left/right bitmaps */
     GArray *selectors;
 
-    /* Remaining fields are populated by chafa_symbol_map_prepare () */
+    /* Remaining fields are populated by chafa_symbol_map_prepare (). The
+     * arrays belong to the table. */
+
+    ChafaSymbolTable *table;
 
     /* Narrow symbols */
     ChafaSymbol *symbols;
     gint n_symbols;
     guint64 *packed_bitmaps;
 
+    /* Per-quadrant popcount ranges for each block of
+     * CHAFA_SYMBOL_BLOCK_SIZE consecutive symbols, as a pair of packed
+     * minimums and maximums. Used to skip blocks that can't beat the
+     * candidates found so far. */
+    guint32 *block_bounds;
+
+    /* Symbols are sorted by popcount. Those with popcount N are found at
+     * [popcount_ofs [N], popcount_ofs [N + 1]) */
+    gint popcount_ofs [CHAFA_SYMBOL_N_PIXELS + 2];
+
     /* Wide symbols */
     ChafaSymbol2 *symbols2;
     gint n_symbols2;
     guint64 *packed_bitmaps2;
+
+    /* Index of the symbol with the closest popcount, for each popcount.
+     * These make fill lookups constant-time. */
+    gint fill_index [CHAFA_SYMBOL_N_PIXELS + 1];
+    gint fill_index2 [CHAFA_SYMBOL_N_PIXELS * 2 + 1];
 };
 
 /* Symbol selection candidate */
@@ -112,7 +151,13 @@ struct ChafaCanvasConfig
     ChafaSymbolMap fill_symbol_map;
     guint preprocessing_enabled : 1;
     guint fg_only_enabled : 1;
+    guint stats_enabled : 1;
+    guint palette_reuse_enabled : 1;
     ChafaOptimizations optimizations;
+    gint compression_level;  /* 0-9. 0 = no compression */
+    ChafaTransmissionMedium transmission_medium;
+    gint time_budget_us;  /* 0 = fixed work factor */
+    gint color_tolerance;  /* 0 = lossless */
 };
 
 /* Canvas */
@@ -121,17 +166,20 @@ typedef struct ChafaCanvasCell ChafaCanvasCell;
 
 /* Library functions */
 
-extern ChafaSymbol *chafa_symbols;
-extern ChafaSymbol2 *chafa_symbols2;
+extern const ChafaSymbol chafa_symbols [];
+extern const ChafaSymbol2 chafa_symbols2 [];
 
 void chafa_init_palette (void);
-void chafa_init_symbols (void);
 ChafaSymbolTags chafa_get_tags_for_char (gunichar c);
 
 void chafa_init (void);
 gboolean chafa_have_mmx (void) G_GNUC_PURE;
 gboolean chafa_have_sse41 (void) G_GNUC_PURE;
 gboolean chafa_have_popcnt (void) G_GNUC_PURE;
+gboolean chafa_have_avx2 (void) G_GNUC_PURE;
+gboolean chafa_have_avx512_vpopcntdq (void) G_GNUC_PURE;
+gboolean chafa_have_neon (void) G_GNUC_PURE;
+void chafa_set_feature_mask (ChafaFeatures mask);
 
 void chafa_symbol_map_init (ChafaSymbolMap *symbol_map);
 void chafa_symbol_map_deinit (ChafaSymbolMap *symbol_map);
@@ -168,14 +216,28 @@ gint *chafa_gen_bayer_matrix (gint matrix_size, gdouble magnitude);
 /* Math stuff */
 
 #ifdef HAVE_MMX_INTRINSICS
-void calc_colors_mmx (const ChafaPixel *pixels, ChafaColorAccum *accums_out, const guint8 *cov);
+void calc_colors_mmx (const ChafaPixel *pixels, ChafaColorAccum *accums_out, guint64 bitmap);
 void chafa_leave_mmx (void);
 #else
 # define chafa_leave_mmx()
 #endif
 
 #ifdef HAVE_SSE41_INTRINSICS
-gint calc_error_sse41 (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov) G_GNUC_PURE;
+gint calc_error_sse41 (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov,
+                       gint max_error) G_GNUC_PURE;
+gsize chafa_base64_encode_sse41 (gchar *out, const guint8 *in, gsize in_len);
+#endif
+
+#ifdef HAVE_AVX2_INTRINSICS
+void calc_colors_bitmap_avx2 (const ChafaPixel *pixels, ChafaColorAccum *accums_out, guint64 bitmap);
+gint calc_error_avx2 (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov) G_GNUC_PURE;
+guint64 chafa_work_cell_to_bitmap_avx2 (const guint8 *plane_r, const guint8 *plane_g, const guint8 *plane_b,
+                                        const ChafaColorPair *color_pair) G_GNUC_PURE;
+gint chafa_eval_symbols_mean_avx2 (const ChafaPixel *pixels, const ChafaSymbol *symbols,
+                                   const ChafaCandidate *candidates, gint n_candidates,
+                                   ChafaColorPair *pairs_out, gint *errors_out);
+gsize chafa_base64_encode_avx2 (gchar *out, const guint8 *in, gsize in_len);
+void chafa_apply_dither_row_avx2 (ChafaPixel *pixels, const gint16 *mods, gint width);
 #endif
 
 #if defined(HAVE_POPCNT64_INTRINSICS) || defined(HAVE_POPCNT32_INTRINSICS)
@@ -189,6 +251,23 @@ void chafa_hamming_distance_vu64_builtin (guint64 a, const guint64 *vb, gint *vc
 void chafa_hamming_distance_2_vu64_builtin (const guint64 *a, const guint64 *vb, gint *vc, gint n);
 #endif
 
+#ifdef HAVE_AVX2_INTRINSICS
+void chafa_hamming_distance_vu64_avx2 (guint64 a, const guint64 *vb, gint *vc, gint n);
+void chafa_hamming_distance_2_vu64_avx2 (const guint64 *a, const guint64 *vb, gint *vc, gint n);
+#endif
+
+#ifdef HAVE_AVX512_VPOPCNTDQ_INTRINSICS
+void chafa_hamming_distance_vu64_avx512_popcnt (guint64 a, const guint64 *vb, gint *vc, gint n);
+void chafa_hamming_distance_2_vu64_avx512_popcnt (const guint64 *a, const guint64 *vb, gint *vc, gint n);
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+gint calc_error_neon (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov,
+                      gint max_error) G_GNUC_PURE;
+void chafa_hamming_distance_vu64_neon (guint64 a, const guint64 *vb, gint *vc, gint n);
+void chafa_hamming_distance_2_vu64_neon (const guint64 *a, const guint64 *vb, gint *vc, gint n);
+#endif
+
 /* Inline functions */
 
 static inline guint64 chafa_slow_pop_count (guint64 v) G_GNUC_UNUSED;
@@ -239,6 +318,22 @@ chafa_population_count_vu64 (const guint64 *vv, gint *vc, gint n)
 static inline void
 chafa_hamming_distance_vu64 (guint64 a, const guint64 *vb, gint *vc, gint n)
 {
+#ifdef HAVE_AVX512_VPOPCNTDQ_INTRINSICS
+    if (chafa_have_avx512_vpopcntdq ())
+    {
+        chafa_hamming_distance_vu64_avx512_popcnt (a, vb, vc, n);
+        return;
+    }
+#endif
+
+#ifdef HAVE_AVX2_INTRINSICS
+    if (chafa_have_avx2 ())
+    {
+        chafa_hamming_distance_vu64_avx2 (a, vb, vc, n);
+        return;
+    }
+#endif
+
 #ifdef HAVE_POPCNT_INTRINSICS
     if (chafa_have_popcnt ())
     {
@@ -247,6 +342,14 @@ chafa_hamming_distance_vu64 (guint64 a, const guint64 *vb, gint *vc, gint n)
     }
 #endif
 
+#ifdef HAVE_NEON_INTRINSICS
+    if (chafa_have_neon ())
+    {
+        chafa_hamming_distance_vu64_neon (a, vb, vc, n);
+        return;
+    }
+#endif
+
     while (n--)
         *(vc++) = chafa_slow_pop_count (a ^ *(vb++));
 }
@@ -254,6 +357,22 @@ chafa_hamming_distance_vu64 (guint64 a, const guint64 *vb, gint *vc, gint n)
 static inline void
 chafa_hamming_distance_2_vu64 (const guint64 *a, const guint64 *vb, gint *vc, gint n)
 {
+#ifdef HAVE_AVX512_VPOPCNTDQ_INTRINSICS
+    if (chafa_have_avx512_vpopcntdq ())
+    {
+        chafa_hamming_distance_2_vu64_avx512_popcnt (a, vb, vc, n);
+        return;
+    }
+#endif
+
+#ifdef HAVE_AVX2_INTRINSICS
+    if (chafa_have_avx2 ())
+    {
+        chafa_hamming_distance_2_vu64_avx2 (a, vb, vc, n);
+        return;
+    }
+#endif
+
 #ifdef HAVE_POPCNT_INTRINSICS
     if (chafa_have_popcnt ())
     {
@@ -262,6 +381,14 @@ chafa_hamming_distance_2_vu64 (const guint64 *a, const guint64 *vb, gint *vc, gi
     }
 #endif
 
+#ifdef HAVE_NEON_INTRINSICS
+    if (chafa_have_neon ())
+    {
+        chafa_hamming_distance_2_vu64_neon (a, vb, vc, n);
+        return;
+    }
+#endif
+
     while (n--)
     {
         *(vc++) = chafa_slow_pop_count (a [0] ^ vb [0])
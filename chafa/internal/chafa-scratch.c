@@ -0,0 +1,274 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <string.h>  /* memset */
+
+#ifdef HAVE_MMAP
+# include <sys/mman.h>
+#endif
+
+#include "internal/chafa-scratch.h"
+
+/* The first chunk is big enough for most batches. Later ones double in
+ * size, and from HUGE_PAGE_SIZE up, they're mapped so the kernel can back
+ * them with huge pages. */
+#define INITIAL_CHUNK_SIZE (64 * 1024)
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+#define ALIGN_UP(n, a) (((n) + (a) - 1) & ~((gsize) (a) - 1))
+
+#if defined (HAVE_MMAP) && defined (MAP_ANONYMOUS)
+# define USE_MMAP 1
+#endif
+
+typedef struct ScratchChunk ScratchChunk;
+
+struct ScratchChunk
+{
+    ScratchChunk *next;
+    guint8 *data;
+    gsize size;
+
+    /* What to pass to g_free (), or NULL if the data is mapped */
+    gpointer alloc;
+};
+
+typedef struct
+{
+    ScratchChunk *first;
+    ScratchChunk *cur;
+    gsize ofs;
+
+    /* Skipped chunk tails count as in use, since they can't be had
+     * until the allocations before them are released */
+    gsize in_use;
+    gsize peak;
+}
+ScratchPool;
+
+static void free_pool (gpointer p);
+
+static GPrivate pool_key = G_PRIVATE_INIT (free_pool);
+
+static guint8 *
+map_huge (gsize size)
+{
+#ifdef USE_MMAP
+    guint8 *base, *aligned;
+    gsize map_size = size + HUGE_PAGE_SIZE;
+
+    /* Map an extra huge page's worth, so we can trim it to alignment */
+    base = mmap (NULL, map_size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return NULL;
+
+    aligned = (guint8 *) ALIGN_UP ((guintptr) base, HUGE_PAGE_SIZE);
+    if (aligned > base)
+        munmap (base, aligned - base);
+    if (aligned + size < base + map_size)
+        munmap (aligned + size, base + map_size - (aligned + size));
+
+# ifdef MADV_HUGEPAGE
+    madvise (aligned, size, MADV_HUGEPAGE);
+# endif
+
+    return aligned;
+#else
+    (void) size;
+    return NULL;
+#endif
+}
+
+static ScratchChunk *
+chunk_new (gsize size)
+{
+    ScratchChunk *chunk = g_new0 (ScratchChunk, 1);
+
+    if (size >= HUGE_PAGE_SIZE)
+    {
+        size = ALIGN_UP (size, HUGE_PAGE_SIZE);
+        chunk->data = map_huge (size);
+    }
+
+    if (!chunk->data)
+    {
+        chunk->alloc = g_malloc (size + CHAFA_SCRATCH_ALIGN);
+        chunk->data = (guint8 *) ALIGN_UP ((guintptr) chunk->alloc, CHAFA_SCRATCH_ALIGN);
+    }
+
+    chunk->size = size;
+    return chunk;
+}
+
+static void
+chunk_free (ScratchChunk *chunk)
+{
+#ifdef USE_MMAP
+    if (!chunk->alloc)
+        munmap (chunk->data, chunk->size);
+#endif
+
+    g_free (chunk->alloc);
+    g_free (chunk);
+}
+
+static void
+free_chunks (ScratchChunk *chunk)
+{
+    while (chunk)
+    {
+        ScratchChunk *next = chunk->next;
+        chunk_free (chunk);
+        chunk = next;
+    }
+}
+
+static void
+free_pool (gpointer p)
+{
+    ScratchPool *pool = p;
+
+    free_chunks (pool->first);
+    g_free (pool);
+}
+
+static ScratchPool *
+get_pool (void)
+{
+    ScratchPool *pool = g_private_get (&pool_key);
+
+    if (!pool)
+    {
+        pool = g_new0 (ScratchPool, 1);
+        g_private_set (&pool_key, pool);
+    }
+
+    return pool;
+}
+
+/* Moves on to the next chunk, replacing it if it's too small */
+static void
+next_chunk (ScratchPool *pool, gsize size)
+{
+    ScratchChunk **link = pool->cur ? &pool->cur->next : &pool->first;
+
+    if (pool->cur)
+        pool->in_use += pool->cur->size - pool->ofs;
+
+    if (!*link || (*link)->size < size)
+    {
+        gsize chunk_size = pool->cur ? pool->cur->size * 2 : INITIAL_CHUNK_SIZE;
+
+        /* Nothing after the current chunk can be live */
+        free_chunks (*link);
+        *link = chunk_new (MAX (chunk_size, size));
+    }
+
+    pool->cur = *link;
+    pool->ofs = 0;
+}
+
+void
+chafa_scratch_mark (ChafaScratchMark *mark_out)
+{
+    ScratchPool *pool = get_pool ();
+
+    mark_out->chunk = pool->cur;
+    mark_out->ofs = pool->ofs;
+    mark_out->in_use = pool->in_use;
+    mark_out->peak = pool->peak;
+
+    pool->peak = pool->in_use;
+}
+
+gsize
+chafa_scratch_release (const ChafaScratchMark *mark)
+{
+    ScratchPool *pool = get_pool ();
+    gsize used;
+
+    used = pool->peak - mark->in_use;
+
+    pool->cur = mark->chunk;
+    pool->ofs = mark->ofs;
+    pool->in_use = mark->in_use;
+    pool->peak = MAX (pool->peak, mark->peak);
+
+    return used;
+}
+
+gpointer
+chafa_scratch_alloc (gsize size)
+{
+    ScratchPool *pool = get_pool ();
+    gpointer p;
+
+    size = ALIGN_UP (MAX (size, 1), CHAFA_SCRATCH_ALIGN);
+
+    if (!pool->cur || pool->ofs + size > pool->cur->size)
+        next_chunk (pool, size);
+
+    p = pool->cur->data + pool->ofs;
+    pool->ofs += size;
+    pool->in_use += size;
+    pool->peak = MAX (pool->peak, pool->in_use);
+
+    return p;
+}
+
+gpointer
+chafa_scratch_alloc0 (gsize size)
+{
+    gpointer p = chafa_scratch_alloc (size);
+
+    memset (p, 0, size);
+    return p;
+}
+
+/* The pointer to pass to g_free () is kept just before the aligned block */
+gpointer
+chafa_aligned_alloc (gsize size)
+{
+    guint8 *alloc, *p;
+
+    alloc = g_malloc (size + CHAFA_SCRATCH_ALIGN + sizeof (gpointer));
+    p = (guint8 *) ALIGN_UP ((guintptr) alloc + sizeof (gpointer), CHAFA_SCRATCH_ALIGN);
+    ((gpointer *) p) [-1] = alloc;
+
+    return p;
+}
+
+gpointer
+chafa_aligned_alloc0 (gsize size)
+{
+    gpointer p = chafa_aligned_alloc (size);
+
+    memset (p, 0, size);
+    return p;
+}
+
+void
+chafa_aligned_free (gpointer p)
+{
+    if (p)
+        g_free (((gpointer *) p) [-1]);
+}
@@ -0,0 +1,75 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef __CHAFA_SCRATCH_H__
+#define __CHAFA_SCRATCH_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* Per-thread scratch memory for temporaries that only live for the
+ * duration of a frame or a batch. Allocation is a pointer bump, and
+ * releasing a mark returns everything allocated after it in one go. The
+ * memory is kept for the life of the thread, so once the pool has grown
+ * to fit a frame, the following frames don't touch the heap at all.
+ *
+ * Marks must be released in the reverse order they were taken, on the
+ * thread that took them. Allocations are aligned to CHAFA_SCRATCH_ALIGN. */
+
+#define CHAFA_SCRATCH_ALIGN 64
+
+typedef struct
+{
+    gpointer chunk;
+    gsize ofs;
+    gsize in_use;
+    gsize peak;
+}
+ChafaScratchMark;
+
+void chafa_scratch_mark (ChafaScratchMark *mark_out);
+
+/* Returns the most memory that was in use above the mark while it was held */
+gsize chafa_scratch_release (const ChafaScratchMark *mark);
+
+gpointer chafa_scratch_alloc (gsize size);
+gpointer chafa_scratch_alloc0 (gsize size);
+
+#define chafa_scratch_new(struct_type, n_structs) \
+    ((struct_type *) chafa_scratch_alloc (sizeof (struct_type) * (n_structs)))
+#define chafa_scratch_new0(struct_type, n_structs) \
+    ((struct_type *) chafa_scratch_alloc0 (sizeof (struct_type) * (n_structs)))
+
+/* Long-lived heap buffers with the same alignment, for images that SIMD
+ * code walks a row at a time. Rows that are a multiple of
+ * CHAFA_SCRATCH_ALIGN bytes apart all start aligned, and a kernel can
+ * run to the end of the padded row instead of finishing with a scalar
+ * tail. Must be freed with chafa_aligned_free (). */
+
+#define CHAFA_ALIGNED_ROWSTRIDE(n_bytes) \
+    (((n_bytes) + CHAFA_SCRATCH_ALIGN - 1) & ~(CHAFA_SCRATCH_ALIGN - 1))
+
+gpointer chafa_aligned_alloc (gsize size);
+gpointer chafa_aligned_alloc0 (gsize size);
+void chafa_aligned_free (gpointer p);
+
+G_END_DECLS
+
+#endif /* __CHAFA_SCRATCH_H__ */
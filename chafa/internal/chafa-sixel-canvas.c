@@ -22,31 +22,44 @@
 #include "chafa.h"
 #include "smolscale/smolscale.h"
 #include "internal/chafa-batch.h"
-#include "internal/chafa-bitfield.h"
 #include "internal/chafa-indexed-image.h"
+#include "internal/chafa-scratch.h"
 #include "internal/chafa-sixel-canvas.h"
 #include "internal/chafa-string-util.h"
 
 #define SIXEL_CELL_HEIGHT 6
 
+/* Streamed images are drawn this many bands at a time per thread, so the
+ * bands can still be encoded in parallel */
+#define STREAM_BANDS_PER_THREAD 2
+
 typedef struct
 {
     ChafaSixelCanvas *sixel_canvas;
-    GString *out_str;
+    ChafaStringSink *sink;
+
+    /* When set, bands identical to the ones in this buffer are left out */
+    const guint8 *prev_pixels;
 }
 BuildSixelsCtx;
 
+/* One column of a sixel row in which a given pen appears. Events for each
+ * pen are chained in column order, so a pen's run-length data can be
+ * emitted without looking at the columns where it's absent. */
 typedef struct
 {
-    /* Lower six bytes are vertical pixel strip; LSB is bottom pixel */
-    guint64 d;
+    gint x;
+    gint next;
+    gchar schar;
 }
-SixelData;
+SixelEvent;
 
 typedef struct
 {
-    SixelData *data;
-    ChafaBitfield filter_bits;
+    SixelEvent *events;
+    gint n_events;
+    gint first_event [256];
+    gint last_event [256];
 }
 SixelRow;
 
@@ -65,7 +78,7 @@ chafa_sixel_canvas_new (gint width, gint height,
 {
     ChafaSixelCanvas *sixel_canvas;
 
-    sixel_canvas = g_new (ChafaSixelCanvas, 1);
+    sixel_canvas = g_new0 (ChafaSixelCanvas, 1);
     sixel_canvas->width = width;
     sixel_canvas->height = height;
     sixel_canvas->color_space = color_space;
@@ -79,9 +92,37 @@ void
 chafa_sixel_canvas_destroy (ChafaSixelCanvas *sixel_canvas)
 {
     chafa_indexed_image_destroy (sixel_canvas->image);
+    g_free (sixel_canvas->emitted_pixels);
     g_free (sixel_canvas);
 }
 
+void
+chafa_sixel_canvas_set_palette (ChafaSixelCanvas *sixel_canvas, const ChafaPalette *palette)
+{
+    chafa_indexed_image_set_palette (sixel_canvas->image, palette);
+}
+
+void
+chafa_sixel_canvas_set_fixed_palette (ChafaSixelCanvas *sixel_canvas, const ChafaPalette *palette)
+{
+    chafa_indexed_image_set_fixed_palette (sixel_canvas->image, palette);
+}
+
+void
+chafa_sixel_canvas_set_palette_reuse (ChafaSixelCanvas *sixel_canvas, gboolean reuse_palette)
+{
+    sixel_canvas->reuse_palette = reuse_palette;
+    sixel_canvas->have_emitted_palette = FALSE;
+    g_clear_pointer (&sixel_canvas->emitted_pixels, g_free);
+    chafa_indexed_image_set_palette_reuse (sixel_canvas->image, reuse_palette);
+}
+
+void
+chafa_sixel_canvas_set_cancel_flag (ChafaSixelCanvas *sixel_canvas, const gint *cancel_flag)
+{
+    sixel_canvas->image->cancel_flag = cancel_flag;
+}
+
 void
 chafa_sixel_canvas_draw_all_pixels (ChafaSixelCanvas *sixel_canvas, ChafaPixelType src_pixel_type,
                                     gconstpointer src_pixels,
@@ -104,127 +145,129 @@ chafa_sixel_canvas_draw_all_pixels (ChafaSixelCanvas *sixel_canvas, ChafaPixelTy
                                      sixel_canvas->width, sixel_canvas->height);
 }
 
-#define FILTER_BANK_WIDTH 64
-
 static void
-filter_set (SixelRow *srow, guint8 pen, gint bank)
+add_event (SixelRow *srow, guint8 pen, gint x, guint8 mask)
 {
-    chafa_bitfield_set_bit (&srow->filter_bits, bank * 256 + (gint) pen, TRUE);
-}
+    SixelEvent *ev = &srow->events [srow->n_events];
 
-static gboolean
-filter_get (const SixelRow *srow, guint8 pen, gint bank)
-{
-    return chafa_bitfield_get_bit (&srow->filter_bits, bank * 256 + (gint) pen);
+    ev->x = x;
+    ev->next = -1;
+    ev->schar = '?' + mask;
+
+    if (srow->first_event [pen] < 0)
+        srow->first_event [pen] = srow->n_events;
+    else
+        srow->events [srow->last_event [pen]].next = srow->n_events;
+
+    srow->last_event [pen] = srow->n_events++;
 }
 
-static void
-fetch_sixel_row (SixelRow *srow, const guint8 *pixels, gint width)
+/* Six rows are uniform across the next 8 columns if every row matches the
+ * first one. Checked a word at a time; this is the common case in flat
+ * image regions. */
+static gboolean
+columns_are_uniform_8 (const guint8 *pixels, gint rowstride)
 {
-    const guint8 *pixels_end, *p;
-    SixelData *sdata = srow->data;
-    gint x;
+    guint64 w0, w;
+    gint r;
 
-    /* The ordering of output bytes is 351240; this is the inverse of
-     * 140325. see sixel_data_do_schar(). */
+    memcpy (&w0, pixels, 8);
+    if (w0 != (w0 & 0xff) * G_GUINT64_CONSTANT (0x0101010101010101))
+        return FALSE;
 
-    for (pixels_end = pixels + width, x = 0; pixels < pixels_end; pixels++, x++)
+    for (r = 1; r < SIXEL_CELL_HEIGHT; r++)
     {
-        guint64 d;
-        gint bank = x / FILTER_BANK_WIDTH;
-
-        p = pixels;
-
-        filter_set (srow, *p, bank);
-        d = (guint64) *p;
-        p += width;
-
-        filter_set (srow, *p, bank);
-        d |= (guint64) *p << (3 * 8);
-        p += width;
+        memcpy (&w, pixels + r * rowstride, 8);
+        if (w != w0)
+            return FALSE;
+    }
 
-        filter_set (srow, *p, bank);
-        d |= (guint64) *p << (2 * 8);
-        p += width;
+    return TRUE;
+}
 
-        filter_set (srow, *p, bank);
-        d |= (guint64) *p << (5 * 8);
-        p += width;
+/* Transposes six image rows into per-pen sixel events */
+static void
+fetch_sixel_row (SixelRow *srow, const guint8 *pixels, gint width, gint rowstride)
+{
+    gint x = 0;
 
-        filter_set (srow, *p, bank);
-        d |= (guint64) *p << (1 * 8);
-        p += width;
+    srow->n_events = 0;
+    memset (srow->first_event, 0xff, sizeof (srow->first_event));
 
-        filter_set (srow, *p, bank);
-        d |= (guint64) *p << (4 * 8);
+    while (x < width)
+    {
+        guint8 pens [SIXEL_CELL_HEIGHT];
+        guint8 masks [SIXEL_CELL_HEIGHT];
+        gint n_pens, r, i;
 
-        (sdata++)->d = d;
-    }
-} 
+        if (x + 8 <= width && columns_are_uniform_8 (pixels + x, rowstride))
+        {
+            /* A single pen covers all six rows of eight columns; extend
+             * the pen's run directly */
+            for (i = 0; i < 8; i++)
+                add_event (srow, pixels [x], x + i, 0x3f);
 
-static gchar
-sixel_data_to_schar (const SixelData *sdata, guint64 expanded_pen)
-{
-    guint64 a;
-    gchar c;
+            x += 8;
+            continue;
+        }
 
-    a = ~(sdata->d ^ expanded_pen);
+        /* Sixel bit n corresponds to row n, top to bottom */
 
-    /* Matching bytes will now contain 0xff. Any other value is a mismatch. */
+        pens [0] = pixels [x];
+        masks [0] = 1;
+        n_pens = 1;
 
-    a &= (a & 0x0000f0f0f0f0f0f0) >> 4;
-    a &= (a & 0x00000c0c0c0c0c0c) >> 2;
-    a &= (a & 0x0000020202020202) >> 1;
+        for (r = 1; r < SIXEL_CELL_HEIGHT; r++)
+        {
+            guint8 pen = pixels [x + r * rowstride];
 
-    /* Matching bytes will now contain 0x01. Misses contain 0x00. */
+            for (i = 0; i < n_pens && pens [i] != pen; i++)
+                ;
 
-    a |= a >> (24 - 1);
-    a |= a >> (16 - 2);
-    a |= a >> (8 - 4);
+            if (i == n_pens)
+            {
+                pens [n_pens] = pen;
+                masks [n_pens++] = 0;
+            }
 
-    /* Set bits are now packed in the lower 6 bits, reordered like this:
-     *
-     * 012345 -> 03/14/25 -> 14/0325 -> 140325 */
+            masks [i] |= 1 << r;
+        }
 
-    c = a & 0x3f;
+        for (i = 0; i < n_pens; i++)
+            add_event (srow, pens [i], x, masks [i]);
 
-    return '?' + c;
+        x++;
+    }
 }
 
+/* Repeat counts can be any decimal number. Counts above 9999 are split,
+ * which never happens in practice. Up to three repeats are shorter (or no
+ * longer) as literals. */
+#define SCHAR_REPS_MAX 9999
+
 static gchar *
 format_schar_reps (gchar rep_schar, gint n_reps, gchar *p)
 {
     g_assert (n_reps > 0);
 
-    for (;;)
+    while (n_reps > 0)
     {
-        if (n_reps < 4)
+        gint n = MIN (n_reps, SCHAR_REPS_MAX);
+
+        if (n < 4)
         {
             do *(p++) = rep_schar;
-            while (--n_reps);
+            while (--n);
 
-            goto out;
+            return p;
         }
-        else if (n_reps < 255)
-        {
-            *(p++) = '!';
-            p = chafa_format_dec_u8 (p, n_reps);
-            *(p++) = rep_schar;
-            goto out;
-        }
-        else
-        {
-            strcpy (p, "!255");
-            p += 4;
-            *(p++) = rep_schar;
-            n_reps -= 255;
 
-            if (n_reps == 0)
-                goto out;
-        }
+        *(p++) = '!';
+        p = chafa_format_dec_uint_0_to_9999 (p, n);
+        *(p++) = rep_schar;
+        n_reps -= n;
     }
 
-out:
     return p;
 }
 
@@ -235,174 +278,250 @@ format_pen (guint8 pen, gchar *p)
     return chafa_format_dec_u8 (p, pen);
 }
 
-/* force_full_width is a workaround for a bug in mlterm; we need to
+typedef struct
+{
+    gchar *p;
+    gboolean need_cr;
+    gboolean need_pen;
+    guint8 pen;
+    gchar rep_schar;
+    gint n_reps;
+}
+SixelEmitter;
+
+static void
+emitter_flush (SixelEmitter *em)
+{
+    if (em->need_cr)
+    {
+        *(em->p++) = '$';
+        em->need_cr = FALSE;
+    }
+    if (em->need_pen)
+    {
+        em->p = format_pen (em->pen, em->p);
+        em->need_pen = FALSE;
+    }
+
+    em->p = format_schar_reps (em->rep_schar, em->n_reps, em->p);
+}
+
+static void
+emitter_feed (SixelEmitter *em, gchar schar, gint n)
+{
+    if (schar == em->rep_schar)
+    {
+        em->n_reps += n;
+        return;
+    }
+
+    if (em->rep_schar != 0)
+        emitter_flush (em);
+
+    em->rep_schar = schar;
+    em->n_reps = n;
+}
+
+/* Emits one pen's events starting at column x, with the gaps between them
+ * becoming runs of empty sixels. Returns the column after the last event. */
+static gint
+emit_pen (SixelEmitter *em, const SixelRow *srow, gint pen, gint x)
+{
+    gint i;
+
+    em->need_pen = TRUE;
+    em->pen = pen;
+    em->rep_schar = 0;
+    em->n_reps = 0;
+
+    for (i = srow->first_event [pen]; i >= 0; i = srow->events [i].next)
+    {
+        const SixelEvent *ev = &srow->events [i];
+
+        if (ev->x > x)
+            emitter_feed (em, '?', ev->x - x);
+
+        emitter_feed (em, ev->schar, 1);
+        x = ev->x + 1;
+    }
+
+    emitter_flush (em);
+    return x;
+}
+
+/* Emits the row pen by pen. Switching pens doesn't move the cursor, so a
+ * pen that starts to the right of where the previous one ended can follow
+ * it directly. Pens are chained that way, and each chain after the first
+ * costs a carriage return ('$'). Pens are taken in order of their first
+ * column, and each goes at the end of the chain that ends closest to its
+ * left (or starts a new one). This uses the fewest possible chains. Pens
+ * absent from the row are skipped.
+ *
+ * force_full_width is a workaround for a bug in mlterm; we need to
  * draw the entire first row even if the rightmost pixels are transparent,
  * otherwise the first row with non-transparent pixels will have
  * garbage rendered in it */
 static gchar *
 build_sixel_row_ansi (const ChafaSixelCanvas *scanvas, const SixelRow *srow, gchar *p, gboolean force_full_width)
 {
-    gint pen = 0;
-    gboolean need_cr = FALSE;
-    gboolean need_cr_next = FALSE;
-    const SixelData *sdata = srow->data;
+    gint transparent_index = chafa_palette_get_transparent_index (&scanvas->image->palette);
+    gint n_colors = chafa_palette_get_n_colors (&scanvas->image->palette);
     gint width = scanvas->width;
-
-    do
+    gint16 pens_by_x [256];
+    gint16 chain_next [256];
+    gint16 chain_first [256];
+    gint16 chain_last [256];
+    gint chain_end [256];
+    gint empty_pen = transparent_index == 0 ? 1 : 0;
+    gint n_pens = 0, n_chains = 0;
+    SixelEmitter em;
+    gint pen, x = 0;
+    gint i, j;
+
+    /* Insertion sort of the pens present by first column. Events are added
+     * in column order, so this is mostly in order already. */
+    for (pen = 0; pen < n_colors; pen++)
     {
-        guint64 expanded_pen;
-        gboolean need_pen = TRUE;
-        gchar rep_schar;
-        gint n_reps;
-        gint i;
+        gint first_x;
 
-        if (pen == chafa_palette_get_transparent_index (&scanvas->image->palette))
+        if (pen == transparent_index || srow->first_event [pen] < 0)
             continue;
 
-        /* Assign pen value to each of lower six bytes */
-        expanded_pen = pen;
-        expanded_pen |= expanded_pen << 8;
-        expanded_pen |= expanded_pen << 16;
-        expanded_pen |= expanded_pen << 16;
+        first_x = srow->events [srow->first_event [pen]].x;
 
-        rep_schar = 0;
-        n_reps = 0;
-
-        for (i = 0; i < width; )
-        {
-            gint step = MIN (FILTER_BANK_WIDTH, width - i);
-            gchar schar;
+        for (i = n_pens; i > 0
+             && srow->events [srow->first_event [pens_by_x [i - 1]]].x > first_x; i--)
+            pens_by_x [i] = pens_by_x [i - 1];
 
-            /* Skip over FILTER_BANK_WIDTH sixels at once if possible */
+        pens_by_x [i] = pen;
+        n_pens++;
+    }
 
-            if (!filter_get (srow, pen, i / FILTER_BANK_WIDTH))
-            {
-                if (rep_schar != '?' && rep_schar != 0)
-                {
-                    if (need_cr)
-                    {
-                        *(p++) = '$';
-                        need_cr = FALSE;
-                    }
-                    if (need_pen)
-                    {
-                        p = format_pen (pen, p);
-                        need_pen = FALSE;
-                    }
-
-                    p = format_schar_reps (rep_schar, n_reps, p);
-                    need_cr_next = TRUE;
-                    n_reps = 0;
-                }
-
-                rep_schar = '?';
-                n_reps += step;
-                i += step;
-                continue;
-            }
+    for (i = 0; i < n_pens; i++)
+    {
+        gint first_x, best = -1;
 
-            /* The pen appears in this bank; iterate over sixels */
+        pen = pens_by_x [i];
+        first_x = srow->events [srow->first_event [pen]].x;
 
-            for ( ; step > 0; step--, i++)
-            {
-                schar = sixel_data_to_schar (&sdata [i], expanded_pen);
-
-                if (schar == rep_schar)
-                {
-                    n_reps++;
-                }
-                else if (rep_schar == 0)
-                {
-                    rep_schar = schar;
-                    n_reps = 1;
-                }
-                else
-                {
-                    if (need_cr)
-                    {
-                        *(p++) = '$';
-                        need_cr = FALSE;
-                    }
-                    if (need_pen)
-                    {
-                        p = format_pen (pen, p);
-                        need_pen = FALSE;
-                    }
-
-                    p = format_schar_reps (rep_schar, n_reps, p);
-                    need_cr_next = TRUE;
-
-                    rep_schar = schar;
-                    n_reps = 1;
-                }
-            }
+        for (j = 0; j < n_chains; j++)
+        {
+            if (chain_end [j] <= first_x
+                && (best < 0 || chain_end [j] > chain_end [best]))
+                best = j;
         }
 
-        if (rep_schar != '?' || force_full_width)
+        if (best < 0)
         {
-            if (need_cr)
-            {
-                *(p++) = '$';
-                need_cr = FALSE;
-            }
-            if (need_pen)
-            {
-                p = format_pen (pen, p);
-                need_pen = FALSE;
-            }
+            best = n_chains++;
+            chain_first [best] = pen;
+        }
+        else
+        {
+            chain_next [chain_last [best]] = pen;
+        }
+
+        chain_last [best] = pen;
+        chain_next [pen] = -1;
+        chain_end [best] = srow->events [srow->last_event [pen]].x + 1;
+    }
 
-            p = format_schar_reps (rep_schar, n_reps, p);
-            need_cr_next = TRUE;
+    em.p = p;
+    em.need_cr = FALSE;
+
+    for (i = 0; i < n_chains; i++)
+    {
+        x = 0;
 
-            /* Only need to do this for a single pen */
-            force_full_width = FALSE;
+        for (pen = chain_first [i]; pen >= 0; pen = chain_next [pen])
+            x = emit_pen (&em, srow, pen, x);
+
+        em.need_cr = TRUE;
+    }
+
+    /* Any pen will do for an empty row */
+    if (force_full_width && x < width
+        && (n_chains > 0 || empty_pen < n_colors))
+    {
+        if (n_chains == 0)
+        {
+            em.need_pen = TRUE;
+            em.pen = empty_pen;
         }
 
-        need_cr = need_cr_next;
+        em.rep_schar = '?';
+        em.n_reps = width - x;
+        emitter_flush (&em);
     }
-    while (++pen < chafa_palette_get_n_colors (&scanvas->image->palette));
 
+    p = em.p;
     *(p++) = '-';
     return p;
 }
 
+/* The first band is always drawn, since skipping it would bring back the
+ * mlterm bug worked around in build_sixel_row_ansi () */
+static gboolean
+band_is_unchanged (const BuildSixelsCtx *ctx, gint first_row)
+{
+    const ChafaIndexedImage *image = ctx->sixel_canvas->image;
+    gsize ofs = (gsize) image->rowstride * first_row;
+
+    return ctx->prev_pixels
+        && first_row > 0
+        && !memcmp (image->pixels + ofs, ctx->prev_pixels + ofs,
+                    (gsize) image->rowstride * SIXEL_CELL_HEIGHT);
+}
+
 static void
 build_sixel_row_worker (ChafaBatchInfo *batch, const BuildSixelsCtx *ctx)
 {
     SixelRow srow;
+    ChafaScratchMark mark;
     gchar *sixel_ansi, *p;
     gint n_sixel_rows;
     gint i;
 
     n_sixel_rows = (batch->n_rows + SIXEL_CELL_HEIGHT - 1) / SIXEL_CELL_HEIGHT;
-    srow.data = g_malloc (sizeof (SixelData) * ctx->sixel_canvas->width);
-    chafa_bitfield_init (&srow.filter_bits, ((ctx->sixel_canvas->width + FILTER_BANK_WIDTH - 1) / FILTER_BANK_WIDTH) * 256);
+    chafa_scratch_mark (&mark);
+    srow.events = chafa_scratch_new (SixelEvent, ctx->sixel_canvas->width * SIXEL_CELL_HEIGHT);
+
+    /* The output is handed to build_sixel_row_post (), which may run on
+     * another thread, so it can't be scratch memory */
 
     sixel_ansi = p = g_malloc (256 * (ctx->sixel_canvas->width + 5) * n_sixel_rows + 1);
 
     for (i = 0; i < n_sixel_rows; i++)
     {
+        /* Unchanged bands are sent empty. We ask the terminal to keep the
+         * background (P2=1), so what's on screen there stays. */
+        if (band_is_unchanged (ctx, batch->first_row + i * SIXEL_CELL_HEIGHT))
+        {
+            *(p++) = '-';
+            continue;
+        }
+
         fetch_sixel_row (&srow,
                          ctx->sixel_canvas->image->pixels
-                         + ctx->sixel_canvas->image->width * (batch->first_row + i * SIXEL_CELL_HEIGHT),
-                         ctx->sixel_canvas->image->width);
+                         + ctx->sixel_canvas->image->rowstride * (batch->first_row + i * SIXEL_CELL_HEIGHT),
+                         ctx->sixel_canvas->image->width,
+                         ctx->sixel_canvas->image->rowstride);
         p = build_sixel_row_ansi (ctx->sixel_canvas, &srow, p,
                                   (i == 0) || (i == n_sixel_rows - 1)
                                   ? TRUE : FALSE);
-        chafa_bitfield_clear (&srow.filter_bits);
     }
 
     batch->ret_p = sixel_ansi;
     batch->ret_n = p - sixel_ansi;
 
-    chafa_bitfield_deinit (&srow.filter_bits);
-    g_free (srow.data);
+    chafa_scratch_release (&mark);
 }
 
 static void
 build_sixel_row_post (ChafaBatchInfo *batch, BuildSixelsCtx *ctx)
 {
-    g_string_append_len (ctx->out_str, batch->ret_p, batch->ret_n);
+    /* Bands arrive in order, so each one can be passed on right away */
+    chafa_string_sink_append_len (ctx->sink, batch->ret_p, batch->ret_n);
     g_free (batch->ret_p);
 }
 
@@ -443,22 +562,121 @@ build_sixel_palette (ChafaSixelCanvas *sixel_canvas, GString *out_str)
     g_string_append_len (out_str, str, p - str);
 }
 
+/* If skip_unchanged is set, the terminal is assumed to still be showing
+ * what this canvas emitted last, at the same position. Bands that didn't
+ * change since then are left out, as long as the palette is the same. */
 void
-chafa_sixel_canvas_build_ansi (ChafaSixelCanvas *sixel_canvas, GString *out_str)
+chafa_sixel_canvas_build_ansi (ChafaSixelCanvas *sixel_canvas, ChafaStringSink *sink,
+                               gboolean skip_unchanged)
 {
+    ChafaIndexedImage *image = sixel_canvas->image;
+    gsize n_pixels = (gsize) image->rowstride * image->height;
     BuildSixelsCtx ctx;
 
     g_assert (sixel_canvas->image->height % SIXEL_CELL_HEIGHT == 0);
 
     ctx.sixel_canvas = sixel_canvas;
-    ctx.out_str = out_str;
+    ctx.sink = sink;
+    ctx.prev_pixels = skip_unchanged ? sixel_canvas->emitted_pixels : NULL;
+
+    /* Terminals keep color registers between images, so an unchanged
+     * palette can be left out */
+    if (!sixel_canvas->reuse_palette
+        || !sixel_canvas->have_emitted_palette
+        || sixel_canvas->emitted_palette_serial != sixel_canvas->image->palette_serial)
+    {
+        build_sixel_palette (sixel_canvas, sink->gs);
+        sixel_canvas->emitted_palette_serial = sixel_canvas->image->palette_serial;
+        sixel_canvas->have_emitted_palette = TRUE;
 
-    build_sixel_palette (sixel_canvas, out_str);
+        /* Pens now have new colors, so everything must be redrawn */
+        ctx.prev_pixels = NULL;
+    }
 
     chafa_process_batches (&ctx,
+                           "build-sixel",
                            (GFunc) build_sixel_row_worker,
                            (GFunc) build_sixel_row_post,
                            sixel_canvas->image->height,
                            chafa_get_n_actual_threads (),
                            SIXEL_CELL_HEIGHT);
+
+    if (sixel_canvas->reuse_palette)
+    {
+        if (!sixel_canvas->emitted_pixels)
+            sixel_canvas->emitted_pixels = g_malloc (n_pixels);
+        memcpy (sixel_canvas->emitted_pixels, image->pixels, n_pixels);
+    }
+}
+
+/* Draws and encodes an image a few bands at a time, passing the sixel data
+ * for each group of bands to the sink as soon as it's ready. Neither the
+ * scaled image nor the indexed one is ever held in full, so memory use
+ * doesn't grow with the image height. The output is the same as that of
+ * chafa_sixel_canvas_build_ansi () on a canvas drawn without palette
+ * reuse, except that a dynamic palette is generated from a downscaled
+ * copy of the image. If fixed_palette is set, palette is used as-is. */
+void
+chafa_sixel_canvas_stream_pixels (gint width, gint height,
+                                  ChafaColorSpace color_space,
+                                  const ChafaPalette *palette,
+                                  gboolean fixed_palette,
+                                  const ChafaDither *dither,
+                                  const gint *cancel_flag,
+                                  ChafaPixelType src_pixel_type,
+                                  gconstpointer src_pixels,
+                                  gint src_width, gint src_height, gint src_rowstride,
+                                  ChafaStringSink *sink)
+{
+    ChafaSixelCanvas *sixel_canvas;
+    BuildSixelsCtx ctx;
+    gint band_height;
+
+    g_return_if_fail (src_pixel_type < CHAFA_PIXEL_MAX);
+    g_return_if_fail (src_pixels != NULL);
+
+    if (width <= 0 || height <= 0 || src_width <= 0 || src_height <= 0)
+        return;
+
+    band_height = SIXEL_CELL_HEIGHT * STREAM_BANDS_PER_THREAD * chafa_get_n_actual_threads ();
+    band_height = MIN (band_height, round_up_to_multiple_of (height, SIXEL_CELL_HEIGHT));
+
+    /* The canvas is only as tall as a group of bands */
+    sixel_canvas = chafa_sixel_canvas_new (width, band_height, color_space, palette, dither);
+    chafa_sixel_canvas_set_cancel_flag (sixel_canvas, cancel_flag);
+    if (fixed_palette)
+        chafa_sixel_canvas_set_fixed_palette (sixel_canvas, palette);
+
+    chafa_indexed_image_begin_stream (sixel_canvas->image,
+                                      color_space,
+                                      src_pixel_type,
+                                      src_pixels,
+                                      src_width, src_height, src_rowstride,
+                                      width, height);
+
+    build_sixel_palette (sixel_canvas, sink->gs);
+    chafa_string_sink_flush (sink);
+
+    ctx.sixel_canvas = sixel_canvas;
+    ctx.sink = sink;
+    ctx.prev_pixels = NULL;
+
+    while (!sink->failed)
+    {
+        gint n_rows = chafa_indexed_image_draw_next_band (sixel_canvas->image);
+
+        if (n_rows == 0)
+            break;
+
+        chafa_process_batches (&ctx,
+                               "build-sixel",
+                               (GFunc) build_sixel_row_worker,
+                               (GFunc) build_sixel_row_post,
+                               round_up_to_multiple_of (n_rows, SIXEL_CELL_HEIGHT),
+                               chafa_get_n_actual_threads (),
+                               SIXEL_CELL_HEIGHT);
+    }
+
+    chafa_indexed_image_end_stream (sixel_canvas->image);
+    chafa_sixel_canvas_destroy (sixel_canvas);
 }
@@ -21,6 +21,7 @@
 #define __CHAFA_SIXEL_CANVAS_H__
 
 #include "chafa.h"
+#include "internal/chafa-string-util.h"
 
 G_BEGIN_DECLS
 
@@ -29,6 +30,16 @@ typedef struct
     gint width, height;
     ChafaColorSpace color_space;
     ChafaIndexedImage *image;
+
+    /* With palette reuse, the palette is only emitted when it changed
+     * since the last build */
+    guint reuse_palette : 1;
+    guint have_emitted_palette : 1;
+    guint emitted_palette_serial;
+
+    /* Also with palette reuse, a copy of the pixels as last emitted, so
+     * bands that didn't change can be skipped in the next build */
+    guint8 *emitted_pixels;
 }
 ChafaSixelCanvas;
 
@@ -37,11 +48,26 @@ ChafaSixelCanvas *chafa_sixel_canvas_new (gint width, gint height,
                                           const ChafaPalette *palette,
                                           const ChafaDither *dither);
 void chafa_sixel_canvas_destroy (ChafaSixelCanvas *sixel_canvas);
+void chafa_sixel_canvas_set_palette (ChafaSixelCanvas *sixel_canvas, const ChafaPalette *palette);
+void chafa_sixel_canvas_set_fixed_palette (ChafaSixelCanvas *sixel_canvas, const ChafaPalette *palette);
+void chafa_sixel_canvas_set_palette_reuse (ChafaSixelCanvas *sixel_canvas, gboolean reuse_palette);
+void chafa_sixel_canvas_set_cancel_flag (ChafaSixelCanvas *sixel_canvas, const gint *cancel_flag);
 
 void chafa_sixel_canvas_draw_all_pixels (ChafaSixelCanvas *sixel_canvas, ChafaPixelType src_pixel_type,
                                          gconstpointer src_pixels,
                                          gint src_width, gint src_height, gint src_rowstride);
-void chafa_sixel_canvas_build_ansi (ChafaSixelCanvas *sixel_canvas, GString *out_str);
+void chafa_sixel_canvas_build_ansi (ChafaSixelCanvas *sixel_canvas, ChafaStringSink *sink,
+                                    gboolean skip_unchanged);
+void chafa_sixel_canvas_stream_pixels (gint width, gint height,
+                                       ChafaColorSpace color_space,
+                                       const ChafaPalette *palette,
+                                       gboolean fixed_palette,
+                                       const ChafaDither *dither,
+                                       const gint *cancel_flag,
+                                       ChafaPixelType src_pixel_type,
+                                       gconstpointer src_pixels,
+                                       gint src_width, gint src_height, gint src_rowstride,
+                                       ChafaStringSink *sink);
 
 G_END_DECLS
 
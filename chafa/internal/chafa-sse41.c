@@ -23,8 +23,10 @@
 #include "chafa.h"
 #include "internal/chafa-private.h"
 
+/* Stops early and returns a partial sum once the error reaches max_error */
 gint
-calc_error_sse41 (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov)
+calc_error_sse41 (const ChafaPixel *pixels, const ChafaColorPair *color_pair, const guint8 *cov,
+                  gint max_error)
 {
     const guint32 *u32p0 = (const guint32 *) pixels;
     const guint32 *u32p1 = (const guint32 *) color_pair->colors;
@@ -39,10 +41,75 @@ calc_error_sse41 (const ChafaPixel *pixels, const ChafaColorPair *color_pair, co
         t0 = _mm_cvtepu8_epi32 (_mm_cvtsi32_si128 (u32p0 [i]));
         t1 = _mm_cvtepu8_epi32 (_mm_cvtsi32_si128 (u32p1 [cov [i]]));
 
-        t = t0 - t1;
+        t = _mm_sub_epi32 (t0, t1);
         t = _mm_mullo_epi32 (t, t);
-        err4 += t;
+        err4 = _mm_add_epi32 (err4, t);
+
+        /* The alpha lane isn't part of the error */
+        if ((i & 15) == 15 && e [0] + e [1] + e [2] >= max_error)
+            break;
     }
 
     return e [0] + e [1] + e [2];
 }
+
+/* Base64 encoding after Wojciech Muła and Daniel Lemire, "Faster Base64
+ * Encoding and Decoding Using AVX2 Instructions". Each iteration turns 12
+ * input bytes into 16 characters. */
+
+static inline __m128i
+base64_reshuffle (__m128i in)
+{
+    __m128i t0, t1, t2, t3;
+
+    /* Spread each 3-byte group over a 32-bit lane as bytes [1 0 2 1] */
+    in = _mm_shuffle_epi8 (in, _mm_set_epi8 (10, 11, 9, 10, 7, 8, 6, 7,
+                                             4, 5, 3, 4, 1, 2, 0, 1));
+
+    /* Move the four 6-bit fields of each lane into their own bytes */
+    t0 = _mm_and_si128 (in, _mm_set1_epi32 (0x0fc0fc00));
+    t1 = _mm_mulhi_epu16 (t0, _mm_set1_epi32 (0x04000040));
+    t2 = _mm_and_si128 (in, _mm_set1_epi32 (0x003f03f0));
+    t3 = _mm_mullo_epi16 (t2, _mm_set1_epi32 (0x01000010));
+
+    return _mm_or_si128 (t1, t3);
+}
+
+static inline __m128i
+base64_translate (__m128i in)
+{
+    const __m128i offsets = _mm_setr_epi8 ('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                           '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                           '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                           '/' - 63, 'A', 0, 0);
+    __m128i r, less;
+
+    /* Map 0..51 to 0, 52..61 to 1..10, 62 to 11 and 63 to 12, then
+     * split off 0..25 as 13. The result indexes the offset to add. */
+    r = _mm_subs_epu8 (in, _mm_set1_epi8 (51));
+    less = _mm_cmpgt_epi8 (_mm_set1_epi8 (26), in);
+    r = _mm_or_si128 (r, _mm_and_si128 (less, _mm_set1_epi8 (13)));
+
+    return _mm_add_epi8 (_mm_shuffle_epi8 (offsets, r), in);
+}
+
+gsize
+chafa_base64_encode_sse41 (gchar *out, const guint8 *in, gsize in_len)
+{
+    const guint8 *p = in;
+
+    /* Loads are 16 bytes wide, but only 12 bytes are consumed */
+    while (in_len - (p - in) >= 16)
+    {
+        __m128i v;
+
+        v = _mm_loadu_si128 ((const __m128i *) p);
+        v = base64_translate (base64_reshuffle (v));
+        _mm_storeu_si128 ((__m128i *) out, v);
+
+        p += 12;
+        out += 16;
+    }
+
+    return p - in;
+}
@@ -0,0 +1,47 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2019-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <time.h>
+#include <glib.h>
+
+#include "internal/chafa-stage-time.h"
+
+static gint64
+get_cpu_time_us (void)
+{
+    return (gint64) clock () * G_GINT64_CONSTANT (1000000) / CLOCKS_PER_SEC;
+}
+
+void
+chafa_stage_time_begin (ChafaStageTime *start_out)
+{
+    start_out->wall_us = g_get_monotonic_time ();
+    start_out->cpu_us = get_cpu_time_us ();
+}
+
+/* Adds the time elapsed since start to accum. CPU time is counted for all
+ * threads in the process, so it exceeds wall time when workers are busy. */
+void
+chafa_stage_time_end (const ChafaStageTime *start, ChafaStageTime *accum)
+{
+    accum->wall_us += g_get_monotonic_time () - start->wall_us;
+    accum->cpu_us += get_cpu_time_us () - start->cpu_us;
+}
@@ -143,3 +143,32 @@ chafa_format_dec_u16_hex (char *dest, guint16 arg)
     *(dest++) = format_hex_digit (arg & 0xf);
     return dest;
 }
+
+void
+chafa_string_sink_flush (ChafaStringSink *sink)
+{
+    if (!sink->sink_func || sink->gs->len == 0)
+        return;
+
+    if (!sink->failed
+        && !sink->sink_func (sink->gs->str, sink->gs->len, sink->sink_data))
+        sink->failed = TRUE;
+
+    g_string_truncate (sink->gs, 0);
+}
+
+void
+chafa_string_sink_append_len (ChafaStringSink *sink, const gchar *data, gsize len)
+{
+    if (!sink->sink_func)
+    {
+        g_string_append_len (sink->gs, data, len);
+        return;
+    }
+
+    chafa_string_sink_flush (sink);
+
+    if (!sink->failed && len > 0
+        && !sink->sink_func (data, len, sink->sink_data))
+        sink->failed = TRUE;
+}
@@ -27,6 +27,26 @@ G_BEGIN_DECLS
 
 extern const char chafa_ascii_dec_u8 [256] [4];
 
+/* Output buffer for the printers. If sink_func is set, each call to
+ * chafa_string_sink_flush () passes the accumulated output on to it and
+ * empties the buffer, so a full frame never has to be held in memory. */
+typedef struct
+{
+    GString *gs;
+    gboolean (*sink_func) (const gchar *data, gsize len, gpointer user_data);
+    gpointer sink_data;
+
+    /* Set when sink_func fails; further output is discarded */
+    gboolean failed;
+}
+ChafaStringSink;
+
+void chafa_string_sink_flush (ChafaStringSink *sink);
+
+/* Appends data and flushes. With a sink_func, data is passed on directly
+ * instead of being copied into the buffer first. */
+void chafa_string_sink_append_len (ChafaStringSink *sink, const gchar *data, gsize len);
+
 /* Will overwrite 4 bytes starting at dest. Returns a pointer to the first
  * byte after the formatted ASCII decimal number (dest + 1..3). */
 static inline gchar *
@@ -44,6 +64,54 @@ gchar *chafa_format_dec_uint_0_to_9999 (char *dest, guint arg);
  * byte after the formatted ASCII hexadecimal number (dest + 4). */
 gchar *chafa_format_dec_u16_hex (char *dest, guint16 arg);
 
+/* Encodes c as UTF-8 into the bytes of *packed_out, in memory order, so it
+ * can be written out with a single 4-byte store. Returns the length (1..4).
+ * Unlike g_unichar_to_utf8 (), this doesn't handle code points beyond the
+ * Unicode range. */
+static inline gint
+chafa_unichar_to_utf8_packed (gunichar c, guint32 *packed_out)
+{
+    guint8 b [4] = { 0 };
+    gint len;
+
+    if (c < 0x80)
+    {
+        b [0] = c;
+        len = 1;
+    }
+    else if (c < 0x800)
+    {
+        b [0] = 0xc0 | (c >> 6);
+        b [1] = 0x80 | (c & 0x3f);
+        len = 2;
+    }
+    else if (c < 0x10000)
+    {
+        b [0] = 0xe0 | (c >> 12);
+        b [1] = 0x80 | ((c >> 6) & 0x3f);
+        b [2] = 0x80 | (c & 0x3f);
+        len = 3;
+    }
+    else
+    {
+        b [0] = 0xf0 | ((c >> 18) & 0x07);
+        b [1] = 0x80 | ((c >> 12) & 0x3f);
+        b [2] = 0x80 | ((c >> 6) & 0x3f);
+        b [3] = 0x80 | (c & 0x3f);
+        len = 4;
+    }
+
+    memcpy (packed_out, b, 4);
+    return len;
+}
+
+/* Length in bytes of c encoded as UTF-8 */
+static inline gint
+chafa_unichar_utf8_len (gunichar c)
+{
+    return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+}
+
 G_END_DECLS
 
 #endif /* __CHAFA_STRING_UTIL_H__ */
@@ -0,0 +1,145 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include "chafa.h"
+#include "internal/chafa-symbol-tags.h"
+
+typedef struct
+{
+    gunichar first, last;
+}
+UnicharRange;
+
+/* Ranges we treat as ambiguous-width in addition to the ones defined by
+ * GLib. For instance: VTE, although spacing correctly, has many glyphs
+ * extending well outside their cells resulting in ugly overlapping. */
+static const UnicharRange ambiguous_ranges [] =
+{
+    {  0x00ad,  0x00ad },  /* Soft hyphen */
+    {  0x2196,  0x21ff },  /* Arrows (most) */
+
+    {  0x222c,  0x2237 },  /* Mathematical ops (some) */
+    {  0x2245,  0x2269 },  /* Mathematical ops (some) */
+    {  0x226d,  0x2279 },  /* Mathematical ops (some) */
+    {  0x2295,  0x22af },  /* Mathematical ops (some) */
+    {  0x22bf,  0x22bf },  /* Mathematical ops (some) */
+    {  0x22c8,  0x22ff },  /* Mathematical ops (some) */
+
+    {  0x2300,  0x23ff },  /* Technical */
+    {  0x2460,  0x24ff },  /* Enclosed alphanumerics */
+    {  0x25a0,  0x25ff },  /* Geometric */
+    {  0x2700,  0x27bf },  /* Dingbats */
+    {  0x27c0,  0x27e5 },  /* Miscellaneous mathematical symbols A (most) */
+    {  0x27f0,  0x27ff },  /* Supplemental arrows A */
+    {  0x2900,  0x297f },  /* Supplemental arrows B */
+    {  0x2980,  0x29ff },  /* Miscellaneous mathematical symbols B */
+    {  0x2b00,  0x2bff },  /* Miscellaneous symbols and arrows */
+    { 0x1f100, 0x1f1ff },  /* Enclosed alphanumeric supplement */
+
+    { 0, 0 }
+};
+
+/* Emojis of various kinds; usually multicolored. We have no control over
+ * the foreground colors of these, and they may render poorly for other
+ * reasons (e.g. too wide). */
+static const UnicharRange emoji_ranges [] =
+{
+    {  0x2600,  0x26ff },  /* Miscellaneous symbols */
+    { 0x1f000, 0x1fb3b },  /* Emojis first part */
+    { 0x1fbcb, 0x1ffff },  /* Emojis second part, the gap is legacy computing */
+
+    /* This symbol usually prints fine, but we don't want it randomly
+     * popping up in our output anyway. So we add it to the "ugly" category,
+     * which is excluded from "all". */
+    {  0x534d,  0x534d },
+
+    { 0, 0 }
+};
+
+static const UnicharRange meta_ranges [] =
+{
+    /* Arabic tatweel -- RTL but it's a modifier and not formally part
+     * of a script, so can't simply be excluded on that basis in
+     * ChafaSymbolMap::char_is_selected() */
+    {  0x0640, 0x0640 },
+
+    /* Ideographic description characters. These convert poorly to our
+     * internal format. */
+    {  0x2ff0, 0x2fff },
+
+    { 0, 0 }
+};
+
+/* ranges must be terminated by zero first, last */
+static gboolean
+unichar_is_in_ranges (gunichar c, const UnicharRange *ranges)
+{
+    for ( ; ranges->first != 0 || ranges->last != 0; ranges++)
+    {
+        g_assert (ranges->first <= ranges->last);
+
+        if (c >= ranges->first && c <= ranges->last)
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+ChafaSymbolTags
+chafa_get_default_tags_for_char (gunichar c)
+{
+    ChafaSymbolTags tags = CHAFA_SYMBOL_TAG_NONE;
+
+    if (g_unichar_iswide (c))
+        tags |= CHAFA_SYMBOL_TAG_WIDE;
+    else if (g_unichar_iswide_cjk (c))
+        tags |= CHAFA_SYMBOL_TAG_AMBIGUOUS;
+
+    if (g_unichar_ismark (c)
+        || g_unichar_iszerowidth (c)
+        || unichar_is_in_ranges (c, ambiguous_ranges))
+        tags |= CHAFA_SYMBOL_TAG_AMBIGUOUS;
+
+    if (unichar_is_in_ranges (c, emoji_ranges)
+        || unichar_is_in_ranges (c, meta_ranges))
+        tags |= CHAFA_SYMBOL_TAG_UGLY;
+
+    if (c <= 0x7f)
+        tags |= CHAFA_SYMBOL_TAG_ASCII;
+    else if (c >= 0x2300 && c <= 0x23ff)
+        tags |= CHAFA_SYMBOL_TAG_TECHNICAL;
+    else if (c >= 0x25a0 && c <= 0x25ff)
+        tags |= CHAFA_SYMBOL_TAG_GEOMETRIC;
+    else if (c >= 0x2800 && c <= 0x28ff)
+        tags |= CHAFA_SYMBOL_TAG_BRAILLE;
+    else if (c >= 0x1fb00 && c <= 0x1fb3b)
+        tags |= CHAFA_SYMBOL_TAG_SEXTANT;
+
+    if (g_unichar_isalpha (c))
+        tags |= CHAFA_SYMBOL_TAG_ALPHA;
+    if (g_unichar_isdigit (c))
+        tags |= CHAFA_SYMBOL_TAG_DIGIT;
+
+    if (!(tags & CHAFA_SYMBOL_TAG_WIDE))
+        tags |= CHAFA_SYMBOL_TAG_NARROW;
+
+    return tags;
+}
@@ -0,0 +1,359 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2018-2022 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+/* Build-time helper that turns the ASCII-art symbol outlines into the const
+ * tables in chafa-symbols-generated.h. This way, the library does no
+ * per-glyph work at startup and the tables can live in read-only pages
+ * shared between processes. */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <string.h>  /* memset, strlen */
+#include <stdlib.h>  /* qsort */
+#include "chafa.h"
+#include "internal/chafa-symbol-tags.h"
+
+#define CHAFA_SYMBOL_OUTLINE_8X8(x) x
+#define CHAFA_SYMBOL_OUTLINE_16X8(x) x
+
+#define N_PIXELS (CHAFA_SYMBOL_WIDTH_PIXELS * CHAFA_SYMBOL_HEIGHT_PIXELS)
+
+typedef struct
+{
+    ChafaSymbolTags sc;
+    gunichar c;
+    const gchar *outline;
+}
+ChafaSymbolDef;
+
+typedef struct
+{
+    ChafaSymbolTags sc;
+    gunichar c;
+    gchar coverage [N_PIXELS];
+    gint fg_weight, bg_weight;
+    guint64 bitmap;
+    gint popcount;
+}
+GenSymbol;
+
+typedef struct
+{
+    gunichar c;
+    ChafaSymbolTags sc;
+}
+GenTags;
+
+static const ChafaSymbolDef symbol_defs [] =
+{
+#include "chafa-symbols-ascii.h"
+#include "chafa-symbols-latin.h"
+#include "chafa-symbols-block.h"
+#include "chafa-symbols-kana.h"
+#include "chafa-symbols-misc-narrow.h"
+    { 0, 0, NULL }
+};
+
+static ChafaSymbolTags
+get_tags_for_def (const ChafaSymbolDef *def)
+{
+    /* FIXME: g_unichar_iswide_cjk() will erroneously mark many of our
+     * builtin symbols as ambiguous. Find a better way to deal with it. */
+    return def->sc | (chafa_get_default_tags_for_char (def->c) & ~CHAFA_SYMBOL_TAG_AMBIGUOUS);
+}
+
+static void
+finish_symbol (GenSymbol *sym)
+{
+    gint i;
+
+    sym->fg_weight = 0;
+    sym->bg_weight = 0;
+    sym->bitmap = 0;
+    sym->popcount = 0;
+
+    for (i = 0; i < N_PIXELS; i++)
+    {
+        guchar p = sym->coverage [i];
+
+        sym->fg_weight += p;
+        sym->bg_weight += 1 - p;
+        sym->bitmap = (sym->bitmap << 1) | p;
+        sym->popcount += p;
+    }
+}
+
+static void
+outline_to_coverage (const gchar *outline, gchar *coverage_out, gint rowstride)
+{
+    gint x, y;
+
+    for (y = 0; y < CHAFA_SYMBOL_HEIGHT_PIXELS; y++)
+    {
+        for (x = 0; x < CHAFA_SYMBOL_WIDTH_PIXELS; x++)
+        {
+            gchar p = outline [y * rowstride + x];
+
+            if (p != ' ' && p != 'X')
+            {
+                fprintf (stderr, "Bad outline character '%c'.\n", p);
+                exit (1);
+            }
+
+            coverage_out [y * CHAFA_SYMBOL_WIDTH_PIXELS + x] = (p == 'X');
+        }
+    }
+}
+
+static void
+def_to_symbol (const ChafaSymbolDef *def, GenSymbol *sym, gint x_ofs, gint rowstride)
+{
+    sym->c = def->c;
+    sym->sc = get_tags_for_def (def);
+    outline_to_coverage (def->outline + x_ofs, sym->coverage, rowstride);
+    finish_symbol (sym);
+}
+
+static void
+gen_braille_sym (gchar *cov, guint8 val)
+{
+    memset (cov, 0, N_PIXELS);
+
+    cov [1] = cov [2] = (val & 1);
+    cov [5] = cov [6] = ((val >> 3) & 1);
+    cov += CHAFA_SYMBOL_WIDTH_PIXELS * 2;
+
+    cov [1] = cov [2] = ((val >> 1) & 1);
+    cov [5] = cov [6] = ((val >> 4) & 1);
+    cov += CHAFA_SYMBOL_WIDTH_PIXELS * 2;
+
+    cov [1] = cov [2] = ((val >> 2) & 1);
+    cov [5] = cov [6] = ((val >> 5) & 1);
+    cov += CHAFA_SYMBOL_WIDTH_PIXELS * 2;
+
+    cov [1] = cov [2] = ((val >> 6) & 1);
+    cov [5] = cov [6] = ((val >> 7) & 1);
+}
+
+static GenSymbol *
+generate_braille_syms (GenSymbol *sym)
+{
+    gunichar c;
+
+    /* Braille 2x4 range */
+
+    for (c = 0x2800; c < 0x2900; c++, sym++)
+    {
+        sym->sc = CHAFA_SYMBOL_TAG_BRAILLE;
+        sym->c = c;
+        gen_braille_sym (sym->coverage, c - 0x2800);
+        finish_symbol (sym);
+    }
+
+    return sym;
+}
+
+static void
+gen_sextant_sym (gchar *cov, guint8 val)
+{
+    gint x, y;
+
+    memset (cov, 0, N_PIXELS);
+
+    for (y = 0; y < 3; y++)
+    {
+        for (x = 0; x < 2; x++)
+        {
+            gint bit = y * 2 + x;
+
+            if (val & (1 << bit))
+            {
+                gint u, v;
+
+                for (v = 0; v < 3; v++)
+                {
+                    for (u = 0; u < 4; u++)
+                    {
+                        gint row = y * 3 + v;
+                        if (row > 3)
+                            row--;
+
+                        cov [(row * 8) + x * 4 + u] = 1;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static GenSymbol *
+generate_sextant_syms (GenSymbol *sym)
+{
+    gunichar c;
+
+    /* Teletext sextant/2x3 mosaic range */
+
+    for (c = 0x1fb00; c < 0x1fb3b; c++, sym++)
+    {
+        gint bitmap;
+
+        sym->sc = CHAFA_SYMBOL_TAG_LEGACY | CHAFA_SYMBOL_TAG_SEXTANT;
+        sym->c = c;
+
+        bitmap = c - 0x1fb00 + 1;
+        if (bitmap > 20) bitmap++;
+        if (bitmap > 41) bitmap++;
+
+        gen_sextant_sym (sym->coverage, bitmap);
+        finish_symbol (sym);
+    }
+
+    return sym;
+}
+
+static gint
+compare_tags (gconstpointer a, gconstpointer b)
+{
+    const GenTags *ta = a;
+    const GenTags *tb = b;
+
+    return ta->c < tb->c ? -1 : ta->c > tb->c ? 1 : 0;
+}
+
+static void
+print_coverage (const GenSymbol *sym)
+{
+    gint i;
+
+    printf ("    { ");
+    for (i = 0; i < N_PIXELS; i++)
+        printf ("%d%s", sym->coverage [i], i < N_PIXELS - 1 ? "," : "");
+    printf (" },\n");
+}
+
+static void
+print_symbol (const GenSymbol *sym, gint cov_index)
+{
+    printf ("    { (ChafaSymbolTags) 0x%08x, 0x%05x, (gchar *) symbol_coverage [%d], %d, %d, "
+            "G_GUINT64_CONSTANT (0x%016" G_GINT64_MODIFIER "x), %d }",
+            (guint) sym->sc, (guint) sym->c, cov_index, sym->fg_weight, sym->bg_weight,
+            sym->bitmap, sym->popcount);
+}
+
+int
+main (G_GNUC_UNUSED int argc, G_GNUC_UNUSED char *argv [])
+{
+    GenSymbol *syms, *syms2, *sym;
+    GenTags *tags;
+    gint n_syms, n_syms2, n_tags;
+    gint i, j;
+
+    syms = g_new0 (GenSymbol, G_N_ELEMENTS (symbol_defs) + 0x100 + 0x3b);
+    syms2 = g_new0 (GenSymbol, G_N_ELEMENTS (symbol_defs) * 2);
+    tags = g_new0 (GenTags, G_N_ELEMENTS (symbol_defs));
+
+    for (i = 0, sym = syms, n_syms2 = 0; symbol_defs [i].c; i++)
+    {
+        const ChafaSymbolDef *def = &symbol_defs [i];
+        gint outline_len = strlen (def->outline);
+
+        if (outline_len != N_PIXELS && outline_len != N_PIXELS * 2)
+        {
+            fprintf (stderr, "Bad outline length for U+%04x.\n", (guint) def->c);
+            return 1;
+        }
+
+        if (outline_len == N_PIXELS && !g_unichar_iswide (def->c))
+        {
+            def_to_symbol (def, sym++, 0, CHAFA_SYMBOL_WIDTH_PIXELS);
+        }
+        else if (outline_len == N_PIXELS * 2 && g_unichar_iswide (def->c))
+        {
+            def_to_symbol (def, &syms2 [n_syms2 * 2], 0, CHAFA_SYMBOL_WIDTH_PIXELS * 2);
+            def_to_symbol (def, &syms2 [n_syms2 * 2 + 1],
+                           CHAFA_SYMBOL_WIDTH_PIXELS, CHAFA_SYMBOL_WIDTH_PIXELS * 2);
+            n_syms2++;
+        }
+    }
+
+    sym = generate_braille_syms (sym);
+    sym = generate_sextant_syms (sym);
+    n_syms = sym - syms;
+
+    /* Tags for chafa_get_tags_for_char (), sorted for binary search. The
+     * first definition of a code point takes precedence. */
+
+    for (i = 0; symbol_defs [i].c; i++)
+    {
+        tags [i].c = symbol_defs [i].c;
+        tags [i].sc = get_tags_for_def (&symbol_defs [i]);
+    }
+
+    n_tags = i;
+    qsort (tags, n_tags, sizeof (GenTags), compare_tags);
+
+    for (i = 1, j = 0; i < n_tags; i++)
+    {
+        if (tags [i].c != tags [j].c)
+            tags [++j] = tags [i];
+    }
+
+    n_tags = j + 1;
+
+    printf ("/* Generated by chafa-symbols-gen from the chafa-symbols-*.h outlines.\n"
+            " * Do not edit. */\n\n");
+
+    printf ("static const gchar symbol_coverage [%d] [CHAFA_SYMBOL_N_PIXELS] =\n{\n",
+            n_syms + n_syms2 * 2);
+    for (i = 0; i < n_syms; i++)
+        print_coverage (&syms [i]);
+    for (i = 0; i < n_syms2 * 2; i++)
+        print_coverage (&syms2 [i]);
+    printf ("};\n\n");
+
+    printf ("const ChafaSymbol chafa_symbols [%d] =\n{\n", n_syms + 1);
+    for (i = 0; i < n_syms; i++)
+    {
+        print_symbol (&syms [i], i);
+        printf (",\n");
+    }
+    printf ("    { 0, 0, NULL, 0, 0, 0, 0 }\n};\n\n");
+
+    printf ("const ChafaSymbol2 chafa_symbols2 [%d] =\n{\n", n_syms2 + 1);
+    for (i = 0; i < n_syms2; i++)
+    {
+        printf ("  {{\n");
+        print_symbol (&syms2 [i * 2], n_syms + i * 2);
+        printf (",\n");
+        print_symbol (&syms2 [i * 2 + 1], n_syms + i * 2 + 1);
+        printf ("\n  }},\n");
+    }
+    printf ("  {{ { 0, 0, NULL, 0, 0, 0, 0 }, { 0, 0, NULL, 0, 0, 0, 0 } }}\n};\n\n");
+
+    printf ("static const ChafaSymbolTagsDef builtin_tags [%d] =\n{\n", n_tags);
+    for (i = 0; i < n_tags; i++)
+        printf ("    { 0x%05x, (ChafaSymbolTags) 0x%08x },\n", (guint) tags [i].c, (guint) tags [i].sc);
+    printf ("};\n");
+
+    g_free (syms);
+    g_free (syms2);
+    g_free (tags);
+    return 0;
+}
@@ -0,0 +1,4021 @@
+/* Generated by chafa-symbols-gen from the chafa-symbols-*.h outlines.
+ * Do not edit. */
+
+static const gchar symbol_coverage [1381] [CHAFA_SYMBOL_N_PIXELS] =
+{
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,1,1,1,0,1,1,0,0,1,1,0,1,1,1,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,0,0,1,0,0,0,1,1,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,1,0,0,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,1,1,1,0,0,1,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,1,0,0,0,1,0,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,0,0,1,0,1,0,1,1,1,0,1,0,1,0,1,0,0,1,1,0,1,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,1,0,1,0,1,0,1,0,1,0,0,1,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,1,0,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,1,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,1,0,0,1,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,1,0,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,1,0,0,0,1,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,0,1,1,0,1,0,0,0,0,1,1,0,0,1,1,1,0,1,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,1,1,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,0,0,1,0,1,1,0,1,1,1,0,0,1,1,0,1,0,0,1,0,1,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,1,1,0,0,1,1,1,1,0,1,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,1,1,0,1,1,0,0,1,1,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,1,1,0,1,0,0,0,1,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0 },
+    { 0,1,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,1,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,0 },
+    { 1,1,1,1,0,0,0,0,0,1,1,0,0,0,1,0,1,1,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,1,1,0,1,0,0,0,1,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,1,1,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,1,0,1,0,0,1,1,1,0,0,1,1,1,0,0,1,0,1,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,1,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,0,1,1,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,0,0,1,0,1,0,0,1,1,1,1,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,0,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,0,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,1,0,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,1,1,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,1,1,0,0,1,1,1,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,1,0,0,1,0,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,1,1,1,1,0,0,1,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,1,0,0,1,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,1,0,0,1,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,0,1,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,1,1,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,0,1,1,1,1,0,1,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,1,0,1,0,1,1,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,0,0,1,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,0,0,0,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,1 },
+    { 0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,1,0,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,1,1,1,1,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0 },
+    { 0,0,0,0,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,1,1,1,0,1,0,0,1,0,1,0,0,1,1,1,0,0,1,0,1,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,1,1,0,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0 },
+    { 0,1,1,1,1,1,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,1,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0 },
+    { 0,0,1,1,0,0,1,0,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,1,1,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,1,0,1,1,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,1,0,1,1,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,1,0,1,0,1,0,1,0,1,0,0,1,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,1,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,1,1,0,1,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,1,0,1,1,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,1,1,0,0,1,1,1,1,0,1,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,1,0,0,1,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,1,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,0,1,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,1,1,0,1,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,0,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0 },
+    { 1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0 },
+    { 1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0 },
+    { 1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1 },
+    { 1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1 },
+    { 1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0 },
+    { 1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1 },
+    { 0,1,1,1,0,1,1,1,1,1,0,1,1,1,0,1,0,1,1,1,0,1,1,1,1,1,0,1,1,1,0,1,0,1,1,1,0,1,1,1,1,1,0,1,1,1,0,1,0,1,1,1,0,1,1,1,1,1,0,1,1,1,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,0,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1 },
+    { 0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0 },
+    { 1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1 },
+    { 0,1,0,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,1,0,0,1,0,0,1,0 },
+    { 1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1 },
+    { 0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1 },
+    { 0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0 },
+    { 0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,1,0,0,0,0,1,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,1,1,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,1,0,0,0,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,1,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,1,1,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,1,1,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,0,0,1,1,0,0,0,0,0,1,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,1,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,1,1,1 },
+    { 0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,1,1,0,0,1,0,0,0,0,1,1,0,0,1,0,0,0,1,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,1,1,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,1 },
+    { 0,0,0,1,0,1,1,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,1 },
+    { 0,0,0,0,1,0,1,0,0,0,0,1,0,1,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,0,1,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 1,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 1,0,0,0,1,0,1,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,1,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0 },
+    { 1,1,0,1,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,0,1,1,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,1,1,1,1,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1 },
+    { 1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,1,1,1,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1 },
+    { 1,1,1,0,0,0,0,0,1,1,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,1,0,0,1,1,0,0,0,1,0,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,0,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,1,0,0,1,0,0,1,1,0,0,0,1,0,0,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,1,1,1,0,0,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,1,0,1,0,0,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,1,0,0,1,0,0,0,0,1,0,1,1,0,0,0,1,1,0,0,1,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,1,1,0,0,1,0,0,0,1,1,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,0,1,1,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,1,1,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1 },
+    { 0,0,0,0,1,0,1,0,0,0,1,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,1,1,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1 },
+    { 0,0,0,0,1,1,1,1,0,0,1,0,0,1,1,0,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,0,1,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,1,1,0,0,0,1,1,1,0,1,0,0,0,0,1,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,0,1,1,0,0,0,1,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,1,1,0,0,1,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,0,0,1,1,0,0,0,1,0,0,0,1,0,0,0,1,1,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,0,1,1,0,0,1,0,1,0,0,0,0,0,0,1,0,0,1,0,0,1,1,0,0,0,1,1,0,0,0,1,0,0,0,1,0,0,0,1,1,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,1,0,0,1,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,1,1,0,0,1,0,0,0,1,1,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,0,1,1,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,1 },
+    { 0,0,0,0,1,0,1,0,1,1,1,1,0,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,1 },
+    { 0,0,0,0,1,1,1,1,1,1,1,1,0,1,1,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1 },
+    { 1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,0,0,1,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,1,0,0,0,0,0,1,0,0,1,0,1,0,1,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,1,1,1,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,1,0,0,0,0,0,1,1,0,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,1,1,1,0,0,1,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1 },
+    { 1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,1,1,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,1,1,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,1,1,1,1,0 },
+    { 1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,1,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,0,0,1,1,0,0,1,0,0,0,1,0,0,1,1,0,0,1,1,0,1,1,0,1,0,0,1,1,1,0,0,0 },
+    { 1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,1,1,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,0,1,0,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,0,0,1 },
+    { 1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,1,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,1,0,1,1,0,0,0,1,0,0,0,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,0,1,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,0,0,0,1,1,0,0,1,0,0,0,1,1,0,0,1,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1 },
+    { 1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1 },
+    { 0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,1,0,1,0,0,0,0,0,0,1,0,1,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,1,0,0,0,0,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0 },
+    { 0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,1,1,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,1,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,0,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0 },
+    { 0,0,0,1,1,0,1,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1 },
+    { 0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,0,0,1,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0 },
+    { 0,0,0,0,1,0,1,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,0,1,0,0,0,0,0,0,1,0,1,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0 },
+    { 1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1 },
+    { 1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,1,0,0,0,0,1,0,0,0,1,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,1,1,0,0,1,1,0,1,0,1,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1 },
+    { 0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,1,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,1,0,1,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,1,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,1,0,0,0,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,1,1,1 },
+    { 1,0,0,1,0,1,0,0,1,0,0,0,1,0,1,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,1,0,0,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1 },
+    { 0,0,0,1,1,1,1,0,1,0,0,0,1,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,0,0,0,1,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,1,0,1,1,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,1,0,1,1,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 },
+    { 0,0,0,1,0,1,1,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,1,0,1,0,0,0,1,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0 },
+    { 0,0,0,1,0,1,1,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,0 },
+    { 0,0,0,1,0,1,1,0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+    { 0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 },
+};
+
+const ChafaSymbol chafa_symbols [1020] =
+{
+    { (ChafaSymbolTags) 0x01024001, 0x00020, (gchar *) symbol_coverage [0], 0, 64, G_GUINT64_CONSTANT (0x0000000000000000), 0 },
+    { (ChafaSymbolTags) 0x01024000, 0x00021, (gchar *) symbol_coverage [1], 5, 59, G_GUINT64_CONSTANT (0x0010101010001000), 5 },
+    { (ChafaSymbolTags) 0x01024000, 0x00022, (gchar *) symbol_coverage [2], 4, 60, G_GUINT64_CONSTANT (0x2424000000000000), 4 },
+    { (ChafaSymbolTags) 0x01024000, 0x00023, (gchar *) symbol_coverage [3], 18, 46, G_GUINT64_CONSTANT (0x002424766e242400), 18 },
+    { (ChafaSymbolTags) 0x01024000, 0x00024, (gchar *) symbol_coverage [4], 23, 41, G_GUINT64_CONSTANT (0x10107c907e127c10), 23 },
+    { (ChafaSymbolTags) 0x01024000, 0x00025, (gchar *) symbol_coverage [5], 16, 48, G_GUINT64_CONSTANT (0x00646818302c4c00), 16 },
+    { (ChafaSymbolTags) 0x01024000, 0x00026, (gchar *) symbol_coverage [6], 16, 48, G_GUINT64_CONSTANT (0x001824384a443a00), 16 },
+    { (ChafaSymbolTags) 0x01024000, 0x00027, (gchar *) symbol_coverage [7], 2, 62, G_GUINT64_CONSTANT (0x1010000000000000), 2 },
+    { (ChafaSymbolTags) 0x01024000, 0x00028, (gchar *) symbol_coverage [8], 8, 56, G_GUINT64_CONSTANT (0x0018202020201800), 8 },
+    { (ChafaSymbolTags) 0x01024000, 0x00029, (gchar *) symbol_coverage [9], 8, 56, G_GUINT64_CONSTANT (0x0030080808083000), 8 },
+    { (ChafaSymbolTags) 0x01024000, 0x0002a, (gchar *) symbol_coverage [10], 12, 52, G_GUINT64_CONSTANT (0x0000003c7e240000), 12 },
+    { (ChafaSymbolTags) 0x01024000, 0x0002b, (gchar *) symbol_coverage [11], 7, 57, G_GUINT64_CONSTANT (0x000000107c100000), 7 },
+    { (ChafaSymbolTags) 0x01024000, 0x0002c, (gchar *) symbol_coverage [12], 2, 62, G_GUINT64_CONSTANT (0x0000000000001020), 2 },
+    { (ChafaSymbolTags) 0x01024000, 0x0002d, (gchar *) symbol_coverage [13], 6, 58, G_GUINT64_CONSTANT (0x000000007e000000), 6 },
+    { (ChafaSymbolTags) 0x01024000, 0x0002e, (gchar *) symbol_coverage [14], 1, 63, G_GUINT64_CONSTANT (0x0000000000001000), 1 },
+    { (ChafaSymbolTags) 0x01024000, 0x0002f, (gchar *) symbol_coverage [15], 8, 56, G_GUINT64_CONSTANT (0x0004081830204000), 8 },
+    { (ChafaSymbolTags) 0x01034000, 0x00030, (gchar *) symbol_coverage [16], 20, 44, G_GUINT64_CONSTANT (0x003c424e72423c00), 20 },
+    { (ChafaSymbolTags) 0x01034000, 0x00031, (gchar *) symbol_coverage [17], 12, 52, G_GUINT64_CONSTANT (0x0018280808083e00), 12 },
+    { (ChafaSymbolTags) 0x01034000, 0x00032, (gchar *) symbol_coverage [18], 17, 47, G_GUINT64_CONSTANT (0x003c420618207e00), 17 },
+    { (ChafaSymbolTags) 0x01034000, 0x00033, (gchar *) symbol_coverage [19], 16, 48, G_GUINT64_CONSTANT (0x003c421c02423c00), 16 },
+    { (ChafaSymbolTags) 0x01034000, 0x00034, (gchar *) symbol_coverage [20], 15, 49, G_GUINT64_CONSTANT (0x00061a227e020200), 15 },
+    { (ChafaSymbolTags) 0x01034000, 0x00035, (gchar *) symbol_coverage [21], 19, 45, G_GUINT64_CONSTANT (0x007e407c02423c00), 19 },
+    { (ChafaSymbolTags) 0x01034000, 0x00036, (gchar *) symbol_coverage [22], 18, 46, G_GUINT64_CONSTANT (0x003c407c42423c00), 18 },
+    { (ChafaSymbolTags) 0x01034000, 0x00037, (gchar *) symbol_coverage [23], 11, 53, G_GUINT64_CONSTANT (0x007e020408101000), 11 },
+    { (ChafaSymbolTags) 0x01034000, 0x00038, (gchar *) symbol_coverage [24], 18, 46, G_GUINT64_CONSTANT (0x003c423c42423c00), 18 },
+    { (ChafaSymbolTags) 0x01034000, 0x00039, (gchar *) symbol_coverage [25], 18, 46, G_GUINT64_CONSTANT (0x003c42423e023c00), 18 },
+    { (ChafaSymbolTags) 0x01024000, 0x0003a, (gchar *) symbol_coverage [26], 2, 62, G_GUINT64_CONSTANT (0x0000001000001000), 2 },
+    { (ChafaSymbolTags) 0x01024000, 0x0003b, (gchar *) symbol_coverage [27], 3, 61, G_GUINT64_CONSTANT (0x0000001000001020), 3 },
+    { (ChafaSymbolTags) 0x01024000, 0x0003c, (gchar *) symbol_coverage [28], 9, 55, G_GUINT64_CONSTANT (0x0004083060180400), 9 },
+    { (ChafaSymbolTags) 0x01024000, 0x0003d, (gchar *) symbol_coverage [29], 12, 52, G_GUINT64_CONSTANT (0x0000007e7e000000), 12 },
+    { (ChafaSymbolTags) 0x01024000, 0x0003e, (gchar *) symbol_coverage [30], 9, 55, G_GUINT64_CONSTANT (0x004020180c304000), 9 },
+    { (ChafaSymbolTags) 0x01024000, 0x0003f, (gchar *) symbol_coverage [31], 11, 53, G_GUINT64_CONSTANT (0x003c424608000800), 11 },
+    { (ChafaSymbolTags) 0x01024000, 0x00040, (gchar *) symbol_coverage [32], 25, 39, G_GUINT64_CONSTANT (0x007c82baa6987e00), 25 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00041, (gchar *) symbol_coverage [33], 18, 46, G_GUINT64_CONSTANT (0x003c42427e424200), 18 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00042, (gchar *) symbol_coverage [34], 21, 43, G_GUINT64_CONSTANT (0x007c427c42427c00), 21 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00043, (gchar *) symbol_coverage [35], 14, 50, G_GUINT64_CONSTANT (0x003c424040423c00), 14 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00044, (gchar *) symbol_coverage [36], 18, 46, G_GUINT64_CONSTANT (0x007c424242427c00), 18 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00045, (gchar *) symbol_coverage [37], 19, 45, G_GUINT64_CONSTANT (0x007e407840407e00), 19 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00046, (gchar *) symbol_coverage [38], 14, 50, G_GUINT64_CONSTANT (0x007e407840404000), 14 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00047, (gchar *) symbol_coverage [39], 17, 47, G_GUINT64_CONSTANT (0x003c42404e423c00), 17 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00048, (gchar *) symbol_coverage [40], 16, 48, G_GUINT64_CONSTANT (0x0042427e42424200), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00049, (gchar *) symbol_coverage [41], 10, 54, G_GUINT64_CONSTANT (0x0038101010103800), 10 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0004a, (gchar *) symbol_coverage [42], 11, 53, G_GUINT64_CONSTANT (0x000e040404443800), 11 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0004b, (gchar *) symbol_coverage [43], 16, 48, G_GUINT64_CONSTANT (0x00424c70704c4200), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0004c, (gchar *) symbol_coverage [44], 11, 53, G_GUINT64_CONSTANT (0x0040404040407e00), 11 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0004d, (gchar *) symbol_coverage [45], 17, 47, G_GUINT64_CONSTANT (0x00c6aa9282828200), 17 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0004e, (gchar *) symbol_coverage [46], 16, 48, G_GUINT64_CONSTANT (0x004262524a464200), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0004f, (gchar *) symbol_coverage [47], 16, 48, G_GUINT64_CONSTANT (0x003c424242423c00), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00050, (gchar *) symbol_coverage [48], 16, 48, G_GUINT64_CONSTANT (0x007c42427c404000), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00051, (gchar *) symbol_coverage [49], 17, 47, G_GUINT64_CONSTANT (0x003c424242423c02), 17 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00052, (gchar *) symbol_coverage [50], 19, 45, G_GUINT64_CONSTANT (0x007c42427c4c4200), 19 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00053, (gchar *) symbol_coverage [51], 18, 46, G_GUINT64_CONSTANT (0x003c427c02423c00), 18 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00054, (gchar *) symbol_coverage [52], 12, 52, G_GUINT64_CONSTANT (0x00fe101010101000), 12 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00055, (gchar *) symbol_coverage [53], 14, 50, G_GUINT64_CONSTANT (0x0042424242423c00), 14 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00056, (gchar *) symbol_coverage [54], 12, 52, G_GUINT64_CONSTANT (0x0042424224241800), 12 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00057, (gchar *) symbol_coverage [55], 17, 47, G_GUINT64_CONSTANT (0x0082828292aac600), 17 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00058, (gchar *) symbol_coverage [56], 12, 52, G_GUINT64_CONSTANT (0x0042241818244200), 12 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00059, (gchar *) symbol_coverage [57], 11, 53, G_GUINT64_CONSTANT (0x0082446c10101000), 11 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0005a, (gchar *) symbol_coverage [58], 18, 46, G_GUINT64_CONSTANT (0x007e020c30407e00), 18 },
+    { (ChafaSymbolTags) 0x01024000, 0x0005b, (gchar *) symbol_coverage [59], 10, 54, G_GUINT64_CONSTANT (0x0038202020203800), 10 },
+    { (ChafaSymbolTags) 0x01024000, 0x0005c, (gchar *) symbol_coverage [60], 8, 56, G_GUINT64_CONSTANT (0x0040203018080400), 8 },
+    { (ChafaSymbolTags) 0x01024000, 0x0005d, (gchar *) symbol_coverage [61], 10, 54, G_GUINT64_CONSTANT (0x0038080808083800), 10 },
+    { (ChafaSymbolTags) 0x01024000, 0x0005e, (gchar *) symbol_coverage [62], 5, 59, G_GUINT64_CONSTANT (0x1028440000000000), 5 },
+    { (ChafaSymbolTags) 0x01024000, 0x0005f, (gchar *) symbol_coverage [63], 6, 58, G_GUINT64_CONSTANT (0x000000000000007e), 6 },
+    { (ChafaSymbolTags) 0x01024000, 0x00060, (gchar *) symbol_coverage [64], 2, 62, G_GUINT64_CONSTANT (0x1800000000000000), 2 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00061, (gchar *) symbol_coverage [65], 18, 46, G_GUINT64_CONSTANT (0x0000003e7e423e00), 18 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00062, (gchar *) symbol_coverage [66], 17, 47, G_GUINT64_CONSTANT (0x0040407e42427c00), 17 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00063, (gchar *) symbol_coverage [67], 13, 51, G_GUINT64_CONSTANT (0x0000007e40423c00), 13 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00064, (gchar *) symbol_coverage [68], 17, 47, G_GUINT64_CONSTANT (0x0002027e42423e00), 17 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00065, (gchar *) symbol_coverage [69], 15, 49, G_GUINT64_CONSTANT (0x0000007e5a403c00), 15 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00066, (gchar *) symbol_coverage [70], 12, 52, G_GUINT64_CONSTANT (0x000e107c10101000), 12 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00067, (gchar *) symbol_coverage [71], 19, 45, G_GUINT64_CONSTANT (0x0000007e42423e3c), 19 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00068, (gchar *) symbol_coverage [72], 14, 50, G_GUINT64_CONSTANT (0x0040407e42424200), 14 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00069, (gchar *) symbol_coverage [73], 8, 56, G_GUINT64_CONSTANT (0x0010003010103800), 8 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0006a, (gchar *) symbol_coverage [74], 10, 54, G_GUINT64_CONSTANT (0x0004000c04044438), 10 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0006b, (gchar *) symbol_coverage [75], 14, 50, G_GUINT64_CONSTANT (0x0040404678484600), 14 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0006c, (gchar *) symbol_coverage [76], 9, 55, G_GUINT64_CONSTANT (0x0030101010103800), 9 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0006d, (gchar *) symbol_coverage [77], 16, 48, G_GUINT64_CONSTANT (0x000000fe92929200), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0006e, (gchar *) symbol_coverage [78], 12, 52, G_GUINT64_CONSTANT (0x0000007e42424200), 12 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0006f, (gchar *) symbol_coverage [79], 14, 50, G_GUINT64_CONSTANT (0x0000007e42423c00), 14 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00070, (gchar *) symbol_coverage [80], 16, 48, G_GUINT64_CONSTANT (0x0000007e42427c40), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00071, (gchar *) symbol_coverage [81], 16, 48, G_GUINT64_CONSTANT (0x0000007e42423e02), 16 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00072, (gchar *) symbol_coverage [82], 9, 55, G_GUINT64_CONSTANT (0x0000007e40404000), 9 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00073, (gchar *) symbol_coverage [83], 17, 47, G_GUINT64_CONSTANT (0x0000007e7c027c00), 17 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00074, (gchar *) symbol_coverage [84], 12, 52, G_GUINT64_CONSTANT (0x0010107c10100e00), 12 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00075, (gchar *) symbol_coverage [85], 11, 53, G_GUINT64_CONSTANT (0x0000004242423e00), 11 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00076, (gchar *) symbol_coverage [86], 10, 54, G_GUINT64_CONSTANT (0x0000004266241800), 10 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00077, (gchar *) symbol_coverage [87], 13, 51, G_GUINT64_CONSTANT (0x0000008292927c00), 13 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00078, (gchar *) symbol_coverage [88], 10, 54, G_GUINT64_CONSTANT (0x000000423c244200), 10 },
+    { (ChafaSymbolTags) 0x0102c000, 0x00079, (gchar *) symbol_coverage [89], 15, 49, G_GUINT64_CONSTANT (0x0000004242423e3c), 15 },
+    { (ChafaSymbolTags) 0x0102c000, 0x0007a, (gchar *) symbol_coverage [90], 16, 48, G_GUINT64_CONSTANT (0x0000007e0c307e00), 16 },
+    { (ChafaSymbolTags) 0x01024000, 0x0007b, (gchar *) symbol_coverage [91], 8, 56, G_GUINT64_CONSTANT (0x000c102010100c00), 8 },
+    { (ChafaSymbolTags) 0x01024000, 0x0007c, (gchar *) symbol_coverage [92], 6, 58, G_GUINT64_CONSTANT (0x0010101010101000), 6 },
+    { (ChafaSymbolTags) 0x01024000, 0x0007d, (gchar *) symbol_coverage [93], 8, 56, G_GUINT64_CONSTANT (0x0030080408083000), 8 },
+    { (ChafaSymbolTags) 0x01024000, 0x0007e, (gchar *) symbol_coverage [94], 7, 57, G_GUINT64_CONSTANT (0x629c000000000000), 7 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a1, (gchar *) symbol_coverage [95], 5, 59, G_GUINT64_CONSTANT (0x0010001010101000), 5 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a2, (gchar *) symbol_coverage [96], 19, 45, G_GUINT64_CONSTANT (0x000010fe90927c10), 19 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a3, (gchar *) symbol_coverage [97], 16, 48, G_GUINT64_CONSTANT (0x0018247820207e00), 16 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a4, (gchar *) symbol_coverage [98], 14, 50, G_GUINT64_CONSTANT (0x0000447c44384400), 14 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a5, (gchar *) symbol_coverage [99], 18, 46, G_GUINT64_CONSTANT (0x008244387c7c1000), 18 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a6, (gchar *) symbol_coverage [100], 5, 59, G_GUINT64_CONSTANT (0x0010101000101000), 5 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a7, (gchar *) symbol_coverage [101], 20, 44, G_GUINT64_CONSTANT (0x3844304c64184438), 20 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a8, (gchar *) symbol_coverage [102], 2, 62, G_GUINT64_CONSTANT (0x2400000000000000), 2 },
+    { (ChafaSymbolTags) 0x01020000, 0x000a9, (gchar *) symbol_coverage [103], 28, 36, G_GUINT64_CONSTANT (0x0000ffbda19d7e00), 28 },
+    { (ChafaSymbolTags) 0x01028000, 0x000aa, (gchar *) symbol_coverage [104], 15, 49, G_GUINT64_CONSTANT (0x380464387c000000), 15 },
+    { (ChafaSymbolTags) 0x01020000, 0x000ab, (gchar *) symbol_coverage [105], 14, 50, G_GUINT64_CONSTANT (0x00000036d86c1200), 14 },
+    { (ChafaSymbolTags) 0x01020000, 0x000ac, (gchar *) symbol_coverage [106], 7, 57, G_GUINT64_CONSTANT (0x0000007e02000000), 7 },
+    { (ChafaSymbolTags) 0x01020000, 0x000ae, (gchar *) symbol_coverage [107], 27, 37, G_GUINT64_CONSTANT (0x0000ffa5b9a57e00), 27 },
+    { (ChafaSymbolTags) 0x01020000, 0x000af, (gchar *) symbol_coverage [108], 4, 60, G_GUINT64_CONSTANT (0x3c00000000000000), 4 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b0, (gchar *) symbol_coverage [109], 6, 58, G_GUINT64_CONSTANT (0x1824180000000000), 6 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b1, (gchar *) symbol_coverage [110], 12, 52, G_GUINT64_CONSTANT (0x000000107c107c00), 12 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b2, (gchar *) symbol_coverage [111], 9, 55, G_GUINT64_CONSTANT (0x1824083c00000000), 9 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b3, (gchar *) symbol_coverage [112], 10, 54, G_GUINT64_CONSTANT (0x380c043c00000000), 10 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b4, (gchar *) symbol_coverage [113], 2, 62, G_GUINT64_CONSTANT (0x1800000000000000), 2 },
+    { (ChafaSymbolTags) 0x01028000, 0x000b5, (gchar *) symbol_coverage [114], 13, 51, G_GUINT64_CONSTANT (0x0000004242467a40), 13 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b6, (gchar *) symbol_coverage [115], 20, 44, G_GUINT64_CONSTANT (0x007e929272121200), 20 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b7, (gchar *) symbol_coverage [116], 2, 62, G_GUINT64_CONSTANT (0x0000001010000000), 2 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b8, (gchar *) symbol_coverage [117], 2, 62, G_GUINT64_CONSTANT (0x0000000000001020), 2 },
+    { (ChafaSymbolTags) 0x01020000, 0x000b9, (gchar *) symbol_coverage [118], 7, 57, G_GUINT64_CONSTANT (0x1030103800000000), 7 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ba, (gchar *) symbol_coverage [119], 15, 49, G_GUINT64_CONSTANT (0x384444387c000000), 15 },
+    { (ChafaSymbolTags) 0x01020000, 0x000bb, (gchar *) symbol_coverage [120], 14, 50, G_GUINT64_CONSTANT (0x000000d8366c9000), 14 },
+    { (ChafaSymbolTags) 0x01020000, 0x000bc, (gchar *) symbol_coverage [121], 19, 45, G_GUINT64_CONSTANT (0x60222418668a0e02), 19 },
+    { (ChafaSymbolTags) 0x01020000, 0x000bd, (gchar *) symbol_coverage [122], 20, 44, G_GUINT64_CONSTANT (0x602224186c92081e), 20 },
+    { (ChafaSymbolTags) 0x01020000, 0x000be, (gchar *) symbol_coverage [123], 24, 40, G_GUINT64_CONSTANT (0xf062e418668a0e02), 24 },
+    { (ChafaSymbolTags) 0x01020000, 0x000bf, (gchar *) symbol_coverage [124], 11, 53, G_GUINT64_CONSTANT (0x0010001062423c00), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c0, (gchar *) symbol_coverage [125], 21, 43, G_GUINT64_CONSTANT (0x383c42427e424200), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c1, (gchar *) symbol_coverage [126], 21, 43, G_GUINT64_CONSTANT (0x1c3c42427e424200), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c2, (gchar *) symbol_coverage [127], 22, 42, G_GUINT64_CONSTANT (0x3c3c42427e424200), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c3, (gchar *) symbol_coverage [128], 24, 40, G_GUINT64_CONSTANT (0x7e3c42427e424200), 24 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c4, (gchar *) symbol_coverage [129], 20, 44, G_GUINT64_CONSTANT (0x243c42427e424200), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c5, (gchar *) symbol_coverage [130], 22, 42, G_GUINT64_CONSTANT (0x3c3c42427e424200), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c6, (gchar *) symbol_coverage [131], 23, 41, G_GUINT64_CONSTANT (0x007e90fc90909e00), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c7, (gchar *) symbol_coverage [132], 15, 49, G_GUINT64_CONSTANT (0x003c424040423c20), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c8, (gchar *) symbol_coverage [133], 22, 42, G_GUINT64_CONSTANT (0x387e404078407e00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000c9, (gchar *) symbol_coverage [134], 22, 42, G_GUINT64_CONSTANT (0x1c7e404078407e00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ca, (gchar *) symbol_coverage [135], 23, 41, G_GUINT64_CONSTANT (0x3c7e404078407e00), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x000cb, (gchar *) symbol_coverage [136], 21, 43, G_GUINT64_CONSTANT (0x247e404078407e00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x000cc, (gchar *) symbol_coverage [137], 12, 52, G_GUINT64_CONSTANT (0x3038101010103800), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x000cd, (gchar *) symbol_coverage [138], 12, 52, G_GUINT64_CONSTANT (0x1838101010103800), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ce, (gchar *) symbol_coverage [139], 14, 50, G_GUINT64_CONSTANT (0x3c38101010103800), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x000cf, (gchar *) symbol_coverage [140], 12, 52, G_GUINT64_CONSTANT (0x4438101010103800), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d0, (gchar *) symbol_coverage [141], 21, 43, G_GUINT64_CONSTANT (0x007c42f242427c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d1, (gchar *) symbol_coverage [142], 22, 42, G_GUINT64_CONSTANT (0x7e4242724e424200), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d2, (gchar *) symbol_coverage [143], 19, 45, G_GUINT64_CONSTANT (0x383c424242423c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d3, (gchar *) symbol_coverage [144], 19, 45, G_GUINT64_CONSTANT (0x1c3c424242423c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d4, (gchar *) symbol_coverage [145], 20, 44, G_GUINT64_CONSTANT (0x3c3c424242423c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d5, (gchar *) symbol_coverage [146], 22, 42, G_GUINT64_CONSTANT (0x7e3c424242423c00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d6, (gchar *) symbol_coverage [147], 18, 46, G_GUINT64_CONSTANT (0x243c424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01020000, 0x000d7, (gchar *) symbol_coverage [148], 10, 54, G_GUINT64_CONSTANT (0x0000006618244200), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d8, (gchar *) symbol_coverage [149], 22, 42, G_GUINT64_CONSTANT (0x003c434e72c23c00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000d9, (gchar *) symbol_coverage [150], 17, 47, G_GUINT64_CONSTANT (0x3842424242423c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x000da, (gchar *) symbol_coverage [151], 17, 47, G_GUINT64_CONSTANT (0x1c42424242423c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x000db, (gchar *) symbol_coverage [152], 18, 46, G_GUINT64_CONSTANT (0x3c42424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x000dc, (gchar *) symbol_coverage [153], 16, 48, G_GUINT64_CONSTANT (0x2442424242423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x000dd, (gchar *) symbol_coverage [154], 14, 50, G_GUINT64_CONSTANT (0x1c82446c10101000), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x000de, (gchar *) symbol_coverage [155], 16, 48, G_GUINT64_CONSTANT (0x00407c42427c4000), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x000df, (gchar *) symbol_coverage [156], 19, 45, G_GUINT64_CONSTANT (0x0038447c42625c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e0, (gchar *) symbol_coverage [157], 20, 44, G_GUINT64_CONSTANT (0x0010083e7e423e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e1, (gchar *) symbol_coverage [158], 20, 44, G_GUINT64_CONSTANT (0x0008103e7e423e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e2, (gchar *) symbol_coverage [159], 20, 44, G_GUINT64_CONSTANT (0x0018003e7e423e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e3, (gchar *) symbol_coverage [160], 24, 40, G_GUINT64_CONSTANT (0x00324c3e7e423e00), 24 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e4, (gchar *) symbol_coverage [161], 20, 44, G_GUINT64_CONSTANT (0x0024003e7e423e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e5, (gchar *) symbol_coverage [162], 22, 42, G_GUINT64_CONSTANT (0x0018183e7e423e00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e6, (gchar *) symbol_coverage [163], 19, 45, G_GUINT64_CONSTANT (0x0000007e729e6c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e7, (gchar *) symbol_coverage [164], 14, 50, G_GUINT64_CONSTANT (0x0000007e40423c20), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e8, (gchar *) symbol_coverage [165], 17, 47, G_GUINT64_CONSTANT (0x0010087e5a403c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x000e9, (gchar *) symbol_coverage [166], 17, 47, G_GUINT64_CONSTANT (0x0008107e5a403c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ea, (gchar *) symbol_coverage [167], 17, 47, G_GUINT64_CONSTANT (0x0018007e5a403c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x000eb, (gchar *) symbol_coverage [168], 17, 47, G_GUINT64_CONSTANT (0x0024007e5a403c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ec, (gchar *) symbol_coverage [169], 9, 55, G_GUINT64_CONSTANT (0x0020103010103800), 9 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ed, (gchar *) symbol_coverage [170], 9, 55, G_GUINT64_CONSTANT (0x0008103010103800), 9 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ee, (gchar *) symbol_coverage [171], 11, 53, G_GUINT64_CONSTANT (0x0030483010103800), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ef, (gchar *) symbol_coverage [172], 9, 55, G_GUINT64_CONSTANT (0x0048003010103800), 9 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f0, (gchar *) symbol_coverage [173], 19, 45, G_GUINT64_CONSTANT (0x00282c7e42423c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f1, (gchar *) symbol_coverage [174], 18, 46, G_GUINT64_CONSTANT (0x00324c7e42424200), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f2, (gchar *) symbol_coverage [175], 16, 48, G_GUINT64_CONSTANT (0x0010087e42423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f3, (gchar *) symbol_coverage [176], 16, 48, G_GUINT64_CONSTANT (0x0008107e42423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f4, (gchar *) symbol_coverage [177], 16, 48, G_GUINT64_CONSTANT (0x0018007e42423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f5, (gchar *) symbol_coverage [178], 20, 44, G_GUINT64_CONSTANT (0x00324c7e42423c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f6, (gchar *) symbol_coverage [179], 16, 48, G_GUINT64_CONSTANT (0x0024007e42423c00), 16 },
+    { (ChafaSymbolTags) 0x01020000, 0x000f7, (gchar *) symbol_coverage [180], 8, 56, G_GUINT64_CONSTANT (0x000010107c100000), 8 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f8, (gchar *) symbol_coverage [181], 19, 45, G_GUINT64_CONSTANT (0x0000027e5a62bc00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x000f9, (gchar *) symbol_coverage [182], 13, 51, G_GUINT64_CONSTANT (0x0010084242423e00), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x000fa, (gchar *) symbol_coverage [183], 13, 51, G_GUINT64_CONSTANT (0x0008104242423e00), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x000fb, (gchar *) symbol_coverage [184], 15, 49, G_GUINT64_CONSTANT (0x0018244242423e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x000fc, (gchar *) symbol_coverage [185], 13, 51, G_GUINT64_CONSTANT (0x0024004242423e00), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x000fd, (gchar *) symbol_coverage [186], 17, 47, G_GUINT64_CONSTANT (0x0008104242423e3c), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x000fe, (gchar *) symbol_coverage [187], 18, 46, G_GUINT64_CONSTANT (0x0040407e42427c40), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x000ff, (gchar *) symbol_coverage [188], 17, 47, G_GUINT64_CONSTANT (0x0024004242423e3c), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x00100, (gchar *) symbol_coverage [189], 22, 42, G_GUINT64_CONSTANT (0x3c3c42427e424200), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x00101, (gchar *) symbol_coverage [190], 20, 44, G_GUINT64_CONSTANT (0x0000183e7e423e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00102, (gchar *) symbol_coverage [191], 21, 43, G_GUINT64_CONSTANT (0x2c3c42427e424200), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00103, (gchar *) symbol_coverage [192], 20, 44, G_GUINT64_CONSTANT (0x0024003e7e423e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00104, (gchar *) symbol_coverage [193], 21, 43, G_GUINT64_CONSTANT (0x003c42427e424207), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00105, (gchar *) symbol_coverage [194], 20, 44, G_GUINT64_CONSTANT (0x0000003e7e423e03), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00106, (gchar *) symbol_coverage [195], 17, 47, G_GUINT64_CONSTANT (0x1c3c424040423c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x00107, (gchar *) symbol_coverage [196], 14, 50, G_GUINT64_CONSTANT (0x0008007e40423c00), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x00108, (gchar *) symbol_coverage [197], 18, 46, G_GUINT64_CONSTANT (0x3c3c424040423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00109, (gchar *) symbol_coverage [198], 15, 49, G_GUINT64_CONSTANT (0x0018007e40423c00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x0010a, (gchar *) symbol_coverage [199], 15, 49, G_GUINT64_CONSTANT (0x103c424040423c00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x0010b, (gchar *) symbol_coverage [200], 14, 50, G_GUINT64_CONSTANT (0x0010007e40423c00), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x0010c, (gchar *) symbol_coverage [201], 18, 46, G_GUINT64_CONSTANT (0x3c3c424040423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0010d, (gchar *) symbol_coverage [202], 17, 47, G_GUINT64_CONSTANT (0x0024187e40423c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x0010e, (gchar *) symbol_coverage [203], 20, 44, G_GUINT64_CONSTANT (0x247c424242427c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x0010f, (gchar *) symbol_coverage [204], 21, 43, G_GUINT64_CONSTANT (0x241a027e42423e00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00110, (gchar *) symbol_coverage [205], 21, 43, G_GUINT64_CONSTANT (0x007c42f242427c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00111, (gchar *) symbol_coverage [206], 19, 45, G_GUINT64_CONSTANT (0x00020e7e42423e00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00112, (gchar *) symbol_coverage [207], 23, 41, G_GUINT64_CONSTANT (0x3c7e407840407e00), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x00113, (gchar *) symbol_coverage [208], 18, 46, G_GUINT64_CONSTANT (0x0000387e5a403c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00114, (gchar *) symbol_coverage [209], 23, 41, G_GUINT64_CONSTANT (0x3c7e407840407e00), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x00115, (gchar *) symbol_coverage [210], 19, 45, G_GUINT64_CONSTANT (0x0024187e5a403c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00116, (gchar *) symbol_coverage [211], 20, 44, G_GUINT64_CONSTANT (0x107e407840407e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00117, (gchar *) symbol_coverage [212], 16, 48, G_GUINT64_CONSTANT (0x0010007e5a403c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00118, (gchar *) symbol_coverage [213], 21, 43, G_GUINT64_CONSTANT (0x007e407840407e03), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00119, (gchar *) symbol_coverage [214], 17, 47, G_GUINT64_CONSTANT (0x0000007e5a403c06), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x0011a, (gchar *) symbol_coverage [215], 23, 41, G_GUINT64_CONSTANT (0x3c7e407840407e00), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x0011b, (gchar *) symbol_coverage [216], 19, 45, G_GUINT64_CONSTANT (0x0024187e5a403c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x0011c, (gchar *) symbol_coverage [217], 21, 43, G_GUINT64_CONSTANT (0x3c3c42404e423c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x0011d, (gchar *) symbol_coverage [218], 23, 41, G_GUINT64_CONSTANT (0x0018247e42423e3c), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x0011e, (gchar *) symbol_coverage [219], 21, 43, G_GUINT64_CONSTANT (0x3c3c42404e423c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x0011f, (gchar *) symbol_coverage [220], 23, 41, G_GUINT64_CONSTANT (0x0024187e42423e3c), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x00120, (gchar *) symbol_coverage [221], 18, 46, G_GUINT64_CONSTANT (0x103c42404e423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00121, (gchar *) symbol_coverage [222], 20, 44, G_GUINT64_CONSTANT (0x0008007e42423e3c), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00122, (gchar *) symbol_coverage [223], 18, 46, G_GUINT64_CONSTANT (0x003c42404e423c20), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00123, (gchar *) symbol_coverage [224], 21, 43, G_GUINT64_CONSTANT (0x0408007e42423e3c), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00124, (gchar *) symbol_coverage [225], 18, 46, G_GUINT64_CONSTANT (0x3c0042427e424200), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00125, (gchar *) symbol_coverage [226], 18, 46, G_GUINT64_CONSTANT (0x1e40407e42424200), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00126, (gchar *) symbol_coverage [227], 20, 44, G_GUINT64_CONSTANT (0x0042e77e42424200), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00127, (gchar *) symbol_coverage [228], 16, 48, G_GUINT64_CONSTANT (0x0040707e42424200), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00128, (gchar *) symbol_coverage [229], 13, 51, G_GUINT64_CONSTANT (0x7e00101010103800), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00129, (gchar *) symbol_coverage [230], 13, 51, G_GUINT64_CONSTANT (0x0036483010103800), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x0012a, (gchar *) symbol_coverage [231], 15, 49, G_GUINT64_CONSTANT (0x7c38101010103800), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x0012b, (gchar *) symbol_coverage [232], 10, 54, G_GUINT64_CONSTANT (0x0000383010103800), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x0012c, (gchar *) symbol_coverage [233], 14, 50, G_GUINT64_CONSTANT (0x3c38101010103800), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x0012d, (gchar *) symbol_coverage [234], 9, 55, G_GUINT64_CONSTANT (0x0048003010103800), 9 },
+    { (ChafaSymbolTags) 0x01028000, 0x0012e, (gchar *) symbol_coverage [235], 12, 52, G_GUINT64_CONSTANT (0x003810101010380c), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x0012f, (gchar *) symbol_coverage [236], 10, 54, G_GUINT64_CONSTANT (0x001000301010380c), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x00130, (gchar *) symbol_coverage [237], 11, 53, G_GUINT64_CONSTANT (0x1038101010103800), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x00131, (gchar *) symbol_coverage [238], 7, 57, G_GUINT64_CONSTANT (0x0000003010103800), 7 },
+    { (ChafaSymbolTags) 0x01028000, 0x00132, (gchar *) symbol_coverage [239], 20, 44, G_GUINT64_CONSTANT (0x00e742424252ec00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00133, (gchar *) symbol_coverage [240], 17, 47, G_GUINT64_CONSTANT (0x004200c64242f20c), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x00134, (gchar *) symbol_coverage [241], 12, 52, G_GUINT64_CONSTANT (0x0c12040404443800), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x00135, (gchar *) symbol_coverage [242], 13, 51, G_GUINT64_CONSTANT (0x000c120c04044438), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00136, (gchar *) symbol_coverage [243], 18, 46, G_GUINT64_CONSTANT (0x00424c70704c5220), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00137, (gchar *) symbol_coverage [244], 16, 48, G_GUINT64_CONSTANT (0x00404046784c5220), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00138, (gchar *) symbol_coverage [245], 12, 52, G_GUINT64_CONSTANT (0x00000046784c4200), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x00139, (gchar *) symbol_coverage [246], 12, 52, G_GUINT64_CONSTANT (0x6000404040407e00), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x0013a, (gchar *) symbol_coverage [247], 11, 53, G_GUINT64_CONSTANT (0x1830101010103800), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x0013b, (gchar *) symbol_coverage [248], 12, 52, G_GUINT64_CONSTANT (0x0040404040407e20), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x0013c, (gchar *) symbol_coverage [249], 10, 54, G_GUINT64_CONSTANT (0x0030101010103820), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x0013d, (gchar *) symbol_coverage [250], 15, 49, G_GUINT64_CONSTANT (0x2458404040407e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x0013e, (gchar *) symbol_coverage [251], 13, 51, G_GUINT64_CONSTANT (0x7830101010103800), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x0013f, (gchar *) symbol_coverage [252], 13, 51, G_GUINT64_CONSTANT (0x0040404444407e00), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00140, (gchar *) symbol_coverage [253], 11, 53, G_GUINT64_CONSTANT (0x0030101111103800), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x00141, (gchar *) symbol_coverage [254], 13, 51, G_GUINT64_CONSTANT (0x00404060c0407e00), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00142, (gchar *) symbol_coverage [255], 11, 53, G_GUINT64_CONSTANT (0x0030101830103800), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x00143, (gchar *) symbol_coverage [256], 19, 45, G_GUINT64_CONSTANT (0x1c4242724e424200), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00144, (gchar *) symbol_coverage [257], 13, 51, G_GUINT64_CONSTANT (0x0008007e42424200), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00145, (gchar *) symbol_coverage [258], 18, 46, G_GUINT64_CONSTANT (0x004242724e425220), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00146, (gchar *) symbol_coverage [259], 14, 50, G_GUINT64_CONSTANT (0x0000007e42425220), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x00147, (gchar *) symbol_coverage [260], 20, 44, G_GUINT64_CONSTANT (0x245a42724e424200), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00148, (gchar *) symbol_coverage [261], 16, 48, G_GUINT64_CONSTANT (0x0024187e42424200), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00149, (gchar *) symbol_coverage [262], 14, 50, G_GUINT64_CONSTANT (0x4040007e42424200), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x0014a, (gchar *) symbol_coverage [263], 18, 46, G_GUINT64_CONSTANT (0x004242724e42420c), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0014b, (gchar *) symbol_coverage [264], 14, 50, G_GUINT64_CONSTANT (0x0000007e4242420c), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x0014c, (gchar *) symbol_coverage [265], 20, 44, G_GUINT64_CONSTANT (0x3c3c424242423c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x0014d, (gchar *) symbol_coverage [266], 16, 48, G_GUINT64_CONSTANT (0x0000187e42423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0014e, (gchar *) symbol_coverage [267], 16, 48, G_GUINT64_CONSTANT (0x2418424242423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0014f, (gchar *) symbol_coverage [268], 18, 46, G_GUINT64_CONSTANT (0x0024187e42423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00150, (gchar *) symbol_coverage [269], 16, 48, G_GUINT64_CONSTANT (0x3600424242423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00151, (gchar *) symbol_coverage [270], 16, 48, G_GUINT64_CONSTANT (0x0012007e42423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00152, (gchar *) symbol_coverage [271], 22, 42, G_GUINT64_CONSTANT (0x007e909c90907e00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x00153, (gchar *) symbol_coverage [272], 20, 44, G_GUINT64_CONSTANT (0x000000fe9e907e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x00154, (gchar *) symbol_coverage [273], 22, 42, G_GUINT64_CONSTANT (0x1c7c42427c484600), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x00155, (gchar *) symbol_coverage [274], 10, 54, G_GUINT64_CONSTANT (0x0008007e40404000), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x00156, (gchar *) symbol_coverage [275], 21, 43, G_GUINT64_CONSTANT (0x007c42427c485620), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00157, (gchar *) symbol_coverage [276], 11, 53, G_GUINT64_CONSTANT (0x0000007e40406040), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x00158, (gchar *) symbol_coverage [277], 23, 41, G_GUINT64_CONSTANT (0x3c7c42427c484600), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x00159, (gchar *) symbol_coverage [278], 13, 51, G_GUINT64_CONSTANT (0x0024187e40404000), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x0015a, (gchar *) symbol_coverage [279], 20, 44, G_GUINT64_CONSTANT (0x183c42403e423c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x0015b, (gchar *) symbol_coverage [280], 19, 45, G_GUINT64_CONSTANT (0x0004087e7c027c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x0015c, (gchar *) symbol_coverage [281], 22, 42, G_GUINT64_CONSTANT (0x3c3c42403e423c00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x0015d, (gchar *) symbol_coverage [282], 21, 43, G_GUINT64_CONSTANT (0x0018247e7c027c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x0015e, (gchar *) symbol_coverage [283], 19, 45, G_GUINT64_CONSTANT (0x003c427c02423c20), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x0015f, (gchar *) symbol_coverage [284], 18, 46, G_GUINT64_CONSTANT (0x0000007e7c027c20), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00160, (gchar *) symbol_coverage [285], 22, 42, G_GUINT64_CONSTANT (0x3c3c42403e423c00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x00161, (gchar *) symbol_coverage [286], 21, 43, G_GUINT64_CONSTANT (0x0024187e7c027c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00162, (gchar *) symbol_coverage [287], 14, 50, G_GUINT64_CONSTANT (0x00fe101010101810), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x00163, (gchar *) symbol_coverage [288], 13, 51, G_GUINT64_CONSTANT (0x0010107c10100e08), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00164, (gchar *) symbol_coverage [289], 9, 55, G_GUINT64_CONSTANT (0x3c00101010101000), 9 },
+    { (ChafaSymbolTags) 0x01028000, 0x00165, (gchar *) symbol_coverage [290], 15, 49, G_GUINT64_CONSTANT (0x3c00107c10100e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x00166, (gchar *) symbol_coverage [291], 16, 48, G_GUINT64_CONSTANT (0x00fe107c10101000), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00167, (gchar *) symbol_coverage [292], 14, 50, G_GUINT64_CONSTANT (0x0010107c38100e00), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x00168, (gchar *) symbol_coverage [293], 18, 46, G_GUINT64_CONSTANT (0x324c424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00169, (gchar *) symbol_coverage [294], 16, 48, G_GUINT64_CONSTANT (0x00320c4242423e00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0016a, (gchar *) symbol_coverage [295], 18, 46, G_GUINT64_CONSTANT (0x3c42424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0016b, (gchar *) symbol_coverage [296], 15, 49, G_GUINT64_CONSTANT (0x00003c4242423e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x0016c, (gchar *) symbol_coverage [297], 18, 46, G_GUINT64_CONSTANT (0x245a424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0016d, (gchar *) symbol_coverage [298], 15, 49, G_GUINT64_CONSTANT (0x0024184242423e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x0016e, (gchar *) symbol_coverage [299], 18, 46, G_GUINT64_CONSTANT (0x3c18424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0016f, (gchar *) symbol_coverage [300], 15, 49, G_GUINT64_CONSTANT (0x0018184242423e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x00170, (gchar *) symbol_coverage [301], 16, 48, G_GUINT64_CONSTANT (0x3600424242423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00171, (gchar *) symbol_coverage [302], 15, 49, G_GUINT64_CONSTANT (0x0012244242423e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x00172, (gchar *) symbol_coverage [303], 16, 48, G_GUINT64_CONSTANT (0x0042424242423c06), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00173, (gchar *) symbol_coverage [304], 13, 51, G_GUINT64_CONSTANT (0x0000004242423e03), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00174, (gchar *) symbol_coverage [305], 19, 45, G_GUINT64_CONSTANT (0x3c00828292aac600), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00175, (gchar *) symbol_coverage [306], 17, 47, G_GUINT64_CONSTANT (0x0018248292927c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x00176, (gchar *) symbol_coverage [307], 12, 52, G_GUINT64_CONSTANT (0x3c00824428101000), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x00177, (gchar *) symbol_coverage [308], 19, 45, G_GUINT64_CONSTANT (0x0018244242423e3c), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00178, (gchar *) symbol_coverage [309], 10, 54, G_GUINT64_CONSTANT (0x4400824428101000), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x00179, (gchar *) symbol_coverage [310], 20, 44, G_GUINT64_CONSTANT (0x187e020c30407e00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x0017a, (gchar *) symbol_coverage [311], 17, 47, G_GUINT64_CONSTANT (0x0008107e18207e00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x0017b, (gchar *) symbol_coverage [312], 19, 45, G_GUINT64_CONSTANT (0x107e020c30407e00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x0017c, (gchar *) symbol_coverage [313], 16, 48, G_GUINT64_CONSTANT (0x0010007e18207e00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0017d, (gchar *) symbol_coverage [314], 22, 42, G_GUINT64_CONSTANT (0x3c7e020c30407e00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x0017e, (gchar *) symbol_coverage [315], 19, 45, G_GUINT64_CONSTANT (0x0024187e18207e00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x0017f, (gchar *) symbol_coverage [316], 8, 56, G_GUINT64_CONSTANT (0x000e101010101000), 8 },
+    { (ChafaSymbolTags) 0x01028000, 0x00186, (gchar *) symbol_coverage [317], 14, 50, G_GUINT64_CONSTANT (0x003c420202423c00), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x0018e, (gchar *) symbol_coverage [318], 19, 45, G_GUINT64_CONSTANT (0x007e021e02027e00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x0018f, (gchar *) symbol_coverage [319], 19, 45, G_GUINT64_CONSTANT (0x003c027e42423c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00190, (gchar *) symbol_coverage [320], 16, 48, G_GUINT64_CONSTANT (0x003c423840423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00192, (gchar *) symbol_coverage [321], 15, 49, G_GUINT64_CONSTANT (0x000c127c101010e0), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x0019d, (gchar *) symbol_coverage [322], 17, 47, G_GUINT64_CONSTANT (0x004242724e424280), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x0019e, (gchar *) symbol_coverage [323], 13, 51, G_GUINT64_CONSTANT (0x0000007e42424202), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x001b5, (gchar *) symbol_coverage [324], 22, 42, G_GUINT64_CONSTANT (0x007e047e30407e00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x001b6, (gchar *) symbol_coverage [325], 17, 47, G_GUINT64_CONSTANT (0x0000007e3c107e00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x001b7, (gchar *) symbol_coverage [326], 17, 47, G_GUINT64_CONSTANT (0x007e041c02423c00), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x001cd, (gchar *) symbol_coverage [327], 22, 42, G_GUINT64_CONSTANT (0x3c3c42427e424200), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x001ce, (gchar *) symbol_coverage [328], 22, 42, G_GUINT64_CONSTANT (0x0024183e7e423e00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x001cf, (gchar *) symbol_coverage [329], 14, 50, G_GUINT64_CONSTANT (0x3c38101010103800), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x001d0, (gchar *) symbol_coverage [330], 11, 53, G_GUINT64_CONSTANT (0x0048303010103800), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x001d1, (gchar *) symbol_coverage [331], 20, 44, G_GUINT64_CONSTANT (0x3c3c424242423c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x001d2, (gchar *) symbol_coverage [332], 16, 48, G_GUINT64_CONSTANT (0x0024007e42423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x001d3, (gchar *) symbol_coverage [333], 18, 46, G_GUINT64_CONSTANT (0x3c42424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x001d4, (gchar *) symbol_coverage [334], 15, 49, G_GUINT64_CONSTANT (0x0024184242423e00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e2, (gchar *) symbol_coverage [335], 28, 36, G_GUINT64_CONSTANT (0x7c7e90fc90909e00), 28 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e3, (gchar *) symbol_coverage [336], 20, 44, G_GUINT64_CONSTANT (0x0000187e7e906c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e4, (gchar *) symbol_coverage [337], 20, 44, G_GUINT64_CONSTANT (0x003c42404e4f3c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e5, (gchar *) symbol_coverage [338], 22, 42, G_GUINT64_CONSTANT (0x0000007e4f423e3c), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e6, (gchar *) symbol_coverage [339], 21, 43, G_GUINT64_CONSTANT (0x3c3c42404e423c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e7, (gchar *) symbol_coverage [340], 23, 41, G_GUINT64_CONSTANT (0x0024187e42423e3c), 23 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e8, (gchar *) symbol_coverage [341], 20, 44, G_GUINT64_CONSTANT (0x3c424c70704c4200), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x001e9, (gchar *) symbol_coverage [342], 18, 46, G_GUINT64_CONSTANT (0x3c404046784c4200), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x001ea, (gchar *) symbol_coverage [343], 18, 46, G_GUINT64_CONSTANT (0x003c424242423c06), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x001eb, (gchar *) symbol_coverage [344], 16, 48, G_GUINT64_CONSTANT (0x0000007e42423c06), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x001ec, (gchar *) symbol_coverage [345], 22, 42, G_GUINT64_CONSTANT (0x3c3c424242423c06), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x001ed, (gchar *) symbol_coverage [346], 19, 45, G_GUINT64_CONSTANT (0x0000387e42423c06), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x001ee, (gchar *) symbol_coverage [347], 19, 45, G_GUINT64_CONSTANT (0x1c3e041c02423c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x001ef, (gchar *) symbol_coverage [348], 20, 44, G_GUINT64_CONSTANT (0x0024187e041c027c), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x001f0, (gchar *) symbol_coverage [349], 11, 53, G_GUINT64_CONSTANT (0x0012000c04044438), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x001f4, (gchar *) symbol_coverage [350], 19, 45, G_GUINT64_CONSTANT (0x0c3c42404e423c00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x001f5, (gchar *) symbol_coverage [351], 21, 43, G_GUINT64_CONSTANT (0x0004087e42423e3c), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x001fc, (gchar *) symbol_coverage [352], 25, 39, G_GUINT64_CONSTANT (0x0c7e9090fc909e00), 25 },
+    { (ChafaSymbolTags) 0x01028000, 0x001fd, (gchar *) symbol_coverage [353], 20, 44, G_GUINT64_CONSTANT (0x0008107e7e906c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x001fe, (gchar *) symbol_coverage [354], 24, 40, G_GUINT64_CONSTANT (0x0c3c474a72c23c00), 24 },
+    { (ChafaSymbolTags) 0x01028000, 0x001ff, (gchar *) symbol_coverage [355], 21, 43, G_GUINT64_CONSTANT (0x0008127e5a62bc00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00218, (gchar *) symbol_coverage [356], 19, 45, G_GUINT64_CONSTANT (0x003c427c02423c20), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00219, (gchar *) symbol_coverage [357], 18, 46, G_GUINT64_CONSTANT (0x0000007e7c027c20), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0021a, (gchar *) symbol_coverage [358], 14, 50, G_GUINT64_CONSTANT (0x00fe101010101810), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x0021b, (gchar *) symbol_coverage [359], 13, 51, G_GUINT64_CONSTANT (0x0010107c10100e04), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00232, (gchar *) symbol_coverage [360], 16, 48, G_GUINT64_CONSTANT (0x7c82446c10101000), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00233, (gchar *) symbol_coverage [361], 19, 45, G_GUINT64_CONSTANT (0x00003c4242423e3c), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00237, (gchar *) symbol_coverage [362], 9, 55, G_GUINT64_CONSTANT (0x0000000c04044438), 9 },
+    { (ChafaSymbolTags) 0x01028000, 0x00254, (gchar *) symbol_coverage [363], 13, 51, G_GUINT64_CONSTANT (0x0000007e02423c00), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00258, (gchar *) symbol_coverage [364], 15, 49, G_GUINT64_CONSTANT (0x0000007e5a023c00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x00259, (gchar *) symbol_coverage [365], 16, 48, G_GUINT64_CONSTANT (0x0000003e7a423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0025b, (gchar *) symbol_coverage [366], 16, 48, G_GUINT64_CONSTANT (0x0000007e78423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00272, (gchar *) symbol_coverage [367], 13, 51, G_GUINT64_CONSTANT (0x0000007e42424280), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x00292, (gchar *) symbol_coverage [368], 16, 48, G_GUINT64_CONSTANT (0x0000007e041c027c), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x002bb, (gchar *) symbol_coverage [369], 2, 62, G_GUINT64_CONSTANT (0x0810000000000000), 2 },
+    { (ChafaSymbolTags) 0x01028000, 0x002bc, (gchar *) symbol_coverage [370], 2, 62, G_GUINT64_CONSTANT (0x0810000000000000), 2 },
+    { (ChafaSymbolTags) 0x01028000, 0x002bd, (gchar *) symbol_coverage [371], 2, 62, G_GUINT64_CONSTANT (0x1008000000000000), 2 },
+    { (ChafaSymbolTags) 0x01028000, 0x002c6, (gchar *) symbol_coverage [372], 4, 60, G_GUINT64_CONSTANT (0x1824000000000000), 4 },
+    { (ChafaSymbolTags) 0x01028000, 0x002c7, (gchar *) symbol_coverage [373], 4, 60, G_GUINT64_CONSTANT (0x2418000000000000), 4 },
+    { (ChafaSymbolTags) 0x01020000, 0x002d8, (gchar *) symbol_coverage [374], 4, 60, G_GUINT64_CONSTANT (0x2418000000000000), 4 },
+    { (ChafaSymbolTags) 0x01020000, 0x002d9, (gchar *) symbol_coverage [375], 1, 63, G_GUINT64_CONSTANT (0x1000000000000000), 1 },
+    { (ChafaSymbolTags) 0x01020000, 0x002db, (gchar *) symbol_coverage [376], 4, 60, G_GUINT64_CONSTANT (0x000000000000040e), 4 },
+    { (ChafaSymbolTags) 0x01020000, 0x002dc, (gchar *) symbol_coverage [377], 6, 58, G_GUINT64_CONSTANT (0x324c000000000000), 6 },
+    { (ChafaSymbolTags) 0x01020000, 0x002dd, (gchar *) symbol_coverage [378], 4, 60, G_GUINT64_CONSTANT (0x3600000000000000), 4 },
+    { (ChafaSymbolTags) 0x01020000, 0x00384, (gchar *) symbol_coverage [379], 2, 62, G_GUINT64_CONSTANT (0xc000000000000000), 2 },
+    { (ChafaSymbolTags) 0x01020000, 0x00385, (gchar *) symbol_coverage [380], 6, 58, G_GUINT64_CONSTANT (0x0834240000000000), 6 },
+    { (ChafaSymbolTags) 0x01028000, 0x00386, (gchar *) symbol_coverage [381], 20, 44, G_GUINT64_CONSTANT (0xc03c42427e424200), 20 },
+    { (ChafaSymbolTags) 0x01020000, 0x00387, (gchar *) symbol_coverage [382], 1, 63, G_GUINT64_CONSTANT (0x0000001000000000), 1 },
+    { (ChafaSymbolTags) 0x01028000, 0x00388, (gchar *) symbol_coverage [383], 21, 43, G_GUINT64_CONSTANT (0xc07e407840407e00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00389, (gchar *) symbol_coverage [384], 18, 46, G_GUINT64_CONSTANT (0xc042427e42424200), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0038a, (gchar *) symbol_coverage [385], 12, 52, G_GUINT64_CONSTANT (0xc038101010103800), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x0038c, (gchar *) symbol_coverage [386], 18, 46, G_GUINT64_CONSTANT (0xc03c424242423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x0038e, (gchar *) symbol_coverage [387], 10, 54, G_GUINT64_CONSTANT (0xc000824428101000), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x0038f, (gchar *) symbol_coverage [388], 18, 46, G_GUINT64_CONSTANT (0xc03c424242246600), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00390, (gchar *) symbol_coverage [389], 10, 54, G_GUINT64_CONSTANT (0x1068003010100c00), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x00391, (gchar *) symbol_coverage [390], 18, 46, G_GUINT64_CONSTANT (0x003c42427e424200), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00392, (gchar *) symbol_coverage [391], 21, 43, G_GUINT64_CONSTANT (0x007c427c42427c00), 21 },
+    { (ChafaSymbolTags) 0x01028000, 0x00393, (gchar *) symbol_coverage [392], 11, 53, G_GUINT64_CONSTANT (0x007e404040404000), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x00394, (gchar *) symbol_coverage [393], 18, 46, G_GUINT64_CONSTANT (0x0010286c4482fe00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00395, (gchar *) symbol_coverage [394], 19, 45, G_GUINT64_CONSTANT (0x007e407840407e00), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x00396, (gchar *) symbol_coverage [395], 18, 46, G_GUINT64_CONSTANT (0x007e020c30407e00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00397, (gchar *) symbol_coverage [396], 16, 48, G_GUINT64_CONSTANT (0x0042427e42424200), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x00398, (gchar *) symbol_coverage [397], 18, 46, G_GUINT64_CONSTANT (0x003c425a42423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x00399, (gchar *) symbol_coverage [398], 10, 54, G_GUINT64_CONSTANT (0x0038101010103800), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x0039a, (gchar *) symbol_coverage [399], 16, 48, G_GUINT64_CONSTANT (0x00424c70704c4200), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0039b, (gchar *) symbol_coverage [400], 13, 51, G_GUINT64_CONSTANT (0x0010286c44828200), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x0039c, (gchar *) symbol_coverage [401], 17, 47, G_GUINT64_CONSTANT (0x00c6aa9282828200), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x0039d, (gchar *) symbol_coverage [402], 16, 48, G_GUINT64_CONSTANT (0x004242724e424200), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0039e, (gchar *) symbol_coverage [403], 16, 48, G_GUINT64_CONSTANT (0x007e003c00007e00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x0039f, (gchar *) symbol_coverage [404], 16, 48, G_GUINT64_CONSTANT (0x003c424242423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a0, (gchar *) symbol_coverage [405], 16, 48, G_GUINT64_CONSTANT (0x007e424242424200), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a1, (gchar *) symbol_coverage [406], 16, 48, G_GUINT64_CONSTANT (0x007c42427c404000), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a3, (gchar *) symbol_coverage [407], 18, 46, G_GUINT64_CONSTANT (0x007e201818207e00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a4, (gchar *) symbol_coverage [408], 12, 52, G_GUINT64_CONSTANT (0x00fe101010101000), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a5, (gchar *) symbol_coverage [409], 11, 53, G_GUINT64_CONSTANT (0x0082446c10101000), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a6, (gchar *) symbol_coverage [410], 22, 42, G_GUINT64_CONSTANT (0x007c929292927c00), 22 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a7, (gchar *) symbol_coverage [411], 12, 52, G_GUINT64_CONSTANT (0x0042241818244200), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a8, (gchar *) symbol_coverage [412], 18, 46, G_GUINT64_CONSTANT (0x00929292927c1000), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x003a9, (gchar *) symbol_coverage [413], 16, 48, G_GUINT64_CONSTANT (0x003c424242246600), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003aa, (gchar *) symbol_coverage [414], 12, 52, G_GUINT64_CONSTANT (0x4438101010103800), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003ab, (gchar *) symbol_coverage [415], 10, 54, G_GUINT64_CONSTANT (0x4400824428101000), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x003ac, (gchar *) symbol_coverage [416], 16, 48, G_GUINT64_CONSTANT (0x0008107e44443a00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003ad, (gchar *) symbol_coverage [417], 18, 46, G_GUINT64_CONSTANT (0x0008107e78423c00), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x003ae, (gchar *) symbol_coverage [418], 15, 49, G_GUINT64_CONSTANT (0x0008107e42424202), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x003af, (gchar *) symbol_coverage [419], 8, 56, G_GUINT64_CONSTANT (0x0008103010100c00), 8 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b0, (gchar *) symbol_coverage [420], 16, 48, G_GUINT64_CONSTANT (0x0834244242423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b1, (gchar *) symbol_coverage [421], 14, 50, G_GUINT64_CONSTANT (0x0000007e44443a00), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b2, (gchar *) symbol_coverage [422], 20, 44, G_GUINT64_CONSTANT (0x0038447c42427c40), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b3, (gchar *) symbol_coverage [423], 8, 56, G_GUINT64_CONSTANT (0x0000008244281010), 8 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b4, (gchar *) symbol_coverage [424], 20, 44, G_GUINT64_CONSTANT (0x003e087e42423c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b5, (gchar *) symbol_coverage [425], 16, 48, G_GUINT64_CONSTANT (0x0000007e78423c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b6, (gchar *) symbol_coverage [426], 17, 47, G_GUINT64_CONSTANT (0x007e083040403c06), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b7, (gchar *) symbol_coverage [427], 13, 51, G_GUINT64_CONSTANT (0x0000007e42424202), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b8, (gchar *) symbol_coverage [428], 17, 47, G_GUINT64_CONSTANT (0x0038447c44443800), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x003b9, (gchar *) symbol_coverage [429], 6, 58, G_GUINT64_CONSTANT (0x0000003010100c00), 6 },
+    { (ChafaSymbolTags) 0x01028000, 0x003ba, (gchar *) symbol_coverage [430], 11, 53, G_GUINT64_CONSTANT (0x0000004678484200), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x003bb, (gchar *) symbol_coverage [431], 12, 52, G_GUINT64_CONSTANT (0x002010286c448200), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003bc, (gchar *) symbol_coverage [432], 13, 51, G_GUINT64_CONSTANT (0x0000004242467a40), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x003bd, (gchar *) symbol_coverage [433], 10, 54, G_GUINT64_CONSTANT (0x0000004266241800), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x003be, (gchar *) symbol_coverage [434], 18, 46, G_GUINT64_CONSTANT (0x003e403c40403c06), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x003bf, (gchar *) symbol_coverage [435], 14, 50, G_GUINT64_CONSTANT (0x0000007e42423c00), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c0, (gchar *) symbol_coverage [436], 12, 52, G_GUINT64_CONSTANT (0x0000007e42424200), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c1, (gchar *) symbol_coverage [437], 16, 48, G_GUINT64_CONSTANT (0x0000007e42427c40), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c2, (gchar *) symbol_coverage [438], 14, 50, G_GUINT64_CONSTANT (0x0000007e40403c06), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c3, (gchar *) symbol_coverage [439], 13, 51, G_GUINT64_CONSTANT (0x0000007e44443800), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c4, (gchar *) symbol_coverage [440], 11, 53, G_GUINT64_CONSTANT (0x000000fe10100c00), 11 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c5, (gchar *) symbol_coverage [441], 10, 54, G_GUINT64_CONSTANT (0x0000004242423c00), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c6, (gchar *) symbol_coverage [442], 18, 46, G_GUINT64_CONSTANT (0x000000de92927c10), 18 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c7, (gchar *) symbol_coverage [443], 10, 54, G_GUINT64_CONSTANT (0x0000004224182442), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c8, (gchar *) symbol_coverage [444], 15, 49, G_GUINT64_CONSTANT (0x0000009292927c10), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x003c9, (gchar *) symbol_coverage [445], 14, 50, G_GUINT64_CONSTANT (0x000000c692926c00), 14 },
+    { (ChafaSymbolTags) 0x01028000, 0x003ca, (gchar *) symbol_coverage [446], 8, 56, G_GUINT64_CONSTANT (0x0048003010100c00), 8 },
+    { (ChafaSymbolTags) 0x01028000, 0x003cb, (gchar *) symbol_coverage [447], 12, 52, G_GUINT64_CONSTANT (0x0024004242423c00), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003cc, (gchar *) symbol_coverage [448], 15, 49, G_GUINT64_CONSTANT (0x0008007e42423c00), 15 },
+    { (ChafaSymbolTags) 0x01028000, 0x003cd, (gchar *) symbol_coverage [449], 12, 52, G_GUINT64_CONSTANT (0x0008104242423c00), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003ce, (gchar *) symbol_coverage [450], 16, 48, G_GUINT64_CONSTANT (0x000810c692926c00), 16 },
+    { (ChafaSymbolTags) 0x01028000, 0x003d1, (gchar *) symbol_coverage [451], 17, 47, G_GUINT64_CONSTANT (0x0038443e84443800), 17 },
+    { (ChafaSymbolTags) 0x01028000, 0x003d5, (gchar *) symbol_coverage [452], 20, 44, G_GUINT64_CONSTANT (0x000010fe92927c10), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x003f0, (gchar *) symbol_coverage [453], 12, 52, G_GUINT64_CONSTANT (0x000000e618308600), 12 },
+    { (ChafaSymbolTags) 0x01028000, 0x003f1, (gchar *) symbol_coverage [454], 19, 45, G_GUINT64_CONSTANT (0x0000007e42427c3c), 19 },
+    { (ChafaSymbolTags) 0x01028000, 0x003f2, (gchar *) symbol_coverage [455], 13, 51, G_GUINT64_CONSTANT (0x0000007e40423c00), 13 },
+    { (ChafaSymbolTags) 0x01028000, 0x003f3, (gchar *) symbol_coverage [456], 10, 54, G_GUINT64_CONSTANT (0x0004000c04044438), 10 },
+    { (ChafaSymbolTags) 0x01028000, 0x003f4, (gchar *) symbol_coverage [457], 20, 44, G_GUINT64_CONSTANT (0x003c427e42423c00), 20 },
+    { (ChafaSymbolTags) 0x01028000, 0x003f5, (gchar *) symbol_coverage [458], 16, 48, G_GUINT64_CONSTANT (0x0000003e7c403e00), 16 },
+    { (ChafaSymbolTags) 0x01020000, 0x003f6, (gchar *) symbol_coverage [459], 16, 48, G_GUINT64_CONSTANT (0x0000007c3e027c00), 16 },
+    { (ChafaSymbolTags) 0x00020608, 0x02580, (gchar *) symbol_coverage [460], 32, 32, G_GUINT64_CONSTANT (0xffffffff00000000), 32 },
+    { (ChafaSymbolTags) 0x00020008, 0x02581, (gchar *) symbol_coverage [461], 8, 56, G_GUINT64_CONSTANT (0x00000000000000ff), 8 },
+    { (ChafaSymbolTags) 0x00020008, 0x02582, (gchar *) symbol_coverage [462], 16, 48, G_GUINT64_CONSTANT (0x000000000000ffff), 16 },
+    { (ChafaSymbolTags) 0x00020008, 0x02583, (gchar *) symbol_coverage [463], 24, 40, G_GUINT64_CONSTANT (0x0000000000ffffff), 24 },
+    { (ChafaSymbolTags) 0x00020208, 0x02584, (gchar *) symbol_coverage [464], 32, 32, G_GUINT64_CONSTANT (0x00000000ffffffff), 32 },
+    { (ChafaSymbolTags) 0x00020008, 0x02585, (gchar *) symbol_coverage [465], 40, 24, G_GUINT64_CONSTANT (0x000000ffffffffff), 40 },
+    { (ChafaSymbolTags) 0x00020008, 0x02586, (gchar *) symbol_coverage [466], 48, 16, G_GUINT64_CONSTANT (0x0000ffffffffffff), 48 },
+    { (ChafaSymbolTags) 0x00020008, 0x02587, (gchar *) symbol_coverage [467], 56, 8, G_GUINT64_CONSTANT (0x00ffffffffffffff), 56 },
+    { (ChafaSymbolTags) 0x0042000a, 0x02588, (gchar *) symbol_coverage [468], 64, 0, G_GUINT64_CONSTANT (0xffffffffffffffff), 64 },
+    { (ChafaSymbolTags) 0x00020008, 0x02589, (gchar *) symbol_coverage [469], 56, 8, G_GUINT64_CONSTANT (0xfefefefefefefefe), 56 },
+    { (ChafaSymbolTags) 0x00020008, 0x0258a, (gchar *) symbol_coverage [470], 48, 16, G_GUINT64_CONSTANT (0xfcfcfcfcfcfcfcfc), 48 },
+    { (ChafaSymbolTags) 0x00020008, 0x0258b, (gchar *) symbol_coverage [471], 40, 24, G_GUINT64_CONSTANT (0xf8f8f8f8f8f8f8f8), 40 },
+    { (ChafaSymbolTags) 0x00420108, 0x0258c, (gchar *) symbol_coverage [472], 32, 32, G_GUINT64_CONSTANT (0xf0f0f0f0f0f0f0f0), 32 },
+    { (ChafaSymbolTags) 0x00020008, 0x0258d, (gchar *) symbol_coverage [473], 24, 40, G_GUINT64_CONSTANT (0xe0e0e0e0e0e0e0e0), 24 },
+    { (ChafaSymbolTags) 0x00020008, 0x0258e, (gchar *) symbol_coverage [474], 16, 48, G_GUINT64_CONSTANT (0xc0c0c0c0c0c0c0c0), 16 },
+    { (ChafaSymbolTags) 0x00020008, 0x0258f, (gchar *) symbol_coverage [475], 8, 56, G_GUINT64_CONSTANT (0x8080808080808080), 8 },
+    { (ChafaSymbolTags) 0x00420508, 0x02590, (gchar *) symbol_coverage [476], 32, 32, G_GUINT64_CONSTANT (0x0f0f0f0f0f0f0f0f), 32 },
+    { (ChafaSymbolTags) 0x00020408, 0x02594, (gchar *) symbol_coverage [477], 8, 56, G_GUINT64_CONSTANT (0xff00000000000000), 8 },
+    { (ChafaSymbolTags) 0x00020408, 0x02595, (gchar *) symbol_coverage [478], 8, 56, G_GUINT64_CONSTANT (0x0101010101010101), 8 },
+    { (ChafaSymbolTags) 0x00020088, 0x02596, (gchar *) symbol_coverage [479], 16, 48, G_GUINT64_CONSTANT (0x00000000f0f0f0f0), 16 },
+    { (ChafaSymbolTags) 0x00020088, 0x02597, (gchar *) symbol_coverage [480], 16, 48, G_GUINT64_CONSTANT (0x000000000f0f0f0f), 16 },
+    { (ChafaSymbolTags) 0x00020088, 0x02598, (gchar *) symbol_coverage [481], 16, 48, G_GUINT64_CONSTANT (0xf0f0f0f000000000), 16 },
+    { (ChafaSymbolTags) 0x00020488, 0x02599, (gchar *) symbol_coverage [482], 48, 16, G_GUINT64_CONSTANT (0xf0f0f0f0ffffffff), 48 },
+    { (ChafaSymbolTags) 0x00020088, 0x0259a, (gchar *) symbol_coverage [483], 32, 32, G_GUINT64_CONSTANT (0xf0f0f0f00f0f0f0f), 32 },
+    { (ChafaSymbolTags) 0x00020488, 0x0259b, (gchar *) symbol_coverage [484], 48, 16, G_GUINT64_CONSTANT (0xfffffffff0f0f0f0), 48 },
+    { (ChafaSymbolTags) 0x00020488, 0x0259c, (gchar *) symbol_coverage [485], 48, 16, G_GUINT64_CONSTANT (0xffffffff0f0f0f0f), 48 },
+    { (ChafaSymbolTags) 0x00020088, 0x0259d, (gchar *) symbol_coverage [486], 16, 48, G_GUINT64_CONSTANT (0x0f0f0f0f00000000), 16 },
+    { (ChafaSymbolTags) 0x00020488, 0x0259e, (gchar *) symbol_coverage [487], 32, 32, G_GUINT64_CONSTANT (0x0f0f0f0ff0f0f0f0), 32 },
+    { (ChafaSymbolTags) 0x00020488, 0x0259f, (gchar *) symbol_coverage [488], 48, 16, G_GUINT64_CONSTANT (0x0f0f0f0fffffffff), 48 },
+    { (ChafaSymbolTags) 0x00020010, 0x02500, (gchar *) symbol_coverage [489], 8, 56, G_GUINT64_CONSTANT (0x00000000ff000000), 8 },
+    { (ChafaSymbolTags) 0x00020010, 0x02501, (gchar *) symbol_coverage [490], 16, 48, G_GUINT64_CONSTANT (0x000000ffff000000), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02502, (gchar *) symbol_coverage [491], 8, 56, G_GUINT64_CONSTANT (0x0808080808080808), 8 },
+    { (ChafaSymbolTags) 0x00020010, 0x02503, (gchar *) symbol_coverage [492], 16, 48, G_GUINT64_CONSTANT (0x1818181818181818), 16 },
+    { (ChafaSymbolTags) 0x00020050, 0x02504, (gchar *) symbol_coverage [493], 6, 58, G_GUINT64_CONSTANT (0x00000000db000000), 6 },
+    { (ChafaSymbolTags) 0x00020050, 0x02505, (gchar *) symbol_coverage [494], 12, 52, G_GUINT64_CONSTANT (0x000000dbdb000000), 12 },
+    { (ChafaSymbolTags) 0x00020050, 0x02506, (gchar *) symbol_coverage [495], 6, 58, G_GUINT64_CONSTANT (0x0808000808000808), 6 },
+    { (ChafaSymbolTags) 0x00020050, 0x02507, (gchar *) symbol_coverage [496], 12, 52, G_GUINT64_CONSTANT (0x1818001818001818), 12 },
+    { (ChafaSymbolTags) 0x00020050, 0x02508, (gchar *) symbol_coverage [497], 4, 60, G_GUINT64_CONSTANT (0x00000000aa000000), 4 },
+    { (ChafaSymbolTags) 0x00020050, 0x02509, (gchar *) symbol_coverage [498], 8, 56, G_GUINT64_CONSTANT (0x000000aaaa000000), 8 },
+    { (ChafaSymbolTags) 0x00020050, 0x0250a, (gchar *) symbol_coverage [499], 4, 60, G_GUINT64_CONSTANT (0x0800080008000800), 4 },
+    { (ChafaSymbolTags) 0x00020050, 0x0250b, (gchar *) symbol_coverage [500], 8, 56, G_GUINT64_CONSTANT (0x1800180018001800), 8 },
+    { (ChafaSymbolTags) 0x00020010, 0x0250c, (gchar *) symbol_coverage [501], 7, 57, G_GUINT64_CONSTANT (0x000000000f080808), 7 },
+    { (ChafaSymbolTags) 0x00020010, 0x0250d, (gchar *) symbol_coverage [502], 11, 53, G_GUINT64_CONSTANT (0x0000000f0f080808), 11 },
+    { (ChafaSymbolTags) 0x00020010, 0x0250e, (gchar *) symbol_coverage [503], 11, 53, G_GUINT64_CONSTANT (0x000000001f181818), 11 },
+    { (ChafaSymbolTags) 0x00020010, 0x0250f, (gchar *) symbol_coverage [504], 16, 48, G_GUINT64_CONSTANT (0x0000001f1f181818), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02510, (gchar *) symbol_coverage [505], 8, 56, G_GUINT64_CONSTANT (0x00000000f8080808), 8 },
+    { (ChafaSymbolTags) 0x00020010, 0x02511, (gchar *) symbol_coverage [506], 13, 51, G_GUINT64_CONSTANT (0x000000f8f8080808), 13 },
+    { (ChafaSymbolTags) 0x00020010, 0x02512, (gchar *) symbol_coverage [507], 11, 53, G_GUINT64_CONSTANT (0x00000000f8181818), 11 },
+    { (ChafaSymbolTags) 0x00020010, 0x02513, (gchar *) symbol_coverage [508], 16, 48, G_GUINT64_CONSTANT (0x000000f8f8181818), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02514, (gchar *) symbol_coverage [509], 8, 56, G_GUINT64_CONSTANT (0x080808080f000000), 8 },
+    { (ChafaSymbolTags) 0x00020010, 0x02515, (gchar *) symbol_coverage [510], 11, 53, G_GUINT64_CONSTANT (0x0808080f0f000000), 11 },
+    { (ChafaSymbolTags) 0x00020010, 0x02516, (gchar *) symbol_coverage [511], 13, 51, G_GUINT64_CONSTANT (0x181818181f000000), 13 },
+    { (ChafaSymbolTags) 0x00020010, 0x02517, (gchar *) symbol_coverage [512], 16, 48, G_GUINT64_CONSTANT (0x1818181f1f000000), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02518, (gchar *) symbol_coverage [513], 9, 55, G_GUINT64_CONSTANT (0x08080808f8000000), 9 },
+    { (ChafaSymbolTags) 0x00020010, 0x02519, (gchar *) symbol_coverage [514], 13, 51, G_GUINT64_CONSTANT (0x080808f8f8000000), 13 },
+    { (ChafaSymbolTags) 0x00020010, 0x0251a, (gchar *) symbol_coverage [515], 13, 51, G_GUINT64_CONSTANT (0x18181818f8000000), 13 },
+    { (ChafaSymbolTags) 0x00020010, 0x0251b, (gchar *) symbol_coverage [516], 16, 48, G_GUINT64_CONSTANT (0x181818f8f8000000), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x0251c, (gchar *) symbol_coverage [517], 11, 53, G_GUINT64_CONSTANT (0x080808080f080808), 11 },
+    { (ChafaSymbolTags) 0x00020010, 0x0251d, (gchar *) symbol_coverage [518], 14, 50, G_GUINT64_CONSTANT (0x0808080f0f080808), 14 },
+    { (ChafaSymbolTags) 0x00020010, 0x0251e, (gchar *) symbol_coverage [519], 16, 48, G_GUINT64_CONSTANT (0x181818181f080808), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x0251f, (gchar *) symbol_coverage [520], 15, 49, G_GUINT64_CONSTANT (0x080808081f181818), 15 },
+    { (ChafaSymbolTags) 0x00020010, 0x02520, (gchar *) symbol_coverage [521], 19, 45, G_GUINT64_CONSTANT (0x181818181f181818), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02521, (gchar *) symbol_coverage [522], 19, 45, G_GUINT64_CONSTANT (0x1818181f1f080808), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02522, (gchar *) symbol_coverage [523], 19, 45, G_GUINT64_CONSTANT (0x0808081f1f181818), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02523, (gchar *) symbol_coverage [524], 22, 42, G_GUINT64_CONSTANT (0x1818181f1f181818), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02524, (gchar *) symbol_coverage [525], 12, 52, G_GUINT64_CONSTANT (0x08080808f8080808), 12 },
+    { (ChafaSymbolTags) 0x00020010, 0x02525, (gchar *) symbol_coverage [526], 16, 48, G_GUINT64_CONSTANT (0x080808f8f8080808), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02526, (gchar *) symbol_coverage [527], 16, 48, G_GUINT64_CONSTANT (0x18181818f8080808), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02527, (gchar *) symbol_coverage [528], 15, 49, G_GUINT64_CONSTANT (0x08080808f8181818), 15 },
+    { (ChafaSymbolTags) 0x00020010, 0x02528, (gchar *) symbol_coverage [529], 19, 45, G_GUINT64_CONSTANT (0x18181818f8181818), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02529, (gchar *) symbol_coverage [530], 19, 45, G_GUINT64_CONSTANT (0x181818f8f8080808), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x0252a, (gchar *) symbol_coverage [531], 19, 45, G_GUINT64_CONSTANT (0x080808f8f8181818), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x0252b, (gchar *) symbol_coverage [532], 22, 42, G_GUINT64_CONSTANT (0x181818f8f8181818), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x0252c, (gchar *) symbol_coverage [533], 11, 53, G_GUINT64_CONSTANT (0x00000000ff080808), 11 },
+    { (ChafaSymbolTags) 0x00020010, 0x0252d, (gchar *) symbol_coverage [534], 16, 48, G_GUINT64_CONSTANT (0x000000f8ff080808), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x0252e, (gchar *) symbol_coverage [535], 15, 49, G_GUINT64_CONSTANT (0x0000000fff080808), 15 },
+    { (ChafaSymbolTags) 0x00020010, 0x0252f, (gchar *) symbol_coverage [536], 19, 45, G_GUINT64_CONSTANT (0x000000ffff080808), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02530, (gchar *) symbol_coverage [537], 14, 50, G_GUINT64_CONSTANT (0x00000000ff181818), 14 },
+    { (ChafaSymbolTags) 0x00020010, 0x02531, (gchar *) symbol_coverage [538], 19, 45, G_GUINT64_CONSTANT (0x000000f8ff181818), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02532, (gchar *) symbol_coverage [539], 19, 45, G_GUINT64_CONSTANT (0x0000001fff181818), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02533, (gchar *) symbol_coverage [540], 22, 42, G_GUINT64_CONSTANT (0x000000ffff181818), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02534, (gchar *) symbol_coverage [541], 12, 52, G_GUINT64_CONSTANT (0x08080808ff000000), 12 },
+    { (ChafaSymbolTags) 0x00020010, 0x02535, (gchar *) symbol_coverage [542], 16, 48, G_GUINT64_CONSTANT (0x080808f8ff000000), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02536, (gchar *) symbol_coverage [543], 15, 49, G_GUINT64_CONSTANT (0x0808080fff000000), 15 },
+    { (ChafaSymbolTags) 0x00020010, 0x02537, (gchar *) symbol_coverage [544], 19, 45, G_GUINT64_CONSTANT (0x080808ffff000000), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02538, (gchar *) symbol_coverage [545], 16, 48, G_GUINT64_CONSTANT (0x18181818ff000000), 16 },
+    { (ChafaSymbolTags) 0x00020010, 0x02539, (gchar *) symbol_coverage [546], 19, 45, G_GUINT64_CONSTANT (0x181818f8ff000000), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x0253a, (gchar *) symbol_coverage [547], 19, 45, G_GUINT64_CONSTANT (0x1818181fff000000), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x0253b, (gchar *) symbol_coverage [548], 22, 42, G_GUINT64_CONSTANT (0x181818ffff000000), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x0253c, (gchar *) symbol_coverage [549], 15, 49, G_GUINT64_CONSTANT (0x08080808ff080808), 15 },
+    { (ChafaSymbolTags) 0x00020010, 0x0253d, (gchar *) symbol_coverage [550], 19, 45, G_GUINT64_CONSTANT (0x080808f8ff080808), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x0253e, (gchar *) symbol_coverage [551], 18, 46, G_GUINT64_CONSTANT (0x0808080fff080808), 18 },
+    { (ChafaSymbolTags) 0x00020010, 0x0253f, (gchar *) symbol_coverage [552], 22, 42, G_GUINT64_CONSTANT (0x080808ffff080808), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02540, (gchar *) symbol_coverage [553], 19, 45, G_GUINT64_CONSTANT (0x18181818ff080808), 19 },
+    { (ChafaSymbolTags) 0x00020010, 0x02541, (gchar *) symbol_coverage [554], 18, 46, G_GUINT64_CONSTANT (0x08080808ff181818), 18 },
+    { (ChafaSymbolTags) 0x00020010, 0x02542, (gchar *) symbol_coverage [555], 22, 42, G_GUINT64_CONSTANT (0x18181818ff181818), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02543, (gchar *) symbol_coverage [556], 22, 42, G_GUINT64_CONSTANT (0x181818f8ff080808), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02544, (gchar *) symbol_coverage [557], 22, 42, G_GUINT64_CONSTANT (0x1818181fff080808), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02545, (gchar *) symbol_coverage [558], 22, 42, G_GUINT64_CONSTANT (0x080808f8ff181818), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02546, (gchar *) symbol_coverage [559], 22, 42, G_GUINT64_CONSTANT (0x0808081fff181818), 22 },
+    { (ChafaSymbolTags) 0x00020010, 0x02547, (gchar *) symbol_coverage [560], 25, 39, G_GUINT64_CONSTANT (0x181818ffff080808), 25 },
+    { (ChafaSymbolTags) 0x00020010, 0x02548, (gchar *) symbol_coverage [561], 25, 39, G_GUINT64_CONSTANT (0x080808ffff181818), 25 },
+    { (ChafaSymbolTags) 0x00020010, 0x02549, (gchar *) symbol_coverage [562], 25, 39, G_GUINT64_CONSTANT (0x181818f8ff181818), 25 },
+    { (ChafaSymbolTags) 0x00020010, 0x0254a, (gchar *) symbol_coverage [563], 25, 39, G_GUINT64_CONSTANT (0x1818181fff181818), 25 },
+    { (ChafaSymbolTags) 0x00020010, 0x0254b, (gchar *) symbol_coverage [564], 28, 36, G_GUINT64_CONSTANT (0x181818ffff181818), 28 },
+    { (ChafaSymbolTags) 0x00020050, 0x0254c, (gchar *) symbol_coverage [565], 6, 58, G_GUINT64_CONSTANT (0x00000000e7000000), 6 },
+    { (ChafaSymbolTags) 0x00020050, 0x0254d, (gchar *) symbol_coverage [566], 12, 52, G_GUINT64_CONSTANT (0x000000e7e7000000), 12 },
+    { (ChafaSymbolTags) 0x00020050, 0x0254e, (gchar *) symbol_coverage [567], 6, 58, G_GUINT64_CONSTANT (0x0808080000080808), 6 },
+    { (ChafaSymbolTags) 0x00020050, 0x0254f, (gchar *) symbol_coverage [568], 12, 52, G_GUINT64_CONSTANT (0x1818180000181818), 12 },
+    { (ChafaSymbolTags) 0x00020030, 0x02571, (gchar *) symbol_coverage [569], 8, 56, G_GUINT64_CONSTANT (0x0102040810204080), 8 },
+    { (ChafaSymbolTags) 0x00020030, 0x02571, (gchar *) symbol_coverage [570], 22, 42, G_GUINT64_CONSTANT (0x03070e1c3870e0c0), 22 },
+    { (ChafaSymbolTags) 0x00020030, 0x02572, (gchar *) symbol_coverage [571], 8, 56, G_GUINT64_CONSTANT (0x8040201008040201), 8 },
+    { (ChafaSymbolTags) 0x00020030, 0x02572, (gchar *) symbol_coverage [572], 22, 42, G_GUINT64_CONSTANT (0xc0e070381c0e0703), 22 },
+    { (ChafaSymbolTags) 0x00020030, 0x02573, (gchar *) symbol_coverage [573], 16, 48, G_GUINT64_CONSTANT (0x8142241818244281), 16 },
+    { (ChafaSymbolTags) 0x00020050, 0x02574, (gchar *) symbol_coverage [574], 4, 60, G_GUINT64_CONSTANT (0x00000000f0000000), 4 },
+    { (ChafaSymbolTags) 0x00020050, 0x02575, (gchar *) symbol_coverage [575], 4, 60, G_GUINT64_CONSTANT (0x0808080800000000), 4 },
+    { (ChafaSymbolTags) 0x00020050, 0x02576, (gchar *) symbol_coverage [576], 4, 60, G_GUINT64_CONSTANT (0x000000000f000000), 4 },
+    { (ChafaSymbolTags) 0x00020050, 0x02577, (gchar *) symbol_coverage [577], 4, 60, G_GUINT64_CONSTANT (0x0000000008080808), 4 },
+    { (ChafaSymbolTags) 0x00020050, 0x02578, (gchar *) symbol_coverage [578], 8, 56, G_GUINT64_CONSTANT (0x000000f0f0000000), 8 },
+    { (ChafaSymbolTags) 0x00020050, 0x02579, (gchar *) symbol_coverage [579], 8, 56, G_GUINT64_CONSTANT (0x1818181800000000), 8 },
+    { (ChafaSymbolTags) 0x00020050, 0x0257a, (gchar *) symbol_coverage [580], 8, 56, G_GUINT64_CONSTANT (0x0000000f0f000000), 8 },
+    { (ChafaSymbolTags) 0x00020050, 0x0257b, (gchar *) symbol_coverage [581], 8, 56, G_GUINT64_CONSTANT (0x0000000018181818), 8 },
+    { (ChafaSymbolTags) 0x00020010, 0x0257c, (gchar *) symbol_coverage [582], 12, 52, G_GUINT64_CONSTANT (0x0000000fff000000), 12 },
+    { (ChafaSymbolTags) 0x00020010, 0x0257d, (gchar *) symbol_coverage [583], 12, 52, G_GUINT64_CONSTANT (0x0808080818181818), 12 },
+    { (ChafaSymbolTags) 0x00020010, 0x0257e, (gchar *) symbol_coverage [584], 12, 52, G_GUINT64_CONSTANT (0x000000f0ff000000), 12 },
+    { (ChafaSymbolTags) 0x00020010, 0x0257f, (gchar *) symbol_coverage [585], 12, 52, G_GUINT64_CONSTANT (0x1818181808080808), 12 },
+    { (ChafaSymbolTags) 0x00020004, 0x02591, (gchar *) symbol_coverage [586], 16, 48, G_GUINT64_CONSTANT (0x8822882288228822), 16 },
+    { (ChafaSymbolTags) 0x00020004, 0x02592, (gchar *) symbol_coverage [587], 32, 32, G_GUINT64_CONSTANT (0xaa55aa55aa55aa55), 32 },
+    { (ChafaSymbolTags) 0x00020004, 0x02593, (gchar *) symbol_coverage [588], 48, 16, G_GUINT64_CONSTANT (0x77dd77dd77dd77dd), 48 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb3c, (gchar *) symbol_coverage [589], 8, 56, G_GUINT64_CONSTANT (0x000000000080e0f0), 8 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb3d, (gchar *) symbol_coverage [590], 15, 49, G_GUINT64_CONSTANT (0x0000000000c0f8ff), 15 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb3e, (gchar *) symbol_coverage [591], 12, 52, G_GUINT64_CONSTANT (0x00000080c0c0e0f0), 12 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb3f, (gchar *) symbol_coverage [592], 25, 39, G_GUINT64_CONSTANT (0x000000c0e0f8feff), 25 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb40, (gchar *) symbol_coverage [593], 16, 48, G_GUINT64_CONSTANT (0x008080c0c0e0e0f0), 16 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb41, (gchar *) symbol_coverage [594], 56, 8, G_GUINT64_CONSTANT (0x0f1f7fffffffffff), 56 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb42, (gchar *) symbol_coverage [595], 49, 15, G_GUINT64_CONSTANT (0x00073fffffffffff), 49 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb43, (gchar *) symbol_coverage [596], 51, 13, G_GUINT64_CONSTANT (0x0f1f1f3f7fffffff), 51 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb44, (gchar *) symbol_coverage [597], 37, 27, G_GUINT64_CONSTANT (0x0001030f3fffffff), 37 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb45, (gchar *) symbol_coverage [598], 44, 20, G_GUINT64_CONSTANT (0x0f0f1f1f3f3f7f7f), 44 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb46, (gchar *) symbol_coverage [599], 32, 32, G_GUINT64_CONSTANT (0x000000071fffffff), 32 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb47, (gchar *) symbol_coverage [600], 8, 56, G_GUINT64_CONSTANT (0x000000000001070f), 8 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb48, (gchar *) symbol_coverage [601], 14, 50, G_GUINT64_CONSTANT (0x0000000000031f7f), 14 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb49, (gchar *) symbol_coverage [602], 12, 52, G_GUINT64_CONSTANT (0x000000010303070f), 12 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb4a, (gchar *) symbol_coverage [603], 24, 40, G_GUINT64_CONSTANT (0x00000001071f7fff), 24 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb4b, (gchar *) symbol_coverage [604], 20, 44, G_GUINT64_CONSTANT (0x0101030307070f0f), 20 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb4c, (gchar *) symbol_coverage [605], 57, 7, G_GUINT64_CONSTANT (0xf0fcfeffffffffff), 57 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb4d, (gchar *) symbol_coverage [606], 50, 14, G_GUINT64_CONSTANT (0x80e0fcffffffffff), 50 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb4e, (gchar *) symbol_coverage [607], 52, 12, G_GUINT64_CONSTANT (0xf0f8fcfcfeffffff), 52 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb4f, (gchar *) symbol_coverage [608], 44, 20, G_GUINT64_CONSTANT (0x80c0f0fcfeffffff), 44 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb50, (gchar *) symbol_coverage [609], 44, 20, G_GUINT64_CONSTANT (0xf0f0f8f8fcfcfefe), 44 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb51, (gchar *) symbol_coverage [610], 32, 32, G_GUINT64_CONSTANT (0x000000e0f8ffffff), 32 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb52, (gchar *) symbol_coverage [611], 56, 8, G_GUINT64_CONSTANT (0xffffffffff7f1f0f), 56 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb53, (gchar *) symbol_coverage [612], 49, 15, G_GUINT64_CONSTANT (0xffffffffff3f0700), 49 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb54, (gchar *) symbol_coverage [613], 53, 11, G_GUINT64_CONSTANT (0xffffff7f3f3f1f1f), 53 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb55, (gchar *) symbol_coverage [614], 45, 19, G_GUINT64_CONSTANT (0xffffff7f3f0f0701), 45 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb56, (gchar *) symbol_coverage [615], 44, 20, G_GUINT64_CONSTANT (0x7f7f3f3f1f1f0f0f), 44 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb57, (gchar *) symbol_coverage [616], 8, 56, G_GUINT64_CONSTANT (0xf0e0800000000000), 8 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb58, (gchar *) symbol_coverage [617], 16, 48, G_GUINT64_CONSTANT (0xfff8e00000000000), 16 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb59, (gchar *) symbol_coverage [618], 12, 52, G_GUINT64_CONSTANT (0xf0e0e08080000000), 12 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb5a, (gchar *) symbol_coverage [619], 25, 39, G_GUINT64_CONSTANT (0xfffef8e0c0000000), 25 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb5b, (gchar *) symbol_coverage [620], 18, 46, G_GUINT64_CONSTANT (0xf0f0e0e0c0808000), 18 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb5c, (gchar *) symbol_coverage [621], 32, 32, G_GUINT64_CONSTANT (0xfffffff8e0000000), 32 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb5d, (gchar *) symbol_coverage [622], 57, 7, G_GUINT64_CONSTANT (0xfffffffffffefcf0), 57 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb5e, (gchar *) symbol_coverage [623], 50, 14, G_GUINT64_CONSTANT (0xfffffffffffce080), 50 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb5f, (gchar *) symbol_coverage [624], 53, 11, G_GUINT64_CONSTANT (0xfffffffefefcf8f0), 53 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb60, (gchar *) symbol_coverage [625], 45, 19, G_GUINT64_CONSTANT (0xfffffffefcf0e080), 45 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb61, (gchar *) symbol_coverage [626], 44, 20, G_GUINT64_CONSTANT (0xfefefcfcf8f8f0f0), 44 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb62, (gchar *) symbol_coverage [627], 7, 57, G_GUINT64_CONSTANT (0x0f03010000000000), 7 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb63, (gchar *) symbol_coverage [628], 15, 49, G_GUINT64_CONSTANT (0xff1f030000000000), 15 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb64, (gchar *) symbol_coverage [629], 12, 52, G_GUINT64_CONSTANT (0x0f07030301000000), 12 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb65, (gchar *) symbol_coverage [630], 21, 43, G_GUINT64_CONSTANT (0x7f3f0f0701000000), 21 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb66, (gchar *) symbol_coverage [631], 20, 44, G_GUINT64_CONSTANT (0x0f0f070703030101), 20 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb67, (gchar *) symbol_coverage [632], 32, 32, G_GUINT64_CONSTANT (0xffffff1f07000000), 32 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb68, (gchar *) symbol_coverage [633], 48, 16, G_GUINT64_CONSTANT (0xff7f3f1f0f1f3f7f), 48 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb69, (gchar *) symbol_coverage [634], 44, 20, G_GUINT64_CONSTANT (0x0081c3e7ffffffff), 44 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb6a, (gchar *) symbol_coverage [635], 48, 16, G_GUINT64_CONSTANT (0xfffefcf8f0f8fcfe), 48 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb6b, (gchar *) symbol_coverage [636], 44, 20, G_GUINT64_CONSTANT (0xffffffffe7c38100), 44 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb6c, (gchar *) symbol_coverage [637], 16, 48, G_GUINT64_CONSTANT (0x0080c0e0f0e0c080), 16 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb6d, (gchar *) symbol_coverage [638], 20, 44, G_GUINT64_CONSTANT (0xff7e3c1800000000), 20 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb6e, (gchar *) symbol_coverage [639], 16, 48, G_GUINT64_CONSTANT (0x000103070f070301), 16 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb6f, (gchar *) symbol_coverage [640], 20, 44, G_GUINT64_CONSTANT (0x00000000183c7eff), 20 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb9a, (gchar *) symbol_coverage [641], 32, 32, G_GUINT64_CONSTANT (0xfe7c3810081c3e7f), 32 },
+    { (ChafaSymbolTags) 0x00a20000, 0x1fb9b, (gchar *) symbol_coverage [642], 32, 32, G_GUINT64_CONSTANT (0x0183c7eff7e3c180), 32 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb98, (gchar *) symbol_coverage [643], 22, 42, G_GUINT64_CONSTANT (0x9249249249249249), 22 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb99, (gchar *) symbol_coverage [644], 22, 42, G_GUINT64_CONSTANT (0x4992244992244992), 22 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb7c, (gchar *) symbol_coverage [645], 15, 49, G_GUINT64_CONSTANT (0x80808080808080ff), 15 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb7d, (gchar *) symbol_coverage [646], 15, 49, G_GUINT64_CONSTANT (0xff80808080808080), 15 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb7e, (gchar *) symbol_coverage [647], 15, 49, G_GUINT64_CONSTANT (0xff01010101010101), 15 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb7f, (gchar *) symbol_coverage [648], 15, 49, G_GUINT64_CONSTANT (0x01010101010101ff), 15 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb80, (gchar *) symbol_coverage [649], 16, 48, G_GUINT64_CONSTANT (0xff000000000000ff), 16 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb70, (gchar *) symbol_coverage [650], 8, 56, G_GUINT64_CONSTANT (0x4040404040404040), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb71, (gchar *) symbol_coverage [651], 8, 56, G_GUINT64_CONSTANT (0x2020202020202020), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb72, (gchar *) symbol_coverage [652], 8, 56, G_GUINT64_CONSTANT (0x1010101010101010), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb73, (gchar *) symbol_coverage [653], 8, 56, G_GUINT64_CONSTANT (0x0808080808080808), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb74, (gchar *) symbol_coverage [654], 8, 56, G_GUINT64_CONSTANT (0x0404040404040404), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb75, (gchar *) symbol_coverage [655], 8, 56, G_GUINT64_CONSTANT (0x0202020202020202), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb76, (gchar *) symbol_coverage [656], 8, 56, G_GUINT64_CONSTANT (0x00ff000000000000), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb77, (gchar *) symbol_coverage [657], 8, 56, G_GUINT64_CONSTANT (0x0000ff0000000000), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb78, (gchar *) symbol_coverage [658], 8, 56, G_GUINT64_CONSTANT (0x000000ff00000000), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb79, (gchar *) symbol_coverage [659], 8, 56, G_GUINT64_CONSTANT (0x00000000ff000000), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb7a, (gchar *) symbol_coverage [660], 8, 56, G_GUINT64_CONSTANT (0x0000000000ff0000), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb7b, (gchar *) symbol_coverage [661], 8, 56, G_GUINT64_CONSTANT (0x000000000000ff00), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb95, (gchar *) symbol_coverage [662], 32, 32, G_GUINT64_CONSTANT (0xcccc3333cccc3333), 32 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb96, (gchar *) symbol_coverage [663], 32, 32, G_GUINT64_CONSTANT (0x3333cccc3333cccc), 32 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fb97, (gchar *) symbol_coverage [664], 32, 32, G_GUINT64_CONSTANT (0x0000ffff0000ffff), 32 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba0, (gchar *) symbol_coverage [665], 4, 60, G_GUINT64_CONSTANT (0x1020408000000000), 4 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba1, (gchar *) symbol_coverage [666], 4, 60, G_GUINT64_CONSTANT (0x0804020100000000), 4 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba2, (gchar *) symbol_coverage [667], 4, 60, G_GUINT64_CONSTANT (0x0000000080402010), 4 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba3, (gchar *) symbol_coverage [668], 4, 60, G_GUINT64_CONSTANT (0x0000000001020408), 4 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba4, (gchar *) symbol_coverage [669], 8, 56, G_GUINT64_CONSTANT (0x1020408080402010), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba5, (gchar *) symbol_coverage [670], 8, 56, G_GUINT64_CONSTANT (0x0804020101020408), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba6, (gchar *) symbol_coverage [671], 8, 56, G_GUINT64_CONSTANT (0x0000000081422418), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba7, (gchar *) symbol_coverage [672], 8, 56, G_GUINT64_CONSTANT (0x1824428100000000), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba8, (gchar *) symbol_coverage [673], 8, 56, G_GUINT64_CONSTANT (0x1020408001020408), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fba9, (gchar *) symbol_coverage [674], 8, 56, G_GUINT64_CONSTANT (0x0804020180402010), 8 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fbaa, (gchar *) symbol_coverage [675], 12, 52, G_GUINT64_CONSTANT (0x0804020181422418), 12 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fbab, (gchar *) symbol_coverage [676], 12, 52, G_GUINT64_CONSTANT (0x1020408081422418), 12 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fbac, (gchar *) symbol_coverage [677], 12, 52, G_GUINT64_CONSTANT (0x1824428101020408), 12 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fbad, (gchar *) symbol_coverage [678], 12, 52, G_GUINT64_CONSTANT (0x1824428180402010), 12 },
+    { (ChafaSymbolTags) 0x00220000, 0x1fbae, (gchar *) symbol_coverage [679], 16, 48, G_GUINT64_CONSTANT (0x1824428181422418), 16 },
+    { (ChafaSymbolTags) 0x00021000, 0x023ba, (gchar *) symbol_coverage [680], 8, 56, G_GUINT64_CONSTANT (0x00ff000000000000), 8 },
+    { (ChafaSymbolTags) 0x00021000, 0x023bb, (gchar *) symbol_coverage [681], 8, 56, G_GUINT64_CONSTANT (0x000000ff00000000), 8 },
+    { (ChafaSymbolTags) 0x00021000, 0x023bc, (gchar *) symbol_coverage [682], 8, 56, G_GUINT64_CONSTANT (0x00000000ff000000), 8 },
+    { (ChafaSymbolTags) 0x00021000, 0x023bd, (gchar *) symbol_coverage [683], 8, 56, G_GUINT64_CONSTANT (0x000000000000ff00), 8 },
+    { (ChafaSymbolTags) 0x00022040, 0x025ae, (gchar *) symbol_coverage [684], 36, 28, G_GUINT64_CONSTANT (0x007e7e7e7e7e7e00), 36 },
+    { (ChafaSymbolTags) 0x00022040, 0x025a0, (gchar *) symbol_coverage [685], 24, 40, G_GUINT64_CONSTANT (0x00007e7e7e7e0000), 24 },
+    { (ChafaSymbolTags) 0x000a2040, 0x025aa, (gchar *) symbol_coverage [686], 16, 48, G_GUINT64_CONSTANT (0x00003c3c3c3c0000), 16 },
+    { (ChafaSymbolTags) 0x00022000, 0x025b2, (gchar *) symbol_coverage [687], 26, 38, G_GUINT64_CONSTANT (0x00183c7e7eff0000), 26 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025b6, (gchar *) symbol_coverage [688], 22, 42, G_GUINT64_CONSTANT (0x4070787e78704000), 22 },
+    { (ChafaSymbolTags) 0x00022000, 0x025bc, (gchar *) symbol_coverage [689], 26, 38, G_GUINT64_CONSTANT (0x00ff7e7e3c180000), 26 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025c0, (gchar *) symbol_coverage [690], 22, 42, G_GUINT64_CONSTANT (0x020e1e7e1e0e0200), 22 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025c6, (gchar *) symbol_coverage [691], 18, 46, G_GUINT64_CONSTANT (0x00183c7e3c180000), 18 },
+    { (ChafaSymbolTags) 0x00022000, 0x025cf, (gchar *) symbol_coverage [692], 26, 38, G_GUINT64_CONSTANT (0x003c7e7e7e3c0000), 26 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025e2, (gchar *) symbol_coverage [693], 15, 49, G_GUINT64_CONSTANT (0x0000060e1e7e0000), 15 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025e3, (gchar *) symbol_coverage [694], 15, 49, G_GUINT64_CONSTANT (0x00006070787e0000), 15 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025e4, (gchar *) symbol_coverage [695], 15, 49, G_GUINT64_CONSTANT (0x00007e7870600000), 15 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025e5, (gchar *) symbol_coverage [696], 15, 49, G_GUINT64_CONSTANT (0x00007e1e0e060000), 15 },
+    { (ChafaSymbolTags) 0x000a2000, 0x025fc, (gchar *) symbol_coverage [697], 16, 48, G_GUINT64_CONSTANT (0x00003c3c3c3c0000), 16 },
+    { (ChafaSymbolTags) 0x00020040, 0x000b7, (gchar *) symbol_coverage [698], 4, 60, G_GUINT64_CONSTANT (0x0000001818000000), 4 },
+    { (ChafaSymbolTags) 0x00020040, 0x000b7, (gchar *) symbol_coverage [699], 4, 60, G_GUINT64_CONSTANT (0x0000003030000000), 4 },
+    { (ChafaSymbolTags) 0x00020040, 0x000b7, (gchar *) symbol_coverage [700], 4, 60, G_GUINT64_CONSTANT (0x0000000c0c000000), 4 },
+    { (ChafaSymbolTags) 0x00020040, 0x000b7, (gchar *) symbol_coverage [701], 4, 60, G_GUINT64_CONSTANT (0x0000181800000000), 4 },
+    { (ChafaSymbolTags) 0x00020040, 0x000b7, (gchar *) symbol_coverage [702], 4, 60, G_GUINT64_CONSTANT (0x0000000018180000), 4 },
+    { (ChafaSymbolTags) 0x40028000, 0x0039e, (gchar *) symbol_coverage [703], 16, 48, G_GUINT64_CONSTANT (0x007e003c007e0000), 16 },
+    { (ChafaSymbolTags) 0x00000800, 0x02800, (gchar *) symbol_coverage [704], 0, 64, G_GUINT64_CONSTANT (0x0000000000000000), 0 },
+    { (ChafaSymbolTags) 0x00000800, 0x02801, (gchar *) symbol_coverage [705], 2, 62, G_GUINT64_CONSTANT (0x6000000000000000), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02802, (gchar *) symbol_coverage [706], 2, 62, G_GUINT64_CONSTANT (0x0000600000000000), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02803, (gchar *) symbol_coverage [707], 4, 60, G_GUINT64_CONSTANT (0x6000600000000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02804, (gchar *) symbol_coverage [708], 2, 62, G_GUINT64_CONSTANT (0x0000000060000000), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02805, (gchar *) symbol_coverage [709], 4, 60, G_GUINT64_CONSTANT (0x6000000060000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02806, (gchar *) symbol_coverage [710], 4, 60, G_GUINT64_CONSTANT (0x0000600060000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02807, (gchar *) symbol_coverage [711], 6, 58, G_GUINT64_CONSTANT (0x6000600060000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02808, (gchar *) symbol_coverage [712], 2, 62, G_GUINT64_CONSTANT (0x0600000000000000), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02809, (gchar *) symbol_coverage [713], 4, 60, G_GUINT64_CONSTANT (0x6600000000000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x0280a, (gchar *) symbol_coverage [714], 4, 60, G_GUINT64_CONSTANT (0x0600600000000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x0280b, (gchar *) symbol_coverage [715], 6, 58, G_GUINT64_CONSTANT (0x6600600000000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0280c, (gchar *) symbol_coverage [716], 4, 60, G_GUINT64_CONSTANT (0x0600000060000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x0280d, (gchar *) symbol_coverage [717], 6, 58, G_GUINT64_CONSTANT (0x6600000060000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0280e, (gchar *) symbol_coverage [718], 6, 58, G_GUINT64_CONSTANT (0x0600600060000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0280f, (gchar *) symbol_coverage [719], 8, 56, G_GUINT64_CONSTANT (0x6600600060000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02810, (gchar *) symbol_coverage [720], 2, 62, G_GUINT64_CONSTANT (0x0000060000000000), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02811, (gchar *) symbol_coverage [721], 4, 60, G_GUINT64_CONSTANT (0x6000060000000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02812, (gchar *) symbol_coverage [722], 4, 60, G_GUINT64_CONSTANT (0x0000660000000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02813, (gchar *) symbol_coverage [723], 6, 58, G_GUINT64_CONSTANT (0x6000660000000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02814, (gchar *) symbol_coverage [724], 4, 60, G_GUINT64_CONSTANT (0x0000060060000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02815, (gchar *) symbol_coverage [725], 6, 58, G_GUINT64_CONSTANT (0x6000060060000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02816, (gchar *) symbol_coverage [726], 6, 58, G_GUINT64_CONSTANT (0x0000660060000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02817, (gchar *) symbol_coverage [727], 8, 56, G_GUINT64_CONSTANT (0x6000660060000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02818, (gchar *) symbol_coverage [728], 4, 60, G_GUINT64_CONSTANT (0x0600060000000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02819, (gchar *) symbol_coverage [729], 6, 58, G_GUINT64_CONSTANT (0x6600060000000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0281a, (gchar *) symbol_coverage [730], 6, 58, G_GUINT64_CONSTANT (0x0600660000000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0281b, (gchar *) symbol_coverage [731], 8, 56, G_GUINT64_CONSTANT (0x6600660000000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0281c, (gchar *) symbol_coverage [732], 6, 58, G_GUINT64_CONSTANT (0x0600060060000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0281d, (gchar *) symbol_coverage [733], 8, 56, G_GUINT64_CONSTANT (0x6600060060000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0281e, (gchar *) symbol_coverage [734], 8, 56, G_GUINT64_CONSTANT (0x0600660060000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0281f, (gchar *) symbol_coverage [735], 10, 54, G_GUINT64_CONSTANT (0x6600660060000000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02820, (gchar *) symbol_coverage [736], 2, 62, G_GUINT64_CONSTANT (0x0000000006000000), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02821, (gchar *) symbol_coverage [737], 4, 60, G_GUINT64_CONSTANT (0x6000000006000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02822, (gchar *) symbol_coverage [738], 4, 60, G_GUINT64_CONSTANT (0x0000600006000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02823, (gchar *) symbol_coverage [739], 6, 58, G_GUINT64_CONSTANT (0x6000600006000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02824, (gchar *) symbol_coverage [740], 4, 60, G_GUINT64_CONSTANT (0x0000000066000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02825, (gchar *) symbol_coverage [741], 6, 58, G_GUINT64_CONSTANT (0x6000000066000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02826, (gchar *) symbol_coverage [742], 6, 58, G_GUINT64_CONSTANT (0x0000600066000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02827, (gchar *) symbol_coverage [743], 8, 56, G_GUINT64_CONSTANT (0x6000600066000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02828, (gchar *) symbol_coverage [744], 4, 60, G_GUINT64_CONSTANT (0x0600000006000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02829, (gchar *) symbol_coverage [745], 6, 58, G_GUINT64_CONSTANT (0x6600000006000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0282a, (gchar *) symbol_coverage [746], 6, 58, G_GUINT64_CONSTANT (0x0600600006000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0282b, (gchar *) symbol_coverage [747], 8, 56, G_GUINT64_CONSTANT (0x6600600006000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0282c, (gchar *) symbol_coverage [748], 6, 58, G_GUINT64_CONSTANT (0x0600000066000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0282d, (gchar *) symbol_coverage [749], 8, 56, G_GUINT64_CONSTANT (0x6600000066000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0282e, (gchar *) symbol_coverage [750], 8, 56, G_GUINT64_CONSTANT (0x0600600066000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0282f, (gchar *) symbol_coverage [751], 10, 54, G_GUINT64_CONSTANT (0x6600600066000000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02830, (gchar *) symbol_coverage [752], 4, 60, G_GUINT64_CONSTANT (0x0000060006000000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02831, (gchar *) symbol_coverage [753], 6, 58, G_GUINT64_CONSTANT (0x6000060006000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02832, (gchar *) symbol_coverage [754], 6, 58, G_GUINT64_CONSTANT (0x0000660006000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02833, (gchar *) symbol_coverage [755], 8, 56, G_GUINT64_CONSTANT (0x6000660006000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02834, (gchar *) symbol_coverage [756], 6, 58, G_GUINT64_CONSTANT (0x0000060066000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02835, (gchar *) symbol_coverage [757], 8, 56, G_GUINT64_CONSTANT (0x6000060066000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02836, (gchar *) symbol_coverage [758], 8, 56, G_GUINT64_CONSTANT (0x0000660066000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02837, (gchar *) symbol_coverage [759], 10, 54, G_GUINT64_CONSTANT (0x6000660066000000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02838, (gchar *) symbol_coverage [760], 6, 58, G_GUINT64_CONSTANT (0x0600060006000000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02839, (gchar *) symbol_coverage [761], 8, 56, G_GUINT64_CONSTANT (0x6600060006000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0283a, (gchar *) symbol_coverage [762], 8, 56, G_GUINT64_CONSTANT (0x0600660006000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0283b, (gchar *) symbol_coverage [763], 10, 54, G_GUINT64_CONSTANT (0x6600660006000000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0283c, (gchar *) symbol_coverage [764], 8, 56, G_GUINT64_CONSTANT (0x0600060066000000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0283d, (gchar *) symbol_coverage [765], 10, 54, G_GUINT64_CONSTANT (0x6600060066000000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0283e, (gchar *) symbol_coverage [766], 10, 54, G_GUINT64_CONSTANT (0x0600660066000000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0283f, (gchar *) symbol_coverage [767], 12, 52, G_GUINT64_CONSTANT (0x6600660066000000), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x02840, (gchar *) symbol_coverage [768], 2, 62, G_GUINT64_CONSTANT (0x0000000000006000), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02841, (gchar *) symbol_coverage [769], 4, 60, G_GUINT64_CONSTANT (0x6000000000006000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02842, (gchar *) symbol_coverage [770], 4, 60, G_GUINT64_CONSTANT (0x0000600000006000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02843, (gchar *) symbol_coverage [771], 6, 58, G_GUINT64_CONSTANT (0x6000600000006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02844, (gchar *) symbol_coverage [772], 4, 60, G_GUINT64_CONSTANT (0x0000000060006000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02845, (gchar *) symbol_coverage [773], 6, 58, G_GUINT64_CONSTANT (0x6000000060006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02846, (gchar *) symbol_coverage [774], 6, 58, G_GUINT64_CONSTANT (0x0000600060006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02847, (gchar *) symbol_coverage [775], 8, 56, G_GUINT64_CONSTANT (0x6000600060006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02848, (gchar *) symbol_coverage [776], 4, 60, G_GUINT64_CONSTANT (0x0600000000006000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02849, (gchar *) symbol_coverage [777], 6, 58, G_GUINT64_CONSTANT (0x6600000000006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0284a, (gchar *) symbol_coverage [778], 6, 58, G_GUINT64_CONSTANT (0x0600600000006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0284b, (gchar *) symbol_coverage [779], 8, 56, G_GUINT64_CONSTANT (0x6600600000006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0284c, (gchar *) symbol_coverage [780], 6, 58, G_GUINT64_CONSTANT (0x0600000060006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0284d, (gchar *) symbol_coverage [781], 8, 56, G_GUINT64_CONSTANT (0x6600000060006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0284e, (gchar *) symbol_coverage [782], 8, 56, G_GUINT64_CONSTANT (0x0600600060006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0284f, (gchar *) symbol_coverage [783], 10, 54, G_GUINT64_CONSTANT (0x6600600060006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02850, (gchar *) symbol_coverage [784], 4, 60, G_GUINT64_CONSTANT (0x0000060000006000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02851, (gchar *) symbol_coverage [785], 6, 58, G_GUINT64_CONSTANT (0x6000060000006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02852, (gchar *) symbol_coverage [786], 6, 58, G_GUINT64_CONSTANT (0x0000660000006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02853, (gchar *) symbol_coverage [787], 8, 56, G_GUINT64_CONSTANT (0x6000660000006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02854, (gchar *) symbol_coverage [788], 6, 58, G_GUINT64_CONSTANT (0x0000060060006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02855, (gchar *) symbol_coverage [789], 8, 56, G_GUINT64_CONSTANT (0x6000060060006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02856, (gchar *) symbol_coverage [790], 8, 56, G_GUINT64_CONSTANT (0x0000660060006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02857, (gchar *) symbol_coverage [791], 10, 54, G_GUINT64_CONSTANT (0x6000660060006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02858, (gchar *) symbol_coverage [792], 6, 58, G_GUINT64_CONSTANT (0x0600060000006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02859, (gchar *) symbol_coverage [793], 8, 56, G_GUINT64_CONSTANT (0x6600060000006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0285a, (gchar *) symbol_coverage [794], 8, 56, G_GUINT64_CONSTANT (0x0600660000006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0285b, (gchar *) symbol_coverage [795], 10, 54, G_GUINT64_CONSTANT (0x6600660000006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0285c, (gchar *) symbol_coverage [796], 8, 56, G_GUINT64_CONSTANT (0x0600060060006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0285d, (gchar *) symbol_coverage [797], 10, 54, G_GUINT64_CONSTANT (0x6600060060006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0285e, (gchar *) symbol_coverage [798], 10, 54, G_GUINT64_CONSTANT (0x0600660060006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0285f, (gchar *) symbol_coverage [799], 12, 52, G_GUINT64_CONSTANT (0x6600660060006000), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x02860, (gchar *) symbol_coverage [800], 4, 60, G_GUINT64_CONSTANT (0x0000000006006000), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02861, (gchar *) symbol_coverage [801], 6, 58, G_GUINT64_CONSTANT (0x6000000006006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02862, (gchar *) symbol_coverage [802], 6, 58, G_GUINT64_CONSTANT (0x0000600006006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02863, (gchar *) symbol_coverage [803], 8, 56, G_GUINT64_CONSTANT (0x6000600006006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02864, (gchar *) symbol_coverage [804], 6, 58, G_GUINT64_CONSTANT (0x0000000066006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02865, (gchar *) symbol_coverage [805], 8, 56, G_GUINT64_CONSTANT (0x6000000066006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02866, (gchar *) symbol_coverage [806], 8, 56, G_GUINT64_CONSTANT (0x0000600066006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02867, (gchar *) symbol_coverage [807], 10, 54, G_GUINT64_CONSTANT (0x6000600066006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02868, (gchar *) symbol_coverage [808], 6, 58, G_GUINT64_CONSTANT (0x0600000006006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02869, (gchar *) symbol_coverage [809], 8, 56, G_GUINT64_CONSTANT (0x6600000006006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0286a, (gchar *) symbol_coverage [810], 8, 56, G_GUINT64_CONSTANT (0x0600600006006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0286b, (gchar *) symbol_coverage [811], 10, 54, G_GUINT64_CONSTANT (0x6600600006006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0286c, (gchar *) symbol_coverage [812], 8, 56, G_GUINT64_CONSTANT (0x0600000066006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0286d, (gchar *) symbol_coverage [813], 10, 54, G_GUINT64_CONSTANT (0x6600000066006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0286e, (gchar *) symbol_coverage [814], 10, 54, G_GUINT64_CONSTANT (0x0600600066006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0286f, (gchar *) symbol_coverage [815], 12, 52, G_GUINT64_CONSTANT (0x6600600066006000), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x02870, (gchar *) symbol_coverage [816], 6, 58, G_GUINT64_CONSTANT (0x0000060006006000), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02871, (gchar *) symbol_coverage [817], 8, 56, G_GUINT64_CONSTANT (0x6000060006006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02872, (gchar *) symbol_coverage [818], 8, 56, G_GUINT64_CONSTANT (0x0000660006006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02873, (gchar *) symbol_coverage [819], 10, 54, G_GUINT64_CONSTANT (0x6000660006006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02874, (gchar *) symbol_coverage [820], 8, 56, G_GUINT64_CONSTANT (0x0000060066006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02875, (gchar *) symbol_coverage [821], 10, 54, G_GUINT64_CONSTANT (0x6000060066006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02876, (gchar *) symbol_coverage [822], 10, 54, G_GUINT64_CONSTANT (0x0000660066006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02877, (gchar *) symbol_coverage [823], 12, 52, G_GUINT64_CONSTANT (0x6000660066006000), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x02878, (gchar *) symbol_coverage [824], 8, 56, G_GUINT64_CONSTANT (0x0600060006006000), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02879, (gchar *) symbol_coverage [825], 10, 54, G_GUINT64_CONSTANT (0x6600060006006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0287a, (gchar *) symbol_coverage [826], 10, 54, G_GUINT64_CONSTANT (0x0600660006006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0287b, (gchar *) symbol_coverage [827], 12, 52, G_GUINT64_CONSTANT (0x6600660006006000), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x0287c, (gchar *) symbol_coverage [828], 10, 54, G_GUINT64_CONSTANT (0x0600060066006000), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0287d, (gchar *) symbol_coverage [829], 12, 52, G_GUINT64_CONSTANT (0x6600060066006000), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x0287e, (gchar *) symbol_coverage [830], 12, 52, G_GUINT64_CONSTANT (0x0600660066006000), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x0287f, (gchar *) symbol_coverage [831], 14, 50, G_GUINT64_CONSTANT (0x6600660066006000), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x02880, (gchar *) symbol_coverage [832], 2, 62, G_GUINT64_CONSTANT (0x0000000000000600), 2 },
+    { (ChafaSymbolTags) 0x00000800, 0x02881, (gchar *) symbol_coverage [833], 4, 60, G_GUINT64_CONSTANT (0x6000000000000600), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02882, (gchar *) symbol_coverage [834], 4, 60, G_GUINT64_CONSTANT (0x0000600000000600), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02883, (gchar *) symbol_coverage [835], 6, 58, G_GUINT64_CONSTANT (0x6000600000000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02884, (gchar *) symbol_coverage [836], 4, 60, G_GUINT64_CONSTANT (0x0000000060000600), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02885, (gchar *) symbol_coverage [837], 6, 58, G_GUINT64_CONSTANT (0x6000000060000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02886, (gchar *) symbol_coverage [838], 6, 58, G_GUINT64_CONSTANT (0x0000600060000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02887, (gchar *) symbol_coverage [839], 8, 56, G_GUINT64_CONSTANT (0x6000600060000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02888, (gchar *) symbol_coverage [840], 4, 60, G_GUINT64_CONSTANT (0x0600000000000600), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02889, (gchar *) symbol_coverage [841], 6, 58, G_GUINT64_CONSTANT (0x6600000000000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0288a, (gchar *) symbol_coverage [842], 6, 58, G_GUINT64_CONSTANT (0x0600600000000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0288b, (gchar *) symbol_coverage [843], 8, 56, G_GUINT64_CONSTANT (0x6600600000000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0288c, (gchar *) symbol_coverage [844], 6, 58, G_GUINT64_CONSTANT (0x0600000060000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x0288d, (gchar *) symbol_coverage [845], 8, 56, G_GUINT64_CONSTANT (0x6600000060000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0288e, (gchar *) symbol_coverage [846], 8, 56, G_GUINT64_CONSTANT (0x0600600060000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0288f, (gchar *) symbol_coverage [847], 10, 54, G_GUINT64_CONSTANT (0x6600600060000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02890, (gchar *) symbol_coverage [848], 4, 60, G_GUINT64_CONSTANT (0x0000060000000600), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x02891, (gchar *) symbol_coverage [849], 6, 58, G_GUINT64_CONSTANT (0x6000060000000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02892, (gchar *) symbol_coverage [850], 6, 58, G_GUINT64_CONSTANT (0x0000660000000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02893, (gchar *) symbol_coverage [851], 8, 56, G_GUINT64_CONSTANT (0x6000660000000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02894, (gchar *) symbol_coverage [852], 6, 58, G_GUINT64_CONSTANT (0x0000060060000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02895, (gchar *) symbol_coverage [853], 8, 56, G_GUINT64_CONSTANT (0x6000060060000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02896, (gchar *) symbol_coverage [854], 8, 56, G_GUINT64_CONSTANT (0x0000660060000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x02897, (gchar *) symbol_coverage [855], 10, 54, G_GUINT64_CONSTANT (0x6000660060000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x02898, (gchar *) symbol_coverage [856], 6, 58, G_GUINT64_CONSTANT (0x0600060000000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x02899, (gchar *) symbol_coverage [857], 8, 56, G_GUINT64_CONSTANT (0x6600060000000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0289a, (gchar *) symbol_coverage [858], 8, 56, G_GUINT64_CONSTANT (0x0600660000000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0289b, (gchar *) symbol_coverage [859], 10, 54, G_GUINT64_CONSTANT (0x6600660000000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0289c, (gchar *) symbol_coverage [860], 8, 56, G_GUINT64_CONSTANT (0x0600060060000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x0289d, (gchar *) symbol_coverage [861], 10, 54, G_GUINT64_CONSTANT (0x6600060060000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0289e, (gchar *) symbol_coverage [862], 10, 54, G_GUINT64_CONSTANT (0x0600660060000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x0289f, (gchar *) symbol_coverage [863], 12, 52, G_GUINT64_CONSTANT (0x6600660060000600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a0, (gchar *) symbol_coverage [864], 4, 60, G_GUINT64_CONSTANT (0x0000000006000600), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a1, (gchar *) symbol_coverage [865], 6, 58, G_GUINT64_CONSTANT (0x6000000006000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a2, (gchar *) symbol_coverage [866], 6, 58, G_GUINT64_CONSTANT (0x0000600006000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a3, (gchar *) symbol_coverage [867], 8, 56, G_GUINT64_CONSTANT (0x6000600006000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a4, (gchar *) symbol_coverage [868], 6, 58, G_GUINT64_CONSTANT (0x0000000066000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a5, (gchar *) symbol_coverage [869], 8, 56, G_GUINT64_CONSTANT (0x6000000066000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a6, (gchar *) symbol_coverage [870], 8, 56, G_GUINT64_CONSTANT (0x0000600066000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a7, (gchar *) symbol_coverage [871], 10, 54, G_GUINT64_CONSTANT (0x6000600066000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a8, (gchar *) symbol_coverage [872], 6, 58, G_GUINT64_CONSTANT (0x0600000006000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028a9, (gchar *) symbol_coverage [873], 8, 56, G_GUINT64_CONSTANT (0x6600000006000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028aa, (gchar *) symbol_coverage [874], 8, 56, G_GUINT64_CONSTANT (0x0600600006000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ab, (gchar *) symbol_coverage [875], 10, 54, G_GUINT64_CONSTANT (0x6600600006000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ac, (gchar *) symbol_coverage [876], 8, 56, G_GUINT64_CONSTANT (0x0600000066000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ad, (gchar *) symbol_coverage [877], 10, 54, G_GUINT64_CONSTANT (0x6600000066000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ae, (gchar *) symbol_coverage [878], 10, 54, G_GUINT64_CONSTANT (0x0600600066000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028af, (gchar *) symbol_coverage [879], 12, 52, G_GUINT64_CONSTANT (0x6600600066000600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b0, (gchar *) symbol_coverage [880], 6, 58, G_GUINT64_CONSTANT (0x0000060006000600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b1, (gchar *) symbol_coverage [881], 8, 56, G_GUINT64_CONSTANT (0x6000060006000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b2, (gchar *) symbol_coverage [882], 8, 56, G_GUINT64_CONSTANT (0x0000660006000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b3, (gchar *) symbol_coverage [883], 10, 54, G_GUINT64_CONSTANT (0x6000660006000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b4, (gchar *) symbol_coverage [884], 8, 56, G_GUINT64_CONSTANT (0x0000060066000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b5, (gchar *) symbol_coverage [885], 10, 54, G_GUINT64_CONSTANT (0x6000060066000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b6, (gchar *) symbol_coverage [886], 10, 54, G_GUINT64_CONSTANT (0x0000660066000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b7, (gchar *) symbol_coverage [887], 12, 52, G_GUINT64_CONSTANT (0x6000660066000600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b8, (gchar *) symbol_coverage [888], 8, 56, G_GUINT64_CONSTANT (0x0600060006000600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028b9, (gchar *) symbol_coverage [889], 10, 54, G_GUINT64_CONSTANT (0x6600060006000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ba, (gchar *) symbol_coverage [890], 10, 54, G_GUINT64_CONSTANT (0x0600660006000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028bb, (gchar *) symbol_coverage [891], 12, 52, G_GUINT64_CONSTANT (0x6600660006000600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028bc, (gchar *) symbol_coverage [892], 10, 54, G_GUINT64_CONSTANT (0x0600060066000600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028bd, (gchar *) symbol_coverage [893], 12, 52, G_GUINT64_CONSTANT (0x6600060066000600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028be, (gchar *) symbol_coverage [894], 12, 52, G_GUINT64_CONSTANT (0x0600660066000600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028bf, (gchar *) symbol_coverage [895], 14, 50, G_GUINT64_CONSTANT (0x6600660066000600), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c0, (gchar *) symbol_coverage [896], 4, 60, G_GUINT64_CONSTANT (0x0000000000006600), 4 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c1, (gchar *) symbol_coverage [897], 6, 58, G_GUINT64_CONSTANT (0x6000000000006600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c2, (gchar *) symbol_coverage [898], 6, 58, G_GUINT64_CONSTANT (0x0000600000006600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c3, (gchar *) symbol_coverage [899], 8, 56, G_GUINT64_CONSTANT (0x6000600000006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c4, (gchar *) symbol_coverage [900], 6, 58, G_GUINT64_CONSTANT (0x0000000060006600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c5, (gchar *) symbol_coverage [901], 8, 56, G_GUINT64_CONSTANT (0x6000000060006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c6, (gchar *) symbol_coverage [902], 8, 56, G_GUINT64_CONSTANT (0x0000600060006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c7, (gchar *) symbol_coverage [903], 10, 54, G_GUINT64_CONSTANT (0x6000600060006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c8, (gchar *) symbol_coverage [904], 6, 58, G_GUINT64_CONSTANT (0x0600000000006600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028c9, (gchar *) symbol_coverage [905], 8, 56, G_GUINT64_CONSTANT (0x6600000000006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ca, (gchar *) symbol_coverage [906], 8, 56, G_GUINT64_CONSTANT (0x0600600000006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028cb, (gchar *) symbol_coverage [907], 10, 54, G_GUINT64_CONSTANT (0x6600600000006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028cc, (gchar *) symbol_coverage [908], 8, 56, G_GUINT64_CONSTANT (0x0600000060006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028cd, (gchar *) symbol_coverage [909], 10, 54, G_GUINT64_CONSTANT (0x6600000060006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ce, (gchar *) symbol_coverage [910], 10, 54, G_GUINT64_CONSTANT (0x0600600060006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028cf, (gchar *) symbol_coverage [911], 12, 52, G_GUINT64_CONSTANT (0x6600600060006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d0, (gchar *) symbol_coverage [912], 6, 58, G_GUINT64_CONSTANT (0x0000060000006600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d1, (gchar *) symbol_coverage [913], 8, 56, G_GUINT64_CONSTANT (0x6000060000006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d2, (gchar *) symbol_coverage [914], 8, 56, G_GUINT64_CONSTANT (0x0000660000006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d3, (gchar *) symbol_coverage [915], 10, 54, G_GUINT64_CONSTANT (0x6000660000006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d4, (gchar *) symbol_coverage [916], 8, 56, G_GUINT64_CONSTANT (0x0000060060006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d5, (gchar *) symbol_coverage [917], 10, 54, G_GUINT64_CONSTANT (0x6000060060006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d6, (gchar *) symbol_coverage [918], 10, 54, G_GUINT64_CONSTANT (0x0000660060006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d7, (gchar *) symbol_coverage [919], 12, 52, G_GUINT64_CONSTANT (0x6000660060006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d8, (gchar *) symbol_coverage [920], 8, 56, G_GUINT64_CONSTANT (0x0600060000006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028d9, (gchar *) symbol_coverage [921], 10, 54, G_GUINT64_CONSTANT (0x6600060000006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028da, (gchar *) symbol_coverage [922], 10, 54, G_GUINT64_CONSTANT (0x0600660000006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028db, (gchar *) symbol_coverage [923], 12, 52, G_GUINT64_CONSTANT (0x6600660000006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028dc, (gchar *) symbol_coverage [924], 10, 54, G_GUINT64_CONSTANT (0x0600060060006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028dd, (gchar *) symbol_coverage [925], 12, 52, G_GUINT64_CONSTANT (0x6600060060006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028de, (gchar *) symbol_coverage [926], 12, 52, G_GUINT64_CONSTANT (0x0600660060006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028df, (gchar *) symbol_coverage [927], 14, 50, G_GUINT64_CONSTANT (0x6600660060006600), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e0, (gchar *) symbol_coverage [928], 6, 58, G_GUINT64_CONSTANT (0x0000000006006600), 6 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e1, (gchar *) symbol_coverage [929], 8, 56, G_GUINT64_CONSTANT (0x6000000006006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e2, (gchar *) symbol_coverage [930], 8, 56, G_GUINT64_CONSTANT (0x0000600006006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e3, (gchar *) symbol_coverage [931], 10, 54, G_GUINT64_CONSTANT (0x6000600006006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e4, (gchar *) symbol_coverage [932], 8, 56, G_GUINT64_CONSTANT (0x0000000066006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e5, (gchar *) symbol_coverage [933], 10, 54, G_GUINT64_CONSTANT (0x6000000066006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e6, (gchar *) symbol_coverage [934], 10, 54, G_GUINT64_CONSTANT (0x0000600066006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e7, (gchar *) symbol_coverage [935], 12, 52, G_GUINT64_CONSTANT (0x6000600066006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e8, (gchar *) symbol_coverage [936], 8, 56, G_GUINT64_CONSTANT (0x0600000006006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028e9, (gchar *) symbol_coverage [937], 10, 54, G_GUINT64_CONSTANT (0x6600000006006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ea, (gchar *) symbol_coverage [938], 10, 54, G_GUINT64_CONSTANT (0x0600600006006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028eb, (gchar *) symbol_coverage [939], 12, 52, G_GUINT64_CONSTANT (0x6600600006006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ec, (gchar *) symbol_coverage [940], 10, 54, G_GUINT64_CONSTANT (0x0600000066006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ed, (gchar *) symbol_coverage [941], 12, 52, G_GUINT64_CONSTANT (0x6600000066006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ee, (gchar *) symbol_coverage [942], 12, 52, G_GUINT64_CONSTANT (0x0600600066006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ef, (gchar *) symbol_coverage [943], 14, 50, G_GUINT64_CONSTANT (0x6600600066006600), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f0, (gchar *) symbol_coverage [944], 8, 56, G_GUINT64_CONSTANT (0x0000060006006600), 8 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f1, (gchar *) symbol_coverage [945], 10, 54, G_GUINT64_CONSTANT (0x6000060006006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f2, (gchar *) symbol_coverage [946], 10, 54, G_GUINT64_CONSTANT (0x0000660006006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f3, (gchar *) symbol_coverage [947], 12, 52, G_GUINT64_CONSTANT (0x6000660006006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f4, (gchar *) symbol_coverage [948], 10, 54, G_GUINT64_CONSTANT (0x0000060066006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f5, (gchar *) symbol_coverage [949], 12, 52, G_GUINT64_CONSTANT (0x6000060066006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f6, (gchar *) symbol_coverage [950], 12, 52, G_GUINT64_CONSTANT (0x0000660066006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f7, (gchar *) symbol_coverage [951], 14, 50, G_GUINT64_CONSTANT (0x6000660066006600), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f8, (gchar *) symbol_coverage [952], 10, 54, G_GUINT64_CONSTANT (0x0600060006006600), 10 },
+    { (ChafaSymbolTags) 0x00000800, 0x028f9, (gchar *) symbol_coverage [953], 12, 52, G_GUINT64_CONSTANT (0x6600060006006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028fa, (gchar *) symbol_coverage [954], 12, 52, G_GUINT64_CONSTANT (0x0600660006006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028fb, (gchar *) symbol_coverage [955], 14, 50, G_GUINT64_CONSTANT (0x6600660006006600), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x028fc, (gchar *) symbol_coverage [956], 12, 52, G_GUINT64_CONSTANT (0x0600060066006600), 12 },
+    { (ChafaSymbolTags) 0x00000800, 0x028fd, (gchar *) symbol_coverage [957], 14, 50, G_GUINT64_CONSTANT (0x6600060066006600), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x028fe, (gchar *) symbol_coverage [958], 14, 50, G_GUINT64_CONSTANT (0x0600660066006600), 14 },
+    { (ChafaSymbolTags) 0x00000800, 0x028ff, (gchar *) symbol_coverage [959], 16, 48, G_GUINT64_CONSTANT (0x6600660066006600), 16 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb00, (gchar *) symbol_coverage [960], 12, 52, G_GUINT64_CONSTANT (0xf0f0f00000000000), 12 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb01, (gchar *) symbol_coverage [961], 12, 52, G_GUINT64_CONSTANT (0x0f0f0f0000000000), 12 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb02, (gchar *) symbol_coverage [962], 24, 40, G_GUINT64_CONSTANT (0xffffff0000000000), 24 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb03, (gchar *) symbol_coverage [963], 8, 56, G_GUINT64_CONSTANT (0x000000f0f0000000), 8 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb04, (gchar *) symbol_coverage [964], 20, 44, G_GUINT64_CONSTANT (0xf0f0f0f0f0000000), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb05, (gchar *) symbol_coverage [965], 20, 44, G_GUINT64_CONSTANT (0x0f0f0ff0f0000000), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb06, (gchar *) symbol_coverage [966], 32, 32, G_GUINT64_CONSTANT (0xfffffff0f0000000), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb07, (gchar *) symbol_coverage [967], 8, 56, G_GUINT64_CONSTANT (0x0000000f0f000000), 8 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb08, (gchar *) symbol_coverage [968], 20, 44, G_GUINT64_CONSTANT (0xf0f0f00f0f000000), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb09, (gchar *) symbol_coverage [969], 20, 44, G_GUINT64_CONSTANT (0x0f0f0f0f0f000000), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb0a, (gchar *) symbol_coverage [970], 32, 32, G_GUINT64_CONSTANT (0xffffff0f0f000000), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb0b, (gchar *) symbol_coverage [971], 16, 48, G_GUINT64_CONSTANT (0x000000ffff000000), 16 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb0c, (gchar *) symbol_coverage [972], 28, 36, G_GUINT64_CONSTANT (0xf0f0f0ffff000000), 28 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb0d, (gchar *) symbol_coverage [973], 28, 36, G_GUINT64_CONSTANT (0x0f0f0fffff000000), 28 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb0e, (gchar *) symbol_coverage [974], 40, 24, G_GUINT64_CONSTANT (0xffffffffff000000), 40 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb0f, (gchar *) symbol_coverage [975], 12, 52, G_GUINT64_CONSTANT (0x0000000000f0f0f0), 12 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb10, (gchar *) symbol_coverage [976], 24, 40, G_GUINT64_CONSTANT (0xf0f0f00000f0f0f0), 24 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb11, (gchar *) symbol_coverage [977], 24, 40, G_GUINT64_CONSTANT (0x0f0f0f0000f0f0f0), 24 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb12, (gchar *) symbol_coverage [978], 36, 28, G_GUINT64_CONSTANT (0xffffff0000f0f0f0), 36 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb13, (gchar *) symbol_coverage [979], 20, 44, G_GUINT64_CONSTANT (0x000000f0f0f0f0f0), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb14, (gchar *) symbol_coverage [980], 32, 32, G_GUINT64_CONSTANT (0x0f0f0ff0f0f0f0f0), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb15, (gchar *) symbol_coverage [981], 44, 20, G_GUINT64_CONSTANT (0xfffffff0f0f0f0f0), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb16, (gchar *) symbol_coverage [982], 20, 44, G_GUINT64_CONSTANT (0x0000000f0ff0f0f0), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb17, (gchar *) symbol_coverage [983], 32, 32, G_GUINT64_CONSTANT (0xf0f0f00f0ff0f0f0), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb18, (gchar *) symbol_coverage [984], 32, 32, G_GUINT64_CONSTANT (0x0f0f0f0f0ff0f0f0), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb19, (gchar *) symbol_coverage [985], 44, 20, G_GUINT64_CONSTANT (0xffffff0f0ff0f0f0), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb1a, (gchar *) symbol_coverage [986], 28, 36, G_GUINT64_CONSTANT (0x000000fffff0f0f0), 28 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb1b, (gchar *) symbol_coverage [987], 40, 24, G_GUINT64_CONSTANT (0xf0f0f0fffff0f0f0), 40 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb1c, (gchar *) symbol_coverage [988], 40, 24, G_GUINT64_CONSTANT (0x0f0f0ffffff0f0f0), 40 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb1d, (gchar *) symbol_coverage [989], 52, 12, G_GUINT64_CONSTANT (0xfffffffffff0f0f0), 52 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb1e, (gchar *) symbol_coverage [990], 12, 52, G_GUINT64_CONSTANT (0x00000000000f0f0f), 12 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb1f, (gchar *) symbol_coverage [991], 24, 40, G_GUINT64_CONSTANT (0xf0f0f000000f0f0f), 24 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb20, (gchar *) symbol_coverage [992], 24, 40, G_GUINT64_CONSTANT (0x0f0f0f00000f0f0f), 24 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb21, (gchar *) symbol_coverage [993], 36, 28, G_GUINT64_CONSTANT (0xffffff00000f0f0f), 36 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb22, (gchar *) symbol_coverage [994], 20, 44, G_GUINT64_CONSTANT (0x000000f0f00f0f0f), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb23, (gchar *) symbol_coverage [995], 32, 32, G_GUINT64_CONSTANT (0xf0f0f0f0f00f0f0f), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb24, (gchar *) symbol_coverage [996], 32, 32, G_GUINT64_CONSTANT (0x0f0f0ff0f00f0f0f), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb25, (gchar *) symbol_coverage [997], 44, 20, G_GUINT64_CONSTANT (0xfffffff0f00f0f0f), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb26, (gchar *) symbol_coverage [998], 20, 44, G_GUINT64_CONSTANT (0x0000000f0f0f0f0f), 20 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb27, (gchar *) symbol_coverage [999], 32, 32, G_GUINT64_CONSTANT (0xf0f0f00f0f0f0f0f), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb28, (gchar *) symbol_coverage [1000], 44, 20, G_GUINT64_CONSTANT (0xffffff0f0f0f0f0f), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb29, (gchar *) symbol_coverage [1001], 28, 36, G_GUINT64_CONSTANT (0x000000ffff0f0f0f), 28 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb2a, (gchar *) symbol_coverage [1002], 40, 24, G_GUINT64_CONSTANT (0xf0f0f0ffff0f0f0f), 40 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb2b, (gchar *) symbol_coverage [1003], 40, 24, G_GUINT64_CONSTANT (0x0f0f0fffff0f0f0f), 40 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb2c, (gchar *) symbol_coverage [1004], 52, 12, G_GUINT64_CONSTANT (0xffffffffff0f0f0f), 52 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb2d, (gchar *) symbol_coverage [1005], 24, 40, G_GUINT64_CONSTANT (0x0000000000ffffff), 24 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb2e, (gchar *) symbol_coverage [1006], 36, 28, G_GUINT64_CONSTANT (0xf0f0f00000ffffff), 36 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb2f, (gchar *) symbol_coverage [1007], 36, 28, G_GUINT64_CONSTANT (0x0f0f0f0000ffffff), 36 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb30, (gchar *) symbol_coverage [1008], 48, 16, G_GUINT64_CONSTANT (0xffffff0000ffffff), 48 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb31, (gchar *) symbol_coverage [1009], 32, 32, G_GUINT64_CONSTANT (0x000000f0f0ffffff), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb32, (gchar *) symbol_coverage [1010], 44, 20, G_GUINT64_CONSTANT (0xf0f0f0f0f0ffffff), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb33, (gchar *) symbol_coverage [1011], 44, 20, G_GUINT64_CONSTANT (0x0f0f0ff0f0ffffff), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb34, (gchar *) symbol_coverage [1012], 56, 8, G_GUINT64_CONSTANT (0xfffffff0f0ffffff), 56 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb35, (gchar *) symbol_coverage [1013], 32, 32, G_GUINT64_CONSTANT (0x0000000f0fffffff), 32 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb36, (gchar *) symbol_coverage [1014], 44, 20, G_GUINT64_CONSTANT (0xf0f0f00f0fffffff), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb37, (gchar *) symbol_coverage [1015], 44, 20, G_GUINT64_CONSTANT (0x0f0f0f0f0fffffff), 44 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb38, (gchar *) symbol_coverage [1016], 56, 8, G_GUINT64_CONSTANT (0xffffff0f0fffffff), 56 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb39, (gchar *) symbol_coverage [1017], 40, 24, G_GUINT64_CONSTANT (0x000000ffffffffff), 40 },
+    { (ChafaSymbolTags) 0x00600000, 0x1fb3a, (gchar *) symbol_coverage [1018], 52, 12, G_GUINT64_CONSTANT (0xf0f0f0ffffffffff), 52 },
+    { 0, 0, NULL, 0, 0, 0, 0 }
+};
+
+const ChafaSymbol2 chafa_symbols2 [182] =
+{
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03041, (gchar *) symbol_coverage [1019], 17, 47, G_GUINT64_CONSTANT (0x00001f02071a130c), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x03041, (gchar *) symbol_coverage [1020], 16, 48, G_GUINT64_CONSTANT (0x0000f020d88c0870), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03042, (gchar *) symbol_coverage [1021], 23, 41, G_GUINT64_CONSTANT (0x033f02071a22231c), 23 },
+    { (ChafaSymbolTags) 0x00048000, 0x03042, (gchar *) symbol_coverage [1022], 21, 43, G_GUINT64_CONSTANT (0x00f830f844840478), 21 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03043, (gchar *) symbol_coverage [1023], 8, 56, G_GUINT64_CONSTANT (0x0000101010100906), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x03043, (gchar *) symbol_coverage [1024], 4, 60, G_GUINT64_CONSTANT (0x0000001008080800), 4 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03044, (gchar *) symbol_coverage [1025], 14, 50, G_GUINT64_CONSTANT (0x003020203011190e), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x03044, (gchar *) symbol_coverage [1026], 7, 57, G_GUINT64_CONSTANT (0x0000180c04060000), 7 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03045, (gchar *) symbol_coverage [1027], 8, 56, G_GUINT64_CONSTANT (0x000300030c000003), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x03045, (gchar *) symbol_coverage [1028], 11, 53, G_GUINT64_CONSTANT (0x00c000c0301030c0), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03046, (gchar *) symbol_coverage [1029], 11, 53, G_GUINT64_CONSTANT (0x0007011e00000007), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03046, (gchar *) symbol_coverage [1030], 13, 51, G_GUINT64_CONSTANT (0x00e0c03808106080), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03047, (gchar *) symbol_coverage [1031], 11, 53, G_GUINT64_CONSTANT (0x000003000f010618), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03047, (gchar *) symbol_coverage [1032], 13, 51, G_GUINT64_CONSTANT (0x0000e000e080c078), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03048, (gchar *) symbol_coverage [1033], 15, 49, G_GUINT64_CONSTANT (0x0007001f01071820), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x03048, (gchar *) symbol_coverage [1034], 14, 50, G_GUINT64_CONSTANT (0x00e000e080c0403c), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03049, (gchar *) symbol_coverage [1035], 17, 47, G_GUINT64_CONSTANT (0x0000021f020f121e), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x03049, (gchar *) symbol_coverage [1036], 14, 50, G_GUINT64_CONSTANT (0x0000009c00f808f0), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0304a, (gchar *) symbol_coverage [1037], 22, 42, G_GUINT64_CONSTANT (0x06043f040f34241c), 22 },
+    { (ChafaSymbolTags) 0x00048000, 0x0304a, (gchar *) symbol_coverage [1038], 17, 47, G_GUINT64_CONSTANT (0x00108e609c0408f0), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0304b, (gchar *) symbol_coverage [1039], 19, 45, G_GUINT64_CONSTANT (0x02067f0408183023), 19 },
+    { (ChafaSymbolTags) 0x00048000, 0x0304b, (gchar *) symbol_coverage [1040], 14, 50, G_GUINT64_CONSTANT (0x0008cc2622604080), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0304c, (gchar *) symbol_coverage [1041], 20, 44, G_GUINT64_CONSTANT (0x06047f0c08103027), 20 },
+    { (ChafaSymbolTags) 0x00048000, 0x0304c, (gchar *) symbol_coverage [1042], 15, 49, G_GUINT64_CONSTANT (0x0a04c86462404080), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0304d, (gchar *) symbol_coverage [1043], 16, 48, G_GUINT64_CONSTANT (0x0018071f0010100f), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x0304d, (gchar *) symbol_coverage [1044], 21, 43, G_GUINT64_CONSTANT (0x80f840f8307000f0), 21 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0304e, (gchar *) symbol_coverage [1045], 21, 43, G_GUINT64_CONSTANT (0x01310e3b0410301f), 21 },
+    { (ChafaSymbolTags) 0x00048000, 0x0304e, (gchar *) symbol_coverage [1046], 22, 42, G_GUINT64_CONSTANT (0x16f880f820f000e0), 22 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0304f, (gchar *) symbol_coverage [1047], 8, 56, G_GUINT64_CONSTANT (0x0000010618060100), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x0304f, (gchar *) symbol_coverage [1048], 6, 58, G_GUINT64_CONSTANT (0x006080000000c020), 6 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03050, (gchar *) symbol_coverage [1049], 9, 55, G_GUINT64_CONSTANT (0x0000010e18060100), 9 },
+    { (ChafaSymbolTags) 0x00048000, 0x03050, (gchar *) symbol_coverage [1050], 8, 56, G_GUINT64_CONSTANT (0x0060802800008060), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03051, (gchar *) symbol_coverage [1051], 11, 53, G_GUINT64_CONSTANT (0x0030232020303000), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03051, (gchar *) symbol_coverage [1052], 15, 49, G_GUINT64_CONSTANT (0x1010fe10101020c0), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03052, (gchar *) symbol_coverage [1053], 13, 51, G_GUINT64_CONSTANT (0x0030232020303011), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x03052, (gchar *) symbol_coverage [1054], 18, 46, G_GUINT64_CONSTANT (0x0a14fe10103020c0), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03053, (gchar *) symbol_coverage [1055], 10, 54, G_GUINT64_CONSTANT (0x000f000000101807), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x03053, (gchar *) symbol_coverage [1056], 9, 55, G_GUINT64_CONSTANT (0x00f00000000000f8), 9 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03054, (gchar *) symbol_coverage [1057], 11, 53, G_GUINT64_CONSTANT (0x001f00000010100f), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03054, (gchar *) symbol_coverage [1058], 12, 52, G_GUINT64_CONSTANT (0x0af40000000000f8), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03055, (gchar *) symbol_coverage [1059], 11, 53, G_GUINT64_CONSTANT (0x00001f0000101807), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03055, (gchar *) symbol_coverage [1060], 17, 47, G_GUINT64_CONSTANT (0x8044f820186000f0), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03056, (gchar *) symbol_coverage [1061], 12, 52, G_GUINT64_CONSTANT (0x00003f000010100f), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x03056, (gchar *) symbol_coverage [1062], 19, 45, G_GUINT64_CONSTANT (0x8ac0f820906000f0), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03057, (gchar *) symbol_coverage [1063], 10, 54, G_GUINT64_CONSTANT (0x0808080808080807), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x03057, (gchar *) symbol_coverage [1064], 7, 57, G_GUINT64_CONSTANT (0x0000000000040cf0), 7 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03058, (gchar *) symbol_coverage [1065], 11, 53, G_GUINT64_CONSTANT (0x080808080808080f), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03058, (gchar *) symbol_coverage [1066], 10, 54, G_GUINT64_CONSTANT (0x0058200000000cf0), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03059, (gchar *) symbol_coverage [1067], 15, 49, G_GUINT64_CONSTANT (0x000f300304070007), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x03059, (gchar *) symbol_coverage [1068], 16, 48, G_GUINT64_CONSTANT (0x40fe40c040c0c000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0305a, (gchar *) symbol_coverage [1069], 18, 46, G_GUINT64_CONSTANT (0x000f30070c07010e), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x0305a, (gchar *) symbol_coverage [1070], 16, 48, G_GUINT64_CONSTANT (0xd4fc808040c08000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0305b, (gchar *) symbol_coverage [1071], 15, 49, G_GUINT64_CONSTANT (0x0008087f08080c03), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x0305b, (gchar *) symbol_coverage [1072], 18, 46, G_GUINT64_CONSTANT (0x00103ed0306000f8), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0305c, (gchar *) symbol_coverage [1073], 15, 49, G_GUINT64_CONSTANT (0x0008087f08080807), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x0305c, (gchar *) symbol_coverage [1074], 19, 45, G_GUINT64_CONSTANT (0x02243ce020e000f8), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0305d, (gchar *) symbol_coverage [1075], 13, 51, G_GUINT64_CONSTANT (0x0007010639020201), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x0305d, (gchar *) symbol_coverage [1076], 17, 47, G_GUINT64_CONSTANT (0xf060801ce00000f0), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0305e, (gchar *) symbol_coverage [1077], 17, 47, G_GUINT64_CONSTANT (0x000f01067b040601), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x0305e, (gchar *) symbol_coverage [1078], 17, 47, G_GUINT64_CONSTANT (0xe0c4183cc00000e0), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0305f, (gchar *) symbol_coverage [1079], 15, 49, G_GUINT64_CONSTANT (0x023f040408181030), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x0305f, (gchar *) symbol_coverage [1080], 14, 50, G_GUINT64_CONSTANT (0x00c0007c0080807c), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03060, (gchar *) symbol_coverage [1081], 20, 44, G_GUINT64_CONSTANT (0x06047f0c08113160), 20 },
+    { (ChafaSymbolTags) 0x00048000, 0x03060, (gchar *) symbol_coverage [1082], 16, 48, G_GUINT64_CONSTANT (0x040a80fc000000fc), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03061, (gchar *) symbol_coverage [1083], 18, 46, G_GUINT64_CONSTANT (0x063f04080f100007), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x03061, (gchar *) symbol_coverage [1084], 16, 48, G_GUINT64_CONSTANT (0x00f80040380c18e0), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03062, (gchar *) symbol_coverage [1085], 18, 46, G_GUINT64_CONSTANT (0x00047f081f100007), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x03062, (gchar *) symbol_coverage [1086], 17, 47, G_GUINT64_CONSTANT (0x1a08e000f00818e0), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03063, (gchar *) symbol_coverage [1087], 7, 57, G_GUINT64_CONSTANT (0x0000000718000003), 7 },
+    { (ChafaSymbolTags) 0x00048000, 0x03063, (gchar *) symbol_coverage [1088], 11, 53, G_GUINT64_CONSTANT (0x000000f00c0830c0), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03064, (gchar *) symbol_coverage [1089], 10, 54, G_GUINT64_CONSTANT (0x00007f0000000700), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x03064, (gchar *) symbol_coverage [1090], 14, 50, G_GUINT64_CONSTANT (0x00e01c060418e000), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03065, (gchar *) symbol_coverage [1091], 10, 54, G_GUINT64_CONSTANT (0x0000077800000007), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x03065, (gchar *) symbol_coverage [1092], 16, 48, G_GUINT64_CONSTANT (0x040af804040c30c0), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03066, (gchar *) symbol_coverage [1093], 12, 52, G_GUINT64_CONSTANT (0x003f000302030100), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x03066, (gchar *) symbol_coverage [1094], 11, 53, G_GUINT64_CONSTANT (0x00fc800000008070), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03067, (gchar *) symbol_coverage [1095], 13, 51, G_GUINT64_CONSTANT (0x003f010302030100), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x03067, (gchar *) symbol_coverage [1096], 15, 49, G_GUINT64_CONSTANT (0x00fc841a00008070), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03068, (gchar *) symbol_coverage [1097], 14, 50, G_GUINT64_CONSTANT (0x000c04030c181807), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x03068, (gchar *) symbol_coverage [1098], 10, 54, G_GUINT64_CONSTANT (0x00007880000000f8), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03069, (gchar *) symbol_coverage [1099], 12, 52, G_GUINT64_CONSTANT (0x0008040708101807), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x03069, (gchar *) symbol_coverage [1100], 12, 52, G_GUINT64_CONSTANT (0x020c7080000000f8), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0306a, (gchar *) symbol_coverage [1101], 19, 45, G_GUINT64_CONSTANT (0x02063d0c18300703), 19 },
+    { (ChafaSymbolTags) 0x00048000, 0x0306a, (gchar *) symbol_coverage [1102], 16, 48, G_GUINT64_CONSTANT (0x00009c202020fce0), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0306b, (gchar *) symbol_coverage [1103], 14, 50, G_GUINT64_CONSTANT (0x0011302020293130), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x0306b, (gchar *) symbol_coverage [1104], 12, 52, G_GUINT64_CONSTANT (0x00fc0000000000fc), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0306c, (gchar *) symbol_coverage [1105], 20, 44, G_GUINT64_CONSTANT (0x00201f392d463800), 20 },
+    { (ChafaSymbolTags) 0x00048000, 0x0306c, (gchar *) symbol_coverage [1106], 22, 42, G_GUINT64_CONSTANT (0x80c0b80404fc8e70), 22 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0306d, (gchar *) symbol_coverage [1107], 19, 45, G_GUINT64_CONSTANT (0x04047f0c1828480c), 19 },
+    { (ChafaSymbolTags) 0x00048000, 0x0306d, (gchar *) symbol_coverage [1108], 19, 45, G_GUINT64_CONSTANT (0x0020d80404fc8a70), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0306e, (gchar *) symbol_coverage [1109], 18, 46, G_GUINT64_CONSTANT (0x0007192163223c00), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x0306e, (gchar *) symbol_coverage [1110], 16, 48, G_GUINT64_CONSTANT (0x00f08c04060418e0), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0306f, (gchar *) symbol_coverage [1111], 15, 49, G_GUINT64_CONSTANT (0x0010232020313231), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x0306f, (gchar *) symbol_coverage [1112], 20, 44, G_GUINT64_CONSTANT (0x0010fc1010f816e0), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03070, (gchar *) symbol_coverage [1113], 16, 48, G_GUINT64_CONSTANT (0x0020232060732221), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x03070, (gchar *) symbol_coverage [1114], 24, 40, G_GUINT64_CONSTANT (0x0a24fc2030f836c0), 24 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03071, (gchar *) symbol_coverage [1115], 16, 48, G_GUINT64_CONSTANT (0x0020232060732221), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x03071, (gchar *) symbol_coverage [1116], 27, 37, G_GUINT64_CONSTANT (0x0f26fc2030f836c0), 27 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03072, (gchar *) symbol_coverage [1117], 18, 46, G_GUINT64_CONSTANT (0x003f0c181030100f), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x03072, (gchar *) symbol_coverage [1118], 12, 52, G_GUINT64_CONSTANT (0x00101818161020c0), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03073, (gchar *) symbol_coverage [1119], 18, 46, G_GUINT64_CONSTANT (0x007f08103020300f), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x03073, (gchar *) symbol_coverage [1120], 15, 49, G_GUINT64_CONSTANT (0x0a341018143020c0), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03074, (gchar *) symbol_coverage [1121], 18, 46, G_GUINT64_CONSTANT (0x007f08103020300f), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x03074, (gchar *) symbol_coverage [1122], 17, 47, G_GUINT64_CONSTANT (0x0e3a1418141020c0), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03075, (gchar *) symbol_coverage [1123], 11, 53, G_GUINT64_CONSTANT (0x0201000201087007), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03075, (gchar *) symbol_coverage [1124], 12, 52, G_GUINT64_CONSTANT (0x00c0c00088446280), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03076, (gchar *) symbol_coverage [1125], 11, 53, G_GUINT64_CONSTANT (0x0003000201186007), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03076, (gchar *) symbol_coverage [1126], 18, 46, G_GUINT64_CONSTANT (0x00c6ca0098c44680), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03077, (gchar *) symbol_coverage [1127], 11, 53, G_GUINT64_CONSTANT (0x0003000201186007), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x03077, (gchar *) symbol_coverage [1128], 20, 44, G_GUINT64_CONSTANT (0x00ceca0498c44680), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03078, (gchar *) symbol_coverage [1129], 7, 57, G_GUINT64_CONSTANT (0x0000070830400000), 7 },
+    { (ChafaSymbolTags) 0x00048000, 0x03078, (gchar *) symbol_coverage [1130], 8, 56, G_GUINT64_CONSTANT (0x000000c030180600), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03079, (gchar *) symbol_coverage [1131], 8, 56, G_GUINT64_CONSTANT (0x0000071830400000), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x03079, (gchar *) symbol_coverage [1132], 9, 55, G_GUINT64_CONSTANT (0x000410c020180600), 9 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0307a, (gchar *) symbol_coverage [1133], 8, 56, G_GUINT64_CONSTANT (0x0000071830400000), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x0307a, (gchar *) symbol_coverage [1134], 14, 50, G_GUINT64_CONSTANT (0x001c24d820180600), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0307b, (gchar *) symbol_coverage [1135], 16, 48, G_GUINT64_CONSTANT (0x0031202120313231), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x0307b, (gchar *) symbol_coverage [1136], 26, 38, G_GUINT64_CONSTANT (0x00fc30fc10f816e0), 26 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0307c, (gchar *) symbol_coverage [1137], 17, 47, G_GUINT64_CONSTANT (0x0023202360702321), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x0307c, (gchar *) symbol_coverage [1138], 24, 40, G_GUINT64_CONSTANT (0x0af420fc2020fcc0), 24 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0307d, (gchar *) symbol_coverage [1139], 17, 47, G_GUINT64_CONSTANT (0x0023202360702321), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x0307d, (gchar *) symbol_coverage [1140], 27, 37, G_GUINT64_CONSTANT (0x0ff620fc2020fcc0), 27 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0307e, (gchar *) symbol_coverage [1141], 20, 44, G_GUINT64_CONSTANT (0x001f001f000f101f), 20 },
+    { (ChafaSymbolTags) 0x00048000, 0x0307e, (gchar *) symbol_coverage [1142], 21, 43, G_GUINT64_CONSTANT (0x80f880fc80e09880), 21 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0307f, (gchar *) symbol_coverage [1143], 18, 46, G_GUINT64_CONSTANT (0x000f01033e447800), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x0307f, (gchar *) symbol_coverage [1144], 16, 48, G_GUINT64_CONSTANT (0x00808008f81e30c0), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03080, (gchar *) symbol_coverage [1145], 23, 41, G_GUINT64_CONSTANT (0x047f043c243c0807), 23 },
+    { (ChafaSymbolTags) 0x00048000, 0x03080, (gchar *) symbol_coverage [1146], 10, 54, G_GUINT64_CONSTANT (0x00980400000808f0), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03081, (gchar *) symbol_coverage [1147], 18, 46, G_GUINT64_CONSTANT (0x00100f1825633c00), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x03081, (gchar *) symbol_coverage [1148], 15, 49, G_GUINT64_CONSTANT (0x0040f08c84041860), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03082, (gchar *) symbol_coverage [1149], 19, 45, G_GUINT64_CONSTANT (0x02023f043f040403), 19 },
+    { (ChafaSymbolTags) 0x00048000, 0x03082, (gchar *) symbol_coverage [1150], 12, 52, G_GUINT64_CONSTANT (0x0000c000cc0408f0), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03083, (gchar *) symbol_coverage [1151], 12, 52, G_GUINT64_CONSTANT (0x000001091e220301), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x03083, (gchar *) symbol_coverage [1152], 12, 52, G_GUINT64_CONSTANT (0x000080f808f80000), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03084, (gchar *) symbol_coverage [1153], 15, 49, G_GUINT64_CONSTANT (0x01100f7402030101), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x03084, (gchar *) symbol_coverage [1154], 15, 49, G_GUINT64_CONSTANT (0x00b0cc067c000080), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03085, (gchar *) symbol_coverage [1155], 13, 51, G_GUINT64_CONSTANT (0x00000813141a1901), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x03085, (gchar *) symbol_coverage [1156], 17, 47, G_GUINT64_CONSTANT (0x0000c0784c4cf080), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03086, (gchar *) symbol_coverage [1157], 16, 48, G_GUINT64_CONSTANT (0x0030272830320103), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x03086, (gchar *) symbol_coverage [1158], 20, 44, G_GUINT64_CONSTANT (0xc040dc4444ccf000), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03087, (gchar *) symbol_coverage [1159], 14, 50, G_GUINT64_CONSTANT (0x0000010101011f1f), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x03087, (gchar *) symbol_coverage [1160], 10, 54, G_GUINT64_CONSTANT (0x000000f08080f000), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03088, (gchar *) symbol_coverage [1161], 16, 48, G_GUINT64_CONSTANT (0x01010101011f211e), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x03088, (gchar *) symbol_coverage [1162], 16, 48, G_GUINT64_CONSTANT (0x8080f88080c0bc00), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03089, (gchar *) symbol_coverage [1163], 15, 49, G_GUINT64_CONSTANT (0x040308181f100007), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x03089, (gchar *) symbol_coverage [1164], 15, 49, G_GUINT64_CONSTANT (0x00e000e0180c18e0), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0308a, (gchar *) symbol_coverage [1165], 13, 51, G_GUINT64_CONSTANT (0x08090e1818000007), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x0308a, (gchar *) symbol_coverage [1166], 12, 52, G_GUINT64_CONSTANT (0x00e0101818106080), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0308b, (gchar *) symbol_coverage [1167], 16, 48, G_GUINT64_CONSTANT (0x000f00031d200703), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x0308b, (gchar *) symbol_coverage [1168], 20, 44, G_GUINT64_CONSTANT (0x00f0c000f80cc8f0), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0308c, (gchar *) symbol_coverage [1169], 18, 46, G_GUINT64_CONSTANT (0x04047f0c18284808), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x0308c, (gchar *) symbol_coverage [1170], 14, 50, G_GUINT64_CONSTANT (0x0020d8181010101e), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0308d, (gchar *) symbol_coverage [1171], 14, 50, G_GUINT64_CONSTANT (0x000f00031d200007), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x0308d, (gchar *) symbol_coverage [1172], 17, 47, G_GUINT64_CONSTANT (0x00e0c040b80c18e0), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0308e, (gchar *) symbol_coverage [1173], 14, 50, G_GUINT64_CONSTANT (0x0000061d061c2404), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x0308e, (gchar *) symbol_coverage [1174], 11, 53, G_GUINT64_CONSTANT (0x000000f804041860), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x0308f, (gchar *) symbol_coverage [1175], 19, 45, G_GUINT64_CONSTANT (0x04047d0e1828480c), 19 },
+    { (ChafaSymbolTags) 0x00048000, 0x0308f, (gchar *) symbol_coverage [1176], 13, 51, G_GUINT64_CONSTANT (0x0000f80602043840), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03090, (gchar *) symbol_coverage [1177], 23, 41, G_GUINT64_CONSTANT (0x010e010f32266d38), 23 },
+    { (ChafaSymbolTags) 0x00048000, 0x03090, (gchar *) symbol_coverage [1178], 18, 46, G_GUINT64_CONSTANT (0x8080c0380404fce0), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03091, (gchar *) symbol_coverage [1179], 22, 42, G_GUINT64_CONSTANT (0x0f010e15070c1a61), 22 },
+    { (ChafaSymbolTags) 0x00048000, 0x03091, (gchar *) symbol_coverage [1180], 20, 44, G_GUINT64_CONSTANT (0xe0807088f0007886), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03092, (gchar *) symbol_coverage [1181], 20, 44, G_GUINT64_CONSTANT (0x023f041f21060403), 20 },
+    { (ChafaSymbolTags) 0x00048000, 0x03092, (gchar *) symbol_coverage [1182], 17, 47, G_GUINT64_CONSTANT (0x00f000bcc08000f8), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03093, (gchar *) symbol_coverage [1183], 13, 51, G_GUINT64_CONSTANT (0x0103060d0a102020), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x03093, (gchar *) symbol_coverage [1184], 11, 53, G_GUINT64_CONSTANT (0x0000000080c2c478), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03094, (gchar *) symbol_coverage [1185], 12, 52, G_GUINT64_CONSTANT (0x0007033c00000007), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x03094, (gchar *) symbol_coverage [1186], 16, 48, G_GUINT64_CONSTANT (0x00e6c8301030e000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03095, (gchar *) symbol_coverage [1187], 14, 50, G_GUINT64_CONSTANT (0x000002170e04081b), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x03095, (gchar *) symbol_coverage [1188], 12, 52, G_GUINT64_CONSTANT (0x00000098646440c0), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x03096, (gchar *) symbol_coverage [1189], 9, 55, G_GUINT64_CONSTANT (0x0000081110141808), 9 },
+    { (ChafaSymbolTags) 0x00048000, 0x03096, (gchar *) symbol_coverage [1190], 15, 49, G_GUINT64_CONSTANT (0x000030fc303020c0), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00040000, 0x030a0, (gchar *) symbol_coverage [1191], 4, 60, G_GUINT64_CONSTANT (0x0000000303000000), 4 },
+    { (ChafaSymbolTags) 0x00040000, 0x030a0, (gchar *) symbol_coverage [1192], 4, 60, G_GUINT64_CONSTANT (0x000000c0c0000000), 4 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a1, (gchar *) symbol_coverage [1193], 11, 53, G_GUINT64_CONSTANT (0x00001f000101030c), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a1, (gchar *) symbol_coverage [1194], 8, 56, G_GUINT64_CONSTANT (0x0000f81820000000), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a2, (gchar *) symbol_coverage [1195], 15, 49, G_GUINT64_CONSTANT (0x003f010101030618), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a2, (gchar *) symbol_coverage [1196], 10, 54, G_GUINT64_CONSTANT (0x00fe083000000000), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a3, (gchar *) symbol_coverage [1197], 6, 58, G_GUINT64_CONSTANT (0x00000000033c0000), 6 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a3, (gchar *) symbol_coverage [1198], 7, 57, G_GUINT64_CONSTANT (0x0000106080808080), 7 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a4, (gchar *) symbol_coverage [1199], 6, 58, G_GUINT64_CONSTANT (0x000000033c000000), 6 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a4, (gchar *) symbol_coverage [1200], 11, 53, G_GUINT64_CONSTANT (0x000c7080808080c0), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a5, (gchar *) symbol_coverage [1201], 10, 54, G_GUINT64_CONSTANT (0x0000011f10000007), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a5, (gchar *) symbol_coverage [1202], 12, 52, G_GUINT64_CONSTANT (0x000080f818106080), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a6, (gchar *) symbol_coverage [1203], 14, 50, G_GUINT64_CONSTANT (0x01013f3030000003), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a6, (gchar *) symbol_coverage [1204], 16, 48, G_GUINT64_CONSTANT (0x8080fc0c0830e000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a7, (gchar *) symbol_coverage [1205], 14, 50, G_GUINT64_CONSTANT (0x0000001f0101013f), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a7, (gchar *) symbol_coverage [1206], 14, 50, G_GUINT64_CONSTANT (0x000000f8808080fc), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a8, (gchar *) symbol_coverage [1207], 17, 47, G_GUINT64_CONSTANT (0x003f010101017f00), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a8, (gchar *) symbol_coverage [1208], 17, 47, G_GUINT64_CONSTANT (0x00fc80808080fe00), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030a9, (gchar *) symbol_coverage [1209], 11, 53, G_GUINT64_CONSTANT (0x0000001f00030c11), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030a9, (gchar *) symbol_coverage [1210], 13, 51, G_GUINT64_CONSTANT (0x000040fcc04040c0), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030aa, (gchar *) symbol_coverage [1211], 13, 51, G_GUINT64_CONSTANT (0x00003f00031c2001), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030aa, (gchar *) symbol_coverage [1212], 20, 44, G_GUINT64_CONSTANT (0x6040fce0606060c0), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ab, (gchar *) symbol_coverage [1213], 15, 49, G_GUINT64_CONSTANT (0x01013f0302040830), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ab, (gchar *) symbol_coverage [1214], 15, 49, G_GUINT64_CONSTANT (0x0000fc0c080808f0), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ac, (gchar *) symbol_coverage [1215], 17, 47, G_GUINT64_CONSTANT (0x03033f0206041820), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ac, (gchar *) symbol_coverage [1216], 18, 46, G_GUINT64_CONSTANT (0x140af808080818f0), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ad, (gchar *) symbol_coverage [1217], 15, 49, G_GUINT64_CONSTANT (0x0003013f013e0000), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ad, (gchar *) symbol_coverage [1218], 15, 49, G_GUINT64_CONSTANT (0x0000f800bcc0c040), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ae, (gchar *) symbol_coverage [1219], 15, 49, G_GUINT64_CONSTANT (0x00027f0107380000), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ae, (gchar *) symbol_coverage [1220], 16, 48, G_GUINT64_CONSTANT (0x140af000fc808000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030af, (gchar *) symbol_coverage [1221], 11, 53, G_GUINT64_CONSTANT (0x01030c300000030c), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030af, (gchar *) symbol_coverage [1222], 12, 52, G_GUINT64_CONSTANT (0x00f8081830408000), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b0, (gchar *) symbol_coverage [1223], 14, 50, G_GUINT64_CONSTANT (0x020207186000031c), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b0, (gchar *) symbol_coverage [1224], 13, 51, G_GUINT64_CONSTANT (0x020af81030408000), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b1, (gchar *) symbol_coverage [1225], 12, 52, G_GUINT64_CONSTANT (0x06040f3000000304), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b1, (gchar *) symbol_coverage [1226], 11, 53, G_GUINT64_CONSTANT (0x0000fe40c0800000), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b2, (gchar *) symbol_coverage [1227], 14, 50, G_GUINT64_CONSTANT (0x000c0f106000030e), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b2, (gchar *) symbol_coverage [1228], 13, 51, G_GUINT64_CONSTANT (0x040afc40c0800000), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b3, (gchar *) symbol_coverage [1229], 10, 54, G_GUINT64_CONSTANT (0x001f000000001f00), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b3, (gchar *) symbol_coverage [1230], 22, 42, G_GUINT64_CONSTANT (0x00fc0c0c0c0cfc0c), 22 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b4, (gchar *) symbol_coverage [1231], 12, 52, G_GUINT64_CONSTANT (0x003f000000003f00), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b4, (gchar *) symbol_coverage [1232], 18, 46, G_GUINT64_CONSTANT (0x16f808080808f808), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b5, (gchar *) symbol_coverage [1233], 15, 49, G_GUINT64_CONSTANT (0x000c7f0c0c000003), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b5, (gchar *) symbol_coverage [1234], 17, 47, G_GUINT64_CONSTANT (0x3030fe302020c000), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b6, (gchar *) symbol_coverage [1235], 12, 52, G_GUINT64_CONSTANT (0x00087f0808000003), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b6, (gchar *) symbol_coverage [1236], 17, 47, G_GUINT64_CONSTANT (0x022efc202060c000), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b7, (gchar *) symbol_coverage [1237], 12, 52, G_GUINT64_CONSTANT (0x000c033800001f00), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b7, (gchar *) symbol_coverage [1238], 7, 57, G_GUINT64_CONSTANT (0x0000000618608000), 7 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b8, (gchar *) symbol_coverage [1239], 12, 52, G_GUINT64_CONSTANT (0x000807300800031c), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b8, (gchar *) symbol_coverage [1240], 10, 54, G_GUINT64_CONSTANT (0x00140a0408708000), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030b9, (gchar *) symbol_coverage [1241], 11, 53, G_GUINT64_CONSTANT (0x001f000000031c20), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030b9, (gchar *) symbol_coverage [1242], 15, 49, G_GUINT64_CONSTANT (0x00f83060c0300804), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ba, (gchar *) symbol_coverage [1243], 11, 53, G_GUINT64_CONSTANT (0x001f000000030c30), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ba, (gchar *) symbol_coverage [1244], 20, 44, G_GUINT64_CONSTANT (0x1af83060c060180c), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030bb, (gchar *) symbol_coverage [1245], 15, 49, G_GUINT64_CONSTANT (0x0404047f04040403), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030bb, (gchar *) symbol_coverage [1246], 15, 49, G_GUINT64_CONSTANT (0x0000fc18300000f8), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030bc, (gchar *) symbol_coverage [1247], 14, 50, G_GUINT64_CONSTANT (0x0004047f04040403), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030bc, (gchar *) symbol_coverage [1248], 18, 46, G_GUINT64_CONSTANT (0x12087c98300000f8), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030bd, (gchar *) symbol_coverage [1249], 8, 56, G_GUINT64_CONSTANT (0x0030180800000700), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x030bd, (gchar *) symbol_coverage [1250], 7, 57, G_GUINT64_CONSTANT (0x0008181020c00000), 7 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030be, (gchar *) symbol_coverage [1251], 7, 57, G_GUINT64_CONSTANT (0x0020100c00000700), 7 },
+    { (ChafaSymbolTags) 0x00048000, 0x030be, (gchar *) symbol_coverage [1252], 10, 54, G_GUINT64_CONSTANT (0x140a181020c00000), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030bf, (gchar *) symbol_coverage [1253], 14, 50, G_GUINT64_CONSTANT (0x0103041a2100031c), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030bf, (gchar *) symbol_coverage [1254], 16, 48, G_GUINT64_CONSTANT (0x00f80818f0f00000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c0, (gchar *) symbol_coverage [1255], 16, 48, G_GUINT64_CONSTANT (0x03070c320100031c), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c0, (gchar *) symbol_coverage [1256], 16, 48, G_GUINT64_CONSTANT (0x0af81810a0f00000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c1, (gchar *) symbol_coverage [1257], 17, 47, G_GUINT64_CONSTANT (0x001f007f0101020c), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c1, (gchar *) symbol_coverage [1258], 13, 51, G_GUINT64_CONSTANT (0x00f080fe80000000), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c2, (gchar *) symbol_coverage [1259], 20, 44, G_GUINT64_CONSTANT (0x003f017f01010618), 20 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c2, (gchar *) symbol_coverage [1260], 13, 51, G_GUINT64_CONSTANT (0x00f40afc00000000), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c3, (gchar *) symbol_coverage [1261], 6, 58, G_GUINT64_CONSTANT (0x0000001108000007), 6 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c3, (gchar *) symbol_coverage [1262], 8, 56, G_GUINT64_CONSTANT (0x000000089830c000), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c4, (gchar *) symbol_coverage [1263], 9, 55, G_GUINT64_CONSTANT (0x0003311000000700), 9 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c4, (gchar *) symbol_coverage [1264], 8, 56, G_GUINT64_CONSTANT (0x00040c0810608000), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c5, (gchar *) symbol_coverage [1265], 7, 57, G_GUINT64_CONSTANT (0x0002211000000700), 7 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c5, (gchar *) symbol_coverage [1266], 11, 53, G_GUINT64_CONSTANT (0x12080c1830c00000), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c6, (gchar *) symbol_coverage [1267], 16, 48, G_GUINT64_CONSTANT (0x001f003f0001030c), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c6, (gchar *) symbol_coverage [1268], 14, 50, G_GUINT64_CONSTANT (0x00f800fe80800000), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c7, (gchar *) symbol_coverage [1269], 18, 46, G_GUINT64_CONSTANT (0x001f007f0101030c), 18 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c7, (gchar *) symbol_coverage [1270], 13, 51, G_GUINT64_CONSTANT (0x0af000fc80000000), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c8, (gchar *) symbol_coverage [1271], 13, 51, G_GUINT64_CONSTANT (0x0006060706060600), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c8, (gchar *) symbol_coverage [1272], 6, 58, G_GUINT64_CONSTANT (0x000000807c000000), 6 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030c9, (gchar *) symbol_coverage [1273], 9, 55, G_GUINT64_CONSTANT (0x0004040704040404), 9 },
+    { (ChafaSymbolTags) 0x00048000, 0x030c9, (gchar *) symbol_coverage [1274], 8, 56, G_GUINT64_CONSTANT (0x00281000f8000000), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ca, (gchar *) symbol_coverage [1275], 11, 53, G_GUINT64_CONSTANT (0x00003f0001010608), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ca, (gchar *) symbol_coverage [1276], 11, 53, G_GUINT64_CONSTANT (0x8080fe8080000000), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030cb, (gchar *) symbol_coverage [1277], 12, 52, G_GUINT64_CONSTANT (0x001f000000007f00), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030cb, (gchar *) symbol_coverage [1278], 11, 53, G_GUINT64_CONSTANT (0x00f800000000fc00), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030cc, (gchar *) symbol_coverage [1279], 14, 50, G_GUINT64_CONSTANT (0x001f000e01010618), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030cc, (gchar *) symbol_coverage [1280], 14, 50, G_GUINT64_CONSTANT (0x00f81020c0e01800), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030cd, (gchar *) symbol_coverage [1281], 17, 47, G_GUINT64_CONSTANT (0x013f000007790101), 17 },
+    { (ChafaSymbolTags) 0x00048000, 0x030cd, (gchar *) symbol_coverage [1282], 19, 45, G_GUINT64_CONSTANT (0x80f830c0b08e8080), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ce, (gchar *) symbol_coverage [1283], 6, 58, G_GUINT64_CONSTANT (0x0000000000033c00), 6 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ce, (gchar *) symbol_coverage [1284], 8, 56, G_GUINT64_CONSTANT (0x00183060c0000000), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030cf, (gchar *) symbol_coverage [1285], 6, 58, G_GUINT64_CONSTANT (0x0000040c08102000), 6 },
+    { (ChafaSymbolTags) 0x00048000, 0x030cf, (gchar *) symbol_coverage [1286], 9, 55, G_GUINT64_CONSTANT (0x00203010080c0600), 9 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d0, (gchar *) symbol_coverage [1287], 7, 57, G_GUINT64_CONSTANT (0x0000040c08106000), 7 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d0, (gchar *) symbol_coverage [1288], 8, 56, G_GUINT64_CONSTANT (0x000a2010080c0400), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d1, (gchar *) symbol_coverage [1289], 7, 57, G_GUINT64_CONSTANT (0x0004040c08102000), 7 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d1, (gchar *) symbol_coverage [1290], 15, 49, G_GUINT64_CONSTANT (0x0e6a3410080c0400), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d2, (gchar *) symbol_coverage [1291], 12, 52, G_GUINT64_CONSTANT (0x0008080f08080807), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d2, (gchar *) symbol_coverage [1292], 10, 54, G_GUINT64_CONSTANT (0x000038c0000000f8), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d3, (gchar *) symbol_coverage [1293], 14, 50, G_GUINT64_CONSTANT (0x0010101f1010100f), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d3, (gchar *) symbol_coverage [1294], 12, 52, G_GUINT64_CONSTANT (0x140830c0000000f8), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d4, (gchar *) symbol_coverage [1295], 14, 50, G_GUINT64_CONSTANT (0x0010101f1010100f), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d4, (gchar *) symbol_coverage [1296], 15, 49, G_GUINT64_CONSTANT (0x0e0a7480000000f8), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d5, (gchar *) symbol_coverage [1297], 10, 54, G_GUINT64_CONSTANT (0x003f00000000030c), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d5, (gchar *) symbol_coverage [1298], 14, 50, G_GUINT64_CONSTANT (0x00fc081830608000), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d6, (gchar *) symbol_coverage [1299], 10, 54, G_GUINT64_CONSTANT (0x003f00000000030c), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d6, (gchar *) symbol_coverage [1300], 15, 49, G_GUINT64_CONSTANT (0x0af8081830608000), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d7, (gchar *) symbol_coverage [1301], 10, 54, G_GUINT64_CONSTANT (0x003f00000000030c), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d7, (gchar *) symbol_coverage [1302], 20, 44, G_GUINT64_CONSTANT (0x0ff90e1830608000), 20 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d8, (gchar *) symbol_coverage [1303], 7, 57, G_GUINT64_CONSTANT (0x0000070830400000), 7 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d8, (gchar *) symbol_coverage [1304], 8, 56, G_GUINT64_CONSTANT (0x000000c0300c0600), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030d9, (gchar *) symbol_coverage [1305], 8, 56, G_GUINT64_CONSTANT (0x0000071830400000), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x030d9, (gchar *) symbol_coverage [1306], 10, 54, G_GUINT64_CONSTANT (0x000410c030180600), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030da, (gchar *) symbol_coverage [1307], 8, 56, G_GUINT64_CONSTANT (0x0000071830400000), 8 },
+    { (ChafaSymbolTags) 0x00048000, 0x030da, (gchar *) symbol_coverage [1308], 14, 50, G_GUINT64_CONSTANT (0x001c14c830180600), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030db, (gchar *) symbol_coverage [1309], 12, 52, G_GUINT64_CONSTANT (0x00003f0008300007), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030db, (gchar *) symbol_coverage [1310], 14, 50, G_GUINT64_CONSTANT (0x8080fc8088848000), 14 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030dc, (gchar *) symbol_coverage [1311], 20, 44, G_GUINT64_CONSTANT (0x01017f0119214107), 20 },
+    { (ChafaSymbolTags) 0x00048000, 0x030dc, (gchar *) symbol_coverage [1312], 19, 45, G_GUINT64_CONSTANT (0x948afc8098848000), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030dd, (gchar *) symbol_coverage [1313], 19, 45, G_GUINT64_CONSTANT (0x00017f0119310107), 19 },
+    { (ChafaSymbolTags) 0x00048000, 0x030dd, (gchar *) symbol_coverage [1314], 21, 43, G_GUINT64_CONSTANT (0x1e8cfc80988c8000), 21 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030de, (gchar *) symbol_coverage [1315], 10, 54, G_GUINT64_CONSTANT (0x003f00000c030000), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030de, (gchar *) symbol_coverage [1316], 16, 48, G_GUINT64_CONSTANT (0x00fc0c186080c020), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030df, (gchar *) symbol_coverage [1317], 13, 51, G_GUINT64_CONSTANT (0x000f000f00100f00), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030df, (gchar *) symbol_coverage [1318], 13, 51, G_GUINT64_CONSTANT (0x00c03800f000f000), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e0, (gchar *) symbol_coverage [1319], 14, 50, G_GUINT64_CONSTANT (0x0003020604087f00), 14 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e0, (gchar *) symbol_coverage [1320], 7, 57, G_GUINT64_CONSTANT (0x000000001008f400), 7 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e1, (gchar *) symbol_coverage [1321], 9, 55, G_GUINT64_CONSTANT (0x0000080700031c00), 9 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e1, (gchar *) symbol_coverage [1322], 11, 53, G_GUINT64_CONSTANT (0x00183060e0180000), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e2, (gchar *) symbol_coverage [1323], 19, 45, G_GUINT64_CONSTANT (0x001f033f03030300), 19 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e2, (gchar *) symbol_coverage [1324], 18, 46, G_GUINT64_CONSTANT (0x00f800fe000000fc), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e3, (gchar *) symbol_coverage [1325], 10, 54, G_GUINT64_CONSTANT (0x000004061f010100), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e3, (gchar *) symbol_coverage [1326], 11, 53, G_GUINT64_CONSTANT (0x0000001cf8600080), 11 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e4, (gchar *) symbol_coverage [1327], 15, 49, G_GUINT64_CONSTANT (0x000c047f02030101), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e4, (gchar *) symbol_coverage [1328], 10, 54, G_GUINT64_CONSTANT (0x00007c8830000080), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e5, (gchar *) symbol_coverage [1329], 10, 54, G_GUINT64_CONSTANT (0x0000000f00003f00), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e5, (gchar *) symbol_coverage [1330], 12, 52, G_GUINT64_CONSTANT (0x000000f02020fc00), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e6, (gchar *) symbol_coverage [1331], 12, 52, G_GUINT64_CONSTANT (0x001f000000007f00), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e6, (gchar *) symbol_coverage [1332], 17, 47, G_GUINT64_CONSTANT (0x00f010103030fe00), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e7, (gchar *) symbol_coverage [1333], 13, 51, G_GUINT64_CONSTANT (0x00000f000f00001f), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e7, (gchar *) symbol_coverage [1334], 15, 49, G_GUINT64_CONSTANT (0x0000f010f01010f0), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e8, (gchar *) symbol_coverage [1335], 16, 48, G_GUINT64_CONSTANT (0x001f00001f003f00), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e8, (gchar *) symbol_coverage [1336], 19, 45, G_GUINT64_CONSTANT (0x00f80808f808f808), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030e9, (gchar *) symbol_coverage [1337], 13, 51, G_GUINT64_CONSTANT (0x000f003f00000007), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030e9, (gchar *) symbol_coverage [1338], 16, 48, G_GUINT64_CONSTANT (0x00f800fc0810e000), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ea, (gchar *) symbol_coverage [1339], 5, 59, G_GUINT64_CONSTANT (0x0008080808000100), 5 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ea, (gchar *) symbol_coverage [1340], 8, 56, G_GUINT64_CONSTANT (0x001010101030c000), 8 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030eb, (gchar *) symbol_coverage [1341], 10, 54, G_GUINT64_CONSTANT (0x000c0c0808183000), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030eb, (gchar *) symbol_coverage [1342], 17, 47, G_GUINT64_CONSTANT (0x00c0c0c0c2ccf000), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ec, (gchar *) symbol_coverage [1343], 9, 55, G_GUINT64_CONSTANT (0x0008080808080f00), 9 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ec, (gchar *) symbol_coverage [1344], 6, 58, G_GUINT64_CONSTANT (0x000000000c708000), 6 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ed, (gchar *) symbol_coverage [1345], 22, 42, G_GUINT64_CONSTANT (0x003f303030303f30), 22 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ed, (gchar *) symbol_coverage [1346], 22, 42, G_GUINT64_CONSTANT (0x00fc0c0c0c0cfc0c), 22 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ee, (gchar *) symbol_coverage [1347], 10, 54, G_GUINT64_CONSTANT (0x00001f1010000007), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ee, (gchar *) symbol_coverage [1348], 12, 52, G_GUINT64_CONSTANT (0x0000f80810306080), 12 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030ef, (gchar *) symbol_coverage [1349], 12, 52, G_GUINT64_CONSTANT (0x003f303000000102), 12 },
+    { (ChafaSymbolTags) 0x00048000, 0x030ef, (gchar *) symbol_coverage [1350], 15, 49, G_GUINT64_CONSTANT (0x00fc0c081830c000), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f0, (gchar *) symbol_coverage [1351], 15, 49, G_GUINT64_CONSTANT (0x00003f04047f0000), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f0, (gchar *) symbol_coverage [1352], 18, 46, G_GUINT64_CONSTANT (0x0020fc2020fe2020), 18 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f1, (gchar *) symbol_coverage [1353], 16, 48, G_GUINT64_CONSTANT (0x003f000101017f00), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f1, (gchar *) symbol_coverage [1354], 16, 48, G_GUINT64_CONSTANT (0x00fc08300000fe00), 16 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f2, (gchar *) symbol_coverage [1355], 13, 51, G_GUINT64_CONSTANT (0x001f001f00000106), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f2, (gchar *) symbol_coverage [1356], 17, 47, G_GUINT64_CONSTANT (0x00fc0cf81020c000), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f3, (gchar *) symbol_coverage [1357], 10, 54, G_GUINT64_CONSTANT (0x0018060000003f00), 10 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f3, (gchar *) symbol_coverage [1358], 6, 58, G_GUINT64_CONSTANT (0x0000000c10e00000), 6 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f4, (gchar *) symbol_coverage [1359], 13, 51, G_GUINT64_CONSTANT (0x01013f2020000007), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f4, (gchar *) symbol_coverage [1360], 17, 47, G_GUINT64_CONSTANT (0x1608fc081830c000), 17 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f5, (gchar *) symbol_coverage [1361], 13, 51, G_GUINT64_CONSTANT (0x0000011f03020618), 13 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f5, (gchar *) symbol_coverage [1362], 13, 51, G_GUINT64_CONSTANT (0x000000f0181810f0), 13 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f6, (gchar *) symbol_coverage [1363], 11, 53, G_GUINT64_CONSTANT (0x0000060718000107), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f6, (gchar *) symbol_coverage [1364], 10, 54, G_GUINT64_CONSTANT (0x000000fc40c08000), 10 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f7, (gchar *) symbol_coverage [1365], 11, 53, G_GUINT64_CONSTANT (0x003f202000000007), 11 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f7, (gchar *) symbol_coverage [1366], 15, 49, G_GUINT64_CONSTANT (0x16f808081030c000), 15 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f8, (gchar *) symbol_coverage [1367], 15, 49, G_GUINT64_CONSTANT (0x00003f04047f0000), 15 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f8, (gchar *) symbol_coverage [1368], 21, 43, G_GUINT64_CONSTANT (0x0a24fc2020fe2020), 21 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030f9, (gchar *) symbol_coverage [1369], 16, 48, G_GUINT64_CONSTANT (0x003f000101017f00), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x030f9, (gchar *) symbol_coverage [1370], 19, 45, G_GUINT64_CONSTANT (0x16fc08300000fe00), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030fa, (gchar *) symbol_coverage [1371], 16, 48, G_GUINT64_CONSTANT (0x003f003f0000010e), 16 },
+    { (ChafaSymbolTags) 0x00048000, 0x030fa, (gchar *) symbol_coverage [1372], 19, 45, G_GUINT64_CONSTANT (0x16f808f830608000), 19 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00040000, 0x030fb, (gchar *) symbol_coverage [1373], 3, 61, G_GUINT64_CONSTANT (0x0000000301000000), 3 },
+    { (ChafaSymbolTags) 0x00040000, 0x030fb, (gchar *) symbol_coverage [1374], 3, 61, G_GUINT64_CONSTANT (0x000000c080000000), 3 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030fc, (gchar *) symbol_coverage [1375], 6, 58, G_GUINT64_CONSTANT (0x0000003f00000000), 6 },
+    { (ChafaSymbolTags) 0x00048000, 0x030fc, (gchar *) symbol_coverage [1376], 6, 58, G_GUINT64_CONSTANT (0x000000fc00000000), 6 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030fd, (gchar *) symbol_coverage [1377], 3, 61, G_GUINT64_CONSTANT (0x0000040300000000), 3 },
+    { (ChafaSymbolTags) 0x00048000, 0x030fd, (gchar *) symbol_coverage [1378], 4, 60, G_GUINT64_CONSTANT (0x00000000c0300000), 4 }
+  }},
+  {{
+    { (ChafaSymbolTags) 0x00048000, 0x030fe, (gchar *) symbol_coverage [1379], 3, 61, G_GUINT64_CONSTANT (0x0000040300000000), 3 },
+    { (ChafaSymbolTags) 0x00048000, 0x030fe, (gchar *) symbol_coverage [1380], 6, 58, G_GUINT64_CONSTANT (0x00502000c0200000), 6 }
+  }},
+  {{ { 0, 0, NULL, 0, 0, 0, 0 }, { 0, 0, NULL, 0, 0, 0, 0 } }}
+};
+
+static const ChafaSymbolTagsDef builtin_tags [877] =
+{
+    { 0x00020, (ChafaSymbolTags) 0x01024001 },
+    { 0x00021, (ChafaSymbolTags) 0x01024000 },
+    { 0x00022, (ChafaSymbolTags) 0x01024000 },
+    { 0x00023, (ChafaSymbolTags) 0x01024000 },
+    { 0x00024, (ChafaSymbolTags) 0x01024000 },
+    { 0x00025, (ChafaSymbolTags) 0x01024000 },
+    { 0x00026, (ChafaSymbolTags) 0x01024000 },
+    { 0x00027, (ChafaSymbolTags) 0x01024000 },
+    { 0x00028, (ChafaSymbolTags) 0x01024000 },
+    { 0x00029, (ChafaSymbolTags) 0x01024000 },
+    { 0x0002a, (ChafaSymbolTags) 0x01024000 },
+    { 0x0002b, (ChafaSymbolTags) 0x01024000 },
+    { 0x0002c, (ChafaSymbolTags) 0x01024000 },
+    { 0x0002d, (ChafaSymbolTags) 0x01024000 },
+    { 0x0002e, (ChafaSymbolTags) 0x01024000 },
+    { 0x0002f, (ChafaSymbolTags) 0x01024000 },
+    { 0x00030, (ChafaSymbolTags) 0x01034000 },
+    { 0x00031, (ChafaSymbolTags) 0x01034000 },
+    { 0x00032, (ChafaSymbolTags) 0x01034000 },
+    { 0x00033, (ChafaSymbolTags) 0x01034000 },
+    { 0x00034, (ChafaSymbolTags) 0x01034000 },
+    { 0x00035, (ChafaSymbolTags) 0x01034000 },
+    { 0x00036, (ChafaSymbolTags) 0x01034000 },
+    { 0x00037, (ChafaSymbolTags) 0x01034000 },
+    { 0x00038, (ChafaSymbolTags) 0x01034000 },
+    { 0x00039, (ChafaSymbolTags) 0x01034000 },
+    { 0x0003a, (ChafaSymbolTags) 0x01024000 },
+    { 0x0003b, (ChafaSymbolTags) 0x01024000 },
+    { 0x0003c, (ChafaSymbolTags) 0x01024000 },
+    { 0x0003d, (ChafaSymbolTags) 0x01024000 },
+    { 0x0003e, (ChafaSymbolTags) 0x01024000 },
+    { 0x0003f, (ChafaSymbolTags) 0x01024000 },
+    { 0x00040, (ChafaSymbolTags) 0x01024000 },
+    { 0x00041, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00042, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00043, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00044, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00045, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00046, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00047, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00048, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00049, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0004a, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0004b, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0004c, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0004d, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0004e, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0004f, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00050, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00051, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00052, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00053, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00054, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00055, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00056, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00057, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00058, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00059, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0005a, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0005b, (ChafaSymbolTags) 0x01024000 },
+    { 0x0005c, (ChafaSymbolTags) 0x01024000 },
+    { 0x0005d, (ChafaSymbolTags) 0x01024000 },
+    { 0x0005e, (ChafaSymbolTags) 0x01024000 },
+    { 0x0005f, (ChafaSymbolTags) 0x01024000 },
+    { 0x00060, (ChafaSymbolTags) 0x01024000 },
+    { 0x00061, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00062, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00063, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00064, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00065, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00066, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00067, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00068, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00069, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0006a, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0006b, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0006c, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0006d, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0006e, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0006f, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00070, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00071, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00072, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00073, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00074, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00075, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00076, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00077, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00078, (ChafaSymbolTags) 0x0102c000 },
+    { 0x00079, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0007a, (ChafaSymbolTags) 0x0102c000 },
+    { 0x0007b, (ChafaSymbolTags) 0x01024000 },
+    { 0x0007c, (ChafaSymbolTags) 0x01024000 },
+    { 0x0007d, (ChafaSymbolTags) 0x01024000 },
+    { 0x0007e, (ChafaSymbolTags) 0x01024000 },
+    { 0x000a1, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a2, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a3, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a4, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a5, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a6, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a7, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a8, (ChafaSymbolTags) 0x01020000 },
+    { 0x000a9, (ChafaSymbolTags) 0x01020000 },
+    { 0x000aa, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ab, (ChafaSymbolTags) 0x01020000 },
+    { 0x000ac, (ChafaSymbolTags) 0x01020000 },
+    { 0x000ae, (ChafaSymbolTags) 0x01020000 },
+    { 0x000af, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b0, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b1, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b2, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b3, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b4, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b5, (ChafaSymbolTags) 0x01028000 },
+    { 0x000b6, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b7, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b8, (ChafaSymbolTags) 0x01020000 },
+    { 0x000b9, (ChafaSymbolTags) 0x01020000 },
+    { 0x000ba, (ChafaSymbolTags) 0x01028000 },
+    { 0x000bb, (ChafaSymbolTags) 0x01020000 },
+    { 0x000bc, (ChafaSymbolTags) 0x01020000 },
+    { 0x000bd, (ChafaSymbolTags) 0x01020000 },
+    { 0x000be, (ChafaSymbolTags) 0x01020000 },
+    { 0x000bf, (ChafaSymbolTags) 0x01020000 },
+    { 0x000c0, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c1, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c2, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c3, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c4, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c5, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c6, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c7, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c8, (ChafaSymbolTags) 0x01028000 },
+    { 0x000c9, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ca, (ChafaSymbolTags) 0x01028000 },
+    { 0x000cb, (ChafaSymbolTags) 0x01028000 },
+    { 0x000cc, (ChafaSymbolTags) 0x01028000 },
+    { 0x000cd, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ce, (ChafaSymbolTags) 0x01028000 },
+    { 0x000cf, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d0, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d1, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d2, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d3, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d4, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d5, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d6, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d7, (ChafaSymbolTags) 0x01020000 },
+    { 0x000d8, (ChafaSymbolTags) 0x01028000 },
+    { 0x000d9, (ChafaSymbolTags) 0x01028000 },
+    { 0x000da, (ChafaSymbolTags) 0x01028000 },
+    { 0x000db, (ChafaSymbolTags) 0x01028000 },
+    { 0x000dc, (ChafaSymbolTags) 0x01028000 },
+    { 0x000dd, (ChafaSymbolTags) 0x01028000 },
+    { 0x000de, (ChafaSymbolTags) 0x01028000 },
+    { 0x000df, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e0, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e1, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e2, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e3, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e4, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e5, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e6, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e7, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e8, (ChafaSymbolTags) 0x01028000 },
+    { 0x000e9, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ea, (ChafaSymbolTags) 0x01028000 },
+    { 0x000eb, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ec, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ed, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ee, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ef, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f0, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f1, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f2, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f3, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f4, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f5, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f6, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f7, (ChafaSymbolTags) 0x01020000 },
+    { 0x000f8, (ChafaSymbolTags) 0x01028000 },
+    { 0x000f9, (ChafaSymbolTags) 0x01028000 },
+    { 0x000fa, (ChafaSymbolTags) 0x01028000 },
+    { 0x000fb, (ChafaSymbolTags) 0x01028000 },
+    { 0x000fc, (ChafaSymbolTags) 0x01028000 },
+    { 0x000fd, (ChafaSymbolTags) 0x01028000 },
+    { 0x000fe, (ChafaSymbolTags) 0x01028000 },
+    { 0x000ff, (ChafaSymbolTags) 0x01028000 },
+    { 0x00100, (ChafaSymbolTags) 0x01028000 },
+    { 0x00101, (ChafaSymbolTags) 0x01028000 },
+    { 0x00102, (ChafaSymbolTags) 0x01028000 },
+    { 0x00103, (ChafaSymbolTags) 0x01028000 },
+    { 0x00104, (ChafaSymbolTags) 0x01028000 },
+    { 0x00105, (ChafaSymbolTags) 0x01028000 },
+    { 0x00106, (ChafaSymbolTags) 0x01028000 },
+    { 0x00107, (ChafaSymbolTags) 0x01028000 },
+    { 0x00108, (ChafaSymbolTags) 0x01028000 },
+    { 0x00109, (ChafaSymbolTags) 0x01028000 },
+    { 0x0010a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0010b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0010c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0010d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0010e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0010f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00110, (ChafaSymbolTags) 0x01028000 },
+    { 0x00111, (ChafaSymbolTags) 0x01028000 },
+    { 0x00112, (ChafaSymbolTags) 0x01028000 },
+    { 0x00113, (ChafaSymbolTags) 0x01028000 },
+    { 0x00114, (ChafaSymbolTags) 0x01028000 },
+    { 0x00115, (ChafaSymbolTags) 0x01028000 },
+    { 0x00116, (ChafaSymbolTags) 0x01028000 },
+    { 0x00117, (ChafaSymbolTags) 0x01028000 },
+    { 0x00118, (ChafaSymbolTags) 0x01028000 },
+    { 0x00119, (ChafaSymbolTags) 0x01028000 },
+    { 0x0011a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0011b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0011c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0011d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0011e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0011f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00120, (ChafaSymbolTags) 0x01028000 },
+    { 0x00121, (ChafaSymbolTags) 0x01028000 },
+    { 0x00122, (ChafaSymbolTags) 0x01028000 },
+    { 0x00123, (ChafaSymbolTags) 0x01028000 },
+    { 0x00124, (ChafaSymbolTags) 0x01028000 },
+    { 0x00125, (ChafaSymbolTags) 0x01028000 },
+    { 0x00126, (ChafaSymbolTags) 0x01028000 },
+    { 0x00127, (ChafaSymbolTags) 0x01028000 },
+    { 0x00128, (ChafaSymbolTags) 0x01028000 },
+    { 0x00129, (ChafaSymbolTags) 0x01028000 },
+    { 0x0012a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0012b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0012c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0012d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0012e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0012f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00130, (ChafaSymbolTags) 0x01028000 },
+    { 0x00131, (ChafaSymbolTags) 0x01028000 },
+    { 0x00132, (ChafaSymbolTags) 0x01028000 },
+    { 0x00133, (ChafaSymbolTags) 0x01028000 },
+    { 0x00134, (ChafaSymbolTags) 0x01028000 },
+    { 0x00135, (ChafaSymbolTags) 0x01028000 },
+    { 0x00136, (ChafaSymbolTags) 0x01028000 },
+    { 0x00137, (ChafaSymbolTags) 0x01028000 },
+    { 0x00138, (ChafaSymbolTags) 0x01028000 },
+    { 0x00139, (ChafaSymbolTags) 0x01028000 },
+    { 0x0013a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0013b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0013c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0013d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0013e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0013f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00140, (ChafaSymbolTags) 0x01028000 },
+    { 0x00141, (ChafaSymbolTags) 0x01028000 },
+    { 0x00142, (ChafaSymbolTags) 0x01028000 },
+    { 0x00143, (ChafaSymbolTags) 0x01028000 },
+    { 0x00144, (ChafaSymbolTags) 0x01028000 },
+    { 0x00145, (ChafaSymbolTags) 0x01028000 },
+    { 0x00146, (ChafaSymbolTags) 0x01028000 },
+    { 0x00147, (ChafaSymbolTags) 0x01028000 },
+    { 0x00148, (ChafaSymbolTags) 0x01028000 },
+    { 0x00149, (ChafaSymbolTags) 0x01028000 },
+    { 0x0014a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0014b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0014c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0014d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0014e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0014f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00150, (ChafaSymbolTags) 0x01028000 },
+    { 0x00151, (ChafaSymbolTags) 0x01028000 },
+    { 0x00152, (ChafaSymbolTags) 0x01028000 },
+    { 0x00153, (ChafaSymbolTags) 0x01028000 },
+    { 0x00154, (ChafaSymbolTags) 0x01028000 },
+    { 0x00155, (ChafaSymbolTags) 0x01028000 },
+    { 0x00156, (ChafaSymbolTags) 0x01028000 },
+    { 0x00157, (ChafaSymbolTags) 0x01028000 },
+    { 0x00158, (ChafaSymbolTags) 0x01028000 },
+    { 0x00159, (ChafaSymbolTags) 0x01028000 },
+    { 0x0015a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0015b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0015c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0015d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0015e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0015f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00160, (ChafaSymbolTags) 0x01028000 },
+    { 0x00161, (ChafaSymbolTags) 0x01028000 },
+    { 0x00162, (ChafaSymbolTags) 0x01028000 },
+    { 0x00163, (ChafaSymbolTags) 0x01028000 },
+    { 0x00164, (ChafaSymbolTags) 0x01028000 },
+    { 0x00165, (ChafaSymbolTags) 0x01028000 },
+    { 0x00166, (ChafaSymbolTags) 0x01028000 },
+    { 0x00167, (ChafaSymbolTags) 0x01028000 },
+    { 0x00168, (ChafaSymbolTags) 0x01028000 },
+    { 0x00169, (ChafaSymbolTags) 0x01028000 },
+    { 0x0016a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0016b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0016c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0016d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0016e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0016f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00170, (ChafaSymbolTags) 0x01028000 },
+    { 0x00171, (ChafaSymbolTags) 0x01028000 },
+    { 0x00172, (ChafaSymbolTags) 0x01028000 },
+    { 0x00173, (ChafaSymbolTags) 0x01028000 },
+    { 0x00174, (ChafaSymbolTags) 0x01028000 },
+    { 0x00175, (ChafaSymbolTags) 0x01028000 },
+    { 0x00176, (ChafaSymbolTags) 0x01028000 },
+    { 0x00177, (ChafaSymbolTags) 0x01028000 },
+    { 0x00178, (ChafaSymbolTags) 0x01028000 },
+    { 0x00179, (ChafaSymbolTags) 0x01028000 },
+    { 0x0017a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0017b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0017c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0017d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0017e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0017f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00186, (ChafaSymbolTags) 0x01028000 },
+    { 0x0018e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0018f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00190, (ChafaSymbolTags) 0x01028000 },
+    { 0x00192, (ChafaSymbolTags) 0x01028000 },
+    { 0x0019d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0019e, (ChafaSymbolTags) 0x01028000 },
+    { 0x001b5, (ChafaSymbolTags) 0x01028000 },
+    { 0x001b6, (ChafaSymbolTags) 0x01028000 },
+    { 0x001b7, (ChafaSymbolTags) 0x01028000 },
+    { 0x001cd, (ChafaSymbolTags) 0x01028000 },
+    { 0x001ce, (ChafaSymbolTags) 0x01028000 },
+    { 0x001cf, (ChafaSymbolTags) 0x01028000 },
+    { 0x001d0, (ChafaSymbolTags) 0x01028000 },
+    { 0x001d1, (ChafaSymbolTags) 0x01028000 },
+    { 0x001d2, (ChafaSymbolTags) 0x01028000 },
+    { 0x001d3, (ChafaSymbolTags) 0x01028000 },
+    { 0x001d4, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e2, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e3, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e4, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e5, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e6, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e7, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e8, (ChafaSymbolTags) 0x01028000 },
+    { 0x001e9, (ChafaSymbolTags) 0x01028000 },
+    { 0x001ea, (ChafaSymbolTags) 0x01028000 },
+    { 0x001eb, (ChafaSymbolTags) 0x01028000 },
+    { 0x001ec, (ChafaSymbolTags) 0x01028000 },
+    { 0x001ed, (ChafaSymbolTags) 0x01028000 },
+    { 0x001ee, (ChafaSymbolTags) 0x01028000 },
+    { 0x001ef, (ChafaSymbolTags) 0x01028000 },
+    { 0x001f0, (ChafaSymbolTags) 0x01028000 },
+    { 0x001f4, (ChafaSymbolTags) 0x01028000 },
+    { 0x001f5, (ChafaSymbolTags) 0x01028000 },
+    { 0x001fc, (ChafaSymbolTags) 0x01028000 },
+    { 0x001fd, (ChafaSymbolTags) 0x01028000 },
+    { 0x001fe, (ChafaSymbolTags) 0x01028000 },
+    { 0x001ff, (ChafaSymbolTags) 0x01028000 },
+    { 0x00218, (ChafaSymbolTags) 0x01028000 },
+    { 0x00219, (ChafaSymbolTags) 0x01028000 },
+    { 0x0021a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0021b, (ChafaSymbolTags) 0x01028000 },
+    { 0x00232, (ChafaSymbolTags) 0x01028000 },
+    { 0x00233, (ChafaSymbolTags) 0x01028000 },
+    { 0x00237, (ChafaSymbolTags) 0x01028000 },
+    { 0x00254, (ChafaSymbolTags) 0x01028000 },
+    { 0x00258, (ChafaSymbolTags) 0x01028000 },
+    { 0x00259, (ChafaSymbolTags) 0x01028000 },
+    { 0x0025b, (ChafaSymbolTags) 0x01028000 },
+    { 0x00272, (ChafaSymbolTags) 0x01028000 },
+    { 0x00292, (ChafaSymbolTags) 0x01028000 },
+    { 0x002bb, (ChafaSymbolTags) 0x01028000 },
+    { 0x002bc, (ChafaSymbolTags) 0x01028000 },
+    { 0x002bd, (ChafaSymbolTags) 0x01028000 },
+    { 0x002c6, (ChafaSymbolTags) 0x01028000 },
+    { 0x002c7, (ChafaSymbolTags) 0x01028000 },
+    { 0x002d8, (ChafaSymbolTags) 0x01020000 },
+    { 0x002d9, (ChafaSymbolTags) 0x01020000 },
+    { 0x002db, (ChafaSymbolTags) 0x01020000 },
+    { 0x002dc, (ChafaSymbolTags) 0x01020000 },
+    { 0x002dd, (ChafaSymbolTags) 0x01020000 },
+    { 0x00384, (ChafaSymbolTags) 0x01020000 },
+    { 0x00385, (ChafaSymbolTags) 0x01020000 },
+    { 0x00386, (ChafaSymbolTags) 0x01028000 },
+    { 0x00387, (ChafaSymbolTags) 0x01020000 },
+    { 0x00388, (ChafaSymbolTags) 0x01028000 },
+    { 0x00389, (ChafaSymbolTags) 0x01028000 },
+    { 0x0038a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0038c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0038e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0038f, (ChafaSymbolTags) 0x01028000 },
+    { 0x00390, (ChafaSymbolTags) 0x01028000 },
+    { 0x00391, (ChafaSymbolTags) 0x01028000 },
+    { 0x00392, (ChafaSymbolTags) 0x01028000 },
+    { 0x00393, (ChafaSymbolTags) 0x01028000 },
+    { 0x00394, (ChafaSymbolTags) 0x01028000 },
+    { 0x00395, (ChafaSymbolTags) 0x01028000 },
+    { 0x00396, (ChafaSymbolTags) 0x01028000 },
+    { 0x00397, (ChafaSymbolTags) 0x01028000 },
+    { 0x00398, (ChafaSymbolTags) 0x01028000 },
+    { 0x00399, (ChafaSymbolTags) 0x01028000 },
+    { 0x0039a, (ChafaSymbolTags) 0x01028000 },
+    { 0x0039b, (ChafaSymbolTags) 0x01028000 },
+    { 0x0039c, (ChafaSymbolTags) 0x01028000 },
+    { 0x0039d, (ChafaSymbolTags) 0x01028000 },
+    { 0x0039e, (ChafaSymbolTags) 0x01028000 },
+    { 0x0039f, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a0, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a1, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a3, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a4, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a5, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a6, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a7, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a8, (ChafaSymbolTags) 0x01028000 },
+    { 0x003a9, (ChafaSymbolTags) 0x01028000 },
+    { 0x003aa, (ChafaSymbolTags) 0x01028000 },
+    { 0x003ab, (ChafaSymbolTags) 0x01028000 },
+    { 0x003ac, (ChafaSymbolTags) 0x01028000 },
+    { 0x003ad, (ChafaSymbolTags) 0x01028000 },
+    { 0x003ae, (ChafaSymbolTags) 0x01028000 },
+    { 0x003af, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b0, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b1, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b2, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b3, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b4, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b5, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b6, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b7, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b8, (ChafaSymbolTags) 0x01028000 },
+    { 0x003b9, (ChafaSymbolTags) 0x01028000 },
+    { 0x003ba, (ChafaSymbolTags) 0x01028000 },
+    { 0x003bb, (ChafaSymbolTags) 0x01028000 },
+    { 0x003bc, (ChafaSymbolTags) 0x01028000 },
+    { 0x003bd, (ChafaSymbolTags) 0x01028000 },
+    { 0x003be, (ChafaSymbolTags) 0x01028000 },
+    { 0x003bf, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c0, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c1, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c2, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c3, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c4, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c5, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c6, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c7, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c8, (ChafaSymbolTags) 0x01028000 },
+    { 0x003c9, (ChafaSymbolTags) 0x01028000 },
+    { 0x003ca, (ChafaSymbolTags) 0x01028000 },
+    { 0x003cb, (ChafaSymbolTags) 0x01028000 },
+    { 0x003cc, (ChafaSymbolTags) 0x01028000 },
+    { 0x003cd, (ChafaSymbolTags) 0x01028000 },
+    { 0x003ce, (ChafaSymbolTags) 0x01028000 },
+    { 0x003d1, (ChafaSymbolTags) 0x01028000 },
+    { 0x003d5, (ChafaSymbolTags) 0x01028000 },
+    { 0x003f0, (ChafaSymbolTags) 0x01028000 },
+    { 0x003f1, (ChafaSymbolTags) 0x01028000 },
+    { 0x003f2, (ChafaSymbolTags) 0x01028000 },
+    { 0x003f3, (ChafaSymbolTags) 0x01028000 },
+    { 0x003f4, (ChafaSymbolTags) 0x01028000 },
+    { 0x003f5, (ChafaSymbolTags) 0x01028000 },
+    { 0x003f6, (ChafaSymbolTags) 0x01020000 },
+    { 0x023ba, (ChafaSymbolTags) 0x00021000 },
+    { 0x023bb, (ChafaSymbolTags) 0x00021000 },
+    { 0x023bc, (ChafaSymbolTags) 0x00021000 },
+    { 0x023bd, (ChafaSymbolTags) 0x00021000 },
+    { 0x02500, (ChafaSymbolTags) 0x00020010 },
+    { 0x02501, (ChafaSymbolTags) 0x00020010 },
+    { 0x02502, (ChafaSymbolTags) 0x00020010 },
+    { 0x02503, (ChafaSymbolTags) 0x00020010 },
+    { 0x02504, (ChafaSymbolTags) 0x00020050 },
+    { 0x02505, (ChafaSymbolTags) 0x00020050 },
+    { 0x02506, (ChafaSymbolTags) 0x00020050 },
+    { 0x02507, (ChafaSymbolTags) 0x00020050 },
+    { 0x02508, (ChafaSymbolTags) 0x00020050 },
+    { 0x02509, (ChafaSymbolTags) 0x00020050 },
+    { 0x0250a, (ChafaSymbolTags) 0x00020050 },
+    { 0x0250b, (ChafaSymbolTags) 0x00020050 },
+    { 0x0250c, (ChafaSymbolTags) 0x00020010 },
+    { 0x0250d, (ChafaSymbolTags) 0x00020010 },
+    { 0x0250e, (ChafaSymbolTags) 0x00020010 },
+    { 0x0250f, (ChafaSymbolTags) 0x00020010 },
+    { 0x02510, (ChafaSymbolTags) 0x00020010 },
+    { 0x02511, (ChafaSymbolTags) 0x00020010 },
+    { 0x02512, (ChafaSymbolTags) 0x00020010 },
+    { 0x02513, (ChafaSymbolTags) 0x00020010 },
+    { 0x02514, (ChafaSymbolTags) 0x00020010 },
+    { 0x02515, (ChafaSymbolTags) 0x00020010 },
+    { 0x02516, (ChafaSymbolTags) 0x00020010 },
+    { 0x02517, (ChafaSymbolTags) 0x00020010 },
+    { 0x02518, (ChafaSymbolTags) 0x00020010 },
+    { 0x02519, (ChafaSymbolTags) 0x00020010 },
+    { 0x0251a, (ChafaSymbolTags) 0x00020010 },
+    { 0x0251b, (ChafaSymbolTags) 0x00020010 },
+    { 0x0251c, (ChafaSymbolTags) 0x00020010 },
+    { 0x0251d, (ChafaSymbolTags) 0x00020010 },
+    { 0x0251e, (ChafaSymbolTags) 0x00020010 },
+    { 0x0251f, (ChafaSymbolTags) 0x00020010 },
+    { 0x02520, (ChafaSymbolTags) 0x00020010 },
+    { 0x02521, (ChafaSymbolTags) 0x00020010 },
+    { 0x02522, (ChafaSymbolTags) 0x00020010 },
+    { 0x02523, (ChafaSymbolTags) 0x00020010 },
+    { 0x02524, (ChafaSymbolTags) 0x00020010 },
+    { 0x02525, (ChafaSymbolTags) 0x00020010 },
+    { 0x02526, (ChafaSymbolTags) 0x00020010 },
+    { 0x02527, (ChafaSymbolTags) 0x00020010 },
+    { 0x02528, (ChafaSymbolTags) 0x00020010 },
+    { 0x02529, (ChafaSymbolTags) 0x00020010 },
+    { 0x0252a, (ChafaSymbolTags) 0x00020010 },
+    { 0x0252b, (ChafaSymbolTags) 0x00020010 },
+    { 0x0252c, (ChafaSymbolTags) 0x00020010 },
+    { 0x0252d, (ChafaSymbolTags) 0x00020010 },
+    { 0x0252e, (ChafaSymbolTags) 0x00020010 },
+    { 0x0252f, (ChafaSymbolTags) 0x00020010 },
+    { 0x02530, (ChafaSymbolTags) 0x00020010 },
+    { 0x02531, (ChafaSymbolTags) 0x00020010 },
+    { 0x02532, (ChafaSymbolTags) 0x00020010 },
+    { 0x02533, (ChafaSymbolTags) 0x00020010 },
+    { 0x02534, (ChafaSymbolTags) 0x00020010 },
+    { 0x02535, (ChafaSymbolTags) 0x00020010 },
+    { 0x02536, (ChafaSymbolTags) 0x00020010 },
+    { 0x02537, (ChafaSymbolTags) 0x00020010 },
+    { 0x02538, (ChafaSymbolTags) 0x00020010 },
+    { 0x02539, (ChafaSymbolTags) 0x00020010 },
+    { 0x0253a, (ChafaSymbolTags) 0x00020010 },
+    { 0x0253b, (ChafaSymbolTags) 0x00020010 },
+    { 0x0253c, (ChafaSymbolTags) 0x00020010 },
+    { 0x0253d, (ChafaSymbolTags) 0x00020010 },
+    { 0x0253e, (ChafaSymbolTags) 0x00020010 },
+    { 0x0253f, (ChafaSymbolTags) 0x00020010 },
+    { 0x02540, (ChafaSymbolTags) 0x00020010 },
+    { 0x02541, (ChafaSymbolTags) 0x00020010 },
+    { 0x02542, (ChafaSymbolTags) 0x00020010 },
+    { 0x02543, (ChafaSymbolTags) 0x00020010 },
+    { 0x02544, (ChafaSymbolTags) 0x00020010 },
+    { 0x02545, (ChafaSymbolTags) 0x00020010 },
+    { 0x02546, (ChafaSymbolTags) 0x00020010 },
+    { 0x02547, (ChafaSymbolTags) 0x00020010 },
+    { 0x02548, (ChafaSymbolTags) 0x00020010 },
+    { 0x02549, (ChafaSymbolTags) 0x00020010 },
+    { 0x0254a, (ChafaSymbolTags) 0x00020010 },
+    { 0x0254b, (ChafaSymbolTags) 0x00020010 },
+    { 0x0254c, (ChafaSymbolTags) 0x00020050 },
+    { 0x0254d, (ChafaSymbolTags) 0x00020050 },
+    { 0x0254e, (ChafaSymbolTags) 0x00020050 },
+    { 0x0254f, (ChafaSymbolTags) 0x00020050 },
+    { 0x02571, (ChafaSymbolTags) 0x00020030 },
+    { 0x02572, (ChafaSymbolTags) 0x00020030 },
+    { 0x02573, (ChafaSymbolTags) 0x00020030 },
+    { 0x02574, (ChafaSymbolTags) 0x00020050 },
+    { 0x02575, (ChafaSymbolTags) 0x00020050 },
+    { 0x02576, (ChafaSymbolTags) 0x00020050 },
+    { 0x02577, (ChafaSymbolTags) 0x00020050 },
+    { 0x02578, (ChafaSymbolTags) 0x00020050 },
+    { 0x02579, (ChafaSymbolTags) 0x00020050 },
+    { 0x0257a, (ChafaSymbolTags) 0x00020050 },
+    { 0x0257b, (ChafaSymbolTags) 0x00020050 },
+    { 0x0257c, (ChafaSymbolTags) 0x00020010 },
+    { 0x0257d, (ChafaSymbolTags) 0x00020010 },
+    { 0x0257e, (ChafaSymbolTags) 0x00020010 },
+    { 0x0257f, (ChafaSymbolTags) 0x00020010 },
+    { 0x02580, (ChafaSymbolTags) 0x00020608 },
+    { 0x02581, (ChafaSymbolTags) 0x00020008 },
+    { 0x02582, (ChafaSymbolTags) 0x00020008 },
+    { 0x02583, (ChafaSymbolTags) 0x00020008 },
+    { 0x02584, (ChafaSymbolTags) 0x00020208 },
+    { 0x02585, (ChafaSymbolTags) 0x00020008 },
+    { 0x02586, (ChafaSymbolTags) 0x00020008 },
+    { 0x02587, (ChafaSymbolTags) 0x00020008 },
+    { 0x02588, (ChafaSymbolTags) 0x0042000a },
+    { 0x02589, (ChafaSymbolTags) 0x00020008 },
+    { 0x0258a, (ChafaSymbolTags) 0x00020008 },
+    { 0x0258b, (ChafaSymbolTags) 0x00020008 },
+    { 0x0258c, (ChafaSymbolTags) 0x00420108 },
+    { 0x0258d, (ChafaSymbolTags) 0x00020008 },
+    { 0x0258e, (ChafaSymbolTags) 0x00020008 },
+    { 0x0258f, (ChafaSymbolTags) 0x00020008 },
+    { 0x02590, (ChafaSymbolTags) 0x00420508 },
+    { 0x02591, (ChafaSymbolTags) 0x00020004 },
+    { 0x02592, (ChafaSymbolTags) 0x00020004 },
+    { 0x02593, (ChafaSymbolTags) 0x00020004 },
+    { 0x02594, (ChafaSymbolTags) 0x00020408 },
+    { 0x02595, (ChafaSymbolTags) 0x00020408 },
+    { 0x02596, (ChafaSymbolTags) 0x00020088 },
+    { 0x02597, (ChafaSymbolTags) 0x00020088 },
+    { 0x02598, (ChafaSymbolTags) 0x00020088 },
+    { 0x02599, (ChafaSymbolTags) 0x00020488 },
+    { 0x0259a, (ChafaSymbolTags) 0x00020088 },
+    { 0x0259b, (ChafaSymbolTags) 0x00020488 },
+    { 0x0259c, (ChafaSymbolTags) 0x00020488 },
+    { 0x0259d, (ChafaSymbolTags) 0x00020088 },
+    { 0x0259e, (ChafaSymbolTags) 0x00020488 },
+    { 0x0259f, (ChafaSymbolTags) 0x00020488 },
+    { 0x025a0, (ChafaSymbolTags) 0x00022040 },
+    { 0x025aa, (ChafaSymbolTags) 0x000a2040 },
+    { 0x025ae, (ChafaSymbolTags) 0x00022040 },
+    { 0x025b2, (ChafaSymbolTags) 0x00022000 },
+    { 0x025b6, (ChafaSymbolTags) 0x000a2000 },
+    { 0x025bc, (ChafaSymbolTags) 0x00022000 },
+    { 0x025c0, (ChafaSymbolTags) 0x000a2000 },
+    { 0x025c6, (ChafaSymbolTags) 0x000a2000 },
+    { 0x025cf, (ChafaSymbolTags) 0x00022000 },
+    { 0x025e2, (ChafaSymbolTags) 0x000a2000 },
+    { 0x025e3, (ChafaSymbolTags) 0x000a2000 },
+    { 0x025e4, (ChafaSymbolTags) 0x000a2000 },
+    { 0x025e5, (ChafaSymbolTags) 0x000a2000 },
+    { 0x025fc, (ChafaSymbolTags) 0x000a2000 },
+    { 0x03041, (ChafaSymbolTags) 0x00048000 },
+    { 0x03042, (ChafaSymbolTags) 0x00048000 },
+    { 0x03043, (ChafaSymbolTags) 0x00048000 },
+    { 0x03044, (ChafaSymbolTags) 0x00048000 },
+    { 0x03045, (ChafaSymbolTags) 0x00048000 },
+    { 0x03046, (ChafaSymbolTags) 0x00048000 },
+    { 0x03047, (ChafaSymbolTags) 0x00048000 },
+    { 0x03048, (ChafaSymbolTags) 0x00048000 },
+    { 0x03049, (ChafaSymbolTags) 0x00048000 },
+    { 0x0304a, (ChafaSymbolTags) 0x00048000 },
+    { 0x0304b, (ChafaSymbolTags) 0x00048000 },
+    { 0x0304c, (ChafaSymbolTags) 0x00048000 },
+    { 0x0304d, (ChafaSymbolTags) 0x00048000 },
+    { 0x0304e, (ChafaSymbolTags) 0x00048000 },
+    { 0x0304f, (ChafaSymbolTags) 0x00048000 },
+    { 0x03050, (ChafaSymbolTags) 0x00048000 },
+    { 0x03051, (ChafaSymbolTags) 0x00048000 },
+    { 0x03052, (ChafaSymbolTags) 0x00048000 },
+    { 0x03053, (ChafaSymbolTags) 0x00048000 },
+    { 0x03054, (ChafaSymbolTags) 0x00048000 },
+    { 0x03055, (ChafaSymbolTags) 0x00048000 },
+    { 0x03056, (ChafaSymbolTags) 0x00048000 },
+    { 0x03057, (ChafaSymbolTags) 0x00048000 },
+    { 0x03058, (ChafaSymbolTags) 0x00048000 },
+    { 0x03059, (ChafaSymbolTags) 0x00048000 },
+    { 0x0305a, (ChafaSymbolTags) 0x00048000 },
+    { 0x0305b, (ChafaSymbolTags) 0x00048000 },
+    { 0x0305c, (ChafaSymbolTags) 0x00048000 },
+    { 0x0305d, (ChafaSymbolTags) 0x00048000 },
+    { 0x0305e, (ChafaSymbolTags) 0x00048000 },
+    { 0x0305f, (ChafaSymbolTags) 0x00048000 },
+    { 0x03060, (ChafaSymbolTags) 0x00048000 },
+    { 0x03061, (ChafaSymbolTags) 0x00048000 },
+    { 0x03062, (ChafaSymbolTags) 0x00048000 },
+    { 0x03063, (ChafaSymbolTags) 0x00048000 },
+    { 0x03064, (ChafaSymbolTags) 0x00048000 },
+    { 0x03065, (ChafaSymbolTags) 0x00048000 },
+    { 0x03066, (ChafaSymbolTags) 0x00048000 },
+    { 0x03067, (ChafaSymbolTags) 0x00048000 },
+    { 0x03068, (ChafaSymbolTags) 0x00048000 },
+    { 0x03069, (ChafaSymbolTags) 0x00048000 },
+    { 0x0306a, (ChafaSymbolTags) 0x00048000 },
+    { 0x0306b, (ChafaSymbolTags) 0x00048000 },
+    { 0x0306c, (ChafaSymbolTags) 0x00048000 },
+    { 0x0306d, (ChafaSymbolTags) 0x00048000 },
+    { 0x0306e, (ChafaSymbolTags) 0x00048000 },
+    { 0x0306f, (ChafaSymbolTags) 0x00048000 },
+    { 0x03070, (ChafaSymbolTags) 0x00048000 },
+    { 0x03071, (ChafaSymbolTags) 0x00048000 },
+    { 0x03072, (ChafaSymbolTags) 0x00048000 },
+    { 0x03073, (ChafaSymbolTags) 0x00048000 },
+    { 0x03074, (ChafaSymbolTags) 0x00048000 },
+    { 0x03075, (ChafaSymbolTags) 0x00048000 },
+    { 0x03076, (ChafaSymbolTags) 0x00048000 },
+    { 0x03077, (ChafaSymbolTags) 0x00048000 },
+    { 0x03078, (ChafaSymbolTags) 0x00048000 },
+    { 0x03079, (ChafaSymbolTags) 0x00048000 },
+    { 0x0307a, (ChafaSymbolTags) 0x00048000 },
+    { 0x0307b, (ChafaSymbolTags) 0x00048000 },
+    { 0x0307c, (ChafaSymbolTags) 0x00048000 },
+    { 0x0307d, (ChafaSymbolTags) 0x00048000 },
+    { 0x0307e, (ChafaSymbolTags) 0x00048000 },
+    { 0x0307f, (ChafaSymbolTags) 0x00048000 },
+    { 0x03080, (ChafaSymbolTags) 0x00048000 },
+    { 0x03081, (ChafaSymbolTags) 0x00048000 },
+    { 0x03082, (ChafaSymbolTags) 0x00048000 },
+    { 0x03083, (ChafaSymbolTags) 0x00048000 },
+    { 0x03084, (ChafaSymbolTags) 0x00048000 },
+    { 0x03085, (ChafaSymbolTags) 0x00048000 },
+    { 0x03086, (ChafaSymbolTags) 0x00048000 },
+    { 0x03087, (ChafaSymbolTags) 0x00048000 },
+    { 0x03088, (ChafaSymbolTags) 0x00048000 },
+    { 0x03089, (ChafaSymbolTags) 0x00048000 },
+    { 0x0308a, (ChafaSymbolTags) 0x00048000 },
+    { 0x0308b, (ChafaSymbolTags) 0x00048000 },
+    { 0x0308c, (ChafaSymbolTags) 0x00048000 },
+    { 0x0308d, (ChafaSymbolTags) 0x00048000 },
+    { 0x0308e, (ChafaSymbolTags) 0x00048000 },
+    { 0x0308f, (ChafaSymbolTags) 0x00048000 },
+    { 0x03090, (ChafaSymbolTags) 0x00048000 },
+    { 0x03091, (ChafaSymbolTags) 0x00048000 },
+    { 0x03092, (ChafaSymbolTags) 0x00048000 },
+    { 0x03093, (ChafaSymbolTags) 0x00048000 },
+    { 0x03094, (ChafaSymbolTags) 0x00048000 },
+    { 0x03095, (ChafaSymbolTags) 0x00048000 },
+    { 0x03096, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a0, (ChafaSymbolTags) 0x00040000 },
+    { 0x030a1, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a2, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a3, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a4, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a5, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a6, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a7, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a8, (ChafaSymbolTags) 0x00048000 },
+    { 0x030a9, (ChafaSymbolTags) 0x00048000 },
+    { 0x030aa, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ab, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ac, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ad, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ae, (ChafaSymbolTags) 0x00048000 },
+    { 0x030af, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b0, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b1, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b2, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b3, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b4, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b5, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b6, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b7, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b8, (ChafaSymbolTags) 0x00048000 },
+    { 0x030b9, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ba, (ChafaSymbolTags) 0x00048000 },
+    { 0x030bb, (ChafaSymbolTags) 0x00048000 },
+    { 0x030bc, (ChafaSymbolTags) 0x00048000 },
+    { 0x030bd, (ChafaSymbolTags) 0x00048000 },
+    { 0x030be, (ChafaSymbolTags) 0x00048000 },
+    { 0x030bf, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c0, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c1, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c2, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c3, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c4, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c5, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c6, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c7, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c8, (ChafaSymbolTags) 0x00048000 },
+    { 0x030c9, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ca, (ChafaSymbolTags) 0x00048000 },
+    { 0x030cb, (ChafaSymbolTags) 0x00048000 },
+    { 0x030cc, (ChafaSymbolTags) 0x00048000 },
+    { 0x030cd, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ce, (ChafaSymbolTags) 0x00048000 },
+    { 0x030cf, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d0, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d1, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d2, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d3, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d4, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d5, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d6, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d7, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d8, (ChafaSymbolTags) 0x00048000 },
+    { 0x030d9, (ChafaSymbolTags) 0x00048000 },
+    { 0x030da, (ChafaSymbolTags) 0x00048000 },
+    { 0x030db, (ChafaSymbolTags) 0x00048000 },
+    { 0x030dc, (ChafaSymbolTags) 0x00048000 },
+    { 0x030dd, (ChafaSymbolTags) 0x00048000 },
+    { 0x030de, (ChafaSymbolTags) 0x00048000 },
+    { 0x030df, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e0, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e1, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e2, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e3, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e4, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e5, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e6, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e7, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e8, (ChafaSymbolTags) 0x00048000 },
+    { 0x030e9, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ea, (ChafaSymbolTags) 0x00048000 },
+    { 0x030eb, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ec, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ed, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ee, (ChafaSymbolTags) 0x00048000 },
+    { 0x030ef, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f0, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f1, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f2, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f3, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f4, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f5, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f6, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f7, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f8, (ChafaSymbolTags) 0x00048000 },
+    { 0x030f9, (ChafaSymbolTags) 0x00048000 },
+    { 0x030fa, (ChafaSymbolTags) 0x00048000 },
+    { 0x030fb, (ChafaSymbolTags) 0x00040000 },
+    { 0x030fc, (ChafaSymbolTags) 0x00048000 },
+    { 0x030fd, (ChafaSymbolTags) 0x00048000 },
+    { 0x030fe, (ChafaSymbolTags) 0x00048000 },
+    { 0x1fb3c, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb3d, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb3e, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb3f, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb40, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb41, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb42, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb43, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb44, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb45, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb46, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb47, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb48, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb49, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb4a, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb4b, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb4c, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb4d, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb4e, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb4f, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb50, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb51, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb52, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb53, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb54, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb55, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb56, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb57, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb58, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb59, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb5a, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb5b, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb5c, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb5d, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb5e, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb5f, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb60, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb61, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb62, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb63, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb64, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb65, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb66, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb67, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb68, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb69, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb6a, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb6b, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb6c, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb6d, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb6e, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb6f, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb70, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb71, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb72, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb73, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb74, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb75, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb76, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb77, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb78, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb79, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb7a, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb7b, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb7c, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb7d, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb7e, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb7f, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb80, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb95, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb96, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb97, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb98, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb99, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fb9a, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fb9b, (ChafaSymbolTags) 0x00a20000 },
+    { 0x1fba0, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba1, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba2, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba3, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba4, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba5, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba6, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba7, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba8, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fba9, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fbaa, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fbab, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fbac, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fbad, (ChafaSymbolTags) 0x00220000 },
+    { 0x1fbae, (ChafaSymbolTags) 0x00220000 },
+};
@@ -0,0 +1,188 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+#include "config.h"
+
+#include <stdio.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+
+#include "internal/chafa-trace.h"
+
+/* Events are written as they come in Chrome's JSON trace format, which
+ * chrome://tracing and Perfetto both load. The closing bracket is optional
+ * in that format, so a trace is still usable if the process never gets
+ * around to closing it. Output goes through stdio's buffer, which is
+ * flushed on exit. */
+
+static GMutex trace_mutex;
+static FILE *trace_file;
+static gboolean trace_have_events;
+
+/* Threads are numbered in the order they first record something. The id
+ * is stored plus one, so NULL means unset. */
+static GPrivate thread_id_key = G_PRIVATE_INIT (NULL);
+static gint n_thread_ids;
+
+static gint
+get_thread_id (void)
+{
+    gint id = GPOINTER_TO_INT (g_private_get (&thread_id_key));
+
+    if (id == 0)
+    {
+        id = g_atomic_int_add (&n_thread_ids, 1) + 1;
+        g_private_set (&thread_id_key, GINT_TO_POINTER (id));
+    }
+
+    return id - 1;
+}
+
+/* Must be called with the mutex held */
+static void
+close_file_unlocked (void)
+{
+    if (!trace_file)
+        return;
+
+    fputs ("\n]\n", trace_file);
+    fclose (trace_file);
+    g_atomic_pointer_set (&trace_file, NULL);
+}
+
+/* Must be called with the mutex held */
+static gboolean
+open_file_unlocked (const gchar *path)
+{
+    FILE *file;
+
+    close_file_unlocked ();
+
+    if (!path)
+        return TRUE;
+
+    file = g_fopen (path, "w");
+    if (!file)
+        return FALSE;
+
+    fputs ("[\n", file);
+    trace_have_events = FALSE;
+    g_atomic_pointer_set (&trace_file, file);
+    return TRUE;
+}
+
+/* The CHAFA_TRACE environment variable names a file to trace to from the
+ * start. An explicit chafa_trace_set_file () overrides it. */
+static void
+init_from_env (void)
+{
+    static gsize initialized;
+
+    if (g_once_init_enter (&initialized))
+    {
+        const gchar *path = g_getenv ("CHAFA_TRACE");
+
+        if (path && *path)
+        {
+            g_mutex_lock (&trace_mutex);
+            open_file_unlocked (path);
+            g_mutex_unlock (&trace_mutex);
+        }
+
+        g_once_init_leave (&initialized, 1);
+    }
+}
+
+static void
+write_json_string (FILE *file, const gchar *str)
+{
+    const gchar *p;
+
+    fputc ('"', file);
+
+    for (p = str; *p; p++)
+    {
+        guchar c = *p;
+
+        if (c == '"' || c == '\\')
+            fprintf (file, "\\%c", c);
+        else if (c < 0x20)
+            fprintf (file, "\\u%04x", c);
+        else
+            fputc (c, file);
+    }
+
+    fputc ('"', file);
+}
+
+gboolean
+chafa_trace_is_enabled (void)
+{
+    init_from_env ();
+    return g_atomic_pointer_get (&trace_file) != NULL;
+}
+
+/* Starts writing events to path, or stops tracing if path is NULL. Any
+ * previous trace is closed first. */
+gboolean
+chafa_trace_set_file (const gchar *path)
+{
+    gboolean result;
+
+    init_from_env ();
+
+    g_mutex_lock (&trace_mutex);
+    result = open_file_unlocked (path);
+    g_mutex_unlock (&trace_mutex);
+
+    return result;
+}
+
+void
+chafa_trace_add_event (const gchar *name, gint64 start_us, gint64 end_us,
+                       gint first_row, gint n_rows)
+{
+    gint tid;
+
+    if (!chafa_trace_is_enabled ())
+        return;
+
+    tid = get_thread_id ();
+
+    g_mutex_lock (&trace_mutex);
+
+    /* May have been closed since we checked */
+    if (trace_file)
+    {
+        fputs (trace_have_events ? ",\n{\"name\":" : "{\"name\":", trace_file);
+        write_json_string (trace_file, name);
+        fprintf (trace_file,
+                 ",\"ph\":\"X\",\"pid\":1,\"tid\":%d"
+                 ",\"ts\":%" G_GINT64_FORMAT ",\"dur\":%" G_GINT64_FORMAT,
+                 tid, start_us, MAX (end_us - start_us, 0));
+
+        if (n_rows >= 0)
+            fprintf (trace_file, ",\"args\":{\"first_row\":%d,\"n_rows\":%d}",
+                     first_row, n_rows);
+
+        fputc ('}', trace_file);
+        trace_have_events = TRUE;
+    }
+
+    g_mutex_unlock (&trace_mutex);
+}
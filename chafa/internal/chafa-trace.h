@@ -0,0 +1,36 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+#ifndef __CHAFA_TRACE_H__
+#define __CHAFA_TRACE_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+gboolean chafa_trace_is_enabled (void);
+gboolean chafa_trace_set_file (const gchar *path);
+
+/* Records a span of work on the calling thread. If n_rows is negative, the
+ * row range is left out. */
+void chafa_trace_add_event (const gchar *name, gint64 start_us, gint64 end_us,
+                            gint first_row, gint n_rows);
+
+G_END_DECLS
+
+#endif /* __CHAFA_TRACE_H__ */
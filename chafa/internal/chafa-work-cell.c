@@ -52,37 +52,73 @@ accum_to_color (const ChafaColorAccum *accum, ChafaColor *color)
         color->ch [i] = accum->ch [i];
 }
 
-/* pixels_out must point to CHAFA_SYMBOL_N_PIXELS-element array */
+/* Copies the cell's pixels out of the canvas, filling in both the
+ * interleaved and the planar representation in the same pass */
 static void
 fetch_canvas_pixel_block (const ChafaPixel *src_image, gint src_width,
-                          ChafaPixel *pixels_out, gint cx, gint cy)
+                          ChafaWorkCell *wcell, gint cx, gint cy)
+{
+    const ChafaPixel *row_p;
+    gint x, y, i = 0;
+
+    row_p = src_image + cy * CHAFA_SYMBOL_HEIGHT_PIXELS * src_width + cx * CHAFA_SYMBOL_WIDTH_PIXELS;
+
+    for (y = 0; y < CHAFA_SYMBOL_HEIGHT_PIXELS; y++, row_p += src_width)
+    {
+        memcpy (&wcell->pixels [i], row_p, CHAFA_SYMBOL_WIDTH_PIXELS * sizeof (ChafaPixel));
+
+        for (x = 0; x < CHAFA_SYMBOL_WIDTH_PIXELS; x++, i++)
+        {
+            wcell->planes [0] [i] = row_p [x].col.ch [0];
+            wcell->planes [1] [i] = row_p [x].col.ch [1];
+            wcell->planes [2] [i] = row_p [x].col.ch [2];
+            wcell->planes [3] [i] = row_p [x].col.ch [3];
+        }
+    }
+}
+
+/* Hashes the pixel block that chafa_work_cell_init () would fetch for
+ * cell (cx, cy), without copying it. Used to detect unchanged cells
+ * between frames. */
+guint64
+chafa_work_cell_hash_pixels (const ChafaPixel *src_image, gint src_width, gint cx, gint cy)
 {
     const ChafaPixel *row_p;
     const ChafaPixel *end_p;
-    gint i = 0;
+    guint64 h = 0x9e3779b97f4a7c15ULL;
 
     row_p = src_image + cy * CHAFA_SYMBOL_HEIGHT_PIXELS * src_width + cx * CHAFA_SYMBOL_WIDTH_PIXELS;
     end_p = row_p + (src_width * CHAFA_SYMBOL_HEIGHT_PIXELS);
 
     for ( ; row_p < end_p; row_p += src_width)
     {
-        const ChafaPixel *p0 = row_p;
-        const ChafaPixel *p1 = p0 + CHAFA_SYMBOL_WIDTH_PIXELS;
+        const guint8 *p0 = (const guint8 *) row_p;
+        const guint8 *p1 = p0 + CHAFA_SYMBOL_WIDTH_PIXELS * sizeof (ChafaPixel);
 
-        for ( ; p0 < p1; p0++)
-            pixels_out [i++] = *p0;
+        for ( ; p0 < p1; p0 += sizeof (guint64))
+        {
+            guint64 v;
+
+            memcpy (&v, p0, sizeof (v));
+            h = (h ^ v) * 0xff51afd7ed558ccdULL;
+            h ^= h >> 32;
+        }
     }
+
+    return h;
 }
 
+/* The bitmap has the first pixel in its most significant bit. It matches
+ * the symbol's coverage, but is a single load instead of 64. */
 static void
-calc_colors_plain (const ChafaPixel *block, ChafaColorAccum *accums, const guint8 *cov)
+calc_colors_plain (const ChafaPixel *block, ChafaColorAccum *accums, guint64 bitmap)
 {
     const guint8 *in_u8 = (const guint8 *) block;
     gint i;
 
     for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
     {
-        gint16 *out_s16 = (gint16 *) (accums + *cov++);
+        gint16 *out_s16 = (gint16 *) (accums + ((bitmap >> (CHAFA_SYMBOL_N_PIXELS - 1 - i)) & 1));
 
         *out_s16++ += *in_u8++;
         *out_s16++ += *in_u8++;
@@ -95,15 +131,19 @@ void
 chafa_work_cell_get_mean_colors_for_symbol (const ChafaWorkCell *wcell, const ChafaSymbol *sym,
                                             ChafaColorPair *color_pair_out)
 {
-    const guint8 *covp = (guint8 *) &sym->coverage [0];
     ChafaColorAccum accums [2] = { 0 };
 
+#ifdef HAVE_AVX2_INTRINSICS
+    if (chafa_have_avx2 ())
+        calc_colors_bitmap_avx2 (wcell->pixels, accums, sym->bitmap);
+    else
+#endif
 #ifdef HAVE_MMX_INTRINSICS
     if (chafa_have_mmx ())
-        calc_colors_mmx (wcell->pixels, accums, covp);
+        calc_colors_mmx (wcell->pixels, accums, sym->bitmap);
     else
 #endif
-        calc_colors_plain (wcell->pixels, accums, covp);
+        calc_colors_plain (wcell->pixels, accums, sym->bitmap);
 
     if (sym->fg_weight > 1)
         chafa_color_accum_div_scalar (&accums [1], sym->fg_weight);
@@ -115,69 +155,214 @@ chafa_work_cell_get_mean_colors_for_symbol (const ChafaWorkCell *wcell, const Ch
     accum_to_color (&accums [1], &color_pair_out->colors [CHAFA_COLOR_PAIR_FG]);
 }
 
-void
-chafa_work_cell_calc_mean_color (const ChafaWorkCell *wcell, ChafaColor *color_out)
+static void
+work_cell_calc_sums (ChafaWorkCell *wcell)
 {
-    ChafaColorAccum accum = { 0 };
-    const ChafaPixel *block = wcell->pixels;
+    ChafaColorSums *sums = &wcell->total_sums;
     gint i;
 
+    memset (sums, 0, sizeof (*sums));
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+    {
+        gint r = wcell->planes [0] [i], g = wcell->planes [1] [i], b = wcell->planes [2] [i];
+
+        wcell->pixel_sq [i] = r * r + g * g + b * b;
+
+        sums->ch [0] += r;
+        sums->ch [1] += g;
+        sums->ch [2] += b;
+        sums->ch [3] += wcell->planes [3] [i];
+        sums->sq += wcell->pixel_sq [i];
+    }
+
+    sums->n = CHAFA_SYMBOL_N_PIXELS;
+    wcell->have_sums = TRUE;
+}
+
+/* Only the foreground pixels are visited; the background gets the rest of
+ * the cell's totals */
+void
+chafa_work_cell_get_sums_for_symbol (ChafaWorkCell *wcell, const ChafaSymbol *sym,
+                                     ChafaColorSums *fg_out, ChafaColorSums *bg_out)
+{
+    guint64 bitmap = sym->bitmap;
+    gint ch, i;
+
+    if (!wcell->have_sums)
+        work_cell_calc_sums (wcell);
+
+    memset (fg_out, 0, sizeof (*fg_out));
+
     for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
     {
-        chafa_color_accum_add (&accum, &block->col);
-        block++;
+        if (!((bitmap >> (CHAFA_SYMBOL_N_PIXELS - 1 - i)) & 1))
+            continue;
+
+        fg_out->ch [0] += wcell->planes [0] [i];
+        fg_out->ch [1] += wcell->planes [1] [i];
+        fg_out->ch [2] += wcell->planes [2] [i];
+        fg_out->ch [3] += wcell->planes [3] [i];
+        fg_out->sq += wcell->pixel_sq [i];
+        fg_out->n++;
+    }
+
+    for (ch = 0; ch < 4; ch++)
+        bg_out->ch [ch] = wcell->total_sums.ch [ch] - fg_out->ch [ch];
+    bg_out->sq = wcell->total_sums.sq - fg_out->sq;
+    bg_out->n = CHAFA_SYMBOL_N_PIXELS - fg_out->n;
+}
+
+void
+chafa_work_cell_calc_mean_color (const ChafaWorkCell *wcell, ChafaColor *color_out)
+{
+    gint ch, i;
+
+    for (ch = 0; ch < 4; ch++)
+    {
+        const guint8 *plane = wcell->planes [ch];
+        gint sum = 0;
+
+        for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+            sum += plane [i];
+
+        color_out->ch [ch] = sum / CHAFA_SYMBOL_N_PIXELS;
+    }
+}
+
+/* Gets each channel's smallest and largest value. The loop vectorizes to
+ * byte min/max, so this is much cheaper than sorting the planes. */
+static void
+work_cell_get_channel_extremes (const ChafaWorkCell *wcell, guint8 *lo_out, guint8 *hi_out)
+{
+    gint ch, i;
+
+    for (ch = 0; ch < 4; ch++)
+    {
+        const guint8 *plane = wcell->planes [ch];
+        guint8 lo = 0xff, hi = 0;
+
+        for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+        {
+            lo = MIN (lo, plane [i]);
+            hi = MAX (hi, plane [i]);
+        }
+
+        lo_out [ch] = lo;
+        hi_out [ch] = hi;
     }
+}
+
+/* Returns the largest difference between the brightest and darkest value in
+ * any one channel. Zero means all the pixels are the same. */
+gint
+chafa_work_cell_get_max_channel_range (const ChafaWorkCell *wcell)
+{
+    guint8 lo [4], hi [4];
+    gint max_range = 0;
+    gint ch;
+
+    work_cell_get_channel_extremes (wcell, lo, hi);
 
-    chafa_color_accum_div_scalar (&accum, CHAFA_SYMBOL_N_PIXELS);
-    accum_to_color (&accum, color_out);
+    for (ch = 0; ch < 4; ch++)
+        max_range = MAX (max_range, hi [ch] - lo [ch]);
+
+    return max_range;
 }
 
 /* colors must point to an array of two elements */
 guint64
 chafa_work_cell_to_bitmap (const ChafaWorkCell *wcell, const ChafaColorPair *color_pair)
 {
+    const ChafaColor *col_a = &color_pair->colors [0];
+    const ChafaColor *col_b = &color_pair->colors [1];
+    guint8 is_fg [CHAFA_SYMBOL_N_PIXELS];
     guint64 bitmap = 0;
-    const ChafaPixel *block = wcell->pixels;
     gint i;
 
+#ifdef HAVE_AVX2_INTRINSICS
+    if (chafa_have_avx2 ())
+        return chafa_work_cell_to_bitmap_avx2 (wcell->planes [0], wcell->planes [1],
+                                               wcell->planes [2], color_pair);
+#endif
+
+    /* Pixel p goes to the color nearer to it. Since |p-a|² - |p-b|² is
+     * linear in p, each pixel needs only a dot product against the
+     * difference of the two colors. This loop vectorizes. */
+
+    /* FIXME: What to do about alpha? */
     for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
     {
-        gint error [2];
+        gint d = 0, ch;
 
-        bitmap <<= 1;
+        for (ch = 0; ch < 3; ch++)
+        {
+            gint a = col_a->ch [ch], b = col_b->ch [ch];
 
-        /* FIXME: What to do about alpha? */
-        error [0] = chafa_color_diff_fast (&block [i].col, &color_pair->colors [0]);
-        error [1] = chafa_color_diff_fast (&block [i].col, &color_pair->colors [1]);
+            d += 2 * (b - a) * wcell->planes [ch] [i] + a * a - b * b;
+        }
 
-        if (error [0] > error [1])
-            bitmap |= 1;
+        is_fg [i] = d > 0;
     }
 
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+        bitmap = (bitmap << 1) | is_fg [i];
+
     return bitmap;
 }
 
+/* Fills index with the pixel indexes ordered by their value in plane.
+ *
+ * This is a stable LSD radix sort in two passes of four bits each. With only
+ * 64 keys, a 16-bucket pass is cheap, and unlike a comparison sort it has no
+ * data-dependent branches to mispredict. Ties keep ascending pixel order. */
+static void
+sort_index_by_plane (guint8 *index, const guint8 *plane)
+{
+    guint8 tmp [CHAFA_SYMBOL_N_PIXELS];
+    guint8 ofs_lo [16] = { 0 };
+    guint8 ofs_hi [16] = { 0 };
+    gint i, sum_lo, sum_hi;
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+    {
+        ofs_lo [plane [i] & 0x0f]++;
+        ofs_hi [plane [i] >> 4]++;
+    }
+
+    for (i = 0, sum_lo = 0, sum_hi = 0; i < 16; i++)
+    {
+        gint n_lo = ofs_lo [i], n_hi = ofs_hi [i];
+
+        ofs_lo [i] = sum_lo;
+        ofs_hi [i] = sum_hi;
+        sum_lo += n_lo;
+        sum_hi += n_hi;
+    }
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+        tmp [ofs_lo [plane [i] & 0x0f]++] = i;
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+    {
+        guint8 p = tmp [i];
+        index [ofs_hi [plane [p] >> 4]++] = p;
+    }
+}
+
 /* Get cell's pixels sorted by a specific channel. Sorts on demand and caches
  * the results. */
 static const guint8 *
 work_cell_get_sorted_pixels (ChafaWorkCell *wcell, gint ch)
 {
     guint8 *index;
-    const guint8 index_init [CHAFA_SYMBOL_N_PIXELS] =
-    {
-        0,   1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
-        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
-        48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63
-    };
 
     index = &wcell->pixels_sorted_index [ch] [0];
 
     if (wcell->have_pixels_sorted_by_channel [ch])
         return index;
 
-    memcpy (index, index_init, CHAFA_SYMBOL_N_PIXELS);
-    chafa_sort_pixel_index_by_channel (index, wcell->pixels, CHAFA_SYMBOL_N_PIXELS, ch);
+    sort_index_by_plane (index, wcell->planes [ch]);
 
     wcell->have_pixels_sorted_by_channel [ch] = TRUE;
     return index;
@@ -189,14 +374,15 @@ chafa_work_cell_init (ChafaWorkCell *wcell, const ChafaPixel *src_image,
 {
     memset (wcell->have_pixels_sorted_by_channel, 0,
             sizeof (wcell->have_pixels_sorted_by_channel));
-    fetch_canvas_pixel_block (src_image, src_width, wcell->pixels, cx, cy);
+    fetch_canvas_pixel_block (src_image, src_width, wcell, cx, cy);
     wcell->dominant_channel = -1;
+    wcell->have_sums = FALSE;
 }
 
 static gint
 work_cell_get_dominant_channel (ChafaWorkCell *wcell)
 {
-    const guint8 *sorted_pixels [4];
+    guint8 lo [4], hi [4];
     gint best_range;
     gint best_ch;
     gint i;
@@ -204,17 +390,14 @@ work_cell_get_dominant_channel (ChafaWorkCell *wcell)
     if (wcell->dominant_channel >= 0)
         return wcell->dominant_channel;
 
-    for (i = 0; i < 4; i++)
-        sorted_pixels [i] = work_cell_get_sorted_pixels (wcell, i);
+    work_cell_get_channel_extremes (wcell, lo, hi);
 
-    best_range = wcell->pixels [sorted_pixels [0] [CHAFA_SYMBOL_N_PIXELS - 1]].col.ch [0]
-        - wcell->pixels [sorted_pixels [0] [0]].col.ch [0];
+    best_range = hi [0] - lo [0];
     best_ch = 0;
 
     for (i = 1; i < 4; i++)
     {
-        gint range = wcell->pixels [sorted_pixels [i] [CHAFA_SYMBOL_N_PIXELS - 1]].col.ch [i]
-            - wcell->pixels [sorted_pixels [i] [0]].col.ch [i];
+        gint range = hi [i] - lo [i];
 
         if (range > best_range)
         {
@@ -261,14 +444,14 @@ work_cell_get_dominant_channels_for_symbol (ChafaWorkCell *wcell, const ChafaSym
     for (j = 0; j < 4; j++)
     {
         gint pen_a = sym->coverage [sorted_pixels [j] [0]];
-        min [pen_a] [j] = wcell->pixels [sorted_pixels [j] [0]].col.ch [j];
+        min [pen_a] [j] = wcell->planes [j] [sorted_pixels [j] [0]];
 
         for (i = 1; ; i++)
         {
             gint pen_b = sym->coverage [sorted_pixels [j] [i]];
             if (pen_b != pen_a)
             {
-                min [pen_b] [j] = wcell->pixels [sorted_pixels [j] [i]].col.ch [j];
+                min [pen_b] [j] = wcell->planes [j] [sorted_pixels [j] [i]];
                 break;
             }
         }
@@ -279,14 +462,14 @@ work_cell_get_dominant_channels_for_symbol (ChafaWorkCell *wcell, const ChafaSym
     for (j = 0; j < 4; j++)
     {
         gint pen_a = sym->coverage [sorted_pixels [j] [CHAFA_SYMBOL_N_PIXELS - 1]];
-        max [pen_a] [j] = wcell->pixels [sorted_pixels [j] [CHAFA_SYMBOL_N_PIXELS - 1]].col.ch [j];
+        max [pen_a] [j] = wcell->planes [j] [sorted_pixels [j] [CHAFA_SYMBOL_N_PIXELS - 1]];
 
         for (i = CHAFA_SYMBOL_N_PIXELS - 2; ; i--)
         {
             gint pen_b = sym->coverage [sorted_pixels [j] [i]];
             if (pen_b != pen_a)
             {
-                max [pen_b] [j] = wcell->pixels [sorted_pixels [j] [i]].col.ch [j];
+                max [pen_b] [j] = wcell->planes [j] [sorted_pixels [j] [i]];
                 break;
             }
         }
@@ -317,14 +500,30 @@ work_cell_get_dominant_channels_for_symbol (ChafaWorkCell *wcell, const ChafaSym
 void
 chafa_work_cell_get_contrasting_color_pair (ChafaWorkCell *wcell, ChafaColorPair *color_pair_out)
 {
-    const guint8 *sorted_pixels;
+    const guint8 *plane;
+    guint8 lo = 0xff, hi = 0;
+    gint i_lo, i_hi;
+    gint i;
+
+    plane = wcell->planes [work_cell_get_dominant_channel (wcell)];
+
+    for (i = 0; i < CHAFA_SYMBOL_N_PIXELS; i++)
+    {
+        lo = MIN (lo, plane [i]);
+        hi = MAX (hi, plane [i]);
+    }
 
-    sorted_pixels = work_cell_get_sorted_pixels (wcell, work_cell_get_dominant_channel (wcell));
+    /* Pick the same pixels the ends of a stable sort would give us: the
+     * first darkest one and the last brightest one. Both exist, so the
+     * scans stop inside the plane. */
 
-    /* Choose two colors by median cut */
+    for (i_lo = 0; plane [i_lo] != lo; i_lo++)
+        ;
+    for (i_hi = CHAFA_SYMBOL_N_PIXELS - 1; plane [i_hi] != hi; i_hi--)
+        ;
 
-    color_pair_out->colors [CHAFA_COLOR_PAIR_BG] = wcell->pixels [sorted_pixels [0]].col;
-    color_pair_out->colors [CHAFA_COLOR_PAIR_FG] = wcell->pixels [sorted_pixels [CHAFA_SYMBOL_N_PIXELS - 1]].col;
+    color_pair_out->colors [CHAFA_COLOR_PAIR_BG] = wcell->pixels [i_lo].col;
+    color_pair_out->colors [CHAFA_COLOR_PAIR_FG] = wcell->pixels [i_hi].col;
 }
 
 static const ChafaPixel *
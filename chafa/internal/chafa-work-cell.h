@@ -24,12 +24,35 @@ G_BEGIN_DECLS
 
 typedef struct ChafaWorkCell ChafaWorkCell;
 
+/* Channel sums over a set of pixels, plus the sum of their squared
+ * magnitudes over the first three channels. The squared error of the whole
+ * set against any one color follows from these without another pass. */
+typedef struct
+{
+    gint ch [4];
+    gint sq;
+    gint n;
+}
+ChafaColorSums;
+
 struct ChafaWorkCell
 {
+    /* Interleaved pixels for the SIMD symbol evaluators */
     ChafaPixel pixels [CHAFA_SYMBOL_N_PIXELS];
+
+    /* The same pixels, one plane per channel. Per-channel passes (sorting,
+     * means, bitmap construction) run over these with unit stride. */
+    guint8 planes [4] [CHAFA_SYMBOL_N_PIXELS];
+
     guint8 pixels_sorted_index [4] [CHAFA_SYMBOL_N_PIXELS];
     guint8 have_pixels_sorted_by_channel [4];
     gint dominant_channel;
+
+    /* Squared magnitude of each pixel and sums over the whole cell, filled
+     * in on first use by chafa_work_cell_get_sums_for_symbol () */
+    gint pixel_sq [CHAFA_SYMBOL_N_PIXELS];
+    ChafaColorSums total_sums;
+    guint8 have_sums;
 };
 
 /* Currently unused */
@@ -49,7 +72,11 @@ void chafa_work_cell_get_median_colors_for_symbol (ChafaWorkCell *wcell, const C
                                                    ChafaColorPair *color_pair_out);
 void chafa_work_cell_get_contrasting_color_pair (ChafaWorkCell *wcell, ChafaColorPair *color_pair_out);
 void chafa_work_cell_calc_mean_color (const ChafaWorkCell *wcell, ChafaColor *color_out);
+gint chafa_work_cell_get_max_channel_range (const ChafaWorkCell *wcell);
+void chafa_work_cell_get_sums_for_symbol (ChafaWorkCell *wcell, const ChafaSymbol *sym,
+                                          ChafaColorSums *fg_out, ChafaColorSums *bg_out);
 guint64 chafa_work_cell_to_bitmap (const ChafaWorkCell *wcell, const ChafaColorPair *color_pair);
+guint64 chafa_work_cell_hash_pixels (const ChafaPixel *src_image, gint src_width, gint cx, gint cy);
 
 G_END_DECLS
 
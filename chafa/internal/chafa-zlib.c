@@ -0,0 +1,138 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+
+#include "config.h"
+
+#include <string.h>
+
+#ifdef HAVE_ZLIB
+# include <zlib.h>
+#endif
+
+#include "chafa.h"
+#include "internal/chafa-batch.h"
+#include "internal/chafa-zlib.h"
+
+#ifdef HAVE_ZLIB
+
+/* Don't split the input into blocks smaller than this for parallel
+ * compression. Each block starts with an empty window, so small ones
+ * hurt the ratio. */
+#define COMPRESS_BLOCK_SIZE_MIN (256 * 1024)
+
+typedef struct
+{
+    const guint8 *data;
+    gsize row_len;
+    gint n_rows;
+    gint level;
+    GString *out_str;
+    guint32 adler;
+}
+CompressCtx;
+
+/* Deflates a band of rows as a run of raw deflate blocks. Every band but
+ * the last ends on a byte boundary with a sync flush, so the bands can be
+ * concatenated into a single stream. */
+static void
+compress_worker (ChafaBatchInfo *batch, const CompressCtx *ctx)
+{
+    gboolean is_last = (batch->first_row + batch->n_rows == ctx->n_rows);
+    gsize src_len = batch->n_rows * ctx->row_len;
+    gsize dest_len;
+    z_stream zs;
+    guint8 *dest;
+
+    memset (&zs, 0, sizeof (zs));
+    deflateInit2 (&zs, ctx->level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+
+    /* The sync flush marker isn't included in the bound */
+    dest_len = deflateBound (&zs, src_len) + 16;
+    dest = g_malloc (dest_len);
+
+    zs.next_in = (guint8 *) ctx->data + batch->first_row * ctx->row_len;
+    zs.avail_in = src_len;
+    zs.next_out = dest;
+    zs.avail_out = dest_len;
+
+    deflate (&zs, is_last ? Z_FINISH : Z_SYNC_FLUSH);
+    g_assert (zs.avail_in == 0);
+
+    batch->ret_p = dest;
+    batch->ret_n = zs.total_out;
+
+    deflateEnd (&zs);
+}
+
+static void
+compress_post (ChafaBatchInfo *batch, CompressCtx *ctx)
+{
+    g_string_append_len (ctx->out_str, batch->ret_p, batch->ret_n);
+    g_free (batch->ret_p);
+
+    ctx->adler = adler32 (ctx->adler,
+                          ctx->data + batch->first_row * ctx->row_len,
+                          batch->n_rows * ctx->row_len);
+}
+
+GString *
+chafa_zlib_compress_rows (gconstpointer data, gsize row_len, gint n_rows, gint level)
+{
+    CompressCtx ctx;
+    gsize data_len = row_len * n_rows;
+    gint n_batches;
+    guint8 header [2];
+    guint8 trailer [4];
+
+    ctx.data = data;
+    ctx.row_len = row_len;
+    ctx.n_rows = n_rows;
+    ctx.level = level;
+    ctx.out_str = g_string_sized_new (data_len / 4);
+    ctx.adler = adler32 (0, NULL, 0);
+
+    /* CMF: deflate with 32k window. FLG: level hint, padded to a multiple
+     * of 31 with no preset dictionary. */
+    header [0] = 0x78;
+    header [1] = (level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3) << 6;
+    header [1] += 31 - ((header [0] << 8) | header [1]) % 31;
+    g_string_append_len (ctx.out_str, (const gchar *) header, 2);
+
+    n_batches = data_len / COMPRESS_BLOCK_SIZE_MIN;
+    n_batches = CLAMP (n_batches, 1, chafa_get_n_actual_threads ());
+
+    chafa_process_batches (&ctx,
+                           "compress",
+                           (GFunc) compress_worker,
+                           (GFunc) compress_post,
+                           n_rows,
+                           n_batches,
+                           1);
+
+    trailer [0] = ctx.adler >> 24;
+    trailer [1] = ctx.adler >> 16;
+    trailer [2] = ctx.adler >> 8;
+    trailer [3] = ctx.adler;
+    g_string_append_len (ctx.out_str, (const gchar *) trailer, 4);
+
+    return ctx.out_str;
+}
+
+#endif
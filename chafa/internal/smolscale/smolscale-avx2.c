@@ -1239,6 +1239,9 @@ static SMOL_INLINE const uint32_t *
 inrow_ofs_to_pointer (const SmolScaleCtx *scale_ctx,
                       uint32_t inrow_ofs)
 {
+    if (scale_ctx->pull)
+        return _smol_pull_row (scale_ctx->pull, inrow_ofs);
+
     return scale_ctx->pixels_in + scale_ctx->rowstride_in * inrow_ofs;
 }
 
@@ -1746,29 +1749,49 @@ interp_horizontal_copy_128bpp (const SmolScaleCtx *scale_ctx,
 static void
 scale_horizontal (const SmolScaleCtx *scale_ctx,
                   SmolVerticalCtx *vertical_ctx,
-                  const uint32_t *row_in,
+                  uint32_t inrow_ofs,
                   uint64_t *row_parts_out)
 {
+    const uint32_t *row_in;
     uint64_t * SMOL_RESTRICT unpacked_in;
 
     unpacked_in = vertical_ctx->parts_row [3];
 
-    /* 32-bit unpackers need 32-bit alignment */
-    if ((((uintptr_t) row_in) & 3)
-        && scale_ctx->pixel_type_in != SMOL_PIXEL_RGB8
-        && scale_ctx->pixel_type_in != SMOL_PIXEL_BGR8)
+    if (scale_ctx->convert_row_func)
     {
+        /* Planar and high bit depth input is converted to packed pixels on the fly */
         if (!vertical_ctx->in_aligned)
             vertical_ctx->in_aligned =
                 smol_alloc_aligned (scale_ctx->width_in * sizeof (uint32_t),
                                     &vertical_ctx->in_aligned_storage);
-        memcpy (vertical_ctx->in_aligned, row_in, scale_ctx->width_in * sizeof (uint32_t));
+        scale_ctx->convert_row_func (scale_ctx, inrow_ofs, vertical_ctx->in_aligned);
         row_in = vertical_ctx->in_aligned;
     }
+    else
+    {
+        row_in = inrow_ofs_to_pointer (scale_ctx, inrow_ofs);
+
+        /* 32-bit unpackers need 32-bit alignment */
+        if ((((uintptr_t) row_in) & 3)
+            && scale_ctx->pixel_type_in != SMOL_PIXEL_RGB8
+            && scale_ctx->pixel_type_in != SMOL_PIXEL_BGR8)
+        {
+            if (!vertical_ctx->in_aligned)
+                vertical_ctx->in_aligned =
+                    smol_alloc_aligned (scale_ctx->width_in * sizeof (uint32_t),
+                                        &vertical_ctx->in_aligned_storage);
+            memcpy (vertical_ctx->in_aligned, row_in, scale_ctx->width_in * sizeof (uint32_t));
+            row_in = vertical_ctx->in_aligned;
+        }
+    }
 
     scale_ctx->unpack_row_func (row_in,
                                 unpacked_in,
                                 scale_ctx->width_in);
+    if (scale_ctx->linearize_row_func)
+        scale_ctx->linearize_row_func (scale_ctx,
+                                       unpacked_in,
+                                       scale_ctx->width_in);
     scale_ctx->hfilter_func (scale_ctx,
                              unpacked_in,
                              row_parts_out);
@@ -1794,18 +1817,18 @@ update_vertical_ctx_bilinear (const SmolScaleCtx *scale_ctx,
 
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, new_in_ofs + 1),
+                          new_in_ofs + 1,
                           vertical_ctx->parts_row [1]);
     }
     else
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, new_in_ofs),
+                          new_in_ofs,
                           vertical_ctx->parts_row [0]);
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, new_in_ofs + 1),
+                          new_in_ofs + 1,
                           vertical_ctx->parts_row [1]);
     }
 
@@ -2079,7 +2102,7 @@ scale_outrow_bilinear_##n_halvings##h_64bpp (const SmolScaleCtx *scale_ctx, \
                                                           vertical_ctx->parts_row [2], \
                                                           scale_ctx->width_out); \
                                                                         \
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out); \
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out); \
 }                                                                       \
                                                                         \
 static void                                                             \
@@ -2117,7 +2140,7 @@ scale_outrow_bilinear_##n_halvings##h_128bpp (const SmolScaleCtx *scale_ctx, \
                                                            vertical_ctx->parts_row [2], \
                                                            scale_ctx->width_out * 2); \
                                                                         \
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out); \
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out); \
 }
 
 static void
@@ -2132,7 +2155,7 @@ scale_outrow_bilinear_0h_64bpp (const SmolScaleCtx *scale_ctx,
                                           vertical_ctx->parts_row [1],
                                           vertical_ctx->parts_row [2],
                                           scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 static void
@@ -2147,7 +2170,7 @@ scale_outrow_bilinear_0h_128bpp (const SmolScaleCtx *scale_ctx,
                                            vertical_ctx->parts_row [1],
                                            vertical_ctx->parts_row [2],
                                            scale_ctx->width_out * 2);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 DEF_INTERP_VERTICAL_BILINEAR_FINAL(1)
@@ -2173,7 +2196,7 @@ scale_outrow_bilinear_1h_64bpp (const SmolScaleCtx *scale_ctx,
                                              vertical_ctx->parts_row [1],
                                              vertical_ctx->parts_row [2],
                                              scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 static void
@@ -2197,7 +2220,7 @@ scale_outrow_bilinear_1h_128bpp (const SmolScaleCtx *scale_ctx,
                                               vertical_ctx->parts_row [1],
                                               vertical_ctx->parts_row [2],
                                               scale_ctx->width_out * 2);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 DEF_INTERP_VERTICAL_BILINEAR_FINAL(2)
@@ -2292,7 +2315,7 @@ update_vertical_ctx_box_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [0]);
         weight_edge_row_64bpp (vertical_ctx->parts_row [0], w1, scale_ctx->width_out);
     }
@@ -2303,7 +2326,7 @@ update_vertical_ctx_box_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y_max),
+                          ofs_y_max,
                           vertical_ctx->parts_row [1]);
     }
     else
@@ -2349,7 +2372,7 @@ scale_outrow_box_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [0]);
         add_parts (vertical_ctx->parts_row [0],
                    vertical_ctx->parts_row [2],
@@ -2362,7 +2385,7 @@ scale_outrow_box_64bpp (const SmolScaleCtx *scale_ctx,
                              scale_ctx->span_mul_y,
                              vertical_ctx->parts_row [0],
                              scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
 }
 
 static void
@@ -2418,7 +2441,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
 
     scale_horizontal (scale_ctx,
                       vertical_ctx,
-                      inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                      ofs_y,
                       vertical_ctx->parts_row [0]);
     weight_row_128bpp (vertical_ctx->parts_row [0],
                        outrow_index == 0 ? 256 : 255 - scale_ctx->offsets_y [outrow_index * 2 - 1],
@@ -2431,7 +2454,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [1]);
         add_parts (vertical_ctx->parts_row [1],
                    vertical_ctx->parts_row [0],
@@ -2447,7 +2470,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [1]);
         weight_row_128bpp (vertical_ctx->parts_row [1],
                            w - 1,  /* Subtract 1 to avoid overflow */
@@ -2461,7 +2484,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
                               scale_ctx->span_mul_y,
                               vertical_ctx->parts_row [1],
                               scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [1], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [1], row_out);
 }
 
 static void
@@ -2478,12 +2501,12 @@ scale_outrow_one_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, 0),
+                          0,
                           vertical_ctx->parts_row [0]);
         vertical_ctx->in_ofs = 0;
     }
 
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
 }
 
 static void
@@ -2500,12 +2523,12 @@ scale_outrow_one_128bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, 0),
+                          0,
                           vertical_ctx->parts_row [0]);
         vertical_ctx->in_ofs = 0;
     }
 
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
 }
 
 static void
@@ -2516,10 +2539,100 @@ scale_outrow_copy (const SmolScaleCtx *scale_ctx,
 {
     scale_horizontal (scale_ctx,
                       vertical_ctx,
-                      inrow_ofs_to_pointer (scale_ctx, row_index),
+                      row_index,
                       vertical_ctx->parts_row [0]);
 
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
+}
+
+/* --- sRGB linearization --- */
+
+/* Opaque pixels are converted two at a time with table gathers that skip
+ * the alpha lanes. Pairs with any translucency take the scalar path. */
+
+static __m256i
+get_linear_alpha_mask (const SmolScaleCtx *scale_ctx)
+{
+    /* 32-bit lanes are { ch2, ch1, ch4, ch3 } per pixel */
+    if (scale_ctx->linear_alpha_first)
+        return _mm256_set_epi32 (0, 0, -1, 0, 0, 0, -1, 0);
+    return _mm256_set_epi32 (0, -1, 0, 0, 0, -1, 0, 0);
+}
+
+static void
+linearize_row_128bpp (const SmolScaleCtx *scale_ctx,
+                      uint64_t *row_inout,
+                      uint32_t n_pixels)
+{
+    const int *lut = (const int *) scale_ctx->srgb_to_linear_lut;
+    const __m256i alpha_mask = get_linear_alpha_mask (scale_ctx);
+    const __m256i opaque = _mm256_and_si256 (alpha_mask, _mm256_set1_epi32 (0xff));
+    const __m256i entry_mask = _mm256_set1_epi32 (0xffff);
+    uint64_t *row_max = row_inout + n_pixels * 2;
+
+    for ( ; row_inout + 4 <= row_max; row_inout += 4)
+    {
+        __m256i m0, m1;
+
+        m0 = _mm256_loadu_si256 ((const __m256i *) row_inout);
+
+        if (_mm256_movemask_epi8 (_mm256_cmpeq_epi32 (_mm256_and_si256 (m0, alpha_mask),
+                                                      opaque)) != -1)
+        {
+            _smol_linearize_pixel_128bpp (scale_ctx, row_inout);
+            _smol_linearize_pixel_128bpp (scale_ctx, row_inout + 2);
+            continue;
+        }
+
+        /* Entries are 16 bits, so use a scale of 2 and mask off the rest */
+        m1 = _mm256_i32gather_epi32 (lut, m0, 2);
+        m1 = _mm256_and_si256 (m1, entry_mask);
+        m0 = _mm256_blendv_epi8 (m1, m0, alpha_mask);
+
+        _mm256_storeu_si256 ((__m256i *) row_inout, m0);
+    }
+
+    for ( ; row_inout != row_max; row_inout += 2)
+        _smol_linearize_pixel_128bpp (scale_ctx, row_inout);
+}
+
+static void
+delinearize_row_128bpp (const SmolScaleCtx *scale_ctx,
+                        const uint64_t *row_in,
+                        uint64_t *row_out,
+                        uint32_t n_pixels)
+{
+    const int *lut = (const int *) scale_ctx->linear_to_srgb_lut;
+    const __m256i alpha_mask = get_linear_alpha_mask (scale_ctx);
+    const __m256i opaque = _mm256_and_si256 (alpha_mask, _mm256_set1_epi32 (0xff));
+    const __m256i linear_max = _mm256_set1_epi32 (SMOL_LINEAR_MAX);
+    const __m256i entry_mask = _mm256_set1_epi32 (0xff);
+    const uint64_t *row_max = row_in + n_pixels * 2;
+
+    for ( ; row_in + 4 <= row_max; row_in += 4, row_out += 4)
+    {
+        __m256i m0, m1;
+
+        m0 = _mm256_loadu_si256 ((const __m256i *) row_in);
+
+        if (_mm256_movemask_epi8 (_mm256_cmpeq_epi32 (_mm256_and_si256 (m0, alpha_mask),
+                                                      opaque)) != -1)
+        {
+            _smol_delinearize_pixel_128bpp (scale_ctx, row_in, row_out);
+            _smol_delinearize_pixel_128bpp (scale_ctx, row_in + 2, row_out + 2);
+            continue;
+        }
+
+        m1 = _mm256_min_epu32 (m0, linear_max);
+        m1 = _mm256_i32gather_epi32 (lut, m1, 1);
+        m1 = _mm256_and_si256 (m1, entry_mask);
+        m0 = _mm256_blendv_epi8 (m1, m0, alpha_mask);
+
+        _mm256_storeu_si256 ((__m256i *) row_out, m0);
+    }
+
+    for ( ; row_in != row_max; row_in += 2, row_out += 2)
+        _smol_delinearize_pixel_128bpp (scale_ctx, row_in, row_out);
 }
 
 /* --- Conversion tables --- */
@@ -2860,7 +2973,9 @@ static const SmolImplementation avx2_implementation =
             scale_outrow_box_128bpp
         }
     },
-    &avx2_conversions
+    &avx2_conversions,
+    linearize_row_128bpp,
+    delinearize_row_128bpp
 };
 
 const SmolImplementation *
@@ -0,0 +1,309 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright © 2019-2022 Hans Petter Jansson. See COPYING for details. */
+
+#include <stdlib.h> /* malloc, free, alloca */
+#include <string.h> /* memset */
+#include <immintrin.h>
+#include "smolscale-private.h"
+
+/* This implementation only overrides the horizontal box filters, which do
+ * the bulk of the work in large downscales. Everything else is left to the
+ * AVX2 or generic implementations.
+ *
+ * The spans are summed eight parts at a time using 64-bit adds, so the
+ * results are bit-identical to the scalar sums. */
+
+/* --- Box filter helpers --- */
+
+static SMOL_INLINE uint64_t
+weight_pixel_64bpp (uint64_t p,
+                    uint16_t w)
+{
+    return ((p * w) >> 8) & 0x00ff00ff00ff00ff;
+}
+
+/* p and out may be the same address */
+static SMOL_INLINE void
+weight_pixel_128bpp (uint64_t *p,
+                     uint64_t *out,
+                     uint16_t w)
+{
+    out [0] = ((p [0] * w) >> 8) & 0x00ffffff00ffffffULL;
+    out [1] = ((p [1] * w) >> 8) & 0x00ffffff00ffffffULL;
+}
+
+/* Sums n consecutive parts into eight 64-bit lanes. The tail is picked up
+ * with a masked load, which does not touch memory past the end. */
+static SMOL_INLINE __m512i
+sum_parts_8x (const uint64_t * SMOL_RESTRICT pp,
+              uint32_t n)
+{
+    __m512i acc = _mm512_setzero_si512 ();
+
+    for ( ; n >= 8; n -= 8, pp += 8)
+        acc = _mm512_add_epi64 (acc, _mm512_loadu_si512 ((const void *) pp));
+
+    if (n > 0)
+        acc = _mm512_add_epi64 (acc, _mm512_maskz_loadu_epi64 ((__mmask8) ((1U << n) - 1), pp));
+
+    return acc;
+}
+
+static SMOL_INLINE void
+sum_parts_64bpp (const uint64_t ** SMOL_RESTRICT parts_in,
+                 uint64_t * SMOL_RESTRICT accum,
+                 uint32_t n)
+{
+    const uint64_t * SMOL_RESTRICT pp = *parts_in;
+
+    *accum += _mm512_reduce_add_epi64 (sum_parts_8x (pp, n));
+    *parts_in = pp + n;
+}
+
+static SMOL_INLINE void
+sum_parts_128bpp (const uint64_t ** SMOL_RESTRICT parts_in,
+                  uint64_t * SMOL_RESTRICT accum,
+                  uint32_t n)
+{
+    const uint64_t * SMOL_RESTRICT pp = *parts_in;
+    __m512i acc;
+    __m256i h;
+    __m128i s;
+
+    /* Even lanes hold the first part of each pixel, odd lanes the second */
+    acc = sum_parts_8x (pp, n * 2);
+    h = _mm256_add_epi64 (_mm512_castsi512_si256 (acc), _mm512_extracti64x4_epi64 (acc, 1));
+    s = _mm_add_epi64 (_mm256_castsi256_si128 (h), _mm256_extracti128_si256 (h, 1));
+    s = _mm_add_epi64 (s, _mm_loadu_si128 ((const __m128i *) accum));
+    _mm_storeu_si128 ((__m128i *) accum, s);
+
+    *parts_in = pp + n * 2;
+}
+
+static SMOL_INLINE uint64_t
+scale_64bpp (uint64_t accum,
+             uint64_t multiplier)
+{
+    uint64_t a, b;
+
+    /* Average the inputs */
+    a = ((accum & 0x0000ffff0000ffffULL) * multiplier
+         + (SMOL_BOXES_MULTIPLIER / 2) + ((SMOL_BOXES_MULTIPLIER / 2) << 32)) / SMOL_BOXES_MULTIPLIER;
+    b = (((accum & 0xffff0000ffff0000ULL) >> 16) * multiplier
+         + (SMOL_BOXES_MULTIPLIER / 2) + ((SMOL_BOXES_MULTIPLIER / 2) << 32)) / SMOL_BOXES_MULTIPLIER;
+
+    /* Return pixel */
+    return (a & 0x000000ff000000ffULL) | ((b & 0x000000ff000000ffULL) << 16);
+}
+
+static SMOL_INLINE uint64_t
+scale_128bpp_half (uint64_t accum,
+                   uint64_t multiplier)
+{
+    uint64_t a, b;
+
+    a = accum & 0x00000000ffffffffULL;
+    a = (a * multiplier + SMOL_BOXES_MULTIPLIER / 2) / SMOL_BOXES_MULTIPLIER;
+
+    b = (accum & 0xffffffff00000000ULL) >> 32;
+    b = (b * multiplier + SMOL_BOXES_MULTIPLIER / 2) / SMOL_BOXES_MULTIPLIER;
+
+    return (a & 0x000000000000ffffULL)
+           | ((b & 0x000000000000ffffULL) << 32);
+}
+
+static SMOL_INLINE void
+scale_and_store_128bpp (const uint64_t * SMOL_RESTRICT accum,
+                        uint64_t multiplier,
+                        uint64_t ** SMOL_RESTRICT row_parts_out)
+{
+    *(*row_parts_out)++ = scale_128bpp_half (accum [0], multiplier);
+    *(*row_parts_out)++ = scale_128bpp_half (accum [1], multiplier);
+}
+
+/* --- Horizontal scaling --- */
+
+static void
+interp_horizontal_boxes_64bpp (const SmolScaleCtx *scale_ctx,
+                               const uint64_t *row_parts_in,
+                               uint64_t * SMOL_RESTRICT row_parts_out)
+{
+    const uint64_t * SMOL_RESTRICT pp;
+    const uint16_t *ofs_x = scale_ctx->offsets_x;
+    uint64_t *row_parts_out_max = row_parts_out + scale_ctx->width_out - 1;
+    uint64_t accum = 0;
+    uint64_t p, q, r, s;
+    uint32_t n;
+    uint64_t F;
+
+    SMOL_ASSUME_ALIGNED (row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (row_parts_out, uint64_t *);
+
+    pp = row_parts_in;
+    p = weight_pixel_64bpp (*(pp++), 256);
+    n = *(ofs_x++);
+
+    while (row_parts_out != row_parts_out_max)
+    {
+        sum_parts_64bpp ((const uint64_t ** SMOL_RESTRICT) &pp, &accum, n);
+
+        F = *(ofs_x++);
+        n = *(ofs_x++);
+
+        r = *(pp++);
+        s = r * F;
+
+        q = (s >> 8) & 0x00ff00ff00ff00ffULL;
+
+        accum += p + q;
+
+        /* (255 * r) - (F * r) */
+        p = (((r << 8) - r - s) >> 8) & 0x00ff00ff00ff00ffULL;
+
+        *(row_parts_out++) = scale_64bpp (accum, scale_ctx->span_mul_x);
+        accum = 0;
+    }
+
+    /* Final box optionally features the rightmost fractional pixel */
+
+    sum_parts_64bpp ((const uint64_t ** SMOL_RESTRICT) &pp, &accum, n);
+
+    q = 0;
+    F = *(ofs_x);
+    if (F > 0)
+        q = weight_pixel_64bpp (*(pp), F);
+
+    accum += p + q;
+    *(row_parts_out++) = scale_64bpp (accum, scale_ctx->span_mul_x);
+}
+
+static void
+interp_horizontal_boxes_128bpp (const SmolScaleCtx *scale_ctx,
+                                const uint64_t *row_parts_in,
+                                uint64_t * SMOL_RESTRICT row_parts_out)
+{
+    const uint64_t * SMOL_RESTRICT pp;
+    const uint16_t *ofs_x = scale_ctx->offsets_x;
+    uint64_t *row_parts_out_max = row_parts_out + (scale_ctx->width_out - /* 2 */ 1) * 2;
+    uint64_t accum [2] = { 0, 0 };
+    uint64_t p [2], q [2], r [2], s [2];
+    uint32_t n;
+    uint64_t F;
+
+    SMOL_ASSUME_ALIGNED (row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (row_parts_out, uint64_t *);
+
+    pp = row_parts_in;
+
+    p [0] = *(pp++);
+    p [1] = *(pp++);
+    weight_pixel_128bpp (p, p, 256);
+
+    n = *(ofs_x++);
+
+    while (row_parts_out != row_parts_out_max)
+    {
+        sum_parts_128bpp ((const uint64_t ** SMOL_RESTRICT) &pp, accum, n);
+
+        F = *(ofs_x++);
+        n = *(ofs_x++);
+
+        r [0] = *(pp++);
+        r [1] = *(pp++);
+
+        s [0] = r [0] * F;
+        s [1] = r [1] * F;
+
+        q [0] = (s [0] >> 8) & 0x00ffffff00ffffff;
+        q [1] = (s [1] >> 8) & 0x00ffffff00ffffff;
+
+        accum [0] += p [0] + q [0];
+        accum [1] += p [1] + q [1];
+
+        p [0] = (((r [0] << 8) - r [0] - s [0]) >> 8) & 0x00ffffff00ffffff;
+        p [1] = (((r [1] << 8) - r [1] - s [1]) >> 8) & 0x00ffffff00ffffff;
+
+        scale_and_store_128bpp (accum,
+                                scale_ctx->span_mul_x,
+                                (uint64_t ** SMOL_RESTRICT) &row_parts_out);
+
+        accum [0] = 0;
+        accum [1] = 0;
+    }
+
+    /* Final box optionally features the rightmost fractional pixel */
+
+    sum_parts_128bpp ((const uint64_t ** SMOL_RESTRICT) &pp, accum, n);
+
+    q [0] = 0;
+    q [1] = 0;
+
+    F = *(ofs_x);
+    if (F > 0)
+    {
+        q [0] = *(pp++);
+        q [1] = *(pp++);
+        weight_pixel_128bpp (q, q, F);
+    }
+
+    accum [0] += p [0] + q [0];
+    accum [1] += p [1] + q [1];
+
+    scale_and_store_128bpp (accum,
+                            scale_ctx->span_mul_x,
+                            (uint64_t ** SMOL_RESTRICT) &row_parts_out);
+}
+
+/* --- Implementation --- */
+
+static const SmolImplementation avx512_implementation =
+{
+    {
+        /* Horizontal filters */
+        {
+            /* 64bpp */
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            interp_horizontal_boxes_64bpp
+        },
+        {
+            /* 128bpp */
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            interp_horizontal_boxes_128bpp
+        }
+    },
+    {
+        /* Vertical filters */
+        {
+            /* 64bpp */
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
+        },
+        {
+            /* 128bpp */
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
+        }
+    },
+    NULL
+};
+
+const SmolImplementation *
+_smol_get_avx512_implementation (void)
+{
+    return &avx512_implementation;
+}
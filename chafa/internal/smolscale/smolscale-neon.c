@@ -0,0 +1,382 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright © 2019-2022 Hans Petter Jansson. See COPYING for details. */
+
+#include <stdlib.h> /* malloc, free, alloca */
+#include <string.h> /* memcpy */
+#include <arm_neon.h>
+#include "smolscale-private.h"
+
+/* This implementation only overrides the plain bilinear filters, which
+ * dominate when scaling by less than a factor of two. Everything else falls
+ * back to the generic implementation. */
+
+/* --- Linear interpolation helpers --- */
+
+#define LERP_SIMD128_U16(a, b, f)                                       \
+    vaddq_u16 (vshrq_n_u16 (vmulq_u16 (vsubq_u16 ((a), (b)), (f)), 8), (b))
+
+#define LERP_SIMD128_U32(a, b, f)                                       \
+    vaddq_u32 (vshrq_n_u32 (vmulq_u32 (vsubq_u32 ((a), (b)), (f)), 8), (b))
+
+#define LERP_SIMD128_U16_AND_MASK(a, b, f, mask)                        \
+    vandq_u16 (LERP_SIMD128_U16 ((a), (b), (f)), (mask))
+
+#define LERP_SIMD128_U32_AND_MASK(a, b, f, mask)                        \
+    vandq_u32 (LERP_SIMD128_U32 ((a), (b), (f)), (mask))
+
+/* --- Filter helpers --- */
+
+static SMOL_INLINE const uint32_t *
+inrow_ofs_to_pointer (const SmolScaleCtx *scale_ctx,
+                      uint32_t inrow_ofs)
+{
+    if (scale_ctx->pull)
+        return _smol_pull_row (scale_ctx->pull, inrow_ofs);
+
+    return scale_ctx->pixels_in + scale_ctx->rowstride_in * inrow_ofs;
+}
+
+/* --- Horizontal scaling --- */
+
+static void
+interp_horizontal_bilinear_0h_64bpp (const SmolScaleCtx *scale_ctx,
+                                     const uint64_t * SMOL_RESTRICT row_parts_in,
+                                     uint64_t * SMOL_RESTRICT row_parts_out)
+{
+    const uint16_t * SMOL_RESTRICT ofs_x = scale_ctx->offsets_x;
+    uint64_t * SMOL_RESTRICT row_parts_out_max = row_parts_out + scale_ctx->width_out;
+    const uint16x8_t mask = vdupq_n_u16 (0x00ff);
+
+    SMOL_ASSUME_ALIGNED (row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (row_parts_out, uint64_t *);
+
+    /* Two output pixels per iteration. Each load gets a pixel and its right
+     * neighbor; the pixels go in the low halves and the neighbors in the
+     * high halves. */
+    while (row_parts_out + 2 <= row_parts_out_max)
+    {
+        uint16x8_t n0, n1, p, q, factors;
+        uint16_t f0, f1;
+
+        row_parts_in += *(ofs_x++);
+        f0 = *(ofs_x++);
+        n0 = vld1q_u16 ((const uint16_t *) row_parts_in);
+
+        row_parts_in += *(ofs_x++);
+        f1 = *(ofs_x++);
+        n1 = vld1q_u16 ((const uint16_t *) row_parts_in);
+
+        p = vcombine_u16 (vget_low_u16 (n0), vget_low_u16 (n1));
+        q = vcombine_u16 (vget_high_u16 (n0), vget_high_u16 (n1));
+        factors = vcombine_u16 (vdup_n_u16 (f0), vdup_n_u16 (f1));
+
+        vst1q_u16 ((uint16_t *) row_parts_out, LERP_SIMD128_U16_AND_MASK (p, q, factors, mask));
+        row_parts_out += 2;
+    }
+
+    /* No need for a loop here; let compiler know we're doing it at most once */
+    if (row_parts_out != row_parts_out_max)
+    {
+        uint64_t p, q;
+        uint64_t F;
+
+        row_parts_in += *(ofs_x++);
+        F = *(ofs_x++);
+
+        p = *row_parts_in;
+        q = *(row_parts_in + 1);
+
+        *(row_parts_out++) = ((((p - q) * F) >> 8) + q) & 0x00ff00ff00ff00ffULL;
+    }
+}
+
+static void
+interp_horizontal_bilinear_0h_128bpp (const SmolScaleCtx *scale_ctx,
+                                      const uint64_t * SMOL_RESTRICT row_parts_in,
+                                      uint64_t * SMOL_RESTRICT row_parts_out)
+{
+    const uint16_t * SMOL_RESTRICT ofs_x = scale_ctx->offsets_x;
+    uint64_t * SMOL_RESTRICT row_parts_out_max = row_parts_out + scale_ctx->width_out * 2;
+    const uint32x4_t mask = vdupq_n_u32 (0x00ffffff);
+
+    SMOL_ASSUME_ALIGNED (row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (row_parts_out, uint64_t *);
+
+    do
+    {
+        uint32x4_t p, q, factors;
+
+        row_parts_in += *(ofs_x++) * 2;
+        factors = vdupq_n_u32 (*(ofs_x++));
+
+        p = vld1q_u32 ((const uint32_t *) row_parts_in);
+        q = vld1q_u32 ((const uint32_t *) (row_parts_in + 2));
+
+        vst1q_u32 ((uint32_t *) row_parts_out, LERP_SIMD128_U32_AND_MASK (p, q, factors, mask));
+        row_parts_out += 2;
+    }
+    while (row_parts_out != row_parts_out_max);
+}
+
+static void
+scale_horizontal (const SmolScaleCtx *scale_ctx,
+                  SmolVerticalCtx *vertical_ctx,
+                  uint32_t inrow_ofs,
+                  uint64_t *row_parts_out)
+{
+    const uint32_t *row_in;
+    uint64_t * SMOL_RESTRICT unpacked_in;
+
+    unpacked_in = vertical_ctx->parts_row [3];
+
+    if (scale_ctx->convert_row_func)
+    {
+        /* Planar and high bit depth input is converted to packed pixels on the fly */
+        if (!vertical_ctx->in_aligned)
+            vertical_ctx->in_aligned =
+                smol_alloc_aligned (scale_ctx->width_in * sizeof (uint32_t),
+                                    &vertical_ctx->in_aligned_storage);
+        scale_ctx->convert_row_func (scale_ctx, inrow_ofs, vertical_ctx->in_aligned);
+        row_in = vertical_ctx->in_aligned;
+    }
+    else
+    {
+        row_in = inrow_ofs_to_pointer (scale_ctx, inrow_ofs);
+
+        /* 32-bit unpackers need 32-bit alignment */
+        if ((((uintptr_t) row_in) & 3)
+            && scale_ctx->pixel_type_in != SMOL_PIXEL_RGB8
+            && scale_ctx->pixel_type_in != SMOL_PIXEL_BGR8)
+        {
+            if (!vertical_ctx->in_aligned)
+                vertical_ctx->in_aligned =
+                    smol_alloc_aligned (scale_ctx->width_in * sizeof (uint32_t),
+                                        &vertical_ctx->in_aligned_storage);
+            memcpy (vertical_ctx->in_aligned, row_in, scale_ctx->width_in * sizeof (uint32_t));
+            row_in = vertical_ctx->in_aligned;
+        }
+    }
+
+    scale_ctx->unpack_row_func (row_in,
+                                unpacked_in,
+                                scale_ctx->width_in);
+    if (scale_ctx->linearize_row_func)
+        scale_ctx->linearize_row_func (scale_ctx,
+                                       unpacked_in,
+                                       scale_ctx->width_in);
+    scale_ctx->hfilter_func (scale_ctx,
+                             unpacked_in,
+                             row_parts_out);
+}
+
+/* --- Vertical scaling --- */
+
+static void
+update_vertical_ctx_bilinear (const SmolScaleCtx *scale_ctx,
+                              SmolVerticalCtx *vertical_ctx,
+                              uint32_t outrow_index)
+{
+    uint32_t new_in_ofs = scale_ctx->offsets_y [outrow_index * 2];
+
+    if (new_in_ofs == vertical_ctx->in_ofs)
+        return;
+
+    if (new_in_ofs == vertical_ctx->in_ofs + 1)
+    {
+        uint64_t *t = vertical_ctx->parts_row [0];
+        vertical_ctx->parts_row [0] = vertical_ctx->parts_row [1];
+        vertical_ctx->parts_row [1] = t;
+
+        scale_horizontal (scale_ctx,
+                          vertical_ctx,
+                          new_in_ofs + 1,
+                          vertical_ctx->parts_row [1]);
+    }
+    else
+    {
+        scale_horizontal (scale_ctx,
+                          vertical_ctx,
+                          new_in_ofs,
+                          vertical_ctx->parts_row [0]);
+        scale_horizontal (scale_ctx,
+                          vertical_ctx,
+                          new_in_ofs + 1,
+                          vertical_ctx->parts_row [1]);
+    }
+
+    vertical_ctx->in_ofs = new_in_ofs;
+}
+
+static void
+interp_vertical_bilinear_store_64bpp (uint64_t F,
+                                      const uint64_t * SMOL_RESTRICT top_row_parts_in,
+                                      const uint64_t * SMOL_RESTRICT bottom_row_parts_in,
+                                      uint64_t * SMOL_RESTRICT parts_out,
+                                      uint32_t width)
+{
+    uint64_t *parts_out_last = parts_out + width;
+    const uint16x8_t mask = vdupq_n_u16 (0x00ff);
+    const uint16x8_t factors = vdupq_n_u16 (F);
+
+    SMOL_ASSUME_ALIGNED (top_row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (bottom_row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (parts_out, uint64_t *);
+
+    while (parts_out + 2 <= parts_out_last)
+    {
+        uint16x8_t p, q;
+
+        p = vld1q_u16 ((const uint16_t *) top_row_parts_in);
+        q = vld1q_u16 ((const uint16_t *) bottom_row_parts_in);
+
+        vst1q_u16 ((uint16_t *) parts_out, LERP_SIMD128_U16_AND_MASK (p, q, factors, mask));
+
+        top_row_parts_in += 2;
+        bottom_row_parts_in += 2;
+        parts_out += 2;
+    }
+
+    if (parts_out != parts_out_last)
+    {
+        uint64_t p, q;
+
+        p = *top_row_parts_in;
+        q = *bottom_row_parts_in;
+
+        *(parts_out++) = ((((p - q) * F) >> 8) + q) & 0x00ff00ff00ff00ffULL;
+    }
+}
+
+static void
+interp_vertical_bilinear_store_128bpp (uint64_t F,
+                                       const uint64_t * SMOL_RESTRICT top_row_parts_in,
+                                       const uint64_t * SMOL_RESTRICT bottom_row_parts_in,
+                                       uint64_t * SMOL_RESTRICT parts_out,
+                                       uint32_t width)
+{
+    uint64_t *parts_out_last = parts_out + width;
+    const uint32x4_t mask = vdupq_n_u32 (0x00ffffff);
+    const uint32x4_t factors = vdupq_n_u32 (F);
+
+    SMOL_ASSUME_ALIGNED (top_row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (bottom_row_parts_in, const uint64_t *);
+    SMOL_ASSUME_ALIGNED (parts_out, uint64_t *);
+
+    /* 128bpp rows always hold an even number of parts */
+    do
+    {
+        uint32x4_t p, q;
+
+        p = vld1q_u32 ((const uint32_t *) top_row_parts_in);
+        q = vld1q_u32 ((const uint32_t *) bottom_row_parts_in);
+
+        vst1q_u32 ((uint32_t *) parts_out, LERP_SIMD128_U32_AND_MASK (p, q, factors, mask));
+
+        top_row_parts_in += 2;
+        bottom_row_parts_in += 2;
+        parts_out += 2;
+    }
+    while (parts_out != parts_out_last);
+}
+
+static void
+scale_outrow_bilinear_0h_64bpp (const SmolScaleCtx *scale_ctx,
+                                SmolVerticalCtx *vertical_ctx,
+                                uint32_t outrow_index,
+                                uint32_t *row_out)
+{
+    update_vertical_ctx_bilinear (scale_ctx, vertical_ctx, outrow_index);
+    interp_vertical_bilinear_store_64bpp (scale_ctx->offsets_y [outrow_index * 2 + 1],
+                                          vertical_ctx->parts_row [0],
+                                          vertical_ctx->parts_row [1],
+                                          vertical_ctx->parts_row [2],
+                                          scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
+}
+
+static void
+scale_outrow_bilinear_0h_128bpp (const SmolScaleCtx *scale_ctx,
+                                 SmolVerticalCtx *vertical_ctx,
+                                 uint32_t outrow_index,
+                                 uint32_t *row_out)
+{
+    update_vertical_ctx_bilinear (scale_ctx, vertical_ctx, outrow_index);
+    interp_vertical_bilinear_store_128bpp (scale_ctx->offsets_y [outrow_index * 2 + 1],
+                                           vertical_ctx->parts_row [0],
+                                           vertical_ctx->parts_row [1],
+                                           vertical_ctx->parts_row [2],
+                                           scale_ctx->width_out * 2);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
+}
+
+/* --- Implementation --- */
+
+static const SmolImplementation neon_implementation =
+{
+    {
+        /* Horizontal filters */
+        {
+            /* 64bpp */
+            NULL,
+            NULL,
+            interp_horizontal_bilinear_0h_64bpp,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL
+        },
+        {
+            /* 128bpp */
+            NULL,
+            NULL,
+            interp_horizontal_bilinear_0h_128bpp,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL
+        }
+    },
+    {
+        /* Vertical filters */
+        {
+            /* 64bpp */
+            NULL,
+            NULL,
+            scale_outrow_bilinear_0h_64bpp,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL
+        },
+        {
+            /* 128bpp */
+            NULL,
+            NULL,
+            scale_outrow_bilinear_0h_128bpp,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL
+        }
+    },
+    NULL
+};
+
+const SmolImplementation *
+_smol_get_neon_implementation (void)
+{
+    return &neon_implementation;
+}
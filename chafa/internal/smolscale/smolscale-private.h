@@ -104,12 +104,14 @@ typedef enum
 }
 SmolFilterType;
 
+#define SMOL_N_STORED_ROWS 4
+
 /* For reusing rows that have already undergone horizontal scaling */
 typedef struct
 {
     uint32_t in_ofs;
-    uint64_t *parts_row [4];
-    uint64_t *row_storage [4];
+    uint64_t *parts_row [SMOL_N_STORED_ROWS];
+    uint64_t *row_storage [SMOL_N_STORED_ROWS];
     uint32_t *in_aligned;
     uint32_t *in_aligned_storage;
 }
@@ -121,6 +123,9 @@ typedef void (SmolUnpackRowFunc) (const uint32_t *row_in,
 typedef void (SmolPackRowFunc) (const uint64_t *row_in,
                                 uint32_t *row_out,
                                 uint32_t n_pixels);
+typedef void (SmolConvertRowFunc) (const SmolScaleCtx *scale_ctx,
+                                   uint32_t inrow_ofs,
+                                   uint32_t *row_out);
 typedef void (SmolHFilterFunc) (const SmolScaleCtx *scale_ctx,
                                 const uint64_t *row_limbs_in,
                                 uint64_t *row_limbs_out);
@@ -128,6 +133,13 @@ typedef void (SmolVFilterFunc) (const SmolScaleCtx *scale_ctx,
                                 SmolVerticalCtx *vertical_ctx,
                                 uint32_t outrow_index,
                                 uint32_t *row_out);
+typedef void (SmolLinearizeRowFunc) (const SmolScaleCtx *scale_ctx,
+                                     uint64_t *row_inout,
+                                     uint32_t n_pixels);
+typedef void (SmolDelinearizeRowFunc) (const SmolScaleCtx *scale_ctx,
+                                       const uint64_t *row_in,
+                                       uint64_t *row_out,
+                                       uint32_t n_pixels);
 
 #define SMOL_CONV_UNDEFINED { 0, NULL, NULL }
 #define SMOL_CONV(un_from_order, un_from_type, un_to_order, un_to_type, pk_from_order, pk_from_type, pk_to_order, pk_to_type, storage_bits) \
@@ -156,9 +168,29 @@ typedef struct
     /* Can be a NULL pointer if the implementation does not override any
      * conversions. */
     const SmolConversionTable *ctab;
+
+    /* Can be NULL pointers if the implementation does not override sRGB
+     * linearization. */
+    SmolLinearizeRowFunc *linearize_row_func;
+    SmolDelinearizeRowFunc *delinearize_row_func;
 }
 SmolImplementation;
 
+/* Input rows pulled from the caller. Rows arrive strictly in order, and
+ * the last n_rows of them are kept in a ring for the filters to revisit. */
+typedef struct
+{
+    SmolFetchRowFunc *fetch_row_func;
+    void *user_data;
+
+    uint32_t *rows;
+    uint32_t row_stride;
+    uint32_t n_rows;
+    uint32_t next_row;
+    uint32_t n_rows_in;
+}
+SmolPullCtx;
+
 struct SmolScaleCtx
 {
     /* <private> */
@@ -177,6 +209,23 @@ struct SmolScaleCtx
     SmolHFilterFunc *hfilter_func;
     SmolVFilterFunc *vfilter_func;
 
+    /* Converts a row of planar or high bit depth input to packed 8-bit
+     * pixels of type convert_ptype, or NULL if the input can be unpacked
+     * directly. planes_in [2] is unused for NV12, and packed input only
+     * uses planes_in [0]. */
+    SmolConvertRowFunc *convert_row_func;
+    SmolPixelType convert_ptype;
+    const uint8_t *planes_in [3];
+    uint32_t plane_rowstrides_in [3];
+
+    /* For float input; maps tone mapped linear values to sRGB */
+    uint8_t *float_to_srgb_lut;
+
+    /* Set if input rows are pulled from the caller instead. This is the
+     * only mutable state, which is why pulled input can't be scaled from
+     * more than one thread. */
+    SmolPullCtx *pull;
+
     /* User specified, can be NULL */
     SmolPostRowFunc *post_row_func;
     void *user_data;
@@ -188,12 +237,142 @@ struct SmolScaleCtx
 
     uint32_t width_bilin_out, height_bilin_out;
     unsigned int width_halvings, height_halvings;
+
+    /* Linear light scaling. The row funcs are NULL if it's disabled. Linear
+     * values are 12 bits wide and need 128bpp storage. Channels keep their
+     * positions, so the alpha channel is either the first or the last. */
+    SmolLinearizeRowFunc *linearize_row_func;
+    SmolDelinearizeRowFunc *delinearize_row_func;
+    const uint16_t *srgb_to_linear_lut;
+    uint8_t *linear_to_srgb_lut;
+    SmolBool linear_alpha_first;
 };
 
+const uint32_t *_smol_pull_row (SmolPullCtx *pull, uint32_t inrow_ofs);
+
+/* --- sRGB linearization --- */
+
+#define SMOL_LINEAR_MAX 4095
+
+/* In 128bpp storage, pixel parts are { ch1 << 32 | ch2, ch3 << 32 | ch4 }.
+ * These convert one premultiplied pixel. Translucent colors are converted
+ * unassociated and premultiplied again. */
+
+static SMOL_INLINE uint32_t
+_smol_linearize_channel (const uint16_t *lut, uint32_t c, uint32_t alpha)
+{
+    if (alpha == 0xff)
+        return lut [c];
+    if (alpha == 0)
+        return 0;
+
+    c = MIN ((c * 0xff + alpha / 2) / alpha, 0xff);
+    return (lut [c] * alpha + 0x7f) / 0xff;
+}
+
+static SMOL_INLINE uint32_t
+_smol_delinearize_channel (const uint8_t *lut, uint32_t c, uint32_t alpha)
+{
+    if (alpha == 0xff)
+        return lut [MIN (c, SMOL_LINEAR_MAX)];
+    if (alpha == 0)
+        return 0;
+
+    c = MIN ((c * 0xff + alpha / 2) / alpha, SMOL_LINEAR_MAX);
+    return (lut [c] * alpha + 0x7f) / 0xff;
+}
+
+static SMOL_INLINE void
+_smol_linearize_pixel_128bpp (const SmolScaleCtx *scale_ctx,
+                              uint64_t *p)
+{
+    const uint16_t *lut = scale_ctx->srgb_to_linear_lut;
+    uint32_t ch [4];
+
+    ch [0] = p [0] >> 32;
+    ch [1] = p [0] & 0xffffffff;
+    ch [2] = p [1] >> 32;
+    ch [3] = p [1] & 0xffffffff;
+
+    if (scale_ctx->linear_alpha_first)
+    {
+        ch [1] = _smol_linearize_channel (lut, ch [1], ch [0]);
+        ch [2] = _smol_linearize_channel (lut, ch [2], ch [0]);
+        ch [3] = _smol_linearize_channel (lut, ch [3], ch [0]);
+    }
+    else
+    {
+        ch [0] = _smol_linearize_channel (lut, ch [0], ch [3]);
+        ch [1] = _smol_linearize_channel (lut, ch [1], ch [3]);
+        ch [2] = _smol_linearize_channel (lut, ch [2], ch [3]);
+    }
+
+    p [0] = ((uint64_t) ch [0] << 32) | ch [1];
+    p [1] = ((uint64_t) ch [2] << 32) | ch [3];
+}
+
+static SMOL_INLINE void
+_smol_delinearize_pixel_128bpp (const SmolScaleCtx *scale_ctx,
+                                const uint64_t *p_in,
+                                uint64_t *p_out)
+{
+    const uint8_t *lut = scale_ctx->linear_to_srgb_lut;
+    uint32_t ch [4];
+
+    ch [0] = p_in [0] >> 32;
+    ch [1] = p_in [0] & 0xffffffff;
+    ch [2] = p_in [1] >> 32;
+    ch [3] = p_in [1] & 0xffffffff;
+
+    if (scale_ctx->linear_alpha_first)
+    {
+        ch [1] = _smol_delinearize_channel (lut, ch [1], ch [0]);
+        ch [2] = _smol_delinearize_channel (lut, ch [2], ch [0]);
+        ch [3] = _smol_delinearize_channel (lut, ch [3], ch [0]);
+    }
+    else
+    {
+        ch [0] = _smol_delinearize_channel (lut, ch [0], ch [3]);
+        ch [1] = _smol_delinearize_channel (lut, ch [1], ch [3]);
+        ch [2] = _smol_delinearize_channel (lut, ch [2], ch [3]);
+    }
+
+    p_out [0] = ((uint64_t) ch [0] << 32) | ch [1];
+    p_out [1] = ((uint64_t) ch [2] << 32) | ch [3];
+}
+
+/* Vertical filters pack their output rows through this. Rows may be reused
+ * for the next output row, so linear rows are converted out of place, into
+ * the unpacking buffer that scale_horizontal () is done with by now. */
+static SMOL_INLINE void
+smol_pack_row (const SmolScaleCtx *scale_ctx,
+               SmolVerticalCtx *vertical_ctx,
+               const uint64_t *row_parts_in,
+               uint32_t *row_out)
+{
+    if (scale_ctx->delinearize_row_func)
+    {
+        scale_ctx->delinearize_row_func (scale_ctx, row_parts_in,
+                                         vertical_ctx->parts_row [3],
+                                         scale_ctx->width_out);
+        row_parts_in = vertical_ctx->parts_row [3];
+    }
+
+    scale_ctx->pack_row_func (row_parts_in, row_out, scale_ctx->width_out);
+}
+
 #ifdef SMOL_WITH_AVX2
 const SmolImplementation *_smol_get_avx2_implementation (void);
 #endif
 
+#ifdef SMOL_WITH_AVX512
+const SmolImplementation *_smol_get_avx512_implementation (void);
+#endif
+
+#ifdef SMOL_WITH_NEON
+const SmolImplementation *_smol_get_neon_implementation (void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -998,15 +998,371 @@ unpack_row_123a_u_to_123a_i_128bpp (const uint32_t * SMOL_RESTRICT row_in,
     }
 }
 
+/* --- Planar input --- */
+
+static SMOL_INLINE uint8_t
+clamp_u8 (int32_t v)
+{
+    return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+/* BT.601 limited range to RGB in 8.8 fixed point. The output is opaque,
+ * so it's valid as both premultiplied and unassociated. */
+static SMOL_INLINE void
+convert_row_yuv420 (const uint8_t * SMOL_RESTRICT y_row,
+                    const uint8_t * SMOL_RESTRICT u_row,
+                    const uint8_t * SMOL_RESTRICT v_row,
+                    uint32_t uv_step,
+                    uint8_t * SMOL_RESTRICT row_out,
+                    uint32_t n_pixels)
+{
+    uint32_t x;
+
+    for (x = 0; x < n_pixels; x++)
+    {
+        int32_t d = (int32_t) u_row [(x / 2) * uv_step] - 128;
+        int32_t e = (int32_t) v_row [(x / 2) * uv_step] - 128;
+        int32_t l = ((int32_t) y_row [x] - 16) * 298 + 128;
+
+        *(row_out++) = clamp_u8 ((l + 409 * e) >> 8);
+        *(row_out++) = clamp_u8 ((l - 100 * d - 208 * e) >> 8);
+        *(row_out++) = clamp_u8 ((l + 516 * d) >> 8);
+        *(row_out++) = 0xff;
+    }
+}
+
+static void
+planar_row_i420 (const SmolScaleCtx *scale_ctx,
+                 uint32_t inrow_ofs,
+                 uint32_t *row_out)
+{
+    convert_row_yuv420 (scale_ctx->planes_in [0] + inrow_ofs * scale_ctx->plane_rowstrides_in [0],
+                        scale_ctx->planes_in [1] + (inrow_ofs / 2) * scale_ctx->plane_rowstrides_in [1],
+                        scale_ctx->planes_in [2] + (inrow_ofs / 2) * scale_ctx->plane_rowstrides_in [2],
+                        1,
+                        (uint8_t *) row_out,
+                        scale_ctx->width_in);
+}
+
+static void
+planar_row_nv12 (const SmolScaleCtx *scale_ctx,
+                 uint32_t inrow_ofs,
+                 uint32_t *row_out)
+{
+    const uint8_t *uv_row = scale_ctx->planes_in [1] + (inrow_ofs / 2) * scale_ctx->plane_rowstrides_in [1];
+
+    convert_row_yuv420 (scale_ctx->planes_in [0] + inrow_ofs * scale_ctx->plane_rowstrides_in [0],
+                        uv_row,
+                        uv_row + 1,
+                        2,
+                        (uint8_t *) row_out,
+                        scale_ctx->width_in);
+}
+
+static SmolBool
+is_planar_pixel_type (SmolPixelType pixel_type)
+{
+    return pixel_type == SMOL_PIXEL_I420 || pixel_type == SMOL_PIXEL_NV12;
+}
+
+/* Sets up the plane pointers for a contiguous image, as described in
+ * smolscale.h */
+static void
+init_planar_input (SmolScaleCtx *scale_ctx,
+                   const void *pixels_in,
+                   uint32_t height_in,
+                   uint32_t rowstride_in)
+{
+    uint32_t chroma_height = (height_in + 1) / 2;
+
+    scale_ctx->planes_in [0] = pixels_in;
+    scale_ctx->plane_rowstrides_in [0] = rowstride_in;
+    scale_ctx->planes_in [1] = scale_ctx->planes_in [0] + (size_t) rowstride_in * height_in;
+
+    if (scale_ctx->pixel_type_in == SMOL_PIXEL_I420)
+    {
+        scale_ctx->plane_rowstrides_in [1] = rowstride_in / 2;
+        scale_ctx->plane_rowstrides_in [2] = rowstride_in / 2;
+        scale_ctx->planes_in [2] = scale_ctx->planes_in [1]
+            + (size_t) scale_ctx->plane_rowstrides_in [1] * chroma_height;
+        scale_ctx->convert_row_func = planar_row_i420;
+    }
+    else
+    {
+        scale_ctx->plane_rowstrides_in [1] = rowstride_in;
+        scale_ctx->planes_in [2] = NULL;
+        scale_ctx->convert_row_func = planar_row_nv12;
+    }
+
+    /* The output is opaque, so it's valid as both premultiplied and
+     * unassociated */
+    scale_ctx->convert_ptype = SMOL_PIXEL_RGBA8_PREMULTIPLIED;
+}
+
+/* --- High bit depth input --- */
+
+/* Reading the source through the converters means it's only touched once,
+ * and only the rows the filters actually sample are converted. */
+
+static SMOL_INLINE const uint8_t *
+get_wide_row (const SmolScaleCtx *scale_ctx,
+              uint32_t inrow_ofs)
+{
+    if (scale_ctx->pull)
+        return (const uint8_t *) _smol_pull_row (scale_ctx->pull, inrow_ofs);
+
+    return scale_ctx->planes_in [0] + (size_t) inrow_ofs * scale_ctx->plane_rowstrides_in [0];
+}
+
+/* Rounds v / 257 to nearest */
+static SMOL_INLINE uint8_t
+u16_to_u8 (uint16_t v)
+{
+    return ((uint32_t) v * 255 + 32895) >> 16;
+}
+
+static void
+wide_row_rgba16 (const SmolScaleCtx *scale_ctx,
+                 uint32_t inrow_ofs,
+                 uint32_t *row_out)
+{
+    const uint16_t *row_in = (const uint16_t *) get_wide_row (scale_ctx, inrow_ofs);
+    uint8_t *out = (uint8_t *) row_out;
+    uint32_t i;
+
+    for (i = 0; i < scale_ctx->width_in * 4; i++)
+        out [i] = u16_to_u8 (row_in [i]);
+}
+
+static void
+wide_row_rgb16 (const SmolScaleCtx *scale_ctx,
+                uint32_t inrow_ofs,
+                uint32_t *row_out)
+{
+    const uint16_t *row_in = (const uint16_t *) get_wide_row (scale_ctx, inrow_ofs);
+    uint8_t *out = (uint8_t *) row_out;
+    uint32_t x;
+
+    for (x = 0; x < scale_ctx->width_in; x++)
+    {
+        *(out++) = u16_to_u8 (*(row_in++));
+        *(out++) = u16_to_u8 (*(row_in++));
+        *(out++) = u16_to_u8 (*(row_in++));
+        *(out++) = 0xff;
+    }
+}
+
+static SMOL_INLINE float
+half_to_float (uint16_t h)
+{
+    uint32_t sign = (uint32_t) (h & 0x8000) << 16;
+    uint32_t exp = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    union { uint32_t u; float f; } v;
+
+    if (exp == 0x1f)
+    {
+        /* Inf or NaN */
+        v.u = sign | 0x7f800000 | (mant << 13);
+    }
+    else if (exp == 0)
+    {
+        /* Zero or subnormal; mant * 2^-24 is exact in a float */
+        v.f = (float) mant * (1.0f / 16777216.0f);
+        v.u |= sign;
+    }
+    else
+    {
+        v.u = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    }
+
+    return v.f;
+}
+
+/* Identity below the knee, then an asymptotic roll-off towards 1.0 with
+ * matching slope. Only the brightest SDR values are affected. */
+#define TONE_MAP_KNEE 0.8f
+
+static SMOL_INLINE float
+tone_map (float c)
+{
+    float t;
+
+    if (!(c > 0.0f))  /* Also catches NaN */
+        return 0.0f;
+    if (c <= TONE_MAP_KNEE)
+        return c;
+
+    t = (c - TONE_MAP_KNEE) * (1.0f / (1.0f - TONE_MAP_KNEE));
+    if (t > 1e6f)  /* Also catches inf */
+        return 1.0f;
+
+    return TONE_MAP_KNEE + (1.0f - TONE_MAP_KNEE) * (t / (1.0f + t));
+}
+
+/* Unpremultiplies, tone maps and converts to sRGB. The output has
+ * unassociated alpha. */
+static SMOL_INLINE void
+convert_pixel_float (const SmolScaleCtx *scale_ctx,
+                     float r, float g, float b, float a,
+                     uint8_t *out)
+{
+    const uint8_t *lut = scale_ctx->float_to_srgb_lut;
+
+    if (!(a > 0.0f))
+    {
+        out [0] = out [1] = out [2] = out [3] = 0;
+        return;
+    }
+
+    if (a > 1.0f)
+        a = 1.0f;
+
+    out [0] = lut [(uint32_t) (tone_map (r / a) * SMOL_LINEAR_MAX + 0.5f)];
+    out [1] = lut [(uint32_t) (tone_map (g / a) * SMOL_LINEAR_MAX + 0.5f)];
+    out [2] = lut [(uint32_t) (tone_map (b / a) * SMOL_LINEAR_MAX + 0.5f)];
+    out [3] = (uint8_t) (a * 255.0f + 0.5f);
+}
+
+static void
+wide_row_rgba16f (const SmolScaleCtx *scale_ctx,
+                  uint32_t inrow_ofs,
+                  uint32_t *row_out)
+{
+    const uint16_t *row_in = (const uint16_t *) get_wide_row (scale_ctx, inrow_ofs);
+    uint8_t *out = (uint8_t *) row_out;
+    uint32_t x;
+
+    for (x = 0; x < scale_ctx->width_in; x++)
+    {
+        convert_pixel_float (scale_ctx,
+                             half_to_float (row_in [0]),
+                             half_to_float (row_in [1]),
+                             half_to_float (row_in [2]),
+                             half_to_float (row_in [3]),
+                             out);
+        row_in += 4;
+        out += 4;
+    }
+}
+
+static void
+wide_row_rgba32f (const SmolScaleCtx *scale_ctx,
+                  uint32_t inrow_ofs,
+                  uint32_t *row_out)
+{
+    const float *row_in = (const float *) get_wide_row (scale_ctx, inrow_ofs);
+    uint8_t *out = (uint8_t *) row_out;
+    uint32_t x;
+
+    for (x = 0; x < scale_ctx->width_in; x++)
+    {
+        convert_pixel_float (scale_ctx, row_in [0], row_in [1], row_in [2], row_in [3], out);
+        row_in += 4;
+        out += 4;
+    }
+}
+
+static uint32_t
+get_wide_bytes_per_pixel (SmolPixelType pixel_type)
+{
+    switch (pixel_type)
+    {
+        case SMOL_PIXEL_RGBA16_PREMULTIPLIED:
+        case SMOL_PIXEL_RGBA16_UNASSOCIATED:
+        case SMOL_PIXEL_RGBA16F_PREMULTIPLIED:
+            return 8;
+        case SMOL_PIXEL_RGB16:
+            return 6;
+        case SMOL_PIXEL_RGBA32F_PREMULTIPLIED:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+static SmolBool
+is_wide_pixel_type (SmolPixelType pixel_type)
+{
+    return get_wide_bytes_per_pixel (pixel_type) != 0;
+}
+
+static void init_linear_to_srgb_lut (uint8_t *lut);
+
+static void
+init_wide_input (SmolScaleCtx *scale_ctx,
+                 const void *pixels_in,
+                 uint32_t rowstride_in)
+{
+    scale_ctx->planes_in [0] = pixels_in;
+    scale_ctx->plane_rowstrides_in [0] = rowstride_in;
+
+    switch (scale_ctx->pixel_type_in)
+    {
+        case SMOL_PIXEL_RGBA16_PREMULTIPLIED:
+            scale_ctx->convert_row_func = wide_row_rgba16;
+            scale_ctx->convert_ptype = SMOL_PIXEL_RGBA8_PREMULTIPLIED;
+            break;
+        case SMOL_PIXEL_RGBA16_UNASSOCIATED:
+            scale_ctx->convert_row_func = wide_row_rgba16;
+            scale_ctx->convert_ptype = SMOL_PIXEL_RGBA8_UNASSOCIATED;
+            break;
+        case SMOL_PIXEL_RGB16:
+            scale_ctx->convert_row_func = wide_row_rgb16;
+            scale_ctx->convert_ptype = SMOL_PIXEL_RGBA8_PREMULTIPLIED;
+            break;
+        case SMOL_PIXEL_RGBA16F_PREMULTIPLIED:
+            scale_ctx->convert_row_func = wide_row_rgba16f;
+            scale_ctx->convert_ptype = SMOL_PIXEL_RGBA8_UNASSOCIATED;
+            break;
+        case SMOL_PIXEL_RGBA32F_PREMULTIPLIED:
+            scale_ctx->convert_row_func = wide_row_rgba32f;
+            scale_ctx->convert_ptype = SMOL_PIXEL_RGBA8_UNASSOCIATED;
+            break;
+        default:
+            assert (0);
+    }
+
+    if (scale_ctx->pixel_type_in == SMOL_PIXEL_RGBA16F_PREMULTIPLIED
+        || scale_ctx->pixel_type_in == SMOL_PIXEL_RGBA32F_PREMULTIPLIED)
+    {
+        scale_ctx->float_to_srgb_lut = malloc (SMOL_LINEAR_MAX + 1);
+        init_linear_to_srgb_lut (scale_ctx->float_to_srgb_lut);
+    }
+}
+
 /* --- Filter helpers --- */
 
 static SMOL_INLINE const uint32_t *
 inrow_ofs_to_pointer (const SmolScaleCtx *scale_ctx,
                       uint32_t inrow_ofs)
 {
+    if (scale_ctx->pull)
+        return _smol_pull_row (scale_ctx->pull, inrow_ofs);
+
     return scale_ctx->pixels_in + scale_ctx->rowstride_in * inrow_ofs;
 }
 
+const uint32_t *
+_smol_pull_row (SmolPullCtx *pull, uint32_t inrow_ofs)
+{
+    /* Filters near the bottom edge may reach past it */
+    inrow_ofs = MIN (inrow_ofs, pull->n_rows_in - 1);
+
+    while (pull->next_row <= inrow_ofs)
+    {
+        pull->fetch_row_func (pull->next_row,
+                              pull->rows + (pull->next_row % pull->n_rows) * pull->row_stride,
+                              pull->user_data);
+        pull->next_row++;
+    }
+
+    /* Rows that fell out of the window are gone for good */
+    assert (inrow_ofs + pull->n_rows >= pull->next_row);
+
+    return pull->rows + (inrow_ofs % pull->n_rows) * pull->row_stride;
+}
+
 static SMOL_INLINE uint32_t *
 outrow_ofs_to_pointer (const SmolScaleCtx *scale_ctx,
                        uint32_t outrow_ofs)
@@ -1623,29 +1979,49 @@ interp_horizontal_copy_128bpp (const SmolScaleCtx *scale_ctx,
 static void
 scale_horizontal (const SmolScaleCtx *scale_ctx,
                   SmolVerticalCtx *vertical_ctx,
-                  const uint32_t *row_in,
+                  uint32_t inrow_ofs,
                   uint64_t *row_parts_out)
 {
+    const uint32_t *row_in;
     uint64_t * SMOL_RESTRICT unpacked_in;
 
     unpacked_in = vertical_ctx->parts_row [3];
 
-    /* 32-bit unpackers need 32-bit alignment */
-    if ((((uintptr_t) row_in) & 3)
-        && scale_ctx->pixel_type_in != SMOL_PIXEL_RGB8
-        && scale_ctx->pixel_type_in != SMOL_PIXEL_BGR8)
+    if (scale_ctx->convert_row_func)
     {
+        /* Planar and high bit depth input is converted to packed pixels on the fly */
         if (!vertical_ctx->in_aligned)
             vertical_ctx->in_aligned =
                 smol_alloc_aligned (scale_ctx->width_in * sizeof (uint32_t),
                                     &vertical_ctx->in_aligned_storage);
-        memcpy (vertical_ctx->in_aligned, row_in, scale_ctx->width_in * sizeof (uint32_t));
+        scale_ctx->convert_row_func (scale_ctx, inrow_ofs, vertical_ctx->in_aligned);
         row_in = vertical_ctx->in_aligned;
     }
+    else
+    {
+        row_in = inrow_ofs_to_pointer (scale_ctx, inrow_ofs);
+
+        /* 32-bit unpackers need 32-bit alignment */
+        if ((((uintptr_t) row_in) & 3)
+            && scale_ctx->pixel_type_in != SMOL_PIXEL_RGB8
+            && scale_ctx->pixel_type_in != SMOL_PIXEL_BGR8)
+        {
+            if (!vertical_ctx->in_aligned)
+                vertical_ctx->in_aligned =
+                    smol_alloc_aligned (scale_ctx->width_in * sizeof (uint32_t),
+                                        &vertical_ctx->in_aligned_storage);
+            memcpy (vertical_ctx->in_aligned, row_in, scale_ctx->width_in * sizeof (uint32_t));
+            row_in = vertical_ctx->in_aligned;
+        }
+    }
 
     scale_ctx->unpack_row_func (row_in,
                                 unpacked_in,
                                 scale_ctx->width_in);
+    if (scale_ctx->linearize_row_func)
+        scale_ctx->linearize_row_func (scale_ctx,
+                                       unpacked_in,
+                                       scale_ctx->width_in);
     scale_ctx->hfilter_func (scale_ctx,
                              unpacked_in,
                              row_parts_out);
@@ -1671,18 +2047,18 @@ update_vertical_ctx_bilinear (const SmolScaleCtx *scale_ctx,
 
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, new_in_ofs + 1),
+                          new_in_ofs + 1,
                           vertical_ctx->parts_row [1]);
     }
     else
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, new_in_ofs),
+                          new_in_ofs,
                           vertical_ctx->parts_row [0]);
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, new_in_ofs + 1),
+                          new_in_ofs + 1,
                           vertical_ctx->parts_row [1]);
     }
 
@@ -1882,7 +2258,7 @@ scale_outrow_bilinear_##n_halvings##h_64bpp (const SmolScaleCtx *scale_ctx, \
                                                           vertical_ctx->parts_row [2], \
                                                           scale_ctx->width_out); \
                                                                         \
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out); \
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out); \
 }                                                                       \
                                                                         \
 static void                                                             \
@@ -1920,7 +2296,7 @@ scale_outrow_bilinear_##n_halvings##h_128bpp (const SmolScaleCtx *scale_ctx, \
                                                            vertical_ctx->parts_row [2], \
                                                            scale_ctx->width_out * 2); \
                                                                         \
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out); \
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out); \
 }
 
 static void
@@ -1935,7 +2311,7 @@ scale_outrow_bilinear_0h_64bpp (const SmolScaleCtx *scale_ctx,
                                           vertical_ctx->parts_row [1],
                                           vertical_ctx->parts_row [2],
                                           scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 static void
@@ -1950,7 +2326,7 @@ scale_outrow_bilinear_0h_128bpp (const SmolScaleCtx *scale_ctx,
                                            vertical_ctx->parts_row [1],
                                            vertical_ctx->parts_row [2],
                                            scale_ctx->width_out * 2);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 DEF_INTERP_VERTICAL_BILINEAR_FINAL(1)
@@ -1976,7 +2352,7 @@ scale_outrow_bilinear_1h_64bpp (const SmolScaleCtx *scale_ctx,
                                              vertical_ctx->parts_row [1],
                                              vertical_ctx->parts_row [2],
                                              scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 static void
@@ -2000,7 +2376,7 @@ scale_outrow_bilinear_1h_128bpp (const SmolScaleCtx *scale_ctx,
                                               vertical_ctx->parts_row [1],
                                               vertical_ctx->parts_row [2],
                                               scale_ctx->width_out * 2);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [2], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [2], row_out);
 }
 
 DEF_INTERP_VERTICAL_BILINEAR_FINAL(2)
@@ -2095,7 +2471,7 @@ update_vertical_ctx_box_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [0]);
         weight_edge_row_64bpp (vertical_ctx->parts_row [0], w1, scale_ctx->width_out);
     }
@@ -2106,7 +2482,7 @@ update_vertical_ctx_box_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y_max),
+                          ofs_y_max,
                           vertical_ctx->parts_row [1]);
     }
     else
@@ -2152,7 +2528,7 @@ scale_outrow_box_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [0]);
         add_parts (vertical_ctx->parts_row [0],
                    vertical_ctx->parts_row [2],
@@ -2165,7 +2541,7 @@ scale_outrow_box_64bpp (const SmolScaleCtx *scale_ctx,
                              scale_ctx->span_mul_y,
                              vertical_ctx->parts_row [0],
                              scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
 }
 
 static void
@@ -2221,7 +2597,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
 
     scale_horizontal (scale_ctx,
                       vertical_ctx,
-                      inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                      ofs_y,
                       vertical_ctx->parts_row [0]);
     weight_row_128bpp (vertical_ctx->parts_row [0],
                        outrow_index == 0 ? 256 : 255 - scale_ctx->offsets_y [outrow_index * 2 - 1],
@@ -2234,7 +2610,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [1]);
         add_parts (vertical_ctx->parts_row [1],
                    vertical_ctx->parts_row [0],
@@ -2250,7 +2626,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, ofs_y),
+                          ofs_y,
                           vertical_ctx->parts_row [1]);
         weight_row_128bpp (vertical_ctx->parts_row [1],
                            w - 1,  /* Subtract 1 to avoid overflow */
@@ -2264,7 +2640,7 @@ scale_outrow_box_128bpp (const SmolScaleCtx *scale_ctx,
                               scale_ctx->span_mul_y,
                               vertical_ctx->parts_row [1],
                               scale_ctx->width_out);
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [1], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [1], row_out);
 }
 
 static void
@@ -2281,12 +2657,12 @@ scale_outrow_one_64bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, 0),
+                          0,
                           vertical_ctx->parts_row [0]);
         vertical_ctx->in_ofs = 0;
     }
 
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
 }
 
 static void
@@ -2303,12 +2679,12 @@ scale_outrow_one_128bpp (const SmolScaleCtx *scale_ctx,
     {
         scale_horizontal (scale_ctx,
                           vertical_ctx,
-                          inrow_ofs_to_pointer (scale_ctx, 0),
+                          0,
                           vertical_ctx->parts_row [0]);
         vertical_ctx->in_ofs = 0;
     }
 
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
 }
 
 static void
@@ -2319,10 +2695,10 @@ scale_outrow_copy (const SmolScaleCtx *scale_ctx,
 {
     scale_horizontal (scale_ctx,
                       vertical_ctx,
-                      inrow_ofs_to_pointer (scale_ctx, row_index),
+                      row_index,
                       vertical_ctx->parts_row [0]);
 
-    scale_ctx->pack_row_func (vertical_ctx->parts_row [0], row_out, scale_ctx->width_out);
+    smol_pack_row (scale_ctx, vertical_ctx, vertical_ctx->parts_row [0], row_out);
 }
 
 static void
@@ -2341,45 +2717,72 @@ scale_outrow (const SmolScaleCtx *scale_ctx,
 }
 
 static void
-do_rows (const SmolScaleCtx *scale_ctx,
-         void *outrows_dest,
-         uint32_t row_out_index,
-         uint32_t n_rows)
+init_vertical_ctx (const SmolScaleCtx *scale_ctx,
+                   SmolVerticalCtx *vertical_ctx)
 {
-    SmolVerticalCtx vertical_ctx = { 0 };
     uint32_t n_parts_per_pixel = 1;
-    uint32_t n_stored_rows = 4;
     uint32_t i;
 
     if (scale_ctx->storage_type == SMOL_STORAGE_128BPP)
         n_parts_per_pixel = 2;
 
+    memset (vertical_ctx, 0, sizeof (*vertical_ctx));
+
     /* Must be one less, or this test in update_vertical_ctx() will wrap around:
      * if (new_in_ofs == vertical_ctx->in_ofs + 1) { ... } */
-    vertical_ctx.in_ofs = UINT_MAX - 1;
+    vertical_ctx->in_ofs = UINT_MAX - 1;
 
-    for (i = 0; i < n_stored_rows; i++)
+    for (i = 0; i < SMOL_N_STORED_ROWS; i++)
     {
-        vertical_ctx.parts_row [i] =
+        vertical_ctx->parts_row [i] =
             smol_alloc_aligned (MAX (scale_ctx->width_in, scale_ctx->width_out)
                                 * n_parts_per_pixel * sizeof (uint64_t),
-                                &vertical_ctx.row_storage [i]);
+                                &vertical_ctx->row_storage [i]);
     }
+}
 
-    for (i = row_out_index; i < row_out_index + n_rows; i++)
+static void
+finalize_vertical_ctx (SmolVerticalCtx *vertical_ctx)
+{
+    uint32_t i;
+
+    for (i = 0; i < SMOL_N_STORED_ROWS; i++)
     {
-        scale_outrow (scale_ctx, &vertical_ctx, i, outrows_dest);
-        outrows_dest = (uint32_t *) outrows_dest + scale_ctx->rowstride_out;
+        smol_free (vertical_ctx->row_storage [i]);
     }
 
-    for (i = 0; i < n_stored_rows; i++)
+    /* Used to align row data if needed. May be allocated in scale_horizontal(). */
+    if (vertical_ctx->in_aligned)
+        smol_free (vertical_ctx->in_aligned_storage);
+}
+
+static void
+do_rows_with_ctx (const SmolScaleCtx *scale_ctx,
+                  SmolVerticalCtx *vertical_ctx,
+                  void *outrows_dest,
+                  uint32_t row_out_index,
+                  uint32_t n_rows)
+{
+    uint32_t i;
+
+    for (i = row_out_index; i < row_out_index + n_rows; i++)
     {
-        smol_free (vertical_ctx.row_storage [i]);
+        scale_outrow (scale_ctx, vertical_ctx, i, outrows_dest);
+        outrows_dest = (uint32_t *) outrows_dest + scale_ctx->rowstride_out;
     }
+}
 
-    /* Used to align row data if needed. May be allocated in scale_horizontal(). */
-    if (vertical_ctx.in_aligned)
-        smol_free (vertical_ctx.in_aligned_storage);
+static void
+do_rows (const SmolScaleCtx *scale_ctx,
+         void *outrows_dest,
+         uint32_t row_out_index,
+         uint32_t n_rows)
+{
+    SmolVerticalCtx vertical_ctx;
+
+    init_vertical_ctx (scale_ctx, &vertical_ctx);
+    do_rows_with_ctx (scale_ctx, &vertical_ctx, outrows_dest, row_out_index, n_rows);
+    finalize_vertical_ctx (&vertical_ctx);
 }
 
 /* --- Conversion tables --- */
@@ -2660,6 +3063,79 @@ static const SmolConversionTable generic_conversions =
 } }
 };
 
+/* --- sRGB linearization --- */
+
+/* sRGB to 12-bit linear. All 256 entries are distinct, so opaque colors
+ * survive the round trip unchanged. Padded so SIMD gathers can fetch 32
+ * bits at a time from the last entry. */
+static const uint16_t srgb_to_linear_lut [256 + 2] =
+{
+       0,    1,    2,    4,    5,    6,    7,    9,   10,   11,   12,   14,
+      15,   16,   18,   20,   21,   23,   25,   27,   29,   31,   33,   35,
+      37,   40,   42,   45,   48,   50,   53,   56,   59,   62,   66,   69,
+      72,   76,   79,   83,   87,   91,   95,   99,  103,  107,  112,  116,
+     121,  126,  131,  136,  141,  146,  151,  156,  162,  168,  173,  179,
+     185,  191,  197,  204,  210,  216,  223,  230,  237,  244,  251,  258,
+     265,  273,  280,  288,  296,  304,  312,  320,  329,  337,  346,  354,
+     363,  372,  381,  390,  400,  409,  419,  428,  438,  448,  458,  469,
+     479,  490,  500,  511,  522,  533,  544,  555,  567,  578,  590,  602,
+     614,  626,  639,  651,  664,  676,  689,  702,  715,  728,  742,  755,
+     769,  783,  797,  811,  825,  840,  854,  869,  884,  899,  914,  929,
+     945,  960,  976,  992, 1008, 1024, 1041, 1057, 1074, 1091, 1108, 1125,
+    1142, 1159, 1177, 1195, 1213, 1231, 1249, 1267, 1286, 1304, 1323, 1342,
+    1361, 1381, 1400, 1420, 1440, 1459, 1480, 1500, 1520, 1541, 1562, 1582,
+    1603, 1625, 1646, 1668, 1689, 1711, 1733, 1755, 1778, 1800, 1823, 1846,
+    1869, 1892, 1916, 1939, 1963, 1987, 2011, 2035, 2059, 2084, 2109, 2133,
+    2159, 2184, 2209, 2235, 2260, 2286, 2312, 2339, 2365, 2392, 2419, 2446,
+    2473, 2500, 2527, 2555, 2583, 2611, 2639, 2668, 2696, 2725, 2754, 2783,
+    2812, 2841, 2871, 2901, 2931, 2961, 2991, 3022, 3052, 3083, 3114, 3146,
+    3177, 3209, 3240, 3272, 3304, 3337, 3369, 3402, 3435, 3468, 3501, 3535,
+    3568, 3602, 3636, 3670, 3705, 3739, 3774, 3809, 3844, 3879, 3915, 3950,
+    3986, 4022, 4059, 4095,
+    0, 0
+};
+
+static void
+init_linear_to_srgb_lut (uint8_t *lut)
+{
+    uint32_t c = 0;
+    uint32_t i;
+
+    /* Map each linear value to the nearest sRGB value */
+    for (i = 0; i <= SMOL_LINEAR_MAX; i++)
+    {
+        while (c < 0xff
+               && i * 2 >= (uint32_t) srgb_to_linear_lut [c] + srgb_to_linear_lut [c + 1])
+            c++;
+        lut [i] = c;
+    }
+}
+
+static void
+linearize_row_128bpp (const SmolScaleCtx *scale_ctx,
+                      uint64_t *row_inout,
+                      uint32_t n_pixels)
+{
+    uint64_t *row_max = row_inout + n_pixels * 2;
+
+    for ( ; row_inout != row_max; row_inout += 2)
+        _smol_linearize_pixel_128bpp (scale_ctx, row_inout);
+}
+
+static void
+delinearize_row_128bpp (const SmolScaleCtx *scale_ctx,
+                        const uint64_t *row_in,
+                        uint64_t *row_out,
+                        uint32_t n_pixels)
+{
+    const uint64_t *row_max = row_in + n_pixels * 2;
+
+    for ( ; row_in != row_max; row_in += 2, row_out += 2)
+        _smol_delinearize_pixel_128bpp (scale_ctx, row_in, row_out);
+}
+
+/* --- Implementation tables --- */
+
 static const SmolImplementation generic_implementation =
 {
     {
@@ -2720,7 +3196,9 @@ static const SmolImplementation generic_implementation =
             scale_outrow_box_128bpp
         }
     },
-    &generic_conversions
+    &generic_conversions,
+    linearize_row_128bpp,
+    delinearize_row_128bpp
 };
 
 /* In the absence of a proper build system, runtime detection is more
@@ -2777,6 +3255,20 @@ get_host_pixel_type (SmolPixelType pixel_type)
             host_pixel_type = SMOL_PIXEL_RGB8; break;
         case SMOL_PIXEL_BGR8:
             host_pixel_type = SMOL_PIXEL_BGR8; break;
+        case SMOL_PIXEL_I420:
+            host_pixel_type = SMOL_PIXEL_I420; break;
+        case SMOL_PIXEL_NV12:
+            host_pixel_type = SMOL_PIXEL_NV12; break;
+        case SMOL_PIXEL_RGBA16_PREMULTIPLIED:
+            host_pixel_type = SMOL_PIXEL_RGBA16_PREMULTIPLIED; break;
+        case SMOL_PIXEL_RGBA16_UNASSOCIATED:
+            host_pixel_type = SMOL_PIXEL_RGBA16_UNASSOCIATED; break;
+        case SMOL_PIXEL_RGB16:
+            host_pixel_type = SMOL_PIXEL_RGB16; break;
+        case SMOL_PIXEL_RGBA16F_PREMULTIPLIED:
+            host_pixel_type = SMOL_PIXEL_RGBA16F_PREMULTIPLIED; break;
+        case SMOL_PIXEL_RGBA32F_PREMULTIPLIED:
+            host_pixel_type = SMOL_PIXEL_RGBA32F_PREMULTIPLIED; break;
         case SMOL_PIXEL_MAX:
             host_pixel_type = SMOL_PIXEL_MAX; break;
     }
@@ -2801,6 +3293,24 @@ have_avx2 (void)
 
 #endif
 
+#ifdef SMOL_WITH_AVX512
+
+static SmolBool
+have_avx512 (void)
+{
+#ifdef HAVE_GCC_X86_FEATURE_BUILTINS
+    __builtin_cpu_init ();
+
+    if (__builtin_cpu_supports ("avx512f")
+        && __builtin_cpu_supports ("avx512bw"))
+        return TRUE;
+#endif
+
+    return FALSE;
+}
+
+#endif
+
 static void
 try_override_conversion (SmolScaleCtx *scale_ctx,
                          const SmolImplementation *impl,
@@ -2810,6 +3320,9 @@ try_override_conversion (SmolScaleCtx *scale_ctx,
 {
     const SmolConversion *conv;
 
+    if (!impl->ctab)
+        return;
+
     conv = &impl->ctab->conversions
         [scale_ctx->storage_type] [ptype_in] [ptype_out];
 
@@ -2846,13 +3359,28 @@ get_implementations (SmolScaleCtx *scale_ctx)
     SmolPixelType ptype_in, ptype_out;
     uint8_t n_bytes_per_pixel;
     const SmolImplementation *avx2_impl = NULL;
+    const SmolImplementation *avx512_impl = NULL;
+    const SmolImplementation *neon_impl = NULL;
 
 #ifdef SMOL_WITH_AVX2
     if (have_avx2 ())
         avx2_impl = _smol_get_avx2_implementation ();
 #endif
 
-    ptype_in = get_host_pixel_type (scale_ctx->pixel_type_in);
+#ifdef SMOL_WITH_AVX512
+    if (have_avx512 ())
+        avx512_impl = _smol_get_avx512_implementation ();
+#endif
+
+#ifdef SMOL_WITH_NEON
+    /* Advanced SIMD is a mandatory part of AArch64 */
+    neon_impl = _smol_get_neon_implementation ();
+#endif
+
+    /* Converted input is unpacked from the rows convert_row_func () produces */
+    ptype_in = get_host_pixel_type (scale_ctx->convert_row_func
+                                    ? scale_ctx->convert_ptype
+                                    : scale_ctx->pixel_type_in);
     ptype_out = get_host_pixel_type (scale_ctx->pixel_type_out);
 
     /* Install generic unpack()/pack() */
@@ -2870,6 +3398,14 @@ get_implementations (SmolScaleCtx *scale_ctx)
         try_override_conversion (scale_ctx, avx2_impl,
                                  ptype_in, ptype_out,
                                  &n_bytes_per_pixel);
+    if (avx512_impl)
+        try_override_conversion (scale_ctx, avx512_impl,
+                                 ptype_in, ptype_out,
+                                 &n_bytes_per_pixel);
+    if (neon_impl)
+        try_override_conversion (scale_ctx, neon_impl,
+                                 ptype_in, ptype_out,
+                                 &n_bytes_per_pixel);
 
     /* Some conversions require extra precision. This can only ever
      * upgrade the storage from 64bpp to 128bpp, but we handle both
@@ -2894,6 +3430,74 @@ get_implementations (SmolScaleCtx *scale_ctx)
 
     if (avx2_impl)
         try_override_filters (scale_ctx, avx2_impl);
+    if (avx512_impl)
+        try_override_filters (scale_ctx, avx512_impl);
+    if (neon_impl)
+        try_override_filters (scale_ctx, neon_impl);
+
+    /* Linearization, if it was enabled in init */
+
+    if (scale_ctx->linear_to_srgb_lut)
+    {
+        scale_ctx->linearize_row_func = generic_implementation.linearize_row_func;
+        scale_ctx->delinearize_row_func = generic_implementation.delinearize_row_func;
+
+        if (avx2_impl && avx2_impl->linearize_row_func)
+        {
+            scale_ctx->linearize_row_func = avx2_impl->linearize_row_func;
+            scale_ctx->delinearize_row_func = avx2_impl->delinearize_row_func;
+        }
+    }
+}
+
+static SmolBool
+is_unassociated_pixel_type (SmolPixelType pixel_type)
+{
+    return pixel_type == SMOL_PIXEL_RGBA8_UNASSOCIATED
+        || pixel_type == SMOL_PIXEL_BGRA8_UNASSOCIATED
+        || pixel_type == SMOL_PIXEL_ARGB8_UNASSOCIATED
+        || pixel_type == SMOL_PIXEL_ABGR8_UNASSOCIATED;
+}
+
+static void
+init_linearization (SmolScaleCtx *scale_ctx)
+{
+    SmolPixelType ptype_in;
+
+    ptype_in = scale_ctx->convert_row_func
+        ? scale_ctx->convert_ptype
+        : scale_ctx->pixel_type_in;
+
+    /* Unassociated to unassociated keeps colors in a premultiplied
+     * representation with different precision. There's no room left
+     * for linear values there. */
+    if (is_unassociated_pixel_type (ptype_in)
+        && (is_unassociated_pixel_type (scale_ctx->pixel_type_out)
+            || scale_ctx->pixel_type_out == SMOL_PIXEL_RGB8
+            || scale_ctx->pixel_type_out == SMOL_PIXEL_BGR8))
+        return;
+
+    /* Copying doesn't mix any pixels */
+    if (scale_ctx->filter_h == SMOL_FILTER_COPY
+        && scale_ctx->filter_v == SMOL_FILTER_COPY)
+        return;
+
+    ptype_in = get_host_pixel_type (ptype_in);
+    scale_ctx->linear_alpha_first =
+        (ptype_in == SMOL_PIXEL_ARGB8_PREMULTIPLIED
+         || ptype_in == SMOL_PIXEL_ABGR8_PREMULTIPLIED
+         || ptype_in == SMOL_PIXEL_ARGB8_UNASSOCIATED
+         || ptype_in == SMOL_PIXEL_ABGR8_UNASSOCIATED);
+
+    scale_ctx->srgb_to_linear_lut = srgb_to_linear_lut;
+    scale_ctx->linear_to_srgb_lut = malloc (SMOL_LINEAR_MAX + 1 + 3);
+    init_linear_to_srgb_lut (scale_ctx->linear_to_srgb_lut);
+
+    /* Pad for SIMD gathers */
+    memset (scale_ctx->linear_to_srgb_lut + SMOL_LINEAR_MAX + 1, 0, 3);
+
+    /* 64bpp storage has no headroom for the extra bits */
+    scale_ctx->storage_type = SMOL_STORAGE_128BPP;
 }
 
 static void
@@ -2909,7 +3513,8 @@ smol_scale_init (SmolScaleCtx *scale_ctx,
                  uint32_t height_out,
                  uint32_t rowstride_out,
                  SmolPostRowFunc post_row_func,
-                 void *user_data)
+                 void *user_data,
+                 SmolFlags flags)
 {
     SmolStorageType storage_type [2];
 
@@ -2927,6 +3532,17 @@ smol_scale_init (SmolScaleCtx *scale_ctx,
     scale_ctx->post_row_func = post_row_func;
     scale_ctx->user_data = user_data;
 
+    scale_ctx->pull = NULL;
+    scale_ctx->convert_row_func = NULL;
+    scale_ctx->float_to_srgb_lut = NULL;
+    if (is_planar_pixel_type (pixel_type_in))
+        init_planar_input (scale_ctx, pixels_in, height_in, rowstride_in);
+    else if (is_wide_pixel_type (pixel_type_in))
+        init_wide_input (scale_ctx, pixels_in, rowstride_in);
+
+    assert (!is_planar_pixel_type (pixel_type_out));
+    assert (!is_wide_pixel_type (pixel_type_out));
+
     pick_filter_params (width_in, width_out,
                         &scale_ctx->width_halvings,
                         &scale_ctx->width_bilin_out,
@@ -2940,6 +3556,14 @@ smol_scale_init (SmolScaleCtx *scale_ctx,
 
     scale_ctx->storage_type = MAX (storage_type [0], storage_type [1]);
 
+    scale_ctx->linearize_row_func = NULL;
+    scale_ctx->delinearize_row_func = NULL;
+    scale_ctx->srgb_to_linear_lut = NULL;
+    scale_ctx->linear_to_srgb_lut = NULL;
+    scale_ctx->linear_alpha_first = FALSE;
+    if (flags & SMOL_ENABLE_SRGB_LINEARIZATION)
+        init_linearization (scale_ctx);
+
     scale_ctx->offsets_x = malloc (((scale_ctx->width_bilin_out + 1) * 2
                                     + (scale_ctx->height_bilin_out + 1) * 2) * sizeof (uint16_t));
     scale_ctx->offsets_y = scale_ctx->offsets_x + (scale_ctx->width_bilin_out + 1) * 2;
@@ -2975,10 +3599,68 @@ smol_scale_init (SmolScaleCtx *scale_ctx,
     get_implementations (scale_ctx);
 }
 
+/* The ring must hold every input row that contributes to one output row,
+ * so a row is never needed again after it has been dropped */
+static uint32_t
+get_pull_window_rows (const SmolScaleCtx *scale_ctx)
+{
+    uint32_t n_rows = 0;
+    uint32_t i;
+
+    if (scale_ctx->filter_v == SMOL_FILTER_BOX)
+    {
+        for (i = 0; i < scale_ctx->height_out; i++)
+        {
+            uint32_t span = scale_ctx->offsets_y [(i + 1) * 2] - scale_ctx->offsets_y [i * 2];
+            n_rows = MAX (n_rows, span);
+        }
+    }
+    else
+    {
+        /* Two bilinear taps, each covering the rows halved into it */
+        n_rows = 2U << scale_ctx->height_halvings;
+    }
+
+    /* Room for a row at each edge */
+    return n_rows + 2;
+}
+
+static void
+init_pull_input (SmolScaleCtx *scale_ctx,
+                 SmolFetchRowFunc *fetch_row_func,
+                 void *user_data)
+{
+    SmolPullCtx *pull;
+
+    pull = calloc (sizeof (SmolPullCtx), 1);
+    pull->fetch_row_func = fetch_row_func;
+    pull->user_data = user_data;
+    pull->n_rows_in = scale_ctx->height_in;
+    pull->n_rows = MIN (get_pull_window_rows (scale_ctx), scale_ctx->height_in);
+
+    /* Wide enough for any packed pixel type. Units are uint32s. */
+    pull->row_stride = scale_ctx->width_in;
+    if (is_wide_pixel_type (scale_ctx->pixel_type_in))
+        pull->row_stride = (scale_ctx->width_in
+                            * get_wide_bytes_per_pixel (scale_ctx->pixel_type_in)
+                            + 3) / sizeof (uint32_t);
+    pull->rows = malloc ((size_t) pull->row_stride * pull->n_rows * sizeof (uint32_t));
+
+    scale_ctx->pull = pull;
+}
+
 static void
 smol_scale_finalize (SmolScaleCtx *scale_ctx)
 {
     free (scale_ctx->offsets_x);
+    free (scale_ctx->linear_to_srgb_lut);
+    free (scale_ctx->float_to_srgb_lut);
+
+    if (scale_ctx->pull)
+    {
+        free (scale_ctx->pull->rows);
+        free (scale_ctx->pull);
+    }
 }
 
 /* --- Public API --- */
@@ -3010,7 +3692,8 @@ smol_scale_new (SmolPixelType pixel_type_in,
                      height_out,
                      rowstride_out,
                      NULL,
-                     NULL);
+                     NULL,
+                     SMOL_NO_FLAGS);
     return scale_ctx;
 }
 
@@ -3043,7 +3726,81 @@ smol_scale_new_full (SmolPixelType pixel_type_in,
                      height_out,
                      rowstride_out,
                      post_row_func,
-                     user_data);
+                     user_data,
+                     SMOL_NO_FLAGS);
+    return scale_ctx;
+}
+
+SmolScaleCtx *
+smol_scale_new_flags (SmolPixelType pixel_type_in,
+                      const void *pixels_in,
+                      uint32_t width_in,
+                      uint32_t height_in,
+                      uint32_t rowstride_in,
+                      SmolPixelType pixel_type_out,
+                      void *pixels_out,
+                      uint32_t width_out,
+                      uint32_t height_out,
+                      uint32_t rowstride_out,
+                      SmolPostRowFunc post_row_func,
+                      void *user_data,
+                      SmolFlags flags)
+{
+    SmolScaleCtx *scale_ctx;
+
+    scale_ctx = calloc (sizeof (SmolScaleCtx), 1);
+    smol_scale_init (scale_ctx,
+                     pixel_type_in,
+                     pixels_in,
+                     width_in,
+                     height_in,
+                     rowstride_in,
+                     pixel_type_out,
+                     pixels_out,
+                     width_out,
+                     height_out,
+                     rowstride_out,
+                     post_row_func,
+                     user_data,
+                     flags);
+    return scale_ctx;
+}
+
+SmolScaleCtx *
+smol_scale_new_pull (SmolPixelType pixel_type_in,
+                     SmolFetchRowFunc *fetch_row_func,
+                     void *fetch_user_data,
+                     uint32_t width_in,
+                     uint32_t height_in,
+                     SmolPixelType pixel_type_out,
+                     void *pixels_out,
+                     uint32_t width_out,
+                     uint32_t height_out,
+                     uint32_t rowstride_out,
+                     SmolPostRowFunc post_row_func,
+                     void *user_data,
+                     SmolFlags flags)
+{
+    SmolScaleCtx *scale_ctx;
+
+    assert (!is_planar_pixel_type (pixel_type_in));
+
+    scale_ctx = calloc (sizeof (SmolScaleCtx), 1);
+    smol_scale_init (scale_ctx,
+                     pixel_type_in,
+                     NULL,
+                     width_in,
+                     height_in,
+                     width_in * sizeof (uint32_t),
+                     pixel_type_out,
+                     pixels_out,
+                     width_out,
+                     height_out,
+                     rowstride_out,
+                     post_row_func,
+                     user_data,
+                     flags);
+    init_pull_input (scale_ctx, fetch_row_func, fetch_user_data);
     return scale_ctx;
 }
 
@@ -3073,7 +3830,7 @@ smol_scale_simple (SmolPixelType pixel_type_in,
                      width_in, height_in, rowstride_in,
                      pixel_type_out, pixels_out,
                      width_out, height_out, rowstride_out,
-                     NULL, NULL);
+                     NULL, NULL, SMOL_NO_FLAGS);
     do_rows (&scale_ctx,
              outrow_ofs_to_pointer (&scale_ctx, 0),
              0,
@@ -3103,3 +3860,42 @@ smol_scale_batch_full (const SmolScaleCtx *scale_ctx,
              first_out_row,
              n_out_rows);
 }
+
+/* The vertical context tracks which input rows it holds horizontally scaled
+ * copies of, so carrying it over from one batch to the next lets them share
+ * the rows at the seam. */
+struct SmolScaleState
+{
+    SmolVerticalCtx vertical_ctx;
+};
+
+SmolScaleState *
+smol_scale_state_new (const SmolScaleCtx *scale_ctx)
+{
+    SmolScaleState *state;
+
+    state = malloc (sizeof (SmolScaleState));
+    init_vertical_ctx (scale_ctx, &state->vertical_ctx);
+    return state;
+}
+
+void
+smol_scale_state_destroy (SmolScaleState *state)
+{
+    finalize_vertical_ctx (&state->vertical_ctx);
+    free (state);
+}
+
+void
+smol_scale_batch_with_state (const SmolScaleCtx *scale_ctx,
+                             SmolScaleState *state,
+                             void *outrows_dest,
+                             uint32_t first_out_row,
+                             uint32_t n_out_rows)
+{
+    do_rows_with_ctx (scale_ctx,
+                      &state->vertical_ctx,
+                      outrows_dest,
+                      first_out_row,
+                      n_out_rows);
+}
@@ -30,6 +30,29 @@ typedef enum
     SMOL_PIXEL_RGB8,
     SMOL_PIXEL_BGR8,
 
+    /* Planar YUV 4:2:0, BT.601 limited range. Input only. The chroma
+     * plane(s) follow the luma plane, which is height_in rows of
+     * rowstride_in bytes. I420 has separate U and V planes with half the
+     * luma rowstride; NV12 has one interleaved UV plane with the same
+     * rowstride as luma. */
+
+    SMOL_PIXEL_I420,
+    SMOL_PIXEL_NV12,
+
+    /* 16 bits per channel in host byte order, with the same transfer
+     * function as the 8-bit types. Input only. rowstride_in need not be
+     * a multiple of 4. */
+
+    SMOL_PIXEL_RGBA16_PREMULTIPLIED,
+    SMOL_PIXEL_RGBA16_UNASSOCIATED,
+    SMOL_PIXEL_RGB16,
+
+    /* Half and single precision floats in linear light, premultiplied.
+     * Input only. Values above 1.0 are tone mapped into range. */
+
+    SMOL_PIXEL_RGBA16F_PREMULTIPLIED,
+    SMOL_PIXEL_RGBA32F_PREMULTIPLIED,
+
     SMOL_PIXEL_MAX
 }
 SmolPixelType;
@@ -38,6 +61,25 @@ typedef void (SmolPostRowFunc) (uint32_t *row_inout,
                                 int width,
                                 void *user_data);
 
+/* Fills row_out with input row inrow_ofs, width_in pixels of pixel_type_in.
+ * See smol_scale_new_pull(). */
+typedef void (SmolFetchRowFunc) (uint32_t inrow_ofs,
+                                 void *row_out,
+                                 void *user_data);
+
+typedef enum
+{
+    SMOL_NO_FLAGS                  = 0,
+
+    /* Filter in linear light instead of directly on sRGB values. Averaging
+     * sRGB values darkens fine detail, like thin bright lines on a dark
+     * background. This costs a table lookup per channel on the way in and
+     * out, and is ignored when both input and output have unassociated
+     * alpha (RGB8 output counts as unassociated here). */
+    SMOL_ENABLE_SRGB_LINEARIZATION = (1 << 0)
+}
+SmolFlags;
+
 typedef struct SmolScaleCtx SmolScaleCtx;
 
 /* Simple API: Scales an entire image in one shot. You must provide pointers to
@@ -62,6 +104,32 @@ SmolScaleCtx *smol_scale_new_full (SmolPixelType pixel_type_in, const void *pixe
                                    uint32_t width_out, uint32_t height_out, uint32_t rowstride_out,
                                    SmolPostRowFunc post_row_func, void *user_data);
 
+SmolScaleCtx *smol_scale_new_flags (SmolPixelType pixel_type_in, const void *pixels_in,
+                                    uint32_t width_in, uint32_t height_in, uint32_t rowstride_in,
+                                    SmolPixelType pixel_type_out, void *pixels_out,
+                                    uint32_t width_out, uint32_t height_out, uint32_t rowstride_out,
+                                    SmolPostRowFunc post_row_func, void *user_data,
+                                    SmolFlags flags);
+
+/* Pull API: Instead of reading the input from memory, the scaler asks for
+ * input rows as it needs them. Each row is requested exactly once, in order
+ * from the top, and only the rows within reach of the vertical filter are
+ * kept. That means the input never has to exist in full, and memory use is
+ * bounded by the filter window.
+ *
+ * The flip side is that output rows must be produced in order too: Call
+ * smol_scale_batch() or smol_scale_batch_full() from a single thread, with
+ * each batch starting where the previous one ended. Planar input types are
+ * not supported. */
+
+SmolScaleCtx *smol_scale_new_pull (SmolPixelType pixel_type_in,
+                                   SmolFetchRowFunc *fetch_row_func, void *fetch_user_data,
+                                   uint32_t width_in, uint32_t height_in,
+                                   SmolPixelType pixel_type_out, void *pixels_out,
+                                   uint32_t width_out, uint32_t height_out, uint32_t rowstride_out,
+                                   SmolPostRowFunc post_row_func, void *user_data,
+                                   SmolFlags flags);
+
 void smol_scale_destroy (SmolScaleCtx *scale_ctx);
 
 /* It's ok to call smol_scale_batch() without locking from multiple concurrent
@@ -78,6 +146,21 @@ void smol_scale_batch_full (const SmolScaleCtx *scale_ctx,
                             void *outrows_dest,
                             uint32_t first_outrow, uint32_t n_outrows);
 
+/* Like smol_scale_batch_full(), but keeps horizontally scaled input rows in
+ * state between calls. When a thread scales consecutive batches with the
+ * same state, the input rows shared at their seams are only scaled once.
+ * A state must not be used by more than one thread at a time. */
+
+typedef struct SmolScaleState SmolScaleState;
+
+SmolScaleState *smol_scale_state_new (const SmolScaleCtx *scale_ctx);
+void smol_scale_state_destroy (SmolScaleState *state);
+
+void smol_scale_batch_with_state (const SmolScaleCtx *scale_ctx,
+                                  SmolScaleState *state,
+                                  void *outrows_dest,
+                                  uint32_t first_outrow, uint32_t n_outrows);
+
 #ifdef __cplusplus
 }
 #endif
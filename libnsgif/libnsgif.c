@@ -107,6 +107,7 @@ gif_initialise_sprite(gif_animation *gif,
 
         /* Invalidate our currently decoded image */
         gif->decoded_frame = GIF_INVALID_FRAME;
+        gif->restore_frame = GIF_INVALID_FRAME;
         return GIF_OK;
 }
 
@@ -319,6 +320,9 @@ static gif_result gif_initialise_frame(gif_animation *gif)
         if (gif->decoded_frame == frame) {
                 gif->decoded_frame = GIF_INVALID_FRAME;
         }
+        if (gif->restore_frame == frame) {
+                gif->restore_frame = GIF_INVALID_FRAME;
+        }
 
         /* We pretend to initialise the frames, but really we just skip over
          * all the data contained within. This is all basically a cut down
@@ -597,6 +601,9 @@ gif_internal_decode_frame(gif_animation *gif,
         unsigned int return_value = 0;
         unsigned int x, y, decode_y, burst_bytes;
         register unsigned char colour;
+        bool drawn = false;
+        bool transparency;
+        unsigned char transparency_index;
 
         /* If the GIF has no frame data, frame holders will not be allocated in
          * gif_initialise() */
@@ -813,6 +820,14 @@ gif_internal_decode_frame(gif_animation *gif,
                                 memset((char*)frame_data,
                                        GIF_TRANSPARENT_COLOUR,
                                        gif->width * gif->height * sizeof(int));
+                        } else if (last_undisposed_frame == gif->restore_frame) {
+                                /* We kept a copy when it was last decoded;
+                                 * no need to replay the frames leading up
+                                 * to it.
+                                 */
+                                memcpy(frame_data,
+                                       gif->restore_image,
+                                       gif->width * gif->height * sizeof(int));
                         } else {
                                 return_value = gif_internal_decode_frame(gif, last_undisposed_frame, false);
                                 if (return_value != GIF_OK) {
@@ -828,6 +843,7 @@ gif_internal_decode_frame(gif_animation *gif,
                 }
                 gif->decoded_frame = frame;
                 gif->buffer_position = (gif_data - gif->gif_data) + 1;
+                drawn = true;
 
                 /* Initialise the LZW decoding */
                 res = lzw_decode_init(gif->lzw_ctx, gif->gif_data,
@@ -837,6 +853,10 @@ gif_internal_decode_frame(gif_animation *gif,
                         return gif_error_from_lzw(res);
                 }
 
+                /* Look these up once rather than for every pixel */
+                transparency = gif->frames[frame].transparency;
+                transparency_index = gif->frames[frame].transparency_index;
+
                 /* Decompress the data */
                 for (y = 0; y < height; y++) {
                         if (interlace) {
@@ -858,14 +878,18 @@ gif_internal_decode_frame(gif_animation *gif,
                                                 burst_bytes = x;
                                         }
                                         x -= burst_bytes;
-                                        while (burst_bytes-- > 0) {
-                                                colour = *--stack_pos;
-                                                if (((gif->frames[frame].transparency) &&
-                                                     (colour != gif->frames[frame].transparency_index)) ||
-                                                    (!gif->frames[frame].transparency)) {
-                                                        *frame_scanline = colour_table[colour];
+                                        if (transparency) {
+                                                while (burst_bytes-- > 0) {
+                                                        colour = *--stack_pos;
+                                                        if (colour != transparency_index) {
+                                                                *frame_scanline = colour_table[colour];
+                                                        }
+                                                        frame_scanline++;
+                                                }
+                                        } else {
+                                                while (burst_bytes-- > 0) {
+                                                        *frame_scanline++ = colour_table[*--stack_pos];
                                                 }
-                                                frame_scanline++;
                                         }
                                 } else {
                                         res = lzw_decode(gif->lzw_ctx, &stack_pos);
@@ -900,6 +924,37 @@ gif_internal_decode_frame(gif_animation *gif,
         }
 gif_decode_frame_exit:
 
+        /* If the following frame is to be disposed of by restoring the
+         * previous image, keep a copy of this one so later frames can go
+         * back to it without decoding the whole chain again.
+         */
+        if (drawn &&
+            (return_value == GIF_OK) &&
+            (gif->frames[frame].disposal_method != GIF_FRAME_RESTORE) &&
+            (frame + 1 < gif->frame_count_partial) &&
+            (gif->frames[frame + 1].disposal_method == GIF_FRAME_RESTORE)) {
+                unsigned int size = gif->width * gif->height;
+
+                if (gif->restore_image_size != size) {
+                        unsigned int *restore_image;
+
+                        restore_image = realloc(gif->restore_image,
+                                                size * sizeof(int));
+                        if (restore_image) {
+                                gif->restore_image = restore_image;
+                                gif->restore_image_size = size;
+                        }
+                }
+
+                if (gif->restore_image_size == size) {
+                        memcpy(gif->restore_image, frame_data,
+                               size * sizeof(int));
+                        gif->restore_frame = frame;
+                } else {
+                        gif->restore_frame = GIF_INVALID_FRAME;
+                }
+        }
+
         /* Check if we should test for optimisation */
         if (gif->frames[frame].virgin) {
                 if (gif->bitmap_callbacks.bitmap_test_opaque) {
@@ -931,6 +986,7 @@ void gif_create(gif_animation *gif, gif_bitmap_callback_vt *bitmap_callbacks)
         memset(gif, 0, sizeof(gif_animation));
         gif->bitmap_callbacks = *bitmap_callbacks;
         gif->decoded_frame = GIF_INVALID_FRAME;
+        gif->restore_frame = GIF_INVALID_FRAME;
 }
 
 
@@ -972,11 +1028,14 @@ gif_result gif_initialise(gif_animation *gif, size_t size, unsigned char *data)
                 gif->frames = NULL;
                 gif->local_colour_table = NULL;
                 gif->global_colour_table = NULL;
+                gif->restore_image = NULL;
 
                 /* The caller may have been lazy and not reset any values */
                 gif->frame_count = 0;
                 gif->frame_count_partial = 0;
                 gif->decoded_frame = GIF_INVALID_FRAME;
+                gif->restore_image_size = 0;
+                gif->restore_frame = GIF_INVALID_FRAME;
 
                 /* 6-byte GIF file header is:
                  *
@@ -1174,6 +1233,10 @@ void gif_finalise(gif_animation *gif)
         gif->local_colour_table = NULL;
         free(gif->global_colour_table);
         gif->global_colour_table = NULL;
+        free(gif->restore_image);
+        gif->restore_image = NULL;
+        gif->restore_image_size = 0;
+        gif->restore_frame = GIF_INVALID_FRAME;
 
         lzw_context_destroy(gif->lzw_ctx);
         gif->lzw_ctx = NULL;
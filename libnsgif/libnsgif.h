@@ -136,6 +136,12 @@ typedef struct gif_animation {
         unsigned int *global_colour_table;
         /** local colour table */
         unsigned int *local_colour_table;
+        /** snapshot of the image to return to for restore-disposal frames */
+        unsigned int *restore_image;
+        /** size of restore_image, in pixels */
+        unsigned int restore_image_size;
+        /** frame whose decoded image is held in restore_image, or -1 */
+        int restore_frame;
 } gif_animation;
 
 /**
@@ -0,0 +1,602 @@
+/* Micro-benchmarks for the hot paths in libchafa.
+ *
+ * Build with "make -C tests bench". Each benchmark runs on a fixed synthetic
+ * image at several canvas sizes and prints one tab-separated line per
+ * measurement, so results can be compared across builds and machines.
+ * Benchmarks whose speed depends on the instruction set are repeated for
+ * each supported code path. */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chafa.h>
+#include "internal/chafa-private.h"
+#include "internal/chafa-canvas-internal.h"
+#include "internal/chafa-kitty-canvas.h"
+#include "internal/chafa-palette.h"
+#include "internal/chafa-pixops.h"
+#include "internal/chafa-sixel-canvas.h"
+#include "internal/chafa-string-util.h"
+#include "internal/chafa-work-cell.h"
+#include "internal/smolscale/smolscale.h"
+
+#define SRC_WIDTH 1024
+#define SRC_HEIGHT 768
+
+typedef struct
+{
+    const gchar *name;
+    ChafaFeatures features;
+}
+IsaLevel;
+
+static const IsaLevel isa_levels [] =
+{
+    { "c", 0 },
+    { "sse41", CHAFA_FEATURE_MMX | CHAFA_FEATURE_SSE41 | CHAFA_FEATURE_POPCNT },
+    { "avx2", CHAFA_FEATURE_MMX | CHAFA_FEATURE_SSE41 | CHAFA_FEATURE_POPCNT
+      | CHAFA_FEATURE_AVX2 },
+    { "avx512", CHAFA_FEATURE_MMX | CHAFA_FEATURE_SSE41 | CHAFA_FEATURE_POPCNT
+      | CHAFA_FEATURE_AVX2 | CHAFA_FEATURE_AVX512_VPOPCNTDQ },
+    { "neon", CHAFA_FEATURE_NEON }
+};
+
+static const struct
+{
+    gint width, height;
+}
+canvas_sizes [] =
+{
+    { 40, 12 },
+    { 80, 24 },
+    { 160, 48 }
+};
+
+typedef struct
+{
+    gint width, height;
+
+    /* Source image */
+    guint8 *src_pixels;
+
+    /* Symbol canvas, drawn once so its work buffers are valid */
+    ChafaCanvas *canvas;
+    ChafaTermInfo *term_info;
+
+    /* The same in 16/8 color mode, which scores symbols against the palettes */
+    ChafaCanvas *canvas_16_8;
+
+    /* And in FGBG mode, where symbols are picked by bitmap alone */
+    ChafaCanvas *canvas_fgbg;
+
+    ChafaCanvas *sixel_canvas;
+    ChafaCanvas *kitty_canvas;
+    ChafaTermInfo *kitty_term_info;
+
+    SmolScaleCtx *scale_ctx;
+    guint8 *scale_out;
+
+    /* Downscales to one pixel per cell, which go through the box filters */
+    SmolScaleCtx *cells_ctx;
+    SmolScaleCtx *cells_unassoc_ctx;
+    guint8 *cells_out;
+
+    guint64 *bitmaps;
+    gint n_bitmaps;
+
+    ChafaPalette fixed_palette;
+    ChafaPalette dynamic_palette;
+
+    /* Canvas pixels packed as B8G8R8 for color table lookups */
+    guint32 *packed_pixels;
+    gint *pens;
+
+    GString *gs;
+}
+Fixture;
+
+typedef void (*BenchFunc) (Fixture *fix);
+
+typedef struct
+{
+    const gchar *name;
+    BenchFunc func;
+    gboolean isa_dependent;
+}
+Bench;
+
+static gdouble min_time_s = 0.25;
+static const gchar *filter;
+
+/* --- Synthetic input --- */
+
+static guint32
+xorshift32 (guint32 *state)
+{
+    guint32 x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+/* Gradients for flat areas, rings for edges and a band of noise for
+ * high-detail cells, all with full alpha except for a transparent corner. */
+static guint8 *
+generate_image (void)
+{
+    guint8 *pixels = g_malloc (SRC_WIDTH * SRC_HEIGHT * 4);
+    guint32 state = 0x12345678;
+    gint x, y;
+
+    for (y = 0; y < SRC_HEIGHT; y++)
+    {
+        for (x = 0; x < SRC_WIDTH; x++)
+        {
+            guint8 *p = pixels + (y * SRC_WIDTH + x) * 4;
+            gint dx = x - SRC_WIDTH / 2, dy = y - SRC_HEIGHT / 2;
+            gint ring = ((dx * dx + dy * dy) / 1500) & 1;
+
+            p [0] = (x * 255) / SRC_WIDTH;
+            p [1] = (y * 255) / SRC_HEIGHT;
+            p [2] = ring ? 230 : 40;
+            p [3] = 255;
+
+            if (y > SRC_HEIGHT / 3 && y < SRC_HEIGHT / 2)
+            {
+                guint32 r = xorshift32 (&state);
+
+                p [0] = r;
+                p [1] = r >> 8;
+                p [2] = r >> 16;
+            }
+
+            if (x < SRC_WIDTH / 8 && y < SRC_HEIGHT / 8)
+                p [3] = 0;
+        }
+    }
+
+    return pixels;
+}
+
+static ChafaCanvas *
+new_canvas (gint width, gint height, ChafaPixelMode pixel_mode, ChafaCanvasMode canvas_mode,
+            const guint8 *src_pixels)
+{
+    ChafaCanvasConfig *config;
+    ChafaCanvas *canvas;
+
+    config = chafa_canvas_config_new ();
+    chafa_canvas_config_set_geometry (config, width, height);
+    chafa_canvas_config_set_pixel_mode (config, pixel_mode);
+    chafa_canvas_config_set_canvas_mode (config, canvas_mode);
+    canvas = chafa_canvas_new (config);
+    chafa_canvas_config_unref (config);
+
+    chafa_canvas_draw_all_pixels (canvas, CHAFA_PIXEL_RGBA8_UNASSOCIATED,
+                                  src_pixels, SRC_WIDTH, SRC_HEIGHT, SRC_WIDTH * 4);
+    return canvas;
+}
+
+static ChafaTermInfo *
+detect_term_info (const gchar *term)
+{
+    gchar *envp [2] = { NULL, NULL };
+    ChafaTermInfo *term_info;
+
+    envp [0] = g_strdup_printf ("TERM=%s", term);
+    term_info = chafa_term_db_detect (chafa_term_db_get_default (), envp);
+    g_free (envp [0]);
+    return term_info;
+}
+
+static void
+fixture_init (Fixture *fix, guint8 *src_pixels, gint width, gint height)
+{
+    ChafaCanvas *canvas;
+    ChafaWorkCell wcell;
+    gint cx, cy, i;
+
+    memset (fix, 0, sizeof (*fix));
+    fix->width = width;
+    fix->height = height;
+    fix->src_pixels = src_pixels;
+    fix->gs = g_string_new ("");
+
+    fix->canvas = canvas = new_canvas (width, height, CHAFA_PIXEL_MODE_SYMBOLS,
+                                       CHAFA_CANVAS_MODE_TRUECOLOR, src_pixels);
+    fix->term_info = detect_term_info ("xterm-256color");
+    fix->canvas_16_8 = new_canvas (width, height, CHAFA_PIXEL_MODE_SYMBOLS,
+                                   CHAFA_CANVAS_MODE_INDEXED_16_8, src_pixels);
+    fix->canvas_fgbg = new_canvas (width, height, CHAFA_PIXEL_MODE_SYMBOLS,
+                                   CHAFA_CANVAS_MODE_FGBG, src_pixels);
+
+    fix->sixel_canvas = new_canvas (width, height, CHAFA_PIXEL_MODE_SIXELS,
+                                    CHAFA_CANVAS_MODE_INDEXED_256, src_pixels);
+    fix->kitty_canvas = new_canvas (width, height, CHAFA_PIXEL_MODE_KITTY,
+                                    CHAFA_CANVAS_MODE_TRUECOLOR, src_pixels);
+    fix->kitty_term_info = detect_term_info ("xterm-kitty");
+
+    fix->scale_out = g_malloc (canvas->width_pixels * canvas->height_pixels * 4);
+    fix->scale_ctx = smol_scale_new_full (SMOL_PIXEL_RGBA8_UNASSOCIATED, src_pixels,
+                                          SRC_WIDTH, SRC_HEIGHT, SRC_WIDTH * 4,
+                                          SMOL_PIXEL_RGBA8_PREMULTIPLIED, fix->scale_out,
+                                          canvas->width_pixels, canvas->height_pixels,
+                                          canvas->width_pixels * 4,
+                                          NULL, NULL);
+
+    fix->cells_out = g_malloc (width * height * 4);
+    fix->cells_ctx = smol_scale_new_full (SMOL_PIXEL_RGBA8_PREMULTIPLIED, src_pixels,
+                                          SRC_WIDTH, SRC_HEIGHT, SRC_WIDTH * 4,
+                                          SMOL_PIXEL_RGBA8_PREMULTIPLIED, fix->cells_out,
+                                          width, height, width * 4,
+                                          NULL, NULL);
+    fix->cells_unassoc_ctx = smol_scale_new_full (SMOL_PIXEL_RGBA8_UNASSOCIATED, src_pixels,
+                                                  SRC_WIDTH, SRC_HEIGHT, SRC_WIDTH * 4,
+                                                  SMOL_PIXEL_RGBA8_PREMULTIPLIED, fix->cells_out,
+                                                  width, height, width * 4,
+                                                  NULL, NULL);
+
+    /* One bitmap per cell, as the symbol search would see them */
+    fix->n_bitmaps = width * height;
+    fix->bitmaps = g_new (guint64, fix->n_bitmaps);
+
+    for (cy = 0; cy < height; cy++)
+    {
+        for (cx = 0; cx < width; cx++)
+        {
+            ChafaColorPair color_pair;
+
+            chafa_work_cell_init (&wcell, canvas->pixels, canvas->width_pixels, cx, cy);
+            chafa_work_cell_get_contrasting_color_pair (&wcell, &color_pair);
+            fix->bitmaps [cy * width + cx] = chafa_work_cell_to_bitmap (&wcell, &color_pair);
+        }
+    }
+
+    chafa_palette_init (&fix->fixed_palette, CHAFA_PALETTE_TYPE_FIXED_256);
+    chafa_palette_init (&fix->dynamic_palette, CHAFA_PALETTE_TYPE_DYNAMIC_256);
+    chafa_palette_generate (&fix->dynamic_palette, canvas->pixels,
+                            canvas->width_pixels * canvas->height_pixels,
+                            CHAFA_COLOR_SPACE_RGB);
+
+    fix->packed_pixels = g_new (guint32, canvas->width_pixels * canvas->height_pixels);
+    fix->pens = g_new (gint, canvas->width_pixels * canvas->height_pixels);
+
+    for (i = 0; i < canvas->width_pixels * canvas->height_pixels; i++)
+    {
+        const ChafaColor *col = &canvas->pixels [i].col;
+
+        fix->packed_pixels [i] = col->ch [0] | (col->ch [1] << 8) | (col->ch [2] << 16);
+    }
+}
+
+static void
+fixture_deinit (Fixture *fix)
+{
+    smol_scale_destroy (fix->scale_ctx);
+    g_free (fix->scale_out);
+    smol_scale_destroy (fix->cells_ctx);
+    smol_scale_destroy (fix->cells_unassoc_ctx);
+    g_free (fix->cells_out);
+    g_free (fix->bitmaps);
+    g_free (fix->packed_pixels);
+    g_free (fix->pens);
+    chafa_palette_deinit (&fix->fixed_palette);
+    chafa_palette_deinit (&fix->dynamic_palette);
+    chafa_canvas_unref (fix->canvas);
+    chafa_canvas_unref (fix->canvas_16_8);
+    chafa_canvas_unref (fix->canvas_fgbg);
+    chafa_canvas_unref (fix->sixel_canvas);
+    chafa_canvas_unref (fix->kitty_canvas);
+    chafa_term_info_unref (fix->term_info);
+    chafa_term_info_unref (fix->kitty_term_info);
+    g_string_free (fix->gs, TRUE);
+}
+
+/* --- Benchmarks --- */
+
+static void
+bench_scale (Fixture *fix)
+{
+    smol_scale_batch_full (fix->scale_ctx, fix->scale_out,
+                           0, fix->canvas->height_pixels);
+}
+
+static void
+bench_scale_cells (Fixture *fix)
+{
+    smol_scale_batch_full (fix->cells_ctx, fix->cells_out, 0, fix->height);
+}
+
+static void
+bench_scale_cells_unassociated (Fixture *fix)
+{
+    smol_scale_batch_full (fix->cells_unassoc_ctx, fix->cells_out, 0, fix->height);
+}
+
+static void
+bench_prepare (Fixture *fix)
+{
+    ChafaCanvas *canvas = fix->canvas;
+
+    chafa_prepare_pixel_data_for_symbols (&canvas->fg_palette, &canvas->dither,
+                                          canvas->config.color_space,
+                                          canvas->config.preprocessing_enabled,
+                                          canvas->work_factor_int,
+                                          CHAFA_PIXEL_RGBA8_UNASSOCIATED,
+                                          fix->src_pixels,
+                                          SRC_WIDTH, SRC_HEIGHT, SRC_WIDTH * 4,
+                                          canvas->pixels,
+                                          canvas->width_pixels, canvas->height_pixels,
+                                          NULL, NULL);
+}
+
+static void
+bench_update_cells (Fixture *fix)
+{
+    /* Force every row to be recomputed */
+    fix->canvas->have_cell_hashes = FALSE;
+    chafa_canvas_update_cells (fix->canvas);
+}
+
+static void
+bench_update_cells_16_8 (Fixture *fix)
+{
+    fix->canvas_16_8->have_cell_hashes = FALSE;
+    chafa_canvas_update_cells (fix->canvas_16_8);
+}
+
+static void
+bench_update_cells_fgbg (Fixture *fix)
+{
+    fix->canvas_fgbg->have_cell_hashes = FALSE;
+    chafa_canvas_update_cells (fix->canvas_fgbg);
+}
+
+static void
+bench_median_colors (Fixture *fix)
+{
+    ChafaCanvas *canvas = fix->canvas;
+    const ChafaSymbolMap *symbol_map = &canvas->config.symbol_map;
+    ChafaWorkCell wcell;
+    gint cx, cy, i = 0;
+
+    /* Cycle through the symbols so the sorts see varied coverage */
+    for (cy = 0; cy < fix->height; cy++)
+    {
+        for (cx = 0; cx < fix->width; cx++)
+        {
+            ChafaColorPair color_pair;
+
+            chafa_work_cell_init (&wcell, canvas->pixels, canvas->width_pixels, cx, cy);
+            chafa_work_cell_get_median_colors_for_symbol (&wcell, &symbol_map->symbols [i],
+                                                          &color_pair);
+            if (++i == symbol_map->n_symbols)
+                i = 0;
+        }
+    }
+}
+
+static void
+bench_find_candidates (Fixture *fix)
+{
+    ChafaCandidate candidates [8];
+    gint n_candidates;
+    gint i;
+
+    for (i = 0; i < fix->n_bitmaps; i++)
+    {
+        n_candidates = CLAMP (fix->canvas->work_factor_int, 1, 8);
+        chafa_symbol_map_find_candidates (&fix->canvas->config.symbol_map,
+                                          fix->bitmaps [i], FALSE,
+                                          candidates, &n_candidates);
+    }
+}
+
+static void
+lookup_all (Fixture *fix, const ChafaPalette *palette)
+{
+    ChafaCanvas *canvas = fix->canvas;
+    gint n_pixels = canvas->width_pixels * canvas->height_pixels;
+    ChafaColorCandidates ccand;
+    gint i;
+
+    for (i = 0; i < n_pixels; i++)
+        chafa_palette_lookup_nearest (palette, CHAFA_COLOR_SPACE_RGB,
+                                      &canvas->pixels [i].col, &ccand);
+}
+
+static void
+bench_palette_fixed (Fixture *fix)
+{
+    lookup_all (fix, &fix->fixed_palette);
+}
+
+static void
+bench_palette_dynamic (Fixture *fix)
+{
+    lookup_all (fix, &fix->dynamic_palette);
+}
+
+static void
+bench_color_table_rows (Fixture *fix)
+{
+    ChafaCanvas *canvas = fix->canvas;
+    gint y;
+
+    for (y = 0; y < canvas->height_pixels; y++)
+    {
+        gint ofs = y * canvas->width_pixels;
+
+        chafa_color_table_find_nearest_pens (&fix->dynamic_palette.table [CHAFA_COLOR_SPACE_RGB],
+                                             fix->packed_pixels + ofs, fix->pens + ofs,
+                                             canvas->width_pixels);
+    }
+}
+
+static void
+bench_sixel_build_ansi (Fixture *fix)
+{
+    ChafaStringSink sink = { fix->gs, NULL, NULL, FALSE };
+
+    g_string_truncate (fix->gs, 0);
+    chafa_sixel_canvas_build_ansi (fix->sixel_canvas->pixel_canvas, &sink, FALSE);
+}
+
+static void
+bench_kitty_build_ansi (Fixture *fix)
+{
+    ChafaStringSink sink = { fix->gs, NULL, NULL, FALSE };
+
+    g_string_truncate (fix->gs, 0);
+    chafa_kitty_canvas_build_ansi (fix->kitty_canvas->pixel_canvas, fix->kitty_term_info,
+                                   &sink, fix->width, fix->height, 0);
+}
+
+static void
+bench_kitty_build_ansi_zlib (Fixture *fix)
+{
+    ChafaStringSink sink = { fix->gs, NULL, NULL, FALSE };
+
+    g_string_truncate (fix->gs, 0);
+    chafa_kitty_canvas_set_compression_level (fix->kitty_canvas->pixel_canvas, 1);
+    chafa_kitty_canvas_build_ansi (fix->kitty_canvas->pixel_canvas, fix->kitty_term_info,
+                                   &sink, fix->width, fix->height, 0);
+    chafa_kitty_canvas_set_compression_level (fix->kitty_canvas->pixel_canvas, 0);
+}
+
+static void
+bench_print_symbols (Fixture *fix)
+{
+    g_string_free (chafa_canvas_print (fix->canvas, fix->term_info), TRUE);
+}
+
+static const Bench benches [] =
+{
+    { "smol_scale_batch_full", bench_scale, FALSE },
+    { "smol_scale_cells", bench_scale_cells, FALSE },
+    { "smol_scale_cells_unassociated", bench_scale_cells_unassociated, FALSE },
+    { "prepare_pixel_data_for_symbols", bench_prepare, FALSE },
+    { "update_cells", bench_update_cells, TRUE },
+    { "update_cells_16_8", bench_update_cells_16_8, TRUE },
+    { "update_cells_fgbg", bench_update_cells_fgbg, TRUE },
+    { "work_cell_get_median_colors", bench_median_colors, FALSE },
+    { "symbol_map_find_candidates", bench_find_candidates, TRUE },
+    { "palette_lookup_nearest_fixed_256", bench_palette_fixed, FALSE },
+    { "palette_lookup_nearest_dynamic_256", bench_palette_dynamic, FALSE },
+    { "color_table_find_nearest_pens", bench_color_table_rows, FALSE },
+    { "sixel_canvas_build_ansi", bench_sixel_build_ansi, FALSE },
+    { "kitty_canvas_build_ansi", bench_kitty_build_ansi, TRUE },
+    { "kitty_canvas_build_ansi_zlib", bench_kitty_build_ansi_zlib, FALSE },
+    { "canvas_print_symbols", bench_print_symbols, FALSE }
+};
+
+/* --- Driver --- */
+
+static void
+run_bench (const Bench *bench, const gchar *isa, Fixture *fix)
+{
+    gint64 start, elapsed;
+    gint n_iter = 0;
+
+    /* Warm up caches and lazily allocated buffers */
+    bench->func (fix);
+
+    start = g_get_monotonic_time ();
+
+    do
+    {
+        bench->func (fix);
+        n_iter++;
+        elapsed = g_get_monotonic_time () - start;
+    }
+    while (elapsed < (gint64) (min_time_s * 1000000.0));
+
+    g_print ("%s\t%s\t%dx%d\t%d\t%.3f\n",
+             bench->name, isa, fix->width, fix->height,
+             n_iter, (gdouble) elapsed / n_iter);
+}
+
+static void
+usage (const gchar *argv0)
+{
+    fprintf (stderr,
+             "Usage: %s [-t SECONDS] [-j THREADS] [FILTER]\n\n"
+             "  -t SECONDS  Minimum time per measurement [0.25].\n"
+             "  -j THREADS  Number of worker threads [1].\n"
+             "  FILTER      Only run benchmarks whose name contains FILTER.\n",
+             argv0);
+}
+
+int
+main (int argc, char *argv [])
+{
+    ChafaFeatures supported;
+    guint8 *src_pixels;
+    gint n_threads = 1;
+    gint i, j, k;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp (argv [i], "-t") && i + 1 < argc)
+            min_time_s = strtod (argv [++i], NULL);
+        else if (!strcmp (argv [i], "-j") && i + 1 < argc)
+            n_threads = atoi (argv [++i]);
+        else if (argv [i] [0] == '-')
+        {
+            usage (argv [0]);
+            return 2;
+        }
+        else
+            filter = argv [i];
+    }
+
+    chafa_set_n_threads (n_threads);
+    supported = chafa_get_supported_features ();
+    src_pixels = generate_image ();
+
+    g_print ("benchmark\tisa\tsize\titerations\tusec_per_iter\n");
+
+    for (i = 0; i < (gint) G_N_ELEMENTS (canvas_sizes); i++)
+    {
+        Fixture fix;
+
+        fixture_init (&fix, src_pixels, canvas_sizes [i].width, canvas_sizes [i].height);
+
+        for (j = 0; j < (gint) G_N_ELEMENTS (benches); j++)
+        {
+            const Bench *bench = &benches [j];
+
+            if (filter && !strstr (bench->name, filter))
+                continue;
+
+            if (!bench->isa_dependent)
+            {
+                /* No ISA-specific paths here that we control; smolscale
+                 * does its own runtime detection */
+                run_bench (bench, "native", &fix);
+                continue;
+            }
+
+            for (k = 0; k < (gint) G_N_ELEMENTS (isa_levels); k++)
+            {
+                if ((isa_levels [k].features & supported) != isa_levels [k].features)
+                    continue;
+
+                chafa_set_feature_mask (isa_levels [k].features);
+                run_bench (bench, isa_levels [k].name, &fix);
+            }
+
+            chafa_set_feature_mask (supported);
+        }
+
+        fixture_deinit (&fix);
+    }
+
+    g_free (src_pixels);
+    return 0;
+}
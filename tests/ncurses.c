@@ -128,24 +128,38 @@ canvas_to_ncurses (ChafaCanvas *canvas)
 {
     ChafaCanvasMode mode = detect_canvas_mode ();
     int pair = 256;  /* Reserve lower pairs for application in direct-color mode */
+    int height = screen_height - 1;
+    gunichar *chars;
+    gint *fgs, *bgs;
     int x, y;
 
-    for (y = 0; y < screen_height - 1; y++)
+    /* Fetch the whole canvas in one go instead of cell by cell */
+    chars = g_new (gunichar, screen_width * height);
+    fgs = g_new (gint, screen_width * height);
+    bgs = g_new (gint, screen_width * height);
+
+    if (mode == CHAFA_CANVAS_MODE_TRUECOLOR)
+        chafa_canvas_get_cells (canvas, 0, 0, screen_width, height,
+                                chars, fgs, bgs, screen_width);
+    else
+        chafa_canvas_get_raw_cells (canvas, 0, 0, screen_width, height,
+                                    chars, fgs, bgs, screen_width);
+
+    for (y = 0; y < height; y++)
     {
         for (x = 0; x < screen_width; x++)
         {
+            gint i = y * screen_width + x;
             wchar_t wc [2];
             cchar_t cch;
-            int fg, bg;
 
             /* wchar_t is 32-bit in glibc, but this may not work on e.g. Windows */
-            wc [0] = chafa_canvas_get_char_at (canvas, x, y);
+            wc [0] = chars [i];
             wc [1] = 0;
 
             if (mode == CHAFA_CANVAS_MODE_TRUECOLOR)
             {
-                chafa_canvas_get_colors_at (canvas, x, y, &fg, &bg);
-                init_extended_pair (pair, fg, bg);
+                init_extended_pair (pair, fgs [i], bgs [i]);
             }
             else if (mode == CHAFA_CANVAS_MODE_FGBG)
             {
@@ -155,8 +169,7 @@ canvas_to_ncurses (ChafaCanvas *canvas)
             {
                 /* In indexed color mode, we've probably got enough pairs
                  * to just let ncurses allocate and reuse as needed. */
-                chafa_canvas_get_raw_colors_at (canvas, x, y, &fg, &bg);
-                pair = alloc_pair (fg, bg);
+                pair = alloc_pair (fgs [i], bgs [i]);
             }
 
             setcchar (&cch, wc, A_NORMAL, -1, &pair);
@@ -164,6 +177,10 @@ canvas_to_ncurses (ChafaCanvas *canvas)
             pair++;
         }
     }
+
+    g_free (chars);
+    g_free (fgs);
+    g_free (bgs);
 }
 
 static void
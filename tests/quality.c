@@ -0,0 +1,489 @@
+/* Quality-vs-speed measurements for symbol output.
+ *
+ * Build with "make -C tests quality". Each image is converted with a range
+ * of work factors and color extractors, once for each supported code path.
+ * The time per conversion is printed together with the PSNR and SSIM of the
+ * rasterized canvas against the source as scaled to the same size, so the
+ * cost of a speed optimization can be measured as well as its gain.
+ *
+ * Images are given as binary PPM (P6) files. Without any, a synthetic
+ * image is used. */
+
+#include "config.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chafa.h>
+#include "internal/chafa-private.h"
+#include "internal/chafa-canvas-internal.h"
+#include "internal/chafa-cell-cache.h"
+#include "internal/smolscale/smolscale.h"
+
+#define SYNTH_WIDTH 1024
+#define SYNTH_HEIGHT 768
+
+/* SSIM window, in pixels */
+#define SSIM_WINDOW 8
+#define SSIM_STEP 4
+
+typedef struct
+{
+    const gchar *name;
+    ChafaFeatures features;
+}
+IsaLevel;
+
+static const IsaLevel isa_levels [] =
+{
+    { "c", 0 },
+    { "sse41", CHAFA_FEATURE_MMX | CHAFA_FEATURE_SSE41 | CHAFA_FEATURE_POPCNT },
+    { "avx2", CHAFA_FEATURE_MMX | CHAFA_FEATURE_SSE41 | CHAFA_FEATURE_POPCNT
+      | CHAFA_FEATURE_AVX2 },
+    { "avx512", CHAFA_FEATURE_MMX | CHAFA_FEATURE_SSE41 | CHAFA_FEATURE_POPCNT
+      | CHAFA_FEATURE_AVX2 | CHAFA_FEATURE_AVX512_VPOPCNTDQ },
+    { "neon", CHAFA_FEATURE_NEON }
+};
+
+static const gfloat work_factors [] =
+{
+    0.0f, 0.25f, 0.5f, 0.75f, 1.0f
+};
+
+static const struct
+{
+    const gchar *name;
+    ChafaColorExtractor extractor;
+}
+extractors [] =
+{
+    { "average", CHAFA_COLOR_EXTRACTOR_AVERAGE },
+    { "median", CHAFA_COLOR_EXTRACTOR_MEDIAN }
+};
+
+typedef struct
+{
+    gchar *name;
+    gint width, height;
+    guint8 *pixels;
+}
+Image;
+
+static gdouble min_time_s = 0.25;
+static gint canvas_width = 80, canvas_height = 24;
+
+/* --- Input --- */
+
+static guint32
+xorshift32 (guint32 *state)
+{
+    guint32 x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+/* Same pattern as the benchmarks: gradients, rings and a band of noise */
+static void
+generate_image (Image *image)
+{
+    guint32 state = 0x12345678;
+    gint x, y;
+
+    image->name = g_strdup ("synthetic");
+    image->width = SYNTH_WIDTH;
+    image->height = SYNTH_HEIGHT;
+    image->pixels = g_malloc (SYNTH_WIDTH * SYNTH_HEIGHT * 4);
+
+    for (y = 0; y < SYNTH_HEIGHT; y++)
+    {
+        for (x = 0; x < SYNTH_WIDTH; x++)
+        {
+            guint8 *p = image->pixels + (y * SYNTH_WIDTH + x) * 4;
+            gint dx = x - SYNTH_WIDTH / 2, dy = y - SYNTH_HEIGHT / 2;
+            gint ring = ((dx * dx + dy * dy) / 1500) & 1;
+
+            p [0] = (x * 255) / SYNTH_WIDTH;
+            p [1] = (y * 255) / SYNTH_HEIGHT;
+            p [2] = ring ? 230 : 40;
+            p [3] = 255;
+
+            if (y > SYNTH_HEIGHT / 3 && y < SYNTH_HEIGHT / 2)
+            {
+                guint32 r = xorshift32 (&state);
+
+                p [0] = r;
+                p [1] = r >> 8;
+                p [2] = r >> 16;
+            }
+        }
+    }
+}
+
+static gboolean
+read_ppm_field (const guint8 **p, const guint8 *end, gint *value_out)
+{
+    gint value = 0, n_digits = 0;
+
+    for (;;)
+    {
+        while (*p < end && g_ascii_isspace (**p))
+            (*p)++;
+        if (*p < end && **p == '#')
+        {
+            while (*p < end && **p != '\n')
+                (*p)++;
+            continue;
+        }
+        break;
+    }
+
+    while (*p < end && g_ascii_isdigit (**p) && n_digits < 6)
+    {
+        value = value * 10 + (**p - '0');
+        (*p)++;
+        n_digits++;
+    }
+
+    *value_out = value;
+    return n_digits > 0;
+}
+
+static gboolean
+load_ppm (Image *image, const gchar *path)
+{
+    gchar *contents;
+    gsize len;
+    const guint8 *p, *end;
+    gint width, height, maxval, i;
+    GError *error = NULL;
+
+    if (!g_file_get_contents (path, &contents, &len, &error))
+    {
+        fprintf (stderr, "%s\n", error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    p = (const guint8 *) contents;
+    end = p + len;
+
+    if (len < 2 || p [0] != 'P' || p [1] != '6')
+        goto bad;
+    p += 2;
+
+    if (!read_ppm_field (&p, end, &width)
+        || !read_ppm_field (&p, end, &height)
+        || !read_ppm_field (&p, end, &maxval)
+        || width < 1 || height < 1 || maxval != 255
+        || p >= end || (gsize) (end - p - 1) < (gsize) width * height * 3)
+        goto bad;
+
+    /* Single whitespace before the raster */
+    p++;
+
+    image->name = g_path_get_basename (path);
+    image->width = width;
+    image->height = height;
+    image->pixels = g_malloc ((gsize) width * height * 4);
+
+    for (i = 0; i < width * height; i++)
+    {
+        image->pixels [i * 4] = p [i * 3];
+        image->pixels [i * 4 + 1] = p [i * 3 + 1];
+        image->pixels [i * 4 + 2] = p [i * 3 + 2];
+        image->pixels [i * 4 + 3] = 0xff;
+    }
+
+    g_free (contents);
+    return TRUE;
+
+bad:
+    fprintf (stderr, "%s: Not an 8-bit binary PPM file.\n", path);
+    g_free (contents);
+    return FALSE;
+}
+
+/* --- Metrics --- */
+
+/* Both images are composited on black, since that's what the canvas
+ * background defaults to */
+static void
+to_luma_and_rgb (const guint8 *rgba, gint n_pixels, guint8 *rgb_out, gfloat *luma_out)
+{
+    gint i;
+
+    for (i = 0; i < n_pixels; i++)
+    {
+        const guint8 *p = rgba + i * 4;
+        gint a = p [3];
+        gint r = (p [0] * a + 127) / 255;
+        gint g = (p [1] * a + 127) / 255;
+        gint b = (p [2] * a + 127) / 255;
+
+        rgb_out [i * 3] = r;
+        rgb_out [i * 3 + 1] = g;
+        rgb_out [i * 3 + 2] = b;
+        luma_out [i] = 0.299f * r + 0.587f * g + 0.114f * b;
+    }
+}
+
+static gdouble
+calc_psnr (const guint8 *a, const guint8 *b, gint n_values)
+{
+    gdouble sum = 0.0;
+    gint i;
+
+    for (i = 0; i < n_values; i++)
+    {
+        gint d = (gint) a [i] - (gint) b [i];
+        sum += d * d;
+    }
+
+    if (sum == 0.0)
+        return INFINITY;
+
+    return 10.0 * log10 (255.0 * 255.0 / (sum / n_values));
+}
+
+/* Mean SSIM over overlapping square windows of luma */
+static gdouble
+calc_ssim (const gfloat *a, const gfloat *b, gint width, gint height)
+{
+    const gdouble c1 = (0.01 * 255) * (0.01 * 255);
+    const gdouble c2 = (0.03 * 255) * (0.03 * 255);
+    const gint n = SSIM_WINDOW * SSIM_WINDOW;
+    gdouble total = 0.0;
+    gint n_windows = 0;
+    gint x, y, i, j;
+
+    for (y = 0; y + SSIM_WINDOW <= height; y += SSIM_STEP)
+    {
+        for (x = 0; x + SSIM_WINDOW <= width; x += SSIM_STEP)
+        {
+            gdouble sa = 0, sb = 0, saa = 0, sbb = 0, sab = 0;
+            gdouble ma, mb, va, vb, cov;
+
+            for (j = 0; j < SSIM_WINDOW; j++)
+            {
+                for (i = 0; i < SSIM_WINDOW; i++)
+                {
+                    gdouble pa = a [(y + j) * width + x + i];
+                    gdouble pb = b [(y + j) * width + x + i];
+
+                    sa += pa;
+                    sb += pb;
+                    saa += pa * pa;
+                    sbb += pb * pb;
+                    sab += pa * pb;
+                }
+            }
+
+            ma = sa / n;
+            mb = sb / n;
+            va = saa / n - ma * ma;
+            vb = sbb / n - mb * mb;
+            cov = sab / n - ma * mb;
+
+            total += ((2 * ma * mb + c1) * (2 * cov + c2))
+                / ((ma * ma + mb * mb + c1) * (va + vb + c2));
+            n_windows++;
+        }
+    }
+
+    return n_windows > 0 ? total / n_windows : 1.0;
+}
+
+/* --- Driver --- */
+
+static ChafaCanvas *
+new_canvas (gfloat work_factor, ChafaColorExtractor extractor)
+{
+    ChafaCanvasConfig *config;
+    ChafaCanvas *canvas;
+
+    config = chafa_canvas_config_new ();
+    chafa_canvas_config_set_geometry (config, canvas_width, canvas_height);
+    chafa_canvas_config_set_canvas_mode (config, CHAFA_CANVAS_MODE_TRUECOLOR);
+    chafa_canvas_config_set_work_factor (config, work_factor);
+    chafa_canvas_config_set_color_extractor (config, extractor);
+    canvas = chafa_canvas_new (config);
+    chafa_canvas_config_unref (config);
+
+    return canvas;
+}
+
+static gdouble
+time_draw (ChafaCanvas *canvas, const Image *image)
+{
+    gint64 start, elapsed;
+    gint n_iter = 0;
+
+    start = g_get_monotonic_time ();
+
+    do
+    {
+        /* Make every draw redo all the rows */
+        canvas->have_cell_hashes = FALSE;
+        chafa_canvas_draw_all_pixels (canvas, CHAFA_PIXEL_RGBA8_UNASSOCIATED,
+                                      image->pixels, image->width, image->height,
+                                      image->width * 4);
+        n_iter++;
+        elapsed = g_get_monotonic_time () - start;
+    }
+    while (elapsed < (gint64) (min_time_s * 1000000.0));
+
+    return (gdouble) elapsed / n_iter;
+}
+
+static void
+measure_image (const Image *image, ChafaFeatures supported)
+{
+    gint width_pixels = canvas_width * CHAFA_SYMBOL_WIDTH_PIXELS;
+    gint height_pixels = canvas_height * CHAFA_SYMBOL_HEIGHT_PIXELS;
+    gint n_pixels = width_pixels * height_pixels;
+    guint8 *ref_rgba, *out_rgba;
+    guint8 *ref_rgb, *out_rgb;
+    gfloat *ref_luma, *out_luma;
+    gint i, j, k;
+
+    ref_rgba = g_malloc (n_pixels * 4);
+    out_rgba = g_malloc (n_pixels * 4);
+    ref_rgb = g_malloc (n_pixels * 3);
+    out_rgb = g_malloc (n_pixels * 3);
+    ref_luma = g_new (gfloat, n_pixels);
+    out_luma = g_new (gfloat, n_pixels);
+
+    smol_scale_simple (SMOL_PIXEL_RGBA8_UNASSOCIATED, image->pixels,
+                       image->width, image->height, image->width * 4,
+                       SMOL_PIXEL_RGBA8_UNASSOCIATED, ref_rgba,
+                       width_pixels, height_pixels, width_pixels * 4);
+    to_luma_and_rgb (ref_rgba, n_pixels, ref_rgb, ref_luma);
+
+    for (i = 0; i < (gint) G_N_ELEMENTS (work_factors); i++)
+    {
+        for (j = 0; j < (gint) G_N_ELEMENTS (extractors); j++)
+        {
+            for (k = 0; k < (gint) G_N_ELEMENTS (isa_levels); k++)
+            {
+                ChafaCanvas *canvas;
+                gdouble usec;
+
+                if ((isa_levels [k].features & supported) != isa_levels [k].features)
+                    continue;
+
+                chafa_set_feature_mask (isa_levels [k].features);
+
+                canvas = new_canvas (work_factors [i], extractors [j].extractor);
+                usec = time_draw (canvas, image);
+
+                chafa_canvas_rasterize (canvas, out_rgba, width_pixels * 4);
+                to_luma_and_rgb (out_rgba, n_pixels, out_rgb, out_luma);
+
+                g_print ("%s\t%.2f\t%s\t%s\t%dx%d\t%.3f\t%.3f\t%.4f\n",
+                         image->name, work_factors [i], extractors [j].name,
+                         isa_levels [k].name, canvas_width, canvas_height, usec,
+                         calc_psnr (ref_rgb, out_rgb, n_pixels * 3),
+                         calc_ssim (ref_luma, out_luma, width_pixels, height_pixels));
+
+                chafa_canvas_unref (canvas);
+            }
+
+            chafa_set_feature_mask (supported);
+        }
+    }
+
+    g_free (ref_rgba);
+    g_free (out_rgba);
+    g_free (ref_rgb);
+    g_free (out_rgb);
+    g_free (ref_luma);
+    g_free (out_luma);
+}
+
+static void
+usage (const gchar *argv0)
+{
+    fprintf (stderr,
+             "Usage: %s [-t SECONDS] [-j THREADS] [-s WxH] [FILE.ppm...]\n\n"
+             "  -t SECONDS  Minimum time per measurement [0.25].\n"
+             "  -j THREADS  Number of worker threads [1].\n"
+             "  -s WxH      Canvas size in cells [80x24].\n"
+             "  FILE.ppm    Binary PPM images to convert. Uses a synthetic\n"
+             "              image if none are given.\n",
+             argv0);
+}
+
+int
+main (int argc, char *argv [])
+{
+    ChafaFeatures supported;
+    GPtrArray *images;
+    gint n_threads = 1;
+    gint i;
+
+    images = g_ptr_array_new ();
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp (argv [i], "-t") && i + 1 < argc)
+            min_time_s = strtod (argv [++i], NULL);
+        else if (!strcmp (argv [i], "-j") && i + 1 < argc)
+            n_threads = atoi (argv [++i]);
+        else if (!strcmp (argv [i], "-s") && i + 1 < argc)
+        {
+            if (sscanf (argv [++i], "%dx%d", &canvas_width, &canvas_height) != 2
+                || canvas_width < 1 || canvas_height < 1)
+            {
+                usage (argv [0]);
+                return 2;
+            }
+        }
+        else if (argv [i] [0] == '-')
+        {
+            usage (argv [0]);
+            return 2;
+        }
+        else
+        {
+            Image *image = g_new0 (Image, 1);
+
+            if (!load_ppm (image, argv [i]))
+                return 1;
+            g_ptr_array_add (images, image);
+        }
+    }
+
+    if (images->len == 0)
+    {
+        Image *image = g_new0 (Image, 1);
+
+        generate_image (image);
+        g_ptr_array_add (images, image);
+    }
+
+    /* Repeated draws of the same image would come from the cache */
+    chafa_cell_cache_set_max_size (0);
+    chafa_set_n_threads (n_threads);
+    supported = chafa_get_supported_features ();
+
+    g_print ("image\twork_factor\textractor\tisa\tsize\tusec_per_draw\tpsnr_db\tssim\n");
+
+    for (i = 0; i < (gint) images->len; i++)
+    {
+        Image *image = g_ptr_array_index (images, i);
+
+        measure_image (image, supported);
+
+        g_free (image->name);
+        g_free (image->pixels);
+        g_free (image);
+    }
+
+    g_ptr_array_free (images, TRUE);
+    return 0;
+}
@@ -178,6 +178,76 @@ parsing_test (void)
     chafa_term_info_unref (ti);
 }
 
+static void
+parse_next_test (void)
+{
+    ChafaTermInfo *ti;
+    gchar *input = "\033[12;34H\033[15~\033[A\033[7Adef-fg-ffff-0-1234,\033[1";
+    gchar *p = input;
+    gint len = strlen (input);
+    guint args [CHAFA_TERM_SEQ_ARGS_MAX];
+    ChafaTermSeq seq;
+    ChafaParseResult result;
+
+    ti = chafa_term_info_new ();
+
+    /* Overlapping sequences, literal and numeric */
+
+    chafa_term_info_set_seq (ti, CHAFA_TERM_SEQ_CURSOR_TO_POS, "\033[%2;%1H", NULL);
+    chafa_term_info_set_seq (ti, CHAFA_TERM_SEQ_CURSOR_UP_1, "\033[A", NULL);
+    chafa_term_info_set_seq (ti, CHAFA_TERM_SEQ_CURSOR_UP, "\033[%1A", NULL);
+    chafa_term_info_set_seq (ti, CHAFA_TERM_SEQ_F5_KEY, "\033[15~", NULL);
+    chafa_term_info_set_seq (ti, CHAFA_TERM_SEQ_SET_DEFAULT_FG, "def-fg-%1-%2-%3,", NULL);
+
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_SUCCESS);
+    g_assert (seq == CHAFA_TERM_SEQ_CURSOR_TO_POS);
+    g_assert (args [0] == 34);
+    g_assert (args [1] == 12);
+
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_SUCCESS);
+    g_assert (seq == CHAFA_TERM_SEQ_F5_KEY);
+
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_SUCCESS);
+    g_assert (seq == CHAFA_TERM_SEQ_CURSOR_UP_1);
+
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_SUCCESS);
+    g_assert (seq == CHAFA_TERM_SEQ_CURSOR_UP);
+    g_assert (args [0] == 7);
+
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_SUCCESS);
+    g_assert (seq == CHAFA_TERM_SEQ_SET_DEFAULT_FG);
+    g_assert (args [0] == 0xffff);
+    g_assert (args [1] == 0x0000);
+    g_assert (args [2] == 0x1234);
+
+    /* Not enough data */
+
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_AGAIN);
+
+    /* Parse failure */
+
+    p = input + 1;
+    len = strlen (input) - 1;
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_FAILURE);
+
+    /* Changed sequences are picked up */
+
+    chafa_term_info_set_seq (ti, CHAFA_TERM_SEQ_F5_KEY, "\033[15;2~", NULL);
+    p = input + 8;
+    len = 5;
+    result = chafa_term_info_parse_next_seq (ti, &p, &len, &seq, args);
+    g_assert (result == CHAFA_PARSE_FAILURE);
+
+    chafa_term_info_unref (ti);
+}
+
 int
 main (int argc, char *argv [])
 {
@@ -186,6 +256,7 @@ main (int argc, char *argv [])
     g_test_add_func ("/term-info/formatting", formatting_test);
     g_test_add_func ("/term-info/dynamic", dynamic_test);
     g_test_add_func ("/term-info/parsing", parsing_test);
+    g_test_add_func ("/term-info/parse-next", parse_next_test);
 
     return g_test_run ();
 }
@@ -33,6 +33,9 @@
 # include <signal.h>  /* sigaction */
 #endif
 #include <stdlib.h>  /* exit */
+#ifdef HAVE_SYS_RESOURCE_H
+# include <sys/resource.h>  /* getrusage */
+#endif
 #ifdef HAVE_TERMIOS_H
 # include <termios.h>  /* tcgetattr, tcsetattr */
 #endif
@@ -40,9 +43,13 @@
 #include <glib/gstdio.h>
 
 #include <chafa.h>
+#include "file-watcher.h"
 #include "font-loader.h"
 #include "media-loader.h"
 #include "named-colors.h"
+#include "passthrough.h"
+#include "render-server.h"
+#include "term-cache.h"
 
 /* Include after glib.h for G_OS_WIN32 */
 #ifdef G_OS_WIN32
@@ -50,12 +57,25 @@
 #  include <windows.h>
 # endif
 # include <io.h>
+#else
+# include "output-writer.h"
 #endif
 
 #define ANIM_FPS_MAX 100000.0
 #define FILE_DURATION_DEFAULT 0.0
 #define SCALE_MAX 9999.0
 
+/* Lets looping animations reuse the cells from their first pass */
+#define CELL_CACHE_SIZE (32 * 1024 * 1024)
+
+/* Per canvas. Text, UI screenshots and tiled graphics repeat the same
+ * blocks all over, at different positions in each frame. */
+#define BLOCK_CACHE_SIZE 4096
+
+/* How much output may be waiting for the terminal before we stop and wait
+ * for it. Enough to get started on the next frame while it catches up. */
+#define OUTPUT_QUEUE_BYTES_MAX (8 * 1024 * 1024)
+
 typedef struct
 {
     gchar *executable_name;
@@ -76,26 +96,48 @@ typedef struct
     ChafaSymbolMap *symbol_map;
     ChafaSymbolMap *fill_symbol_map;
     gboolean symbols_specified;
+
+    /* Fonts from --glyph-file are loaded after option parsing, so the
+     * compiled symbol maps can be fetched from the cache instead. The
+     * checksum covers everything that went into the maps. */
+    GList *glyph_files;
+    GChecksum *symbol_map_checksum;
+
     gboolean is_interactive;
     gboolean clear;
     gboolean verbose;
     gboolean invert;
     gboolean preprocess;
+    gboolean progressive;
+    gboolean reuse_palette;
+    gboolean adaptive_work;
+    gboolean pass_original;
     gboolean polite;
     gboolean stretch;
     gboolean zoom;
     gboolean watch;
+    gchar *serve_path;
     gboolean fg_only;
     gboolean animate;
     gboolean center;
+    gboolean stats;
+    gchar *trace_path;
+    gdouble prune_symbols;
     gint width, height;
     gint cell_width, cell_height;
     gint margin_bottom, margin_right;
     gdouble scale;
     gdouble font_ratio;
     gint work_factor;
+    gint compression_level;
+    gint frame_cache_mib;
+    gint batch_size;
+    gint benchmark_n;
+    ChafaTransmissionMedium transmission_medium;
+    gboolean transmission_medium_set;
     gint optimization_level;
     gint n_threads;
+    ChafaThreadAffinity thread_affinity;
     ChafaOptimizations optimizations;
     guint32 fg_color;
     gboolean fg_color_set;
@@ -127,10 +169,44 @@ typedef struct
 }
 TermSize;
 
+/* Totals for --stats, collected from each canvas after it's printed */
+typedef struct
+{
+    gint64 stage_wall_us [CHAFA_CANVAS_STAGE_MAX];
+    gint64 stage_cpu_us [CHAFA_CANVAS_STAGE_MAX];
+    gint64 counters [CHAFA_CANVAS_COUNTER_MAX];
+    gdouble work_factor_sum;
+    gint n_frames;
+
+    /* Animation frames that were skipped to keep up with the clock, and
+     * frames that were shown after their time was up */
+    gint n_frames_dropped;
+    gint n_frames_late;
+
+    /* For --prune-symbols; maps code points to SymbolUsage */
+    GHashTable *symbol_usage;
+}
+StatsTotals;
+
+typedef struct
+{
+    gunichar c;
+    gint64 n_picked;
+    gint64 n_candidate;
+}
+SymbolUsage;
+
 static GlobalOptions options;
+static StatsTotals stats_totals;
 static TermSize detected_term_size;
 static gboolean using_detected_size = FALSE;
 static volatile sig_atomic_t interrupted_by_user = FALSE;
+static volatile sig_atomic_t terminal_resized = FALSE;
+
+/* Time the cell conversion of an animation frame should take, with
+ * --adaptive-work. Set by the frame pipeline before it creates any
+ * canvases. */
+static gint anim_time_budget_us = 0;
 
 #ifdef HAVE_TERMIOS_H
 static struct termios saved_termios;
@@ -147,6 +223,14 @@ sigint_handler (G_GNUC_UNUSED int sig)
 {
     interrupted_by_user = TRUE;
 }
+
+# ifdef SIGWINCH
+static void
+sigwinch_handler (G_GNUC_UNUSED int sig)
+{
+    terminal_resized = TRUE;
+}
+# endif
 #endif
 
 static void
@@ -205,6 +289,12 @@ safe_WriteConsoleA (HANDLE chd, const gchar *data, gsize len)
     return TRUE;
 }
 
+#else
+
+/* Writes to stdout on a thread of its own, so we can keep working while the
+ * terminal drains its input. NULL until rendering starts. */
+static OutputWriter *output_writer;
+
 #endif
 
 static gboolean
@@ -251,10 +341,26 @@ write_to_stdout (gconstpointer buf, gsize len)
         return total_written == len ? TRUE : FALSE;
     }
 #else
+    if (output_writer)
+        return output_writer_write (output_writer, buf, len);
+
     return fwrite (buf, 1, len, stdout) == len ? TRUE : FALSE;
 #endif
 }
 
+/* Makes sure everything written so far reaches stdout. If wait is FALSE,
+ * queued output may still be on its way. */
+static gboolean
+flush_stdout (gboolean wait)
+{
+#ifndef G_OS_WIN32
+    if (output_writer)
+        return wait ? output_writer_flush (output_writer) : TRUE;
+#endif
+
+    return fflush (stdout) == 0;
+}
+
 static guchar
 get_hex_byte (const gchar *str)
 {
@@ -402,8 +508,18 @@ print_summary (void)
     "      --version      Show version.\n"
     "  -v, --verbose      Be verbose.\n\n"
 
+    "      --adaptive-work=BOOL  Lower the work factor for animations that can't\n"
+    "                     be converted in time [on, off]. Symbols only. Defaults\n"
+    "                     to off.\n"
     "      --animate=BOOL  Whether to allow animation [on, off]. Defaults to on.\n"
     "                     When off, will show a still frame from each animation.\n"
+    "      --batch=NUM    When showing several files, decode and convert up to NUM\n"
+    "                     still images at once. 0 disables. Defaults to the number\n"
+    "                     of threads.\n"
+    "      --benchmark=NUM  Decode each file once, then convert and print its\n"
+    "                     first frame NUM times, discarding the output. Reports\n"
+    "                     the frame rate, time per stage, output size and\n"
+    "                     peak memory use. Implies --stats.\n"
     "      --bg=COLOR     Background color of display (color name or hex).\n"
     "  -C, --center=BOOL  Center images [on, off]. Defaults to off.\n"
     "      --clear        Clear screen before processing each file.\n"
@@ -413,8 +529,13 @@ print_summary (void)
     "                     [average, median]. Average is the default.\n"
     "      --color-space=CS  Color space used for quantization; one of [rgb, din99d].\n"
     "                     Defaults to rgb, which is faster but less accurate.\n"
+    "      --connect=PATH  Have the server listening on socket PATH render the\n"
+    "                     files, passing on only the output size. See --serve.\n"
+    "      --compress=NUM  Compress Kitty and iTerm2 graphics data [0-9]. 1 is the\n"
+    "                     fastest, 9 the smallest. Defaults to 0 (off).\n"
     "      --dither=DITHER  Set output dither mode; one of [none, ordered,\n"
-    "                     diffusion]. No effect with 24-bit color. Defaults to none.\n"
+    "                     diffusion, noise]. No effect with 24-bit color. Defaults\n"
+    "                     to none.\n"
     "      --dither-grain=WxH  Set dimensions of dither grains in 1/8ths of a\n"
     "                     character cell [1, 2, 4, 8]. Defaults to 4x4.\n"
     "      --dither-intensity=NUM  Multiplier for dither intensity [0.0 - inf].\n"
@@ -434,8 +555,12 @@ print_summary (void)
     "                     symbols]. Iterm, kitty and sixels yield much higher\n"
     "                     quality but enjoy limited support. Symbols mode yields\n"
     "                     beautiful character art.\n"
+    "      --frame-cache=NUM  Memory in MiB to use for keeping converted animation\n"
+    "                     frames around, so they don't have to be converted again\n"
+    "                     on every loop. 0 disables. Defaults to 64.\n"
     "      --glyph-file=FILE  Load glyph information from FILE, which can be any\n"
-    "                     font file supported by FreeType (TTF, PCF, etc).\n"
+    "                     font file supported by FreeType (TTF, PCF, etc). The\n"
+    "                     resulting symbol maps are cached for quick reuse.\n"
     "      --invert       Invert video. For display with bright backgrounds in\n"
     "                     color modes 2 and none. Swaps --fg and --bg.\n"
     "      --margin-bottom=NUM  When terminal size is detected, reserve at least NUM\n"
@@ -448,30 +573,61 @@ print_summary (void)
     "                     intelligently [0-9]. 0 disables, 9 enables every\n"
     "                     available optimization. Defaults to 5, except for when\n"
     "                     used with \"-c none\", where it defaults to 0.\n"
+    "      --pass-original=BOOL  Send PNG and JPEG files to Kitty and iTerm2\n"
+    "                     terminals as-is when they don't need downscaling, letting\n"
+    "                     the terminal decode them [on, off]. Defaults to on.\n"
     "      --polite=BOOL  Polite mode [on, off]. Defaults to on. Turning this off\n"
     "                     may enhance presentation and prevent interference from\n"
     "                     other programs, but risks leaving the terminal in an\n"
     "                     altered state (rude).\n"
     "  -p, --preprocess=BOOL  Image preprocessing [on, off]. Defaults to on with 16\n"
     "                     colors or lower, off otherwise.\n"
+    "      --progressive  Show a coarse version of still images first, then refine\n"
+    "                     them a few rows at a time. Symbols only.\n"
+    "      --prune-symbols=PERCENT  Count how often each symbol is picked, and\n"
+    "                     when done, print a --symbols selector that keeps the\n"
+    "                     fewest symbols making up PERCENT of the picks. Run it\n"
+    "                     over typical content to find a smaller, faster set.\n"
+    "                     Implies --stats.\n"
+    "      --reuse-palette=BOOL  Keep the sixel palette across animation frames\n"
+    "                     [on, off], generating a new one only when the colors\n"
+    "                     change a lot. Reduces output size and flicker, but\n"
+    "                     needs a terminal that retains color registers between\n"
+    "                     images. Defaults to off.\n"
     "      --scale=NUM    Scale image, respecting terminal's maximum dimensions. 1.0\n"
     "                     approximates original pixel dimensions. Specify \"max\" to\n"
     "                     use all available space. Defaults to 1.0 for pixel graphics\n"
     "                     and 4.0 for symbols.\n"
+    "      --serve=PATH   Keep running and render files for clients connecting to\n"
+    "                     the Unix socket PATH, using the other options given.\n"
+    "                     Saves startup time when showing many small previews.\n"
     "  -s, --size=WxH     Set maximum output dimensions in columns and rows. By\n"
     "                     default this will be the size of your terminal, or 80x25\n"
     "                     if size detection fails.\n"
     "      --speed=SPEED  Set the speed animations will play at. This can be\n"
     "                     either a unitless multiplier, or a real number followed\n"
     "                     by \"fps\" to apply a specific framerate.\n"
+    "      --stats        Print the time spent in each processing stage and the\n"
+    "                     number of cells handled by each symbol picker to stderr\n"
+    "                     when done.\n"
     "      --stretch      Stretch image to fit output dimensions; ignore aspect.\n"
     "                     Implies --scale max.\n"
     "      --symbols=SYMS  Specify character symbols to employ in final output.\n"
     "                     See below for full usage and a list of symbol classes.\n"
     "      --threads=NUM  Maximum number of CPU threads to use. If left unspecified\n"
     "                     or negative, this will equal available CPU cores.\n"
+    "      --thread-affinity=MODE  Where to run worker threads; one of [none, cores,\n"
+    "                     nodes]. Pinning them to cores or NUMA nodes can help on\n"
+    "                     multi-socket machines. Defaults to none.\n"
     "  -t, --threshold=NUM  Threshold above which full transparency will be used\n"
     "                     [0.0 - 1.0].\n"
+    "      --trace=PATH   Record when each thread works on each stage, and write\n"
+    "                     the events to PATH in Chrome trace format for viewing\n"
+    "                     in Perfetto. CHAFA_TRACE=PATH in the environment works\n"
+    "                     too.\n"
+    "      --transfer=MEDIUM  How to transfer Kitty graphics; one of [auto, direct,\n"
+    "                     file, shm]. Defaults to auto, which uses shared memory\n"
+    "                     if the terminal is local.\n"
     "      --watch        Watch a single input file, redisplaying it whenever its\n"
     "                     contents change. Will run until manually interrupted\n"
     "                     or, if --duration is set, until it expires.\n"
@@ -592,10 +748,12 @@ parse_dither_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_
     else if (!g_ascii_strcasecmp (value, "diffusion")
              || !g_ascii_strcasecmp (value, "fs"))
         options.dither_mode = CHAFA_DITHER_MODE_DIFFUSION;
+    else if (!g_ascii_strcasecmp (value, "noise"))
+        options.dither_mode = CHAFA_DITHER_MODE_NOISE;
     else
     {
         g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
-                     "Dither must be one of [none, ordered, diffusion].");
+                     "Dither must be one of [none, ordered, diffusion, noise].");
         result = FALSE;
     }
 
@@ -682,16 +840,25 @@ out:
     return success;
 }
 
+static void
+update_symbol_map_checksum (const gchar *key, const gchar *value)
+{
+    g_checksum_update (options.symbol_map_checksum, (const guchar *) key, strlen (key) + 1);
+    g_checksum_update (options.symbol_map_checksum, (const guchar *) value, strlen (value) + 1);
+}
+
 static gboolean
 parse_symbols_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
 {
     options.symbols_specified = TRUE;
+    update_symbol_map_checksum ("symbols", value);
     return chafa_symbol_map_apply_selectors (options.symbol_map, value, error);
 }
 
 static gboolean
 parse_fill_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
 {
+    update_symbol_map_checksum ("fill", value);
     return chafa_symbol_map_apply_selectors (options.fill_symbol_map, value, error);
 }
 
@@ -824,30 +991,50 @@ out:
 static gboolean
 parse_glyph_file_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
 {
-    gboolean result = FALSE;
     FileMapping *file_mapping;
-    FontLoader *font_loader;
-    gunichar c;
-    gpointer c_bitmap;
-    gint width, height;
+    gconstpointer file_data;
+    gsize file_data_len;
+    gchar *file_checksum;
+
+    /* Only fingerprint the file here. Loading it is deferred to
+     * load_glyph_files (), which may find a cached result. */
 
     file_mapping = file_mapping_new (value);
-    if (!file_mapping)
+    file_data = file_mapping ? file_mapping_get_data (file_mapping, &file_data_len) : NULL;
+    if (!file_data)
     {
+        if (file_mapping)
+            file_mapping_destroy (file_mapping);
         g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
                      "Unable to open glyph file '%s'.", value);
-        goto out;
+        return FALSE;
     }
 
-    font_loader = font_loader_new_from_mapping (file_mapping);
-    file_mapping = NULL;  /* Font loader owns it now */
+    file_checksum = g_compute_checksum_for_data (G_CHECKSUM_SHA256, file_data, file_data_len);
+    update_symbol_map_checksum ("glyph-file", file_checksum);
+    g_free (file_checksum);
+    file_mapping_destroy (file_mapping);
+
+    options.glyph_files = g_list_append (options.glyph_files, g_strdup (value));
+    return TRUE;
+}
+
+static gboolean
+add_glyphs_from_file (const gchar *path)
+{
+    FileMapping *file_mapping;
+    FontLoader *font_loader;
+    gunichar c;
+    gpointer c_bitmap;
+    gint width, height;
+
+    file_mapping = file_mapping_new (path);
+    if (!file_mapping)
+        return FALSE;
 
+    font_loader = font_loader_new_from_mapping (file_mapping);
     if (!font_loader)
-    {
-        g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
-                     "Unable to load glyph file '%s'.", value);
-        goto out;
-    }
+        return FALSE;
 
     while (font_loader_get_next_glyph (font_loader, &c, &c_bitmap, &width, &height))
     {
@@ -861,12 +1048,98 @@ parse_glyph_file_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value
     }
 
     font_loader_destroy (font_loader);
+    return TRUE;
+}
+
+static ChafaSymbolMap *
+load_cached_symbol_map (const gchar *path)
+{
+    ChafaSymbolMap *symbol_map = NULL;
+    FileMapping *file_mapping;
+    gconstpointer data;
+    gsize data_len;
+
+    file_mapping = file_mapping_new (path);
+    if (!file_mapping)
+        return NULL;
+
+    data = file_mapping_get_data (file_mapping, &data_len);
+    if (data)
+        symbol_map = chafa_symbol_map_new_from_serialized (data, data_len, NULL);
+
+    file_mapping_destroy (file_mapping);
+    return symbol_map;
+}
+
+static void
+store_cached_symbol_map (const gchar *path, ChafaSymbolMap *symbol_map)
+{
+    gpointer data;
+    gsize data_len;
+
+    /* Failure is harmless; we'll just compile the maps again next time */
+    data = chafa_symbol_map_serialize (symbol_map, &data_len);
+    g_file_set_contents (path, data, data_len, NULL);
+    g_free (data);
+}
+
+/* Compiling symbol maps for large fonts takes a long time, so the result
+ * is kept in the user's cache directory. The cache key is the checksum
+ * of the Chafa version, all symbol selectors and the contents of all
+ * glyph files, in order. */
+static gboolean
+load_glyph_files (void)
+{
+    gboolean result = FALSE;
+    ChafaSymbolMap *symbol_map, *fill_symbol_map = NULL;
+    gchar *cache_dir, *symbols_path, *fill_path;
+    const gchar *key;
+    GList *l;
+
+    key = g_checksum_get_string (options.symbol_map_checksum);
+    cache_dir = g_build_filename (g_get_user_cache_dir (), "chafa", NULL);
+    symbols_path = g_strdup_printf ("%s%sglyphs-%s-symbols.bin", cache_dir, G_DIR_SEPARATOR_S, key);
+    fill_path = g_strdup_printf ("%s%sglyphs-%s-fill.bin", cache_dir, G_DIR_SEPARATOR_S, key);
+
+    symbol_map = load_cached_symbol_map (symbols_path);
+    if (symbol_map)
+        fill_symbol_map = load_cached_symbol_map (fill_path);
+
+    if (symbol_map && fill_symbol_map)
+    {
+        chafa_symbol_map_unref (options.symbol_map);
+        chafa_symbol_map_unref (options.fill_symbol_map);
+        options.symbol_map = symbol_map;
+        options.fill_symbol_map = fill_symbol_map;
+        result = TRUE;
+        goto out;
+    }
+
+    if (symbol_map)
+        chafa_symbol_map_unref (symbol_map);
+
+    for (l = options.glyph_files; l; l = g_list_next (l))
+    {
+        if (!add_glyphs_from_file (l->data))
+        {
+            g_printerr ("%s: Unable to load glyph file '%s'.\n",
+                        options.executable_name, (const gchar *) l->data);
+            goto out;
+        }
+    }
+
+    if (g_mkdir_with_parents (cache_dir, 0755) == 0)
+    {
+        store_cached_symbol_map (symbols_path, options.symbol_map);
+        store_cached_symbol_map (fill_path, options.fill_symbol_map);
+    }
 
     result = TRUE;
 
 out:
-    if (file_mapping)
-        file_mapping_destroy (file_mapping);
+    g_free (symbols_path);
+    g_free (fill_path);
+    g_free (cache_dir);
     return result;
 }
 
@@ -1031,6 +1304,91 @@ parse_center_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_
     return result;
 }
 
+static gboolean
+parse_adaptive_work_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
+{
+    gboolean result;
+
+    result = parse_boolean_token (value, &options.adaptive_work);
+    if (!result)
+        g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+                     "Adaptive work must be one of [on, off].");
+
+    return result;
+}
+
+static gboolean
+parse_reuse_palette_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
+{
+    gboolean result;
+
+    result = parse_boolean_token (value, &options.reuse_palette);
+    if (!result)
+        g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+                     "Palette reuse must be one of [on, off].");
+
+    return result;
+}
+
+static gboolean
+parse_pass_original_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
+{
+    gboolean result;
+
+    result = parse_boolean_token (value, &options.pass_original);
+    if (!result)
+        g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+                     "Original file pass-through must be one of [on, off].");
+
+    return result;
+}
+
+static gboolean
+parse_transfer_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
+{
+    gboolean result = TRUE;
+
+    options.transmission_medium_set = TRUE;
+
+    if (!g_ascii_strcasecmp (value, "auto"))
+        options.transmission_medium_set = FALSE;
+    else if (!g_ascii_strcasecmp (value, "direct"))
+        options.transmission_medium = CHAFA_TRANSMISSION_MEDIUM_DIRECT;
+    else if (!g_ascii_strcasecmp (value, "file"))
+        options.transmission_medium = CHAFA_TRANSMISSION_MEDIUM_TEMP_FILE;
+    else if (!g_ascii_strcasecmp (value, "shm"))
+        options.transmission_medium = CHAFA_TRANSMISSION_MEDIUM_SHARED_MEMORY;
+    else
+    {
+        g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+                     "Transfer medium must be one of [auto, direct, file, shm].");
+        result = FALSE;
+    }
+
+    return result;
+}
+
+static gboolean
+parse_thread_affinity_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
+{
+    gboolean result = TRUE;
+
+    if (!g_ascii_strcasecmp (value, "none"))
+        options.thread_affinity = CHAFA_THREAD_AFFINITY_NONE;
+    else if (!g_ascii_strcasecmp (value, "cores"))
+        options.thread_affinity = CHAFA_THREAD_AFFINITY_CORES;
+    else if (!g_ascii_strcasecmp (value, "nodes"))
+        options.thread_affinity = CHAFA_THREAD_AFFINITY_NODES;
+    else
+    {
+        g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+                     "Thread affinity must be one of [none, cores, nodes].");
+        result = FALSE;
+    }
+
+    return result;
+}
+
 static gboolean
 parse_preprocess_arg (G_GNUC_UNUSED const gchar *option_name, const gchar *value, G_GNUC_UNUSED gpointer data, GError **error)
 {
@@ -1306,6 +1664,24 @@ tty_options_init (void)
     }
 }
 
+/* Set between begin_frame () and end_frame () while the terminal is holding
+ * off on repainting. A frame that fails halfway has to end it on exit. */
+static gboolean in_synchronized_update = FALSE;
+
+static gboolean
+end_synchronized_update (void)
+{
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX];
+    gchar *p0;
+
+    if (!in_synchronized_update)
+        return TRUE;
+
+    in_synchronized_update = FALSE;
+    p0 = chafa_term_info_emit_end_synchronized_update (options.term_info, buf);
+    return write_to_stdout (buf, p0 - buf);
+}
+
 static void
 tty_options_deinit (void)
 {
@@ -1314,6 +1690,8 @@ tty_options_deinit (void)
         SetConsoleCP (saved_console_input_cp);
 #endif
 
+    end_synchronized_update ();
+
     if (!options.polite)
     {
         if (options.mode != CHAFA_CANVAS_MODE_FGBG)
@@ -1343,6 +1721,9 @@ detect_terminal (ChafaTermInfo **term_info_out, ChafaCanvasMode *mode_out, Chafa
     ChafaTermInfo *fallback_info;
     gchar **envp;
 
+    if (term_cache_load (term_info_out, mode_out, pixel_mode_out))
+        return;
+
     envp = g_get_environ ();
     term_info = chafa_term_db_detect (chafa_term_db_get_default (), envp);
 
@@ -1378,6 +1759,8 @@ detect_terminal (ChafaTermInfo **term_info_out, ChafaCanvasMode *mode_out, Chafa
     chafa_term_info_supplement (term_info, fallback_info);
     chafa_term_info_unref (fallback_info);
 
+    term_cache_store (term_info, mode, pixel_mode);
+
     *term_info_out = term_info;
     *mode_out = mode;
     *pixel_mode_out = pixel_mode;
@@ -1398,13 +1781,17 @@ parse_options (int *argc, char **argv [])
         { "help",        'h',  0, G_OPTION_ARG_NONE,     &options.show_help,    "Show help", NULL },
         { "version",     '\0', 0, G_OPTION_ARG_NONE,     &options.show_version, "Show version", NULL },
         { "verbose",     'v',  0, G_OPTION_ARG_NONE,     &options.verbose,      "Be verbose", NULL },
+        { "adaptive-work", '\0', 0, G_OPTION_ARG_CALLBACK, parse_adaptive_work_arg, "Adaptive work factor", NULL },
         { "animate",     '\0', 0, G_OPTION_ARG_CALLBACK, parse_animate_arg,     "Animate", NULL },
+        { "batch",       '\0', 0, G_OPTION_ARG_INT,      &options.batch_size,   "Batch size", NULL },
+        { "benchmark",   '\0', 0, G_OPTION_ARG_INT,      &options.benchmark_n,  "Benchmark", NULL },
         { "bg",          '\0', 0, G_OPTION_ARG_CALLBACK, parse_bg_color_arg,    "Background color of display", NULL },
         { "center",      'C',  0, G_OPTION_ARG_CALLBACK, parse_center_arg,      "Center", NULL },
         { "clear",       '\0', 0, G_OPTION_ARG_NONE,     &options.clear,        "Clear", NULL },
         { "colors",      'c',  0, G_OPTION_ARG_CALLBACK, parse_colors_arg,      "Colors (none, 2, 16, 256, 240 or full)", NULL },
         { "color-extractor", '\0', 0, G_OPTION_ARG_CALLBACK, parse_color_extractor_arg, "Color extractor (average or median)", NULL },
         { "color-space", '\0', 0, G_OPTION_ARG_CALLBACK, parse_color_space_arg, "Color space (rgb or din99d)", NULL },
+        { "compress",    '\0', 0, G_OPTION_ARG_INT,      &options.compression_level, "Compression level", NULL },
         { "dither",      '\0', 0, G_OPTION_ARG_CALLBACK, parse_dither_arg,      "Dither", NULL },
         { "dither-grain",'\0', 0, G_OPTION_ARG_CALLBACK, parse_dither_grain_arg, "Dither grain", NULL },
         { "dither-intensity", '\0',  0, G_OPTION_ARG_DOUBLE,   &options.dither_intensity, "Dither intensity", NULL },
@@ -1415,21 +1802,31 @@ parse_options (int *argc, char **argv [])
         { "fill",        '\0', 0, G_OPTION_ARG_CALLBACK, parse_fill_arg,        "Fill symbols", NULL },
         { "format",      'f',  0, G_OPTION_ARG_CALLBACK, parse_format_arg,      "Format of output pixel data (iterm, kitty, sixels or symbols)", NULL },
         { "font-ratio",  '\0', 0, G_OPTION_ARG_CALLBACK, parse_font_ratio_arg,  "Font ratio", NULL },
+        { "frame-cache", '\0', 0, G_OPTION_ARG_INT,      &options.frame_cache_mib, "Frame cache size", NULL },
         { "glyph-file",  '\0', 0, G_OPTION_ARG_CALLBACK, parse_glyph_file_arg,  "Glyph file", NULL },
         { "invert",      '\0', 0, G_OPTION_ARG_NONE,     &options.invert,       "Invert foreground/background", NULL },
         { "margin-bottom", '\0', 0, G_OPTION_ARG_INT,    &options.margin_bottom,  "Bottom margin", NULL },
         { "margin-right", '\0', 0, G_OPTION_ARG_INT,     &options.margin_right,  "Right margin", NULL },
         { "optimize",    'O',  0, G_OPTION_ARG_INT,      &options.optimization_level,  "Optimization", NULL },
+        { "pass-original", '\0', 0, G_OPTION_ARG_CALLBACK, parse_pass_original_arg, "Pass original file through", NULL },
         { "polite",      '\0', 0, G_OPTION_ARG_CALLBACK, parse_polite_arg,      "Polite", NULL },
         { "preprocess",  'p',  0, G_OPTION_ARG_CALLBACK, parse_preprocess_arg,  "Preprocessing", NULL },
+        { "progressive", '\0', 0, G_OPTION_ARG_NONE,     &options.progressive,  "Progressive refinement", NULL },
+        { "prune-symbols", '\0', 0, G_OPTION_ARG_DOUBLE, &options.prune_symbols, "Print pruned symbol selectors", NULL },
+        { "reuse-palette", '\0', 0, G_OPTION_ARG_CALLBACK, parse_reuse_palette_arg, "Reuse palette", NULL },
         { "work",        'w',  0, G_OPTION_ARG_INT,      &options.work_factor,  "Work factor", NULL },
         { "scale",       '\0', 0, G_OPTION_ARG_CALLBACK, parse_scale_arg,       "Scale", NULL },
+        { "serve",       '\0', 0, G_OPTION_ARG_FILENAME, &options.serve_path,   "Serve requests on socket", NULL },
         { "size",        's',  0, G_OPTION_ARG_CALLBACK, parse_size_arg,        "Output size", NULL },
         { "speed",       '\0', 0, G_OPTION_ARG_CALLBACK, parse_anim_speed_arg,  "Animation speed", NULL },
+        { "stats",       '\0', 0, G_OPTION_ARG_NONE,     &options.stats,        "Print statistics", NULL },
         { "stretch",     '\0', 0, G_OPTION_ARG_NONE,     &options.stretch,      "Stretch image to fix output dimensions", NULL },
         { "symbols",     '\0', 0, G_OPTION_ARG_CALLBACK, parse_symbols_arg,     "Output symbols", NULL },
         { "threads",     '\0', 0, G_OPTION_ARG_INT,      &options.n_threads,    "Number of threads", NULL },
+        { "thread-affinity", '\0', 0, G_OPTION_ARG_CALLBACK, parse_thread_affinity_arg, "Thread affinity", NULL },
         { "threshold",   't',  0, G_OPTION_ARG_DOUBLE,   &options.transparency_threshold, "Transparency threshold", NULL },
+        { "trace",       '\0', 0, G_OPTION_ARG_FILENAME, &options.trace_path,   "Write trace events", NULL },
+        { "transfer",    '\0', 0, G_OPTION_ARG_CALLBACK, parse_transfer_arg,    "Transfer medium", NULL },
         { "watch",       '\0', 0, G_OPTION_ARG_NONE,     &options.watch,        "Watch a file's contents", NULL },
         /* Deprecated: Equivalent to --scale max */
         { "zoom",        '\0', 0, G_OPTION_ARG_NONE,     &options.zoom,         "Allow scaling up beyond one character per pixel", NULL },
@@ -1448,6 +1845,12 @@ parse_options (int *argc, char **argv [])
 
     /* Defaults */
 
+    options.symbol_map_checksum = g_checksum_new (G_CHECKSUM_SHA256);
+    update_symbol_map_checksum ("version", VERSION);
+#ifdef G_OS_WIN32
+    update_symbol_map_checksum ("platform", "win32");
+#endif
+
     options.symbol_map = chafa_symbol_map_new ();
 #ifdef G_OS_WIN32
     chafa_symbol_map_add_by_tags (options.symbol_map, CHAFA_SYMBOL_TAG_HALF);
@@ -1473,6 +1876,9 @@ parse_options (int *argc, char **argv [])
     options.dither_intensity = 1.0;
     options.animate = TRUE;
     options.center = FALSE;
+    options.pass_original = TRUE;
+    options.frame_cache_mib = 64;
+    options.batch_size = -1;
     options.polite = TRUE;
     options.preprocess = TRUE;
     options.fg_only = FALSE;
@@ -1522,6 +1928,10 @@ parse_options (int *argc, char **argv [])
         goto out;
     }
 
+    /* The server's own terminal is never drawn on */
+    if (options.serve_path)
+        options.is_interactive = FALSE;
+
     /* Detect terminal geometry */
 
     get_tty_size (&detected_term_size);
@@ -1641,6 +2051,69 @@ parse_options (int *argc, char **argv [])
         goto out;
     }
 
+    if (options.compression_level < 0 || options.compression_level > 9)
+    {
+        g_printerr ("%s: Compression level must be in the range [0-9].\n", options.executable_name);
+        goto out;
+    }
+
+    if (options.frame_cache_mib < 0)
+    {
+        g_printerr ("%s: Frame cache size can't be negative.\n", options.executable_name);
+        goto out;
+    }
+
+    if (options.batch_size < -1)
+    {
+        g_printerr ("%s: Batch size can't be negative.\n", options.executable_name);
+        goto out;
+    }
+
+    if (options.trace_path && !chafa_set_trace_file (options.trace_path))
+    {
+        g_printerr ("%s: Can't write trace to '%s'.\n", options.executable_name, options.trace_path);
+        goto out;
+    }
+
+    if (options.benchmark_n < 0)
+    {
+        g_printerr ("%s: Benchmark repeat count can't be negative.\n", options.executable_name);
+        goto out;
+    }
+
+    if (options.benchmark_n > 0 && (options.watch || options.serve_path))
+    {
+        g_printerr ("%s: Can't use --benchmark with --watch or --serve.\n", options.executable_name);
+        goto out;
+    }
+
+    if (options.prune_symbols < 0.0 || options.prune_symbols > 100.0)
+    {
+        g_printerr ("%s: Symbol pruning share %.1lf is not in the range [0.0-100.0].\n",
+                    options.executable_name, options.prune_symbols);
+        goto out;
+    }
+
+    /* The symbols are tallied with the other statistics, and the benchmark
+     * gets its stage times from them */
+    if (options.prune_symbols > 0.0 || options.benchmark_n > 0)
+        options.stats = TRUE;
+
+    /* Shared memory and temporary files must be read by the terminal as
+     * we go, so only use them automatically when printing straight to a
+     * terminal that can see them. The term db leaves out the sequences
+     * for remote sessions. Benchmark output is never read. */
+    if (!options.transmission_medium_set)
+    {
+        if (isatty (STDOUT_FILENO)
+            && !options.serve_path
+            && options.benchmark_n == 0
+            && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_SHM_IMAGE_V1))
+            options.transmission_medium = CHAFA_TRANSMISSION_MEDIUM_SHARED_MEMORY;
+        else
+            options.transmission_medium = CHAFA_TRANSMISSION_MEDIUM_DIRECT;
+    }
+
     if (options.transparency_threshold == G_MAXDOUBLE)
         options.transparency_threshold = 0.5;
     else
@@ -1654,7 +2127,17 @@ parse_options (int *argc, char **argv [])
 
     /* Collect filenames and validate count and correct usage of stdin */
 
-    if (*argc > 1)
+    if (options.serve_path)
+    {
+        /* Files come from the clients */
+        if (*argc > 1)
+        {
+            g_printerr ("%s: Can't give files to --serve; pass them with --connect.\n",
+                        options.executable_name);
+            goto out;
+        }
+    }
+    else if (*argc > 1)
     {
         options.args = collect_variable_arguments (argc, argv, 1);
     }
@@ -1730,7 +2213,13 @@ parse_options (int *argc, char **argv [])
      * needs inverted symbols. In other modes they will only slow us down,
      * so disable them unless the user specified symbols of their own. */
     if (options.mode != CHAFA_CANVAS_MODE_FGBG && !options.symbols_specified)
+    {
         chafa_symbol_map_remove_by_tags (options.symbol_map, CHAFA_SYMBOL_TAG_INVERTED);
+        update_symbol_map_checksum ("symbols", "-inverted");
+    }
+
+    if (options.glyph_files && !load_glyph_files ())
+        goto out;
 
     /* If optimization level is unset, enable optimizations. However, we
      * leave them off for FGBG mode, since control sequences may be
@@ -1755,8 +2244,16 @@ parse_options (int *argc, char **argv [])
         options.optimizations |= CHAFA_OPTIMIZATION_REPEAT_CELLS;
     if (options.optimization_level >= 7)
         options.optimizations |= CHAFA_OPTIMIZATION_SKIP_CELLS;
+    if (options.optimization_level >= 8)
+        options.optimizations |= CHAFA_OPTIMIZATION_SWAP_COLORS;
 
     chafa_set_n_threads (options.n_threads);
+    chafa_set_thread_affinity (options.thread_affinity);
+    chafa_set_cell_cache_size (CELL_CACHE_SIZE);
+    chafa_set_block_cache_size (BLOCK_CACHE_SIZE);
+
+    if (options.batch_size < 0)
+        options.batch_size = chafa_get_n_actual_threads ();
 
     result = TRUE;
 
@@ -1776,6 +2273,11 @@ write_pad_spaces (gint n)
 
     g_assert (n >= 0);
 
+#ifndef G_OS_WIN32
+    if (output_writer)
+        return output_writer_write_spaces (output_writer, n);
+#endif
+
     n = MIN (n, PAD_SPACES_MAX);
     for (i = 0; i < n; i++)
         buf [i] = ' ';
@@ -1783,64 +2285,79 @@ write_pad_spaces (gint n)
     return write_to_stdout (buf, n);
 }
 
-/* Write out the image data, possibly centering it */
-static gboolean
-write_image (const gchar *data, gsize len, gint dest_width)
+/* Writes out image data, possibly centering it. The data may arrive in
+ * pieces, so we remember whether the next row still needs indenting. */
+typedef struct
 {
     gint left_space;
-    gboolean result = FALSE;
+    gboolean need_indent;
+}
+ImageWriter;
 
-    left_space = options.center ? (detected_term_size.width_cells - dest_width) / 2 : 0;
+static void
+image_writer_init (ImageWriter *writer, gint dest_width)
+{
+    writer->left_space = options.center ? (detected_term_size.width_cells - dest_width) / 2 : 0;
+    writer->need_indent = TRUE;
+}
 
-    /* Indent top left corner: Common for all modes */
-    if (left_space > 0)
-    {
-        if (!write_pad_spaces (left_space))
-            goto out;
-    }
+static gboolean
+image_writer_write (const gchar *data, gsize len, gpointer user_data)
+{
+    ImageWriter *writer = user_data;
+    const gchar *end, *p0, *p1;
+
+#ifndef G_OS_WIN32
+    /* Queue rows and their padding as separate segments instead of
+     * writing them out one by one */
+    if (output_writer && writer->left_space > 0
+        && options.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS)
+        return output_writer_write_lines (output_writer, data, len,
+                                          writer->left_space, &writer->need_indent);
+#endif
 
-    if (left_space <= 0 || options.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS)
-    {
-        if (!write_to_stdout (data, len))
-            goto out;
-    }
-    else
+    for (p0 = data, end = data + len; p0 < end; p0 = p1)
     {
-        const gchar *end, *p0, *p1;
+        /* Indent top left corner: Common for all modes */
+        if (writer->need_indent && writer->left_space > 0)
+        {
+            if (!write_pad_spaces (writer->left_space))
+                return FALSE;
+        }
 
-        /* Indent subsequent rows: Symbols mode only */
+        writer->need_indent = FALSE;
 
-        for (p0 = data, end = data + len; p0 < end; p0 = p1)
+        if (writer->left_space <= 0 || options.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS)
         {
+            p1 = end;
+        }
+        else
+        {
+            /* Indent subsequent rows: Symbols mode only */
             p1 = memchr (p0, '\n', end - p0);
-            p1 = p1 ? (p1 + 1) : end;
-
-            if (!write_to_stdout (p0, p1 - p0))
-                goto out;
-
-            if (p1 != end)
+            if (p1)
             {
-                if (!write_pad_spaces (left_space))
-                    goto out;
+                p1++;
+                writer->need_indent = TRUE;
+            }
+            else
+            {
+                p1 = end;
             }
         }
-    }
 
-    result = TRUE;
+        if (!write_to_stdout (p0, p1 - p0))
+            return FALSE;
+    }
 
-out:
-    return result;
+    return TRUE;
 }
 
-static GString *
-build_string (ChafaPixelType pixel_type, const guint8 *pixels,
-              gint src_width, gint src_height, gint src_rowstride,
-              gint dest_width, gint dest_height,
-              gboolean is_animation)
+static ChafaCanvas *
+create_canvas (gint dest_width, gint dest_height, gboolean is_animation)
 {
     ChafaCanvasConfig *config;
     ChafaCanvas *canvas;
-    GString *gs;
 
     config = chafa_canvas_config_new ();
 
@@ -1874,15 +2391,459 @@ build_string (ChafaPixelType pixel_type, const guint8 *pixels,
      * get the work factor. */
     chafa_canvas_config_set_work_factor (config, (options.work_factor - 1) / 8.0f);
 
+    if (is_animation && anim_time_budget_us > 0)
+        chafa_canvas_config_set_time_budget (config, anim_time_budget_us);
+
     chafa_canvas_config_set_optimizations (config, options.optimizations);
+    chafa_canvas_config_set_stats_enabled (config, options.stats);
+    chafa_canvas_config_set_palette_reuse_enabled (config, is_animation && options.reuse_palette);
+    chafa_canvas_config_set_compression_level (config, options.compression_level);
+    chafa_canvas_config_set_transmission_medium (config, options.transmission_medium);
 
     canvas = chafa_canvas_new (config);
-    chafa_canvas_draw_all_pixels (canvas, pixel_type, pixels, src_width, src_height, src_rowstride);
-    gs = chafa_canvas_print (canvas, options.term_info);
-
-    chafa_canvas_unref (canvas);
     chafa_canvas_config_unref (config);
-    return gs;
+    return canvas;
+}
+
+static gboolean
+canvas_has_geometry (ChafaCanvas *canvas, gint width, gint height)
+{
+    gint canvas_width, canvas_height;
+
+    chafa_canvas_config_get_geometry (chafa_canvas_peek_config (canvas),
+                                      &canvas_width, &canvas_height);
+    return canvas_width == width && canvas_height == height;
+}
+
+/* Kitty animation frames are stored in the terminal during the first loop,
+ * so later loops only have to place them. Within these limits, anyway;
+ * the terminal evicts old images when it runs out of space, and image IDs
+ * are shared with everything else running in it. */
+#define KITTY_STORED_FRAMES_MAX 1000
+#define KITTY_STORED_BYTES_MAX (128 * 1024 * 1024)
+#define KITTY_IMAGE_ID_MAX 9999
+
+typedef struct
+{
+    guint image_id;
+    gint dest_width, dest_height;
+}
+StoredFrame;
+
+static guint
+alloc_kitty_image_id (void)
+{
+    static guint next_id = 0;
+    guint id;
+
+    /* Start at a random ID to make collisions with other programs less likely */
+    if (next_id == 0)
+        next_id = g_random_int_range (1, KITTY_IMAGE_ID_MAX + 1);
+
+    id = next_id;
+    next_id = next_id % KITTY_IMAGE_ID_MAX + 1;
+    return id;
+}
+
+static gboolean
+can_store_kitty_frames (void)
+{
+    return options.pixel_mode == CHAFA_PIXEL_MODE_KITTY
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1)
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1)
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_PLACEMENTS_V1)
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_DELETE_KITTY_IMAGE_V1);
+}
+
+/* At the optimization levels that skip unchanged cells, Kitty animations
+ * are drawn into a single stored image instead, updating only the tiles
+ * that changed. That's much less output for mostly static content, but
+ * later loops can't be replayed from storage. */
+static gboolean
+can_update_kitty_frames (void)
+{
+    return options.pixel_mode == CHAFA_PIXEL_MODE_KITTY
+        && (options.optimizations & CHAFA_OPTIMIZATION_SKIP_CELLS)
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_STORE_IMAGE_V1)
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_PLACE_KITTY_IMAGE_V1)
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_UPDATE_IMAGE_V1);
+}
+
+/* Draws a frame into *canvas. The canvas that held the frame before is moved
+ * to *prev_canvas, so we can print only what changed. The one that was
+ * there before that is redrawn in place when the geometry allows, so frames
+ * recycle two canvases instead of allocating a new one each time. */
+static void
+draw_frame (ChafaPixelType pixel_type, const guint8 *pixels,
+            gint src_width, gint src_height, gint src_rowstride,
+            gint dest_width, gint dest_height,
+            gboolean is_animation,
+            ChafaCanvas **canvas, ChafaCanvas **prev_canvas)
+{
+    ChafaCanvas *recycled;
+
+    /* A reused palette lives in the canvas, so pixel frames must all be
+     * drawn into the same one. So must updates to a stored Kitty image.
+     * Pixel modes don't use prev_canvas. */
+    if (((options.reuse_palette && options.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS)
+         || (is_animation && can_update_kitty_frames ()))
+        && *canvas
+        && canvas_has_geometry (*canvas, dest_width, dest_height))
+    {
+        chafa_canvas_draw_all_pixels (*canvas, pixel_type, pixels, src_width, src_height, src_rowstride);
+        return;
+    }
+
+    recycled = *prev_canvas;
+    *prev_canvas = *canvas;
+
+    if (recycled && !canvas_has_geometry (recycled, dest_width, dest_height))
+    {
+        chafa_canvas_unref (recycled);
+        recycled = NULL;
+    }
+
+    if (!recycled)
+    {
+        recycled = create_canvas (dest_width, dest_height, is_animation);
+
+        if (is_animation && can_update_kitty_frames ())
+            chafa_canvas_set_image_id (recycled, alloc_kitty_image_id ());
+    }
+
+    chafa_canvas_draw_all_pixels (recycled, pixel_type, pixels, src_width, src_height, src_rowstride);
+    *canvas = recycled;
+}
+
+/* Frees the data of every stored frame except the one on screen, which
+ * would disappear along with it. */
+static void
+free_stored_frames (GArray *stored_frames, guint shown_image_id)
+{
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX];
+    guint i;
+
+    for (i = 0; i < stored_frames->len; i++)
+    {
+        StoredFrame *sf = &g_array_index (stored_frames, StoredFrame, i);
+        gchar *p0;
+
+        if (sf->image_id == shown_image_id)
+            continue;
+
+        p0 = chafa_term_info_emit_delete_kitty_image_v1 (options.term_info, buf, sf->image_id);
+        if (!write_to_stdout (buf, p0 - buf))
+            break;
+    }
+
+    g_array_free (stored_frames, TRUE);
+}
+
+/* Returns the canvas to print a delta against, or NULL for a full print.
+ * Symbol frames are compared to the previous canvas. Sixel frames with
+ * a reused palette and updated Kitty frames are all drawn into the same
+ * canvas, which remembers what it printed last. */
+static ChafaCanvas *
+get_delta_base (ChafaCanvas *canvas, ChafaCanvas *prev_canvas)
+{
+    if (!(options.optimizations & CHAFA_OPTIMIZATION_SKIP_CELLS))
+        return NULL;
+
+    if (options.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS)
+        return prev_canvas;
+
+    if (options.pixel_mode == CHAFA_PIXEL_MODE_SIXELS && options.reuse_palette)
+        return canvas;
+
+    if (can_update_kitty_frames ())
+        return canvas;
+
+    return NULL;
+}
+
+static gboolean
+print_frame (ChafaCanvas *canvas, ChafaCanvas *prev_canvas, gboolean allow_delta,
+             gint dest_width)
+{
+    ChafaCanvas *delta_base = allow_delta ? get_delta_base (canvas, prev_canvas) : NULL;
+    ImageWriter writer;
+    gboolean result;
+
+    image_writer_init (&writer, dest_width);
+
+    if (delta_base)
+    {
+        GString *gs;
+
+        /* Only emit what changed since the previous frame */
+        gs = chafa_canvas_print_delta (canvas, delta_base, options.term_info);
+        result = image_writer_write (gs->str, gs->len, &writer);
+        g_string_free (gs, TRUE);
+    }
+    else
+    {
+        /* Stream the output, so we can start writing before it's complete */
+        result = chafa_canvas_print_to_sink (canvas, options.term_info,
+                                             image_writer_write, &writer);
+    }
+
+    return result;
+}
+
+/* Like print_frame(), but for a frame the terminal already has */
+static gboolean
+place_stored_frame (const StoredFrame *stored_frame)
+{
+    ImageWriter writer;
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX];
+    gchar *p0;
+
+    image_writer_init (&writer, stored_frame->dest_width);
+
+    p0 = chafa_term_info_emit_place_kitty_image_v1 (options.term_info, buf,
+                                                    stored_frame->image_id,
+                                                    stored_frame->dest_width,
+                                                    stored_frame->dest_height);
+    return image_writer_write (buf, p0 - buf, &writer);
+}
+
+/* Must be called with the stats mutex held */
+static void
+collect_symbol_usage (ChafaCanvas *canvas)
+{
+    gunichar *symbols;
+    gint64 *n_picked, *n_candidate;
+    gint n, i;
+
+    if (!stats_totals.symbol_usage)
+        stats_totals.symbol_usage = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+                                                           NULL, g_free);
+
+    n = chafa_canvas_get_symbol_usage (canvas, &symbols, &n_picked, &n_candidate);
+
+    for (i = 0; i < n; i++)
+    {
+        SymbolUsage *usage = g_hash_table_lookup (stats_totals.symbol_usage,
+                                                  GUINT_TO_POINTER (symbols [i]));
+
+        if (!usage)
+        {
+            usage = g_new0 (SymbolUsage, 1);
+            usage->c = symbols [i];
+            g_hash_table_insert (stats_totals.symbol_usage, GUINT_TO_POINTER (symbols [i]), usage);
+        }
+
+        usage->n_picked += n_picked [i];
+        usage->n_candidate += n_candidate [i];
+    }
+
+    g_free (symbols);
+    g_free (n_picked);
+    g_free (n_candidate);
+}
+
+static void
+collect_stats (ChafaCanvas *canvas)
+{
+    static GMutex stats_mutex;
+    gint i;
+
+    /* Batched files are converted on several threads at once */
+    g_mutex_lock (&stats_mutex);
+
+    for (i = 0; i < CHAFA_CANVAS_STAGE_MAX; i++)
+    {
+        gint64 wall_us, cpu_us;
+
+        chafa_canvas_get_stage_time (canvas, i, &wall_us, &cpu_us);
+        stats_totals.stage_wall_us [i] += wall_us;
+        stats_totals.stage_cpu_us [i] += cpu_us;
+    }
+
+    for (i = 0; i < CHAFA_CANVAS_COUNTER_MAX; i++)
+    {
+        gint64 n = chafa_canvas_get_counter (canvas, i);
+
+        if (i == CHAFA_CANVAS_COUNTER_SCRATCH_BYTES_MAX)
+            stats_totals.counters [i] = MAX (stats_totals.counters [i], n);
+        else
+            stats_totals.counters [i] += n;
+    }
+
+    stats_totals.work_factor_sum += chafa_canvas_get_work_factor (canvas);
+    stats_totals.n_frames++;
+
+    if (options.prune_symbols > 0.0)
+        collect_symbol_usage (canvas);
+
+    g_mutex_unlock (&stats_mutex);
+
+    /* Canvases are recycled between frames */
+    chafa_canvas_reset_stats (canvas);
+}
+
+static gint
+compare_symbol_usage_picked (gconstpointer a, gconstpointer b)
+{
+    const SymbolUsage *a_usage = *(const SymbolUsage * const *) a;
+    const SymbolUsage *b_usage = *(const SymbolUsage * const *) b;
+
+    if (a_usage->n_picked != b_usage->n_picked)
+        return a_usage->n_picked > b_usage->n_picked ? -1 : 1;
+    if (a_usage->n_candidate != b_usage->n_candidate)
+        return a_usage->n_candidate > b_usage->n_candidate ? -1 : 1;
+    return a_usage->c < b_usage->c ? -1 : a_usage->c > b_usage->c ? 1 : 0;
+}
+
+static gint
+compare_code_points (gconstpointer a, gconstpointer b)
+{
+    gunichar a_c = *(const gunichar *) a;
+    gunichar b_c = *(const gunichar *) b;
+
+    return a_c < b_c ? -1 : a_c > b_c ? 1 : 0;
+}
+
+/* Keeps the most picked symbols until they account for the requested share
+ * of picks, and prints them as a selector with consecutive code points
+ * merged into ranges */
+static void
+print_pruned_symbols (void)
+{
+    GPtrArray *usages;
+    GArray *kept;
+    GString *selectors;
+    GHashTableIter iter;
+    gpointer value;
+    gint64 total_picked = 0, kept_picked = 0;
+    guint i, j;
+
+    if (!stats_totals.symbol_usage)
+        return;
+
+    usages = g_ptr_array_new ();
+    g_hash_table_iter_init (&iter, stats_totals.symbol_usage);
+    while (g_hash_table_iter_next (&iter, NULL, &value))
+    {
+        SymbolUsage *usage = value;
+
+        g_ptr_array_add (usages, usage);
+        total_picked += usage->n_picked;
+    }
+
+    g_ptr_array_sort (usages, compare_symbol_usage_picked);
+
+    g_printerr ("\n%-20s %12s %12s\n", "Symbol", "Picked", "Candidate");
+
+    kept = g_array_new (FALSE, FALSE, sizeof (gunichar));
+
+    for (i = 0; i < usages->len; i++)
+    {
+        SymbolUsage *usage = g_ptr_array_index (usages, i);
+        gchar name [16];
+
+        g_snprintf (name, sizeof (name), "U+%04X", usage->c);
+        g_printerr ("%-20s %12" G_GINT64_FORMAT " %12" G_GINT64_FORMAT "\n",
+                    name, usage->n_picked, usage->n_candidate);
+
+        if (usage->n_picked > 0
+            && kept_picked < total_picked * (options.prune_symbols / 100.0))
+        {
+            g_array_append_val (kept, usage->c);
+            kept_picked += usage->n_picked;
+        }
+    }
+
+    g_array_sort (kept, compare_code_points);
+
+    selectors = g_string_new ("");
+    for (i = 0; i < kept->len; i = j)
+    {
+        gunichar first = g_array_index (kept, gunichar, i);
+
+        for (j = i + 1;
+             j < kept->len && g_array_index (kept, gunichar, j) == first + (j - i);
+             j++)
+            ;
+
+        if (selectors->len > 0)
+            g_string_append_c (selectors, '+');
+
+        if (j - i > 1)
+            g_string_append_printf (selectors, "u%x..u%x", first,
+                                    g_array_index (kept, gunichar, j - 1));
+        else
+            g_string_append_printf (selectors, "u%x", first);
+    }
+
+    g_printerr ("\nKept %u of %u symbols, making up %.1f%% of %" G_GINT64_FORMAT " picks:\n"
+                "--symbols %s\n",
+                kept->len, usages->len,
+                total_picked > 0 ? kept_picked * 100.0 / total_picked : 0.0,
+                total_picked,
+                selectors->len > 0 ? selectors->str : "none");
+
+    g_string_free (selectors, TRUE);
+    g_array_free (kept, TRUE);
+    g_ptr_array_free (usages, TRUE);
+}
+
+static void
+print_stats (void)
+{
+    static const gchar * const stage_names [CHAFA_CANVAS_STAGE_MAX] =
+    {
+        "scale",
+        "prepare-pass-1",
+        "prepare-pass-2",
+        "update-cells",
+        "display-colors",
+        "pixel-canvas-draw",
+        "print"
+    };
+    static const gchar * const counter_names [CHAFA_CANVAS_COUNTER_MAX] =
+    {
+        "fast",
+        "slow",
+        "wide",
+        "fill",
+        "skipped",
+        "wide-gated",
+        "flat",
+        "repeated",
+        "kept",
+        "merged",
+        "rounded",
+        "scratch-bytes-max",
+        "cached"
+    };
+    gint i;
+
+    g_printerr ("Frames: %d\n", stats_totals.n_frames);
+    g_printerr ("Frames dropped: %d\n", stats_totals.n_frames_dropped);
+    g_printerr ("Frames late: %d\n", stats_totals.n_frames_late);
+    g_printerr ("Average work factor: %.2f\n\n",
+                stats_totals.n_frames > 0
+                ? stats_totals.work_factor_sum / stats_totals.n_frames : 0.0);
+    g_printerr ("%-20s %12s %12s\n", "Stage", "Wall ms", "CPU ms");
+
+    for (i = 0; i < CHAFA_CANVAS_STAGE_MAX; i++)
+    {
+        g_printerr ("%-20s %12.3f %12.3f\n", stage_names [i],
+                    stats_totals.stage_wall_us [i] / 1000.0,
+                    stats_totals.stage_cpu_us [i] / 1000.0);
+    }
+
+    g_printerr ("\n%-20s %12s\n", "Cells", "Count");
+
+    for (i = 0; i < CHAFA_CANVAS_COUNTER_MAX; i++)
+    {
+        g_printerr ("%-20s %12" G_GINT64_FORMAT "\n", counter_names [i],
+                    stats_totals.counters [i]);
+    }
+
+    if (options.prune_symbols > 0.0)
+        print_pruned_symbols ();
 }
 
 static void
@@ -1913,240 +2874,1658 @@ pixel_to_cell_dimensions (gdouble scale,
     }
 }
 
-typedef enum
+static void
+calc_dest_geometry (gint src_width, gint src_height, gint *dest_width_out, gint *dest_height_out)
 {
-    FILE_FAILED,
-    FILE_WAS_STILL,
-    FILE_WAS_ANIMATION
+    gint virt_src_width, virt_src_height;
+
+    /* Hack to work around the fact that chafa_calc_canvas_geometry() doesn't
+     * support arbitrary scaling. Instead, we manipulate the source size to
+     * achieve the desired effect. */
+    if (using_detected_size && options.scale < SCALE_MAX - 0.1)
+    {
+        pixel_to_cell_dimensions (options.scale,
+                                  options.cell_width, options.cell_height,
+                                  src_width, src_height,
+                                  &virt_src_width, &virt_src_height);
+    }
+    else
+    {
+        virt_src_width = src_width;
+        virt_src_height = src_height;
+    }
+
+    *dest_width_out = options.width;
+    *dest_height_out = options.height;
+
+    chafa_calc_canvas_geometry (virt_src_width,
+                                virt_src_height,
+                                dest_width_out,
+                                dest_height_out,
+                                options.font_ratio,
+                                options.scale >= SCALE_MAX - 0.1 ? TRUE : FALSE,
+                                options.stretch);
 }
-RunResult;
 
-static RunResult
-run_generic (const gchar *filename, gboolean is_first_file, gboolean is_first_frame, gboolean quiet)
+/* Gets the largest size in pixels an image can be drawn at, so loaders can
+ * avoid decoding more than that. Symbols are always drawn from 8x8 pixel
+ * cells. */
+static void
+calc_target_pixel_size (gint *width_out, gint *height_out)
 {
-    gboolean is_animation = FALSE;
-    gdouble anim_elapsed_s = 0.0;
-    GTimer *timer;
-    gint loop_n = 0;
-    MediaLoader *media_loader;
-    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX * 2 + 3];
-    GString *gs;
-    gchar *p0;
-    RunResult result = FILE_FAILED;
-    GError *error = NULL;
+    gint cell_width = 8, cell_height = 8;
+
+    if (options.pixel_mode != CHAFA_PIXEL_MODE_SYMBOLS
+        && options.cell_width > 0 && options.cell_height > 0)
+    {
+        cell_width = options.cell_width;
+        cell_height = options.cell_height;
+    }
+
+    *width_out = MAX (options.width, 0) * cell_width;
+    *height_out = MAX (options.height, 0) * cell_height;
+}
+
+/* Positions the cursor for a new frame */
+static gboolean
+begin_frame (gboolean is_first_file, gboolean is_first_frame, gint dest_height)
+{
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX * 3 + 3];
+    gchar *p0 = buf;
+
+    /* Have the terminal show the whole frame at once, instead of repainting
+     * partway through. Piped output is left alone. */
+    if (options.is_interactive
+        && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_BEGIN_SYNCHRONIZED_UPDATE))
+    {
+        p0 = chafa_term_info_emit_begin_synchronized_update (options.term_info, p0);
+        in_synchronized_update = TRUE;
+    }
+
+    if (options.clear)
+    {
+        if (is_first_frame)
+        {
+            /* Clear */
+            p0 = chafa_term_info_emit_clear (options.term_info, p0);
+        }
+
+        /* Home cursor between frames */
+        p0 = chafa_term_info_emit_cursor_to_top_left (options.term_info, p0);
+    }
+    else if (!is_first_frame)
+    {
+        /* Cursor to col 0 and up N steps */
+        *(p0++) = '\r';
+        p0 = chafa_term_info_emit_cursor_up (options.term_info, p0, dest_height - (options.have_parking_row ? 0 : 1));
+    }
+
+    /* Put a blank line between files in non-clear mode */
+    if (is_first_frame && !options.clear && !is_first_file)
+    {
+        if (!options.have_parking_row)
+            *(p0++) = '\n';
+        *(p0++) = '\n';
+    }
+
+    return write_to_stdout (buf, p0 - buf);
+}
+
+static gboolean
+end_frame (void)
+{
+    /* No linefeed after frame in sixel mode */
+    if (options.have_parking_row
+        && (options.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS
+            || options.pixel_mode == CHAFA_PIXEL_MODE_KITTY
+            || options.pixel_mode == CHAFA_PIXEL_MODE_ITERM2))
+    {
+        if (!write_to_stdout ("\n", 1))
+            return FALSE;
+    }
+    else if (options.center && options.pixel_mode == CHAFA_PIXEL_MODE_SIXELS)
+    {
+        /* If image was centered in sixel mode, cursor must be brought
+         * back to left margin manually */
+        if (!write_to_stdout ("\r", 1))
+            return FALSE;
+    }
+
+    if (!end_synchronized_update ())
+        return FALSE;
+
+    /* Don't wait for the terminal; the next frame can be prepared meanwhile */
+    return flush_stdout (FALSE);
+}
+
+typedef struct
+{
+    gboolean is_first_file, is_first_frame;
+    gint dest_width, dest_height;
+    gboolean failed;
+}
+RefineCtx;
+
+/* Prints each step of a progressive draw as a frame of its own. After the
+ * first, only the rows that were refined are printed. */
+static gboolean
+print_refined_frame (ChafaCanvas *canvas, ChafaCanvas *prev_canvas, RefineCtx *ctx)
+{
+    if (interrupted_by_user)
+        return FALSE;
+
+    if (!begin_frame (ctx->is_first_file, ctx->is_first_frame, ctx->dest_height)
+        || !print_frame (canvas, prev_canvas, prev_canvas != NULL, ctx->dest_width)
+        || !end_frame ())
+    {
+        ctx->failed = TRUE;
+        return FALSE;
+    }
+
+    ctx->is_first_frame = FALSE;
+    return TRUE;
+}
+
+/* Animation frames are decoded and converted ahead of time in a separate
+ * thread, so slow frames don't make us miss their presentation deadlines.
+ * The main thread only writes them out and keeps time. This many frames can
+ * be waiting to be shown. */
+#define PIPELINE_FRAMES_MAX 4
+
+typedef struct
+{
+    /* Output ready to be written, or NULL at the end of the stream or if
+     * the frame was dropped */
+    GString *gs;
+    gboolean dropped;
+    gint delay_ms;
+    gint dest_width, dest_height;
+    guint frame_n;
+}
+PipelineFrame;
+
+typedef struct
+{
+    MediaLoader *media_loader;
+    GThread *thread;
+    GMutex mutex;
+    GCond cond;
+    GQueue frames;
+    gboolean stop;
+
+    /* Monotonic time at which the first frame was shown, or 0 before then.
+     * Frame n is due at this plus the durations of the frames before it. */
+    gint64 clock_start_us;
+}
+FramePipeline;
+
+/* Returns how long a frame should stay on screen, in microseconds. Zero
+ * means the animation runs as fast as it can, and frames are never late. */
+static gint64
+get_frame_duration_us (gint delay_ms)
+{
+    gdouble duration_ms;
+
+    if (options.anim_fps > 0.0)
+        duration_ms = 1000.0 / options.anim_fps;
+    else
+        duration_ms = delay_ms;
+    duration_ms /= options.anim_speed_multiplier;
+
+    if (duration_ms <= 0.0001 || 1000.0 / duration_ms >= ANIM_FPS_MAX)
+        return 0;
+
+    return duration_ms * 1000.0;
+}
+
+static gint64
+frame_pipeline_get_clock_start (FramePipeline *pipeline)
+{
+    gint64 start_us;
+
+    g_mutex_lock (&pipeline->mutex);
+    start_us = pipeline->clock_start_us;
+    g_mutex_unlock (&pipeline->mutex);
+
+    return start_us;
+}
+
+static void
+pipeline_frame_free (PipelineFrame *frame)
+{
+    if (frame->gs)
+        g_string_free (frame->gs, TRUE);
+    g_free (frame);
+}
+
+/* Blocks while the queue is full. Returns FALSE if the pipeline was
+ * stopped instead, in which case the frame is not taken. */
+static gboolean
+frame_pipeline_push (FramePipeline *pipeline, PipelineFrame *frame)
+{
+    gboolean pushed = FALSE;
+
+    g_mutex_lock (&pipeline->mutex);
+
+    while (!pipeline->stop && pipeline->frames.length >= PIPELINE_FRAMES_MAX)
+        g_cond_wait (&pipeline->cond, &pipeline->mutex);
+
+    if (!pipeline->stop)
+    {
+        g_queue_push_tail (&pipeline->frames, frame);
+        g_cond_broadcast (&pipeline->cond);
+        pushed = TRUE;
+    }
+
+    g_mutex_unlock (&pipeline->mutex);
+    return pushed;
+}
+
+static PipelineFrame *
+frame_pipeline_pop (FramePipeline *pipeline)
+{
+    PipelineFrame *frame;
+
+    g_mutex_lock (&pipeline->mutex);
+
+    while (g_queue_is_empty (&pipeline->frames))
+        g_cond_wait (&pipeline->cond, &pipeline->mutex);
+
+    frame = g_queue_pop_head (&pipeline->frames);
+    g_cond_broadcast (&pipeline->cond);
+
+    g_mutex_unlock (&pipeline->mutex);
+    return frame;
+}
+
+/* Adds one of our own stages to the trace, if there is one */
+static void
+trace_stage (const gchar *name, gint64 start_us)
+{
+    chafa_add_trace_event (name, start_us, g_get_monotonic_time (), 0, -1);
+}
+
+static GString *
+build_frame_string (ChafaCanvas *canvas, ChafaCanvas *prev_canvas, gboolean allow_delta)
+{
+    ChafaCanvas *delta_base = allow_delta ? get_delta_base (canvas, prev_canvas) : NULL;
+
+    /* Only emit what changed since the previous frame */
+    if (delta_base)
+        return chafa_canvas_print_delta (canvas, delta_base, options.term_info);
+
+    return chafa_canvas_print (canvas, options.term_info);
+}
+
+static PipelineFrame *
+prepare_frame (MediaLoader *media_loader, guint frame_n, gboolean allow_delta,
+               ChafaCanvas **canvas, ChafaCanvas **prev_canvas)
+{
+    PipelineFrame *frame;
+    ChafaPixelType pixel_type;
+    gint src_width, src_height, src_rowstride;
+    const guint8 *pixels;
+    gint delay_ms;
+    gint64 start_us;
+
+    delay_ms = media_loader_get_frame_delay (media_loader);
+
+    start_us = g_get_monotonic_time ();
+    pixels = media_loader_get_frame_data (media_loader,
+                                          &pixel_type,
+                                          &src_width,
+                                          &src_height,
+                                          &src_rowstride);
+    trace_stage ("decode", start_us);
+    if (!pixels)
+        return NULL;
+
+    frame = g_new0 (PipelineFrame, 1);
+    frame->delay_ms = delay_ms;
+    frame->frame_n = frame_n;
+
+    calc_dest_geometry (src_width, src_height, &frame->dest_width, &frame->dest_height);
+
+    start_us = g_get_monotonic_time ();
+    draw_frame (pixel_type, pixels,
+                src_width, src_height, src_rowstride,
+                frame->dest_width, frame->dest_height,
+                TRUE,
+                canvas, prev_canvas);
+    trace_stage ("convert", start_us);
+
+    start_us = g_get_monotonic_time ();
+    frame->gs = build_frame_string (*canvas, *prev_canvas, allow_delta);
+    trace_stage ("build-output", start_us);
+
+    if (options.stats)
+        collect_stats (*canvas);
+
+    return frame;
+}
+
+/* Stands in for a frame that was too late to be worth converting. The
+ * loader has already moved past it. */
+static PipelineFrame *
+drop_frame (MediaLoader *media_loader, guint frame_n)
+{
+    PipelineFrame *frame;
+
+    frame = g_new0 (PipelineFrame, 1);
+    frame->dropped = TRUE;
+    frame->delay_ms = media_loader_get_frame_delay (media_loader);
+    frame->frame_n = frame_n;
+
+    return frame;
+}
+
+static PipelineFrame *
+pipeline_frame_copy (const PipelineFrame *frame)
+{
+    PipelineFrame *copy = g_memdup (frame, sizeof (*frame));
+
+    copy->gs = g_string_new_len (frame->gs->str, frame->gs->len);
+    return copy;
+}
+
+/* Steps the loader to frame_n, rewinding if it's already past it */
+static gboolean
+seek_frame (MediaLoader *media_loader, guint *loader_pos, guint frame_n)
+{
+    if (*loader_pos > frame_n)
+    {
+        media_loader_goto_first_frame (media_loader);
+        *loader_pos = 0;
+    }
+
+    while (*loader_pos < frame_n)
+    {
+        if (!media_loader_goto_next_frame (media_loader))
+            return FALSE;
+        (*loader_pos)++;
+    }
+
+    return TRUE;
+}
+
+/* Returns TRUE if a frame's time on screen would be over before we could
+ * convert it. Nothing is late until the first frame has been shown. */
+static gboolean
+frame_is_late (FramePipeline *pipeline, gint64 sched_end_us)
+{
+    gint64 start_us = frame_pipeline_get_clock_start (pipeline);
+
+    return start_us != 0 && g_get_monotonic_time () > start_us + sched_end_us;
+}
+
+/* Loops over the animation until stopped, or until a frame fails to
+ * decode. The canvases belong to this thread.
+ *
+ * Frames whose time has passed by the time we get to them are dropped
+ * without being converted, so playback keeps pace with the clock when
+ * conversion or output is slow. Since the dropped frames aren't printed
+ * either, the terminal still shows the frame we drew last, and the next
+ * one can be printed as a delta.
+ *
+ * Output from the first loop is kept in a cache, so later loops can skip
+ * the frames it holds. Playback is cyclic, so the cache is filled from the
+ * start until it's full and nothing is evicted; LRU would always throw out
+ * the frame needed next. Cached frames may be deltas against the frame
+ * before them, so the cache ends at the first dropped frame, and cached
+ * frames are never dropped. */
+static gpointer
+frame_pipeline_thread_func (FramePipeline *pipeline)
+{
+    ChafaCanvas *canvas = NULL;
+    ChafaCanvas *prev_canvas = NULL;
+    PipelineFrame *frame;
+    GPtrArray *cache;
+    gsize cache_bytes = 0;
+    gsize cache_max;
+    guint n_frames = 0;
+    guint loader_pos = 0;
+    gboolean drawn_is_shown = FALSE;
+    gint64 sched_us = 0;
+    guint frame_n;
+
+    /* Reused palettes are sent once and assumed to persist, which doesn't
+     * hold if cached output skips the frames that sent them */
+    cache_max = options.reuse_palette ? 0 : (gsize) options.frame_cache_mib * 1024 * 1024;
+    cache = g_ptr_array_new_with_free_func ((GDestroyNotify) pipeline_frame_free);
+
+    /* First loop: Figure out how many frames there are */
+
+    media_loader_goto_first_frame (pipeline->media_loader);
+
+    /* Leave half of each frame's time for scaling and output */
+    if (options.adaptive_work)
+        anim_time_budget_us = MIN (get_frame_duration_us (media_loader_get_frame_delay (pipeline->media_loader)) / 2,
+                                   G_MAXINT);
+
+    do
+    {
+        sched_us += get_frame_duration_us (media_loader_get_frame_delay (pipeline->media_loader));
+
+        if (frame_is_late (pipeline, sched_us))
+        {
+            frame = drop_frame (pipeline->media_loader, n_frames++);
+        }
+        else
+        {
+            frame = prepare_frame (pipeline->media_loader, n_frames, drawn_is_shown,
+                                   &canvas, &prev_canvas);
+            if (!frame)
+                goto out;
+            drawn_is_shown = TRUE;
+
+            if (cache->len == n_frames && cache_bytes + frame->gs->len <= cache_max)
+            {
+                g_ptr_array_add (cache, pipeline_frame_copy (frame));
+                cache_bytes += frame->gs->len;
+            }
+
+            n_frames++;
+        }
+
+        if (!frame_pipeline_push (pipeline, frame))
+        {
+            pipeline_frame_free (frame);
+            goto out;
+        }
+
+        loader_pos++;
+    }
+    while (!interrupted_by_user && media_loader_goto_next_frame (pipeline->media_loader));
+
+    /* Subsequent loops */
+
+    while (!interrupted_by_user)
+    {
+        for (frame_n = 0; frame_n < n_frames && !interrupted_by_user; frame_n++)
+        {
+            if (frame_n < cache->len)
+            {
+                frame = pipeline_frame_copy (g_ptr_array_index (cache, frame_n));
+                sched_us += get_frame_duration_us (frame->delay_ms);
+                drawn_is_shown = FALSE;
+            }
+            else
+            {
+                if (!seek_frame (pipeline->media_loader, &loader_pos, frame_n))
+                    goto out;
+
+                sched_us += get_frame_duration_us (media_loader_get_frame_delay (pipeline->media_loader));
+
+                if (frame_is_late (pipeline, sched_us))
+                {
+                    frame = drop_frame (pipeline->media_loader, frame_n);
+                }
+                else
+                {
+                    /* A delta is only valid against what the terminal shows */
+                    frame = prepare_frame (pipeline->media_loader, frame_n, drawn_is_shown,
+                                           &canvas, &prev_canvas);
+                    if (!frame)
+                        goto out;
+                    drawn_is_shown = TRUE;
+                }
+            }
+
+            if (!frame_pipeline_push (pipeline, frame))
+            {
+                pipeline_frame_free (frame);
+                goto out;
+            }
+        }
+    }
+
+out:
+    /* End of stream */
+    frame = g_new0 (PipelineFrame, 1);
+    if (!frame_pipeline_push (pipeline, frame))
+        pipeline_frame_free (frame);
+
+    g_ptr_array_free (cache, TRUE);
+
+    if (canvas)
+        chafa_canvas_unref (canvas);
+    if (prev_canvas)
+        chafa_canvas_unref (prev_canvas);
+
+    return NULL;
+}
+
+static void
+frame_pipeline_start (FramePipeline *pipeline, MediaLoader *media_loader)
+{
+    memset (pipeline, 0, sizeof (*pipeline));
+    pipeline->media_loader = media_loader;
+    g_mutex_init (&pipeline->mutex);
+    g_cond_init (&pipeline->cond);
+    g_queue_init (&pipeline->frames);
+
+    pipeline->thread = g_thread_new ("frame-pipeline",
+                                     (GThreadFunc) frame_pipeline_thread_func,
+                                     pipeline);
+}
+
+static void
+frame_pipeline_stop (FramePipeline *pipeline)
+{
+    g_mutex_lock (&pipeline->mutex);
+    pipeline->stop = TRUE;
+    g_cond_broadcast (&pipeline->cond);
+    g_mutex_unlock (&pipeline->mutex);
+
+    g_thread_join (pipeline->thread);
+
+    while (!g_queue_is_empty (&pipeline->frames))
+        pipeline_frame_free (g_queue_pop_head (&pipeline->frames));
+    g_cond_clear (&pipeline->cond);
+    g_mutex_clear (&pipeline->mutex);
+}
+
+/* Shows an animation with frames prepared by the pipeline. Each frame is
+ * due at a fixed time after the first one was shown, so frames that are
+ * slow to arrive or print don't push back the ones after them. Frames the
+ * pipeline dropped only advance the clock. */
+static void
+run_pipelined (MediaLoader *media_loader, gboolean is_first_file, gboolean is_first_frame)
+{
+    FramePipeline pipeline;
+    gint64 start_us = 0;
+    gint64 sched_us = 0;
+    gint loop_n = -1;
+
+    frame_pipeline_start (&pipeline, media_loader);
+
+    while (!interrupted_by_user)
+    {
+        PipelineFrame *frame;
+        ImageWriter writer;
+        gdouble anim_elapsed_s;
+        gint64 duration_us, now_us;
+        gboolean ok;
+
+        frame = frame_pipeline_pop (&pipeline);
+        if (!frame->gs && !frame->dropped)
+        {
+            pipeline_frame_free (frame);
+            break;
+        }
+
+        /* The first loop always plays in full */
+        anim_elapsed_s = start_us ? (g_get_monotonic_time () - start_us) / 1000000.0 : 0.0;
+        if (frame->frame_n == 0)
+            loop_n++;
+        if (loop_n > 0
+            && (anim_elapsed_s >= options.file_duration_s
+                || (frame->frame_n == 0 && options.watch)))
+        {
+            pipeline_frame_free (frame);
+            break;
+        }
+
+        duration_us = get_frame_duration_us (frame->delay_ms);
+
+        if (frame->dropped)
+        {
+            stats_totals.n_frames_dropped++;
+            sched_us += duration_us;
+            pipeline_frame_free (frame);
+            continue;
+        }
+
+        image_writer_init (&writer, frame->dest_width);
+
+        now_us = g_get_monotonic_time ();
+        ok = begin_frame (is_first_file, is_first_frame, frame->dest_height)
+            && image_writer_write (frame->gs->str, frame->gs->len, &writer)
+            && end_frame ();
+        trace_stage ("output", now_us);
+
+        pipeline_frame_free (frame);
+        if (!ok)
+            break;
+
+        now_us = g_get_monotonic_time ();
+
+        if (!start_us)
+        {
+            start_us = now_us;
+
+            g_mutex_lock (&pipeline.mutex);
+            pipeline.clock_start_us = start_us;
+            g_mutex_unlock (&pipeline.mutex);
+        }
+        else if (duration_us > 0 && now_us > start_us + sched_us + duration_us)
+        {
+            /* Shown after its time was already up */
+            stats_totals.n_frames_late++;
+        }
+
+        sched_us += duration_us;
+        if (start_us + sched_us > now_us)
+            interruptible_usleep ((gint) (start_us + sched_us - now_us));
+
+        is_first_frame = FALSE;
+    }
+
+    frame_pipeline_stop (&pipeline);
+}
+
+typedef enum
+{
+    FILE_FAILED,
+    FILE_WAS_STILL,
+    FILE_WAS_ANIMATION
+}
+RunResult;
+
+/* The last still image shown, kept when it may need to be drawn again at
+ * a new size after the terminal is resized. Decoding can be much slower
+ * than drawing, e.g. for vector graphics. */
+typedef struct
+{
+    gchar *filename;
+    ChafaPixelType pixel_type;
+    guint8 *pixels;
+    gint width, height, rowstride;
+    gint dest_height;
+}
+CachedFrame;
+
+static CachedFrame cached_frame;
+
+static gboolean
+want_cached_frame (void)
+{
+    return using_detected_size && !options.serve_path
+        && (options.watch || options.file_duration_s != G_MAXDOUBLE);
+}
+
+static gsize
+get_frame_data_size (ChafaPixelType pixel_type, gint height, gint rowstride)
+{
+    gsize size = (gsize) rowstride * height;
+
+    /* See ChafaPixelType for the plane layouts */
+    if (pixel_type == CHAFA_PIXEL_I420)
+        size += (gsize) (rowstride / 2) * ((height + 1) / 2) * 2;
+    else if (pixel_type == CHAFA_PIXEL_NV12)
+        size += (gsize) rowstride * ((height + 1) / 2);
+
+    return size;
+}
+
+static void
+clear_cached_frame (void)
+{
+    g_free (cached_frame.filename);
+    g_free (cached_frame.pixels);
+    memset (&cached_frame, 0, sizeof (cached_frame));
+}
+
+static void
+cache_frame (const gchar *filename, ChafaPixelType pixel_type, const guint8 *pixels,
+             gint width, gint height, gint rowstride, gint dest_height)
+{
+    clear_cached_frame ();
+
+    cached_frame.filename = g_strdup (filename);
+    cached_frame.pixel_type = pixel_type;
+    cached_frame.pixels = g_memdup (pixels, get_frame_data_size (pixel_type, height, rowstride));
+    cached_frame.width = width;
+    cached_frame.height = height;
+    cached_frame.rowstride = rowstride;
+    cached_frame.dest_height = dest_height;
+}
+
+/* Picks up the new terminal size after a SIGWINCH. Returns TRUE if the
+ * geometry changed. */
+static gboolean
+update_tty_geometry (void)
+{
+    TermSize term_size;
+
+    terminal_resized = FALSE;
+
+    if (!using_detected_size || options.serve_path)
+        return FALSE;
+
+    get_tty_size (&term_size);
+
+    if (term_size.width_cells <= 0 || term_size.height_cells <= 0
+        || (term_size.width_cells == detected_term_size.width_cells
+            && term_size.height_cells == detected_term_size.height_cells))
+        return FALSE;
+
+    detected_term_size = term_size;
+    options.width = MAX (term_size.width_cells - options.margin_right, 1);
+    options.height = MAX (term_size.height_cells - options.margin_bottom, 1);
+    return TRUE;
+}
+
+/* Draws the cached frame over the previous one, at the current size */
+static gboolean
+redraw_cached_frame (const gchar *filename)
+{
+    ChafaCanvas *canvas = NULL;
+    ChafaCanvas *prev_canvas = NULL;
+    gint dest_width, dest_height;
+    gboolean result;
+
+    if (!cached_frame.pixels || strcmp (filename, cached_frame.filename))
+        return FALSE;
+
+    calc_dest_geometry (cached_frame.width, cached_frame.height, &dest_width, &dest_height);
+    draw_frame (cached_frame.pixel_type, cached_frame.pixels,
+                cached_frame.width, cached_frame.height, cached_frame.rowstride,
+                dest_width, dest_height,
+                FALSE,
+                &canvas, &prev_canvas);
+
+    /* The cursor is still where the previous frame left it */
+    result = begin_frame (TRUE, FALSE, cached_frame.dest_height)
+        && print_frame (canvas, NULL, FALSE, dest_width)
+        && end_frame ();
+
+    cached_frame.dest_height = dest_height;
+
+    chafa_canvas_unref (canvas);
+    if (prev_canvas)
+        chafa_canvas_unref (prev_canvas);
+
+    return result;
+}
+
+static RunResult
+run_generic (const gchar *filename, gboolean is_first_file, gboolean is_first_frame, gboolean quiet)
+{
+    gboolean is_animation = FALSE;
+    gboolean progressive, streamed, from_rows;
+    gdouble anim_elapsed_s = 0.0;
+    gint64 clock_start_us = 0;
+    gint64 sched_us = 0;
+    gint loop_n = 0;
+    MediaLoader *media_loader;
+    gint target_width, target_height;
+    ChafaCanvas *canvas = NULL;
+    ChafaCanvas *prev_canvas = NULL;
+    GArray *stored_frames = NULL;
+    gsize stored_bytes = 0;
+    guint shown_image_id = 0;
+    gchar buf [CHAFA_TERM_SEQ_LENGTH_MAX * 2 + 3];
+    gchar *p0;
+    RunResult result = FILE_FAILED;
+    gint64 start_us;
+    GError *error = NULL;
+
+    calc_target_pixel_size (&target_width, &target_height);
+
+    start_us = g_get_monotonic_time ();
+    media_loader = media_loader_new (filename, target_width, target_height, &error);
+    trace_stage ("open", start_us);
+    if (!media_loader)
+    {
+        if (!quiet)
+            g_printerr ("%s: Failed to open '%s': %s\n",
+                        options.executable_name,
+                        filename,
+                        error->message);
+        goto out;
+    }
+
+    if (interrupted_by_user)
+        goto out;
+
+    /* A fixed --fps doesn't follow the file's clock, so frames can't be late */
+    media_loader_set_playback_speed (media_loader,
+                                     options.anim_fps > 0.0 ? 0.0 : options.anim_speed_multiplier);
+
+    is_animation = options.animate ? media_loader_get_is_animation (media_loader) : FALSE;
+    result = is_animation ? FILE_WAS_ANIMATION : FILE_WAS_STILL;
+    progressive = options.progressive && !is_animation
+        && options.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS;
+
+    /* Sixel stills are encoded and written a few bands at a time, so
+     * huge images don't have to be held in memory all at once */
+    streamed = !is_animation && options.pixel_mode == CHAFA_PIXEL_MODE_SIXELS;
+
+    /* Huge stills that the loader can hand over a row at a time are scaled
+     * down as they're decoded. This takes precedence over streaming, since
+     * the scaled image is small. */
+    from_rows = !is_animation && !progressive && !want_cached_frame ()
+        && media_loader_get_frame_rows (media_loader, NULL, NULL, NULL);
+    if (from_rows)
+        streamed = FALSE;
+
+    if (is_animation && can_store_kitty_frames () && !can_update_kitty_frames ())
+        stored_frames = g_array_new (FALSE, FALSE, sizeof (StoredFrame));
+
+    /* Stored Kitty frames are cheap to replay, and need the sequential path
+     * to keep track of them */
+    if (is_animation && !stored_frames)
+    {
+        run_pipelined (media_loader, is_first_file, is_first_frame);
+        goto out;
+    }
+
+    do
+    {
+        gboolean have_frame;
+        guint frame_n = 0;
+
+        /* Outer loop repeats animation if desired */
+
+        media_loader_goto_first_frame (media_loader);
+
+        for (have_frame = TRUE;
+             have_frame && !interrupted_by_user && (loop_n == 0 || anim_elapsed_s < options.file_duration_s);
+             have_frame = media_loader_goto_next_frame (media_loader), frame_n++)
+        {
+            gint delay_ms;
+            ChafaPixelType pixel_type;
+            gint src_width, src_height, src_rowstride;
+            gint dest_width, dest_height;
+            const guint8 *pixels;
+            StoredFrame *stored_frame = NULL;
+            guint image_id = 0;
+
+            delay_ms = media_loader_get_frame_delay (media_loader);
+
+            /* The terminal already has this frame; skip straight to output */
+            if (stored_frames && loop_n > 0 && frame_n < stored_frames->len)
+            {
+                stored_frame = &g_array_index (stored_frames, StoredFrame, frame_n);
+                dest_width = stored_frame->dest_width;
+                dest_height = stored_frame->dest_height;
+                image_id = stored_frame->image_id;
+            }
+            else if (from_rows)
+            {
+                media_loader_get_frame_rows (media_loader, &pixel_type, &src_width, &src_height);
+                calc_dest_geometry (src_width, src_height, &dest_width, &dest_height);
+
+                if (canvas)
+                    chafa_canvas_unref (canvas);
+                canvas = create_canvas (dest_width, dest_height, FALSE);
+
+                chafa_canvas_draw_all_pixels_from_rows (canvas, pixel_type, src_width, src_height,
+                                                        (ChafaCanvasRowFunc) media_loader_read_frame_row,
+                                                        media_loader);
+            }
+            else
+            {
+                start_us = g_get_monotonic_time ();
+                pixels = media_loader_get_frame_data (media_loader,
+                                                      &pixel_type,
+                                                      &src_width,
+                                                      &src_height,
+                                                      &src_rowstride);
+                trace_stage ("decode", start_us);
+                /* FIXME: This shouldn't happen -- but if it does, our
+                 * options for handling it gracefully here aren't great.
+                 * Needs refactoring. */
+                if (!pixels)
+                    break;
+
+                calc_dest_geometry (src_width, src_height, &dest_width, &dest_height);
+
+                if (progressive)
+                {
+                    RefineCtx refine_ctx;
+
+                    /* Stills are printed as they're refined */
+                    if (canvas)
+                        chafa_canvas_unref (canvas);
+                    canvas = create_canvas (dest_width, dest_height, FALSE);
+
+                    refine_ctx.is_first_file = is_first_file;
+                    refine_ctx.is_first_frame = is_first_frame;
+                    refine_ctx.dest_width = dest_width;
+                    refine_ctx.dest_height = dest_height;
+                    refine_ctx.failed = FALSE;
+
+                    chafa_canvas_draw_all_pixels_progressive (canvas, pixel_type, pixels,
+                                                              src_width, src_height, src_rowstride,
+                                                              (ChafaCanvasRefineFunc) print_refined_frame,
+                                                              &refine_ctx);
+                    if (refine_ctx.failed)
+                        goto out;
+                }
+                else if (streamed)
+                {
+                    ImageWriter writer;
+
+                    if (canvas)
+                        chafa_canvas_unref (canvas);
+                    canvas = create_canvas (dest_width, dest_height, FALSE);
+
+                    if (!begin_frame (is_first_file, is_first_frame, dest_height))
+                        goto out;
+
+                    image_writer_init (&writer, dest_width);
+                    if (!chafa_canvas_draw_and_print_to_sink (canvas, options.term_info,
+                                                              pixel_type, pixels,
+                                                              src_width, src_height, src_rowstride,
+                                                              image_writer_write, &writer))
+                        goto out;
+                }
+                else
+                {
+                    start_us = g_get_monotonic_time ();
+                    draw_frame (pixel_type, pixels,
+                                src_width, src_height, src_rowstride,
+                                dest_width, dest_height,
+                                is_animation,
+                                &canvas, &prev_canvas);
+                    trace_stage ("convert", start_us);
+                }
+
+                if (stored_frames && loop_n == 0
+                    && stored_frames->len < KITTY_STORED_FRAMES_MAX
+                    && stored_bytes < KITTY_STORED_BYTES_MAX)
+                {
+                    StoredFrame sf;
+
+                    sf.image_id = alloc_kitty_image_id ();
+                    sf.dest_width = dest_width;
+                    sf.dest_height = dest_height;
+                    g_array_append_val (stored_frames, sf);
+
+                    image_id = sf.image_id;
+                    stored_bytes += (gsize) dest_width * options.cell_width
+                        * dest_height * options.cell_height * sizeof (guint32);
+                }
+
+                chafa_canvas_set_image_id (canvas, image_id);
+
+                if (!is_animation && want_cached_frame ())
+                    cache_frame (filename, pixel_type, pixels,
+                                 src_width, src_height, src_rowstride, dest_height);
+            }
+
+            /* Progressive and streamed stills were printed as they were drawn */
+            if (!progressive && !streamed)
+            {
+                if (!begin_frame (is_first_file, is_first_frame, dest_height))
+                    goto out;
+
+                if (stored_frame)
+                {
+                    if (!place_stored_frame (stored_frame))
+                        goto out;
+                }
+                else
+                {
+                    start_us = g_get_monotonic_time ();
+                    if (!print_frame (canvas, prev_canvas, is_animation, dest_width))
+                        goto out;
+                    trace_stage ("output", start_us);
+                }
+            }
+
+            /* Stored frames stay on screen until removed, and there's no
+             * point in stacking them */
+            if (stored_frames)
+            {
+                if (shown_image_id != 0 && shown_image_id != image_id)
+                {
+                    p0 = chafa_term_info_emit_delete_kitty_image_placements_v1 (options.term_info, buf,
+                                                                                shown_image_id);
+                    if (!write_to_stdout (buf, p0 - buf))
+                        goto out;
+                }
+
+                shown_image_id = image_id;
+            }
+
+            if (options.stats && !stored_frame)
+                collect_stats (canvas);
+
+            if (!progressive && !end_frame ())
+                goto out;
+
+            if (is_animation)
+            {
+                gint64 duration_us = get_frame_duration_us (delay_ms);
+                gint64 now_us = g_get_monotonic_time ();
+
+                /* Keep to the same clock as run_pipelined (). Stored frames
+                 * can't be dropped, but they're cheap to show again. */
+                if (!clock_start_us)
+                    clock_start_us = now_us;
+                else if (duration_us > 0 && now_us > clock_start_us + sched_us + duration_us)
+                    stats_totals.n_frames_late++;
+
+                sched_us += duration_us;
+                if (clock_start_us + sched_us > now_us)
+                    interruptible_usleep ((gint) (clock_start_us + sched_us - now_us));
+
+                anim_elapsed_s = (g_get_monotonic_time () - clock_start_us) / 1000000.0;
+            }
+
+            is_first_frame = FALSE;
+
+            if (!is_animation)
+                break;
+        }
+
+        loop_n++;
+    }
+    while (is_animation && !interrupted_by_user
+           && !options.watch && anim_elapsed_s < options.file_duration_s);
+
+out:
+    if (stored_frames)
+        free_stored_frames (stored_frames, shown_image_id);
+    if (canvas)
+        chafa_canvas_unref (canvas);
+    if (prev_canvas)
+        chafa_canvas_unref (prev_canvas);
+    if (media_loader)
+        media_loader_destroy (media_loader);
+
+    if (error)
+        g_error_free (error);
+
+    return result;
+}
+
+/* Kitty takes at most 4096 bytes of base64 per chunk */
+#define PASSTHROUGH_KITTY_CHUNK_SIZE (3 * 1024)
+
+/* Pass on output after encoding this many bytes of the file */
+#define PASSTHROUGH_BYTES_PER_FLUSH (3 * 16384)
+
+static void
+append_base64 (GString *gs, const guint8 *data, gsize len, gint *state, gint *save)
+{
+    gsize old_len = gs->len;
+    gsize n;
+
+    g_string_set_size (gs, old_len + (len / 3 + 1) * 4 + 4);
+    n = g_base64_encode_step (data, len, FALSE, gs->str + old_len, state, save);
+    g_string_set_size (gs, old_len + n);
+}
+
+static void
+append_base64_close (GString *gs, gint *state, gint *save)
+{
+    gsize old_len = gs->len;
+    gsize n;
+
+    g_string_set_size (gs, old_len + 4);
+    n = g_base64_encode_close (FALSE, gs->str + old_len, state, save);
+    g_string_set_size (gs, old_len + n);
+}
+
+static gboolean
+print_passthrough (const guint8 *data, gsize data_len,
+                   gint src_width, gint src_height,
+                   gint dest_width, gint dest_height)
+{
+    ImageWriter writer;
+    GString *gs;
+    gchar seq [CHAFA_TERM_SEQ_LENGTH_MAX + 1];
+    const guint8 *p, *last = data + data_len;
+    gint state = 0, save = 0;
+    gboolean result = TRUE;
+
+    image_writer_init (&writer, dest_width);
+    gs = g_string_sized_new (PASSTHROUGH_BYTES_PER_FLUSH * 2);
+
+    if (options.pixel_mode == CHAFA_PIXEL_MODE_KITTY)
+        *chafa_term_info_emit_begin_kitty_immediate_image_v1 (options.term_info, seq,
+                                                              100,  /* PNG */
+                                                              src_width, src_height,
+                                                              dest_width, dest_height) = '\0';
+    else
+        *chafa_term_info_emit_begin_iterm2_image (options.term_info, seq,
+                                                  dest_width, dest_height) = '\0';
+    g_string_append (gs, seq);
+
+    for (p = data; p < last && result; )
+    {
+        const guint8 *end;
+
+        if (options.pixel_mode == CHAFA_PIXEL_MODE_KITTY)
+        {
+            end = p + MIN (last - p, PASSTHROUGH_KITTY_CHUNK_SIZE);
+
+            *chafa_term_info_emit_begin_kitty_image_chunk (options.term_info, seq) = '\0';
+            g_string_append (gs, seq);
+            append_base64 (gs, p, end - p, &state, &save);
+            append_base64_close (gs, &state, &save);
+            *chafa_term_info_emit_end_kitty_image_chunk (options.term_info, seq) = '\0';
+            g_string_append (gs, seq);
+        }
+        else
+        {
+            end = p + MIN (last - p, PASSTHROUGH_BYTES_PER_FLUSH);
+            append_base64 (gs, p, end - p, &state, &save);
+        }
+
+        if (gs->len >= PASSTHROUGH_BYTES_PER_FLUSH)
+        {
+            result = image_writer_write (gs->str, gs->len, &writer);
+            g_string_truncate (gs, 0);
+        }
+
+        p = end;
+    }
+
+    if (options.pixel_mode == CHAFA_PIXEL_MODE_KITTY)
+    {
+        *chafa_term_info_emit_end_kitty_image (options.term_info, seq) = '\0';
+    }
+    else
+    {
+        append_base64_close (gs, &state, &save);
+        *chafa_term_info_emit_end_iterm2_image (options.term_info, seq) = '\0';
+    }
+    g_string_append (gs, seq);
+
+    result = result && image_writer_write (gs->str, gs->len, &writer);
+    g_string_free (gs, TRUE);
+    return result;
+}
+
+/* Checks whether the file can be sent as-is for the terminal to decode and
+ * scale. That's when it's in a format the terminal understands and we
+ * wouldn't be making it any smaller. */
+static gboolean
+can_pass_through (const gchar *filename, FileMapping *mapping,
+                  gint *src_width, gint *src_height,
+                  gint *dest_width, gint *dest_height)
+{
+    PassthroughFormat format;
+
+    /* Stdin can only be read once, so it must go to the regular loaders */
+    if (!options.pass_original
+        || !strcmp (filename, "-")
+        || options.cell_width < 1 || options.cell_height < 1)
+        return FALSE;
+
+    if (!(options.pixel_mode == CHAFA_PIXEL_MODE_KITTY
+          && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_BEGIN_KITTY_IMMEDIATE_IMAGE_V1))
+        && !(options.pixel_mode == CHAFA_PIXEL_MODE_ITERM2
+             && chafa_term_info_have_seq (options.term_info, CHAFA_TERM_SEQ_BEGIN_ITERM2_IMAGE)))
+        return FALSE;
+
+    if (!file_mapping_open_now (mapping, NULL))
+        return FALSE;
+
+    format = passthrough_probe (mapping, src_width, src_height);
+
+    /* Kitty only decodes PNG */
+    if (format == PASSTHROUGH_FORMAT_NONE
+        || (format != PASSTHROUGH_FORMAT_PNG && options.pixel_mode == CHAFA_PIXEL_MODE_KITTY))
+        return FALSE;
+
+    calc_dest_geometry (*src_width, *src_height, dest_width, dest_height);
+
+    /* Allow for rounding to whole cells */
+    if (*src_width > (*dest_width + 1) * options.cell_width
+        || *src_height > (*dest_height + 1) * options.cell_height)
+        return FALSE;
+
+    return TRUE;
+}
+
+/* Sends the file as-is if possible. This skips decoding entirely. Returns
+ * FALSE if the file must take the regular path. */
+static gboolean
+try_passthrough (const gchar *filename, gboolean is_first_file, gboolean is_first_frame,
+                 RunResult *result_out)
+{
+    FileMapping *mapping;
+    gint src_width, src_height;
+    gint dest_width, dest_height;
+    gconstpointer data;
+    gsize data_len;
+    gboolean handled = FALSE;
+
+    mapping = file_mapping_new (filename);
+
+    if (!can_pass_through (filename, mapping,
+                           &src_width, &src_height,
+                           &dest_width, &dest_height))
+        goto out;
+
+    data = file_mapping_get_data (mapping, &data_len);
+    if (!data)
+        goto out;
+
+    handled = TRUE;
+    *result_out = FILE_WAS_STILL;
+
+    if (begin_frame (is_first_file, is_first_frame, dest_height))
+    {
+        if (print_passthrough (data, data_len, src_width, src_height, dest_width, dest_height))
+            end_frame ();
+    }
+
+out:
+    file_mapping_destroy (mapping);
+    return handled;
+}
+
+static RunResult
+run (const gchar *filename, gboolean is_first_file, gboolean is_first_frame, gboolean quiet)
+{
+    RunResult result;
+
+    if (try_passthrough (filename, is_first_file, is_first_frame, &result))
+        return result;
+
+    return run_generic (filename, is_first_file, is_first_frame, quiet);
+}
+
+/* When showing several files, still images are decoded and converted on a
+ * worker pool while earlier ones are being written out. Output is still
+ * written strictly in the order the files were given. Anything that needs
+ * more than a single prepared frame -- animations, pass-through, stdin and
+ * failures -- is left for run () to handle when its turn comes.
+ *
+ * Workers stay at most this many batches ahead of the output. */
+#define BATCH_LOOKAHEAD 2
+
+typedef struct
+{
+    const gchar *filename;
+
+    /* Output ready to be written, or NULL if run () must take the file */
+    GString *gs;
+    gint dest_width, dest_height;
+    gboolean is_ready;
+}
+BatchItem;
+
+typedef struct
+{
+    GThreadPool *pool;
+    GMutex mutex;
+    GCond cond;
+    BatchItem *items;
+    gint n_items;
+    gint n_queued;
+}
+Batch;
+
+static GString *
+prepare_still (const gchar *filename, gint *dest_width, gint *dest_height)
+{
+    FileMapping *mapping;
+    MediaLoader *media_loader;
+    gint target_width, target_height;
+    gint src_width, src_height, src_rowstride;
+    ChafaPixelType pixel_type;
+    const guint8 *pixels;
+    GString *gs = NULL;
+    gboolean pass_through;
+    gint64 start_us;
+
+    if (!strcmp (filename, "-"))
+        return NULL;
+
+    mapping = file_mapping_new (filename);
+    pass_through = can_pass_through (filename, mapping,
+                                     &src_width, &src_height,
+                                     dest_width, dest_height);
+    file_mapping_destroy (mapping);
+    if (pass_through)
+        return NULL;
+
+    calc_target_pixel_size (&target_width, &target_height);
+
+    start_us = g_get_monotonic_time ();
+    media_loader = media_loader_new (filename, target_width, target_height, NULL);
+    trace_stage ("open", start_us);
+    if (!media_loader)
+        return NULL;
+
+    if (options.animate && media_loader_get_is_animation (media_loader))
+        goto out;
+
+    start_us = g_get_monotonic_time ();
+    pixels = media_loader_get_frame_data (media_loader,
+                                          &pixel_type,
+                                          &src_width,
+                                          &src_height,
+                                          &src_rowstride);
+    trace_stage ("decode", start_us);
+    if (pixels)
+    {
+        ChafaCanvas *canvas;
+
+        calc_dest_geometry (src_width, src_height, dest_width, dest_height);
+
+        start_us = g_get_monotonic_time ();
+        canvas = create_canvas (*dest_width, *dest_height, FALSE);
+        chafa_canvas_draw_all_pixels (canvas, pixel_type, pixels,
+                                      src_width, src_height, src_rowstride);
+        trace_stage ("convert", start_us);
+
+        start_us = g_get_monotonic_time ();
+        gs = chafa_canvas_print (canvas, options.term_info);
+        trace_stage ("build-output", start_us);
+
+        if (options.stats)
+            collect_stats (canvas);
+
+        chafa_canvas_unref (canvas);
+    }
+
+out:
+    media_loader_destroy (media_loader);
+    return gs;
+}
+
+static void
+batch_worker (BatchItem *item, Batch *batch)
+{
+    GString *gs = NULL;
+    gint dest_width = 0, dest_height = 0;
+
+    if (!interrupted_by_user)
+        gs = prepare_still (item->filename, &dest_width, &dest_height);
+
+    g_mutex_lock (&batch->mutex);
+    item->gs = gs;
+    item->dest_width = dest_width;
+    item->dest_height = dest_height;
+    item->is_ready = TRUE;
+    g_cond_broadcast (&batch->cond);
+    g_mutex_unlock (&batch->mutex);
+}
+
+static void
+batch_init (Batch *batch, GList *filenames, gint n_threads)
+{
+    GList *l;
+    gint i;
 
-    timer = g_timer_new ();
+    g_mutex_init (&batch->mutex);
+    g_cond_init (&batch->cond);
 
-    media_loader = media_loader_new (filename, &error);
-    if (!media_loader)
-    {
-        if (!quiet)
-            g_printerr ("%s: Failed to open '%s': %s\n",
-                        options.executable_name,
-                        filename,
-                        error->message);
-        goto out;
-    }
+    batch->n_items = g_list_length (filenames);
+    batch->items = g_new0 (BatchItem, batch->n_items);
+    batch->n_queued = 0;
 
-    if (interrupted_by_user)
-        goto out;
+    for (l = filenames, i = 0; l; l = g_list_next (l), i++)
+        batch->items [i].filename = l->data;
 
-    is_animation = options.animate ? media_loader_get_is_animation (media_loader) : FALSE;
-    result = is_animation ? FILE_WAS_ANIMATION : FILE_WAS_STILL;
+    batch->pool = g_thread_pool_new ((GFunc) batch_worker, batch,
+                                     n_threads, FALSE, NULL);
+}
 
-    do
-    {
-        gboolean have_frame;
+static void
+batch_deinit (Batch *batch)
+{
+    gint i;
 
-        /* Outer loop repeats animation if desired */
+    /* Drop anything that hasn't started yet */
+    g_thread_pool_free (batch->pool, TRUE, TRUE);
 
-        media_loader_goto_first_frame (media_loader);
+    for (i = 0; i < batch->n_items; i++)
+    {
+        if (batch->items [i].gs)
+            g_string_free (batch->items [i].gs, TRUE);
+    }
 
-        for (have_frame = TRUE;
-             have_frame && !interrupted_by_user && (loop_n == 0 || anim_elapsed_s < options.file_duration_s);
-             have_frame = media_loader_goto_next_frame (media_loader))
-        {
-            gdouble elapsed_ms, remain_ms;
-            gint delay_ms;
-            ChafaPixelType pixel_type;
-            gint src_width, src_height, src_rowstride;
-            gint virt_src_width, virt_src_height;
-            gint dest_width, dest_height;
-            const guint8 *pixels;
+    g_free (batch->items);
+    g_cond_clear (&batch->cond);
+    g_mutex_clear (&batch->mutex);
+}
 
-            g_timer_start (timer);
-
-            pixels = media_loader_get_frame_data (media_loader,
-                                                  &pixel_type,
-                                                  &src_width,
-                                                  &src_height,
-                                                  &src_rowstride);
-            /* FIXME: This shouldn't happen -- but if it does, our
-             * options for handling it gracefully here aren't great.
-             * Needs refactoring. */
-            if (!pixels)
-                break;
+static RunResult
+batch_run (Batch *batch, gint index, gboolean is_first_file)
+{
+    BatchItem *item = &batch->items [index];
+    gint n_ahead = BATCH_LOOKAHEAD * g_thread_pool_get_max_threads (batch->pool);
+    ImageWriter writer;
 
-            delay_ms = media_loader_get_frame_delay (media_loader);
+    while (batch->n_queued < batch->n_items && batch->n_queued <= index + n_ahead)
+    {
+        g_thread_pool_push (batch->pool, &batch->items [batch->n_queued], NULL);
+        batch->n_queued++;
+    }
 
-            /* Hack to work around the fact that chafa_calc_canvas_geometry() doesn't
-             * support arbitrary scaling. Instead, we manipulate the source size to
-             * achieve the desired effect. */
-            if (using_detected_size && options.scale < SCALE_MAX - 0.1)
-            {
-                pixel_to_cell_dimensions (options.scale,
-                                          options.cell_width, options.cell_height,
-                                          src_width, src_height,
-                                          &virt_src_width, &virt_src_height);
-            }
-            else
-            {
-                virt_src_width = src_width;
-                virt_src_height = src_height;
-            }
+    g_mutex_lock (&batch->mutex);
+    while (!item->is_ready)
+        g_cond_wait (&batch->cond, &batch->mutex);
+    g_mutex_unlock (&batch->mutex);
 
-            dest_width = options.width;
-            dest_height = options.height;
+    if (!item->gs)
+        return run (item->filename, is_first_file, TRUE, FALSE);
 
-            chafa_calc_canvas_geometry (virt_src_width,
-                                        virt_src_height,
-                                        &dest_width,
-                                        &dest_height,
-                                        options.font_ratio,
-                                        options.scale >= SCALE_MAX - 0.1 ? TRUE : FALSE,
-                                        options.stretch);
+    if (begin_frame (is_first_file, TRUE, item->dest_height))
+    {
+        image_writer_init (&writer, item->dest_width);
+        if (image_writer_write (item->gs->str, item->gs->len, &writer))
+            end_frame ();
+    }
 
-            gs = build_string (pixel_type, pixels,
-                               src_width, src_height, src_rowstride,
-                               dest_width, dest_height,
-                               is_animation);
+    g_string_free (item->gs, TRUE);
+    item->gs = NULL;
+    return FILE_WAS_STILL;
+}
 
-            p0 = buf;
+/* Peak resident set size in KiB, or -1 if unknown */
+static gint64
+get_peak_rss_kib (void)
+{
+#ifdef HAVE_GETRUSAGE
+    struct rusage usage;
 
-            if (options.clear)
-            {
-                if (is_first_frame)
-                {
-                    /* Clear */
-                    p0 = chafa_term_info_emit_clear (options.term_info, p0);
-                }
+    if (getrusage (RUSAGE_SELF, &usage) != 0)
+        return -1;
 
-                /* Home cursor between frames */
-                p0 = chafa_term_info_emit_cursor_to_top_left (options.term_info, p0);
-            }
-            else if (!is_first_frame)
-            {
-                /* Cursor to col 0 and up N steps */
-                *(p0++) = '\r';
-                p0 = chafa_term_info_emit_cursor_up (options.term_info, p0, dest_height - (options.have_parking_row ? 0 : 1));
-            }
+# ifdef __APPLE__
+    /* Reported in bytes here, and KiB everywhere else */
+    return usage.ru_maxrss / 1024;
+# else
+    return usage.ru_maxrss;
+# endif
+#else
+    return -1;
+#endif
+}
 
-            /* Put a blank line between files in non-clear mode */
-            if (is_first_frame && !options.clear && !is_first_file)
-            {
-                if (!options.have_parking_row)
-                    *(p0++) = '\n';
-                *(p0++) = '\n';
-            }
+static void
+print_benchmark (gint n_files, gint64 decode_us, gint64 convert_us, gint64 output_bytes)
+{
+    gint n_frames = MAX (stats_totals.n_frames, 1);
+    gint64 peak_rss_kib = get_peak_rss_kib ();
+    const gint64 *wall_us = stats_totals.stage_wall_us;
+
+    g_printerr ("Files: %d\n", n_files);
+    g_printerr ("Frames: %d\n", stats_totals.n_frames);
+    g_printerr ("Frames per second: %.2f\n",
+                convert_us > 0 ? stats_totals.n_frames * 1000000.0 / convert_us : 0.0);
+    g_printerr ("Output bytes per frame: %" G_GINT64_FORMAT "\n", output_bytes / n_frames);
+
+    if (peak_rss_kib >= 0)
+        g_printerr ("Peak RSS: %.1f MiB\n", peak_rss_kib / 1024.0);
+
+    /* Scaling in symbol mode happens inside the first preparation pass, and
+     * is summed over threads, so the two overlap */
+    g_printerr ("\n%-20s %12s\n", "Stage", "Wall ms");
+    g_printerr ("%-20s %12.3f\n", "decode (per file)",
+                n_files > 0 ? decode_us / 1000.0 / n_files : 0.0);
+    g_printerr ("%-20s %12.3f\n", "scale",
+                (wall_us [CHAFA_CANVAS_STAGE_SCALE]
+                 + wall_us [CHAFA_CANVAS_STAGE_PIXEL_CANVAS_DRAW]) / 1000.0 / n_frames);
+    g_printerr ("%-20s %12.3f\n", "prepare",
+                (wall_us [CHAFA_CANVAS_STAGE_PREPARE_PASS_1]
+                 + wall_us [CHAFA_CANVAS_STAGE_PREPARE_PASS_2]) / 1000.0 / n_frames);
+    g_printerr ("%-20s %12.3f\n", "cells",
+                (wall_us [CHAFA_CANVAS_STAGE_UPDATE_CELLS]
+                 + wall_us [CHAFA_CANVAS_STAGE_DISPLAY_COLORS]) / 1000.0 / n_frames);
+    g_printerr ("%-20s %12.3f\n", "print",
+                wall_us [CHAFA_CANVAS_STAGE_PRINT] / 1000.0 / n_frames);
+    g_printerr ("%-20s %12.3f\n\n", "total",
+                convert_us / 1000.0 / n_frames);
+}
 
-            if (!write_to_stdout (buf, p0 - buf))
-                goto out;
+/* Decodes each file once, then converts and prints its first frame
+ * options.benchmark_n times over. The output is thrown away, so it's only
+ * our own time that's measured. Per-stage times come from the canvas
+ * stats. */
+static int
+run_benchmark (GList *filenames)
+{
+    GList *l;
+    gint64 decode_us = 0, convert_us = 0, output_bytes = 0;
+    gint n_processed = 0;
+    gint n_failed = 0;
 
-            if (!write_image (gs->str, gs->len, dest_width))
-                goto out;
+    if (!filenames)
+        return 0;
 
-            g_string_free (gs, TRUE);
+    for (l = filenames; l && !interrupted_by_user; l = g_list_next (l))
+    {
+        const gchar *filename = l->data;
+        MediaLoader *media_loader;
+        ChafaCanvas *canvas = NULL;
+        ChafaCanvas *prev_canvas = NULL;
+        ChafaPixelType pixel_type;
+        gint target_width, target_height;
+        gint src_width, src_height, src_rowstride;
+        gint dest_width, dest_height;
+        const guint8 *pixels = NULL;
+        gint64 start_us;
+        GError *error = NULL;
+        gint i;
 
-            /* No linefeed after frame in sixel mode */
-            if (options.have_parking_row
-                && (options.pixel_mode == CHAFA_PIXEL_MODE_SYMBOLS
-                    || options.pixel_mode == CHAFA_PIXEL_MODE_KITTY
-                    || options.pixel_mode == CHAFA_PIXEL_MODE_ITERM2))
-            {
-                if (!write_to_stdout ("\n", 1))
-                    goto out;
-            }
-            else if (options.center && options.pixel_mode == CHAFA_PIXEL_MODE_SIXELS)
-            {
-                /* If image was centered in sixel mode, cursor must be brought
-                 * back to left margin manually */
-                if (!write_to_stdout ("\r", 1))
-                    goto out;
-            }
+        n_processed++;
+        calc_target_pixel_size (&target_width, &target_height);
 
-            if (fflush (stdout) != 0)
-                goto out;
+        start_us = g_get_monotonic_time ();
+        media_loader = media_loader_new (filename, target_width, target_height, &error);
+        if (media_loader)
+            pixels = media_loader_get_frame_data (media_loader, &pixel_type,
+                                                  &src_width, &src_height, &src_rowstride);
+        decode_us += g_get_monotonic_time () - start_us;
 
-            if (is_animation)
-            {
-                /* Account for time spent converting and printing frame */
-                elapsed_ms = g_timer_elapsed (timer, NULL) * 1000.0;
+        if (!pixels)
+        {
+            g_printerr ("%s: Failed to open '%s': %s\n",
+                        options.executable_name, filename,
+                        error ? error->message : "No image data");
+            if (error)
+                g_error_free (error);
+            if (media_loader)
+                media_loader_destroy (media_loader);
+            n_failed++;
+            continue;
+        }
 
-                if (options.anim_fps > 0.0)
-                    remain_ms = 1000.0 / options.anim_fps;
-                else
-                    remain_ms = delay_ms;
-                remain_ms /= options.anim_speed_multiplier;
-                remain_ms = MAX (remain_ms - elapsed_ms, 0);
+        calc_dest_geometry (src_width, src_height, &dest_width, &dest_height);
 
-                if (remain_ms > 0.0001 && 1000.0 / (gdouble) remain_ms < ANIM_FPS_MAX)
-                    interruptible_usleep (remain_ms * 1000);
+        start_us = g_get_monotonic_time ();
 
-                anim_elapsed_s += MAX (elapsed_ms, delay_ms) / 1000.0;
-            }
+        for (i = 0; i < options.benchmark_n && !interrupted_by_user; i++)
+        {
+            GString *gs;
 
-            is_first_frame = FALSE;
+            draw_frame (pixel_type, pixels,
+                        src_width, src_height, src_rowstride,
+                        dest_width, dest_height,
+                        FALSE,
+                        &canvas, &prev_canvas);
 
-            if (!is_animation)
-                break;
+            gs = build_frame_string (canvas, prev_canvas, FALSE);
+            output_bytes += gs->len;
+            g_string_free (gs, TRUE);
+
+            collect_stats (canvas);
         }
 
-        loop_n++;
-    }
-    while (is_animation && !interrupted_by_user
-           && !options.watch && anim_elapsed_s < options.file_duration_s);
+        convert_us += g_get_monotonic_time () - start_us;
 
-out:
-    if (media_loader)
+        if (canvas)
+            chafa_canvas_unref (canvas);
+        if (prev_canvas)
+            chafa_canvas_unref (prev_canvas);
         media_loader_destroy (media_loader);
-    g_timer_destroy (timer);
-
-    if (error)
-        g_error_free (error);
+    }
 
-    return result;
+    print_benchmark (n_processed - n_failed, decode_us, convert_us, output_bytes);
+    return (n_processed - n_failed < 1) ? 2 : (n_failed > 0) ? 1 : 0;
 }
 
-static RunResult
-run (const gchar *filename, gboolean is_first_file, gboolean is_first_frame, gboolean quiet)
+/* How long to wait for changes before checking the time limit and whether
+ * we were interrupted */
+#define WATCH_WAIT_US 250000
+
+/* Hashes the file's contents, so we can tell if it really changed when we're
+ * told it might have. Returns NULL if it can't be read. */
+static gchar *
+checksum_file (const gchar *filename)
 {
-    return run_generic (filename, is_first_file, is_first_frame, quiet);
+    FileMapping *mapping;
+    gconstpointer data;
+    gsize data_len;
+    gchar *checksum = NULL;
+
+    mapping = file_mapping_new (filename);
+    data = file_mapping_get_data (mapping, &data_len);
+    if (data)
+        checksum = g_compute_checksum_for_data (G_CHECKSUM_MD5, data, data_len);
+    file_mapping_destroy (mapping);
+
+    return checksum;
 }
 
 static int
 run_watch (const gchar *filename)
 {
     GTimer *timer;
+    FileWatcher *watcher;
+    gchar *last_checksum = NULL;
+    RunResult last_result = FILE_FAILED;
     gboolean is_first_frame = TRUE;
+    gboolean may_have_changed = TRUE;
 
     tty_options_init ();
     timer = g_timer_new ();
+    watcher = file_watcher_new (filename);
 
     for ( ; !interrupted_by_user; )
     {
-        struct stat sbuf;
+        gchar *checksum = NULL;
+        gboolean resized = terminal_resized && update_tty_geometry ();
 
-        if (!stat (filename, &sbuf))
-        {
-            /* Sadly we can't rely on timestamps to tell us when to reload
-             * the file, since they can take way too long to update. */
+        /* Sadly we can't rely on timestamps to tell us when to reload the
+         * file, since they can take way too long to update. We go by the
+         * contents instead, and only look at those when we're told the file
+         * may have changed. Animations are replayed regardless. */
 
-            run (filename, TRUE, is_first_frame, TRUE);
-            is_first_frame = FALSE;
+        /* If only the terminal size changed, the still we have can be
+         * drawn again without reloading it */
+        if (resized && !may_have_changed && last_result == FILE_WAS_STILL
+            && redraw_cached_frame (filename))
+            resized = FALSE;
 
-            g_usleep (10000);
+        if (may_have_changed || resized || last_result == FILE_WAS_ANIMATION)
+            checksum = checksum_file (filename);
+
+        if (checksum)
+        {
+            if (last_result == FILE_WAS_ANIMATION || resized
+                || !last_checksum || strcmp (checksum, last_checksum))
+            {
+                last_result = run (filename, TRUE, is_first_frame, TRUE);
+                is_first_frame = FALSE;
+            }
+
+            g_free (last_checksum);
+            last_checksum = checksum;
         }
-        else
+        else if (may_have_changed)
         {
             /* Don't hammer the path if the file is temporarily gone */
 
@@ -2155,17 +4534,48 @@ run_watch (const gchar *filename)
 
         if (g_timer_elapsed (timer, NULL) > options.file_duration_s)
             break;
+
+        may_have_changed = (last_result == FILE_WAS_ANIMATION)
+            || file_watcher_wait (watcher, WATCH_WAIT_US);
     }
 
+    g_free (last_checksum);
+    clear_cached_frame ();
+    file_watcher_destroy (watcher);
     g_timer_destroy (timer);
     tty_options_deinit ();
     return 0;
 }
 
+/* Keeps a still on screen for the given time, redrawing it if the terminal
+ * is resized in the meantime */
+static void
+hold_still (const gchar *filename, gdouble duration_s)
+{
+    GTimer *timer = g_timer_new ();
+
+    while (!interrupted_by_user)
+    {
+        gdouble remain_s = duration_s - g_timer_elapsed (timer, NULL);
+
+        if (remain_s <= 0.0)
+            break;
+
+        interruptible_usleep (MIN (remain_s, 0.05) * 1000000.0);
+
+        if (terminal_resized && update_tty_geometry ())
+            redraw_cached_frame (filename);
+    }
+
+    g_timer_destroy (timer);
+}
+
 static int
 run_all (GList *filenames)
 {
     GList *l;
+    Batch batch;
+    gboolean use_batch;
     gint n_processed = 0;
     gint n_failed = 0;
 
@@ -2175,12 +4585,19 @@ run_all (GList *filenames)
 
     tty_options_init ();
 
+    use_batch = options.batch_size > 1 && filenames->next;
+    if (use_batch)
+        batch_init (&batch, filenames, options.batch_size);
+
     for (l = filenames; l && !interrupted_by_user; l = g_list_next (l))
     {
         gchar *filename = l->data;
         RunResult result;
 
-        result = run (filename, l->prev ? FALSE : TRUE, TRUE, FALSE);
+        if (use_batch)
+            result = batch_run (&batch, n_processed, l->prev ? FALSE : TRUE);
+        else
+            result = run (filename, l->prev ? FALSE : TRUE, TRUE, FALSE);
 
         n_processed++;
         if (result == FILE_FAILED)
@@ -2188,10 +4605,15 @@ run_all (GList *filenames)
 
         if (result == FILE_WAS_STILL && options.file_duration_s != G_MAXDOUBLE)
         {
-            interruptible_usleep (options.file_duration_s * 1000000.0);
+            hold_still (filename, options.file_duration_s);
         }
     }
 
+    clear_cached_frame ();
+
+    if (use_batch)
+        batch_deinit (&batch);
+
     /* Emit linefeed after last image when cursor was not in parking row */
     if (!options.have_parking_row)
         write_to_stdout ("\n", 1);
@@ -2200,6 +4622,197 @@ run_all (GList *filenames)
     return (n_processed - n_failed < 1) ? 2 : (n_failed > 0) ? 1 : 0;
 }
 
+/* Requests carry the client's terminal geometry, which stands in for
+ * our own when the server was started without an explicit size */
+static void
+apply_request_geometry (const RenderRequest *request)
+{
+    if (request->term_width_cells > 0 && request->term_height_cells > 0)
+    {
+        detected_term_size.width_cells = request->term_width_cells;
+        detected_term_size.height_cells = request->term_height_cells;
+        detected_term_size.width_pixels = request->term_width_pixels;
+        detected_term_size.height_pixels = request->term_height_pixels;
+    }
+
+    if (request->width > 0 || request->height > 0)
+    {
+        options.width = request->width;
+        options.height = request->height;
+        using_detected_size = FALSE;
+    }
+    else if (using_detected_size && request->term_width_cells > 0 && request->term_height_cells > 0)
+    {
+        options.width = MAX (request->term_width_cells - options.margin_right, 1);
+        options.height = MAX (request->term_height_cells - options.margin_bottom, 1);
+    }
+
+    options.have_parking_row = (using_detected_size && options.margin_bottom == 0) ? FALSE : TRUE;
+}
+
+static int
+run_server (const gchar *path)
+{
+    RenderServer *server;
+    GError *error = NULL;
+    TermSize saved_term_size = detected_term_size;
+    gboolean saved_using_detected_size = using_detected_size;
+    gint saved_width = options.width;
+    gint saved_height = options.height;
+    gboolean saved_have_parking_row = options.have_parking_row;
+    gint saved_stdout;
+
+    server = render_server_new (path, &error);
+    if (!server)
+    {
+        g_printerr ("%s: %s\n", options.executable_name, error->message);
+        g_error_free (error);
+        return 2;
+    }
+
+#ifdef HAVE_SIGACTION
+    {
+        struct sigaction sa = { 0 };
+
+        /* Clients hanging up early must not take the server down with them */
+        sa.sa_handler = SIG_IGN;
+        sigaction (SIGPIPE, &sa, NULL);
+    }
+#endif
+
+    saved_stdout = dup (STDOUT_FILENO);
+
+    while (!interrupted_by_user)
+    {
+        RenderRequest request;
+        gint fd;
+
+        fd = render_server_accept (server, &request);
+        if (fd < 0)
+        {
+            if (!interrupted_by_user)
+                g_printerr ("%s: Could not accept connection on %s.\n",
+                            options.executable_name, path);
+            break;
+        }
+
+        /* Everything we print goes to the client for the duration */
+        apply_request_geometry (&request);
+        flush_stdout (TRUE);
+        dup2 (fd, STDOUT_FILENO);
+        close (fd);
+
+        run_all (request.filenames);
+
+        flush_stdout (TRUE);
+        dup2 (saved_stdout, STDOUT_FILENO);
+
+        detected_term_size = saved_term_size;
+        using_detected_size = saved_using_detected_size;
+        options.width = saved_width;
+        options.height = saved_height;
+        options.have_parking_row = saved_have_parking_row;
+        render_request_clear (&request);
+    }
+
+    close (saved_stdout);
+    render_server_destroy (server);
+    return 0;
+}
+
+/* The client passes on its geometry and leaves everything else to the
+ * server, so it doesn't need any of the expensive setup in parse_options () */
+static gboolean
+is_client_invocation (int argc, char *argv [])
+{
+    gint i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp (argv [i], "--"))
+            break;
+        if (!strcmp (argv [i], "--connect") || g_str_has_prefix (argv [i], "--connect="))
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+static int
+run_client (int *argc, char **argv [])
+{
+    GError *error = NULL;
+    GOptionContext *context;
+    gchar *connect_path = NULL;
+    RenderRequest request;
+    TermSize term_size;
+    int ret = 2;
+    const GOptionEntry option_entries [] =
+    {
+        { "connect",     '\0', 0, G_OPTION_ARG_FILENAME, &connect_path,         "Connect to server", NULL },
+        { "size",        's',  0, G_OPTION_ARG_CALLBACK, parse_size_arg,        "Output size", NULL },
+        { 0 }
+    };
+
+    context = g_option_context_new ("[COMMAND] [OPTION...]");
+    g_option_context_set_help_enabled (context, FALSE);
+    g_option_context_add_main_entries (context, option_entries, NULL);
+
+    options.executable_name = g_strdup ((*argv) [0]);
+    options.width = options.height = -1;
+    render_request_init (&request);
+
+    if (!g_option_context_parse (context, argc, argv, &error))
+    {
+        g_printerr ("%s: %s (only --size can be combined with --connect)\n",
+                    options.executable_name, error->message);
+        g_error_free (error);
+        goto out;
+    }
+
+    if (*argc < 2)
+    {
+        g_printerr ("%s: Need at least one file to send with --connect.\n",
+                    options.executable_name);
+        goto out;
+    }
+
+    get_tty_size (&term_size);
+    request.term_width_cells = term_size.width_cells;
+    request.term_height_cells = term_size.height_cells;
+    request.term_width_pixels = term_size.width_pixels;
+    request.term_height_pixels = term_size.height_pixels;
+    request.width = options.width;
+    request.height = options.height;
+    request.filenames = collect_variable_arguments (argc, argv, 1);
+
+    if (count_dash_strings (request.filenames) > 0)
+    {
+        g_printerr ("%s: Can't pipe from standard input with --connect.\n",
+                    options.executable_name);
+        goto out;
+    }
+
+    if (!render_client_run (connect_path, &request, &error))
+    {
+        if (error)
+        {
+            g_printerr ("%s: %s\n", options.executable_name, error->message);
+            g_error_free (error);
+        }
+        goto out;
+    }
+
+    ret = 0;
+
+out:
+    render_request_clear (&request);
+    g_free (connect_path);
+    g_free (options.executable_name);
+    g_option_context_free (context);
+    return ret;
+}
+
 static void
 proc_init (void)
 {
@@ -2210,6 +4823,13 @@ proc_init (void)
     sa.sa_flags = SA_RESETHAND;
 
     sigaction (SIGINT, &sa, NULL);
+
+# ifdef SIGWINCH
+    sa.sa_handler = sigwinch_handler;
+    sa.sa_flags = SA_RESTART;
+
+    sigaction (SIGWINCH, &sa, NULL);
+# endif
 #endif
 
 #ifdef G_OS_WIN32
@@ -2230,22 +4850,57 @@ proc_init (void)
 int
 main (int argc, char *argv [])
 {
+    GList *l;
     int ret;
 
     proc_init ();
 
+    if (is_client_invocation (argc, argv))
+        return run_client (&argc, &argv);
+
     if (!parse_options (&argc, &argv))
         exit (2);
 
-    ret = options.watch
+#ifndef G_OS_WIN32
+    fflush (stdout);
+    output_writer = output_writer_new (STDOUT_FILENO, OUTPUT_QUEUE_BYTES_MAX);
+#endif
+
+    ret = options.serve_path
+        ? run_server (options.serve_path)
+        : options.watch
         ? run_watch (options.args->data)
+        : options.benchmark_n > 0
+        ? run_benchmark (options.args)
         : run_all (options.args);
 
+#ifndef G_OS_WIN32
+    output_writer_destroy (output_writer);
+    output_writer = NULL;
+#endif
+
+    if (options.stats)
+        print_stats ();
+
     if (options.symbol_map)
         chafa_symbol_map_unref (options.symbol_map);
     if (options.fill_symbol_map)
         chafa_symbol_map_unref (options.fill_symbol_map);
+    if (options.symbol_map_checksum)
+        g_checksum_free (options.symbol_map_checksum);
+    for (l = options.glyph_files; l; l = g_list_next (l))
+        g_free (l->data);
+    g_list_free (options.glyph_files);
     if (options.term_info)
         chafa_term_info_unref (options.term_info);
+    g_free (options.serve_path);
+
+    /* Finishes the trace */
+    if (options.trace_path)
+    {
+        chafa_set_trace_file (NULL);
+        g_free (options.trace_path);
+    }
+
     return ret;
 }
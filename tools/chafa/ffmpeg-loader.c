@@ -0,0 +1,701 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+#include <string.h>
+
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/hwcontext.h>
+#include <libavutil/pixdesc.h>
+#include <libswscale/swscale.h>
+
+#include <chafa.h>
+#include "ffmpeg-loader.h"
+
+#define DEFAULT_FRAME_DURATION_MS 40
+
+/* How many converted frames the decoder thread may keep ready */
+#define DECODE_AHEAD_MAX 8
+
+typedef struct
+{
+    guint8 *data;
+    ChafaPixelType pixel_type;
+    gint width, height, rowstride;
+    gint64 pts_ms;
+}
+DecodedFrame;
+
+struct FfmpegLoader
+{
+    /* Only touched by the decoder thread once it's running */
+    AVFormatContext *format_ctx;
+    AVCodecContext *codec_ctx;
+    AVBufferRef *hw_device_ctx;
+    enum AVPixelFormat hw_pix_fmt;
+    struct SwsContext *sws_ctx;
+    AVRational time_base;
+    gint stream_index;
+    gint64 last_pts_ms;
+
+    gint default_delay_ms;
+    guint is_animation : 1;
+
+    /* Shared with the decoder thread; protected by mutex */
+    GThread *thread;
+    GMutex mutex;
+    GCond cond;
+    GQueue queue;
+    guint generation;
+    guint eof : 1;
+    guint rewind : 1;
+    guint stop : 1;
+
+    /* Presentation side */
+    DecodedFrame *this_frame;
+    GTimer *clock;
+    gint64 clock_base_pts_ms;
+    gdouble speed;
+    guint clock_started : 1;
+    guint at_start : 1;
+};
+
+static void
+decoded_frame_free (DecodedFrame *frame)
+{
+    g_free (frame->data);
+    g_free (frame);
+}
+
+/* --- Decoder thread --- */
+
+/* This is the only colorspace the I420 and NV12 pixel types cover */
+static gboolean
+is_bt601_limited (const AVFrame *frame)
+{
+    return frame->color_range != AVCOL_RANGE_JPEG
+        && (frame->colorspace == AVCOL_SPC_UNSPECIFIED
+            || frame->colorspace == AVCOL_SPC_BT470BG
+            || frame->colorspace == AVCOL_SPC_SMPTE170M);
+}
+
+static void
+copy_plane (guint8 *dest, gint dest_rowstride,
+            const guint8 *src, gint src_rowstride,
+            gint width, gint height)
+{
+    gint y;
+
+    for (y = 0; y < height; y++)
+        memcpy (dest + y * dest_rowstride, src + y * src_rowstride, width);
+}
+
+/* Packs the planes into the single buffer chafa expects, which saves us a
+ * pass through swscale */
+static gboolean
+pack_yuv (const AVFrame *src, const AVFrame *props, DecodedFrame *out)
+{
+    gint rowstride = (src->width + 1) & ~1;
+    gint chroma_width = (src->width + 1) / 2;
+    gint chroma_height = (src->height + 1) / 2;
+    guint8 *p;
+
+    if (!is_bt601_limited (props))
+        return FALSE;
+
+    if (src->format == AV_PIX_FMT_YUV420P)
+    {
+        out->pixel_type = CHAFA_PIXEL_I420;
+        out->data = p = g_malloc (rowstride * src->height + rowstride * chroma_height);
+
+        copy_plane (p, rowstride, src->data [0], src->linesize [0], src->width, src->height);
+        p += rowstride * src->height;
+        copy_plane (p, rowstride / 2, src->data [1], src->linesize [1], chroma_width, chroma_height);
+        p += (rowstride / 2) * chroma_height;
+        copy_plane (p, rowstride / 2, src->data [2], src->linesize [2], chroma_width, chroma_height);
+    }
+    else if (src->format == AV_PIX_FMT_NV12)
+    {
+        out->pixel_type = CHAFA_PIXEL_NV12;
+        out->data = p = g_malloc (rowstride * src->height + rowstride * chroma_height);
+
+        copy_plane (p, rowstride, src->data [0], src->linesize [0], src->width, src->height);
+        p += rowstride * src->height;
+        copy_plane (p, rowstride, src->data [1], src->linesize [1], chroma_width * 2, chroma_height);
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    out->width = src->width;
+    out->height = src->height;
+    out->rowstride = rowstride;
+    return TRUE;
+}
+
+static gboolean
+convert_rgba (FfmpegLoader *loader, const AVFrame *src, const AVFrame *props, DecodedFrame *out)
+{
+    const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get ((enum AVPixelFormat) src->format);
+    guint8 *dest [4] = { NULL };
+    gint dest_linesize [4] = { 0 };
+
+    loader->sws_ctx = sws_getCachedContext (loader->sws_ctx,
+                                            src->width, src->height, (enum AVPixelFormat) src->format,
+                                            src->width, src->height, AV_PIX_FMT_RGBA,
+                                            SWS_BILINEAR, NULL, NULL, NULL);
+    if (!loader->sws_ctx)
+        return FALSE;
+
+    /* AVColorSpace matches the SWS_CS_* constants for the spaces swscale
+     * knows about, and it falls back to BT.601 for the rest */
+    sws_setColorspaceDetails (loader->sws_ctx,
+                              sws_getCoefficients (props->colorspace),
+                              props->color_range == AVCOL_RANGE_JPEG ? 1 : 0,
+                              sws_getCoefficients (SWS_CS_DEFAULT), 1,
+                              0, 1 << 16, 1 << 16);
+
+    out->rowstride = src->width * 4;
+    out->data = g_malloc (out->rowstride * src->height);
+    dest [0] = out->data;
+    dest_linesize [0] = out->rowstride;
+
+    sws_scale (loader->sws_ctx, (const guint8 * const *) src->data, src->linesize,
+               0, src->height, dest, dest_linesize);
+
+    /* An opaque image with unassociated alpha set to 0xff is equivalent to
+     * premultiplied alpha. This will speed up resampling later on. */
+    out->pixel_type = (desc && (desc->flags & AV_PIX_FMT_FLAG_ALPHA))
+        ? CHAFA_PIXEL_RGBA8_UNASSOCIATED : CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
+    out->width = src->width;
+    out->height = src->height;
+    return TRUE;
+}
+
+static DecodedFrame *
+convert_frame (FfmpegLoader *loader, AVFrame *frame, AVFrame *sw_frame)
+{
+    DecodedFrame *decoded;
+    AVFrame *src = frame;
+
+    if (loader->hw_pix_fmt != AV_PIX_FMT_NONE && frame->format == loader->hw_pix_fmt)
+    {
+        if (av_hwframe_transfer_data (sw_frame, frame, 0) < 0)
+        {
+            av_frame_unref (sw_frame);
+            return NULL;
+        }
+        src = sw_frame;
+    }
+
+    decoded = g_new0 (DecodedFrame, 1);
+
+    if (!pack_yuv (src, frame, decoded)
+        && !convert_rgba (loader, src, frame, decoded))
+    {
+        decoded_frame_free (decoded);
+        decoded = NULL;
+        goto out;
+    }
+
+    if (frame->best_effort_timestamp != AV_NOPTS_VALUE)
+        decoded->pts_ms = av_rescale_q (frame->best_effort_timestamp, loader->time_base,
+                                        (AVRational) { 1, 1000 });
+    else
+        decoded->pts_ms = loader->last_pts_ms + loader->default_delay_ms;
+
+    loader->last_pts_ms = decoded->pts_ms;
+
+out:
+    if (src == sw_frame)
+        av_frame_unref (sw_frame);
+    return decoded;
+}
+
+/* Returns the next frame in decoding order, or NULL at the end of the
+ * stream. Frames that fail to convert are skipped. */
+static DecodedFrame *
+decode_frame (FfmpegLoader *loader, AVPacket *packet, AVFrame *frame, AVFrame *sw_frame,
+              gboolean *draining)
+{
+    for (;;)
+    {
+        gint ret = avcodec_receive_frame (loader->codec_ctx, frame);
+
+        if (ret == 0)
+        {
+            DecodedFrame *decoded = convert_frame (loader, frame, sw_frame);
+
+            av_frame_unref (frame);
+            if (decoded)
+                return decoded;
+            continue;
+        }
+
+        if (ret != AVERROR (EAGAIN) || *draining)
+            return NULL;
+
+        /* The decoder needs more input. Once we run out, send a flush
+         * packet to get the frames it's still holding. */
+        for (;;)
+        {
+            if (av_read_frame (loader->format_ctx, packet) < 0)
+            {
+                avcodec_send_packet (loader->codec_ctx, NULL);
+                *draining = TRUE;
+                break;
+            }
+
+            if (packet->stream_index == loader->stream_index)
+            {
+                /* Corrupt packets are skipped by the decoder */
+                avcodec_send_packet (loader->codec_ctx, packet);
+                av_packet_unref (packet);
+                break;
+            }
+
+            av_packet_unref (packet);
+        }
+    }
+}
+
+static gpointer
+decoder_thread_func (FfmpegLoader *loader)
+{
+    AVPacket *packet = av_packet_alloc ();
+    AVFrame *frame = av_frame_alloc ();
+    AVFrame *sw_frame = av_frame_alloc ();
+    gboolean draining = FALSE;
+
+    g_mutex_lock (&loader->mutex);
+
+    for (;;)
+    {
+        DecodedFrame *decoded;
+        guint generation;
+
+        while (!loader->stop && !loader->rewind
+               && (loader->eof || loader->queue.length >= DECODE_AHEAD_MAX))
+            g_cond_wait (&loader->cond, &loader->mutex);
+
+        if (loader->stop)
+            break;
+
+        if (loader->rewind)
+        {
+            loader->rewind = FALSE;
+            g_mutex_unlock (&loader->mutex);
+
+            av_seek_frame (loader->format_ctx, loader->stream_index, 0, AVSEEK_FLAG_BACKWARD);
+            avcodec_flush_buffers (loader->codec_ctx);
+            draining = FALSE;
+            loader->last_pts_ms = -loader->default_delay_ms;
+
+            g_mutex_lock (&loader->mutex);
+            continue;
+        }
+
+        generation = loader->generation;
+        g_mutex_unlock (&loader->mutex);
+
+        decoded = decode_frame (loader, packet, frame, sw_frame, &draining);
+
+        g_mutex_lock (&loader->mutex);
+
+        /* Rewound while we were busy; this frame is from the old position */
+        if (generation != loader->generation)
+        {
+            if (decoded)
+                decoded_frame_free (decoded);
+            continue;
+        }
+
+        if (decoded)
+            g_queue_push_tail (&loader->queue, decoded);
+        else
+            loader->eof = TRUE;
+
+        g_cond_broadcast (&loader->cond);
+    }
+
+    g_mutex_unlock (&loader->mutex);
+
+    av_frame_free (&sw_frame);
+    av_frame_free (&frame);
+    av_packet_free (&packet);
+    return NULL;
+}
+
+/* --- Setup --- */
+
+static enum AVPixelFormat
+get_hw_format (AVCodecContext *codec_ctx, const enum AVPixelFormat *formats)
+{
+    FfmpegLoader *loader = codec_ctx->opaque;
+    const enum AVPixelFormat *p;
+
+    for (p = formats; *p != AV_PIX_FMT_NONE; p++)
+    {
+        if (*p == loader->hw_pix_fmt)
+            return *p;
+    }
+
+    /* The device can't do this stream; decode in software */
+    return avcodec_default_get_format (codec_ctx, formats);
+}
+
+static void
+init_hw_decode (FfmpegLoader *loader, const AVCodec *codec)
+{
+    gint i;
+
+    for (i = 0; ; i++)
+    {
+        const AVCodecHWConfig *config = avcodec_get_hw_config (codec, i);
+
+        if (!config)
+            break;
+
+        if (!(config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX))
+            continue;
+
+        if (av_hwdevice_ctx_create (&loader->hw_device_ctx, config->device_type, NULL, NULL, 0) < 0)
+            continue;
+
+        loader->hw_pix_fmt = config->pix_fmt;
+        loader->codec_ctx->hw_device_ctx = av_buffer_ref (loader->hw_device_ctx);
+        loader->codec_ctx->opaque = loader;
+        loader->codec_ctx->get_format = get_hw_format;
+        break;
+    }
+}
+
+static FfmpegLoader *
+ffmpeg_loader_new_internal (void)
+{
+    FfmpegLoader *loader = g_new0 (FfmpegLoader, 1);
+
+    loader->stream_index = -1;
+    loader->hw_pix_fmt = AV_PIX_FMT_NONE;
+    loader->default_delay_ms = DEFAULT_FRAME_DURATION_MS;
+    loader->at_start = TRUE;
+    g_mutex_init (&loader->mutex);
+    g_cond_init (&loader->cond);
+    g_queue_init (&loader->queue);
+    loader->clock = g_timer_new ();
+    return loader;
+}
+
+FfmpegLoader *
+ffmpeg_loader_new (const gchar *path)
+{
+    FfmpegLoader *loader;
+    AVStream *stream;
+    const AVCodec *codec;
+    gboolean success = FALSE;
+
+    g_return_val_if_fail (path != NULL, NULL);
+
+    /* Probing is chatty when given things it doesn't recognize */
+    av_log_set_level (AV_LOG_QUIET);
+
+    loader = ffmpeg_loader_new_internal ();
+
+    if (avformat_open_input (&loader->format_ctx, path, NULL, NULL) < 0)
+        goto out;
+
+    /* Still images are better served by the other loaders, which we've
+     * either been through already or will get to next */
+    if (!strcmp (loader->format_ctx->iformat->name, "image2")
+        || g_str_has_suffix (loader->format_ctx->iformat->name, "_pipe"))
+        goto out;
+
+    if (avformat_find_stream_info (loader->format_ctx, NULL) < 0)
+        goto out;
+
+    loader->stream_index = av_find_best_stream (loader->format_ctx, AVMEDIA_TYPE_VIDEO,
+                                                -1, -1, NULL, 0);
+    if (loader->stream_index < 0)
+        goto out;
+
+    stream = loader->format_ctx->streams [loader->stream_index];
+    if (stream->codecpar->width < 1 || stream->codecpar->height < 1
+        || (stream->disposition & AV_DISPOSITION_ATTACHED_PIC))
+        goto out;
+
+    codec = avcodec_find_decoder (stream->codecpar->codec_id);
+    if (!codec)
+        goto out;
+
+    loader->codec_ctx = avcodec_alloc_context3 (codec);
+    if (!loader->codec_ctx
+        || avcodec_parameters_to_context (loader->codec_ctx, stream->codecpar) < 0)
+        goto out;
+
+    /* Let the decoder pick a thread count */
+    loader->codec_ctx->thread_count = 0;
+    init_hw_decode (loader, codec);
+
+    if (avcodec_open2 (loader->codec_ctx, codec, NULL) < 0)
+        goto out;
+
+    loader->time_base = stream->time_base;
+    if (stream->avg_frame_rate.num > 0 && stream->avg_frame_rate.den > 0)
+        loader->default_delay_ms = MAX (1, (gint) (1000.0 / av_q2d (stream->avg_frame_rate) + 0.5));
+    loader->last_pts_ms = -loader->default_delay_ms;
+    loader->is_animation = stream->nb_frames != 1;
+
+    loader->thread = g_thread_new ("ffmpeg-decoder", (GThreadFunc) decoder_thread_func, loader);
+    success = TRUE;
+
+out:
+    if (!success)
+    {
+        ffmpeg_loader_destroy (loader);
+        loader = NULL;
+    }
+
+    return loader;
+}
+
+static void
+clear_queue (FfmpegLoader *loader)
+{
+    DecodedFrame *frame;
+
+    while ((frame = g_queue_pop_head (&loader->queue)))
+        decoded_frame_free (frame);
+}
+
+void
+ffmpeg_loader_destroy (FfmpegLoader *loader)
+{
+    if (loader->thread)
+    {
+        g_mutex_lock (&loader->mutex);
+        loader->stop = TRUE;
+        g_cond_broadcast (&loader->cond);
+        g_mutex_unlock (&loader->mutex);
+
+        g_thread_join (loader->thread);
+    }
+
+    clear_queue (loader);
+    if (loader->this_frame)
+        decoded_frame_free (loader->this_frame);
+
+    if (loader->sws_ctx)
+        sws_freeContext (loader->sws_ctx);
+    avcodec_free_context (&loader->codec_ctx);
+    if (loader->format_ctx)
+        avformat_close_input (&loader->format_ctx);
+    av_buffer_unref (&loader->hw_device_ctx);
+
+    g_timer_destroy (loader->clock);
+    g_cond_clear (&loader->cond);
+    g_mutex_clear (&loader->mutex);
+    g_free (loader);
+}
+
+/* --- Presentation --- */
+
+/* Takes the next frame off the queue, waiting for it if necessary. If
+ * wait is FALSE, only returns a frame that is already decoded. */
+static DecodedFrame *
+pop_frame (FfmpegLoader *loader, gboolean wait)
+{
+    DecodedFrame *frame;
+
+    g_mutex_lock (&loader->mutex);
+
+    while (wait && !loader->queue.length && !loader->eof)
+        g_cond_wait (&loader->cond, &loader->mutex);
+
+    frame = g_queue_pop_head (&loader->queue);
+    g_cond_broadcast (&loader->cond);
+
+    g_mutex_unlock (&loader->mutex);
+
+    if (frame)
+        loader->at_start = FALSE;
+
+    return frame;
+}
+
+static DecodedFrame *
+peek_frame (FfmpegLoader *loader, gboolean wait)
+{
+    DecodedFrame *frame;
+
+    g_mutex_lock (&loader->mutex);
+
+    while (wait && !loader->queue.length && !loader->eof)
+        g_cond_wait (&loader->cond, &loader->mutex);
+
+    frame = g_queue_peek_head (&loader->queue);
+
+    g_mutex_unlock (&loader->mutex);
+    return frame;
+}
+
+static gboolean
+maybe_pop_this_frame (FfmpegLoader *loader)
+{
+    if (!loader->this_frame)
+        loader->this_frame = pop_frame (loader, TRUE);
+
+    if (loader->this_frame && !loader->clock_started)
+    {
+        g_timer_start (loader->clock);
+        loader->clock_base_pts_ms = loader->this_frame->pts_ms;
+        loader->clock_started = TRUE;
+    }
+
+    return loader->this_frame ? TRUE : FALSE;
+}
+
+gboolean
+ffmpeg_loader_get_is_animation (FfmpegLoader *loader)
+{
+    g_return_val_if_fail (loader != NULL, FALSE);
+
+    return loader->is_animation;
+}
+
+gconstpointer
+ffmpeg_loader_get_frame_data (FfmpegLoader *loader, ChafaPixelType *pixel_type_out,
+                              gint *width_out, gint *height_out, gint *rowstride_out)
+{
+    g_return_val_if_fail (loader != NULL, NULL);
+
+    if (!maybe_pop_this_frame (loader))
+        return NULL;
+
+    if (pixel_type_out)
+        *pixel_type_out = loader->this_frame->pixel_type;
+    if (width_out)
+        *width_out = loader->this_frame->width;
+    if (height_out)
+        *height_out = loader->this_frame->height;
+    if (rowstride_out)
+        *rowstride_out = loader->this_frame->rowstride;
+
+    return loader->this_frame->data;
+}
+
+gint
+ffmpeg_loader_get_frame_delay (FfmpegLoader *loader)
+{
+    DecodedFrame *next;
+    gint64 delay_ms;
+
+    g_return_val_if_fail (loader != NULL, 0);
+
+    if (!maybe_pop_this_frame (loader))
+        return loader->default_delay_ms;
+
+    /* Hold this frame until the next one is due */
+    next = peek_frame (loader, TRUE);
+    if (!next)
+        return loader->default_delay_ms;
+
+    delay_ms = next->pts_ms - loader->this_frame->pts_ms;
+    return delay_ms > 0 ? MIN (delay_ms, G_MAXINT) : loader->default_delay_ms;
+}
+
+void
+ffmpeg_loader_goto_first_frame (FfmpegLoader *loader)
+{
+    g_return_if_fail (loader != NULL);
+
+    loader->clock_started = FALSE;
+
+    /* The decoder starts out at the beginning, so don't throw away what
+     * it's done by seeking there */
+    if (loader->at_start)
+        return;
+
+    if (loader->this_frame)
+    {
+        decoded_frame_free (loader->this_frame);
+        loader->this_frame = NULL;
+    }
+
+    g_mutex_lock (&loader->mutex);
+    loader->generation++;
+    clear_queue (loader);
+    loader->eof = FALSE;
+    loader->rewind = TRUE;
+    g_cond_broadcast (&loader->cond);
+    g_mutex_unlock (&loader->mutex);
+
+    loader->at_start = TRUE;
+}
+
+static gboolean
+is_late (FfmpegLoader *loader, const DecodedFrame *next)
+{
+    gdouble now_ms;
+
+    if (loader->speed <= 0.0 || !loader->clock_started)
+        return FALSE;
+
+    now_ms = g_timer_elapsed (loader->clock, NULL) * 1000.0 * loader->speed;
+    return next->pts_ms - loader->clock_base_pts_ms <= now_ms;
+}
+
+gboolean
+ffmpeg_loader_goto_next_frame (FfmpegLoader *loader)
+{
+    DecodedFrame *frame, *next;
+
+    g_return_val_if_fail (loader != NULL, FALSE);
+
+    if (loader->this_frame)
+    {
+        decoded_frame_free (loader->this_frame);
+        loader->this_frame = NULL;
+    }
+
+    frame = pop_frame (loader, TRUE);
+    if (!frame)
+        return FALSE;
+
+    /* If the frame after this one is due already, we've fallen behind and
+     * this one would never be seen. Only look at what's been decoded, so
+     * dropping never makes us wait. */
+    while ((next = peek_frame (loader, FALSE)) && is_late (loader, next))
+    {
+        decoded_frame_free (frame);
+        frame = pop_frame (loader, FALSE);
+    }
+
+    loader->this_frame = frame;
+    return TRUE;
+}
+
+void
+ffmpeg_loader_set_playback_speed (FfmpegLoader *loader, gdouble speed)
+{
+    g_return_if_fail (loader != NULL);
+
+    loader->speed = speed;
+}
@@ -0,0 +1,47 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef __FFMPEG_LOADER_H__
+#define __FFMPEG_LOADER_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+typedef struct FfmpegLoader FfmpegLoader;
+
+FfmpegLoader *ffmpeg_loader_new (const gchar *path);
+void ffmpeg_loader_destroy (FfmpegLoader *loader);
+
+gboolean ffmpeg_loader_get_is_animation (FfmpegLoader *loader);
+
+gconstpointer ffmpeg_loader_get_frame_data (FfmpegLoader *loader, ChafaPixelType *pixel_type_out,
+                                            gint *width_out, gint *height_out, gint *rowstride_out);
+gint ffmpeg_loader_get_frame_delay (FfmpegLoader *loader);
+
+void ffmpeg_loader_goto_first_frame (FfmpegLoader *loader);
+gboolean ffmpeg_loader_goto_next_frame (FfmpegLoader *loader);
+
+/* Frames that are already late when we get to them are dropped, going by
+ * the file's timestamps played back at this speed. Zero disables. */
+void ffmpeg_loader_set_playback_speed (FfmpegLoader *loader, gdouble speed);
+
+G_END_DECLS
+
+#endif /* __FFMPEG_LOADER_H__ */
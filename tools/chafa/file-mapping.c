@@ -61,8 +61,8 @@
 # endif
 #endif
 
-/* Streams bigger than this must be cached in a file */
-#define FILE_MEMORY_CACHE_MAX (4 * 1024 * 1024)
+/* Initial size of buffer used to cache stdin. It doubles as needed */
+#define STDIN_BUFFER_SIZE_MIN (64 * 1024)
 
 /* Size of buffer used for copying stdin to file */
 #define COPY_BUFFER_SIZE 8192
@@ -299,12 +299,32 @@ open_temp_file (void)
     return fd;
 }
 
+static gint
+spill_to_temp_file (gint src_fd, gconstpointer buf, gsize len)
+{
+    gint cache_fd;
+
+    cache_fd = open_temp_file ();
+    if (cache_fd < 0)
+        return -1;
+
+    if (!safe_write (cache_fd, buf, len)
+        || !safe_copy (src_fd, cache_fd))
+    {
+        g_close (cache_fd, NULL);
+        return -1;
+    }
+
+    return cache_fd;
+}
+
 static gint
 cache_stdin (FileMapping *file_mapping, GError **error)
 {
-    gpointer buf = NULL;
+    guint8 *buf = NULL;
+    gsize buf_size = STDIN_BUFFER_SIZE_MIN;
     gint stdin_fd = fileno (stdin);  /* Can't use STDIN_FILENO on Windows */
-    size_t n_read;
+    size_t n_read = 0;
     gint cache_fd = -1;
     gint success = FALSE;
 
@@ -315,47 +335,51 @@ cache_stdin (FileMapping *file_mapping, GError **error)
     setmode (stdin_fd, O_BINARY);
 #endif
 
-    /* Read from stdin */
-
-    buf = g_malloc (FILE_MEMORY_CACHE_MAX);
-    n_read = safe_read (stdin_fd, buf, FILE_MEMORY_CACHE_MAX);
-    if (n_read < 1)
-        goto out;
+    /* Read from stdin into a buffer that grows geometrically. Big blocks
+     * are mmapped by the allocator, so growing them is usually a remap
+     * rather than a copy. */
 
-    /* If the stream didn't fit in memory, save it all to a file instead.
-     * We can mmap it later. Or read it back in, ha ha. */
+    buf = g_malloc (buf_size);
 
-    if (n_read == FILE_MEMORY_CACHE_MAX)
+    for (;;)
     {
-        cache_fd = open_temp_file ();
-        if (cache_fd >= 0)
-        {
-            if (!safe_write (cache_fd, buf, n_read))
-                goto out;
-            g_free (buf);
-            buf = NULL;
+        guint8 *new_buf = NULL;
 
-            if (!safe_copy (stdin_fd, cache_fd))
-                goto out;
-        }
-    }
-    else
-    {
-        file_mapping->data = g_realloc (buf, n_read);
-        file_mapping->length = n_read;
-        buf = NULL;
+        n_read += safe_read (stdin_fd, buf + n_read, buf_size - n_read);
+        if (n_read < buf_size)
+            break;
+
+        /* If we can't grow the buffer, save it all to a file instead.
+         * We can mmap it later. */
+
+        if (buf_size <= G_MAXSIZE / 2)
+            new_buf = g_try_realloc (buf, buf_size * 2);
+        if (!new_buf)
+            goto spill;
+
+        buf = new_buf;
+        buf_size *= 2;
     }
 
+    if (n_read < 1)
+        goto out;
+
+    file_mapping->data = g_realloc (buf, n_read);
+    file_mapping->length = n_read;
+    buf = NULL;
     success = TRUE;
+    goto out;
+
+spill:
+    cache_fd = spill_to_temp_file (stdin_fd, buf, n_read);
+    if (cache_fd >= 0)
+        success = TRUE;
 
 out:
+    g_free (buf);
+
     if (!success)
     {
-        if (cache_fd >= 0)
-            g_close (cache_fd, NULL);
-        cache_fd = -1;
-        g_free (buf);
-
         if (error && !*error)
         {
             g_set_error (error, G_FILE_ERROR, G_FILE_ERROR_FAILED,
@@ -0,0 +1,254 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+
+#ifdef HAVE_POLL_H
+# include <poll.h>
+#endif
+
+#if defined (HAVE_SYS_INOTIFY_H) && defined (HAVE_POLL_H)
+# include <sys/inotify.h>
+# define USE_INOTIFY 1
+#elif defined (HAVE_SYS_EVENT_H)
+# include <sys/event.h>
+# include <sys/time.h>
+# define USE_KQUEUE 1
+#endif
+
+#include <glib/gstdio.h>
+
+#include "file-watcher.h"
+
+/* How often to look at the file when we can't be told about changes */
+#define POLL_INTERVAL_US 10000
+
+/* Open the watched file for notifications only, where supported */
+#ifndef O_EVTONLY
+# define O_EVTONLY O_RDONLY
+#endif
+
+struct FileWatcher
+{
+    gchar *path;
+    gchar *basename;
+
+    /* The inotify instance or kqueue, or -1 if we must poll */
+    gint fd;
+
+    /* Kqueue only: The watched file itself. May be -1 while it's missing */
+    gint file_fd;
+};
+
+static void
+poll_wait (gint64 timeout_us)
+{
+    g_usleep (MIN (timeout_us, POLL_INTERVAL_US));
+}
+
+#ifdef USE_INOTIFY
+
+static void
+watch_init (FileWatcher *file_watcher)
+{
+    gchar *dir;
+
+    file_watcher->fd = inotify_init ();
+    if (file_watcher->fd < 0)
+        return;
+
+    /* Watch the directory, so we see the file being replaced or created
+     * and not just written to */
+    dir = g_path_get_dirname (file_watcher->path);
+
+    if (inotify_add_watch (file_watcher->fd, dir,
+                           IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0)
+    {
+        g_close (file_watcher->fd, NULL);
+        file_watcher->fd = -1;
+    }
+
+    g_free (dir);
+}
+
+static gboolean
+watch_wait (FileWatcher *file_watcher, gint64 timeout_us)
+{
+    union
+    {
+        struct inotify_event event;
+        gchar buf [4096];
+    }
+    u;
+    struct pollfd pfd;
+    gboolean changed = FALSE;
+    gssize len;
+    gchar *p;
+
+    pfd.fd = file_watcher->fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    if (poll (&pfd, 1, MAX (timeout_us / 1000, 1)) < 1)
+        return FALSE;
+
+    len = read (file_watcher->fd, u.buf, sizeof (u.buf));
+
+    for (p = u.buf; len > 0 && p < u.buf + len; )
+    {
+        const struct inotify_event *event = (const struct inotify_event *) p;
+
+        if (event->len > 0 && !strcmp (event->name, file_watcher->basename))
+            changed = TRUE;
+
+        p += sizeof (struct inotify_event) + event->len;
+    }
+
+    return changed;
+}
+
+#elif defined (USE_KQUEUE)
+
+static gboolean
+ensure_file_watched (FileWatcher *file_watcher)
+{
+    struct kevent kev;
+
+    if (file_watcher->file_fd >= 0)
+        return TRUE;
+
+    file_watcher->file_fd = g_open (file_watcher->path, O_EVTONLY, 0);
+    if (file_watcher->file_fd < 0)
+        return FALSE;
+
+    EV_SET (&kev, file_watcher->file_fd, EVFILT_VNODE, EV_ADD | EV_CLEAR,
+            NOTE_WRITE | NOTE_EXTEND | NOTE_ATTRIB | NOTE_DELETE | NOTE_RENAME,
+            0, NULL);
+
+    if (kevent (file_watcher->fd, &kev, 1, NULL, 0, NULL) < 0)
+    {
+        g_close (file_watcher->file_fd, NULL);
+        file_watcher->file_fd = -1;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void
+watch_init (FileWatcher *file_watcher)
+{
+    file_watcher->fd = kqueue ();
+}
+
+static gboolean
+watch_wait (FileWatcher *file_watcher, gint64 timeout_us)
+{
+    struct kevent kev;
+    struct timespec ts;
+
+    /* Kqueue watches the file rather than its name, so we can't be told
+     * when it appears. Look for it the old way in the meantime. */
+    if (!ensure_file_watched (file_watcher))
+    {
+        poll_wait (timeout_us);
+        return TRUE;
+    }
+
+    ts.tv_sec = timeout_us / G_USEC_PER_SEC;
+    ts.tv_nsec = (timeout_us % G_USEC_PER_SEC) * 1000;
+
+    if (kevent (file_watcher->fd, NULL, 0, &kev, 1, &ts) < 1)
+        return FALSE;
+
+    /* The name now refers to something else, if anything */
+    if (kev.fflags & (NOTE_DELETE | NOTE_RENAME))
+    {
+        g_close (file_watcher->file_fd, NULL);
+        file_watcher->file_fd = -1;
+    }
+
+    return TRUE;
+}
+
+#else
+
+static void
+watch_init (FileWatcher *file_watcher)
+{
+    file_watcher->fd = -1;
+}
+
+static gboolean
+watch_wait (G_GNUC_UNUSED FileWatcher *file_watcher, gint64 timeout_us)
+{
+    poll_wait (timeout_us);
+    return TRUE;
+}
+
+#endif
+
+FileWatcher *
+file_watcher_new (const gchar *path)
+{
+    FileWatcher *file_watcher;
+
+    file_watcher = g_new0 (FileWatcher, 1);
+    file_watcher->path = g_strdup (path);
+    file_watcher->basename = g_path_get_basename (path);
+    file_watcher->fd = -1;
+    file_watcher->file_fd = -1;
+
+    watch_init (file_watcher);
+
+    return file_watcher;
+}
+
+void
+file_watcher_destroy (FileWatcher *file_watcher)
+{
+    if (file_watcher->file_fd >= 0)
+        g_close (file_watcher->file_fd, NULL);
+    if (file_watcher->fd >= 0)
+        g_close (file_watcher->fd, NULL);
+
+    g_free (file_watcher->basename);
+    g_free (file_watcher->path);
+    g_free (file_watcher);
+}
+
+/* Waits up to timeout_us for the file to change. Returns TRUE if it may
+ * have changed, and FALSE if it certainly didn't. When changes can't be
+ * watched for, this waits a short while and returns TRUE. */
+gboolean
+file_watcher_wait (FileWatcher *file_watcher, gint64 timeout_us)
+{
+    if (file_watcher->fd < 0)
+    {
+        poll_wait (timeout_us);
+        return TRUE;
+    }
+
+    return watch_wait (file_watcher, timeout_us);
+}
@@ -35,6 +35,9 @@
 #define REQ_WIDTH_DEFAULT 15
 #define REQ_HEIGHT_DEFAULT 8
 
+/* Don't bother spinning up a thread for fewer glyphs than this */
+#define GLYPHS_PER_THREAD_MIN 256
+
 /* The font is read in two passes; once for narrow (single-cell) symbols,
  * and once for wide (double-cell) ones. This allows us to use a different
  * resolution for each -- 8x8 vs 16x8. */
@@ -45,6 +48,15 @@ typedef enum
 }
 FontPass;
 
+/* A glyph selected for the current pass. data is NULL if it failed to render. */
+typedef struct
+{
+    FT_ULong charcode;
+    FT_UInt index;
+    gpointer data;
+}
+FontGlyph;
+
 struct FontLoader
 {
     /* General / I/O */
@@ -61,12 +73,26 @@ struct FontLoader
     /* Baseline offset, vertical from top */
     gint baseline_ofs;
 
-    /* Iterator */
+    /* Pixel size request that produced the above */
+    gint req_width;
+    gint req_height;
+
+    /* Iterator. Each pass is rendered up front, then handed out one
+     * glyph at a time. */
     FontPass pass;
-    FT_ULong glyph_charcode;
+    FontGlyph *glyphs;
+    gint n_glyphs;
     gint n_glyphs_read;
 };
 
+typedef struct
+{
+    const FontLoader *loader;
+    FontGlyph *glyphs;
+    gint n_glyphs;
+}
+RenderBatch;
+
 /* With 256 bins we get a histogram for integer values [-128 .. 127]. This
  * is more than enough for the sizes we'll be getting, which should be in the
  * 0..16 range, give or take a little. Values outside the histogram's range
@@ -162,6 +188,20 @@ get_bitmap_bit (const FontLoader *loader, const FT_GlyphSlot slot,
     return (bm->buffer [y * bm->pitch + (x / 8)] >> (7 - (x % 8))) & 1;
 }
 
+static gboolean
+is_glyph_in_pass (FontPass pass, FT_ULong charcode)
+{
+    if (!g_unichar_isprint (charcode)
+        || g_unichar_ismark (charcode))
+        return FALSE;
+
+    if ((pass == FONT_PASS_NARROW && g_unichar_iswide (charcode))
+        || (pass == FONT_PASS_WIDE && !g_unichar_iswide (charcode)))
+        return FALSE;
+
+    return TRUE;
+}
+
 /* Get the 7th octile values for glyph width, height and baseline. This means 87.5% of
  * the glyphs will have values equal to or lower than the returned value. Discarding
  * the upper 12.5% prevents outliers from affecting the result. */
@@ -185,13 +225,7 @@ measure_glyphs (FontLoader *loader, gint *width_out, gint *height_out, gint *bas
          glyph_index != 0;
          glyph_charcode = FT_Get_Next_Char (loader->ft_face, glyph_charcode, &glyph_index))
     {
-        if (!g_unichar_isprint (glyph_charcode)
-            || g_unichar_ismark (glyph_charcode))
-            continue;
-
-        /* Skip glyphs that are not relevant to this pass */
-        if ((loader->pass == FONT_PASS_NARROW && g_unichar_iswide (glyph_charcode))
-            || (loader->pass == FONT_PASS_WIDE && !g_unichar_iswide (glyph_charcode)))
+        if (!is_glyph_in_pass (loader->pass, glyph_charcode))
             continue;
 
         /* FIXME: No need to render? */
@@ -277,6 +311,8 @@ find_best_pixel_size_scalable (FontLoader *loader, gint target_width)
     loader->font_width = width;
     loader->font_height = height;
     loader->baseline_ofs = baseline;
+    loader->req_width = req_width;
+    loader->req_height = req_height;
     success = TRUE;
 
 out:
@@ -328,6 +364,8 @@ find_best_pixel_size_fixed (FontLoader *loader, gint target_width)
     loader->font_width = best_width;
     loader->font_height = best_height;
     loader->baseline_ofs = best_baseline;
+    loader->req_width = best_width;
+    loader->req_height = best_height;
 
     success = TRUE;
 
@@ -335,6 +373,168 @@ out:
     return success;
 }
 
+static void
+generate_glyph (const FontLoader *loader, const FT_GlyphSlot slot, gpointer *glyph_out)
+{
+    guint8 *glyph_data;
+    gint i, j;
+    const guint8 val [2] = { 0x00, 0xff };
+
+    glyph_data = g_malloc (loader->font_width * loader->font_height * 4);
+
+    for (j = 0; j < loader->font_height; j++)
+    {
+        for (i = 0; i < loader->font_width; i++)
+        {
+            guint b = get_bitmap_bit (loader, slot, i, j);
+
+            if (b)
+            {
+                DEBUG (g_printerr ("XX"));
+            }
+            else
+            {
+                DEBUG (g_printerr (".."));
+            }
+
+            glyph_data [(j * loader->font_width + i) * 4] = val [b];
+            glyph_data [(j * loader->font_width + i) * 4 + 1] = val [b];
+            glyph_data [(j * loader->font_width + i) * 4 + 2] = val [b];
+            glyph_data [(j * loader->font_width + i) * 4 + 3] = val [b];
+        }
+
+        DEBUG (g_printerr ("\n"));
+    }
+
+    DEBUG (g_printerr ("\n"));
+
+    *glyph_out = glyph_data;
+}
+
+/* FreeType faces can't be shared between threads, so each batch opens its
+ * own library and face on the same memory. */
+static gpointer
+render_batch_thread_func (RenderBatch *batch)
+{
+    const FontLoader *loader = batch->loader;
+    FT_Library ft_lib;
+    FT_Face ft_face = NULL;
+    gint i;
+
+    if (FT_Init_FreeType (&ft_lib) != 0)
+        return NULL;
+
+    if (FT_New_Memory_Face (ft_lib, loader->file_data, loader->file_data_len,
+                            0, &ft_face))
+        goto out;
+
+    if (FT_Set_Pixel_Sizes (ft_face, loader->req_width, loader->req_height))
+        goto out;
+
+    for (i = 0; i < batch->n_glyphs; i++)
+    {
+        FontGlyph *glyph = &batch->glyphs [i];
+
+        if (FT_Load_Glyph (ft_face, glyph->index, FT_LOAD_RENDER | FT_LOAD_MONOCHROME | FT_LOAD_TARGET_MONO))
+            continue;
+
+        generate_glyph (loader, ft_face->glyph, &glyph->data);
+
+        DEBUG (g_printerr ("Loaded symbol %04x: %dx%d (ofs %d,%d bmsize %dx%d xadv %d/64=%d)\n",
+                           (guint) glyph->charcode,
+                           loader->font_width, loader->font_height,
+                           ft_face->glyph->bitmap_left, ft_face->glyph->bitmap_top,
+                           ft_face->glyph->bitmap.width, ft_face->glyph->bitmap.rows,
+                           (gint) ft_face->glyph->advance.x,
+                           (gint) ft_face->glyph->advance.x >> 6));
+    }
+
+out:
+    if (ft_face)
+        FT_Done_Face (ft_face);
+    FT_Done_FreeType (ft_lib);
+    return NULL;
+}
+
+static void
+clear_glyphs (FontLoader *loader)
+{
+    gint i;
+
+    /* Glyphs that were handed out belong to the caller */
+    for (i = loader->n_glyphs_read; i < loader->n_glyphs; i++)
+        g_free (loader->glyphs [i].data);
+
+    g_free (loader->glyphs);
+    loader->glyphs = NULL;
+    loader->n_glyphs = 0;
+    loader->n_glyphs_read = 0;
+}
+
+/* Rendering is the slow part of loading big fonts, so the glyphs in a pass
+ * are split into contiguous batches and rendered in parallel. */
+static void
+render_pass (FontLoader *loader)
+{
+    FT_ULong charcode;
+    FT_UInt index;
+    RenderBatch *batches;
+    GThread **threads;
+    gint n_threads, n_alloc = 0;
+    gint i, first;
+
+    clear_glyphs (loader);
+
+    for (charcode = FT_Get_First_Char (loader->ft_face, &index);
+         index != 0;
+         charcode = FT_Get_Next_Char (loader->ft_face, charcode, &index))
+    {
+        if (!is_glyph_in_pass (loader->pass, charcode))
+            continue;
+
+        if (loader->n_glyphs == n_alloc)
+        {
+            n_alloc = MAX (n_alloc * 2, 256);
+            loader->glyphs = g_renew (FontGlyph, loader->glyphs, n_alloc);
+        }
+
+        loader->glyphs [loader->n_glyphs].charcode = charcode;
+        loader->glyphs [loader->n_glyphs].index = index;
+        loader->glyphs [loader->n_glyphs].data = NULL;
+        loader->n_glyphs++;
+    }
+
+    n_threads = MIN (chafa_get_n_actual_threads (), loader->n_glyphs / GLYPHS_PER_THREAD_MIN);
+    n_threads = MAX (n_threads, 1);
+
+    batches = g_new (RenderBatch, n_threads);
+    threads = g_new0 (GThread *, n_threads);
+
+    for (i = 0, first = 0; i < n_threads; i++)
+    {
+        gint next = ((i + 1) * loader->n_glyphs) / n_threads;
+
+        batches [i].loader = loader;
+        batches [i].glyphs = loader->glyphs + first;
+        batches [i].n_glyphs = next - first;
+        first = next;
+    }
+
+    /* The calling thread takes the first batch */
+    for (i = 1; i < n_threads; i++)
+        threads [i] = g_thread_new ("font-loader",
+                                    (GThreadFunc) render_batch_thread_func,
+                                    &batches [i]);
+
+    render_batch_thread_func (&batches [0]);
+
+    for (i = 1; i < n_threads; i++)
+        g_thread_join (threads [i]);
+
+    g_free (threads);
+    g_free (batches);
+}
+
 static gboolean
 begin_pass (FontLoader *loader, FontPass pass)
 {
@@ -357,14 +557,13 @@ begin_pass (FontLoader *loader, FontPass pass)
         g_assert_not_reached ();
     }
 
+    render_pass (loader);
     return TRUE;
 }
 
 static gboolean
 next_pass (FontLoader *loader)
 {
-    loader->n_glyphs_read = 0;
-
     if (loader->pass == FONT_PASS_NARROW)
         return begin_pass (loader, FONT_PASS_WIDE);
 
@@ -418,6 +617,8 @@ out:
 void
 font_loader_destroy (FontLoader *loader)
 {
+    clear_glyphs (loader);
+
     if (loader->mapping)
         file_mapping_destroy (loader->mapping);
 
@@ -430,47 +631,6 @@ font_loader_destroy (FontLoader *loader)
     g_free (loader);
 }
 
-static void
-generate_glyph (const FontLoader *loader, const FT_GlyphSlot slot,
-                gpointer *glyph_out, gint *width_out, gint *height_out)
-{
-    guint8 *glyph_data;
-    gint i, j;
-    const guint8 val [2] = { 0x00, 0xff };
-
-    glyph_data = g_malloc (loader->font_width * loader->font_height * 4);
-
-    for (j = 0; j < loader->font_height; j++)
-    {
-        for (i = 0; i < loader->font_width; i++)
-        {
-            guint b = get_bitmap_bit (loader, slot, i, j);
-
-            if (b)
-            {
-                DEBUG (g_printerr ("XX"));
-            }
-            else
-            {
-                DEBUG (g_printerr (".."));
-            }
-
-            glyph_data [(j * loader->font_width + i) * 4] = val [b];
-            glyph_data [(j * loader->font_width + i) * 4 + 1] = val [b];
-            glyph_data [(j * loader->font_width + i) * 4 + 2] = val [b];
-            glyph_data [(j * loader->font_width + i) * 4 + 3] = val [b];
-        }
-
-        DEBUG (g_printerr ("\n"));
-    }
-
-    DEBUG (g_printerr ("\n"));
-
-    *glyph_out = glyph_data;
-    *width_out = loader->font_width;
-    *height_out = loader->font_height;
-}
-
 /* Load a glyph to an RGBA8 output buffer of fixed size CHAFA_SYMBOL_WIDTH_PIXELS *
  * CHAFA_SYMBOL_HEIGHT_PIXELS. Each pixel will be set to either 0xffffffff (inked)
  * or 0x00000000 (uninked). */
@@ -478,60 +638,25 @@ gboolean
 font_loader_get_next_glyph (FontLoader *loader, gunichar *char_out,
                             gpointer *glyph_out, gint *width_out, gint *height_out)
 {
-    FT_GlyphSlot slot;
-    gboolean success = FALSE;
-    FT_UInt glyph_index = 0;
-
-    slot = loader->ft_face->glyph;
-
-    while (!glyph_index)
+    for (;;)
     {
-        if (loader->n_glyphs_read == 0)
-        {
-            loader->glyph_charcode = FT_Get_First_Char (loader->ft_face, &glyph_index);
-        }
-        else
-        {
-            loader->glyph_charcode = FT_Get_Next_Char (loader->ft_face, loader->glyph_charcode, &glyph_index);
-        }
+        FontGlyph *glyph;
 
-        if (!glyph_index)
+        if (loader->n_glyphs_read == loader->n_glyphs)
         {
             if (next_pass (loader))
                 continue;
-            break;
+            return FALSE;
         }
 
-        loader->n_glyphs_read++;
+        glyph = &loader->glyphs [loader->n_glyphs_read++];
+        if (!glyph->data)
+            continue;
 
-        /* Skip glyphs that are not relevant to this pass */
-        if (!g_unichar_isprint (loader->glyph_charcode)
-            || g_unichar_ismark (loader->glyph_charcode)
-            || (loader->pass == FONT_PASS_NARROW && g_unichar_iswide (loader->glyph_charcode))
-            || (loader->pass == FONT_PASS_WIDE && !g_unichar_iswide (loader->glyph_charcode)))
-            glyph_index = 0;
+        *char_out = glyph->charcode;
+        *glyph_out = glyph->data;
+        *width_out = loader->font_width;
+        *height_out = loader->font_height;
+        return TRUE;
     }
-
-    if (!glyph_index)
-        goto out;
-
-    if (FT_Load_Glyph (loader->ft_face, glyph_index, FT_LOAD_RENDER | FT_LOAD_MONOCHROME | FT_LOAD_TARGET_MONO))
-        goto out;
-
-    generate_glyph (loader, slot, glyph_out, width_out, height_out);
-    *char_out = loader->glyph_charcode;
-
-    DEBUG (g_printerr ("Loaded symbol %04x: %dx%d -> %dx%d (ofs %d,%d bmsize %dx%d xadv %d/64=%d)\n",
-                       *char_out,
-                       loader->font_width, loader->font_height,
-                       *width_out, *height_out,
-                       slot->bitmap_left, slot->bitmap_top,
-                       slot->bitmap.width, slot->bitmap.rows,
-                       (gint) slot->advance.x,
-                       (gint) slot->advance.x >> 6));
-
-    success = TRUE;
-
-out:
-    return success;
 }
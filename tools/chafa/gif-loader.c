@@ -67,6 +67,7 @@ maybe_decode_frame (GifLoader *loader)
 
     code = gif_decode_frame (&loader->gif, loader->current_frame_index);
     loader->frame_is_success = (code == GIF_OK ? TRUE : FALSE);
+    loader->frame_is_decoded = TRUE;
 
     return loader->frame_is_success;
 }
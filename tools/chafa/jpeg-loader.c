@@ -38,6 +38,12 @@
 #define BYTES_PER_PIXEL 3
 #define ROWSTRIDE_ALIGN 16
 
+/* Restart-marker segments are decoded in parallel if the source image has
+ * at least this many pixels. Each thread needs a few MCU rows to be worth
+ * the setup. */
+#define PARALLEL_PIXELS_MIN (1024 * 1024)
+#define SEGMENT_MCU_ROWS_MIN 4
+
 #define PAD_TO_N(p, n) (((p) + ((n) - 1)) & ~((unsigned) (n) - 1))
 #define ROWSTRIDE_PAD(rowstride) (PAD_TO_N ((rowstride), (ROWSTRIDE_ALIGN)))
 
@@ -408,6 +414,382 @@ my_jpeg_error_exit (j_common_ptr cinfo)
     longjmp (my_jerr->setjmp_buffer, 1);
 }
 
+/* --- Parallel decoding --- */
+
+/* Baseline and extended sequential JPEGs with restart markers can be split
+ * into independent pieces. Decoding state is reset at each marker, so a
+ * piece that starts at a marker and spans whole MCU rows can be decoded as
+ * an image of its own: we give the decoder a copy of the headers with the
+ * height patched, followed by the piece's entropy-coded data straight from
+ * the file mapping.
+ *
+ * The decoder expects the first marker it sees to be RST0, and the markers
+ * count modulo 8, so pieces must start after every eighth interval.
+ *
+ * Smooth chroma upsampling treats piece boundaries like image edges, so in
+ * subsampled images, the two rows at each boundary can differ a little in
+ * color from a serial decode. DCT-scaled output is unaffected. */
+
+static const JOCTET eoi_bytes [2] = { 0xff, JPEG_EOI };
+
+typedef struct
+{
+    struct jpeg_source_mgr pub;
+    const JOCTET *chunks [3];
+    gsize chunk_lens [3];
+    gint n_chunks;
+    gint next_chunk;
+}
+ChunkSource;
+
+static boolean
+chunk_fill_input_buffer (j_decompress_ptr cinfo)
+{
+    ChunkSource *src = (ChunkSource *) cinfo->src;
+
+    if (src->next_chunk >= src->n_chunks)
+        ERREXIT (cinfo, JERR_INPUT_EMPTY);
+
+    src->pub.next_input_byte = src->chunks [src->next_chunk];
+    src->pub.bytes_in_buffer = src->chunk_lens [src->next_chunk];
+    src->next_chunk++;
+    return TRUE;
+}
+
+static void
+chunk_skip_input_data (j_decompress_ptr cinfo, long num_bytes)
+{
+    struct jpeg_source_mgr *src = cinfo->src;
+
+    if (num_bytes <= 0)
+        return;
+
+    while ((size_t) num_bytes > src->bytes_in_buffer)
+    {
+        num_bytes -= (long) src->bytes_in_buffer;
+        (void) (*src->fill_input_buffer) (cinfo);
+    }
+
+    src->next_input_byte += (size_t) num_bytes;
+    src->bytes_in_buffer -= (size_t) num_bytes;
+}
+
+static void
+chunk_src (j_decompress_ptr cinfo, const JOCTET *header, gsize header_len,
+           const JOCTET *data, gsize data_len)
+{
+    ChunkSource *src;
+
+    src = (ChunkSource *)
+        (*cinfo->mem->alloc_small) ((j_common_ptr) cinfo, JPOOL_PERMANENT,
+                                    sizeof (ChunkSource));
+    cinfo->src = (struct jpeg_source_mgr *) src;
+
+    src->pub.init_source = init_source;
+    src->pub.fill_input_buffer = chunk_fill_input_buffer;
+    src->pub.skip_input_data = chunk_skip_input_data;
+    src->pub.resync_to_restart = jpeg_resync_to_restart;
+    src->pub.term_source = term_source;
+    src->pub.bytes_in_buffer = 0;
+    src->pub.next_input_byte = NULL;
+
+    src->chunks [0] = header;
+    src->chunk_lens [0] = header_len;
+    src->chunks [1] = data;
+    src->chunk_lens [1] = data_len;
+    src->chunks [2] = eoi_bytes;
+    src->chunk_lens [2] = sizeof (eoi_bytes);
+    src->n_chunks = 3;
+    src->next_chunk = 0;
+}
+
+typedef struct
+{
+    /* Headers up to and including SOS, with the height to patch at
+     * height_ofs */
+    const guint8 *header;
+    gsize header_len;
+    gsize height_ofs;
+
+    guint scale_denom;
+    guint out_width;
+    guchar *frame_data;
+    guint rowstride;
+
+    /* Pieces of entropy-coded data. Piece i covers source rows from
+     * first_row [i] to first_row [i + 1], and decodes into output rows from
+     * first_out_row [i] to first_out_row [i + 1]. */
+    const guint8 **piece_data;
+    gsize *piece_lens;
+    guint *first_row;
+    guint *first_out_row;
+    gint n_pieces;
+
+    gint next_piece;
+    gint failed;
+}
+DecodeCtx;
+
+static gboolean
+decode_piece (DecodeCtx *ctx, gint piece, guint8 *header)
+{
+    struct jpeg_decompress_struct cinfo;
+    struct my_jpeg_error_mgr my_jerr;
+    guint height = ctx->first_row [piece + 1] - ctx->first_row [piece];
+    guint n_out_rows = ctx->first_out_row [piece + 1] - ctx->first_out_row [piece];
+    guchar *dest = ctx->frame_data + ctx->first_out_row [piece] * (gsize) ctx->rowstride;
+    volatile gboolean have_decompress = FALSE;
+    volatile gboolean success = FALSE;
+
+    header [ctx->height_ofs] = height >> 8;
+    header [ctx->height_ofs + 1] = height & 0xff;
+
+    cinfo.err = jpeg_std_error ((struct jpeg_error_mgr *) &my_jerr);
+    my_jerr.jerr.error_exit = my_jpeg_error_exit;
+    if (setjmp (my_jerr.setjmp_buffer))
+        goto out;
+
+    jpeg_create_decompress (&cinfo);
+    have_decompress = TRUE;
+
+    chunk_src (&cinfo, header, ctx->header_len,
+               ctx->piece_data [piece], ctx->piece_lens [piece]);
+    (void) jpeg_read_header (&cinfo, TRUE);
+
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.output_components = 3;
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = ctx->scale_denom;
+
+    jpeg_start_decompress (&cinfo);
+
+    if (cinfo.output_width != ctx->out_width || cinfo.output_height != n_out_rows)
+        goto out;
+
+    while (cinfo.output_scanline < n_out_rows)
+    {
+        guchar *row_data = dest + cinfo.output_scanline * (gsize) ctx->rowstride;
+        if (jpeg_read_scanlines (&cinfo, &row_data, 1) < 1)
+            goto out;
+    }
+
+    success = TRUE;
+
+out:
+    /* Destroying also aborts, so there's no need to read up to EOI */
+    if (have_decompress)
+        jpeg_destroy_decompress (&cinfo);
+    return success;
+}
+
+static gpointer
+decode_thread_func (DecodeCtx *ctx)
+{
+    guint8 *header;
+    gint piece;
+
+    /* Each thread patches its own copy */
+    header = g_memdup (ctx->header, ctx->header_len);
+
+    while (!g_atomic_int_get (&ctx->failed)
+           && (piece = g_atomic_int_add (&ctx->next_piece, 1)) < ctx->n_pieces)
+    {
+        if (!decode_piece (ctx, piece, header))
+        {
+            g_atomic_int_set (&ctx->failed, TRUE);
+            break;
+        }
+    }
+
+    g_free (header);
+    return NULL;
+}
+
+/* Returns the offset of the SOF marker's height field, or 0 if not found */
+static gsize
+find_sof_height (const guint8 *data, gsize len)
+{
+    gsize ofs = 2;
+
+    while (ofs + 4 <= len)
+    {
+        guint marker, seg_len;
+
+        if (data [ofs] != 0xff)
+            return 0;
+
+        /* Fill bytes */
+        if (data [ofs + 1] == 0xff)
+        {
+            ofs++;
+            continue;
+        }
+
+        marker = data [ofs + 1];
+        seg_len = read_uint16 (data + ofs + 2, TRUE);
+
+        if (marker >= 0xc0 && marker <= 0xcf
+            && marker != 0xc4 && marker != 0xc8 && marker != 0xcc)
+            return ofs + 5 <= len - 2 ? ofs + 5 : 0;
+
+        if (marker == 0xda || seg_len < 2)
+            return 0;
+
+        ofs += 2 + seg_len;
+    }
+
+    return 0;
+}
+
+/* Decodes the image into frame_data on several threads if it can be split
+ * up at restart markers. cinfo must have read the header, with the output
+ * parameters set and decompression started. Returns FALSE if the image
+ * wasn't decoded, in which case frame_data may have been partially
+ * written. */
+static gboolean
+decode_parallel (JpegLoader *loader, j_decompress_ptr cinfo, gsize scan_ofs,
+                 guchar *frame_data, guint rowstride)
+{
+    DecodeCtx ctx = { 0 };
+    const guint8 *p, *end;
+    GArray *intervals;
+    guint mcu_width, mcu_height, mcus_per_row, mcu_rows;
+    guint64 n_mcus;
+    GThread **threads;
+    gint n_threads;
+    gint i;
+    gboolean result = FALSE;
+
+    n_threads = chafa_get_n_actual_threads ();
+
+    if (n_threads < 2
+        || cinfo->restart_interval == 0
+        || cinfo->progressive_mode
+        || cinfo->comps_in_scan != cinfo->num_components
+        || cinfo->image_width * (guint64) cinfo->image_height < PARALLEL_PIXELS_MIN
+        || scan_ofs >= loader->file_data_len)
+        return FALSE;
+
+    ctx.height_ofs = find_sof_height (loader->file_data, scan_ofs);
+    if (ctx.height_ofs == 0)
+        return FALSE;
+
+    /* Single-component scans aren't interleaved, and have one block per MCU */
+    if (cinfo->comps_in_scan == 1)
+    {
+        mcu_width = DCTSIZE;
+        mcu_height = DCTSIZE;
+    }
+    else
+    {
+        mcu_width = cinfo->max_h_samp_factor * DCTSIZE;
+        mcu_height = cinfo->max_v_samp_factor * DCTSIZE;
+    }
+    mcus_per_row = (cinfo->image_width + mcu_width - 1) / mcu_width;
+    mcu_rows = (cinfo->image_height + mcu_height - 1) / mcu_height;
+    n_mcus = mcus_per_row * (guint64) mcu_rows;
+
+    /* Find where each restart interval starts. Markers can't appear in the
+     * data, since 0xff bytes are stuffed with a zero. */
+
+    intervals = g_array_new (FALSE, FALSE, sizeof (const guint8 *));
+    p = loader->file_data + scan_ofs;
+    end = loader->file_data + loader->file_data_len;
+    g_array_append_val (intervals, p);
+
+    while ((p = memchr (p, 0xff, end - p)) && p + 1 < end)
+    {
+        if (p [1] >= JPEG_RST0 && p [1] <= JPEG_RST0 + 7)
+        {
+            const guint8 *start = p + 2;
+            g_array_append_val (intervals, start);
+        }
+        else if (p [1] != 0x00 && p [1] != 0xff)
+        {
+            /* End of scan */
+            break;
+        }
+
+        p++;
+    }
+
+    if ((guint64) intervals->len
+        != (n_mcus + cinfo->restart_interval - 1) / cinfo->restart_interval)
+        goto out;
+
+    /* Pick split points at every eighth interval that starts an MCU row,
+     * spaced out so each thread gets a few pieces */
+
+    ctx.piece_data = g_new (const guint8 *, n_threads * 4 + 1);
+    ctx.piece_lens = g_new (gsize, n_threads * 4 + 1);
+    ctx.first_row = g_new (guint, n_threads * 4 + 2);
+    ctx.first_out_row = g_new (guint, n_threads * 4 + 2);
+    ctx.first_row [0] = 0;
+    ctx.first_out_row [0] = 0;
+    ctx.piece_data [0] = g_array_index (intervals, const guint8 *, 0);
+    ctx.n_pieces = 1;
+
+    for (i = 8; i < (gint) intervals->len && ctx.n_pieces < n_threads * 4; i += 8)
+    {
+        guint64 first_mcu = i * (guint64) cinfo->restart_interval;
+        guint mcu_row = first_mcu / mcus_per_row;
+        guint next_row = (ctx.n_pieces * (guint64) mcu_rows) / (n_threads * 4);
+
+        if (first_mcu % mcus_per_row != 0
+            || mcu_row < next_row
+            || mcu_row - ctx.first_row [ctx.n_pieces - 1] / mcu_height < SEGMENT_MCU_ROWS_MIN
+            || mcu_rows - mcu_row < SEGMENT_MCU_ROWS_MIN)
+            continue;
+
+        ctx.first_row [ctx.n_pieces] = mcu_row * mcu_height;
+        ctx.first_out_row [ctx.n_pieces] = mcu_row * mcu_height / cinfo->scale_denom;
+        ctx.piece_data [ctx.n_pieces] = g_array_index (intervals, const guint8 *, i);
+
+        /* The previous piece ends before the marker */
+        ctx.piece_lens [ctx.n_pieces - 1] = ctx.piece_data [ctx.n_pieces] - 2
+            - ctx.piece_data [ctx.n_pieces - 1];
+        ctx.n_pieces++;
+    }
+
+    if (ctx.n_pieces < 2)
+        goto out;
+
+    /* The last piece gets the rest of the file */
+    ctx.piece_lens [ctx.n_pieces - 1] = end - ctx.piece_data [ctx.n_pieces - 1];
+    ctx.first_row [ctx.n_pieces] = cinfo->image_height;
+    ctx.first_out_row [ctx.n_pieces] = cinfo->output_height;
+
+    ctx.header = loader->file_data;
+    ctx.header_len = scan_ofs;
+    ctx.scale_denom = cinfo->scale_denom;
+    ctx.out_width = cinfo->output_width;
+    ctx.frame_data = frame_data;
+    ctx.rowstride = rowstride;
+
+    n_threads = MIN (n_threads, ctx.n_pieces);
+    threads = g_new0 (GThread *, n_threads);
+
+    /* The calling thread pitches in too */
+    for (i = 1; i < n_threads; i++)
+        threads [i] = g_thread_new ("jpeg-decoder", (GThreadFunc) decode_thread_func, &ctx);
+
+    decode_thread_func (&ctx);
+
+    for (i = 1; i < n_threads; i++)
+        g_thread_join (threads [i]);
+
+    g_free (threads);
+    result = !ctx.failed;
+
+out:
+    g_free (ctx.piece_data);
+    g_free (ctx.piece_lens);
+    g_free (ctx.first_row);
+    g_free (ctx.first_out_row);
+    g_array_free (intervals, TRUE);
+    return result;
+}
+
 /* --- Magic probe --- */
 
 static gboolean
@@ -429,6 +811,35 @@ have_any_apptype_magic (FileMapping *mapping)
 
 /* --- Loader --- */
 
+static gboolean
+rotation_swaps_axes (RotationType rot)
+{
+    return rot == ROTATION_90 || rot == ROTATION_90_MIRROR
+        || rot == ROTATION_270 || rot == ROTATION_270_MIRROR;
+}
+
+/* Picks the largest DCT scaling denominator that keeps the decoded image at
+ * least as big as the target in both dimensions, or as big as the original
+ * where that's smaller. libjpeg can scale by 1/2, 1/4 and 1/8 at very
+ * little cost. */
+static guint
+pick_scale_denom (guint width, guint height, gint target_width, gint target_height)
+{
+    guint denom;
+
+    if (target_width < 1 || target_height < 1)
+        return 1;
+
+    for (denom = 8; denom > 1; denom /= 2)
+    {
+        if ((width + denom - 1) / denom >= MIN ((guint) target_width, width)
+            && (height + denom - 1) / denom >= MIN ((guint) target_height, height))
+            break;
+    }
+
+    return denom;
+}
+
 static JpegLoader *
 jpeg_loader_new (void)
 {
@@ -436,14 +847,16 @@ jpeg_loader_new (void)
 }
 
 JpegLoader *
-jpeg_loader_new_from_mapping (FileMapping *mapping)
+jpeg_loader_new_from_mapping (FileMapping *mapping, gint target_width, gint target_height)
 {
     guint width, height;
     guint rowstride;
+    RotationType rot;
     struct jpeg_decompress_struct cinfo;
     struct my_jpeg_error_mgr my_jerr;
     JpegLoader * volatile loader = NULL;
     unsigned char * volatile frame_data = NULL;
+    gsize scan_ofs;
     volatile gboolean have_decompress = FALSE;
     volatile gboolean success = FALSE;
 
@@ -484,9 +897,23 @@ jpeg_loader_new_from_mapping (FileMapping *mapping)
     my_jpeg_mem_src (&cinfo, loader->file_data, loader->file_data_len);
     (void) jpeg_read_header (&cinfo, TRUE);
 
+    /* The header reader stops right after the first SOS */
+    scan_ofs = cinfo.src->next_input_byte - loader->file_data;
+
     cinfo.out_color_space = JCS_RGB;
     cinfo.output_components = 3;
 
+    /* The target applies to the image after rotation */
+    rot = undo_rotation (read_orientation (loader));
+
+    cinfo.scale_num = 1;
+    if (rotation_swaps_axes (rot))
+        cinfo.scale_denom = pick_scale_denom (cinfo.image_width, cinfo.image_height,
+                                              target_height, target_width);
+    else
+        cinfo.scale_denom = pick_scale_denom (cinfo.image_width, cinfo.image_height,
+                                              target_width, target_height);
+
     jpeg_start_decompress (&cinfo);
 
     width = cinfo.output_width;
@@ -502,19 +929,21 @@ jpeg_loader_new_from_mapping (FileMapping *mapping)
 
     /* Decoding loop */
 
-    while (cinfo.output_scanline < height)
+    if (!decode_parallel (loader, &cinfo, scan_ofs, frame_data, rowstride))
     {
-        guchar *row_data = frame_data + cinfo.output_scanline * rowstride;
-        if (jpeg_read_scanlines (&cinfo, &row_data, 1) < 1)
-            goto out;
-    }
+        while (cinfo.output_scanline < height)
+        {
+            guchar *row_data = frame_data + cinfo.output_scanline * rowstride;
+            if (jpeg_read_scanlines (&cinfo, &row_data, 1) < 1)
+                goto out;
+        }
 
-    /* Orientation and cleanup */
+        (void) jpeg_finish_decompress (&cinfo);
+    }
 
-    (void) jpeg_finish_decompress (&cinfo);
+    /* Orientation */
 
-    rotate_frame ((guchar **) &frame_data, &width, &height, &rowstride, 3,
-                  undo_rotation (read_orientation (loader)));
+    rotate_frame ((guchar **) &frame_data, &width, &height, &rowstride, 3, rot);
 
     loader->frame_data = frame_data;
     loader->width = (gint) width;
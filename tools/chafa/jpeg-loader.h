@@ -27,7 +27,7 @@ G_BEGIN_DECLS
 
 typedef struct JpegLoader JpegLoader;
 
-JpegLoader *jpeg_loader_new_from_mapping (FileMapping *mapping);
+JpegLoader *jpeg_loader_new_from_mapping (FileMapping *mapping, gint target_width, gint target_height);
 void jpeg_loader_destroy (JpegLoader *loader);
 
 gboolean jpeg_loader_get_is_animation (JpegLoader *loader);
@@ -30,11 +30,13 @@
 
 #include <chafa.h>
 #include "file-mapping.h"
+#include "ffmpeg-loader.h"
 #include "gif-loader.h"
 #include "im-loader.h"
 #include "xwd-loader.h"
 #include "jpeg-loader.h"
 #include "media-loader.h"
+#include "pam-loader.h"
 #include "png-loader.h"
 #include "svg-loader.h"
 #include "tiff-loader.h"
@@ -45,10 +47,12 @@ typedef enum
     LOADER_TYPE_GIF,
     LOADER_TYPE_PNG,
     LOADER_TYPE_XWD,
+    LOADER_TYPE_PAM,
     LOADER_TYPE_JPEG,
     LOADER_TYPE_TIFF,
     LOADER_TYPE_WEBP,
     LOADER_TYPE_SVG,
+    LOADER_TYPE_FFMPEG,
     LOADER_TYPE_IMAGEMAGICK,
 
     LOADER_TYPE_LAST
@@ -59,13 +63,17 @@ static const struct
 {
     const gchar * const name;
     gpointer (*new_from_mapping) (gpointer);
+    gpointer (*new_from_mapping_with_size) (gpointer, gint, gint);
     gpointer (*new_from_path) (gconstpointer);
     void (*destroy) (gpointer);
     gboolean (*get_is_animation) (gpointer);
     void (*goto_first_frame) (gpointer);
     gboolean (*goto_next_frame) (gpointer);
     gconstpointer (*get_frame_data) (gpointer, gpointer, gpointer, gpointer, gpointer);
+    gboolean (*get_frame_rows) (gpointer, gpointer, gpointer, gpointer);
+    void (*read_frame_row) (gpointer, gint, gpointer);
     gint (*get_frame_delay) (gpointer);
+    void (*set_playback_speed) (gpointer, gdouble);
 }
 loader_vtable [LOADER_TYPE_LAST] =
 {
@@ -73,92 +81,154 @@ loader_vtable [LOADER_TYPE_LAST] =
     {
         "GIF",
         (gpointer (*)(gpointer)) gif_loader_new_from_mapping,
+        (gpointer (*)(gpointer, gint, gint)) NULL,
         (gpointer (*)(gconstpointer)) NULL,
         (void (*)(gpointer)) gif_loader_destroy,
         (gboolean (*)(gpointer)) gif_loader_get_is_animation,
         (void (*)(gpointer)) gif_loader_goto_first_frame,
         (gboolean (*)(gpointer)) gif_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) gif_loader_get_frame_data,
-        (gint (*) (gpointer)) gif_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) gif_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
     },
     [LOADER_TYPE_PNG] =
     {
         "PNG",
         (gpointer (*)(gpointer)) png_loader_new_from_mapping,
+        (gpointer (*)(gpointer, gint, gint)) NULL,
         (gpointer (*)(gconstpointer)) NULL,
         (void (*)(gpointer)) png_loader_destroy,
         (gboolean (*)(gpointer)) png_loader_get_is_animation,
         (void (*)(gpointer)) png_loader_goto_first_frame,
         (gboolean (*)(gpointer)) png_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) png_loader_get_frame_data,
-        (gint (*) (gpointer)) png_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) png_loader_get_frame_rows,
+        (void (*) (gpointer, gint, gpointer)) png_loader_read_frame_row,
+        (gint (*) (gpointer)) png_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
     },
     [LOADER_TYPE_XWD] =
     {
         "XWD",
         (gpointer (*)(gpointer)) xwd_loader_new_from_mapping,
+        (gpointer (*)(gpointer, gint, gint)) NULL,
         (gpointer (*)(gconstpointer)) NULL,
         (void (*)(gpointer)) xwd_loader_destroy,
         (gboolean (*)(gpointer)) xwd_loader_get_is_animation,
         (void (*)(gpointer)) xwd_loader_goto_first_frame,
         (gboolean (*)(gpointer)) xwd_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) xwd_loader_get_frame_data,
-        (gint (*) (gpointer)) xwd_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) xwd_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
+    },
+    [LOADER_TYPE_PAM] =
+    {
+        "PAM",
+        (gpointer (*)(gpointer)) pam_loader_new_from_mapping,
+        (gpointer (*)(gpointer, gint, gint)) NULL,
+        (gpointer (*)(gconstpointer)) NULL,
+        (void (*)(gpointer)) pam_loader_destroy,
+        (gboolean (*)(gpointer)) pam_loader_get_is_animation,
+        (void (*)(gpointer)) pam_loader_goto_first_frame,
+        (gboolean (*)(gpointer)) pam_loader_goto_next_frame,
+        (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) pam_loader_get_frame_data,
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) pam_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
     },
 #ifdef HAVE_JPEG
     [LOADER_TYPE_JPEG] =
     {
         "JPEG",
-        (gpointer (*)(gpointer)) jpeg_loader_new_from_mapping,
+        (gpointer (*)(gpointer)) NULL,
+        (gpointer (*)(gpointer, gint, gint)) jpeg_loader_new_from_mapping,
         (gpointer (*)(gconstpointer)) NULL,
         (void (*)(gpointer)) jpeg_loader_destroy,
         (gboolean (*)(gpointer)) jpeg_loader_get_is_animation,
         (void (*)(gpointer)) jpeg_loader_goto_first_frame,
         (gboolean (*)(gpointer)) jpeg_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) jpeg_loader_get_frame_data,
-        (gint (*) (gpointer)) jpeg_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) jpeg_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
     },
 #endif
 #ifdef HAVE_SVG
     [LOADER_TYPE_SVG] =
     {
         "SVG",
-        (gpointer (*)(gpointer)) svg_loader_new_from_mapping,
+        (gpointer (*)(gpointer)) NULL,
+        (gpointer (*)(gpointer, gint, gint)) svg_loader_new_from_mapping,
         (gpointer (*)(gconstpointer)) NULL,
         (void (*)(gpointer)) svg_loader_destroy,
         (gboolean (*)(gpointer)) svg_loader_get_is_animation,
         (void (*)(gpointer)) svg_loader_goto_first_frame,
         (gboolean (*)(gpointer)) svg_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) svg_loader_get_frame_data,
-        (gint (*) (gpointer)) svg_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) svg_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
     },
 #endif
 #ifdef HAVE_TIFF
     [LOADER_TYPE_TIFF] =
     {
         "TIFF",
-        (gpointer (*)(gpointer)) tiff_loader_new_from_mapping,
+        (gpointer (*)(gpointer)) NULL,
+        (gpointer (*)(gpointer, gint, gint)) tiff_loader_new_from_mapping,
         (gpointer (*)(gconstpointer)) NULL,
         (void (*)(gpointer)) tiff_loader_destroy,
         (gboolean (*)(gpointer)) tiff_loader_get_is_animation,
         (void (*)(gpointer)) tiff_loader_goto_first_frame,
         (gboolean (*)(gpointer)) tiff_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) tiff_loader_get_frame_data,
-        (gint (*) (gpointer)) tiff_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) tiff_loader_get_frame_rows,
+        (void (*) (gpointer, gint, gpointer)) tiff_loader_read_frame_row,
+        (gint (*) (gpointer)) tiff_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
     },
 #endif
 #ifdef HAVE_WEBP
     [LOADER_TYPE_WEBP] =
     {
         "WebP",
-        (gpointer (*)(gpointer)) webp_loader_new_from_mapping,
+        (gpointer (*)(gpointer)) NULL,
+        (gpointer (*)(gpointer, gint, gint)) webp_loader_new_from_mapping,
         (gpointer (*)(gconstpointer)) NULL,
         (void (*)(gpointer)) webp_loader_destroy,
         (gboolean (*)(gpointer)) webp_loader_get_is_animation,
         (void (*)(gpointer)) webp_loader_goto_first_frame,
         (gboolean (*)(gpointer)) webp_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) webp_loader_get_frame_data,
-        (gint (*) (gpointer)) webp_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) webp_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
+    },
+#endif
+#ifdef HAVE_FFMPEG
+    [LOADER_TYPE_FFMPEG] =
+    {
+        "FFmpeg",
+        (gpointer (*)(gpointer)) NULL,
+        (gpointer (*)(gpointer, gint, gint)) NULL,
+        (gpointer (*)(gconstpointer)) ffmpeg_loader_new,
+        (void (*)(gpointer)) ffmpeg_loader_destroy,
+        (gboolean (*)(gpointer)) ffmpeg_loader_get_is_animation,
+        (void (*)(gpointer)) ffmpeg_loader_goto_first_frame,
+        (gboolean (*)(gpointer)) ffmpeg_loader_goto_next_frame,
+        (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) ffmpeg_loader_get_frame_data,
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) ffmpeg_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) ffmpeg_loader_set_playback_speed
     },
 #endif
 #ifdef HAVE_MAGICKWAND
@@ -166,17 +236,53 @@ loader_vtable [LOADER_TYPE_LAST] =
     {
         "ImageMagick",
         (gpointer (*)(gpointer)) NULL,
+        (gpointer (*)(gpointer, gint, gint)) NULL,
         (gpointer (*)(gconstpointer)) im_loader_new,
         (void (*)(gpointer)) im_loader_destroy,
         (gboolean (*)(gpointer)) im_loader_get_is_animation,
         (void (*)(gpointer)) im_loader_goto_first_frame,
         (gboolean (*)(gpointer)) im_loader_goto_next_frame,
         (gconstpointer (*) (gpointer, gpointer, gpointer, gpointer, gpointer)) im_loader_get_frame_data,
-        (gint (*) (gpointer)) im_loader_get_frame_delay
+        (gboolean (*) (gpointer, gpointer, gpointer, gpointer)) NULL,
+        (void (*) (gpointer, gint, gpointer)) NULL,
+        (gint (*) (gpointer)) im_loader_get_frame_delay,
+        (void (*) (gpointer, gdouble)) NULL
     },
 #endif
 };
 
+/* Enough to cover every entry in magic_table */
+#define SNIFF_LEN 16
+
+/* Formats we can tell from the first few bytes. The first match decides
+ * which loader gets the first try. Loaders whose magic is required reject
+ * anything without it, so they're skipped entirely when it's missing. */
+static const struct
+{
+    LoaderType loader_type;
+    gboolean is_required;
+    gint ofs;
+    const gchar *magic;
+    gint len;
+}
+magic_table [] =
+{
+    { LOADER_TYPE_GIF,  TRUE,  0, "GIF89a", 6 },
+    { LOADER_TYPE_GIF,  TRUE,  0, "GIF87a", 6 },
+    { LOADER_TYPE_PNG,  TRUE,  0, "\x89PNG", 4 },
+    { LOADER_TYPE_PAM,  TRUE,  0, "P6", 2 },
+    { LOADER_TYPE_PAM,  TRUE,  0, "P7", 2 },
+    { LOADER_TYPE_JPEG, TRUE,  0, "\xff\xd8\xff", 3 },
+    { LOADER_TYPE_TIFF, TRUE,  0, "II\x2a\x00", 4 },
+    { LOADER_TYPE_TIFF, TRUE,  0, "MM\x00\x2a", 4 },
+    { LOADER_TYPE_WEBP, TRUE,  8, "WEBP", 4 },
+
+    /* SVG may start with an XML declaration, comments, etc. and XWD has
+     * no real magic, only a version field. These are hints. */
+    { LOADER_TYPE_SVG,  FALSE, 0, "<svg", 4 },
+    { LOADER_TYPE_XWD,  FALSE, 4, "\x00\x00\x00\x07", 4 }
+};
+
 struct MediaLoader
 {
     LoaderType loader_type;
@@ -191,11 +297,83 @@ ascii_strcasecmp_ptrs (const void *a, const void *b)
     return g_ascii_strcasecmp (*sa, *sb);
 }
 
+static LoaderType
+sniff_loader_type (const guint8 *buf, gint len)
+{
+    gint i;
+
+    for (i = 0; i < (gint) G_N_ELEMENTS (magic_table); i++)
+    {
+        if (magic_table [i].ofs + magic_table [i].len <= len
+            && !memcmp (buf + magic_table [i].ofs, magic_table [i].magic, magic_table [i].len))
+            return magic_table [i].loader_type;
+    }
+
+    return LOADER_TYPE_LAST;
+}
+
+static gboolean
+loader_requires_magic (LoaderType loader_type)
+{
+    gint i;
+
+    for (i = 0; i < (gint) G_N_ELEMENTS (magic_table); i++)
+    {
+        if (magic_table [i].loader_type == loader_type)
+            return magic_table [i].is_required;
+    }
+
+    return FALSE;
+}
+
+/* On success, the mapping is either transferred to the loader or destroyed,
+ * and *mapping is cleared */
+static gboolean
+try_loader (MediaLoader *loader, LoaderType loader_type, FileMapping **mapping,
+            const gchar *path, gint target_width, gint target_height)
+{
+    loader->loader_type = loader_type;
+
+    if (loader_vtable [loader_type].new_from_mapping_with_size)
+    {
+        loader->loader = loader_vtable [loader_type].new_from_mapping_with_size (*mapping,
+                                                                                 target_width,
+                                                                                 target_height);
+    }
+    else if (loader_vtable [loader_type].new_from_mapping)
+    {
+        loader->loader = loader_vtable [loader_type].new_from_mapping (*mapping);
+    }
+    else if (loader_vtable [loader_type].new_from_path)
+    {
+        loader->loader = loader_vtable [loader_type].new_from_path (path);
+        if (loader->loader)
+            file_mapping_destroy (*mapping);
+    }
+
+    if (!loader->loader)
+        return FALSE;
+
+    *mapping = NULL;
+    return TRUE;
+}
+
+/* target_width and target_height give the size in pixels the image will
+ * be fitted to, or zero if it's unknown. Loaders that can decode at a
+ * reduced size use it to skip work, but never go below it.
+ *
+ * The header is read once and matched against magic_table, so the right
+ * loader is usually the only one tried. Costly generic loaders like
+ * FFmpeg and ImageMagick are only set up when no format could be
+ * identified, or the matching loader failed. */
 MediaLoader *
-media_loader_new (const gchar *path, GError **error)
+media_loader_new (const gchar *path, gint target_width, gint target_height, GError **error)
 {
     MediaLoader *loader;
     FileMapping *mapping = NULL;
+    guint8 sniff_buf [SNIFF_LEN];
+    gssize sniff_len;
+    LoaderType sniffed_type;
     gboolean success = FALSE;
     gint i;
 
@@ -207,34 +385,28 @@ media_loader_new (const gchar *path, GError **error)
     if (!file_mapping_open_now (mapping, error))
         goto out;
 
-    for (i = 0; i < LOADER_TYPE_LAST && !loader->loader; i++)
+    sniff_len = file_mapping_read (mapping, sniff_buf, 0, SNIFF_LEN);
+    sniffed_type = sniff_loader_type (sniff_buf, MAX (sniff_len, 0));
+
+    if (sniffed_type != LOADER_TYPE_LAST
+        && try_loader (loader, sniffed_type, &mapping, path, target_width, target_height))
     {
-        loader->loader_type = i;
+        success = TRUE;
+        goto out;
+    }
 
-        if (mapping && loader_vtable [i].new_from_mapping)
-        {
-            loader->loader = loader_vtable [i].new_from_mapping (mapping);
-        }
-        else if (loader_vtable [i].new_from_path)
-        {
-            loader->loader = loader_vtable [i].new_from_path (path);
-            if (loader->loader)
-                file_mapping_destroy (mapping);
-        }
+    for (i = 0; i < LOADER_TYPE_LAST; i++)
+    {
+        if (i == (gint) sniffed_type || loader_requires_magic (i))
+            continue;
 
-        if (loader->loader)
+        if (try_loader (loader, i, &mapping, path, target_width, target_height))
         {
-            /* Mapping was either transferred to the loader or destroyed by us above */
-            mapping = NULL;
+            success = TRUE;
             break;
         }
     }
 
-    if (!loader->loader)
-        goto out;
-
-    success = TRUE;
-
 out:
     if (!success)
     {
@@ -292,12 +464,42 @@ media_loader_get_frame_data (MediaLoader *loader, ChafaPixelType *pixel_type_out
                                                                width_out, height_out, rowstride_out);
 }
 
+/* Returns TRUE if the current frame can be read a row at a time with
+ * media_loader_read_frame_row (), so it never has to be held in memory
+ * in full. */
+gboolean
+media_loader_get_frame_rows (MediaLoader *loader, ChafaPixelType *pixel_type_out,
+                             gint *width_out, gint *height_out)
+{
+    if (!loader_vtable [loader->loader_type].get_frame_rows)
+        return FALSE;
+
+    return loader_vtable [loader->loader_type].get_frame_rows (loader->loader, pixel_type_out,
+                                                               width_out, height_out);
+}
+
+/* Rows must be read in ascending order */
+void
+media_loader_read_frame_row (MediaLoader *loader, gint row, gpointer row_out)
+{
+    loader_vtable [loader->loader_type].read_frame_row (loader->loader, row, row_out);
+}
+
 gint
 media_loader_get_frame_delay (MediaLoader *loader)
 {
     return loader_vtable [loader->loader_type].get_frame_delay (loader->loader);
 }
 
+/* Lets loaders that decode ahead drop frames they can't show in time. Has
+ * no effect on the others. */
+void
+media_loader_set_playback_speed (MediaLoader *loader, gdouble speed)
+{
+    if (loader_vtable [loader->loader_type].set_playback_speed)
+        loader_vtable [loader->loader_type].set_playback_speed (loader->loader, speed);
+}
+
 gchar **
 get_loader_names (void)
 {
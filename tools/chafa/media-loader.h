@@ -26,7 +26,8 @@ G_BEGIN_DECLS
 
 typedef struct MediaLoader MediaLoader;
 
-MediaLoader *media_loader_new (const gchar *path, GError **error);
+MediaLoader *media_loader_new (const gchar *path, gint target_width, gint target_height,
+                               GError **error);
 void media_loader_destroy (MediaLoader *loader);
 
 gboolean media_loader_get_is_animation (MediaLoader *loader);
@@ -36,7 +37,11 @@ gboolean media_loader_goto_next_frame (MediaLoader *loader);
 
 gconstpointer media_loader_get_frame_data (MediaLoader *loader, ChafaPixelType *pixel_type_out,
                                            gint *width_out, gint *height_out, gint *rowstride_out);
+gboolean media_loader_get_frame_rows (MediaLoader *loader, ChafaPixelType *pixel_type_out,
+                                      gint *width_out, gint *height_out);
+void media_loader_read_frame_row (MediaLoader *loader, gint row, gpointer row_out);
 gint media_loader_get_frame_delay (MediaLoader *loader);
+void media_loader_set_playback_speed (MediaLoader *loader, gdouble speed);
 
 gchar **get_loader_names (void);
 
@@ -0,0 +1,377 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <chafa.h>
+#include "output-writer.h"
+
+/* Segments handed to a single writev () call. POSIX guarantees at least 16;
+ * every system we care about allows 1024 */
+#if defined (IOV_MAX) && IOV_MAX < 256
+# define IOV_BATCH_MAX IOV_MAX
+#else
+# define IOV_BATCH_MAX 256
+#endif
+
+/* Padding segments all point into this */
+#define SPACES_LEN 256
+
+/* A copy of the data passed in one call. The segments cut from it share it,
+ * and the last one to be written frees it */
+typedef struct
+{
+    gint n_refs;
+    gchar data [1];
+}
+OutputBlock;
+
+typedef struct
+{
+    /* NULL for padding */
+    OutputBlock *block;
+    const gchar *data;
+    gsize len;
+}
+OutputSegment;
+
+struct OutputWriter
+{
+    gint fd;
+    gsize max_queued_bytes;
+
+    GThread *thread;
+    GMutex mutex;
+
+    /* Signaled when segments are queued, and when the queue shrinks */
+    GCond data_cond;
+    GCond space_cond;
+
+    /* Segments stay at the head of the queue until they're fully written,
+     * so an empty queue means everything is out */
+    GQueue segments;
+    gsize queued_bytes;
+
+    guint failed : 1;
+    guint shutting_down : 1;
+};
+
+static gchar spaces [SPACES_LEN];
+
+static OutputBlock *
+block_new (gconstpointer data, gsize len)
+{
+    OutputBlock *block;
+
+    block = g_malloc (G_STRUCT_OFFSET (OutputBlock, data) + len);
+    block->n_refs = 0;
+    memcpy (block->data, data, len);
+    return block;
+}
+
+/* Must be called with the mutex held */
+static void
+push_segment (OutputWriter *output_writer, OutputBlock *block, const gchar *data, gsize len)
+{
+    OutputSegment *segment;
+
+    if (len == 0)
+        return;
+
+    segment = g_new (OutputSegment, 1);
+    segment->block = block;
+    segment->data = data;
+    segment->len = len;
+
+    if (block)
+        block->n_refs++;
+
+    g_queue_push_tail (&output_writer->segments, segment);
+    output_writer->queued_bytes += len;
+}
+
+/* Must be called with the mutex held */
+static void
+push_spaces (OutputWriter *output_writer, gint n)
+{
+    while (n > 0)
+    {
+        gint len = MIN (n, SPACES_LEN);
+
+        push_segment (output_writer, NULL, spaces, len);
+        n -= len;
+    }
+}
+
+/* Must be called with the mutex held */
+static void
+pop_segment (OutputWriter *output_writer)
+{
+    OutputSegment *segment = g_queue_pop_head (&output_writer->segments);
+
+    output_writer->queued_bytes -= segment->len;
+
+    if (segment->block && --segment->block->n_refs == 0)
+        g_free (segment->block);
+
+    g_free (segment);
+}
+
+/* Blocks until there's room for len more bytes. A write larger than the
+ * limit is let through once the queue is empty. Must be called with the
+ * mutex held. */
+static gboolean
+wait_for_space (OutputWriter *output_writer, gsize len)
+{
+    while (!output_writer->failed
+           && output_writer->queued_bytes > 0
+           && output_writer->queued_bytes + len > output_writer->max_queued_bytes)
+        g_cond_wait (&output_writer->space_cond, &output_writer->mutex);
+
+    return !output_writer->failed;
+}
+
+static gboolean
+write_iov (gint fd, struct iovec *iov, gint n_iov)
+{
+    while (n_iov > 0)
+    {
+        gssize n = writev (fd, iov, n_iov);
+
+        if (n < 0)
+        {
+            if (errno == EINTR || errno == EAGAIN)
+                continue;
+            return FALSE;
+        }
+
+        /* Skip what was written, possibly stopping partway into a segment */
+        while (n_iov > 0 && (gsize) n >= iov->iov_len)
+        {
+            n -= iov->iov_len;
+            iov++;
+            n_iov--;
+        }
+
+        if (n_iov > 0)
+        {
+            iov->iov_base = (gchar *) iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+
+    return TRUE;
+}
+
+static gpointer
+writer_thread_func (gpointer data)
+{
+    OutputWriter *output_writer = data;
+    struct iovec iov [IOV_BATCH_MAX];
+
+    g_mutex_lock (&output_writer->mutex);
+
+    for (;;)
+    {
+        GList *l;
+        gint n_iov = 0;
+        gboolean success;
+        gint64 start_us;
+        gint i;
+
+        while (g_queue_is_empty (&output_writer->segments) && !output_writer->shutting_down)
+            g_cond_wait (&output_writer->data_cond, &output_writer->mutex);
+
+        /* Drain the queue before shutting down */
+        if (g_queue_is_empty (&output_writer->segments))
+            break;
+
+        /* The producer only appends, so the segments we gather stay put
+         * while we write them without holding the lock */
+        for (l = output_writer->segments.head; l && n_iov < IOV_BATCH_MAX; l = l->next)
+        {
+            OutputSegment *segment = l->data;
+
+            iov [n_iov].iov_base = (gpointer) segment->data;
+            iov [n_iov].iov_len = segment->len;
+            n_iov++;
+        }
+
+        g_mutex_unlock (&output_writer->mutex);
+        start_us = g_get_monotonic_time ();
+        success = write_iov (output_writer->fd, iov, n_iov);
+        chafa_add_trace_event ("write", start_us, g_get_monotonic_time (), 0, -1);
+        g_mutex_lock (&output_writer->mutex);
+
+        for (i = 0; i < n_iov; i++)
+            pop_segment (output_writer);
+
+        if (!success)
+        {
+            /* Nobody's listening; discard the rest */
+            output_writer->failed = TRUE;
+            while (!g_queue_is_empty (&output_writer->segments))
+                pop_segment (output_writer);
+        }
+
+        g_cond_broadcast (&output_writer->space_cond);
+    }
+
+    g_mutex_unlock (&output_writer->mutex);
+    return NULL;
+}
+
+OutputWriter *
+output_writer_new (gint fd, gsize max_queued_bytes)
+{
+    OutputWriter *output_writer;
+
+    if (spaces [0] != ' ')
+        memset (spaces, ' ', SPACES_LEN);
+
+    output_writer = g_new0 (OutputWriter, 1);
+    output_writer->fd = fd;
+    output_writer->max_queued_bytes = max_queued_bytes;
+
+    g_mutex_init (&output_writer->mutex);
+    g_cond_init (&output_writer->data_cond);
+    g_cond_init (&output_writer->space_cond);
+    g_queue_init (&output_writer->segments);
+
+    output_writer->thread = g_thread_new ("output-writer", writer_thread_func, output_writer);
+    return output_writer;
+}
+
+/* Writes out everything that's still queued before returning */
+void
+output_writer_destroy (OutputWriter *output_writer)
+{
+    g_mutex_lock (&output_writer->mutex);
+    output_writer->shutting_down = TRUE;
+    g_cond_signal (&output_writer->data_cond);
+    g_mutex_unlock (&output_writer->mutex);
+
+    g_thread_join (output_writer->thread);
+
+    g_mutex_clear (&output_writer->mutex);
+    g_cond_clear (&output_writer->data_cond);
+    g_cond_clear (&output_writer->space_cond);
+    g_free (output_writer);
+}
+
+/* Queues a copy of the data. Only blocks if the queue is full. */
+gboolean
+output_writer_write (OutputWriter *output_writer, gconstpointer data, gsize len)
+{
+    return output_writer_write_lines (output_writer, data, len, 0, NULL);
+}
+
+gboolean
+output_writer_write_spaces (OutputWriter *output_writer, gint n)
+{
+    gboolean result = FALSE;
+
+    g_assert (n >= 0);
+
+    g_mutex_lock (&output_writer->mutex);
+
+    if (wait_for_space (output_writer, n))
+    {
+        push_spaces (output_writer, n);
+        g_cond_signal (&output_writer->data_cond);
+        result = TRUE;
+    }
+
+    g_mutex_unlock (&output_writer->mutex);
+    return result;
+}
+
+/* Like output_writer_write (), but puts indent spaces in front of every line.
+ * The padding is queued as separate segments, so the data is only copied
+ * once. *at_line_start carries over between calls, since lines may be split
+ * across them. */
+gboolean
+output_writer_write_lines (OutputWriter *output_writer, gconstpointer data, gsize len,
+                           gint indent, gboolean *at_line_start)
+{
+    OutputBlock *block;
+    const gchar *p0, *p1, *end;
+    gboolean result = FALSE;
+
+    if (len == 0)
+        return TRUE;
+
+    /* Copy outside the lock, so the writer can keep going meanwhile */
+    block = block_new (data, len);
+
+    g_mutex_lock (&output_writer->mutex);
+
+    if (!wait_for_space (output_writer, len))
+    {
+        g_free (block);
+        goto out;
+    }
+
+    if (indent <= 0)
+    {
+        push_segment (output_writer, block, block->data, len);
+    }
+    else
+    {
+        for (p0 = block->data, end = p0 + len; p0 < end; p0 = p1)
+        {
+            if (*at_line_start)
+                push_spaces (output_writer, indent);
+
+            p1 = memchr (p0, '\n', end - p0);
+            p1 = p1 ? p1 + 1 : end;
+            *at_line_start = (p1 [-1] == '\n');
+
+            push_segment (output_writer, block, p0, p1 - p0);
+        }
+    }
+
+    g_cond_signal (&output_writer->data_cond);
+    result = TRUE;
+
+out:
+    g_mutex_unlock (&output_writer->mutex);
+    return result;
+}
+
+/* Waits for everything queued so far to be written */
+gboolean
+output_writer_flush (OutputWriter *output_writer)
+{
+    gboolean result;
+
+    g_mutex_lock (&output_writer->mutex);
+
+    while (!g_queue_is_empty (&output_writer->segments) && !output_writer->failed)
+        g_cond_wait (&output_writer->space_cond, &output_writer->mutex);
+
+    result = !output_writer->failed;
+    g_mutex_unlock (&output_writer->mutex);
+    return result;
+}
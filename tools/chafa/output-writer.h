@@ -0,0 +1,40 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef __OUTPUT_WRITER_H__
+#define __OUTPUT_WRITER_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+typedef struct OutputWriter OutputWriter;
+
+OutputWriter *output_writer_new (gint fd, gsize max_queued_bytes);
+void output_writer_destroy (OutputWriter *output_writer);
+
+gboolean output_writer_write (OutputWriter *output_writer, gconstpointer data, gsize len);
+gboolean output_writer_write_spaces (OutputWriter *output_writer, gint n);
+gboolean output_writer_write_lines (OutputWriter *output_writer, gconstpointer data, gsize len,
+                                    gint indent, gboolean *at_line_start);
+gboolean output_writer_flush (OutputWriter *output_writer);
+
+G_END_DECLS
+
+#endif /* __OUTPUT_WRITER_H__ */
@@ -0,0 +1,300 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+
+#include <chafa.h>
+#include "pam-loader.h"
+
+/* Loads binary PPM (P6) and PAM (P7) files, as written by screen grabbers
+ * and framebuffer dumpers. Only 8-bit RGB(A) is accepted, since that can
+ * be used straight out of the mapping. Anything else is left to the more
+ * general loaders. */
+
+/* PAM headers are short; this is way more than enough */
+#define HEADER_LEN_MAX 4096
+
+struct PamLoader
+{
+    FileMapping *mapping;
+    gconstpointer image_data;
+    gint width, height, rowstride;
+    ChafaPixelType pixel_type;
+};
+
+typedef struct
+{
+    const gchar *p, *end;
+}
+HeaderParser;
+
+static void
+skip_space_and_comments (HeaderParser *parser)
+{
+    while (parser->p < parser->end)
+    {
+        if (*parser->p == '#')
+        {
+            while (parser->p < parser->end && *parser->p != '\n')
+                parser->p++;
+        }
+        else if (g_ascii_isspace (*parser->p))
+        {
+            parser->p++;
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+/* Copies the next whitespace-delimited token to buf */
+static gboolean
+next_token (HeaderParser *parser, gchar *buf, gsize buf_len)
+{
+    gsize len = 0;
+
+    skip_space_and_comments (parser);
+
+    while (parser->p < parser->end && !g_ascii_isspace (*parser->p))
+    {
+        if (len + 1 >= buf_len)
+            return FALSE;
+        buf [len++] = *parser->p++;
+    }
+
+    buf [len] = '\0';
+    return len > 0;
+}
+
+static gboolean
+next_uint (HeaderParser *parser, gint *out)
+{
+    gchar buf [16];
+    gchar *end;
+    guint64 n;
+
+    if (!next_token (parser, buf, sizeof (buf))
+        || !g_ascii_isdigit (buf [0]))
+        return FALSE;
+
+    n = g_ascii_strtoull (buf, &end, 10);
+    if (*end != '\0' || n < 1 || n > 65535)
+        return FALSE;
+
+    *out = n;
+    return TRUE;
+}
+
+static gboolean
+parse_ppm_header (HeaderParser *parser, gint *width, gint *height,
+                  gint *depth, gint *maxval)
+{
+    *depth = 3;
+
+    return next_uint (parser, width)
+        && next_uint (parser, height)
+        && next_uint (parser, maxval);
+}
+
+static gboolean
+parse_pam_header (HeaderParser *parser, gint *width, gint *height,
+                  gint *depth, gint *maxval, gboolean *has_alpha)
+{
+    gchar key [16];
+    gchar tuple_type [32];
+
+    *width = *height = *depth = *maxval = 0;
+    *has_alpha = FALSE;
+
+    for (;;)
+    {
+        if (!next_token (parser, key, sizeof (key)))
+            return FALSE;
+
+        if (!strcmp (key, "ENDHDR"))
+            break;
+        else if (!strcmp (key, "WIDTH"))
+        {
+            if (!next_uint (parser, width))
+                return FALSE;
+        }
+        else if (!strcmp (key, "HEIGHT"))
+        {
+            if (!next_uint (parser, height))
+                return FALSE;
+        }
+        else if (!strcmp (key, "DEPTH"))
+        {
+            if (!next_uint (parser, depth))
+                return FALSE;
+        }
+        else if (!strcmp (key, "MAXVAL"))
+        {
+            if (!next_uint (parser, maxval))
+                return FALSE;
+        }
+        else if (!strcmp (key, "TUPLTYPE"))
+        {
+            if (!next_token (parser, tuple_type, sizeof (tuple_type)))
+                return FALSE;
+            if (!strcmp (tuple_type, "RGB_ALPHA"))
+                *has_alpha = TRUE;
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    /* A four-channel image without a tuple type is still most likely RGBA */
+    if (*depth == 4)
+        *has_alpha = TRUE;
+
+    return *width > 0 && *height > 0 && *depth > 0;
+}
+
+static PamLoader *
+pam_loader_new (void)
+{
+    return g_new0 (PamLoader, 1);
+}
+
+PamLoader *
+pam_loader_new_from_mapping (FileMapping *mapping)
+{
+    PamLoader *loader = NULL;
+    HeaderParser parser;
+    const gchar *file_data;
+    gsize file_data_len;
+    gint width, height, depth, maxval;
+    gboolean has_alpha = FALSE;
+    gboolean success = FALSE;
+
+    g_return_val_if_fail (mapping != NULL, NULL);
+
+    if (!file_mapping_has_magic (mapping, 0, "P6", 2)
+        && !file_mapping_has_magic (mapping, 0, "P7", 2))
+        return NULL;
+
+    file_data = file_mapping_get_data (mapping, &file_data_len);
+    if (!file_data)
+        return NULL;
+
+    parser.p = file_data + 2;
+    parser.end = file_data + MIN (file_data_len, HEADER_LEN_MAX);
+
+    if (file_data [1] == '6')
+    {
+        if (!parse_ppm_header (&parser, &width, &height, &depth, &maxval))
+            goto out;
+    }
+    else
+    {
+        if (!parse_pam_header (&parser, &width, &height, &depth, &maxval, &has_alpha))
+            goto out;
+    }
+
+    /* Exactly one whitespace character separates the header from the pixels */
+    if (parser.p >= parser.end || !g_ascii_isspace (*parser.p))
+        goto out;
+    parser.p++;
+
+    if (maxval != 255
+        || !((depth == 3 && !has_alpha) || (depth == 4 && has_alpha)))
+        goto out;
+
+    if (width * (guint64) height >= (1 << 29))
+        goto out;
+
+    if ((gsize) (parser.p - file_data) + (gsize) width * height * depth > file_data_len)
+        goto out;
+
+    loader = pam_loader_new ();
+    loader->mapping = mapping;
+    loader->image_data = parser.p;
+    loader->width = width;
+    loader->height = height;
+    loader->rowstride = width * depth;
+    loader->pixel_type = depth == 4 ? CHAFA_PIXEL_RGBA8_UNASSOCIATED : CHAFA_PIXEL_RGB8;
+
+    success = TRUE;
+
+out:
+    if (!success && loader)
+    {
+        g_free (loader);
+        loader = NULL;
+    }
+
+    return loader;
+}
+
+void
+pam_loader_destroy (PamLoader *loader)
+{
+    if (loader->mapping)
+        file_mapping_destroy (loader->mapping);
+
+    g_free (loader);
+}
+
+gboolean
+pam_loader_get_is_animation (G_GNUC_UNUSED PamLoader *loader)
+{
+    return FALSE;
+}
+
+gconstpointer
+pam_loader_get_frame_data (PamLoader *loader, ChafaPixelType *pixel_type_out,
+                           gint *width_out, gint *height_out, gint *rowstride_out)
+{
+    g_return_val_if_fail (loader != NULL, NULL);
+
+    if (pixel_type_out)
+        *pixel_type_out = loader->pixel_type;
+    if (width_out)
+        *width_out = loader->width;
+    if (height_out)
+        *height_out = loader->height;
+    if (rowstride_out)
+        *rowstride_out = loader->rowstride;
+
+    return loader->image_data;
+}
+
+gint
+pam_loader_get_frame_delay (G_GNUC_UNUSED PamLoader *loader)
+{
+    return 0;
+}
+
+void
+pam_loader_goto_first_frame (G_GNUC_UNUSED PamLoader *loader)
+{
+}
+
+gboolean
+pam_loader_goto_next_frame (G_GNUC_UNUSED PamLoader *loader)
+{
+    return FALSE;
+}
@@ -0,0 +1,151 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+
+#include <string.h>
+
+#include <chafa.h>
+#include "passthrough.h"
+
+/* Reads just enough of a file's headers to tell whether the terminal could
+ * be given the original file instead of pixels we decoded ourselves. We
+ * turn down anything the terminal might present differently from us, like
+ * animated PNGs and JPEGs with Exif orientation. */
+
+/* Give up on JPEG files with more segments than this before the frame
+ * header. Real files have a handful. */
+#define JPEG_SEGMENTS_MAX 64
+
+static guint32
+get_u32_be (const guint8 *p)
+{
+    return ((guint32) p [0] << 24) | ((guint32) p [1] << 16) | ((guint32) p [2] << 8) | p [3];
+}
+
+static guint16
+get_u16_be (const guint8 *p)
+{
+    return ((guint16) p [0] << 8) | p [1];
+}
+
+static gboolean
+probe_png (FileMapping *mapping, gint *width_out, gint *height_out)
+{
+    guint8 buf [8];
+    goffset ofs;
+
+    if (!file_mapping_has_magic (mapping, 0, "\x89PNG\r\n\x1a\n", 8)
+        || !file_mapping_has_magic (mapping, 12, "IHDR", 4)
+        || !file_mapping_taste (mapping, buf, 16, 8))
+        return FALSE;
+
+    *width_out = get_u32_be (buf);
+    *height_out = get_u32_be (buf + 4);
+
+    /* Walk the chunks up to the image data. An acTL chunk before it means
+     * the file is an APNG. */
+    for (ofs = 8; ; )
+    {
+        if (!file_mapping_taste (mapping, buf, ofs, 8))
+            return FALSE;
+
+        if (!memcmp (buf + 4, "IDAT", 4))
+            break;
+        if (!memcmp (buf + 4, "acTL", 4))
+            return FALSE;
+
+        /* Length, type, data, CRC */
+        ofs += get_u32_be (buf) + 12;
+    }
+
+    return *width_out > 0 && *height_out > 0;
+}
+
+static gboolean
+probe_jpeg (FileMapping *mapping, gint *width_out, gint *height_out)
+{
+    guint8 buf [10];
+    goffset ofs;
+    gint i;
+
+    if (!file_mapping_has_magic (mapping, 0, "\xff\xd8", 2))
+        return FALSE;
+
+    for (ofs = 2, i = 0; i < JPEG_SEGMENTS_MAX; i++)
+    {
+        guint8 marker;
+        guint16 seg_len;
+
+        if (!file_mapping_taste (mapping, buf, ofs, 4)
+            || buf [0] != 0xff)
+            return FALSE;
+
+        marker = buf [1];
+        seg_len = get_u16_be (buf + 2);
+
+        /* Fill bytes */
+        if (marker == 0xff)
+        {
+            ofs++;
+            continue;
+        }
+
+        /* Start of scan without a frame header */
+        if (marker == 0xda || seg_len < 2)
+            return FALSE;
+
+        /* APP1 may hold Exif orientation, which terminals may not apply */
+        if (marker == 0xe1
+            && file_mapping_has_magic (mapping, ofs + 4, "Exif\0\0", 6))
+            return FALSE;
+
+        /* SOFn, except DHT, JPG and DAC which share the range */
+        if (marker >= 0xc0 && marker <= 0xcf
+            && marker != 0xc4 && marker != 0xc8 && marker != 0xcc)
+        {
+            if (!file_mapping_taste (mapping, buf, ofs + 4, 6))
+                return FALSE;
+
+            *height_out = get_u16_be (buf + 1);
+            *width_out = get_u16_be (buf + 3);
+
+            /* Grayscale or YCbCr only; CMYK is hit and miss */
+            if (buf [5] != 1 && buf [5] != 3)
+                return FALSE;
+
+            return *width_out > 0 && *height_out > 0;
+        }
+
+        ofs += seg_len + 2;
+    }
+
+    return FALSE;
+}
+
+PassthroughFormat
+passthrough_probe (FileMapping *mapping, gint *width_out, gint *height_out)
+{
+    if (probe_png (mapping, width_out, height_out))
+        return PASSTHROUGH_FORMAT_PNG;
+    if (probe_jpeg (mapping, width_out, height_out))
+        return PASSTHROUGH_FORMAT_JPEG;
+
+    return PASSTHROUGH_FORMAT_NONE;
+}
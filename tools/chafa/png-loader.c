@@ -29,19 +29,36 @@
 #include <sys/stat.h>
 
 #include <chafa.h>
-#include <lodepng.h>
+#ifdef HAVE_SPNG
+# include <spng.h>
+#else
+# include <lodepng.h>
+#endif
 #include "png-loader.h"
 
 #define BYTES_PER_PIXEL 4
 #define IMAGE_BUFFER_SIZE_MAX 0xffffffffU
 
+/* Non-interlaced images larger than this are decoded a row at a time as
+ * they're scaled */
+#define STREAM_PIXELS_MIN (1 << 24)
+
 struct PngLoader
 {
     FileMapping *mapping;
     const guint8 *file_data;
     size_t file_data_len;
     gpointer frame_data;
-    gint width, height;
+    gint width, height, rowstride;
+    ChafaPixelType pixel_type;
+
+#ifdef HAVE_SPNG
+    /* Streamed images are decoded on demand */
+    gint spng_fmt;
+    spng_ctx *stream_ctx;
+    gint next_row;
+    guint streaming : 1;
+#endif
 };
 
 static PngLoader *
@@ -50,40 +67,157 @@ png_loader_new (void)
     return g_new0 (PngLoader, 1);
 }
 
-PngLoader *
-png_loader_new_from_mapping (FileMapping *mapping)
+#ifdef HAVE_SPNG
+
+static spng_ctx *
+open_spng (PngLoader *loader, struct spng_ihdr *ihdr_out)
 {
-    PngLoader *loader = NULL;
+    spng_ctx *ctx;
+
+    ctx = spng_ctx_new (0);
+    if (!ctx)
+        return NULL;
+
+    if (spng_set_image_limits (ctx, (1 << 28) - 1, (1 << 28) - 1)
+        || spng_set_png_buffer (ctx, loader->file_data, loader->file_data_len)
+        || spng_get_ihdr (ctx, ihdr_out))
+    {
+        spng_ctx_free (ctx);
+        return NULL;
+    }
+
+    return ctx;
+}
+
+/* 8-bit RGB without a transparent color key is used as-is. Everything
+ * else is converted to RGBA. */
+static void
+pick_format (spng_ctx *ctx, const struct spng_ihdr *ihdr, PngLoader *loader)
+{
+    struct spng_trns trns;
+
+    if (ihdr->color_type == SPNG_COLOR_TYPE_TRUECOLOR && ihdr->bit_depth == 8
+        && spng_get_trns (ctx, &trns) != 0)
+    {
+        loader->spng_fmt = SPNG_FMT_RGB8;
+        loader->pixel_type = CHAFA_PIXEL_RGB8;
+        loader->rowstride = loader->width * 3;
+    }
+    else
+    {
+        loader->spng_fmt = SPNG_FMT_RGBA8;
+        loader->pixel_type = CHAFA_PIXEL_RGBA8_UNASSOCIATED;
+        loader->rowstride = loader->width * BYTES_PER_PIXEL;
+    }
+}
+
+static gboolean
+decode_image (PngLoader *loader)
+{
+    struct spng_ihdr ihdr;
+    spng_ctx *ctx;
+    size_t size;
+    gpointer frame_data = NULL;
     gboolean success = FALSE;
-    guint width, height;
-    unsigned char *frame_data = NULL;
-    LodePNGState lode_state;
-    gint lode_error;
 
-    g_return_val_if_fail (mapping != NULL, NULL);
+    ctx = open_spng (loader, &ihdr);
+    if (!ctx)
+        return FALSE;
 
-    lodepng_state_init (&lode_state);
+    if (spng_decoded_image_size (ctx, loader->spng_fmt, &size)
+        || size > IMAGE_BUFFER_SIZE_MAX)
+        goto out;
 
-    if (!file_mapping_has_magic (mapping, 0, "\x89PNG", 4))
+    frame_data = malloc (size);
+    if (!frame_data)
         goto out;
 
-    loader = png_loader_new ();
-    loader->mapping = mapping;
+    if (spng_decode_image (ctx, frame_data, size, loader->spng_fmt, SPNG_DECODE_TRNS))
+        goto out;
 
-    loader->file_data = file_mapping_get_data (loader->mapping, &loader->file_data_len);
-    if (!loader->file_data)
+    loader->frame_data = frame_data;
+    frame_data = NULL;
+    success = TRUE;
+
+out:
+    free (frame_data);
+    spng_ctx_free (ctx);
+    return success;
+}
+
+static gboolean
+load_image (PngLoader *loader)
+{
+    struct spng_ihdr ihdr;
+    spng_ctx *ctx;
+
+    ctx = open_spng (loader, &ihdr);
+    if (!ctx)
+        return FALSE;
+
+    loader->width = ihdr.width;
+    loader->height = ihdr.height;
+    pick_format (ctx, &ihdr, loader);
+    spng_ctx_free (ctx);
+
+    if (loader->width < 1 || loader->height < 1)
+        return FALSE;
+
+    /* Interlaced images deliver their rows out of order */
+    if (ihdr.interlace_method == SPNG_INTERLACE_NONE
+        && loader->width * (guint64) loader->height >= STREAM_PIXELS_MIN)
+    {
+        loader->streaming = TRUE;
+        return TRUE;
+    }
+
+    return decode_image (loader);
+}
+
+#else /* !HAVE_SPNG */
+
+static gboolean
+load_image (PngLoader *loader)
+{
+    LodePNGState lode_state;
+    const LodePNGColorMode *color;
+    LodePNGColorType colortype = LCT_RGBA;
+    unsigned char *frame_data = NULL;
+    guint width, height;
+    gboolean success = FALSE;
+
+    lodepng_state_init (&lode_state);
+    lode_state.decoder.zlibsettings.max_output_size = IMAGE_BUFFER_SIZE_MAX;
+
+    if (lodepng_inspect (&width, &height, &lode_state,
+                         loader->file_data, loader->file_data_len) != 0)
         goto out;
 
-    lode_state.info_raw.colortype = LCT_RGBA;
+    /* When the output format matches the file, lodepng hands over the
+     * unfiltered image without converting or copying it */
+    color = &lode_state.info_png.color;
+    if (color->bitdepth == 8 && color->colortype == LCT_RGB)
+        colortype = LCT_RGB;
+
+retry:
+    lode_state.info_raw.colortype = colortype;
     lode_state.info_raw.bitdepth = 8;
-    lode_state.decoder.zlibsettings.max_output_size = IMAGE_BUFFER_SIZE_MAX;
 
-    /* Decodes to RGBA8 */
-    if ((lode_error = lodepng_decode (&frame_data, &width, &height,
-                                      &lode_state,
-                                      loader->file_data, loader->file_data_len)) != 0)
+    if (lodepng_decode (&frame_data, &width, &height,
+                        &lode_state,
+                        loader->file_data, loader->file_data_len) != 0)
         goto out;
 
+    /* The transparent color key comes after the header, so it's only
+     * known now. Keep it by converting to RGBA after all. */
+    if (colortype == LCT_RGB && lode_state.info_png.color.key_defined)
+    {
+        free (frame_data);
+        frame_data = NULL;
+        colortype = LCT_RGBA;
+        goto retry;
+    }
+
     if (width < 1 || width >= (1 << 28)
         || height < 1 || height >= (1 << 28))
         goto out;
@@ -92,6 +226,49 @@ png_loader_new_from_mapping (FileMapping *mapping)
     loader->width = (gint) width;
     loader->height = (gint) height;
 
+    if (colortype == LCT_RGB)
+    {
+        loader->pixel_type = CHAFA_PIXEL_RGB8;
+        loader->rowstride = loader->width * 3;
+    }
+    else
+    {
+        loader->pixel_type = CHAFA_PIXEL_RGBA8_UNASSOCIATED;
+        loader->rowstride = loader->width * BYTES_PER_PIXEL;
+    }
+
+    frame_data = NULL;
+    success = TRUE;
+
+out:
+    free (frame_data);
+    lodepng_state_cleanup (&lode_state);
+    return success;
+}
+
+#endif /* !HAVE_SPNG */
+
+PngLoader *
+png_loader_new_from_mapping (FileMapping *mapping)
+{
+    PngLoader *loader = NULL;
+    gboolean success = FALSE;
+
+    g_return_val_if_fail (mapping != NULL, NULL);
+
+    if (!file_mapping_has_magic (mapping, 0, "\x89PNG", 4))
+        goto out;
+
+    loader = png_loader_new ();
+    loader->mapping = mapping;
+
+    loader->file_data = file_mapping_get_data (loader->mapping, &loader->file_data_len);
+    if (!loader->file_data)
+        goto out;
+
+    if (!load_image (loader))
+        goto out;
+
     success = TRUE;
 
 out:
@@ -102,12 +279,8 @@ out:
             g_free (loader);
             loader = NULL;
         }
-
-        if (frame_data)
-            free (frame_data);
     }
 
-    lodepng_state_cleanup (&lode_state);
     return loader;
 }
 
@@ -120,6 +293,11 @@ png_loader_destroy (PngLoader *loader)
     if (loader->frame_data)
         free (loader->frame_data);
 
+#ifdef HAVE_SPNG
+    if (loader->stream_ctx)
+        spng_ctx_free (loader->stream_ctx);
+#endif
+
     g_free (loader);
 }
 
@@ -137,18 +315,97 @@ png_loader_get_frame_data (PngLoader *loader, ChafaPixelType *pixel_type_out,
 {
     g_return_val_if_fail (loader != NULL, NULL);
 
+#ifdef HAVE_SPNG
+    /* Streamed images are only decoded in full if someone insists */
+    if (!loader->frame_data && loader->streaming
+        && !decode_image (loader))
+        return NULL;
+#endif
+
     if (pixel_type_out)
-        *pixel_type_out = CHAFA_PIXEL_RGBA8_UNASSOCIATED;
+        *pixel_type_out = loader->pixel_type;
     if (width_out)
         *width_out = loader->width;
     if (height_out)
         *height_out = loader->height;
     if (rowstride_out)
-        *rowstride_out = loader->width * BYTES_PER_PIXEL;
+        *rowstride_out = loader->rowstride;
 
     return loader->frame_data;
 }
 
+/* Returns TRUE if the image can be read with png_loader_read_frame_row (). */
+gboolean
+png_loader_get_frame_rows (PngLoader *loader, ChafaPixelType *pixel_type_out,
+                           gint *width_out, gint *height_out)
+{
+    g_return_val_if_fail (loader != NULL, FALSE);
+
+#ifdef HAVE_SPNG
+    if (!loader->streaming)
+        return FALSE;
+
+    if (pixel_type_out)
+        *pixel_type_out = loader->pixel_type;
+    if (width_out)
+        *width_out = loader->width;
+    if (height_out)
+        *height_out = loader->height;
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+/* Rows must be read in ascending order. Rows that fail to decode come out
+ * transparent, or black if there's no alpha. */
+void
+png_loader_read_frame_row (PngLoader *loader, gint row, gpointer row_out)
+{
+    g_return_if_fail (loader != NULL);
+
+#ifdef HAVE_SPNG
+    g_return_if_fail (loader->streaming);
+    g_return_if_fail (row >= 0 && row < loader->height);
+
+    if (!loader->stream_ctx)
+    {
+        struct spng_ihdr ihdr;
+
+        loader->stream_ctx = open_spng (loader, &ihdr);
+        if (loader->stream_ctx
+            && spng_decode_image (loader->stream_ctx, NULL, 0, loader->spng_fmt,
+                                  SPNG_DECODE_TRNS | SPNG_DECODE_PROGRESSIVE))
+        {
+            spng_ctx_free (loader->stream_ctx);
+            loader->stream_ctx = NULL;
+        }
+
+        loader->next_row = 0;
+    }
+
+    /* Skip ahead if need be. Decoding is sequential anyway. */
+    while (loader->stream_ctx && loader->next_row <= row)
+    {
+        gint ret = spng_decode_row (loader->stream_ctx, row_out, loader->rowstride);
+
+        /* The last row comes with SPNG_EOI */
+        if (ret != 0 && ret != SPNG_EOI)
+        {
+            spng_ctx_free (loader->stream_ctx);
+            loader->stream_ctx = NULL;
+            break;
+        }
+
+        loader->next_row++;
+    }
+
+    if (!loader->stream_ctx)
+        memset (row_out, 0, loader->rowstride);
+#endif
+}
+
 gint
 png_loader_get_frame_delay (PngLoader *loader)
 {
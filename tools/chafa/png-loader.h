@@ -34,6 +34,9 @@ gboolean png_loader_get_is_animation (PngLoader *loader);
 
 gconstpointer png_loader_get_frame_data (PngLoader *loader, ChafaPixelType *pixel_type_out,
                                          gint *width_out, gint *height_out, gint *rowstride_out);
+gboolean png_loader_get_frame_rows (PngLoader *loader, ChafaPixelType *pixel_type_out,
+                                    gint *width_out, gint *height_out);
+void png_loader_read_frame_row (PngLoader *loader, gint row, gpointer row_out);
 gint png_loader_get_frame_delay (PngLoader *loader);
 
 void png_loader_goto_first_frame (PngLoader *loader);
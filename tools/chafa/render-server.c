@@ -0,0 +1,456 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+#include <errno.h>
+#include <stdio.h>  /* sscanf */
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#ifdef HAVE_SYS_UN_H
+# include <sys/socket.h>
+# include <sys/stat.h>  /* S_ISSOCK */
+# include <sys/time.h>  /* struct timeval */
+# include <sys/un.h>
+# define USE_UNIX_SOCKETS 1
+#endif
+
+#include <glib/gstdio.h>
+
+#include "render-server.h"
+
+/* Requests are tiny. Anything bigger than this is not talking to us */
+#define REQUEST_SIZE_MAX 65536
+
+/* How long a client gets to send its request before we move on */
+#define REQUEST_TIMEOUT_S 2
+
+/* Bounds for the sizes in a request. Larger ones are clamped. The pixel
+ * limit is the same one we apply to the local terminal. */
+#define REQUEST_CELLS_MAX 9999
+#define REQUEST_PIXELS_MAX 32767
+
+struct RenderServer
+{
+    gchar *path;
+    gint fd;
+};
+
+void
+render_request_init (RenderRequest *request)
+{
+    request->term_width_cells = request->term_height_cells = -1;
+    request->term_width_pixels = request->term_height_pixels = -1;
+    request->width = request->height = -1;
+    request->filenames = NULL;
+}
+
+void
+render_request_clear (RenderRequest *request)
+{
+    g_list_free_full (request->filenames, g_free);
+    render_request_init (request);
+}
+
+#ifdef USE_UNIX_SOCKETS
+
+static gboolean
+make_address (const gchar *path, struct sockaddr_un *addr, GError **error)
+{
+    memset (addr, 0, sizeof (*addr));
+    addr->sun_family = AF_UNIX;
+
+    if (strlen (path) >= sizeof (addr->sun_path))
+    {
+        g_set_error (error, G_FILE_ERROR, G_FILE_ERROR_NAMETOOLONG,
+                     "Socket path is too long: %s", path);
+        return FALSE;
+    }
+
+    strcpy (addr->sun_path, path);
+    return TRUE;
+}
+
+static void
+set_error_from_errno (GError **error, const gchar *what, const gchar *path)
+{
+    gint saved_errno = errno;
+
+    g_set_error (error, G_FILE_ERROR, g_file_error_from_errno (saved_errno),
+                 "%s %s: %s", what, path, g_strerror (saved_errno));
+}
+
+static gboolean
+write_all (gint fd, const gchar *data, gsize len)
+{
+    while (len > 0)
+    {
+        gssize n = write (fd, data, len);
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return FALSE;
+        }
+
+        data += n;
+        len -= n;
+    }
+
+    return TRUE;
+}
+
+/* -1 means unset. Anything else must be at least 1. */
+static gboolean
+check_request_size (gint *value, gint max)
+{
+    if (*value == -1)
+        return TRUE;
+    if (*value < 1)
+        return FALSE;
+
+    *value = MIN (*value, max);
+    return TRUE;
+}
+
+static gboolean
+parse_request (gchar *text, RenderRequest *request)
+{
+    gchar **lines;
+    gint i;
+
+    lines = g_strsplit (text, "\n", -1);
+
+    for (i = 0; lines [i]; i++)
+    {
+        const gchar *line = lines [i];
+
+        if (g_str_has_prefix (line, "file "))
+        {
+            if (line [5] != '\0')
+                request->filenames = g_list_prepend (request->filenames, g_strdup (line + 5));
+        }
+        else if (g_str_has_prefix (line, "term "))
+        {
+            sscanf (line + 5, "%d %d %d %d",
+                    &request->term_width_cells, &request->term_height_cells,
+                    &request->term_width_pixels, &request->term_height_pixels);
+        }
+        else if (g_str_has_prefix (line, "size "))
+        {
+            sscanf (line + 5, "%d %d", &request->width, &request->height);
+        }
+
+        /* Ignore anything else, so the protocol can grow */
+    }
+
+    g_strfreev (lines);
+    request->filenames = g_list_reverse (request->filenames);
+
+    if (!check_request_size (&request->width, REQUEST_CELLS_MAX)
+        || !check_request_size (&request->height, REQUEST_CELLS_MAX)
+        || !check_request_size (&request->term_width_cells, REQUEST_CELLS_MAX)
+        || !check_request_size (&request->term_height_cells, REQUEST_CELLS_MAX)
+        || !check_request_size (&request->term_width_pixels, REQUEST_PIXELS_MAX)
+        || !check_request_size (&request->term_height_pixels, REQUEST_PIXELS_MAX))
+        return FALSE;
+
+    return request->filenames ? TRUE : FALSE;
+}
+
+/* Reads up to and including the empty line that ends the request */
+static gboolean
+read_request (gint fd, RenderRequest *request)
+{
+    GString *buf = g_string_new (NULL);
+    gboolean result = FALSE;
+
+    for (;;)
+    {
+        gchar chunk [4096];
+        gchar *end;
+        gssize n;
+
+        n = read (fd, chunk, sizeof (chunk));
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+
+        g_string_append_len (buf, chunk, n);
+
+        end = strstr (buf->str, "\n\n");
+        if (end || buf->str [0] == '\n')
+        {
+            if (end)
+                *end = '\0';
+            result = parse_request (buf->str, request);
+            break;
+        }
+
+        if (buf->len > REQUEST_SIZE_MAX)
+            break;
+    }
+
+    g_string_free (buf, TRUE);
+    return result;
+}
+
+static gboolean
+is_socket (const gchar *path)
+{
+    GStatBuf sbuf;
+
+    return g_lstat (path, &sbuf) == 0 && S_ISSOCK (sbuf.st_mode);
+}
+
+/* A socket left behind by a previous server would make bind () fail, so
+ * it's removed. Anything else at the path is left alone, so a mistyped
+ * path can't cost the user a file. */
+static gboolean
+remove_stale_socket (const gchar *path, GError **error)
+{
+    GStatBuf sbuf;
+
+    if (g_lstat (path, &sbuf) < 0)
+    {
+        if (errno == ENOENT)
+            return TRUE;
+
+        set_error_from_errno (error, "Could not check socket path", path);
+        return FALSE;
+    }
+
+    if (!S_ISSOCK (sbuf.st_mode))
+    {
+        g_set_error (error, G_FILE_ERROR, G_FILE_ERROR_EXIST,
+                     "%s exists and is not a socket", path);
+        return FALSE;
+    }
+
+    g_unlink (path);
+    return TRUE;
+}
+
+RenderServer *
+render_server_new (const gchar *path, GError **error)
+{
+    RenderServer *render_server;
+    struct sockaddr_un addr;
+    gint fd;
+
+    if (!make_address (path, &addr, error)
+        || !remove_stale_socket (path, error))
+        return NULL;
+
+    fd = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        set_error_from_errno (error, "Could not create socket for", path);
+        return NULL;
+    }
+
+    if (bind (fd, (struct sockaddr *) &addr, sizeof (addr)) < 0
+        || listen (fd, 16) < 0)
+    {
+        set_error_from_errno (error, "Could not listen on", path);
+        close (fd);
+        return NULL;
+    }
+
+    render_server = g_new0 (RenderServer, 1);
+    render_server->path = g_strdup (path);
+    render_server->fd = fd;
+    return render_server;
+}
+
+void
+render_server_destroy (RenderServer *render_server)
+{
+    close (render_server->fd);
+
+    /* Someone may have replaced it meanwhile */
+    if (is_socket (render_server->path))
+        g_unlink (render_server->path);
+
+    g_free (render_server->path);
+    g_free (render_server);
+}
+
+gint
+render_server_accept (RenderServer *render_server, RenderRequest *request_out)
+{
+    render_request_init (request_out);
+
+    for (;;)
+    {
+        struct timeval tv = { REQUEST_TIMEOUT_S, 0 };
+        gint fd;
+
+        fd = accept (render_server->fd, NULL, NULL);
+        if (fd < 0)
+        {
+            /* Clients may give up before we get to them */
+            if (errno == ECONNABORTED)
+                continue;
+            return -1;
+        }
+
+        /* Don't let a stalled client hold up everyone else */
+        setsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof (tv));
+
+        if (read_request (fd, request_out))
+            return fd;
+
+        render_request_clear (request_out);
+        close (fd);
+    }
+}
+
+static gchar *
+build_request (const RenderRequest *request)
+{
+    GString *buf = g_string_new (NULL);
+    GList *l;
+
+    g_string_append_printf (buf, "term %d %d %d %d\n",
+                            request->term_width_cells, request->term_height_cells,
+                            request->term_width_pixels, request->term_height_pixels);
+    if (request->width > 0 || request->height > 0)
+        g_string_append_printf (buf, "size %d %d\n", request->width, request->height);
+
+    for (l = request->filenames; l; l = g_list_next (l))
+    {
+        const gchar *filename = l->data;
+        gchar *abs_path;
+
+        /* The server has its own working directory */
+        if (g_path_is_absolute (filename))
+        {
+            abs_path = g_strdup (filename);
+        }
+        else
+        {
+            gchar *cwd = g_get_current_dir ();
+            abs_path = g_build_filename (cwd, filename, NULL);
+            g_free (cwd);
+        }
+
+        g_string_append_printf (buf, "file %s\n", abs_path);
+        g_free (abs_path);
+    }
+
+    g_string_append_c (buf, '\n');
+    return g_string_free (buf, FALSE);
+}
+
+gboolean
+render_client_run (const gchar *path, const RenderRequest *request, GError **error)
+{
+    struct sockaddr_un addr;
+    gchar *text;
+    gboolean result = FALSE;
+    gint fd;
+
+    if (!make_address (path, &addr, error))
+        return FALSE;
+
+    fd = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        set_error_from_errno (error, "Could not create socket for", path);
+        return FALSE;
+    }
+
+    if (connect (fd, (struct sockaddr *) &addr, sizeof (addr)) < 0)
+    {
+        set_error_from_errno (error, "Could not connect to", path);
+        close (fd);
+        return FALSE;
+    }
+
+    text = build_request (request);
+    if (!write_all (fd, text, strlen (text)))
+    {
+        set_error_from_errno (error, "Could not send request to", path);
+        goto out;
+    }
+
+    for (;;)
+    {
+        gchar chunk [65536];
+        gssize n;
+
+        n = read (fd, chunk, sizeof (chunk));
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+        {
+            set_error_from_errno (error, "Could not read reply from", path);
+            goto out;
+        }
+        if (n == 0)
+            break;
+
+        if (!write_all (STDOUT_FILENO, chunk, n))
+            goto out;
+    }
+
+    result = TRUE;
+
+out:
+    g_free (text);
+    close (fd);
+    return result;
+}
+
+#else /* !USE_UNIX_SOCKETS */
+
+RenderServer *
+render_server_new (G_GNUC_UNUSED const gchar *path, GError **error)
+{
+    g_set_error (error, G_FILE_ERROR, G_FILE_ERROR_NOSYS,
+                 "Render server is not supported on this platform.");
+    return NULL;
+}
+
+void
+render_server_destroy (G_GNUC_UNUSED RenderServer *render_server)
+{
+}
+
+gint
+render_server_accept (G_GNUC_UNUSED RenderServer *render_server, RenderRequest *request_out)
+{
+    render_request_init (request_out);
+    return -1;
+}
+
+gboolean
+render_client_run (G_GNUC_UNUSED const gchar *path, G_GNUC_UNUSED const RenderRequest *request,
+                   GError **error)
+{
+    g_set_error (error, G_FILE_ERROR, G_FILE_ERROR_NOSYS,
+                 "Render server is not supported on this platform.");
+    return FALSE;
+}
+
+#endif /* !USE_UNIX_SOCKETS */
@@ -0,0 +1,64 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef __RENDER_SERVER_H__
+#define __RENDER_SERVER_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* A request is a series of text lines terminated by an empty line:
+ *
+ *   term COLS ROWS WIDTH_PX HEIGHT_PX
+ *   size WIDTH HEIGHT
+ *   file PATH
+ *
+ * All lines are optional and "file" may be repeated. Unknown dimensions
+ * are given as -1. The reply is the raw output, ending when the server
+ * closes the connection. */
+
+typedef struct
+{
+    gint term_width_cells, term_height_cells;
+    gint term_width_pixels, term_height_pixels;
+    gint width, height;
+    GList *filenames;
+}
+RenderRequest;
+
+typedef struct RenderServer RenderServer;
+
+void render_request_init (RenderRequest *request);
+void render_request_clear (RenderRequest *request);
+
+RenderServer *render_server_new (const gchar *path, GError **error);
+void render_server_destroy (RenderServer *render_server);
+
+/* Waits for the next well-formed request. Returns a descriptor the reply
+ * must be written to and closed by the caller, or -1 if interrupted by a
+ * signal or the socket failed. */
+gint render_server_accept (RenderServer *render_server, RenderRequest *request_out);
+
+/* Sends the request and copies the reply to stdout */
+gboolean render_client_run (const gchar *path, const RenderRequest *request, GError **error);
+
+G_END_DECLS
+
+#endif /* __RENDER_SERVER_H__ */
@@ -59,7 +59,8 @@ svg_loader_new (void)
 }
 
 static void
-calc_dimensions (RsvgHandle *rsvg, guint *width_out, guint *height_out)
+calc_dimensions (RsvgHandle *rsvg, gint target_width, gint target_height,
+                 guint *width_out, guint *height_out)
 {
 #if !LIBRSVG_CHECK_VERSION(2, 52, 0)
     RsvgDimensionData dim = { 0 };
@@ -79,9 +80,18 @@ calc_dimensions (RsvgHandle *rsvg, guint *width_out, guint *height_out)
     height = dim.height;
 #endif
 
-    /* FIXME: It would've been nice to know the size of the final viewport;
-     * that is, the terminal's dimensions in pixels. We could pass this in
-     * if we change the internal API. */
+    /* Don't rasterize at more than the target size. Both dimensions must
+     * cover it, so it works with any aspect the image is fitted to. */
+    if (target_width > 0 && target_height > 0)
+    {
+        gdouble scale = MAX (target_width / width, target_height / height);
+
+        if (scale < 1.0)
+        {
+            width = ceil (width * scale);
+            height = ceil (height * scale);
+        }
+    }
 
     if (width > DIMENSION_MAX || height > DIMENSION_MAX)
     {
@@ -102,7 +112,7 @@ calc_dimensions (RsvgHandle *rsvg, guint *width_out, guint *height_out)
 }
 
 SvgLoader *
-svg_loader_new_from_mapping (FileMapping *mapping)
+svg_loader_new_from_mapping (FileMapping *mapping, gint target_width, gint target_height)
 {
     SvgLoader *loader = NULL;
     gboolean success = FALSE;
@@ -147,7 +157,7 @@ svg_loader_new_from_mapping (FileMapping *mapping)
     if (!rsvg)
         goto out;
 
-    calc_dimensions (rsvg, &width, &height);
+    calc_dimensions (rsvg, target_width, target_height, &width, &height);
     if (width < 1 || width >= (1 << 28)
         || height < 1 || height >= (1 << 28)
         || (width * (guint64) height >= (1 << 29)))
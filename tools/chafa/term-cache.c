@@ -0,0 +1,194 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "config.h"
+#include <stdlib.h>  /* atoi */
+#include <string.h>  /* strcmp */
+#include <unistd.h>
+
+#include <glib/gstdio.h>
+
+#include "term-cache.h"
+
+#define GROUP_NAME "Terminal"
+
+static gboolean
+is_enabled (void)
+{
+    const gchar *value = g_getenv ("CHAFA_TERM_CACHE");
+
+    return value && value [0] && strcmp (value, "0") != 0;
+}
+
+static void
+add_key_part (GChecksum *checksum, const gchar *name, const gchar *value)
+{
+    g_checksum_update (checksum, (const guchar *) name, -1);
+    g_checksum_update (checksum, (const guchar *) "=", 1);
+    if (value)
+        g_checksum_update (checksum, (const guchar *) value, -1);
+    g_checksum_update (checksum, (const guchar *) "\n", 1);
+}
+
+/* The environment variables that matter most to detection, plus the tty
+ * and session, so a new login on a recycled tty doesn't pick up stale
+ * results. Returns NULL if there's no terminal to key on. */
+static gchar *
+get_cache_path (void)
+{
+    GChecksum *checksum;
+    const gchar *tty_name = NULL;
+    gchar *path;
+
+#ifndef G_OS_WIN32
+    gchar sid [32];
+
+    tty_name = ttyname (STDOUT_FILENO);
+    if (!tty_name)
+        return NULL;
+    g_snprintf (sid, sizeof (sid), "%ld", (glong) getsid (0));
+#endif
+
+    checksum = g_checksum_new (G_CHECKSUM_SHA256);
+    add_key_part (checksum, "version", VERSION);
+    add_key_part (checksum, "TERM", g_getenv ("TERM"));
+    add_key_part (checksum, "TERM_PROGRAM", g_getenv ("TERM_PROGRAM"));
+    add_key_part (checksum, "tty", tty_name);
+#ifndef G_OS_WIN32
+    add_key_part (checksum, "session", sid);
+#endif
+
+    path = g_strdup_printf ("%s%schafa%sterm-%s.ini",
+                            g_get_user_runtime_dir (), G_DIR_SEPARATOR_S,
+                            G_DIR_SEPARATOR_S, g_checksum_get_string (checksum));
+    g_checksum_free (checksum);
+    return path;
+}
+
+gboolean
+term_cache_load (ChafaTermInfo **term_info_out, ChafaCanvasMode *mode_out,
+                 ChafaPixelMode *pixel_mode_out)
+{
+    GKeyFile *key_file = NULL;
+    ChafaTermInfo *term_info = NULL;
+    gchar *path = NULL;
+    gchar **keys = NULL;
+    gint mode, pixel_mode;
+    gboolean result = FALSE;
+    gint i;
+
+    if (!is_enabled ())
+        goto out;
+
+    path = get_cache_path ();
+    if (!path)
+        goto out;
+
+    key_file = g_key_file_new ();
+    if (!g_key_file_load_from_file (key_file, path, G_KEY_FILE_NONE, NULL))
+        goto out;
+
+    mode = g_key_file_get_integer (key_file, GROUP_NAME, "canvas-mode", NULL);
+    pixel_mode = g_key_file_get_integer (key_file, GROUP_NAME, "pixel-mode", NULL);
+    if (mode < 0 || mode >= CHAFA_CANVAS_MODE_MAX
+        || pixel_mode < 0 || pixel_mode >= CHAFA_PIXEL_MODE_MAX)
+        goto out;
+
+    term_info = chafa_term_info_new ();
+    keys = g_key_file_get_keys (key_file, GROUP_NAME, NULL, NULL);
+
+    for (i = 0; keys && keys [i]; i++)
+    {
+        gchar *value, *seq_str;
+        gint seq;
+
+        if (!g_str_has_prefix (keys [i], "seq-"))
+            continue;
+
+        seq = atoi (keys [i] + 4);
+        if (seq < 0 || seq >= CHAFA_TERM_SEQ_MAX)
+            goto out;
+
+        value = g_key_file_get_value (key_file, GROUP_NAME, keys [i], NULL);
+        seq_str = value ? g_strcompress (value) : NULL;
+        chafa_term_info_set_seq (term_info, seq, seq_str, NULL);
+        g_free (seq_str);
+        g_free (value);
+    }
+
+    *term_info_out = term_info;
+    *mode_out = mode;
+    *pixel_mode_out = pixel_mode;
+    term_info = NULL;
+    result = TRUE;
+
+out:
+    if (term_info)
+        chafa_term_info_unref (term_info);
+    if (key_file)
+        g_key_file_free (key_file);
+    g_strfreev (keys);
+    g_free (path);
+    return result;
+}
+
+void
+term_cache_store (ChafaTermInfo *term_info, ChafaCanvasMode mode,
+                  ChafaPixelMode pixel_mode)
+{
+    GKeyFile *key_file;
+    gchar *path, *dir;
+    gint seq;
+
+    if (!is_enabled ())
+        return;
+
+    path = get_cache_path ();
+    if (!path)
+        return;
+
+    key_file = g_key_file_new ();
+    g_key_file_set_integer (key_file, GROUP_NAME, "canvas-mode", mode);
+    g_key_file_set_integer (key_file, GROUP_NAME, "pixel-mode", pixel_mode);
+
+    for (seq = 0; seq < CHAFA_TERM_SEQ_MAX; seq++)
+    {
+        const gchar *seq_str = chafa_term_info_get_seq (term_info, seq);
+        gchar key [16];
+        gchar *value;
+
+        if (!seq_str)
+            continue;
+
+        /* Sequences are full of control characters */
+        g_snprintf (key, sizeof (key), "seq-%d", seq);
+        value = g_strescape (seq_str, NULL);
+        g_key_file_set_value (key_file, GROUP_NAME, key, value);
+        g_free (value);
+    }
+
+    /* Failure is harmless; we'll just detect again next time */
+    dir = g_path_get_dirname (path);
+    if (g_mkdir_with_parents (dir, 0700) == 0)
+        g_key_file_save_to_file (key_file, path, NULL);
+
+    g_free (dir);
+    g_key_file_free (key_file);
+    g_free (path);
+}
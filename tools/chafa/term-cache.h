@@ -0,0 +1,39 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/* Copyright (C) 2023 Hans Petter Jansson
+ *
+ * This file is part of Chafa, a program that turns images into character art.
+ *
+ * Chafa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chafa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Chafa.  If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef __TERM_CACHE_H__
+#define __TERM_CACHE_H__
+
+#include <glib.h>
+#include <chafa.h>
+
+G_BEGIN_DECLS
+
+/* Opt-in cache of terminal detection results, enabled by setting
+ * CHAFA_TERM_CACHE=1 in the environment. Entries are kept per terminal
+ * session in the user's runtime directory. */
+
+gboolean term_cache_load (ChafaTermInfo **term_info_out, ChafaCanvasMode *mode_out,
+                          ChafaPixelMode *pixel_mode_out);
+void term_cache_store (ChafaTermInfo *term_info, ChafaCanvasMode mode,
+                       ChafaPixelMode pixel_mode);
+
+G_END_DECLS
+
+#endif /* __TERM_CACHE_H__ */
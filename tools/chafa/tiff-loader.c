@@ -40,18 +40,65 @@
 
 #define BYTES_PER_PIXEL 4
 
-struct TiffLoader
+/* Images larger than this are decoded a strip at a time as they're scaled,
+ * if the file layout allows it */
+#define STREAM_PIXELS_MIN (1 << 24)
+
+/* Upper bound on the size of a decoded strip */
+#define STREAM_STRIP_BYTES_MAX (1 << 26)
+
+/* Strips or tiles each decoding thread should get at the least */
+#define UNITS_PER_THREAD_MIN 4
+
+/* Each TIFF handle reads through its own source, so several handles can
+ * decode from the same mapping at once */
+typedef struct
 {
-    FileMapping *mapping;
     const guint8 *file_data;
     size_t file_data_len;
+    toff_t file_pos;
+}
+TiffSource;
+
+struct TiffLoader
+{
+    FileMapping *mapping;
+    TiffSource source;
     gpointer frame_data;
-    gint width, height;
+    gint width, height, rowstride;
     ChafaPixelType pixel_type;
 
-    toff_t file_pos;
+    /* Pixel type of libtiff's RGBA conversions */
+    ChafaPixelType rgba_pixel_type;
+
+    /* Only kept open when streaming */
+    TIFF *tiff;
+    uint32_t *strip_data;
+    gint rows_per_strip;
+    gint cur_strip;
 };
 
+typedef struct
+{
+    const guint8 *file_data;
+    size_t file_data_len;
+    tdir_t dir;
+
+    guint8 *frame_data;
+    gint width, height, rowstride;
+    gint bytes_per_pixel;
+
+    /* Strips span the image width */
+    gint unit_width, unit_height;
+    gint units_across, n_units;
+    guint tiled : 1;
+    guint native : 1;
+
+    gint next_unit;
+    gint failed;
+}
+DecodeCtx;
+
 /* ----------- *
  * TIFF loader *
  * ----------- */
@@ -61,11 +108,11 @@ struct TiffLoader
 static tsize_t
 my_tiff_read (thandle_t obj, tdata_t buffer, tsize_t size)
 {
-    TiffLoader *loader = (TiffLoader *) obj;
+    TiffSource *source = (TiffSource *) obj;
 
-    size = CLAMP (size, 0, (tsize_t) loader->file_data_len - (tsize_t) loader->file_pos);
-    memcpy (buffer, loader->file_data + loader->file_pos, size);
-    loader->file_pos += size;
+    size = CLAMP (size, 0, (tsize_t) source->file_data_len - (tsize_t) source->file_pos);
+    memcpy (buffer, source->file_data + source->file_pos, size);
+    source->file_pos += size;
 
     return size;
 }
@@ -85,47 +132,47 @@ my_tiff_close (G_GNUC_UNUSED thandle_t obj)
 static toff_t
 my_tiff_seek (thandle_t obj, toff_t pos, int whence)
 {
-    TiffLoader *loader = (TiffLoader *) obj;
+    TiffSource *source = (TiffSource *) obj;
 
     if (whence == SEEK_SET)
     {
-        loader->file_pos = pos;
+        source->file_pos = pos;
     }
     else if (whence == SEEK_CUR)
     {
         /* Since toff_t is unsigned, we can't seek backwards */
-        loader->file_pos += pos;
+        source->file_pos += pos;
     }
     else /* whence == SEEK_END */
     {
         /* Since toff_t is unsigned, this is all we can do */
-        loader->file_pos = loader->file_data_len;
+        source->file_pos = source->file_data_len;
     }
 
-    loader->file_pos = MIN (loader->file_pos, loader->file_data_len);
-    return loader->file_pos;
+    source->file_pos = MIN (source->file_pos, source->file_data_len);
+    return source->file_pos;
 }
 
 static toff_t
 my_tiff_size (thandle_t obj)
 {
-    TiffLoader *loader = (TiffLoader *) obj;
+    TiffSource *source = (TiffSource *) obj;
 
-    return loader->file_data_len;
+    return source->file_data_len;
 }
 
 static int
 my_tiff_map (thandle_t obj, void **base, toff_t *len)
 {
-    TiffLoader *loader = (TiffLoader *) obj;
+    TiffSource *source = (TiffSource *) obj;
 
     /* When the TIFFMap delegate is non-NULL, libtiff will use it preferentially.
      *
      * Our map is read-only, while base points to non-const. Fingers crossed
      * libtiff doesn't actually try to write to it during read operations. */
 
-    *base = (void *) loader->file_data;
-    *len = loader->file_data_len;
+    *base = (void *) source->file_data;
+    *len = source->file_data_len;
     return 0;
 }
 
@@ -146,6 +193,267 @@ my_tiff_warning_handler (G_GNUC_UNUSED const char *module, G_GNUC_UNUSED const c
 {
 }
 
+static TIFF *
+open_tiff (TiffSource *source)
+{
+    return TIFFClientOpen ("Memory", "r", (thandle_t) source,
+                           my_tiff_read, my_tiff_write, my_tiff_seek, my_tiff_close,
+                           my_tiff_size, my_tiff_map, my_tiff_unmap);
+}
+
+/* --- Decoding --- */
+
+/* 8-bit RGB(A) can be decoded straight into a buffer we can use, skipping
+ * libtiff's conversion to packed RGBA */
+static gboolean
+get_native_pixel_type (TIFF *tiff, ChafaPixelType *pixel_type_out, gint *bytes_per_pixel_out)
+{
+    uint16_t photometric;
+    uint16_t bits_per_sample, samples_per_pixel, planar_config, sample_format;
+
+    if (!TIFFGetField (tiff, TIFFTAG_PHOTOMETRIC, &photometric))
+        return FALSE;
+
+    TIFFGetFieldDefaulted (tiff, TIFFTAG_BITSPERSAMPLE, &bits_per_sample);
+    TIFFGetFieldDefaulted (tiff, TIFFTAG_SAMPLESPERPIXEL, &samples_per_pixel);
+    TIFFGetFieldDefaulted (tiff, TIFFTAG_PLANARCONFIG, &planar_config);
+    TIFFGetFieldDefaulted (tiff, TIFFTAG_SAMPLEFORMAT, &sample_format);
+
+    if (photometric != PHOTOMETRIC_RGB
+        || bits_per_sample != 8
+        || planar_config != PLANARCONFIG_CONTIG
+        || sample_format != SAMPLEFORMAT_UINT)
+        return FALSE;
+
+    if (samples_per_pixel == 3)
+    {
+        *pixel_type_out = CHAFA_PIXEL_RGB8;
+    }
+    else if (samples_per_pixel == 4)
+    {
+        const uint16_t *extra_samples = NULL;
+        uint16_t n_extra_samples = 0;
+
+        if (TIFFGetField (tiff, TIFFTAG_EXTRASAMPLES, &n_extra_samples, &extra_samples)
+            && n_extra_samples >= 1 && extra_samples && extra_samples [0] == EXTRASAMPLE_ASSOCALPHA)
+            *pixel_type_out = CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
+        else
+            *pixel_type_out = CHAFA_PIXEL_RGBA8_UNASSOCIATED;
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    *bytes_per_pixel_out = samples_per_pixel;
+    return TRUE;
+}
+
+static gboolean
+decode_unit (DecodeCtx *ctx, TIFF *tiff, gint unit, guint8 *buf)
+{
+    guint8 *dest;
+    gint x0, y0, width, height;
+    gint buf_rows, buf_rowstride;
+    gint i;
+
+    x0 = (unit % ctx->units_across) * ctx->unit_width;
+    y0 = (unit / ctx->units_across) * ctx->unit_height;
+    width = MIN (ctx->unit_width, ctx->width - x0);
+    height = MIN (ctx->unit_height, ctx->height - y0);
+
+    dest = ctx->frame_data + (gsize) y0 * ctx->rowstride + (gsize) x0 * ctx->bytes_per_pixel;
+    buf_rowstride = ctx->unit_width * ctx->bytes_per_pixel;
+
+    if (ctx->native && !ctx->tiled)
+    {
+        /* Strips span whole rows, so they can go straight into place */
+        return TIFFReadEncodedStrip (tiff, unit, dest, (tmsize_t) height * ctx->rowstride) >= 0;
+    }
+    else if (ctx->native)
+    {
+        if (TIFFReadEncodedTile (tiff, unit, buf, (tmsize_t) -1) < 0)
+            return FALSE;
+
+        for (i = 0; i < height; i++)
+            memcpy (dest + (gsize) i * ctx->rowstride,
+                    buf + (gsize) i * buf_rowstride,
+                    width * ctx->bytes_per_pixel);
+        return TRUE;
+    }
+
+    /* The RGBA readers produce bottom-up rasters. Partial tiles are laid
+     * out as if they were whole, while partial strips are not. */
+    if (ctx->tiled)
+    {
+        if (!TIFFReadRGBATile (tiff, x0, y0, (uint32_t *) buf))
+            return FALSE;
+        buf_rows = ctx->unit_height;
+    }
+    else
+    {
+        if (!TIFFReadRGBAStrip (tiff, y0, (uint32_t *) buf))
+            return FALSE;
+        buf_rows = height;
+    }
+
+    for (i = 0; i < height; i++)
+        memcpy (dest + (gsize) i * ctx->rowstride,
+                buf + (gsize) (buf_rows - 1 - i) * buf_rowstride,
+                width * BYTES_PER_PIXEL);
+    return TRUE;
+}
+
+/* Threads pick strips or tiles off a shared counter, since some may take
+ * much longer to decompress than others */
+static gpointer
+decode_thread_func (DecodeCtx *ctx)
+{
+    TiffSource source = { ctx->file_data, ctx->file_data_len, 0 };
+    TIFF *tiff;
+    guint8 *buf = NULL;
+    gboolean success = FALSE;
+    gint unit;
+
+    tiff = open_tiff (&source);
+    if (!tiff || !TIFFSetDirectory (tiff, ctx->dir))
+        goto out;
+
+    if (ctx->native && ctx->tiled)
+        buf = _TIFFmalloc (TIFFTileSize (tiff));
+    else if (!ctx->native)
+        buf = _TIFFmalloc ((gsize) ctx->unit_width * ctx->unit_height * BYTES_PER_PIXEL);
+
+    if ((ctx->tiled || !ctx->native) && !buf)
+        goto out;
+
+    while (!g_atomic_int_get (&ctx->failed)
+           && (unit = g_atomic_int_add (&ctx->next_unit, 1)) < ctx->n_units)
+    {
+        if (!decode_unit (ctx, tiff, unit, buf))
+            goto out;
+    }
+
+    success = TRUE;
+
+out:
+    if (!success)
+        g_atomic_int_set (&ctx->failed, TRUE);
+    if (buf)
+        _TIFFfree (buf);
+    if (tiff)
+        TIFFClose (tiff);
+    return NULL;
+}
+
+/* Rotated images need to be assembled in full before they can be turned
+ * upright, so they're left to libtiff */
+static gboolean
+decode_image_oriented (TiffLoader *loader, TIFF *tiff)
+{
+    uint8_t *frame_data;
+
+    frame_data = _TIFFmalloc (loader->width * (guint64) loader->height * BYTES_PER_PIXEL);
+    if (!frame_data)
+        return FALSE;
+
+    if (!TIFFReadRGBAImageOriented (tiff, loader->width, loader->height,
+                                    (uint32_t *) frame_data, ORIENTATION_TOPLEFT, 0))
+    {
+        _TIFFfree (frame_data);
+        return FALSE;
+    }
+
+    loader->frame_data = frame_data;
+    loader->pixel_type = loader->rgba_pixel_type;
+    loader->rowstride = loader->width * BYTES_PER_PIXEL;
+    return TRUE;
+}
+
+/* Strips and tiles are compressed independently, so they're spread over
+ * threads with a TIFF handle each */
+static gboolean
+decode_image (TiffLoader *loader, TIFF *tiff)
+{
+    DecodeCtx ctx = { 0 };
+    ChafaPixelType pixel_type = loader->rgba_pixel_type;
+    uint16_t orientation = ORIENTATION_TOPLEFT;
+    GThread **threads;
+    gint n_threads;
+    gint i;
+
+    TIFFGetFieldDefaulted (tiff, TIFFTAG_ORIENTATION, &orientation);
+    if (orientation != ORIENTATION_TOPLEFT)
+        return decode_image_oriented (loader, tiff);
+
+    ctx.file_data = loader->source.file_data;
+    ctx.file_data_len = loader->source.file_data_len;
+    ctx.dir = TIFFCurrentDirectory (tiff);
+    ctx.width = loader->width;
+    ctx.height = loader->height;
+
+    ctx.native = get_native_pixel_type (tiff, &pixel_type, &ctx.bytes_per_pixel);
+    if (!ctx.native)
+        ctx.bytes_per_pixel = BYTES_PER_PIXEL;
+
+    if (TIFFIsTiled (tiff))
+    {
+        uint32_t tile_width = 0, tile_height = 0;
+
+        TIFFGetField (tiff, TIFFTAG_TILEWIDTH, &tile_width);
+        TIFFGetField (tiff, TIFFTAG_TILELENGTH, &tile_height);
+        if (tile_width < 1 || tile_height < 1
+            || tile_width * (guint64) tile_height * BYTES_PER_PIXEL > STREAM_STRIP_BYTES_MAX)
+            return decode_image_oriented (loader, tiff);
+
+        ctx.tiled = TRUE;
+        ctx.unit_width = tile_width;
+        ctx.unit_height = tile_height;
+    }
+    else
+    {
+        uint32_t rows_per_strip = 0;
+
+        TIFFGetFieldDefaulted (tiff, TIFFTAG_ROWSPERSTRIP, &rows_per_strip);
+        ctx.unit_width = loader->width;
+        ctx.unit_height = CLAMP (rows_per_strip, 1, (uint32_t) loader->height);
+    }
+
+    ctx.units_across = (ctx.width + ctx.unit_width - 1) / ctx.unit_width;
+    ctx.n_units = ctx.units_across * ((ctx.height + ctx.unit_height - 1) / ctx.unit_height);
+    ctx.rowstride = ctx.width * ctx.bytes_per_pixel;
+
+    ctx.frame_data = _TIFFmalloc ((gsize) ctx.rowstride * ctx.height);
+    if (!ctx.frame_data)
+        return FALSE;
+
+    n_threads = MIN (chafa_get_n_actual_threads (), ctx.n_units / UNITS_PER_THREAD_MIN);
+    n_threads = MAX (n_threads, 1);
+    threads = g_new0 (GThread *, n_threads);
+
+    /* The calling thread pitches in too */
+    for (i = 1; i < n_threads; i++)
+        threads [i] = g_thread_new ("tiff-decoder", (GThreadFunc) decode_thread_func, &ctx);
+
+    decode_thread_func (&ctx);
+
+    for (i = 1; i < n_threads; i++)
+        g_thread_join (threads [i]);
+
+    g_free (threads);
+
+    if (ctx.failed)
+    {
+        _TIFFfree (ctx.frame_data);
+        return FALSE;
+    }
+
+    loader->frame_data = ctx.frame_data;
+    loader->pixel_type = pixel_type;
+    loader->rowstride = ctx.rowstride;
+    return TRUE;
+}
+
 /* --- Loader --- */
 
 static TiffLoader *
@@ -154,15 +462,86 @@ tiff_loader_new (void)
     return g_new0 (TiffLoader, 1);
 }
 
+/* Multi-resolution files (pyramids) may carry reduced-resolution copies of
+ * the main image in later directories. Picks the smallest one that still
+ * covers the target in both dimensions. The main image is directory 0. */
+static tdir_t
+pick_directory (TIFF *tiff, gint target_width, gint target_height)
+{
+    uint32_t width, height;
+    uint32_t best_width, best_height;
+    tdir_t best_dir = 0;
+    tdir_t dir;
+
+    if (target_width < 1 || target_height < 1)
+        return 0;
+
+    if (!TIFFGetField (tiff, TIFFTAG_IMAGEWIDTH, &best_width)
+        || !TIFFGetField (tiff, TIFFTAG_IMAGELENGTH, &best_height))
+        return 0;
+
+    target_width = MIN ((uint32_t) target_width, best_width);
+    target_height = MIN ((uint32_t) target_height, best_height);
+
+    for (dir = 1; TIFFReadDirectory (tiff); dir++)
+    {
+        uint32_t subfile_type = 0;
+
+        if (!TIFFGetField (tiff, TIFFTAG_SUBFILETYPE, &subfile_type)
+            || !(subfile_type & FILETYPE_REDUCEDIMAGE)
+            || !TIFFGetField (tiff, TIFFTAG_IMAGEWIDTH, &width)
+            || !TIFFGetField (tiff, TIFFTAG_IMAGELENGTH, &height))
+            continue;
+
+        if (width >= (uint32_t) target_width && height >= (uint32_t) target_height
+            && width * (guint64) height < best_width * (guint64) best_height)
+        {
+            best_dir = dir;
+            best_width = width;
+            best_height = height;
+        }
+    }
+
+    return best_dir;
+}
+
+/* Strips can be decoded one by one in reading order if the image is stored
+ * top to bottom. Other orientations need the whole image to rotate. */
+static gboolean
+can_stream (TIFF *tiff, uint32_t width, uint32_t height, gint *rows_per_strip_out)
+{
+    uint16_t orientation = ORIENTATION_TOPLEFT;
+    uint32_t rows_per_strip;
+
+    if (width * (guint64) height < STREAM_PIXELS_MIN
+        || TIFFIsTiled (tiff))
+        return FALSE;
+
+    TIFFGetFieldDefaulted (tiff, TIFFTAG_ORIENTATION, &orientation);
+    if (orientation != ORIENTATION_TOPLEFT)
+        return FALSE;
+
+    if (!TIFFGetFieldDefaulted (tiff, TIFFTAG_ROWSPERSTRIP, &rows_per_strip))
+        return FALSE;
+
+    rows_per_strip = MIN (rows_per_strip, height);
+    if (rows_per_strip < 1
+        || width * (guint64) rows_per_strip * BYTES_PER_PIXEL > STREAM_STRIP_BYTES_MAX)
+        return FALSE;
+
+    *rows_per_strip_out = rows_per_strip;
+    return TRUE;
+}
+
 TiffLoader *
-tiff_loader_new_from_mapping (FileMapping *mapping)
+tiff_loader_new_from_mapping (FileMapping *mapping, gint target_width, gint target_height)
 {
     TiffLoader *loader = NULL;
     gboolean success = FALSE;
-    uint8_t *frame_data = NULL;
     TIFF *tiff = NULL;
     gint samples_per_pixel = 4;
     uint32_t width, height;
+    gboolean streaming;
 
     g_return_val_if_fail (mapping != NULL, NULL);
 
@@ -177,8 +556,9 @@ tiff_loader_new_from_mapping (FileMapping *mapping)
 
     /* Get file data */
 
-    loader->file_data = file_mapping_get_data (loader->mapping, &loader->file_data_len);
-    if (!loader->file_data)
+    loader->source.file_data = file_mapping_get_data (loader->mapping,
+                                                      &loader->source.file_data_len);
+    if (!loader->source.file_data)
         goto out;
 
     /* Prepare to decode */
@@ -186,12 +566,13 @@ tiff_loader_new_from_mapping (FileMapping *mapping)
     TIFFSetErrorHandler (my_tiff_error_handler);
     TIFFSetWarningHandler (my_tiff_warning_handler);
 
-    tiff = TIFFClientOpen ("Memory", "r", (thandle_t) loader,
-                           my_tiff_read, my_tiff_write, my_tiff_seek, my_tiff_close,
-                           my_tiff_size, my_tiff_map, my_tiff_unmap);
+    tiff = open_tiff (&loader->source);
     if (!tiff)
         goto out;
 
+    if (!TIFFSetDirectory (tiff, pick_directory (tiff, target_width, target_height)))
+        goto out;
+
     if (!TIFFGetField (tiff, TIFFTAG_IMAGEWIDTH, &width))
         goto out;
     if (!TIFFGetField (tiff, TIFFTAG_IMAGELENGTH, &height))
@@ -200,8 +581,13 @@ tiff_loader_new_from_mapping (FileMapping *mapping)
         goto out;
 
     if (width < 1 || width > (1 << 28)
-        || height < 1 || height > (1 << 28)
-        || (width * (guint64) height >= (1 << 29)))
+        || height < 1 || height > (1 << 28))
+        goto out;
+
+    /* Streamed images are never decoded in full, so the size limit that
+     * applies to the others can be lifted */
+    streaming = can_stream (tiff, width, height, &loader->rows_per_strip);
+    if (!streaming && width * (guint64) height >= (1 << 29))
         goto out;
 
     /* An opaque image with unassociated alpha set to 0xff is equivalent to
@@ -212,7 +598,7 @@ tiff_loader_new_from_mapping (FileMapping *mapping)
      * for an EXTRASAMPLES field, and if it doesn't explicitly specify
      * premultiplied alpha, we fail safe to unassociated alpha. */
 
-    loader->pixel_type = CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
+    loader->rgba_pixel_type = CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
 
     if (samples_per_pixel == 2 || samples_per_pixel >= 4)
     {
@@ -221,23 +607,25 @@ tiff_loader_new_from_mapping (FileMapping *mapping)
 
         if (TIFFGetField (tiff, TIFFTAG_EXTRASAMPLES, &n_extra_samples, &extra_samples)
             && n_extra_samples >= 1 && extra_samples && extra_samples [0] != EXTRASAMPLE_ASSOCALPHA)
-            loader->pixel_type = CHAFA_PIXEL_RGBA8_UNASSOCIATED;
+            loader->rgba_pixel_type = CHAFA_PIXEL_RGBA8_UNASSOCIATED;
     }
 
-    frame_data = _TIFFmalloc (width * height * (guint64) BYTES_PER_PIXEL);
-    if (!frame_data)
-        goto out;
+    loader->width = width;
+    loader->height = height;
 
-    /* Decode and rotate the image */
+    /* Streamed images are decoded on demand */
 
-    if (!TIFFReadRGBAImageOriented (tiff, width, height, (uint32_t *) frame_data, ORIENTATION_TOPLEFT, 0))
+    if (streaming)
+    {
+        loader->tiff = tiff;
+        loader->cur_strip = -1;
+        tiff = NULL;
+        success = TRUE;
         goto out;
+    }
 
-    /* Finish up */
-
-    loader->width = width;
-    loader->height = height;
-    loader->frame_data = frame_data;
+    if (!decode_image (loader, tiff))
+        goto out;
 
     success = TRUE;
 
@@ -247,9 +635,6 @@ out:
 
     if (!success)
     {
-        if (frame_data)
-            _TIFFfree (frame_data);
-
         if (loader)
         {
             g_free (loader);
@@ -269,6 +654,12 @@ tiff_loader_destroy (TiffLoader *loader)
     if (loader->frame_data)
         _TIFFfree (loader->frame_data);
 
+    if (loader->strip_data)
+        _TIFFfree (loader->strip_data);
+
+    if (loader->tiff)
+        TIFFClose (loader->tiff);
+
     g_free (loader);
 }
 
@@ -286,6 +677,13 @@ tiff_loader_get_frame_data (TiffLoader *loader, ChafaPixelType *pixel_type_out,
 {
     g_return_val_if_fail (loader != NULL, NULL);
 
+    /* Streamed images are only decoded in full if someone insists, and
+     * then only if they fit */
+    if (!loader->frame_data && loader->tiff
+        && loader->width * (guint64) loader->height < (1 << 29)
+        && !decode_image (loader, loader->tiff))
+        return NULL;
+
     if (pixel_type_out)
         *pixel_type_out = loader->pixel_type;
     if (width_out)
@@ -293,11 +691,69 @@ tiff_loader_get_frame_data (TiffLoader *loader, ChafaPixelType *pixel_type_out,
     if (height_out)
         *height_out = loader->height;
     if (rowstride_out)
-        *rowstride_out = loader->width * BYTES_PER_PIXEL;
+        *rowstride_out = loader->rowstride;
 
     return loader->frame_data;
 }
 
+/* Returns TRUE if the image can be read with tiff_loader_read_frame_row (). */
+gboolean
+tiff_loader_get_frame_rows (TiffLoader *loader, ChafaPixelType *pixel_type_out,
+                            gint *width_out, gint *height_out)
+{
+    g_return_val_if_fail (loader != NULL, FALSE);
+
+    if (!loader->tiff)
+        return FALSE;
+
+    if (pixel_type_out)
+        *pixel_type_out = loader->rgba_pixel_type;
+    if (width_out)
+        *width_out = loader->width;
+    if (height_out)
+        *height_out = loader->height;
+
+    return TRUE;
+}
+
+/* Rows should be read in ascending order, since each strip is only kept
+ * around until the next one is needed. Rows that fail to decode come out
+ * transparent. */
+void
+tiff_loader_read_frame_row (TiffLoader *loader, gint row, gpointer row_out)
+{
+    gint strip, first_row, n_rows;
+
+    g_return_if_fail (loader != NULL);
+    g_return_if_fail (loader->tiff != NULL);
+    g_return_if_fail (row >= 0 && row < loader->height);
+
+    strip = row / loader->rows_per_strip;
+    first_row = strip * loader->rows_per_strip;
+    n_rows = MIN (loader->rows_per_strip, loader->height - first_row);
+
+    if (!loader->strip_data)
+        loader->strip_data = _TIFFmalloc (loader->width * (guint64) loader->rows_per_strip
+                                          * BYTES_PER_PIXEL);
+
+    if (strip != loader->cur_strip)
+    {
+        if (!loader->strip_data
+            || !TIFFReadRGBAStrip (loader->tiff, first_row, loader->strip_data))
+        {
+            memset (row_out, 0, loader->width * BYTES_PER_PIXEL);
+            return;
+        }
+
+        loader->cur_strip = strip;
+    }
+
+    /* The strip comes out bottom-up */
+    memcpy (row_out,
+            loader->strip_data + (gsize) (n_rows - 1 - (row - first_row)) * loader->width,
+            loader->width * BYTES_PER_PIXEL);
+}
+
 gint
 tiff_loader_get_frame_delay (TiffLoader *loader)
 {
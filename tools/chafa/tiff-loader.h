@@ -27,13 +27,16 @@ G_BEGIN_DECLS
 
 typedef struct TiffLoader TiffLoader;
 
-TiffLoader *tiff_loader_new_from_mapping (FileMapping *mapping);
+TiffLoader *tiff_loader_new_from_mapping (FileMapping *mapping, gint target_width, gint target_height);
 void tiff_loader_destroy (TiffLoader *loader);
 
 gboolean tiff_loader_get_is_animation (TiffLoader *loader);
 
 gconstpointer tiff_loader_get_frame_data (TiffLoader *loader, ChafaPixelType *pixel_type_out,
                                           gint *width_out, gint *height_out, gint *rowstride_out);
+gboolean tiff_loader_get_frame_rows (TiffLoader *loader, ChafaPixelType *pixel_type_out,
+                                     gint *width_out, gint *height_out);
+void tiff_loader_read_frame_row (TiffLoader *loader, gint row, gpointer row_out);
 gint tiff_loader_get_frame_delay (TiffLoader *loader);
 
 void tiff_loader_goto_first_frame (TiffLoader *loader);
@@ -28,6 +28,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#include <webp/decode.h>
 #include <webp/demux.h>
 
 #include <chafa.h>
@@ -47,6 +48,10 @@ struct WebpLoader
     gpointer this_frame_data, next_frame_data;
     gint this_timestamp, next_timestamp;
     guint is_animation : 1;
+
+    /* Still images that can be downscaled are decoded up front, without
+     * the animation decoder */
+    guint is_scaled : 1;
 };
 
 static WebpLoader *
@@ -55,8 +60,62 @@ webp_loader_new (void)
     return g_new0 (WebpLoader, 1);
 }
 
+/* Gets a scaled size that covers the target in both dimensions. Returns
+ * FALSE if the image is no bigger than that already. */
+static gboolean
+calc_scaled_size (gint width, gint height, gint target_width, gint target_height,
+                  gint *width_out, gint *height_out)
+{
+    gdouble scale;
+
+    if (target_width < 1 || target_height < 1)
+        return FALSE;
+
+    scale = MAX (target_width / (gdouble) width, target_height / (gdouble) height);
+    if (scale >= 1.0)
+        return FALSE;
+
+    *width_out = MAX (width * scale + 0.999, 1);
+    *height_out = MAX (height * scale + 0.999, 1);
+    return TRUE;
+}
+
+static gboolean
+decode_scaled (WebpLoader *loader, gint width, gint height)
+{
+    WebPDecoderConfig config;
+
+    if (!WebPInitDecoderConfig (&config))
+        return FALSE;
+
+    config.options.use_scaling = 1;
+    config.options.scaled_width = width;
+    config.options.scaled_height = height;
+    config.options.use_threads = 1;
+
+    loader->this_frame_data = g_malloc (width * height * BYTES_PER_PIXEL);
+
+    config.output.colorspace = MODE_RGBA;
+    config.output.is_external_memory = 1;
+    config.output.u.RGBA.rgba = loader->this_frame_data;
+    config.output.u.RGBA.stride = width * BYTES_PER_PIXEL;
+    config.output.u.RGBA.size = width * height * BYTES_PER_PIXEL;
+
+    if (WebPDecode (loader->file_data, loader->file_data_len, &config) != VP8_STATUS_OK)
+    {
+        g_free (loader->this_frame_data);
+        loader->this_frame_data = NULL;
+        return FALSE;
+    }
+
+    loader->width = width;
+    loader->height = height;
+    loader->is_scaled = TRUE;
+    return TRUE;
+}
+
 WebpLoader *
-webp_loader_new_from_mapping (FileMapping *mapping)
+webp_loader_new_from_mapping (FileMapping *mapping, gint target_width, gint target_height)
 {
     WebpLoader *loader = NULL;
     gboolean success = FALSE;
@@ -64,6 +123,7 @@ webp_loader_new_from_mapping (FileMapping *mapping)
     WebPAnimDecoderOptions anim_dec_options;
     WebPData webp_data;
     WebPAnimInfo anim_info;
+    gint scaled_width, scaled_height;
 
     g_return_val_if_fail (mapping != NULL, NULL);
 
@@ -86,6 +146,21 @@ webp_loader_new_from_mapping (FileMapping *mapping)
     if (WebPGetFeatures (loader->file_data, loader->file_data_len, &features) != VP8_STATUS_OK)
         goto out;
 
+    /* An opaque image with unassociated alpha set to 0xff is equivalent to
+     * premultiplied alpha. This will speed up resampling later on. */
+    loader->pixel_type = features.has_alpha ? CHAFA_PIXEL_RGBA8_UNASSOCIATED : CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
+
+    /* libwebp can only scale while decoding still images */
+    if (!features.has_animation
+        && calc_scaled_size (features.width, features.height,
+                             target_width, target_height,
+                             &scaled_width, &scaled_height)
+        && decode_scaled (loader, scaled_width, scaled_height))
+    {
+        success = TRUE;
+        goto out;
+    }
+
     /* Set up the animation decoder */
 
     webp_data.bytes = loader->file_data;
@@ -120,10 +195,6 @@ webp_loader_new_from_mapping (FileMapping *mapping)
     loader->width = anim_info.canvas_width;
     loader->height = anim_info.canvas_height;
 
-    /* An opaque image with unassociated alpha set to 0xff is equivalent to
-     * premultiplied alpha. This will speed up resampling later on. */
-    loader->pixel_type = features.has_alpha ? CHAFA_PIXEL_RGBA8_UNASSOCIATED : CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
-
     success = TRUE;
 
 out:
@@ -214,6 +285,9 @@ webp_loader_get_frame_delay (WebpLoader *loader)
 
     g_return_val_if_fail (loader != NULL, 0);
 
+    if (loader->is_scaled)
+        return DEFAULT_FRAME_DURATION_MS;
+
     /* The libwebp API complicates this a little. We need to load the next frame
      * in advance to know how long to hold this frame. */
 
@@ -237,6 +311,10 @@ webp_loader_goto_first_frame (WebpLoader *loader)
 {
     g_return_if_fail (loader != NULL);
 
+    /* The one and only frame stays around */
+    if (loader->is_scaled)
+        return;
+
     WebPAnimDecoderReset (loader->anim_dec);
     g_free (loader->this_frame_data);
     loader->this_frame_data = NULL;
@@ -249,6 +327,9 @@ webp_loader_goto_next_frame (WebpLoader *loader)
 {
     g_return_val_if_fail (loader != NULL, FALSE);
 
+    if (loader->is_scaled)
+        return FALSE;
+
     g_free (loader->this_frame_data);
     loader->this_frame_data = loader->next_frame_data;
     loader->next_frame_data = NULL;
@@ -27,7 +27,7 @@ G_BEGIN_DECLS
 
 typedef struct WebpLoader WebpLoader;
 
-WebpLoader *webp_loader_new_from_mapping (FileMapping *mapping);
+WebpLoader *webp_loader_new_from_mapping (FileMapping *mapping, gint target_width, gint target_height);
 void webp_loader_destroy (WebpLoader *loader);
 
 gboolean webp_loader_get_is_animation (WebpLoader *loader);
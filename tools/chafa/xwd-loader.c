@@ -140,25 +140,64 @@ dump_header (XwdHeader *header)
 }
 )
 
+/* Returns the position of a channel's byte within a pixel, or -1 if it
+ * doesn't occupy exactly one byte */
+static gint
+mask_to_byte_index (guint32 mask, gint bytes_per_pixel, gboolean msb_first)
+{
+    gint shift;
+
+    for (shift = 0; shift < bytes_per_pixel * 8; shift += 8)
+    {
+        if (mask == 0xffU << shift)
+            return msb_first ? bytes_per_pixel - 1 - shift / 8 : shift / 8;
+    }
+
+    return -1;
+}
+
+/* Every layout with byte-sized channels has a matching pixel type, so the
+ * pixels can always be used straight from the file, whatever their byte
+ * order */
 static ChafaPixelType
 compute_pixel_type (XwdLoader *loader)
 {
     XwdHeader *h = &loader->header;
+    guint32 red_mask = h->red_mask, green_mask = h->green_mask, blue_mask = h->blue_mask;
+    gint bytes_per_pixel = h->bits_per_pixel / 8;
+    gboolean msb_first = (h->byte_order != 0);
+    gint r, g, b;
+
+    /* Some writers leave the masks out. Assume the X.Org default. */
+    if (!(red_mask | green_mask | blue_mask))
+    {
+        red_mask = 0xff0000;
+        green_mask = 0x00ff00;
+        blue_mask = 0x0000ff;
+    }
+
+    r = mask_to_byte_index (red_mask, bytes_per_pixel, msb_first);
+    g = mask_to_byte_index (green_mask, bytes_per_pixel, msb_first);
+    b = mask_to_byte_index (blue_mask, bytes_per_pixel, msb_first);
 
     if (h->bits_per_pixel == 24)
     {
-        if (h->byte_order == 0)
-            return CHAFA_PIXEL_BGR8;
-        else
+        if (r == 0 && g == 1 && b == 2)
             return CHAFA_PIXEL_RGB8;
+        if (b == 0 && g == 1 && r == 2)
+            return CHAFA_PIXEL_BGR8;
     }
 
     if (h->bits_per_pixel == 32)
     {
-        if (h->byte_order == 0)
+        if (r == 0 && g == 1 && b == 2)
+            return CHAFA_PIXEL_RGBA8_PREMULTIPLIED;
+        if (b == 0 && g == 1 && r == 2)
             return CHAFA_PIXEL_BGRA8_PREMULTIPLIED;
-        else
+        if (r == 1 && g == 2 && b == 3)
             return CHAFA_PIXEL_ARGB8_PREMULTIPLIED;
+        if (b == 1 && g == 2 && r == 3)
+            return CHAFA_PIXEL_ABGR8_PREMULTIPLIED;
     }
 
     return CHAFA_PIXEL_MAX;